@@ -53,6 +53,11 @@ struct OffMeshConnection
  * - Multiple area types with different costs
  * - Off-mesh connections for special traversal
  * - Height field queries for multi-level navigation
+ *
+ * Finalize() links neighbours by hashing shared edges and bins polygon
+ * bounds into a uniform XZ grid, which FindNearestPoly() and the queries
+ * built on it use instead of scanning every polygon. Call Finalize() again
+ * after adding polygons.
  */
 class NavMesh
 {
@@ -116,7 +121,7 @@ public:
     Vec3 ClosestPointOnPoly(NavPolyRef polyRef, const Vec3& position) const;
 
     /**
-     * @brief Get polygon by reference
+     * @brief Get polygon by reference (constant time)
      */
     const NavPoly* GetPoly(NavPolyRef polyRef) const;
 
@@ -186,10 +191,32 @@ private:
 
     NavPolyRef m_nextPolyRef = 1;
 
+    /// XZ bounds of a polygon, indexed like m_polygons
+    struct PolyBounds
+    {
+        float minX = 0.0f;
+        float minZ = 0.0f;
+        float maxX = 0.0f;
+        float maxZ = 0.0f;
+    };
+
+    // Uniform XZ grid over polygon bounds, built by Finalize(). Cell c holds
+    // m_gridPolys[m_gridCellStart[c] .. m_gridCellStart[c + 1]).
+    std::vector<PolyBounds> m_polyBounds;
+    std::vector<uint32> m_gridCellStart;
+    std::vector<uint32> m_gridPolys;
+    float m_gridOriginX = 0.0f;
+    float m_gridOriginZ = 0.0f;
+    float m_gridInvCellSize = 0.0f;
+    uint32 m_gridWidth = 0;
+    uint32 m_gridDepth = 0;
+
     void ComputePolygonCenter(NavPoly& poly);
     void ComputeNeighbors();
     void ComputeBounds();
+    void BuildPolyGrid();
     bool PointInPoly(const NavPoly& poly, const Vec3& position) const;
+    Vec3 ClosestPointOnPoly(const NavPoly& poly, const Vec3& position) const;
 };
 
 } // namespace RVX::AI
@@ -4,14 +4,31 @@
  */
 
 #include "AI/Navigation/NavMesh.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Log.h"
 
 #include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <cstdint>
+#include <span>
 
 namespace RVX::AI
 {
 
+namespace
+{
+    // Polygons per JobSystem batch in Finalize()
+    constexpr size_t kPolysPerJob = 2048;
+
+    struct EdgeRecord
+    {
+        uint64 key = 0;     // (min vertex << 32) | max vertex
+        uint32 poly = 0;    // Index into m_polygons
+        uint32 edge = 0;    // Edge index within the polygon
+    };
+} // namespace
+
 // =========================================================================
 // Queries
 // =========================================================================
@@ -23,78 +40,159 @@ NavPolyRef NavMesh::FindNearestPoly(const Vec3& position, const Vec3& searchExte
         return RVX_NAV_INVALID_POLY;
     }
 
-    // Simple brute force search - use spatial acceleration in production
-    NavPolyRef nearest = RVX_NAV_INVALID_POLY;
-    float nearestDist = FLT_MAX;
+    // A polygon further than this from the position is never returned
+    const float maxDist = glm::length(searchExtent);
+    const bool indexed = m_polyBounds.size() == m_polygons.size() && !m_gridCellStart.empty();
 
-    // Search bounds
-    AABB searchBounds(position - searchExtent, position + searchExtent);
+    // Contained polygons win over nearer ones and ties go to the lowest index,
+    // so the result does not depend on the order candidates are visited in
+    const auto contains = [&](size_t index)
+    {
+        const NavPoly& poly = m_polygons[index];
+        return PointInPoly(poly, position) && std::abs(position.y - poly.center.y) < searchExtent.y;
+    };
 
-    for (const auto& poly : m_polygons)
+    size_t nearest = SIZE_MAX;
+    float nearestDist = FLT_MAX;
+    const auto testNearest = [&](size_t index)
     {
-        // Quick bounds check
-        if (poly.center.x < searchBounds.GetMin().x - 5.0f || 
-            poly.center.x > searchBounds.GetMax().x + 5.0f ||
-            poly.center.z < searchBounds.GetMin().z - 5.0f || 
-            poly.center.z > searchBounds.GetMax().z + 5.0f)
+        if (indexed)
         {
-            continue;
+            // XZ distance to the bounds is a lower bound of the distance to the polygon
+            const PolyBounds& bounds = m_polyBounds[index];
+            const float dx = std::max({bounds.minX - position.x, 0.0f, position.x - bounds.maxX});
+            const float dz = std::max({bounds.minZ - position.z, 0.0f, position.z - bounds.maxZ});
+            const float boundsDistSq = dx * dx + dz * dz;
+            if (boundsDistSq > maxDist * maxDist || boundsDistSq > nearestDist * nearestDist)
+            {
+                return;
+            }
         }
 
-        // Check if point is inside polygon (XZ plane)
-        if (PointInPoly(poly, position))
+        const float dist = glm::length(ClosestPointOnPoly(m_polygons[index], position) - position);
+        if (dist < nearestDist || (dist == nearestDist && index < nearest))
         {
-            // Check height
-            float heightDiff = std::abs(position.y - poly.center.y);
-            if (heightDiff < searchExtent.y)
+            nearestDist = dist;
+            nearest = index;
+        }
+    };
+
+    if (!indexed)
+    {
+        // Not finalized since polygons were added
+        for (size_t index = 0; index < m_polygons.size(); ++index)
+        {
+            if (contains(index))
             {
-                return poly.id;  // Perfect match
+                return m_polygons[index].id;
             }
         }
+        for (size_t index = 0; index < m_polygons.size(); ++index)
+        {
+            testNearest(index);
+        }
+    }
+    else
+    {
+        const int64 width = m_gridWidth;
+        const int64 depth = m_gridDepth;
+        const int64 centerX = static_cast<int64>(std::floor((position.x - m_gridOriginX) * m_gridInvCellSize));
+        const int64 centerZ = static_cast<int64>(std::floor((position.z - m_gridOriginZ) * m_gridInvCellSize));
+        const auto cellPolys = [this](int64 x, int64 z)
+        {
+            const size_t cell = static_cast<size_t>(z * m_gridWidth + x);
+            return std::span<const uint32>(m_gridPolys.data() + m_gridCellStart[cell],
+                                           m_gridCellStart[cell + 1] - m_gridCellStart[cell]);
+        };
+
+        // A containing polygon overlaps the position's cell, clamped the same
+        // way polygon bounds are, and cells list polygons in index order
+        for (uint32 index : cellPolys(std::clamp<int64>(centerX, 0, width - 1), std::clamp<int64>(centerZ, 0, depth - 1)))
+        {
+            if (contains(index))
+            {
+                return m_polygons[index].id;
+            }
+        }
+
+        // Otherwise search rings of cells outward until they are further than
+        // the nearest polygon found. Polygons spanning several cells may be
+        // tested more than once, which cannot change the result.
+        const float cellSize = 1.0f / m_gridInvCellSize;
+        const int64 gridRings = std::max({std::abs(centerX), std::abs(centerX - width + 1),
+                                          std::abs(centerZ), std::abs(centerZ - depth + 1)});
+        const int64 maxRing = static_cast<int64>(std::min(std::ceil(maxDist * m_gridInvCellSize) + 1.0f,
+                                                          static_cast<float>(gridRings)));
 
-        // Otherwise find closest
-        Vec3 closest = ClosestPointOnPoly(poly.id, position);
-        float dist = glm::length(closest - position);
-        if (dist < nearestDist)
+        for (int64 ring = 0; ring <= maxRing; ++ring)
         {
-            nearestDist = dist;
-            nearest = poly.id;
+            if (ring > 0 && static_cast<float>(ring - 1) * cellSize > std::min(nearestDist, maxDist))
+            {
+                break;
+            }
+
+            for (int64 z = std::max<int64>(centerZ - ring, 0); z <= std::min(centerZ + ring, depth - 1); ++z)
+            {
+                const bool fullRow = std::abs(z - centerZ) == ring;
+                const int64 step = fullRow ? 1 : std::max<int64>(2 * ring, 1);
+                for (int64 x = centerX - ring; x <= centerX + ring; x += step)
+                {
+                    if (x < 0 || x >= width)
+                    {
+                        continue;
+                    }
+                    for (uint32 index : cellPolys(x, z))
+                    {
+                        testNearest(index);
+                    }
+                }
+            }
         }
     }
 
     // Check if nearest is within search extent
-    if (nearestDist > glm::length(searchExtent))
+    if (nearest == SIZE_MAX || nearestDist > maxDist)
     {
         return RVX_NAV_INVALID_POLY;
     }
 
-    return nearest;
+    return m_polygons[nearest].id;
 }
 
 Vec3 NavMesh::ClosestPointOnPoly(NavPolyRef polyRef, const Vec3& position) const
 {
     const NavPoly* poly = GetPoly(polyRef);
-    if (!poly || poly->vertexIndices.empty())
+    if (!poly)
+    {
+        return position;
+    }
+
+    return ClosestPointOnPoly(*poly, position);
+}
+
+Vec3 NavMesh::ClosestPointOnPoly(const NavPoly& poly, const Vec3& position) const
+{
+    if (poly.vertexIndices.empty())
     {
         return position;
     }
 
     // Check if point is inside polygon
-    if (PointInPoly(*poly, position))
+    if (PointInPoly(poly, position))
     {
         // Project to polygon height
-        return Vec3(position.x, poly->center.y, position.z);
+        return Vec3(position.x, poly.center.y, position.z);
     }
 
     // Find closest point on edges
-    Vec3 closest = m_vertices[poly->vertexIndices[0]];
+    Vec3 closest = m_vertices[poly.vertexIndices[0]];
     float closestDist = FLT_MAX;
 
-    for (size_t i = 0; i < poly->vertexIndices.size(); ++i)
+    for (size_t i = 0; i < poly.vertexIndices.size(); ++i)
     {
-        size_t j = (i + 1) % poly->vertexIndices.size();
-        const Vec3& a = m_vertices[poly->vertexIndices[i]];
-        const Vec3& b = m_vertices[poly->vertexIndices[j]];
+        size_t j = (i + 1) % poly.vertexIndices.size();
+        const Vec3& a = m_vertices[poly.vertexIndices[i]];
+        const Vec3& b = m_vertices[poly.vertexIndices[j]];
 
         // Project onto edge (XZ plane)
         Vec3 ab = b - a;
@@ -119,15 +217,14 @@ Vec3 NavMesh::ClosestPointOnPoly(NavPolyRef polyRef, const Vec3& position) const
 
 const NavPoly* NavMesh::GetPoly(NavPolyRef polyRef) const
 {
-    // Linear search - use map for large navmeshes
-    for (const auto& poly : m_polygons)
+    // References are handed out in insertion order starting at 1
+    if (polyRef == RVX_NAV_INVALID_POLY || polyRef > m_polygons.size())
     {
-        if (poly.id == polyRef)
-        {
-            return &poly;
-        }
+        return nullptr;
     }
-    return nullptr;
+
+    const NavPoly& poly = m_polygons[polyRef - 1];
+    return poly.id == polyRef ? &poly : nullptr;
 }
 
 bool NavMesh::GetHeight(const Vec3& position, float& outHeight) const
@@ -214,6 +311,11 @@ void NavMesh::Clear()
     m_offMeshConnections.clear();
     m_bounds = AABB();
     m_nextPolyRef = 1;
+    m_polyBounds.clear();
+    m_gridCellStart.clear();
+    m_gridPolys.clear();
+    m_gridWidth = 0;
+    m_gridDepth = 0;
 }
 
 uint32 NavMesh::AddVertex(const Vec3& position)
@@ -249,10 +351,10 @@ void NavMesh::AddOffMeshConnection(const OffMeshConnection& connection)
 void NavMesh::Finalize()
 {
     // Compute polygon centers
-    for (auto& poly : m_polygons)
+    JobSystem::Get().ParallelFor(0, m_polygons.size(), [this](size_t index)
     {
-        ComputePolygonCenter(poly);
-    }
+        ComputePolygonCenter(m_polygons[index]);
+    }, kPolysPerJob);
 
     // Compute neighbors
     ComputeNeighbors();
@@ -260,6 +362,9 @@ void NavMesh::Finalize()
     // Compute bounds
     ComputeBounds();
 
+    // Spatial index for poly queries
+    BuildPolyGrid();
+
     RVX_CORE_INFO("NavMesh: Finalized with {} vertices, {} polygons, {} off-mesh connections",
                   m_vertices.size(), m_polygons.size(), m_offMeshConnections.size());
 }
@@ -286,37 +391,73 @@ void NavMesh::ComputePolygonCenter(NavPoly& poly)
 
 void NavMesh::ComputeNeighbors()
 {
-    // Simple O(n^2) neighbor detection - use spatial hashing for large navmeshes
+    // Every polygon edge keyed by its unordered vertex pair; sorting the keys
+    // puts the polygons sharing an edge next to each other
+    std::vector<uint32> edgeOffsets(m_polygons.size() + 1, 0);
     for (size_t i = 0; i < m_polygons.size(); ++i)
     {
-        for (size_t j = i + 1; j < m_polygons.size(); ++j)
+        edgeOffsets[i + 1] = edgeOffsets[i] + static_cast<uint32>(m_polygons[i].vertexIndices.size());
+    }
+
+    std::vector<EdgeRecord> edges(edgeOffsets.back());
+    JobSystem& jobs = JobSystem::Get();
+    jobs.ParallelFor(0, m_polygons.size(), [&](size_t polyIndex)
+    {
+        NavPoly& poly = m_polygons[polyIndex];
+        poly.neighbors.assign(poly.vertexIndices.size(), RVX_NAV_INVALID_POLY);
+
+        EdgeRecord* out = edges.data() + edgeOffsets[polyIndex];
+        for (size_t e = 0; e < poly.vertexIndices.size(); ++e)
         {
-            // Find shared edges
-            auto& polyA = m_polygons[i];
-            auto& polyB = m_polygons[j];
+            const uint32 v0 = poly.vertexIndices[e];
+            const uint32 v1 = poly.vertexIndices[(e + 1) % poly.vertexIndices.size()];
+            out[e].key = (static_cast<uint64>(std::min(v0, v1)) << 32) | std::max(v0, v1);
+            out[e].poly = static_cast<uint32>(polyIndex);
+            out[e].edge = static_cast<uint32>(e);
+        }
+    }, kPolysPerJob);
 
-            for (size_t ei = 0; ei < polyA.vertexIndices.size(); ++ei)
-            {
-                size_t ei_next = (ei + 1) % polyA.vertexIndices.size();
-                uint32 a0 = polyA.vertexIndices[ei];
-                uint32 a1 = polyA.vertexIndices[ei_next];
+    std::sort(edges.begin(), edges.end(), [](const EdgeRecord& a, const EdgeRecord& b)
+    {
+        if (a.key != b.key) return a.key < b.key;
+        if (a.poly != b.poly) return a.poly < b.poly;
+        return a.edge < b.edge;
+    });
+
+    // Each record writes only its own neighbour slot. With more than two
+    // polygons on an edge, the highest other polygon wins, falling back to the
+    // highest lower one, as the pairwise search used to resolve it.
+    jobs.ParallelFor(0, edges.size(), [&](size_t i)
+    {
+        const EdgeRecord& record = edges[i];
+        size_t runEnd = i + 1;
+        while (runEnd < edges.size() && edges[runEnd].key == record.key)
+        {
+            ++runEnd;
+        }
 
-                for (size_t ej = 0; ej < polyB.vertexIndices.size(); ++ej)
+        uint32 neighbor = UINT32_MAX;
+        if (edges[runEnd - 1].poly > record.poly)
+        {
+            neighbor = edges[runEnd - 1].poly;
+        }
+        else
+        {
+            for (size_t j = i; j-- > 0 && edges[j].key == record.key;)
+            {
+                if (edges[j].poly < record.poly)
                 {
-                    size_t ej_next = (ej + 1) % polyB.vertexIndices.size();
-                    uint32 b0 = polyB.vertexIndices[ej];
-                    uint32 b1 = polyB.vertexIndices[ej_next];
-
-                    // Check if edges match (in opposite direction)
-                    if ((a0 == b1 && a1 == b0) || (a0 == b0 && a1 == b1))
-                    {
-                        polyA.neighbors[ei] = polyB.id;
-                        polyB.neighbors[ej] = polyA.id;
-                    }
+                    neighbor = edges[j].poly;
+                    break;
                 }
             }
         }
-    }
+
+        if (neighbor != UINT32_MAX)
+        {
+            m_polygons[record.poly].neighbors[record.edge] = m_polygons[neighbor].id;
+        }
+    }, kPolysPerJob);
 }
 
 void NavMesh::ComputeBounds()
@@ -335,6 +476,106 @@ void NavMesh::ComputeBounds()
     }
 }
 
+void NavMesh::BuildPolyGrid()
+{
+    m_polyBounds.resize(m_polygons.size());
+    m_gridCellStart.clear();
+    m_gridPolys.clear();
+    m_gridWidth = 0;
+    m_gridDepth = 0;
+
+    if (m_polygons.empty())
+    {
+        return;
+    }
+
+    JobSystem::Get().ParallelFor(0, m_polygons.size(), [this](size_t index)
+    {
+        PolyBounds bounds{FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
+        for (uint32 vertex : m_polygons[index].vertexIndices)
+        {
+            const Vec3& v = m_vertices[vertex];
+            bounds.minX = std::min(bounds.minX, v.x);
+            bounds.minZ = std::min(bounds.minZ, v.z);
+            bounds.maxX = std::max(bounds.maxX, v.x);
+            bounds.maxZ = std::max(bounds.maxZ, v.z);
+        }
+        m_polyBounds[index] = bounds;
+    }, kPolysPerJob);
+
+    // Cells about the size of an average polygon, capped at a few cells per polygon
+    double extentSum = 0.0;
+    for (const PolyBounds& bounds : m_polyBounds)
+    {
+        extentSum += std::max(bounds.maxX - bounds.minX, bounds.maxZ - bounds.minZ);
+    }
+
+    const float sizeX = std::max(m_bounds.GetMax().x - m_bounds.GetMin().x, 1e-3f);
+    const float sizeZ = std::max(m_bounds.GetMax().z - m_bounds.GetMin().z, 1e-3f);
+    float cellSize = std::max(static_cast<float>(extentSum / m_polyBounds.size()), 1e-3f);
+
+    const double maxCells = 4.0 * static_cast<double>(m_polygons.size()) + 16.0;
+    const double cells = std::ceil(sizeX / cellSize) * std::ceil(sizeZ / cellSize);
+    if (cells > maxCells)
+    {
+        cellSize *= static_cast<float>(std::sqrt(cells / maxCells));
+    }
+
+    m_gridOriginX = m_bounds.GetMin().x;
+    m_gridOriginZ = m_bounds.GetMin().z;
+    m_gridInvCellSize = 1.0f / cellSize;
+    m_gridWidth = std::max(1u, static_cast<uint32>(std::ceil(sizeX * m_gridInvCellSize)));
+    m_gridDepth = std::max(1u, static_cast<uint32>(std::ceil(sizeZ * m_gridInvCellSize)));
+
+    const auto cellRange = [this](const PolyBounds& bounds, uint32& x0, uint32& z0, uint32& x1, uint32& z1)
+    {
+        const auto toCell = [this](float value, float origin, uint32 count)
+        {
+            const float cell = std::floor((value - origin) * m_gridInvCellSize);
+            return static_cast<uint32>(std::clamp(cell, 0.0f, static_cast<float>(count - 1)));
+        };
+        x0 = toCell(bounds.minX, m_gridOriginX, m_gridWidth);
+        x1 = toCell(bounds.maxX, m_gridOriginX, m_gridWidth);
+        z0 = toCell(bounds.minZ, m_gridOriginZ, m_gridDepth);
+        z1 = toCell(bounds.maxZ, m_gridOriginZ, m_gridDepth);
+    };
+
+    // Counting sort of polygon indices into cells; cells list polygons in index order
+    m_gridCellStart.assign(static_cast<size_t>(m_gridWidth) * m_gridDepth + 1, 0);
+    for (const PolyBounds& bounds : m_polyBounds)
+    {
+        uint32 x0, z0, x1, z1;
+        cellRange(bounds, x0, z0, x1, z1);
+        for (uint32 z = z0; z <= z1; ++z)
+        {
+            for (uint32 x = x0; x <= x1; ++x)
+            {
+                ++m_gridCellStart[z * m_gridWidth + x + 1];
+            }
+        }
+    }
+
+    for (size_t cell = 1; cell < m_gridCellStart.size(); ++cell)
+    {
+        m_gridCellStart[cell] += m_gridCellStart[cell - 1];
+    }
+
+    m_gridPolys.resize(m_gridCellStart.back());
+    std::vector<uint32> cursor(m_gridCellStart.begin(), m_gridCellStart.end() - 1);
+    for (uint32 index = 0; index < m_polyBounds.size(); ++index)
+    {
+        uint32 x0, z0, x1, z1;
+        cellRange(m_polyBounds[index], x0, z0, x1, z1);
+        for (uint32 z = z0; z <= z1; ++z)
+        {
+            for (uint32 x = x0; x <= x1; ++x)
+            {
+                m_gridPolys[cursor[z * m_gridWidth + x]++] = index;
+            }
+        }
+    }
+}
+
 bool NavMesh::PointInPoly(const NavPoly& poly, const Vec3& position) const
 {
     if (poly.vertexIndices.size() < 3)
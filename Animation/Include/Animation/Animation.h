@@ -44,6 +44,7 @@
 #include "Animation/Runtime/AnimationEvaluator.h"
 #include "Animation/Runtime/AnimationPlayer.h"
 #include "Animation/Runtime/RootMotion.h"
+#include "Animation/Runtime/AnimationBatch.h"
 
 // ============================================================================
 // Blend Module - Animation Blending
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Animation/Runtime/SkeletonPose.h"
+#include "Animation/Runtime/AnimationEvaluator.h"
 #include "Animation/Core/Types.h"
 #include "Animation/Data/AnimationClip.h"
 #include <memory>
@@ -178,6 +179,7 @@ private:
     float m_speed = 1.0f;
     WrapMode m_wrapMode = WrapMode::Loop;
     bool m_finished = false;
+    AnimationEvaluator m_evaluator;   // Kept across frames so the clip binding is cached
 };
 
 } // namespace RVX::Animation
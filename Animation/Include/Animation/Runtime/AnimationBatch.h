@@ -0,0 +1,162 @@
+/**
+ * @file AnimationBatch.h
+ * @brief Parallel pose evaluation for many characters into one skinning palette
+ *
+ * Evaluating characters one at a time as their components tick keeps a
+ * crowd on a single core. The batch evaluates every registered state
+ * machine in parallel on the JobSystem and packs the skinning matrices of
+ * all characters into one contiguous buffer, ready for a single upload.
+ */
+
+#pragma once
+
+#include "Animation/Runtime/SkeletonPose.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace RVX::Animation
+{
+
+class AnimationStateMachine;
+
+/**
+ * @brief Per-frame statistics of an AnimationBatch
+ */
+struct AnimationBatchStats
+{
+    size_t instanceCount = 0;       ///< Instances evaluated or interpolated this frame
+    size_t evaluatedCount = 0;      ///< Instances whose state machine was evaluated
+    size_t interpolatedCount = 0;   ///< Instances shown between two evaluations
+    size_t paletteSize = 0;         ///< Matrices in the palette
+};
+
+/**
+ * @brief Evaluates many state machines in parallel into one skinning palette
+ *
+ * The owner advances each state machine (AnimationStateMachine::Advance)
+ * on its own thread, then calls Evaluate() once per frame. Evaluate() lays
+ * out the palette serially, then evaluates poses and skinning matrices in
+ * parallel jobs, one instance per job index. Each state machine must be
+ * registered at most once.
+ *
+ * An instance with an update interval of N evaluates its state machine
+ * every Nth frame and blends between its last two evaluated poses on the
+ * frames in between, trading N - 1 frames of latency for 1/N of the cost.
+ * Instances sharing an interval are staggered so their evaluations spread
+ * over the frames.
+ *
+ * Usage:
+ * @code
+ * AnimationBatch batch;
+ * auto handle = batch.Add(fsm.get());
+ * batch.SetUpdateInterval(handle, 4);  // Far away: evaluate every 4th frame
+ *
+ * // Each frame
+ * fsm->Advance(deltaTime);
+ * batch.Evaluate();
+ * UploadBones(batch.GetPalette());
+ * DrawSkinned(batch.GetPaletteOffset(handle));
+ * @endcode
+ */
+class AnimationBatch
+{
+public:
+    using Handle = uint32_t;
+    static constexpr Handle InvalidHandle = ~0u;
+
+    AnimationBatch() = default;
+    ~AnimationBatch() = default;
+
+    AnimationBatch(const AnimationBatch&) = delete;
+    AnimationBatch& operator=(const AnimationBatch&) = delete;
+
+    // =========================================================================
+    // Instances
+    // =========================================================================
+
+    /// Register a state machine; the batch does not own it
+    Handle Add(AnimationStateMachine* stateMachine);
+
+    /// Unregister an instance; its handle may be reused
+    void Remove(Handle handle);
+
+    /// Unregister all instances
+    void Clear();
+
+    /// Check if a handle refers to a registered instance
+    bool IsValid(Handle handle) const;
+
+    /// Get the state machine of an instance
+    AnimationStateMachine* GetStateMachine(Handle handle) const;
+
+    /// Number of registered instances
+    size_t GetInstanceCount() const { return m_instanceCount; }
+
+    // =========================================================================
+    // Update Rate
+    // =========================================================================
+
+    /// Evaluate every Nth frame and interpolate in between (1 = every frame)
+    void SetUpdateInterval(Handle handle, uint32_t frames);
+    uint32_t GetUpdateInterval(Handle handle) const;
+
+    // =========================================================================
+    // Evaluation
+    // =========================================================================
+
+    /**
+     * @brief Evaluate all instances and rebuild the palette
+     *
+     * Runs in parallel on the JobSystem, or serially if it is not
+     * initialized. State machines must not be advanced concurrently.
+     */
+    void Evaluate();
+
+    /// Skinning matrices of all instances, each instance contiguous
+    const std::vector<Mat4>& GetPalette() const { return m_palette; }
+
+    /// First palette matrix of an instance
+    size_t GetPaletteOffset(Handle handle) const;
+
+    /// Number of palette matrices of an instance
+    size_t GetPaletteCount(Handle handle) const;
+
+    /// Pose shown this frame (evaluated or interpolated), or nullptr
+    const SkeletonPose* GetPose(Handle handle) const;
+
+    /// Statistics of the last Evaluate()
+    const AnimationBatchStats& GetStats() const { return m_stats; }
+
+private:
+    struct Instance
+    {
+        AnimationStateMachine* stateMachine = nullptr;
+        uint32_t updateInterval = 1;
+        uint32_t phase = 0;             ///< Frames since the last evaluation
+        bool hasHistory = false;
+        bool evaluated = false;         ///< Evaluated during the last Evaluate()
+
+        size_t paletteOffset = 0;
+        size_t paletteCount = 0;
+        const SkeletonPose* pose = nullptr;
+
+        // Poses for interpolated update rates
+        SkeletonPose previous;
+        SkeletonPose latest;
+        SkeletonPose display;
+    };
+
+    void EvaluateInstance(Instance& instance);
+
+    // Boxed so poses keep their address while instances are added
+    std::vector<std::unique_ptr<Instance>> m_instances;
+    std::vector<Handle> m_freeHandles;
+    std::vector<Handle> m_active;
+    size_t m_instanceCount = 0;
+
+    std::vector<Mat4> m_palette;
+    AnimationBatchStats m_stats;
+};
+
+} // namespace RVX::Animation
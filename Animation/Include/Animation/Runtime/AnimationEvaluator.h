@@ -12,6 +12,7 @@
 #include "Animation/Core/Interpolation.h"
 #include "Animation/Data/AnimationClip.h"
 #include "Animation/Runtime/SkeletonPose.h"
+#include <memory>
 #include <unordered_map>
 
 namespace RVX::Animation
@@ -53,9 +54,35 @@ struct EvaluationResult
     std::vector<std::string> triggeredEvents;
 };
 
+/**
+ * @brief Track-to-bone mapping for one (clip, skeleton) pair
+ *
+ * Resolving track target names against the skeleton is a string lookup
+ * per track; the binding does it once and is reused on every evaluation.
+ */
+struct ClipBinding
+{
+    /// Bone index for each transform track (-1 = no such bone)
+    std::vector<int> trackToBone;
+
+    /// Number of tracks that resolved to a bone
+    size_t boundTrackCount = 0;
+
+    // Validation: a binding is rebuilt if any of these no longer match
+    const TransformTrack* tracks = nullptr;
+    size_t trackCount = 0;
+    size_t boneCount = 0;
+    std::weak_ptr<const Skeleton> skeleton;
+};
+
 /**
  * @brief Animation clip evaluator
  * 
+ * Track-to-bone bindings are cached per (clip, skeleton) pair, so keep an
+ * evaluator alive across frames rather than creating one per evaluation.
+ * Clips and skeletons are treated as immutable once bound; call
+ * ClearCache() after editing one in place.
+ * 
  * Samples animation clips at specific times to produce poses.
  * Handles interpolation between keyframes and wrap modes.
  * 
@@ -172,15 +199,26 @@ public:
     // Caching for Performance
     // =========================================================================
 
+    /**
+     * @brief Get the track-to-bone binding for a clip and skeleton
+     *
+     * Built on first use and cached until ClearCache().
+     */
+    const ClipBinding& GetBinding(const AnimationClip& clip, const Skeleton::ConstPtr& skeleton);
+
     /**
      * @brief Enable keyframe hint caching for faster sequential playback
      */
     void EnableCaching(bool enable) { m_cachingEnabled = enable; }
 
     /**
-     * @brief Clear cached keyframe hints
+     * @brief Clear cached keyframe hints and clip bindings
      */
-    void ClearCache() { m_keyframeHints.clear(); }
+    void ClearCache()
+    {
+        m_keyframeHints.clear();
+        m_bindings.clear();
+    }
 
     /**
      * @brief Set the cache key for the current evaluation context
@@ -189,6 +227,26 @@ public:
     void SetCacheContext(uint64_t contextId) { m_cacheContext = contextId; }
 
 private:
+    struct BindingKey
+    {
+        const AnimationClip* clip;
+        const Skeleton* skeleton;
+
+        bool operator==(const BindingKey& other) const
+        {
+            return clip == other.clip && skeleton == other.skeleton;
+        }
+    };
+
+    struct BindingKeyHash
+    {
+        size_t operator()(const BindingKey& key) const
+        {
+            size_t h = std::hash<const void*>{}(key.clip);
+            return h ^ (std::hash<const void*>{}(key.skeleton) + 0x9e3779b9 + (h << 6) + (h >> 2));
+        }
+    };
+
     // Helper methods
     TimeUs ApplyTimeWrapping(TimeUs time, TimeUs duration, WrapMode mode);
     
@@ -207,6 +265,7 @@ private:
     bool m_cachingEnabled = true;
     uint64_t m_cacheContext = 0;
     std::unordered_map<uint64_t, int> m_keyframeHints;
+    std::unordered_map<BindingKey, ClipBinding, BindingKeyHash> m_bindings;
 };
 
 } // namespace RVX::Animation
@@ -4,6 +4,10 @@
  * 
  * A pose represents the current state of all bones in a skeleton.
  * Poses can be sampled from animations, blended together, and applied to meshes.
+ *
+ * Local transforms are stored as separate translation, rotation and scale
+ * arrays (structure of arrays) so blending and matrix composition run as
+ * straight loops over contiguous floats.
  */
 
 #pragma once
@@ -13,6 +17,7 @@
 #include "Core/MathTypes.h"
 #include <vector>
 #include <memory>
+#include <optional>
 
 namespace RVX::Animation
 {
@@ -22,6 +27,10 @@ namespace RVX::Animation
  * 
  * Contains local transforms for each bone that can be blended
  * and computed into final skinning matrices.
+ *
+ * Blending interpolates rotations with a normalized lerp along the
+ * shortest arc rather than a slerp; for the small angles between poses
+ * being blended the two are visually identical.
  */
 class SkeletonPose
 {
@@ -65,28 +74,41 @@ public:
     void SetSkeleton(Skeleton::ConstPtr skeleton);
 
     /// Get number of bones in the pose
-    size_t GetBoneCount() const { return m_localTransforms.size(); }
+    size_t GetBoneCount() const { return m_translations.size(); }
 
     /// Check if the pose is valid
-    bool IsValid() const { return !m_localTransforms.empty(); }
+    bool IsValid() const { return !m_translations.empty(); }
 
     // =========================================================================
     // Local Transforms (Bone Space)
     // =========================================================================
 
-    /// Get all local transforms
-    const std::vector<TransformSample>& GetLocalTransforms() const { return m_localTransforms; }
-    std::vector<TransformSample>& GetLocalTransforms() { return m_localTransforms; }
+    /// Get all local translations, one per bone
+    const std::vector<Vec3>& GetTranslations() const { return m_translations; }
 
-    /// Get a single local transform
-    const TransformSample& GetLocalTransform(size_t boneIndex) const;
-    TransformSample& GetLocalTransform(size_t boneIndex);
+    /// Get all local rotations, one per bone
+    const std::vector<Quat>& GetRotations() const { return m_rotations; }
+
+    /// Get all local scales, one per bone
+    const std::vector<Vec3>& GetScales() const { return m_scales; }
+
+    /// Mutable access to local translations (marks global transforms dirty)
+    std::vector<Vec3>& GetTranslations() { MarkDirty(); return m_translations; }
+
+    /// Mutable access to local rotations (marks global transforms dirty)
+    std::vector<Quat>& GetRotations() { MarkDirty(); return m_rotations; }
+
+    /// Mutable access to local scales (marks global transforms dirty)
+    std::vector<Vec3>& GetScales() { MarkDirty(); return m_scales; }
+
+    /// Get a single local transform (identity if out of range)
+    TransformSample GetLocalTransform(size_t boneIndex) const;
 
     /// Set a local transform
     void SetLocalTransform(size_t boneIndex, const TransformSample& transform);
 
     /// Get local transform by bone name
-    const TransformSample* GetLocalTransform(const std::string& boneName) const;
+    std::optional<TransformSample> GetLocalTransform(const std::string& boneName) const;
 
     // =========================================================================
     // Global Transforms (Model Space)
@@ -102,7 +124,7 @@ public:
     bool AreGlobalTransformsDirty() const { return m_globalsDirty; }
 
     /// Mark global transforms as dirty (need recomputation)
-    void MarkGlobalTransformsDirty() { m_globalsDirty = true; }
+    void MarkGlobalTransformsDirty() { MarkDirty(); }
 
     // =========================================================================
     // Skinning Matrices
@@ -176,9 +198,21 @@ public:
     void CopyBones(const SkeletonPose& other, const std::vector<int>& boneIndices);
 
 private:
+    void MarkDirty()
+    {
+        m_globalsDirty = true;
+        m_skinningDirty = true;
+    }
+
+    void Resize(size_t boneCount);
+    void AssignSkeleton(const Skeleton::ConstPtr& skeleton);
+
     Skeleton::ConstPtr m_skeleton;
+    std::vector<int> m_parentIndices;                  // Copied from the skeleton for the hierarchy pass
     
-    std::vector<TransformSample> m_localTransforms;   // Bone-local transforms
+    std::vector<Vec3> m_translations;                  // Bone-local translations
+    std::vector<Quat> m_rotations;                     // Bone-local rotations
+    std::vector<Vec3> m_scales;                        // Bone-local scales
     std::vector<Mat4> m_globalTransforms;              // Model-space transforms
     std::vector<Mat4> m_skinningMatrices;              // Final skinning matrices
     
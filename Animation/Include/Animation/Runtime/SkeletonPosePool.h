@@ -0,0 +1,78 @@
+/**
+ * @file SkeletonPosePool.h
+ * @brief Per-thread scratch poses for intermediate blend results
+ *
+ * Blending a clip or a blend-tree child needs a temporary pose. Allocating
+ * one per evaluation costs several heap allocations per character per
+ * frame; the pool keeps the poses alive and hands them out again.
+ */
+
+#pragma once
+
+#include "Animation/Runtime/SkeletonPose.h"
+#include <memory>
+#include <vector>
+
+namespace RVX::Animation
+{
+
+/**
+ * @brief Thread-local stack of reusable scratch poses
+ *
+ * Poses are borrowed in stack order, so nested evaluations (a blend tree
+ * inside a blend tree) each get their own pose. Each thread has its own
+ * pool, so no locking is needed when characters are evaluated in parallel.
+ *
+ * Usage:
+ * @code
+ * auto scratch = SkeletonPosePool::Acquire(pose.GetSkeleton());
+ * evaluator.Evaluate(clip, time, *scratch);
+ * pose.BlendWith(*scratch, weight);
+ * // Returned to the pool when scratch goes out of scope
+ * @endcode
+ */
+class SkeletonPosePool
+{
+public:
+    /**
+     * @brief A borrowed pose, returned to the pool on destruction
+     */
+    class Handle
+    {
+    public:
+        Handle(Handle&& other) noexcept : m_pose(other.m_pose) { other.m_pose = nullptr; }
+        Handle& operator=(Handle&&) = delete;
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        ~Handle();
+
+        SkeletonPose& operator*() const { return *m_pose; }
+        SkeletonPose* operator->() const { return m_pose; }
+        SkeletonPose* Get() const { return m_pose; }
+
+    private:
+        friend class SkeletonPosePool;
+        explicit Handle(SkeletonPose* pose) : m_pose(pose) {}
+
+        SkeletonPose* m_pose = nullptr;
+    };
+
+    /**
+     * @brief Borrow a scratch pose for a skeleton, reset to its bind pose
+     *
+     * Handles must be released in reverse order of acquisition, which
+     * scoped use guarantees.
+     */
+    static Handle Acquire(const Skeleton::ConstPtr& skeleton);
+
+    /// Number of poses currently borrowed on the calling thread
+    static size_t GetActiveCount();
+
+    /// Number of poses allocated on the calling thread
+    static size_t GetPooledCount();
+
+private:
+    static void Release(SkeletonPose* pose);
+};
+
+} // namespace RVX::Animation
@@ -11,6 +11,7 @@
 #include "Animation/Blend/BlendNode.h"
 #include "Animation/Blend/BlendTree.h"
 #include "Animation/Runtime/SkeletonPose.h"
+#include "Animation/Runtime/AnimationEvaluator.h"
 #include "Animation/Core/Types.h"
 #include <memory>
 #include <string>
@@ -203,6 +204,7 @@ private:
     bool m_finished = false;
     
     TimeUs m_currentTime = 0;
+    AnimationEvaluator m_evaluator;   // Kept across frames so the clip binding is cached
     
     StateCallback m_onEnter;
     StateCallback m_onExit;
@@ -213,9 +213,27 @@ public:
     /**
      * @brief Update the state machine
      * @param deltaTime Time since last update in seconds
+     *
+     * Equivalent to Advance() followed by EvaluateOutputPose().
      */
     void Update(float deltaTime);
 
+    /**
+     * @brief Advance state time and transitions without evaluating the pose
+     *
+     * Runs state-change callbacks and consumes triggers, so call it from the
+     * thread that owns the state machine.
+     */
+    void Advance(float deltaTime);
+
+    /**
+     * @brief Evaluate the output pose for the current state and transition
+     *
+     * Touches only this state machine and its poses, so different state
+     * machines can be evaluated on different threads at once.
+     */
+    void EvaluateOutputPose();
+
     /**
      * @brief Get the output pose
      */
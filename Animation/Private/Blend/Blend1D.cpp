@@ -5,8 +5,10 @@
 
 #include "Animation/Blend/Blend1D.h"
 #include "Animation/Blend/BlendNode.h"
+#include "Animation/Runtime/SkeletonPosePool.h"
 #include <algorithm>
 #include <cmath>
+#include <optional>
 
 namespace RVX::Animation
 {
@@ -73,7 +75,7 @@ float Blend1D::Evaluate(const BlendContext& context, SkeletonPose& outPose)
 
     // Blend multiple entries
     bool firstPose = true;
-    SkeletonPose tempPose;
+    std::optional<SkeletonPosePool::Handle> tempPose;
     
     for (size_t i = 0; i < m_entries.size(); ++i)
     {
@@ -87,12 +89,12 @@ float Blend1D::Evaluate(const BlendContext& context, SkeletonPose& outPose)
         }
         else
         {
-            if (tempPose.GetBoneCount() != outPose.GetBoneCount())
+            if (!tempPose)
             {
-                tempPose.SetSkeleton(outPose.GetSkeleton());
+                tempPose.emplace(SkeletonPosePool::Acquire(outPose.GetSkeleton()));
             }
-            m_entries[i].node->Evaluate(context, tempPose);
-            outPose.BlendWith(tempPose, m_weights[i]);
+            m_entries[i].node->Evaluate(context, **tempPose);
+            outPose.BlendWith(**tempPose, m_weights[i]);
         }
     }
 
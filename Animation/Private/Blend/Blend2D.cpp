@@ -5,8 +5,10 @@
 
 #include "Animation/Blend/Blend2D.h"
 #include "Animation/Blend/BlendNode.h"
+#include "Animation/Runtime/SkeletonPosePool.h"
 #include <algorithm>
 #include <cmath>
+#include <optional>
 
 namespace RVX::Animation
 {
@@ -87,7 +89,7 @@ float Blend2D::Evaluate(const BlendContext& context, SkeletonPose& outPose)
 
     // Blend entries
     bool firstPose = true;
-    SkeletonPose tempPose;
+    std::optional<SkeletonPosePool::Handle> tempPose;
     float totalWeight = 0.0f;
 
     for (auto& entry : m_entries)
@@ -118,12 +120,12 @@ float Blend2D::Evaluate(const BlendContext& context, SkeletonPose& outPose)
         }
         else
         {
-            if (tempPose.GetBoneCount() != outPose.GetBoneCount())
+            if (!tempPose)
             {
-                tempPose.SetSkeleton(outPose.GetSkeleton());
+                tempPose.emplace(SkeletonPosePool::Acquire(outPose.GetSkeleton()));
             }
-            entry.node->Evaluate(context, tempPose);
-            outPose.BlendWith(tempPose, normalizedWeight);
+            entry.node->Evaluate(context, **tempPose);
+            outPose.BlendWith(**tempPose, normalizedWeight);
         }
     }
 
@@ -49,11 +49,10 @@ float ClipNode::Evaluate(const BlendContext& context, SkeletonPose& outPose)
     if (!m_clip || !m_active)
         return 0.0f;
 
-    AnimationEvaluator evaluator;
     EvaluationOptions options;
     options.wrapModeOverride = m_wrapMode;
     
-    evaluator.Evaluate(*m_clip, m_currentTime, outPose, options);
+    m_evaluator.Evaluate(*m_clip, m_currentTime, outPose, options);
     
     return m_weight;
 }
@@ -319,7 +319,7 @@ void FABRIK::ApplyToSkeleton(SkeletonPose& pose, const std::vector<Vec3>& positi
 {
     if (!m_skeleton) return;
 
-    auto& localTransforms = pose.GetLocalTransforms();
+    auto& localRotations = pose.GetRotations();
     const auto& bones = m_skeleton->bones;
 
     // Calculate rotations for each bone in the chain
@@ -369,8 +369,8 @@ void FABRIK::ApplyToSkeleton(SkeletonPose& pose, const std::vector<Vec3>& positi
 
             // Convert to local space and apply
             // Note: This is simplified - proper implementation needs parent inverse
-            localTransforms[boneIdx].rotation = 
-                normalize(deltaRot * localTransforms[boneIdx].rotation);
+            localRotations[boneIdx] = 
+                normalize(deltaRot * localRotations[boneIdx]);
         }
     }
 
@@ -147,7 +147,7 @@ bool TwoBoneIK::Solve(SkeletonPose& pose, const IKTarget& target)
     Vec3 newTipPos = newMidPos + lowerDir * m_lowerLength;
 
     // Calculate rotations and apply to pose
-    auto& localTransforms = pose.GetLocalTransforms();
+    auto& localRotations = pose.GetRotations();
 
     // Root bone rotation
     {
@@ -159,8 +159,8 @@ bool TwoBoneIK::Solve(SkeletonPose& pose, const IKTarget& target)
             deltaRot = slerp(Quat(1, 0, 0, 0), deltaRot, m_weight);
         }
         
-        localTransforms[m_rootBoneIndex].rotation = 
-            normalize(deltaRot * localTransforms[m_rootBoneIndex].rotation);
+        localRotations[m_rootBoneIndex] = 
+            normalize(deltaRot * localRotations[m_rootBoneIndex]);
     }
 
     // Mid bone rotation
@@ -174,17 +174,17 @@ bool TwoBoneIK::Solve(SkeletonPose& pose, const IKTarget& target)
             deltaRot = slerp(Quat(1, 0, 0, 0), deltaRot, m_weight);
         }
         
-        localTransforms[m_midBoneIndex].rotation = 
-            normalize(deltaRot * localTransforms[m_midBoneIndex].rotation);
+        localRotations[m_midBoneIndex] = 
+            normalize(deltaRot * localRotations[m_midBoneIndex]);
     }
 
     // Apply tip rotation for end effector orientation
     if (target.rotationWeight > 0.001f)
     {
         Quat targetRot = target.rotation;
-        Quat currentRot = localTransforms[m_tipBoneIndex].rotation;
+        Quat currentRot = localRotations[m_tipBoneIndex];
         Quat finalRot = slerp(currentRot, targetRot, target.rotationWeight * m_weight);
-        localTransforms[m_tipBoneIndex].rotation = normalize(finalRot);
+        localRotations[m_tipBoneIndex] = normalize(finalRot);
     }
 
     // Apply twist offset
@@ -192,8 +192,8 @@ bool TwoBoneIK::Solve(SkeletonPose& pose, const IKTarget& target)
     {
         Vec3 tipDir = normalize(newTipPos - newMidPos);
         Quat twist = glm::angleAxis(m_twistOffset * m_weight, tipDir);
-        localTransforms[m_tipBoneIndex].rotation = 
-            normalize(twist * localTransforms[m_tipBoneIndex].rotation);
+        localRotations[m_tipBoneIndex] = 
+            normalize(twist * localRotations[m_tipBoneIndex]);
     }
 
     pose.MarkGlobalTransformsDirty();
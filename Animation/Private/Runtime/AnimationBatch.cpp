@@ -0,0 +1,217 @@
+/**
+ * @file AnimationBatch.cpp
+ * @brief AnimationBatch implementation
+ */
+
+#include "Animation/Runtime/AnimationBatch.h"
+#include "Animation/State/AnimationStateMachine.h"
+#include "Core/Job/JobSystem.h"
+#include <algorithm>
+
+namespace RVX::Animation
+{
+
+AnimationBatch::Handle AnimationBatch::Add(AnimationStateMachine* stateMachine)
+{
+    if (!stateMachine)
+    {
+        return InvalidHandle;
+    }
+
+    Handle handle;
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+    else
+    {
+        handle = static_cast<Handle>(m_instances.size());
+        m_instances.push_back(std::make_unique<Instance>());
+    }
+
+    Instance& instance = *m_instances[handle];
+    instance.stateMachine = stateMachine;
+    instance.updateInterval = 1;
+    instance.phase = 0;
+    instance.hasHistory = false;
+    instance.evaluated = false;
+    instance.paletteOffset = 0;
+    instance.paletteCount = 0;
+    instance.pose = nullptr;
+
+    m_instanceCount++;
+    return handle;
+}
+
+void AnimationBatch::Remove(Handle handle)
+{
+    if (!IsValid(handle))
+    {
+        return;
+    }
+
+    // Keep the instance and its pose storage for the next Add()
+    Instance& instance = *m_instances[handle];
+    instance.stateMachine = nullptr;
+    instance.pose = nullptr;
+    m_freeHandles.push_back(handle);
+    m_instanceCount--;
+}
+
+void AnimationBatch::Clear()
+{
+    m_instances.clear();
+    m_freeHandles.clear();
+    m_active.clear();
+    m_instanceCount = 0;
+    m_palette.clear();
+    m_stats = AnimationBatchStats();
+}
+
+bool AnimationBatch::IsValid(Handle handle) const
+{
+    return handle < m_instances.size() && m_instances[handle]->stateMachine != nullptr;
+}
+
+AnimationStateMachine* AnimationBatch::GetStateMachine(Handle handle) const
+{
+    return IsValid(handle) ? m_instances[handle]->stateMachine : nullptr;
+}
+
+void AnimationBatch::SetUpdateInterval(Handle handle, uint32_t frames)
+{
+    if (!IsValid(handle))
+    {
+        return;
+    }
+
+    Instance& instance = *m_instances[handle];
+    frames = std::max(frames, 1u);
+    if (frames == instance.updateInterval)
+    {
+        return;
+    }
+
+    // Stagger instances by handle so they do not all evaluate on one frame
+    instance.updateInterval = frames;
+    instance.phase = handle % frames;
+    if (frames == 1)
+    {
+        instance.hasHistory = false;
+    }
+}
+
+uint32_t AnimationBatch::GetUpdateInterval(Handle handle) const
+{
+    return IsValid(handle) ? m_instances[handle]->updateInterval : 1;
+}
+
+size_t AnimationBatch::GetPaletteOffset(Handle handle) const
+{
+    return IsValid(handle) ? m_instances[handle]->paletteOffset : 0;
+}
+
+size_t AnimationBatch::GetPaletteCount(Handle handle) const
+{
+    return IsValid(handle) ? m_instances[handle]->paletteCount : 0;
+}
+
+const SkeletonPose* AnimationBatch::GetPose(Handle handle) const
+{
+    return IsValid(handle) ? m_instances[handle]->pose : nullptr;
+}
+
+void AnimationBatch::Evaluate()
+{
+    // Lay out the palette serially so each job writes a disjoint range
+    m_active.clear();
+    size_t paletteSize = 0;
+    for (Handle handle = 0; handle < m_instances.size(); ++handle)
+    {
+        Instance& instance = *m_instances[handle];
+        if (!instance.stateMachine)
+        {
+            continue;
+        }
+
+        const Skeleton::ConstPtr& skeleton = instance.stateMachine->GetSkeleton();
+        instance.paletteOffset = paletteSize;
+        instance.paletteCount = skeleton ? skeleton->GetBoneCount() : 0;
+        paletteSize += instance.paletteCount;
+        m_active.push_back(handle);
+    }
+    m_palette.resize(paletteSize);
+
+    JobSystem::Get().ParallelFor(0, m_active.size(), [this](size_t i) {
+        EvaluateInstance(*m_instances[m_active[i]]);
+    });
+
+    m_stats = AnimationBatchStats();
+    m_stats.instanceCount = m_active.size();
+    m_stats.paletteSize = paletteSize;
+    for (Handle handle : m_active)
+    {
+        if (m_instances[handle]->evaluated)
+        {
+            m_stats.evaluatedCount++;
+        }
+    }
+    m_stats.interpolatedCount = m_stats.instanceCount - m_stats.evaluatedCount;
+}
+
+void AnimationBatch::EvaluateInstance(Instance& instance)
+{
+    AnimationStateMachine& stateMachine = *instance.stateMachine;
+    SkeletonPose* shown = nullptr;
+
+    if (instance.updateInterval <= 1)
+    {
+        stateMachine.EvaluateOutputPose();
+        shown = &stateMachine.GetOutputPose();
+        instance.evaluated = true;
+    }
+    else
+    {
+        instance.evaluated = !instance.hasHistory || instance.phase == 0;
+        if (instance.evaluated)
+        {
+            stateMachine.EvaluateOutputPose();
+            if (instance.hasHistory)
+            {
+                std::swap(instance.previous, instance.latest);
+            }
+            else
+            {
+                instance.previous.CopyFrom(stateMachine.GetOutputPose());
+                instance.hasHistory = true;
+            }
+            instance.latest.CopyFrom(stateMachine.GetOutputPose());
+        }
+
+        // Blend toward the latest evaluation, reaching it just before the next one
+        const uint32_t step = instance.phase + 1;
+        if (step >= instance.updateInterval)
+        {
+            shown = &instance.latest;
+        }
+        else
+        {
+            const float t = static_cast<float>(step) / static_cast<float>(instance.updateInterval);
+            SkeletonPose::Blend(instance.previous, instance.latest, t, instance.display);
+            shown = &instance.display;
+        }
+        instance.phase = step % instance.updateInterval;
+    }
+
+    shown->ComputeSkinningMatrices();
+    instance.pose = shown;
+
+    const std::vector<Mat4>& skinning = shown->GetSkinningMatrices();
+    const size_t copied = std::min(skinning.size(), instance.paletteCount);
+    Mat4* out = m_palette.data() + instance.paletteOffset;
+    std::copy_n(skinning.data(), copied, out);
+    std::fill(out + copied, out + instance.paletteCount, Mat4(1.0f));
+}
+
+} // namespace RVX::Animation
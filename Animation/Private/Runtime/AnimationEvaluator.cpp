@@ -5,6 +5,7 @@
 
 #include "Animation/Runtime/AnimationEvaluator.h"
 #include "Animation/Core/Interpolation.h"
+#include "Animation/Runtime/SkeletonPosePool.h"
 
 namespace RVX::Animation
 {
@@ -25,28 +26,88 @@ EvaluationResult AnimationEvaluator::Evaluate(
     // Check if finished
     result.finished = IsAnimationFinished(time, clip.duration, wrapMode);
 
-    // Evaluate transform tracks
-    for (const auto& track : clip.transformTracks)
+    auto skeleton = outPose.GetSkeleton();
+    if (!skeleton)
     {
-        TransformSample sample = EvaluateTransformTrack(track, wrappedTime);
+        return result;
+    }
+
+    // Evaluate transform tracks straight into the pose arrays
+    const ClipBinding& binding = GetBinding(clip, skeleton);
+    if (binding.boundTrackCount == 0)
+    {
+        return result;
+    }
+
+    auto& translations = outPose.GetTranslations();
+    auto& rotations = outPose.GetRotations();
+    auto& scales = outPose.GetScales();
+    const size_t boneCount = translations.size();
 
-        // Find bone index
-        int boneIndex = -1;
-        auto skeleton = outPose.GetSkeleton();
-        if (skeleton)
+    for (size_t i = 0; i < binding.trackToBone.size(); ++i)
+    {
+        const int boneIndex = binding.trackToBone[i];
+        if (boneIndex < 0 || static_cast<size_t>(boneIndex) >= boneCount)
         {
-            boneIndex = skeleton->FindBoneIndex(track.targetName);
+            continue;
         }
 
-        if (boneIndex >= 0)
+        const TransformTrack& track = clip.transformTracks[i];
+
+        // Matrix keyframes take precedence; missing channels sample as identity
+        if (!track.matrixKeyframes.empty())
+        {
+            TransformSample sample = TransformSample::FromMatrix(SampleMatrix(track, wrappedTime));
+            translations[boneIndex] = sample.translation;
+            rotations[boneIndex] = sample.rotation;
+            scales[boneIndex] = sample.scale;
+        }
+        else
         {
-            outPose.SetLocalTransform(static_cast<size_t>(boneIndex), sample);
+            translations[boneIndex] = SampleTranslation(track, wrappedTime);
+            rotations[boneIndex] = SampleRotation(track, wrappedTime);
+            scales[boneIndex] = SampleScale(track, wrappedTime);
         }
     }
 
     return result;
 }
 
+const ClipBinding& AnimationEvaluator::GetBinding(const AnimationClip& clip, const Skeleton::ConstPtr& skeleton)
+{
+    ClipBinding& binding = m_bindings[BindingKey{&clip, skeleton.get()}];
+
+    const bool valid = binding.tracks == clip.transformTracks.data() &&
+                       binding.trackCount == clip.transformTracks.size() &&
+                       binding.boneCount == (skeleton ? skeleton->GetBoneCount() : 0) &&
+                       !binding.skeleton.expired();
+    if (valid)
+    {
+        return binding;
+    }
+
+    binding.tracks = clip.transformTracks.data();
+    binding.trackCount = clip.transformTracks.size();
+    binding.boneCount = skeleton ? skeleton->GetBoneCount() : 0;
+    binding.skeleton = skeleton;
+    binding.boundTrackCount = 0;
+    binding.trackToBone.assign(binding.trackCount, -1);
+
+    if (skeleton)
+    {
+        for (size_t i = 0; i < binding.trackCount; ++i)
+        {
+            const int boneIndex = skeleton->FindBoneIndex(clip.transformTracks[i].targetName);
+            binding.trackToBone[i] = boneIndex;
+            if (boneIndex >= 0)
+            {
+                binding.boundTrackCount++;
+            }
+        }
+    }
+    return binding;
+}
+
 EvaluationResult AnimationEvaluator::EvaluateBlended(
     const AnimationClip& clip,
     TimeUs time,
@@ -66,15 +127,14 @@ EvaluationResult AnimationEvaluator::EvaluateBlended(
         return Evaluate(clip, time, pose, options);
     }
 
-    // Evaluate to temp pose and blend
-    SkeletonPose tempPose(pose.GetSkeleton());
-    tempPose.ResetToBindPose();
+    // Evaluate to a scratch pose and blend
+    auto tempPose = SkeletonPosePool::Acquire(pose.GetSkeleton());
 
-    auto result = Evaluate(clip, time, tempPose, options);
+    auto result = Evaluate(clip, time, *tempPose, options);
     
     if (result.success)
     {
-        pose.BlendWith(tempPose, weight);
+        pose.BlendWith(*tempPose, weight);
     }
 
     return result;
@@ -94,14 +154,14 @@ EvaluationResult AnimationEvaluator::EvaluateAdditive(
         return result;
     }
 
-    SkeletonPose additivePose(basePose.GetSkeleton());
-    additivePose.ResetToIdentity();  // Additive base is identity
+    auto additivePose = SkeletonPosePool::Acquire(basePose.GetSkeleton());
+    additivePose->ResetToIdentity();  // Additive base is identity
 
-    auto result = Evaluate(clip, time, additivePose, options);
+    auto result = Evaluate(clip, time, *additivePose, options);
     
     if (result.success)
     {
-        basePose.AdditivelBlend(additivePose, weight);
+        basePose.AdditivelBlend(*additivePose, weight);
     }
 
     return result;
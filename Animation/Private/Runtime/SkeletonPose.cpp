@@ -4,112 +4,178 @@
  */
 
 #include "Animation/Runtime/SkeletonPose.h"
+#include <algorithm>
+#include <cmath>
 
 namespace RVX::Animation
 {
 
-// Static identity transform for out-of-bounds access
-static const TransformSample s_identityTransform = TransformSample::Identity();
-
-SkeletonPose::SkeletonPose(Skeleton::ConstPtr skeleton)
-    : m_skeleton(skeleton)
+namespace
 {
-    if (m_skeleton)
+    /// dst = a + (b - a) * t over a flat float stream
+    void LerpStream(float* dst, const float* a, const float* b, size_t count, float t)
     {
-        size_t boneCount = m_skeleton->GetBoneCount();
-        m_localTransforms.resize(boneCount);
-        m_globalTransforms.resize(boneCount, Mat4(1.0f));
-        m_skinningMatrices.resize(boneCount, Mat4(1.0f));
-        ResetToBindPose();
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i] = a[i] + (b[i] - a[i]) * t;
+        }
+    }
+
+    void LerpVec3s(Vec3* dst, const Vec3* a, const Vec3* b, size_t count, float t)
+    {
+        static_assert(sizeof(Vec3) == 3 * sizeof(float), "Vec3 must be tightly packed");
+        LerpStream(reinterpret_cast<float*>(dst), reinterpret_cast<const float*>(a),
+                   reinterpret_cast<const float*>(b), count * 3, t);
+    }
+
+    /// Normalized lerp along the shortest arc
+    Quat Nlerp(const Quat& a, const Quat& b, float t)
+    {
+        const float d = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        const float tb = d < 0.0f ? -t : t;
+        const float ta = 1.0f - t;
+
+        const float x = a.x * ta + b.x * tb;
+        const float y = a.y * ta + b.y * tb;
+        const float z = a.z * ta + b.z * tb;
+        const float w = a.w * ta + b.w * tb;
+        const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+        return Quat(w * invLength, x * invLength, y * invLength, z * invLength);
+    }
+
+    void NlerpQuats(Quat* dst, const Quat* a, const Quat* b, size_t count, float t)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i] = Nlerp(a[i], b[i], t);
+        }
+    }
+
+    /// translate(t) * mat4_cast(r) * scale(s), written out
+    void ComposeTRS(const Vec3& t, const Quat& r, const Vec3& s, Mat4& out)
+    {
+        const float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+        const float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+        const float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+
+        out[0] = Vec4((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x, 0.0f);
+        out[1] = Vec4(2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y, 0.0f);
+        out[2] = Vec4(2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z, 0.0f);
+        out[3] = Vec4(t, 1.0f);
     }
+
+    /// a * b for affine matrices (bottom row 0, 0, 0, 1); out may alias b
+    void MultiplyAffine(const Mat4& a, const Mat4& b, Mat4& out)
+    {
+        const Vec4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+        for (int c = 0; c < 4; ++c)
+        {
+            const Vec4 col = b[c];
+            out[c] = a0 * col.x + a1 * col.y + a2 * col.z + (c == 3 ? a3 : Vec4(0.0f));
+        }
+    }
+} // namespace
+
+SkeletonPose::SkeletonPose(Skeleton::ConstPtr skeleton)
+{
+    SetSkeleton(std::move(skeleton));
 }
 
 SkeletonPose::SkeletonPose(size_t boneCount)
 {
-    m_localTransforms.resize(boneCount);
+    Resize(boneCount);
+    ResetToIdentity();
+}
+
+void SkeletonPose::Resize(size_t boneCount)
+{
+    m_translations.resize(boneCount, Vec3(0.0f));
+    m_rotations.resize(boneCount, Quat(1.0f, 0.0f, 0.0f, 0.0f));
+    m_scales.resize(boneCount, Vec3(1.0f));
     m_globalTransforms.resize(boneCount, Mat4(1.0f));
     m_skinningMatrices.resize(boneCount, Mat4(1.0f));
-    ResetToIdentity();
 }
 
-void SkeletonPose::SetSkeleton(Skeleton::ConstPtr skeleton)
+void SkeletonPose::AssignSkeleton(const Skeleton::ConstPtr& skeleton)
 {
+    if (m_skeleton == skeleton)
+        return;
+
     m_skeleton = skeleton;
+    m_parentIndices.clear();
     if (m_skeleton)
     {
-        size_t boneCount = m_skeleton->GetBoneCount();
-        m_localTransforms.resize(boneCount);
-        m_globalTransforms.resize(boneCount, Mat4(1.0f));
-        m_skinningMatrices.resize(boneCount, Mat4(1.0f));
-        ResetToBindPose();
+        m_parentIndices.reserve(m_skeleton->bones.size());
+        for (const Bone& bone : m_skeleton->bones)
+        {
+            m_parentIndices.push_back(bone.parentIndex);
+        }
     }
-    m_globalsDirty = true;
-    m_skinningDirty = true;
 }
 
-const TransformSample& SkeletonPose::GetLocalTransform(size_t boneIndex) const
+void SkeletonPose::SetSkeleton(Skeleton::ConstPtr skeleton)
 {
-    if (boneIndex < m_localTransforms.size())
+    AssignSkeleton(skeleton);
+    if (m_skeleton)
     {
-        return m_localTransforms[boneIndex];
+        Resize(m_skeleton->GetBoneCount());
+        ResetToBindPose();
     }
-    return s_identityTransform;
+    MarkDirty();
 }
 
-TransformSample& SkeletonPose::GetLocalTransform(size_t boneIndex)
+TransformSample SkeletonPose::GetLocalTransform(size_t boneIndex) const
 {
-    static TransformSample s_dummy;
-    if (boneIndex < m_localTransforms.size())
+    if (boneIndex < m_translations.size())
     {
-        m_globalsDirty = true;
-        m_skinningDirty = true;
-        return m_localTransforms[boneIndex];
+        return TransformSample(m_translations[boneIndex], m_rotations[boneIndex], m_scales[boneIndex]);
     }
-    s_dummy = TransformSample::Identity();
-    return s_dummy;
+    return TransformSample::Identity();
 }
 
 void SkeletonPose::SetLocalTransform(size_t boneIndex, const TransformSample& transform)
 {
-    if (boneIndex < m_localTransforms.size())
+    if (boneIndex < m_translations.size())
     {
-        m_localTransforms[boneIndex] = transform;
-        m_globalsDirty = true;
-        m_skinningDirty = true;
+        m_translations[boneIndex] = transform.translation;
+        m_rotations[boneIndex] = transform.rotation;
+        m_scales[boneIndex] = transform.scale;
+        MarkDirty();
     }
 }
 
-const TransformSample* SkeletonPose::GetLocalTransform(const std::string& boneName) const
+std::optional<TransformSample> SkeletonPose::GetLocalTransform(const std::string& boneName) const
 {
-    if (!m_skeleton) return nullptr;
-    
+    if (!m_skeleton) return std::nullopt;
+
     int index = m_skeleton->FindBoneIndex(boneName);
-    if (index >= 0 && static_cast<size_t>(index) < m_localTransforms.size())
+    if (index >= 0 && static_cast<size_t>(index) < m_translations.size())
     {
-        return &m_localTransforms[index];
+        return GetLocalTransform(static_cast<size_t>(index));
     }
-    return nullptr;
+    return std::nullopt;
 }
 
 void SkeletonPose::ComputeGlobalTransforms()
 {
     if (!m_globalsDirty) return;
-    if (!m_skeleton || m_localTransforms.empty()) return;
+    if (!m_skeleton || m_translations.empty()) return;
 
-    const auto& bones = m_skeleton->bones;
-    
-    for (size_t i = 0; i < bones.size(); ++i)
+    const size_t count = std::min(m_parentIndices.size(), m_translations.size());
+
+    // Pass 1: compose every local matrix, independent per bone
+    for (size_t i = 0; i < count; ++i)
     {
-        const Bone& bone = bones[i];
-        Mat4 local = m_localTransforms[i].ToMatrix();
+        ComposeTRS(m_translations[i], m_rotations[i], m_scales[i], m_globalTransforms[i]);
+    }
 
-        if (bone.parentIndex >= 0 && static_cast<size_t>(bone.parentIndex) < i)
-        {
-            m_globalTransforms[i] = m_globalTransforms[bone.parentIndex] * local;
-        }
-        else
+    // Pass 2: concatenate down the hierarchy (parents precede children)
+    for (size_t i = 0; i < count; ++i)
+    {
+        const int parent = m_parentIndices[i];
+        if (parent >= 0 && static_cast<size_t>(parent) < i)
         {
-            m_globalTransforms[i] = local;
+            MultiplyAffine(m_globalTransforms[parent], m_globalTransforms[i], m_globalTransforms[i]);
         }
     }
 
@@ -119,17 +185,19 @@ void SkeletonPose::ComputeGlobalTransforms()
 void SkeletonPose::ComputeSkinningMatrices()
 {
     if (!m_skinningDirty) return;
-    
+
     // Ensure globals are computed first
     ComputeGlobalTransforms();
-    
+
     if (!m_skeleton) return;
 
     const auto& bones = m_skeleton->bones;
-    
-    for (size_t i = 0; i < bones.size(); ++i)
+    const size_t count = std::min(bones.size(), m_globalTransforms.size());
+
+    // Inverse bind poses invert TRS matrices, so they are affine as well
+    for (size_t i = 0; i < count; ++i)
     {
-        m_skinningMatrices[i] = m_globalTransforms[i] * bones[i].inverseBindPose;
+        MultiplyAffine(m_globalTransforms[i], bones[i].inverseBindPose, m_skinningMatrices[i]);
     }
 
     m_skinningDirty = false;
@@ -140,30 +208,35 @@ void SkeletonPose::ResetToBindPose()
     if (!m_skeleton) return;
 
     const auto& bones = m_skeleton->bones;
-    for (size_t i = 0; i < bones.size(); ++i)
+    const size_t count = std::min(bones.size(), m_translations.size());
+    for (size_t i = 0; i < count; ++i)
     {
-        m_localTransforms[i] = bones[i].localBindPose;
+        const TransformSample& bind = bones[i].localBindPose;
+        m_translations[i] = bind.translation;
+        m_rotations[i] = bind.rotation;
+        m_scales[i] = bind.scale;
     }
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
 void SkeletonPose::ResetToIdentity()
 {
-    for (auto& transform : m_localTransforms)
-    {
-        transform = TransformSample::Identity();
-    }
+    std::fill(m_translations.begin(), m_translations.end(), Vec3(0.0f));
+    std::fill(m_rotations.begin(), m_rotations.end(), Quat(1.0f, 0.0f, 0.0f, 0.0f));
+    std::fill(m_scales.begin(), m_scales.end(), Vec3(1.0f));
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
 void SkeletonPose::CopyFrom(const SkeletonPose& other)
 {
-    m_skeleton = other.m_skeleton;
-    m_localTransforms = other.m_localTransforms;
+    if (this == &other) return;
+
+    AssignSkeleton(other.m_skeleton);
+    m_translations = other.m_translations;
+    m_rotations = other.m_rotations;
+    m_scales = other.m_scales;
     m_globalTransforms = other.m_globalTransforms;
     m_skinningMatrices = other.m_skinningMatrices;
     m_globalsDirty = other.m_globalsDirty;
@@ -179,57 +252,46 @@ void SkeletonPose::BlendWith(const SkeletonPose& other, float weight)
         return;
     }
 
-    size_t count = std::min(m_localTransforms.size(), other.m_localTransforms.size());
-    for (size_t i = 0; i < count; ++i)
-    {
-        m_localTransforms[i] = TransformSample::Lerp(
-            m_localTransforms[i], 
-            other.m_localTransforms[i], 
-            weight);
-    }
+    size_t count = std::min(m_translations.size(), other.m_translations.size());
+    LerpVec3s(m_translations.data(), m_translations.data(), other.m_translations.data(), count, weight);
+    NlerpQuats(m_rotations.data(), m_rotations.data(), other.m_rotations.data(), count, weight);
+    LerpVec3s(m_scales.data(), m_scales.data(), other.m_scales.data(), count, weight);
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
-void SkeletonPose::Blend(const SkeletonPose& a, const SkeletonPose& b, 
+void SkeletonPose::Blend(const SkeletonPose& a, const SkeletonPose& b,
                           float weight, SkeletonPose& result)
 {
-    size_t count = std::min(a.m_localTransforms.size(), b.m_localTransforms.size());
-    
-    if (result.m_localTransforms.size() != count)
-    {
-        result.m_localTransforms.resize(count);
-    }
+    size_t count = std::min(a.m_translations.size(), b.m_translations.size());
 
-    for (size_t i = 0; i < count; ++i)
+    if (result.m_translations.size() != count)
     {
-        result.m_localTransforms[i] = TransformSample::Lerp(
-            a.m_localTransforms[i], 
-            b.m_localTransforms[i], 
-            weight);
+        result.Resize(count);
     }
 
-    result.m_skeleton = a.m_skeleton ? a.m_skeleton : b.m_skeleton;
-    result.m_globalsDirty = true;
-    result.m_skinningDirty = true;
+    LerpVec3s(result.m_translations.data(), a.m_translations.data(), b.m_translations.data(), count, weight);
+    NlerpQuats(result.m_rotations.data(), a.m_rotations.data(), b.m_rotations.data(), count, weight);
+    LerpVec3s(result.m_scales.data(), a.m_scales.data(), b.m_scales.data(), count, weight);
+
+    result.AssignSkeleton(a.m_skeleton ? a.m_skeleton : b.m_skeleton);
+    result.MarkDirty();
 }
 
 void SkeletonPose::AdditivelBlend(const SkeletonPose& additivePose, float weight)
 {
     if (weight <= 0.0f) return;
 
-    size_t count = std::min(m_localTransforms.size(), additivePose.m_localTransforms.size());
+    size_t count = std::min(m_translations.size(), additivePose.m_translations.size());
     for (size_t i = 0; i < count; ++i)
     {
-        m_localTransforms[i] = TransformSample::Additive(
-            m_localTransforms[i],
-            additivePose.m_localTransforms[i],
-            weight);
+        SetLocalTransform(i, TransformSample::Additive(
+            GetLocalTransform(i),
+            additivePose.GetLocalTransform(i),
+            weight));
     }
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
 void SkeletonPose::AdditiveBlend(const SkeletonPose& base, const SkeletonPose& additive,
@@ -241,40 +303,41 @@ void SkeletonPose::AdditiveBlend(const SkeletonPose& base, const SkeletonPose& a
 
 void SkeletonPose::BlendWithMask(const SkeletonPose& other, const std::vector<float>& weights)
 {
-    size_t count = std::min({m_localTransforms.size(), 
-                            other.m_localTransforms.size(), 
+    size_t count = std::min({m_translations.size(),
+                            other.m_translations.size(),
                             weights.size()});
-    
+
+    // A zero weight leaves the bone bit-for-bit unchanged
     for (size_t i = 0; i < count; ++i)
     {
-        float w = weights[i];
-        if (w > 0.0f)
-        {
-            m_localTransforms[i] = TransformSample::Lerp(
-                m_localTransforms[i], 
-                other.m_localTransforms[i], 
-                w);
-        }
+        const float w = std::max(weights[i], 0.0f);
+        m_translations[i] = m_translations[i] + (other.m_translations[i] - m_translations[i]) * w;
+        m_scales[i] = m_scales[i] + (other.m_scales[i] - m_scales[i]) * w;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float w = weights[i];
+        m_rotations[i] = w > 0.0f ? Nlerp(m_rotations[i], other.m_rotations[i], w) : m_rotations[i];
     }
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
 void SkeletonPose::CopyBones(const SkeletonPose& other, const std::vector<int>& boneIndices)
 {
     for (int index : boneIndices)
     {
-        if (index >= 0 && 
-            static_cast<size_t>(index) < m_localTransforms.size() &&
-            static_cast<size_t>(index) < other.m_localTransforms.size())
+        if (index >= 0 &&
+            static_cast<size_t>(index) < m_translations.size() &&
+            static_cast<size_t>(index) < other.m_translations.size())
         {
-            m_localTransforms[index] = other.m_localTransforms[index];
+            m_translations[index] = other.m_translations[index];
+            m_rotations[index] = other.m_rotations[index];
+            m_scales[index] = other.m_scales[index];
         }
     }
 
-    m_globalsDirty = true;
-    m_skinningDirty = true;
+    MarkDirty();
 }
 
 } // namespace RVX::Animation
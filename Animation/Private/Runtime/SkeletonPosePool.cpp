@@ -0,0 +1,80 @@
+/**
+ * @file SkeletonPosePool.cpp
+ * @brief SkeletonPosePool implementation
+ */
+
+#include "Animation/Runtime/SkeletonPosePool.h"
+#include <cassert>
+
+namespace RVX::Animation
+{
+
+namespace
+{
+    struct ThreadPosePool
+    {
+        std::vector<std::unique_ptr<SkeletonPose>> poses;
+        size_t activeCount = 0;
+    };
+
+    ThreadPosePool& GetThreadPool()
+    {
+        thread_local ThreadPosePool pool;
+        return pool;
+    }
+} // namespace
+
+SkeletonPosePool::Handle::~Handle()
+{
+    if (m_pose)
+    {
+        SkeletonPosePool::Release(m_pose);
+    }
+}
+
+SkeletonPosePool::Handle SkeletonPosePool::Acquire(const Skeleton::ConstPtr& skeleton)
+{
+    ThreadPosePool& pool = GetThreadPool();
+    if (pool.activeCount == pool.poses.size())
+    {
+        pool.poses.push_back(std::make_unique<SkeletonPose>());
+    }
+
+    SkeletonPose* pose = pool.poses[pool.activeCount++].get();
+
+    // Same skeleton keeps the arrays; a different one resizes them in place
+    if (!skeleton)
+    {
+        *pose = SkeletonPose();
+    }
+    else if (pose->GetSkeleton() != skeleton || pose->GetBoneCount() != skeleton->GetBoneCount())
+    {
+        pose->SetSkeleton(skeleton);
+    }
+    else
+    {
+        pose->ResetToBindPose();
+    }
+    return Handle(pose);
+}
+
+void SkeletonPosePool::Release(SkeletonPose* pose)
+{
+    ThreadPosePool& pool = GetThreadPool();
+    assert(pool.activeCount > 0 && pool.poses[pool.activeCount - 1].get() == pose &&
+           "Scratch poses must be released in reverse order of acquisition");
+    (void)pose;
+    --pool.activeCount;
+}
+
+size_t SkeletonPosePool::GetActiveCount()
+{
+    return GetThreadPool().activeCount;
+}
+
+size_t SkeletonPosePool::GetPooledCount()
+{
+    return GetThreadPool().poses.size();
+}
+
+} // namespace RVX::Animation
@@ -122,10 +122,9 @@ float AnimationState::Evaluate(const BlendContext& context, SkeletonPose& outPos
         case StateMotionType::Clip:
             if (m_clip)
             {
-                AnimationEvaluator evaluator;
                 EvaluationOptions options;
                 options.wrapModeOverride = m_loop ? WrapMode::Loop : WrapMode::ClampForever;
-                evaluator.Evaluate(*m_clip, m_currentTime, outPose, options);
+                m_evaluator.Evaluate(*m_clip, m_currentTime, outPose, options);
                 return 1.0f;
             }
             break;
@@ -219,6 +219,12 @@ void AnimationStateMachine::ForceState(AnimationState* state, float transitionDu
 }
 
 void AnimationStateMachine::Update(float deltaTime)
+{
+    Advance(deltaTime);
+    EvaluateOutputPose();
+}
+
+void AnimationStateMachine::Advance(float deltaTime)
 {
     if (!m_running || !m_currentState)
         return;
@@ -239,11 +245,17 @@ void AnimationStateMachine::Update(float deltaTime)
         CheckTransitions();
     }
 
+    // Triggers only drive transitions, so they are spent once those are checked
+    ResetTriggersAfterEval();
+}
+
+void AnimationStateMachine::EvaluateOutputPose()
+{
+    if (!m_running || !m_currentState)
+        return;
+
     // Evaluate final pose
     EvaluatePose();
-
-    // Reset triggers after evaluation
-    ResetTriggersAfterEval();
 }
 
 void AnimationStateMachine::CheckTransitions()
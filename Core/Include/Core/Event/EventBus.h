@@ -9,6 +9,7 @@
  * - Priority-based handler ordering
  * - Event filtering by source/channel
  * - Scoped subscriptions with RAII
+ * - Lock-free publish over copy-on-write subscriber snapshots
  */
 
 #include "Core/Event/Event.h"
@@ -16,11 +17,9 @@
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
-#include <queue>
 #include <atomic>
 #include <algorithm>
 
@@ -102,6 +101,17 @@ namespace RVX
      * - PublishDeferred is thread-safe
      * - ProcessDeferredEvents should be called from main thread
      * 
+     * Subscriber lists are immutable snapshots. Subscribe and
+     * Unsubscribe build a new dispatch table under a writer lock and swap
+     * it in; Publish only loads the current table pointer, so it neither
+     * locks nor copies. A handler that unsubscribes during a publish is
+     * still called for that publish. Replaced tables are freed once no
+     * publish is in flight.
+     * 
+     * Deferred events are stored by value in one buffer per event type.
+     * ProcessDeferredEvents dispatches each type's events as a batch,
+     * types in the order their first event was queued.
+     * 
      * Usage:
      * @code
      * // Basic subscription
@@ -150,30 +160,11 @@ namespace RVX
         {
             static_assert(std::is_base_of_v<Event, T>, "T must derive from Event");
 
-            std::unique_lock<std::shared_mutex> lock(m_mutex);
-            
-            auto handle = EventHandle(++m_nextHandleId);
-            auto typeIndex = std::type_index(typeid(T));
-
-            Subscriber sub;
-            sub.handle = handle;
-            sub.priority = options.GetPriorityValue();
-            sub.filter = options.filter;
-            sub.debugName = options.debugName;
-            sub.callback = [callback](const Event& e) {
+            Subscriber sub = MakeSubscriber(options);
+            sub.callback = [callback = std::move(callback)](const Event& e) {
                 callback(static_cast<const T&>(e));
             };
-
-            auto& subscribers = m_subscribers[typeIndex];
-            subscribers.push_back(std::move(sub));
-            
-            // Sort by priority (higher first)
-            std::stable_sort(subscribers.begin(), subscribers.end(),
-                [](const Subscriber& a, const Subscriber& b) {
-                    return a.priority > b.priority;
-                });
-
-            return handle;
+            return AddTypeSubscriber(std::type_index(typeid(T)), std::move(sub));
         }
 
         /**
@@ -222,31 +213,8 @@ namespace RVX
         {
             static_assert(std::is_base_of_v<Event, T>, "T must derive from Event");
 
-            std::vector<Subscriber> subscribersCopy;
-            {
-                std::shared_lock<std::shared_mutex> lock(m_mutex);
-                auto typeIndex = std::type_index(typeid(T));
-                auto it = m_subscribers.find(typeIndex);
-                if (it != m_subscribers.end())
-                {
-                    subscribersCopy = it->second;
-                }
-            }
-
-            // Also notify channel subscribers
-            NotifyChannelSubscribers(event.GetChannel(), event);
-
-            // Dispatch to type-specific subscribers
-            for (auto& subscriber : subscribersCopy)
-            {
-                // Apply filter
-                if (!subscriber.filter.Accepts(event))
-                    continue;
-
-                subscriber.callback(event);
-                if (event.handled)
-                    break;
-            }
+            ReadScope scope(*this);
+            Dispatch(*scope.table, FindTypeSubscribers(*scope.table, std::type_index(typeid(T))), event);
         }
 
         /**
@@ -263,17 +231,15 @@ namespace RVX
          * @brief Queue an event for deferred processing
          * 
          * The event will be published during the next ProcessDeferredEvents call.
-         * Useful for cross-thread event posting.
+         * Useful for cross-thread event posting. The event is copied into
+         * a per-type buffer whose capacity is reused from frame to frame.
          */
         template<typename T>
         void PublishDeferred(T event)
         {
             static_assert(std::is_base_of_v<Event, T>, "T must derive from Event");
 
-            std::lock_guard<std::mutex> lock(m_deferredMutex);
-            m_deferredEvents.push([this, e = std::move(event)]() mutable {
-                Publish(e);
-            });
+            GetDeferredQueue<T>().Push(*this, std::move(event));
         }
 
         /**
@@ -289,7 +255,8 @@ namespace RVX
         /**
          * @brief Process all deferred events
          * 
-         * Should be called once per frame from the main thread.
+         * Should be called once per frame from the main thread. Events
+         * deferred by handlers during processing are kept for the next call.
          */
         void ProcessDeferredEvents();
 
@@ -303,10 +270,9 @@ namespace RVX
         template<typename T>
         size_t GetSubscriberCount() const
         {
-            std::shared_lock<std::shared_mutex> lock(m_mutex);
-            auto typeIndex = std::type_index(typeid(T));
-            auto it = m_subscribers.find(typeIndex);
-            return it != m_subscribers.end() ? it->second.size() : 0;
+            ReadScope scope(*this);
+            const SubscriberList* subscribers = FindTypeSubscribers(*scope.table, std::type_index(typeid(T)));
+            return subscribers ? subscribers->size() : 0;
         }
 
         /**
@@ -320,7 +286,7 @@ namespace RVX
         size_t GetDeferredEventCount() const;
 
         /**
-         * @brief Clear all subscribers (use with caution)
+         * @brief Clear all subscribers and drop pending deferred events (use with caution)
          */
         void Clear();
 
@@ -330,14 +296,12 @@ namespace RVX
         template<typename T>
         void ClearSubscribers()
         {
-            std::unique_lock<std::shared_mutex> lock(m_mutex);
-            auto typeIndex = std::type_index(typeid(T));
-            m_subscribers.erase(typeIndex);
+            RemoveTypeSubscribers(std::type_index(typeid(T)));
         }
 
     private:
-        EventBus() = default;
-        ~EventBus() = default;
+        EventBus();
+        ~EventBus();
 
         // Non-copyable
         EventBus(const EventBus&) = delete;
@@ -347,20 +311,147 @@ namespace RVX
         {
             EventHandle handle;
             int32_t priority = 0;
+            bool filtered = false;  // False when the filter accepts everything
             EventFilter filter;
             const char* debugName = nullptr;
             std::function<void(const Event&)> callback;
         };
 
-        void NotifyChannelSubscribers(EventChannel channel, const Event& event);
+        using SubscriberList = std::vector<Subscriber>;
+        using SubscriberListPtr = std::shared_ptr<const SubscriberList>;
+
+        /// Immutable routing snapshot; lists are shared between snapshots
+        struct DispatchTable
+        {
+            std::unordered_map<std::type_index, SubscriberListPtr> byType;
+            std::unordered_map<EventChannel, SubscriberListPtr> byChannel;
+            /// Per channel: its own subscribers merged with EventChannel::All, by priority
+            std::unordered_map<EventChannel, SubscriberListPtr> channelDispatch;
+        };
+
+        /// Pins the current table for the duration of a read
+        struct ReadScope
+        {
+            explicit ReadScope(const EventBus& bus)
+                : activeReaders(bus.m_activeReaders)
+            {
+                activeReaders.fetch_add(1, std::memory_order_seq_cst);
+                table = bus.m_table.load(std::memory_order_seq_cst);
+            }
+            ~ReadScope() { activeReaders.fetch_sub(1, std::memory_order_release); }
+
+            ReadScope(const ReadScope&) = delete;
+            ReadScope& operator=(const ReadScope&) = delete;
+
+            std::atomic<uint32_t>& activeReaders;
+            const DispatchTable* table = nullptr;
+        };
+
+        class DeferredQueueBase
+        {
+        public:
+            virtual ~DeferredQueueBase() = default;
+            virtual void Dispatch(EventBus& bus) = 0;
+            virtual void Clear(EventBus& bus) = 0;
+        };
+
+        /// Double-buffered, so producers keep queueing while a batch dispatches
+        template<typename T>
+        class DeferredQueue final : public DeferredQueueBase
+        {
+        public:
+            void Push(EventBus& bus, T&& event)
+            {
+                bool first = false;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    first = m_pending.empty() && !m_scheduled;
+                    m_scheduled = m_scheduled || first;
+                    m_pending.push_back(std::move(event));
+                }
+                bus.m_deferredCount.fetch_add(1, std::memory_order_relaxed);
+                if (first)
+                {
+                    bus.ScheduleDeferredQueue(this);
+                }
+            }
+
+            void Dispatch(EventBus& bus) override
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_processing.swap(m_pending);
+                    m_scheduled = false;
+                }
+                if (m_processing.empty())
+                    return;
+
+                bus.m_deferredCount.fetch_sub(m_processing.size(), std::memory_order_relaxed);
+                {
+                    ReadScope scope(bus);
+                    const SubscriberList* subscribers =
+                        FindTypeSubscribers(*scope.table, std::type_index(typeid(T)));
+                    for (const T& event : m_processing)
+                    {
+                        bus.Dispatch(*scope.table, subscribers, event);
+                    }
+                }
+                m_processing.clear();
+            }
+
+            void Clear(EventBus& bus) override
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                bus.m_deferredCount.fetch_sub(m_pending.size(), std::memory_order_relaxed);
+                m_pending.clear();
+                m_scheduled = false;
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::vector<T> m_pending;
+            std::vector<T> m_processing;
+            bool m_scheduled = false;
+        };
+
+        /// The bus is a singleton, so each event type's queue can be cached statically
+        template<typename T>
+        DeferredQueue<T>& GetDeferredQueue()
+        {
+            static DeferredQueue<T>& queue = static_cast<DeferredQueue<T>&>(
+                RegisterDeferredQueue(std::make_unique<DeferredQueue<T>>()));
+            return queue;
+        }
+
+        static Subscriber MakeSubscriber(const SubscriptionOptions& options);
+        static const SubscriberList* FindTypeSubscribers(const DispatchTable& table, std::type_index type);
+
+        EventHandle AddTypeSubscriber(std::type_index type, Subscriber subscriber);
+        void RemoveTypeSubscribers(std::type_index type);
+        void PublishTable(std::unique_ptr<DispatchTable> table);
+        void ReclaimRetiredTables();
+
+        void Dispatch(const DispatchTable& table, const SubscriberList* typeSubscribers, const Event& event);
+        void NotifyChannelSubscribers(const DispatchTable& table, EventChannel channel, const Event& event);
+
+        DeferredQueueBase& RegisterDeferredQueue(std::unique_ptr<DeferredQueueBase> queue);
+        void ScheduleDeferredQueue(DeferredQueueBase* queue);
+
+        // Current routing table; replaced wholesale by writers
+        std::atomic<const DispatchTable*> m_table{nullptr};
+        mutable std::atomic<uint32_t> m_activeReaders{0};
 
-        mutable std::shared_mutex m_mutex;
-        std::unordered_map<std::type_index, std::vector<Subscriber>> m_subscribers;
-        std::unordered_map<EventChannel, std::vector<Subscriber>> m_channelSubscribers;
+        // Writers serialize here; retired tables wait for a moment with no readers
+        std::mutex m_writeMutex;
+        std::unique_ptr<const DispatchTable> m_currentTable;
+        std::vector<std::unique_ptr<const DispatchTable>> m_retiredTables;
         std::atomic<EventHandle::HandleId> m_nextHandleId{0};
 
         mutable std::mutex m_deferredMutex;
-        std::queue<std::function<void()>> m_deferredEvents;
+        std::vector<std::unique_ptr<DeferredQueueBase>> m_deferredQueues;
+        std::vector<DeferredQueueBase*> m_scheduledQueues;
+        std::vector<DeferredQueueBase*> m_processingQueues;
+        std::atomic<size_t> m_deferredCount{0};
     };
 
 } // namespace RVX
@@ -109,7 +109,8 @@ namespace RVX
 
         void Reset();
         void Execute();
-        void OnDependencyComplete();
+        /// @return True if this was the last pending dependency
+        bool OnDependencyComplete();
 
         std::string m_name;
         WorkFunction m_work;
@@ -196,13 +197,16 @@ namespace RVX
         /**
          * @brief Execute the job graph
          * 
-         * Jobs are scheduled based on their dependencies.
-         * Returns immediately; use Wait() to block.
+         * Jobs without dependencies are submitted immediately; every other
+         * job is submitted by whichever dependency finishes last, at the
+         * node's priority. Returns immediately; use Wait() to block.
          */
         void Execute();
 
         /**
          * @brief Wait for all jobs to complete
+         *
+         * The calling thread runs queued jobs while it waits.
          */
         void Wait();
 
@@ -237,13 +241,12 @@ namespace RVX
         size_t GetCompletedJobCount() const;
 
     private:
-        void ScheduleReadyJobs();
+        void ScheduleJob(JobNode* node);
         void OnJobComplete(JobNode* node);
 
         std::vector<JobNode::Ptr> m_jobs;
         std::unordered_map<std::string, JobNode::Ptr> m_jobLookup;
 
-        std::mutex m_mutex;
         std::atomic<size_t> m_completedCount{0};
         std::atomic<bool> m_executing{false};
     };
@@ -8,6 +8,7 @@
 #include "Core/Job/ThreadPool.h"
 #include <memory>
 #include <atomic>
+#include <algorithm>
 
 namespace RVX
 {
@@ -37,19 +38,19 @@ namespace RVX
             return m_completed ? m_completed->load() : true; 
         }
 
-        /// Wait for the job to complete
+        /// Wait for the job to complete, running other queued jobs meanwhile
         void Wait() const
         {
-            if (m_future.valid())
+            if (m_completed && !m_completed->load(std::memory_order_acquire))
             {
-                m_future.wait();
+                m_pool->RunUntil([this]() { return m_completed->load(std::memory_order_acquire); });
             }
         }
 
     private:
         friend class JobSystem;
         
-        std::shared_future<void> m_future;
+        ThreadPool* m_pool = nullptr;
         std::shared_ptr<std::atomic<bool>> m_completed;
     };
 
@@ -132,17 +133,35 @@ namespace RVX
 
             auto completed = std::make_shared<std::atomic<bool>>(false);
 
-            auto future = m_threadPool->Submit([func = std::forward<F>(func), completed]() {
+            m_threadPool->SubmitDetached([func = std::forward<F>(func), completed]() mutable {
                 func();
-                completed->store(true);
+                completed->store(true, std::memory_order_release);
             }, priority);
 
             JobHandle handle;
-            handle.m_future = future.share();
-            handle.m_completed = completed;
+            handle.m_pool = m_threadPool.get();
+            handle.m_completed = std::move(completed);
             return handle;
         }
 
+        /**
+         * @brief Submit a job without a handle
+         *
+         * Cheapest way to queue work: no completion state is allocated.
+         * Pair with WaitUntil() on a caller-owned counter or flag.
+         */
+        template<typename F>
+        void SubmitDetached(F&& func, JobPriority priority = JobPriority::Normal)
+        {
+            if (!m_threadPool)
+            {
+                func();
+                return;
+            }
+
+            m_threadPool->SubmitDetached(std::forward<F>(func), priority);
+        }
+
         /**
          * @brief Submit a job that returns a value
          */
@@ -186,24 +205,24 @@ namespace RVX
                 batchSize = std::max(size_t(1), (end - start) / (m_threadPool->GetThreadCount() * 4));
             }
 
-            std::vector<std::future<void>> futures;
-            
+            const size_t batchCount = (end - start + batchSize - 1) / batchSize;
+            std::atomic<size_t> remaining{batchCount};
+
             for (size_t batchStart = start; batchStart < end; batchStart += batchSize)
             {
                 size_t batchEnd = std::min(batchStart + batchSize, end);
                 
-                futures.push_back(m_threadPool->Submit([&func, batchStart, batchEnd]() {
+                m_threadPool->SubmitDetached([&func, &remaining, batchStart, batchEnd]() {
                     for (size_t i = batchStart; i < batchEnd; ++i)
                     {
                         func(i);
                     }
-                }));
+                    remaining.fetch_sub(1, std::memory_order_acq_rel);
+                });
             }
 
-            for (auto& future : futures)
-            {
-                future.wait();
-            }
+            // The caller runs batches too instead of blocking
+            m_threadPool->RunUntil([&remaining]() { return remaining.load(std::memory_order_acquire) == 0; });
         }
 
         /**
@@ -217,6 +236,24 @@ namespace RVX
             }
         }
 
+        /**
+         * @brief Run queued jobs on the calling thread until done() returns true
+         */
+        template<typename Predicate>
+        void WaitUntil(Predicate&& done)
+        {
+            if (m_threadPool)
+            {
+                m_threadPool->RunUntil(std::forward<Predicate>(done));
+                return;
+            }
+
+            while (!done())
+            {
+                std::this_thread::yield();
+            }
+        }
+
         /**
          * @brief Wait for all pending jobs to complete
          */
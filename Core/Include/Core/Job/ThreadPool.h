@@ -2,17 +2,21 @@
 
 /**
  * @file ThreadPool.h
- * @brief Simple thread pool implementation for parallel task execution
+ * @brief Work-stealing thread pool for parallel task execution
  */
 
 #include <vector>
-#include <queue>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 
 namespace RVX
 {
@@ -20,25 +24,86 @@ namespace RVX
     enum class JobPriority;
 
     /**
-     * @brief Task wrapper with priority
+     * @brief Move-only callable stored inline in a task
+     *
+     * Callables up to kInlineSize bytes (a lambda capturing a handful of
+     * pointers or indices) live in the task itself; larger ones fall back
+     * to a heap allocation. A TaskFunction is run exactly once and is
+     * destroyed by running it.
      */
-    struct Task
+    class TaskFunction
     {
-        std::function<void()> func;
-        int32_t priority = 0;  // Higher = more priority
+    public:
+        static constexpr size_t kInlineSize = 48;
+
+        TaskFunction() = default;
+        TaskFunction(const TaskFunction&) = delete;
+        TaskFunction& operator=(const TaskFunction&) = delete;
 
-        // For priority_queue (higher priority first)
-        bool operator<(const Task& other) const
+        template<typename F>
+        void Emplace(F&& func)
         {
-            return priority < other.priority;
+            using Fn = std::decay_t<F>;
+            if constexpr (sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t))
+            {
+                ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(func));
+                m_run = [](void* storage)
+                {
+                    Fn* fn = std::launder(reinterpret_cast<Fn*>(storage));
+                    struct Destroy { Fn* fn; ~Destroy() { fn->~Fn(); } } destroy{fn};
+                    (*fn)();
+                };
+            }
+            else
+            {
+                ::new (static_cast<void*>(m_storage)) Fn*(new Fn(std::forward<F>(func)));
+                m_run = [](void* storage)
+                {
+                    std::unique_ptr<Fn> fn(*std::launder(reinterpret_cast<Fn**>(storage)));
+                    (*fn)();
+                };
+            }
         }
+
+        /// Invoke and destroy the stored callable
+        void Run()
+        {
+            void (*run)(void*) = m_run;
+            m_run = nullptr;
+            run(m_storage);
+        }
+
+        explicit operator bool() const { return m_run != nullptr; }
+
+    private:
+        alignas(std::max_align_t) unsigned char m_storage[kInlineSize];
+        void (*m_run)(void*) = nullptr;
     };
 
     /**
-     * @brief Simple thread pool for parallel task execution
+     * @brief A queued unit of work
      *
-     * The thread pool manages a fixed number of worker threads
-     * and executes tasks submitted to it.
+     * Tasks are recycled through per-worker free lists, so steady-state
+     * submission performs no heap allocation.
+     */
+    struct alignas(64) Task
+    {
+        TaskFunction func;
+        Task* next = nullptr;   // Free-list link
+    };
+
+    /**
+     * @brief Work-stealing thread pool
+     *
+     * Each worker owns one Chase-Lev deque per priority lane. Tasks
+     * submitted from a worker go to its own deque and are popped LIFO;
+     * idle workers steal FIFO from the others. Tasks submitted from
+     * outside the pool go to a small per-lane injection queue. Lanes are
+     * drained highest priority first.
+     *
+     * Waiting is cooperative: WaitAll() and RunUntil() run queued tasks on
+     * the calling thread instead of blocking it, so nested waits inside a
+     * task cannot starve the pool.
      *
      * Usage:
      * @code
@@ -49,11 +114,19 @@ namespace RVX
      * });
      *
      * auto result = future.get();  // Wait for result
+     *
+     * std::atomic<int> remaining{2};
+     * pool.SubmitDetached([&]() { WorkA(); remaining--; });
+     * pool.SubmitDetached([&]() { WorkB(); remaining--; });
+     * pool.RunUntil([&]() { return remaining == 0; });  // Helps while waiting
      * @endcode
      */
     class ThreadPool
     {
     public:
+        /// Number of priority lanes (one per JobPriority value)
+        static constexpr int32_t kLaneCount = 4;
+
         /**
          * @brief Create a thread pool
          * @param numThreads Number of worker threads (0 = hardware concurrency)
@@ -92,21 +165,67 @@ namespace RVX
 
         /**
          * @brief Submit a task without caring about the result
+         *
+         * Unlike Submit(), this allocates no future state. Tasks submitted
+         * after shutdown has begun run inline on the calling thread, so the
+         * counters they signal still reach zero.
+         */
+        template<typename F>
+        void SubmitDetached(F&& func)
+        {
+            SubmitDetachedImpl(std::forward<F>(func), 0);
+        }
+
+        /**
+         * @brief Submit a task without caring about the result, with priority
          */
-        void SubmitDetached(std::function<void()> task);
+        template<typename F>
+        void SubmitDetached(F&& func, JobPriority priority)
+        {
+            SubmitDetachedImpl(std::forward<F>(func), static_cast<int32_t>(priority));
+        }
 
         /**
-         * @brief Wait for all pending tasks to complete
+         * @brief Run queued tasks on the calling thread until done() returns true
+         *
+         * When there is nothing left to run the caller yields, then sleeps
+         * until another task completes.
+         */
+        template<typename Predicate>
+        void RunUntil(Predicate&& done)
+        {
+            while (!done())
+            {
+                const uint64_t epoch = m_completionEpoch.load(std::memory_order_acquire);
+                if (done())
+                {
+                    return;
+                }
+                if (!TryRunTask())
+                {
+                    WaitForProgress(epoch);
+                }
+            }
+        }
+
+        /**
+         * @brief Wait for all pending tasks to complete, helping to run them
          */
         void WaitAll();
 
+        /**
+         * @brief Run one queued task on the calling thread
+         * @return False if no task was available
+         */
+        bool TryRunTask();
+
         /**
          * @brief Get the number of worker threads
          */
-        size_t GetThreadCount() const { return m_threads.size(); }
+        size_t GetThreadCount() const { return m_workers.size(); }
 
         /**
-         * @brief Get the number of pending tasks
+         * @brief Get the number of submitted tasks that have not finished
          */
         size_t GetPendingCount() const;
 
@@ -115,7 +234,20 @@ namespace RVX
          */
         bool HasPendingTasks() const { return GetPendingCount() > 0; }
 
+        /**
+         * @brief Get the number of tasks taken from another worker's deque
+         */
+        size_t GetStealCount() const;
+
+        /**
+         * @brief Get the index of the calling worker thread, or -1 if the caller is not one of ours
+         */
+        int32_t GetCurrentWorkerIndex() const;
+
     private:
+        struct Worker;
+        struct InjectionQueue;
+
         // Implementation for Submit
         template<typename F>
         auto SubmitImpl(F&& func, int32_t priority)
@@ -123,22 +255,14 @@ namespace RVX
         {
             using ReturnType = std::invoke_result_t<F>;
 
-            auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-                std::forward<F>(func)
-            );
-
-            std::future<ReturnType> future = task->get_future();
-
+            if (m_stopping.load(std::memory_order_relaxed))
             {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                if (m_stopping)
-                {
-                    throw std::runtime_error("Submit called on stopped ThreadPool");
-                }
-                m_tasks.emplace(Task{[task]() { (*task)(); }, priority});
+                throw std::runtime_error("Submit called on stopped ThreadPool");
             }
 
-            m_condition.notify_one();
+            std::packaged_task<ReturnType()> task(std::forward<F>(func));
+            std::future<ReturnType> future = task.get_future();
+            SubmitDetachedImpl([task = std::move(task)]() mutable { task(); }, priority);
             return future;
         }
 
@@ -149,36 +273,67 @@ namespace RVX
         {
             using ReturnType = std::invoke_result_t<F, Args...>;
 
-            auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+            if (m_stopping.load(std::memory_order_relaxed))
+            {
+                throw std::runtime_error("Submit called on stopped ThreadPool");
+            }
+
+            std::packaged_task<ReturnType()> task(
                 std::bind(std::forward<F>(func), std::forward<Args>(args)...)
             );
+            std::future<ReturnType> future = task.get_future();
+            SubmitDetachedImpl([task = std::move(task)]() mutable { task(); }, priority);
+            return future;
+        }
 
-            std::future<ReturnType> future = task->get_future();
-
+        template<typename F>
+        void SubmitDetachedImpl(F&& func, int32_t priority)
+        {
+            // Workers may already have exited; dropping the task would leave
+            // whoever waits on it hanging
+            if (m_stopping.load(std::memory_order_relaxed))
             {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                if (m_stopping)
-                {
-                    throw std::runtime_error("Submit called on stopped ThreadPool");
-                }
-                m_tasks.emplace(Task{[task]() { (*task)(); }, priority});
+                std::forward<F>(func)();
+                return;
             }
 
-            m_condition.notify_one();
-            return future;
+            Worker* self = CurrentWorker();
+            Task* task = AllocateTask(self);
+            task->func.Emplace(std::forward<F>(func));
+            Enqueue(task, priority, self);
         }
 
-        void WorkerLoop();
+        Worker* CurrentWorker() const;
+        Task* AllocateTask(Worker* self);
+        void FreeTask(Task* task, Worker* self);
+        void Enqueue(Task* task, int32_t priority, Worker* self);
+        Task* FindTask(Worker* self);
+        void RunTask(Task* task, Worker* self);
+        void WaitForProgress(uint64_t epoch);
+        void WorkerLoop(size_t index);
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::unique_ptr<InjectionQueue[]> m_injection;
+
+        // Shared task free list, refilled from slabs
+        std::mutex m_freeMutex;
+        Task* m_freeTasks = nullptr;
+        std::vector<std::unique_ptr<Task[]>> m_taskSlabs;
 
-        std::vector<std::thread> m_threads;
-        std::priority_queue<Task> m_tasks;
+        // Submitted but not finished; WaitAll() waits for zero
+        alignas(64) std::atomic<int64_t> m_pendingTasks{0};
+        // Queued but not started; idle workers sleep while zero
+        alignas(64) std::atomic<int64_t> m_queuedTasks{0};
+        // Bumped after every finished task to wake RunUntil() sleepers
+        alignas(64) std::atomic<uint64_t> m_completionEpoch{0};
 
-        mutable std::mutex m_mutex;
-        std::condition_variable m_condition;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_workCondition;
         std::condition_variable m_completionCondition;
+        std::atomic<uint32_t> m_sleepingWorkers{0};
+        std::atomic<uint32_t> m_sleepingWaiters{0};
 
         std::atomic<bool> m_stopping{false};
-        std::atomic<size_t> m_activeTasks{0};
     };
 
 } // namespace RVX
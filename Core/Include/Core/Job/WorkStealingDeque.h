@@ -0,0 +1,127 @@
+#pragma once
+
+/**
+ * @file WorkStealingDeque.h
+ * @brief Fixed-capacity Chase-Lev work-stealing deque
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace RVX
+{
+    /**
+     * @brief Single-owner, multi-thief deque of pointers
+     *
+     * The owning thread pushes and pops at the bottom (LIFO, so recently
+     * spawned work stays hot in cache); any other thread may steal from
+     * the top (FIFO). Based on Chase & Lev, "Dynamic Circular Work-Stealing
+     * Deque", with the C11 memory orderings of Le et al. (PPoPP 2013).
+     *
+     * The ring does not grow: Push() returns false when full and the
+     * caller routes the item elsewhere. That keeps the buffer from ever
+     * being reallocated under a concurrent thief.
+     */
+    template<typename T>
+    class WorkStealingDeque
+    {
+    public:
+        /// @param capacity Ring size, rounded up to a power of two
+        explicit WorkStealingDeque(size_t capacity = 4096)
+        {
+            size_t size = 1;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            m_mask = static_cast<int64_t>(size - 1);
+            m_buffer = std::make_unique<std::atomic<T*>[]>(size);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /// Owner only. Returns false if the ring is full.
+        bool Push(T* item)
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask)
+            {
+                return false;
+            }
+
+            m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /// Owner only. Takes the most recently pushed item.
+        T* Pop()
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Empty
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last item: race the thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1,
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /// Any thread. Takes the oldest item, or nullptr if empty or the race was lost.
+        T* Steal()
+        {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            T* item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /// Approximate when called concurrently
+        bool IsEmpty() const
+        {
+            return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // Owner and thieves write different ends; keep them on separate cache lines
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        std::unique_ptr<std::atomic<T*>[]> m_buffer;
+        int64_t m_mask = 0;
+    };
+
+} // namespace RVX
@@ -9,36 +9,90 @@
 namespace RVX
 {
 
+namespace
+{
+    template<typename List, typename Subscriber>
+    void InsertByPriority(List& subscribers, Subscriber subscriber)
+    {
+        // After every subscriber of equal or higher priority, matching a stable sort
+        auto it = std::upper_bound(subscribers.begin(), subscribers.end(), subscriber.priority,
+            [](int32_t priority, const Subscriber& s) { return priority > s.priority; });
+        subscribers.insert(it, std::move(subscriber));
+    }
+} // namespace
+
 EventBus& EventBus::Get()
 {
     static EventBus instance;
     return instance;
 }
 
+EventBus::EventBus()
+{
+    m_currentTable = std::make_unique<DispatchTable>();
+    m_table.store(m_currentTable.get(), std::memory_order_release);
+}
+
+EventBus::~EventBus() = default;
+
+EventBus::Subscriber EventBus::MakeSubscriber(const SubscriptionOptions& options)
+{
+    Subscriber sub;
+    sub.priority = options.GetPriorityValue();
+    sub.filter = options.filter;
+    sub.filtered = options.filter.sourceId != 0 ||
+                   options.filter.channelMask != EventChannel::All ||
+                   static_cast<bool>(options.filter.customFilter);
+    sub.debugName = options.debugName;
+    return sub;
+}
+
+const EventBus::SubscriberList* EventBus::FindTypeSubscribers(const DispatchTable& table, std::type_index type)
+{
+    auto it = table.byType.find(type);
+    return it != table.byType.end() ? it->second.get() : nullptr;
+}
+
+EventHandle EventBus::AddTypeSubscriber(std::type_index type, Subscriber subscriber)
+{
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
+    auto handle = EventHandle(++m_nextHandleId);
+    subscriber.handle = handle;
+
+    auto table = std::make_unique<DispatchTable>(*m_currentTable);
+    auto it = table->byType.find(type);
+    auto subscribers = it != table->byType.end()
+        ? std::make_shared<SubscriberList>(*it->second)
+        : std::make_shared<SubscriberList>();
+    InsertByPriority(*subscribers, std::move(subscriber));
+    table->byType[type] = std::move(subscribers);
+
+    PublishTable(std::move(table));
+    return handle;
+}
+
 EventHandle EventBus::SubscribeToChannel(EventChannel channel,
                                           std::function<void(const Event&)> callback,
                                           SubscriptionOptions options)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-    
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
     auto handle = EventHandle(++m_nextHandleId);
 
-    Subscriber sub;
+    Subscriber sub = MakeSubscriber(options);
     sub.handle = handle;
-    sub.priority = options.GetPriorityValue();
-    sub.filter = options.filter;
-    sub.debugName = options.debugName;
     sub.callback = std::move(callback);
 
-    auto& subscribers = m_channelSubscribers[channel];
-    subscribers.push_back(std::move(sub));
-    
-    // Sort by priority (higher first)
-    std::stable_sort(subscribers.begin(), subscribers.end(),
-        [](const Subscriber& a, const Subscriber& b) {
-            return a.priority > b.priority;
-        });
+    auto table = std::make_unique<DispatchTable>(*m_currentTable);
+    auto it = table->byChannel.find(channel);
+    auto subscribers = it != table->byChannel.end()
+        ? std::make_shared<SubscriberList>(*it->second)
+        : std::make_shared<SubscriberList>();
+    InsertByPriority(*subscribers, std::move(sub));
+    table->byChannel[channel] = std::move(subscribers);
 
+    PublishTable(std::move(table));
     return handle;
 }
 
@@ -47,71 +101,125 @@ void EventBus::Unsubscribe(EventHandle handle)
     if (!handle.IsValid())
         return;
 
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_writeMutex);
 
-    // Check type-based subscribers
-    for (auto& [typeIndex, subscribers] : m_subscribers)
+    auto removeFrom = [this, handle](auto& lists) -> bool
     {
-        auto it = std::remove_if(subscribers.begin(), subscribers.end(),
-            [handle](const Subscriber& s) { return s.handle == handle; });
-        
-        if (it != subscribers.end())
+        for (auto& [key, subscribers] : lists)
         {
-            subscribers.erase(it, subscribers.end());
-            return;
+            auto it = std::find_if(subscribers->begin(), subscribers->end(),
+                [handle](const Subscriber& s) { return s.handle == handle; });
+            if (it == subscribers->end())
+                continue;
+
+            auto remaining = std::make_shared<SubscriberList>();
+            remaining->reserve(subscribers->size() - 1);
+            for (const Subscriber& s : *subscribers)
+            {
+                if (s.handle != handle)
+                    remaining->push_back(s);
+            }
+            subscribers = std::move(remaining);
+            return true;
         }
+        return false;
+    };
+
+    // Lists are shared with the live table; replace, never modify in place
+    auto table = std::make_unique<DispatchTable>(*m_currentTable);
+    if (removeFrom(table->byType) || removeFrom(table->byChannel))
+    {
+        PublishTable(std::move(table));
     }
+}
+
+void EventBus::RemoveTypeSubscribers(std::type_index type)
+{
+    std::lock_guard<std::mutex> lock(m_writeMutex);
 
-    // Check channel-based subscribers
-    for (auto& [channel, subscribers] : m_channelSubscribers)
+    auto table = std::make_unique<DispatchTable>(*m_currentTable);
+    if (table->byType.erase(type) > 0)
     {
-        auto it = std::remove_if(subscribers.begin(), subscribers.end(),
-            [handle](const Subscriber& s) { return s.handle == handle; });
-        
-        if (it != subscribers.end())
-        {
-            subscribers.erase(it, subscribers.end());
-            return;
-        }
+        PublishTable(std::move(table));
     }
 }
 
-void EventBus::NotifyChannelSubscribers(EventChannel channel, const Event& event)
+void EventBus::PublishTable(std::unique_ptr<DispatchTable> table)
 {
-    std::vector<Subscriber> subscribersCopy;
+    // Rebuild the merged channel lists so publishing never has to merge or sort
+    table->channelDispatch.clear();
+    auto allIt = table->byChannel.find(EventChannel::All);
+    const SubscriberListPtr all = allIt != table->byChannel.end() ? allIt->second : nullptr;
+    for (const auto& [channel, subscribers] : table->byChannel)
     {
-        std::shared_lock<std::shared_mutex> lock(m_mutex);
-        
-        // Get subscribers for the specific channel
-        auto it = m_channelSubscribers.find(channel);
-        if (it != m_channelSubscribers.end())
+        if (channel == EventChannel::All || !all || all->empty())
         {
-            subscribersCopy = it->second;
+            table->channelDispatch[channel] = subscribers;
+            continue;
         }
 
-        // Also get subscribers for EventChannel::All
-        auto allIt = m_channelSubscribers.find(EventChannel::All);
-        if (allIt != m_channelSubscribers.end())
-        {
-            subscribersCopy.insert(subscribersCopy.end(), 
-                                   allIt->second.begin(), 
-                                   allIt->second.end());
-        }
+        auto merged = std::make_shared<SubscriberList>(*subscribers);
+        merged->insert(merged->end(), all->begin(), all->end());
+        std::stable_sort(merged->begin(), merged->end(),
+            [](const Subscriber& a, const Subscriber& b) {
+                return a.priority > b.priority;
+            });
+        table->channelDispatch[channel] = std::move(merged);
     }
 
-    if (subscribersCopy.empty())
+    m_table.store(table.get(), std::memory_order_seq_cst);
+    m_retiredTables.push_back(std::move(m_currentTable));
+    m_currentTable = std::move(table);
+
+    ReclaimRetiredTables();
+}
+
+void EventBus::ReclaimRetiredTables()
+{
+    // Any reader that starts after the swap sees the new table, so once the
+    // reader count touches zero no one can still hold a retired one
+    if (!m_retiredTables.empty() && m_activeReaders.load(std::memory_order_seq_cst) == 0)
+    {
+        m_retiredTables.clear();
+    }
+}
+
+void EventBus::Dispatch(const DispatchTable& table, const SubscriberList* typeSubscribers, const Event& event)
+{
+    // Also notify channel subscribers
+    NotifyChannelSubscribers(table, event.GetChannel(), event);
+
+    if (!typeSubscribers)
         return;
 
-    // Sort merged list by priority
-    std::stable_sort(subscribersCopy.begin(), subscribersCopy.end(),
-        [](const Subscriber& a, const Subscriber& b) {
-            return a.priority > b.priority;
-        });
+    // Dispatch to type-specific subscribers
+    for (const Subscriber& subscriber : *typeSubscribers)
+    {
+        // Apply filter
+        if (subscriber.filtered && !subscriber.filter.Accepts(event))
+            continue;
+
+        subscriber.callback(event);
+        if (event.handled)
+            break;
+    }
+}
 
-    // Dispatch to channel subscribers
-    for (auto& subscriber : subscribersCopy)
+void EventBus::NotifyChannelSubscribers(const DispatchTable& table, EventChannel channel, const Event& event)
+{
+    if (table.byChannel.empty())
+        return;
+
+    // Channels without their own subscribers still reach EventChannel::All
+    auto it = table.channelDispatch.find(channel);
+    if (it == table.channelDispatch.end())
+        it = table.channelDispatch.find(EventChannel::All);
+    if (it == table.channelDispatch.end())
+        return;
+
+    for (const Subscriber& subscriber : *it->second)
     {
-        if (!subscriber.filter.Accepts(event))
+        if (subscriber.filtered && !subscriber.filter.Accepts(event))
             continue;
 
         subscriber.callback(event);
@@ -120,49 +228,71 @@ void EventBus::NotifyChannelSubscribers(EventChannel channel, const Event& event
     }
 }
 
+EventBus::DeferredQueueBase& EventBus::RegisterDeferredQueue(std::unique_ptr<DeferredQueueBase> queue)
+{
+    std::lock_guard<std::mutex> lock(m_deferredMutex);
+    m_deferredQueues.push_back(std::move(queue));
+    return *m_deferredQueues.back();
+}
+
+void EventBus::ScheduleDeferredQueue(DeferredQueueBase* queue)
+{
+    std::lock_guard<std::mutex> lock(m_deferredMutex);
+    m_scheduledQueues.push_back(queue);
+}
+
 void EventBus::ProcessDeferredEvents()
 {
-    std::queue<std::function<void()>> eventsToProcess;
-    
     {
         std::lock_guard<std::mutex> lock(m_deferredMutex);
-        std::swap(eventsToProcess, m_deferredEvents);
+        m_processingQueues.swap(m_scheduledQueues);
     }
 
-    while (!eventsToProcess.empty())
+    // One batch per event type, in the order each type was first queued
+    for (DeferredQueueBase* queue : m_processingQueues)
     {
-        eventsToProcess.front()();
-        eventsToProcess.pop();
+        queue->Dispatch(*this);
     }
+    m_processingQueues.clear();
+
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    ReclaimRetiredTables();
 }
 
 size_t EventBus::GetTotalSubscriberCount() const
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
-    
+    ReadScope scope(*this);
+
     size_t count = 0;
-    for (const auto& [typeIndex, subscribers] : m_subscribers)
+    for (const auto& [typeIndex, subscribers] : scope.table->byType)
     {
-        count += subscribers.size();
+        count += subscribers->size();
     }
-    for (const auto& [channel, subscribers] : m_channelSubscribers)
+    for (const auto& [channel, subscribers] : scope.table->byChannel)
     {
-        count += subscribers.size();
+        count += subscribers->size();
     }
     return count;
 }
 
 size_t EventBus::GetDeferredEventCount() const
 {
-    std::lock_guard<std::mutex> lock(m_deferredMutex);
-    return m_deferredEvents.size();
+    return m_deferredCount.load(std::memory_order_relaxed);
 }
 
 void EventBus::Clear()
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-    m_subscribers.clear();
-    m_channelSubscribers.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_deferredMutex);
+        m_scheduledQueues.clear();
+        for (auto& queue : m_deferredQueues)
+        {
+            queue->Clear(*this);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    PublishTable(std::make_unique<DispatchTable>());
 }
 
 } // namespace RVX
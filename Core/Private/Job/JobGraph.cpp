@@ -71,9 +71,9 @@ void JobNode::Execute()
     m_completed.store(true);
 }
 
-void JobNode::OnDependencyComplete()
+bool JobNode::OnDependencyComplete()
 {
-    m_pendingDependencies.fetch_sub(1);
+    return m_pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1;
 }
 
 // ============================================================================
@@ -125,46 +125,50 @@ void JobGraph::Execute()
         job->Reset();
     }
 
-    // Schedule initially ready jobs
-    ScheduleReadyJobs();
-}
-
-void JobGraph::ScheduleReadyJobs()
-{
-    std::lock_guard<std::mutex> lock(m_mutex);
-
+    // Submit the roots; everything else is submitted as its dependencies finish.
+    // Collect first so a fast root cannot race a later root's readiness check.
+    std::vector<JobNode*> roots;
     for (auto& job : m_jobs)
     {
-        if (job->IsReady() && !job->m_scheduled.exchange(true))
+        if (job->IsReady())
         {
-            JobSystem::Get().Submit([this, jobPtr = job.get()]() {
-                jobPtr->Execute();
-                OnJobComplete(jobPtr);
-            });
+            roots.push_back(job.get());
         }
     }
+    for (JobNode* root : roots)
+    {
+        ScheduleJob(root);
+    }
 }
 
-void JobGraph::OnJobComplete(JobNode* node)
+void JobGraph::ScheduleJob(JobNode* node)
 {
-    m_completedCount.fetch_add(1);
+    if (node->m_scheduled.exchange(true))
+        return;
 
-    // Notify successors
+    JobSystem::Get().SubmitDetached([this, node]() {
+        node->Execute();
+        OnJobComplete(node);
+    }, node->GetPriority());
+}
+
+void JobGraph::OnJobComplete(JobNode* node)
+{
     for (JobNode* successor : node->GetSuccessors())
     {
-        successor->OnDependencyComplete();
+        if (successor->OnDependencyComplete())
+        {
+            ScheduleJob(successor);
+        }
     }
 
-    // Schedule newly ready jobs
-    ScheduleReadyJobs();
+    // Last access to the graph: Wait() may return as soon as this lands
+    m_completedCount.fetch_add(1, std::memory_order_acq_rel);
 }
 
 void JobGraph::Wait()
 {
-    while (!IsComplete())
-    {
-        std::this_thread::yield();
-    }
+    JobSystem::Get().WaitUntil([this]() { return IsComplete(); });
     m_executing.store(false);
 }
 
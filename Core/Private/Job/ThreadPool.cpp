@@ -4,10 +4,89 @@
  */
 
 #include "Core/Job/ThreadPool.h"
+#include "Core/Job/WorkStealingDeque.h"
+#include <algorithm>
 
 namespace RVX
 {
 
+namespace
+{
+    constexpr size_t kTaskSlabSize = 256;
+    // Tasks moved between a worker's free list and the shared one at a time
+    constexpr uint32_t kFreeBatchSize = 64;
+    // Yields before an idle thread goes to sleep
+    constexpr int kIdleSpinCount = 64;
+
+    thread_local const ThreadPool* t_pool = nullptr;
+    thread_local int32_t t_workerIndex = -1;
+
+    int32_t LaneOf(int32_t priority)
+    {
+        return std::clamp(priority, 0, ThreadPool::kLaneCount - 1);
+    }
+} // namespace
+
+struct alignas(64) ThreadPool::Worker
+{
+    WorkStealingDeque<Task> lanes[kLaneCount];
+
+    // Owner-only free list
+    Task* freeTasks = nullptr;
+    uint32_t freeCount = 0;
+    uint32_t stealCursor = 0;
+
+    std::atomic<size_t> steals{0};
+    std::thread thread;
+};
+
+/// Mutex-guarded ring for tasks submitted from outside the pool
+struct alignas(64) ThreadPool::InjectionQueue
+{
+    std::mutex mutex;
+    std::vector<Task*> ring;
+    size_t head = 0;
+    size_t count = 0;
+    std::atomic<size_t> size{0};
+
+    void Push(Task* task)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == ring.size())
+        {
+            std::vector<Task*> grown(std::max<size_t>(64, ring.size() * 2));
+            for (size_t i = 0; i < count; ++i)
+            {
+                grown[i] = ring[(head + i) % ring.size()];
+            }
+            ring.swap(grown);
+            head = 0;
+        }
+        ring[(head + count) % ring.size()] = task;
+        ++count;
+        size.store(count, std::memory_order_release);
+    }
+
+    Task* Pop()
+    {
+        if (size.load(std::memory_order_acquire) == 0)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == 0)
+        {
+            return nullptr;
+        }
+        Task* task = ring[head];
+        head = (head + 1) % ring.size();
+        --count;
+        size.store(count, std::memory_order_release);
+        return task;
+    }
+};
+
 ThreadPool::ThreadPool(size_t numThreads)
 {
     if (numThreads == 0)
@@ -19,92 +98,298 @@ ThreadPool::ThreadPool(size_t numThreads)
         }
     }
 
-    m_threads.reserve(numThreads);
+    m_injection = std::make_unique<InjectionQueue[]>(kLaneCount);
+
+    // All deques must exist before any worker starts stealing
+    m_workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
     for (size_t i = 0; i < numThreads; ++i)
     {
-        m_threads.emplace_back(&ThreadPool::WorkerLoop, this);
+        m_workers[i]->thread = std::thread(&ThreadPool::WorkerLoop, this, i);
     }
 }
 
 ThreadPool::~ThreadPool()
 {
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
         m_stopping = true;
     }
 
-    m_condition.notify_all();
+    m_workCondition.notify_all();
 
-    for (auto& thread : m_threads)
+    for (auto& worker : m_workers)
     {
-        if (thread.joinable())
+        if (worker->thread.joinable())
         {
-            thread.join();
+            worker->thread.join();
         }
     }
 }
 
-void ThreadPool::SubmitDetached(std::function<void()> task)
+void ThreadPool::WaitAll()
 {
+    RunUntil([this]() { return m_pendingTasks.load(std::memory_order_acquire) == 0; });
+}
+
+bool ThreadPool::TryRunTask()
+{
+    Worker* self = CurrentWorker();
+    Task* task = FindTask(self);
+    if (!task)
+    {
+        return false;
+    }
+    RunTask(task, self);
+    return true;
+}
+
+size_t ThreadPool::GetPendingCount() const
+{
+    return static_cast<size_t>(std::max<int64_t>(0, m_pendingTasks.load(std::memory_order_acquire)));
+}
+
+size_t ThreadPool::GetStealCount() const
+{
+    size_t steals = 0;
+    for (const auto& worker : m_workers)
+    {
+        steals += worker->steals.load(std::memory_order_relaxed);
+    }
+    return steals;
+}
+
+int32_t ThreadPool::GetCurrentWorkerIndex() const
+{
+    return t_pool == this ? t_workerIndex : -1;
+}
+
+ThreadPool::Worker* ThreadPool::CurrentWorker() const
+{
+    return t_pool == this ? m_workers[t_workerIndex].get() : nullptr;
+}
+
+Task* ThreadPool::AllocateTask(Worker* self)
+{
+    if (self && self->freeTasks)
+    {
+        Task* task = self->freeTasks;
+        self->freeTasks = task->next;
+        --self->freeCount;
+        return task;
+    }
+
+    std::lock_guard<std::mutex> lock(m_freeMutex);
+    if (!m_freeTasks)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_stopping)
+        auto slab = std::make_unique<Task[]>(kTaskSlabSize);
+        for (size_t i = 0; i < kTaskSlabSize; ++i)
         {
-            return;
+            slab[i].next = i + 1 < kTaskSlabSize ? &slab[i + 1] : nullptr;
+        }
+        m_freeTasks = &slab[0];
+        m_taskSlabs.push_back(std::move(slab));
+    }
+
+    Task* task = m_freeTasks;
+    m_freeTasks = task->next;
+
+    // Workers take a batch so the next allocations stay off the lock
+    if (self)
+    {
+        while (m_freeTasks && self->freeCount < kFreeBatchSize)
+        {
+            Task* cached = m_freeTasks;
+            m_freeTasks = cached->next;
+            cached->next = self->freeTasks;
+            self->freeTasks = cached;
+            ++self->freeCount;
         }
-        m_tasks.emplace(Task{std::move(task), 0});
     }
-    m_condition.notify_one();
+    return task;
 }
 
-void ThreadPool::WaitAll()
+void ThreadPool::FreeTask(Task* task, Worker* self)
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    m_completionCondition.wait(lock, [this]() {
-        return m_tasks.empty() && m_activeTasks == 0;
-    });
+    if (!self)
+    {
+        std::lock_guard<std::mutex> lock(m_freeMutex);
+        task->next = m_freeTasks;
+        m_freeTasks = task;
+        return;
+    }
+
+    task->next = self->freeTasks;
+    self->freeTasks = task;
+    ++self->freeCount;
+
+    // Workers that mostly run tasks submitted elsewhere hand the surplus back
+    if (self->freeCount >= 2 * kFreeBatchSize)
+    {
+        Task* first = self->freeTasks;
+        Task* last = first;
+        for (uint32_t i = 1; i < kFreeBatchSize; ++i)
+        {
+            last = last->next;
+        }
+        self->freeTasks = last->next;
+        self->freeCount -= kFreeBatchSize;
+
+        std::lock_guard<std::mutex> lock(m_freeMutex);
+        last->next = m_freeTasks;
+        m_freeTasks = first;
+    }
 }
 
-size_t ThreadPool::GetPendingCount() const
+void ThreadPool::Enqueue(Task* task, int32_t priority, Worker* self)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_tasks.size() + m_activeTasks;
+    m_pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    m_queuedTasks.fetch_add(1, std::memory_order_seq_cst);
+
+    const int32_t lane = LaneOf(priority);
+    if (!self || !self->lanes[lane].Push(task))
+    {
+        m_injection[lane].Push(task);
+    }
+
+    if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_workCondition.notify_one();
+    }
+    if (m_sleepingWaiters.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_completionCondition.notify_all();
+    }
 }
 
-void ThreadPool::WorkerLoop()
+Task* ThreadPool::FindTask(Worker* self)
 {
-    while (true)
+    if (m_queuedTasks.load(std::memory_order_acquire) <= 0)
+    {
+        return nullptr;
+    }
+
+    const size_t workerCount = m_workers.size();
+    for (int32_t lane = kLaneCount - 1; lane >= 0; --lane)
     {
-        Task taskWrapper;
+        if (self)
+        {
+            if (Task* task = self->lanes[lane].Pop())
+            {
+                return task;
+            }
+        }
 
+        if (Task* task = m_injection[lane].Pop())
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_condition.wait(lock, [this]() {
-                return m_stopping || !m_tasks.empty();
-            });
+            return task;
+        }
 
-            if (m_stopping && m_tasks.empty())
+        // Steal, starting after the last victim so thieves spread out
+        const size_t start = self ? self->stealCursor : static_cast<size_t>(lane);
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            const size_t victimIndex = (start + i) % workerCount;
+            Worker* victim = m_workers[victimIndex].get();
+            if (victim == self || victim->lanes[lane].IsEmpty())
+            {
+                continue;
+            }
+            if (Task* task = victim->lanes[lane].Steal())
             {
-                return;
+                if (self)
+                {
+                    self->stealCursor = static_cast<uint32_t>(victimIndex);
+                    self->steals.fetch_add(1, std::memory_order_relaxed);
+                }
+                return task;
             }
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::RunTask(Task* task, Worker* self)
+{
+    m_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+
+    task->func.Run();
+    FreeTask(task, self);
+
+    m_pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    m_completionEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepingWaiters.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_completionCondition.notify_all();
+    }
+}
+
+void ThreadPool::WaitForProgress(uint64_t epoch)
+{
+    auto progressed = [this, epoch]()
+    {
+        return m_completionEpoch.load(std::memory_order_seq_cst) != epoch ||
+               m_queuedTasks.load(std::memory_order_seq_cst) > 0;
+    };
+
+    for (int spin = 0; spin < kIdleSpinCount; ++spin)
+    {
+        if (progressed())
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_sleepingWaiters.fetch_add(1, std::memory_order_seq_cst);
+    m_completionCondition.wait(lock, progressed);
+    m_sleepingWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::WorkerLoop(size_t index)
+{
+    t_pool = this;
+    t_workerIndex = static_cast<int32_t>(index);
+    Worker* self = m_workers[index].get();
+    self->stealCursor = static_cast<uint32_t>((index + 1) % m_workers.size());
 
-            // priority_queue uses top() instead of front()
-            taskWrapper = std::move(const_cast<Task&>(m_tasks.top()));
-            m_tasks.pop();
-            ++m_activeTasks;
+    while (true)
+    {
+        if (Task* task = FindTask(self))
+        {
+            RunTask(task, self);
+            continue;
         }
 
-        // Execute the task
-        if (taskWrapper.func)
+        bool found = false;
+        for (int spin = 0; spin < kIdleSpinCount && !found; ++spin)
+        {
+            std::this_thread::yield();
+            found = m_queuedTasks.load(std::memory_order_acquire) > 0;
+        }
+        if (found)
         {
-            taskWrapper.func();
+            continue;
         }
 
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        m_workCondition.wait(lock, [this]() {
+            return m_stopping || m_queuedTasks.load(std::memory_order_seq_cst) > 0;
+        });
+        m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+        if (m_stopping && m_queuedTasks.load(std::memory_order_acquire) <= 0)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            --m_activeTasks;
+            return;
         }
-        m_completionCondition.notify_all();
     }
 }
 
@@ -12,6 +12,7 @@
 #include "Core/Math/Ray.h"
 #include "Core/Math/AABB.h"
 #include "Core/Math/Sphere.h"
+#include "Core/Math/Frustum.h"
 #include "Geometry/Primitives/Triangle.h"
 
 namespace RVX::Geometry::SIMD
@@ -616,4 +617,82 @@ inline uint32_t SphereBatchAABBTest(const Sphere& sphere, const BatchAABB4& boxe
     return static_cast<uint32_t>(hitMask.MoveMask()) & 0xF;
 }
 
+// ============================================================================
+// AABB-AABB Batch Intersection
+// ============================================================================
+
+/**
+ * @brief Test 1 AABB against 4 AABBs
+ * 
+ * Touching boxes count as overlapping, matching AABB::Overlaps.
+ * 
+ * @param box The box to test
+ * @param boxes 4 AABBs in SOA layout
+ * @return Bitmask of overlaps
+ */
+inline uint32_t AABBBatchOverlapTest(const AABB& box, const BatchAABB4& boxes)
+{
+    Float4 overlapX = (boxes.minX <= Float4::Splat(box.GetMax().x)).And(boxes.maxX >= Float4::Splat(box.GetMin().x));
+    Float4 overlapY = (boxes.minY <= Float4::Splat(box.GetMax().y)).And(boxes.maxY >= Float4::Splat(box.GetMin().y));
+    Float4 overlapZ = (boxes.minZ <= Float4::Splat(box.GetMax().z)).And(boxes.maxZ >= Float4::Splat(box.GetMin().z));
+
+    Float4 hitMask = overlapX.And(overlapY).And(overlapZ);
+    return static_cast<uint32_t>(hitMask.MoveMask()) & 0xF;
+}
+
+// ============================================================================
+// Frustum-AABB Batch Intersection
+// ============================================================================
+
+/**
+ * @brief Test a frustum against 4 AABBs
+ * 
+ * Uses the same positive/negative vertex test as Frustum::Intersects,
+ * so the masks agree with the scalar classification.
+ * 
+ * @param frustum The frustum to test
+ * @param boxes 4 AABBs in SOA layout
+ * @param outInsideMask Output: bit i set if box i is fully inside
+ * @return Bitmask of boxes that are not outside
+ */
+inline uint32_t FrustumBatchAABBTest(
+    const Frustum& frustum,
+    const BatchAABB4& boxes,
+    uint32_t& outInsideMask)
+{
+    Float4 outside = Float4::Zero();
+    Float4 partial = Float4::Zero();
+
+    for (int i = 0; i < 6; ++i)
+    {
+        const Plane& plane = frustum.GetPlane(i);
+
+        // The normal is shared by all boxes, so vertex selection needs no per-lane select
+        const bool px = plane.normal.x >= 0.0f;
+        const bool py = plane.normal.y >= 0.0f;
+        const bool pz = plane.normal.z >= 0.0f;
+
+        Float4 nx = Float4::Splat(plane.normal.x);
+        Float4 ny = Float4::Splat(plane.normal.y);
+        Float4 nz = Float4::Splat(plane.normal.z);
+        Float4 d = Float4::Splat(plane.distance);
+
+        Float4 pDist = nx * (px ? boxes.maxX : boxes.minX) +
+                       ny * (py ? boxes.maxY : boxes.minY) +
+                       nz * (pz ? boxes.maxZ : boxes.minZ) + d;
+        Float4 nDist = nx * (px ? boxes.minX : boxes.maxX) +
+                       ny * (py ? boxes.minY : boxes.maxY) +
+                       nz * (pz ? boxes.minZ : boxes.maxZ) + d;
+
+        outside = outside.Or(pDist < Float4::Zero());
+        partial = partial.Or(nDist < Float4::Zero());
+    }
+
+    const uint32_t outsideMask = static_cast<uint32_t>(outside.MoveMask()) & 0xF;
+    const uint32_t partialMask = static_cast<uint32_t>(partial.MoveMask()) & 0xF;
+
+    outInsideMask = ~(outsideMask | partialMask) & 0xF;
+    return ~outsideMask & 0xF;
+}
+
 } // namespace RVX::Geometry::SIMD
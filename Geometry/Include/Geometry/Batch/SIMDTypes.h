@@ -78,7 +78,12 @@ struct Float4
     // Select: (mask ? a : b)
     Float4 Select(Float4 a, Float4 b) const
     {
+#if defined(__SSE4_1__) || defined(_MSC_VER)
         return Float4(_mm_blendv_ps(b.data, a.data, data));
+#else
+        // blendv is SSE4.1; GCC/Clang only allow it when targeting it
+        return Float4(_mm_or_ps(_mm_and_ps(data, a.data), _mm_andnot_ps(data, b.data)));
+#endif
     }
 
     // Convert mask to int bitmask
@@ -64,12 +64,14 @@ public:
      * @param a First shape
      * @param b Second shape
      * @param maxIterations Maximum iterations (default: 32)
+     * @param outSimplex Optional final simplex, the starting polytope for EPA
      * @return GJKResult containing collision info
      */
     static GJKResult Query(
         const IConvexShape& a,
         const IConvexShape& b,
-        int maxIterations = 32)
+        int maxIterations = 32,
+        Simplex* outSimplex = nullptr)
     {
         GJKResult result;
         Simplex simplex;
@@ -114,12 +116,14 @@ public:
             {
                 result.intersecting = true;
                 result.distance = 0.0f;
+                if (outSimplex) *outSimplex = simplex;
                 return result;
             }
         }
 
         // Did not converge - assume intersection
         result.intersecting = true;
+        if (outSimplex) *outSimplex = simplex;
         return result;
     }
 
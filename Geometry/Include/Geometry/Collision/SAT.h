@@ -7,6 +7,7 @@
 
 #include "Core/MathTypes.h"
 #include "Geometry/Primitives/OBB.h"
+#include "Geometry/Primitives/Capsule.h"
 #include "Geometry/Collision/ContactManifold.h"
 #include "Geometry/Constants.h"
 #include <cmath>
@@ -451,8 +452,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(0, -R[2][0], R[1][0]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 6)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 6)) return false;
         }
     }
 
@@ -463,8 +465,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(0, -R[2][1], R[1][1]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 7)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 7)) return false;
         }
     }
 
@@ -475,8 +478,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(0, -R[2][2], R[1][2]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 8)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 8)) return false;
         }
     }
 
@@ -487,8 +491,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(R[2][0], 0, -R[0][0]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 9)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 9)) return false;
         }
     }
 
@@ -499,8 +504,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(R[2][1], 0, -R[0][1]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 10)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 10)) return false;
         }
     }
 
@@ -511,8 +517,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(R[2][2], 0, -R[0][2]);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 11)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 11)) return false;
         }
     }
 
@@ -523,8 +530,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(-R[1][0], R[0][0], 0);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 12)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 12)) return false;
         }
     }
 
@@ -535,8 +543,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(-R[1][1], R[0][1], 0);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 13)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 13)) return false;
         }
     }
 
@@ -547,8 +556,9 @@ inline bool SATTestOBB(
         Vec3 localAxis(-R[1][2], R[0][2], 0);
         if (glm::dot(localAxis, localAxis) > EPSILON)
         {
-            localAxis = glm::normalize(localAxis);
-            if (!TestAxis(localAxis, ra, rb, 14)) return false;
+            // ra and rb were projected onto the unnormalized axis
+            const float axisLength = glm::length(localAxis);
+            if (!TestAxis(localAxis / axisLength, ra / axisLength, rb / axisLength, 14)) return false;
         }
     }
 
@@ -61,6 +61,11 @@ namespace RVX::Net
      */
     using OnDataCallback = std::function<void(ConnectionPtr, std::span<const uint8>, ChannelId)>;
 
+    /**
+     * @brief Creates the transport a NetworkManager sends through
+     */
+    using TransportFactory = std::function<TransportPtr()>;
+
     /**
      * @brief Central network manager
      * 
@@ -107,6 +112,14 @@ namespace RVX::Net
          */
         void Stop();
 
+        /**
+         * @brief Set how StartServer() and Connect() create their transport
+         *
+         * Defaults to UDP. Used to run servers and clients in one process over
+         * a loopback transport. Takes effect the next time networking starts.
+         */
+        void SetTransportFactory(TransportFactory factory);
+
         /**
          * @brief Update network (call every frame)
          * @param deltaTime Time since last update
@@ -245,6 +258,13 @@ namespace RVX::Net
          */
         NetworkStats GetStats() const;
 
+        /**
+         * @brief Set configuration; takes effect the next time networking starts
+         *
+         * The transport's bind port comes from StartServer() or Connect().
+         */
+        void SetConfig(const NetworkManagerConfig& config) { m_config = config; }
+
         /**
          * @brief Get configuration
          */
@@ -257,7 +277,8 @@ namespace RVX::Net
         NetworkManagerConfig m_config;
         
         // Transport
-        std::shared_ptr<UDPTransport> m_transport;
+        TransportPtr m_transport;
+        TransportFactory m_transportFactory;
         std::unique_ptr<ReliableUDP> m_reliable;
         
         // Connections
@@ -295,6 +316,7 @@ namespace RVX::Net
         void HandlePong(const NetworkAddress& source, BitReader& reader);
         void HandleUserData(const NetworkAddress& source, std::span<const uint8> payload);
         
+        TransportPtr CreateTransport() const;
         ConnectionPtr CreateConnection(const NetworkAddress& address);
         void RemoveConnection(ConnectionId id, DisconnectReason reason);
         std::string AddressToKey(const NetworkAddress& address) const;
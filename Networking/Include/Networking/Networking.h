@@ -14,7 +14,10 @@
  * - Bit-level serialization for bandwidth efficiency
  * - Object replication with delta compression
  * - Property-level change tracking
+ * - Spatial interest management (per-connection relevancy)
  * - Fragmentation for large packets
+ * - In-process loopback transport for tests
+ * - Optional dedicated UDP I/O thread with batched datagram syscalls (Linux)
  * 
  * Usage:
  * @code
@@ -50,8 +53,10 @@
 
 // Transport
 #include "Networking/Transport/ITransport.h"
+#include "Networking/Transport/DatagramRing.h"
 #include "Networking/Transport/UDPTransport.h"
 #include "Networking/Transport/ReliableUDP.h"
+#include "Networking/Transport/LoopbackTransport.h"
 
 // Connection management
 #include "Networking/Packet.h"
@@ -61,6 +66,7 @@
 // Replication
 #include "Networking/Replication/ReplicatedObject.h"
 #include "Networking/Replication/PropertyReplication.h"
+#include "Networking/Replication/InterestManager.h"
 
 // Subsystem
 #include "Networking/NetworkSubsystem.h"
@@ -24,7 +24,7 @@ namespace RVX::Net
         uint16 payloadSize = 0;
         ConnectionId connectionId = RVX_NET_INVALID_CONNECTION_ID;
         
-        static constexpr uint32 kSize = 12; // bytes
+        static constexpr uint32 kSize = 13; // bytes: magic 4, version 2, type 1, payload size 2, connection 4
         
         void Serialize(BitWriter& writer) const
         {
@@ -175,8 +175,8 @@ namespace RVX::Net
          */
         BitWriter BeginWrite()
         {
-            m_data.clear();
-            m_data.resize(PacketHeader::kSize); // Reserve space for header
+            // Sized for the largest packet; EndWrite() trims to what was written
+            m_data.assign(RVX_NET_MAX_PACKET_SIZE, 0);
             return BitWriter(m_data.data() + PacketHeader::kSize, 
                             RVX_NET_MAX_PACKET_SIZE - PacketHeader::kSize);
         }
@@ -186,13 +186,15 @@ namespace RVX::Net
          */
         void EndWrite(BitWriter& writer)
         {
-            uint32 payloadSize = writer.GetBytesWritten();
+            // GetSpan() flushes the last bits into m_data before it is trimmed
+            uint32 payloadSize = static_cast<uint32>(writer.GetSpan().size());
             m_data.resize(PacketHeader::kSize + payloadSize);
             m_header.payloadSize = static_cast<uint16>(payloadSize);
             
             // Write header
             BitWriter headerWriter(m_data.data(), PacketHeader::kSize);
             m_header.Serialize(headerWriter);
+            headerWriter.Flush();
         }
 
         /**
@@ -207,6 +209,7 @@ namespace RVX::Net
             // Write header
             BitWriter headerWriter(m_data.data(), PacketHeader::kSize);
             m_header.Serialize(headerWriter);
+            headerWriter.Flush();
         }
 
         // =====================================================================
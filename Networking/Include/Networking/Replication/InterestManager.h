@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file InterestManager.h
+ * @brief Spatial relevancy of replicated objects to connections
+ */
+
+#include "Networking/Replication/ReplicatedObject.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace RVX::Net
+{
+    /**
+     * @brief Interest management configuration
+     */
+    struct InterestConfig
+    {
+        /// Edge length of the XZ grid cells, in world units
+        float32 cellSize = 32.0f;
+
+        /// Radius for viewers that do not set their own
+        float32 viewRadius = 150.0f;
+
+        /// How far an object or viewer may stray outside its cell before it
+        /// moves to the next one, so movement along a cell edge does not
+        /// repeatedly spawn and despawn objects
+        float32 hysteresis = 4.0f;
+    };
+
+    /**
+     * @brief An object becoming relevant or irrelevant to a connection
+     */
+    struct RelevancyChange
+    {
+        ConnectionId connection = RVX_NET_INVALID_CONNECTION_ID;
+        NetObjectId netId = RVX_NET_INVALID_OBJECT_ID;
+        bool relevant = false;      ///< true if the object entered the connection's view
+    };
+
+    /**
+     * @brief Tracks which replicated objects each connection can see
+     *
+     * Objects with a position are binned into a uniform grid on the XZ plane.
+     * Each connection has a viewer that watches the cells within its radius
+     * of the viewer's cell, and an object is relevant to the viewers watching
+     * its cell. Objects without a position are relevant to every viewer.
+     *
+     * Relevancy is maintained incrementally: nothing is evaluated while
+     * objects and viewers move within their cells. When an object changes
+     * cell only the viewers of the two cells are compared, and when a viewer
+     * changes cell only the cells entering and leaving its view are visited.
+     * Every transition is recorded as a RelevancyChange until ClearChanges().
+     *
+     * Every object within a viewer's radius is relevant to it; objects up to
+     * about a cell further away may be too.
+     */
+    class InterestManager
+    {
+    public:
+        explicit InterestManager(const InterestConfig& config = {});
+
+        const InterestConfig& GetConfig() const { return m_config; }
+
+        // =====================================================================
+        // Objects
+        // =====================================================================
+
+        /**
+         * @brief Add an object at a position, or move it
+         */
+        void SetObjectPosition(NetObjectId netId, const Vec3& position);
+
+        /**
+         * @brief Add an object relevant to every viewer, or make an object so
+         */
+        void SetObjectGlobal(NetObjectId netId);
+
+        /**
+         * @brief Remove an object; viewers that could see it record a change
+         */
+        void RemoveObject(NetObjectId netId);
+
+        /**
+         * @brief Check if any viewer may see an object
+         */
+        bool IsRelevantToAny(NetObjectId netId) const;
+
+        // =====================================================================
+        // Viewers
+        // =====================================================================
+
+        /**
+         * @brief Add a viewer with no position, which sees only global objects
+         */
+        void AddViewer(ConnectionId connection);
+
+        /**
+         * @brief Add or move a connection's viewer
+         * @param radius View radius (0 = InterestConfig::viewRadius)
+         */
+        void SetViewerPosition(ConnectionId connection, const Vec3& position, float32 radius = 0.0f);
+
+        /**
+         * @brief Remove a connection's viewer without recording changes
+         */
+        void RemoveViewer(ConnectionId connection);
+
+        bool HasViewer(ConnectionId connection) const { return m_viewers.contains(connection); }
+
+        // =====================================================================
+        // Queries
+        // =====================================================================
+
+        bool IsRelevant(ConnectionId connection, NetObjectId netId) const;
+
+        /**
+         * @brief Get the objects relevant to a connection
+         * @return nullptr if the connection has no viewer
+         */
+        const std::unordered_set<NetObjectId>* GetRelevantObjects(ConnectionId connection) const;
+
+        /**
+         * @brief Number of (connection, object) pairs that are relevant
+         */
+        size_t GetRelevantPairCount() const;
+
+        /**
+         * @brief Transitions recorded since the last ClearChanges(), in order
+         */
+        const std::vector<RelevancyChange>& GetChanges() const { return m_changes; }
+        void ClearChanges() { m_changes.clear(); }
+
+    private:
+        using CellKey = uint64;
+
+        struct CellCoord
+        {
+            int32 x = 0;
+            int32 z = 0;
+        };
+
+        struct Cell
+        {
+            std::vector<NetObjectId> objects;
+            std::vector<ConnectionId> viewers;
+        };
+
+        struct ObjectEntry
+        {
+            CellCoord cell;
+            uint32 slot = 0;            ///< Index in the cell's objects
+            bool global = false;
+        };
+
+        struct ViewerEntry
+        {
+            CellCoord cell;
+            float32 radius = 0.0f;
+            bool hasPosition = false;
+            std::vector<CellKey> watched;   ///< Sorted
+            std::unordered_set<NetObjectId> relevant;
+        };
+
+        static CellKey MakeKey(CellCoord cell);
+        CellCoord CellOf(const Vec3& position) const;
+        bool IsOutsideCell(CellCoord cell, const Vec3& position) const;
+        void ComputeWatchedCells(CellCoord center, float32 radius, std::vector<CellKey>& outKeys) const;
+
+        void InsertIntoCell(NetObjectId netId, ObjectEntry& entry);
+        void RemoveFromCell(const ObjectEntry& entry);
+        void RemoveGlobal(NetObjectId netId);
+        void EraseCellIfEmpty(CellKey key);
+        void WatchCell(ConnectionId connection, ViewerEntry& viewer, CellKey key);
+        void UnwatchCell(ConnectionId connection, ViewerEntry& viewer, CellKey key);
+
+        void Enter(ConnectionId connection, ViewerEntry& viewer, NetObjectId netId);
+        void Leave(ConnectionId connection, ViewerEntry& viewer, NetObjectId netId);
+
+        InterestConfig m_config;
+        std::unordered_map<CellKey, Cell> m_cells;
+        std::unordered_map<NetObjectId, ObjectEntry> m_objects;
+        std::vector<NetObjectId> m_globalObjects;
+        std::unordered_map<ConnectionId, ViewerEntry> m_viewers;
+        std::vector<RelevancyChange> m_changes;
+
+        // Scratch for viewer cell changes
+        std::vector<CellKey> m_watchedScratch;
+    };
+
+} // namespace RVX::Net
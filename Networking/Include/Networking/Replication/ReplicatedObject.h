@@ -10,10 +10,13 @@
 #include "Networking/NetworkTypes.h"
 #include "Networking/Serialization/NetworkSerializer.h"
 
+#include <deque>
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 
 namespace RVX::Net
@@ -21,6 +24,8 @@ namespace RVX::Net
     // Forward declarations
     class NetworkManager;
     class PropertyReplicator;
+    class InterestManager;
+    struct InterestConfig;
 
     /**
      * @brief Network object identifier
@@ -84,6 +89,41 @@ namespace RVX::Net
         float32 relevancyDistance = 0.0f;
     };
 
+    /**
+     * @brief Outgoing replication limits, applied to each connection
+     */
+    struct ReplicationBudgetConfig
+    {
+        /// State bytes each connection may be sent per second
+        uint32 bytesPerSecond = 64 * 1024;
+
+        /// Largest state packet payload in bytes; with the packet headers
+        /// added it must stay under ReliableUDP's fragment size
+        uint32 maxPacketBytes = 1100;
+
+        /// Distance at which an object's priority has halved (0 = ignore distance)
+        float32 distanceFalloff = 50.0f;
+
+        /// Sent snapshots remembered per connection while awaiting an ack.
+        /// Clients keep as many received states per object, so both ends must agree.
+        /// Objects in a snapshot dropped without an ack are sent as full states again.
+        uint32 maxUnackedSnapshots = 64;
+    };
+
+    /**
+     * @brief Replication counters since Initialize()
+     */
+    struct ReplicationStats
+    {
+        uint64 snapshotsSent = 0;       ///< State packets sent
+        uint64 objectsSent = 0;         ///< Object states written into snapshots
+        uint64 deltaObjectsSent = 0;    ///< ... of which were encoded against a baseline
+        uint64 bytesSent = 0;           ///< State packet payload bytes
+        uint64 objectsDeferred = 0;     ///< Pending states left for a later tick by the budget
+        uint64 snapshotsAcked = 0;      ///< Snapshots acknowledged by clients
+        uint64 serializations = 0;      ///< SerializeState() calls on the server
+    };
+
     /**
      * @brief Base class for replicated network objects
      * 
@@ -143,8 +183,21 @@ namespace RVX::Net
          */
         virtual void DeserializeState(NetworkReader& reader) = 0;
 
+        /**
+         * @brief World position used for relevancy and distance priority
+         * @return false if the object has no position
+         */
+        virtual bool GetReplicationPosition(Vec3& outPosition) const
+        {
+            (void)outPosition;
+            return false;
+        }
+
         /**
          * @brief Serialize delta (changes only)
+         *
+         * ReplicationManager does not call this; it encodes SerializeState()
+         * output against the state each connection acknowledged.
          */
         virtual void SerializeDelta(NetworkWriter& writer) const
         {
@@ -214,6 +267,23 @@ namespace RVX::Net
 
     /**
      * @brief Manages replicated objects
+     *
+     * The server serializes an object when it is marked dirty or its update
+     * interval elapses, at most once per Update. Each connection keeps the
+     * last state it acknowledged for every object as a baseline; states are
+     * sent as 8-byte block deltas against it, or in full when there is none.
+     * Objects whose state differs from what a connection has accumulate
+     * priority from ReplicationPriority, distance to that connection's viewer
+     * and time spent waiting, and each Update sends the highest-priority ones
+     * until the connection's byte budget runs out.
+     *
+     * Clients decode snapshots in HandlePacket() and acknowledge them, which
+     * is what advances baselines on the server.
+     *
+     * With interest management enabled, objects are spawned on and despawned
+     * from each client as they become relevant to its viewer, and only
+     * relevant objects are considered for its snapshots. Objects no viewer
+     * can see are not serialized.
      */
     class ReplicationManager
     {
@@ -297,15 +367,51 @@ namespace RVX::Net
         void Update(float32 deltaTime);
 
         /**
-         * @brief Force sync an object immediately
+         * @brief Serialize an object on the next Update and send it ahead of others
          */
         void ForceSync(NetObjectId netId);
 
         /**
-         * @brief Mark object as dirty (needs sync)
+         * @brief Mark object as dirty (serialized again on the next Update)
          */
         void MarkDirty(NetObjectId netId);
 
+        /**
+         * @brief Handle a replication payload received from a connection
+         * @return false if the payload is not a replication packet
+         */
+        bool HandlePacket(ConnectionId source, std::span<const uint8> data);
+
+        // =====================================================================
+        // Budget and Priority
+        // =====================================================================
+
+        void SetBudgetConfig(const ReplicationBudgetConfig& config) { m_budget = config; }
+        const ReplicationBudgetConfig& GetBudgetConfig() const { return m_budget; }
+
+        /**
+         * @brief Set where a connection's viewer is, for distance priority and relevancy
+         * @param viewRadius Interest radius (0 = InterestConfig::viewRadius)
+         */
+        void SetViewerPosition(ConnectionId connection, const Vec3& position, float32 viewRadius = 0.0f);
+
+        const ReplicationStats& GetStats() const { return m_stats; }
+
+        // =====================================================================
+        // Interest Management
+        // =====================================================================
+
+        /**
+         * @brief Only replicate objects to connections whose viewer is near them
+         *
+         * Objects without a position stay relevant to every connection, and a
+         * connection sees only those until SetViewerPosition() is called for
+         * it. Enable before spawning objects.
+         */
+        void EnableInterestManagement(const InterestConfig& config);
+
+        const InterestManager* GetInterestManager() const { return m_interest.get(); }
+
         // =====================================================================
         // Authority
         // =====================================================================
@@ -321,26 +427,115 @@ namespace RVX::Net
         void RequestAuthority(NetObjectId netId);
 
     private:
+        using StateBytes = std::shared_ptr<const std::vector<uint8>>;
+
+        /// Latest serialized state of an object and its settings this Update (server)
+        struct ObjectState
+        {
+            StateBytes bytes;
+            ReplicationConfig config;
+            Vec3 position{0.0f};
+            bool hasPosition = false;
+            float32 timeSinceSerialize = 0.0f;
+            bool forceSend = false;
+        };
+
+        /// What one connection has of one object (server)
+        struct ConnectionObjectState
+        {
+            StateBytes baseline;                ///< Last acknowledged state
+            uint64 baselineSequence = 0;
+            uint64 firstSequence = 0;           ///< Earlier snapshots predate this state
+            StateBytes lastSent;
+            float32 timeSinceSent = 0.0f;
+            float32 priority = 0.0f;            ///< Accumulated while waiting to be sent
+        };
+
+        /// Server sequences never wrap; only their low 16 bits go on the wire
+        struct SentSnapshot
+        {
+            uint64 sequence = 0;
+            std::vector<std::pair<NetObjectId, StateBytes>> objects;
+        };
+
+        struct ConnectionState
+        {
+            std::unordered_map<NetObjectId, ConnectionObjectState> objects;
+            std::deque<SentSnapshot> unacked;
+            uint64 nextSequence = 0;
+            float32 byteCredit = 0.0f;
+            Vec3 viewerPosition{0.0f};
+            bool hasViewer = false;
+        };
+
+        /// A state received from the server, kept as a possible delta baseline (client)
+        struct ReceivedState
+        {
+            SequenceNumber sequence = 0;
+            std::vector<uint8> bytes;
+        };
+
+        struct SendCandidate
+        {
+            NetObjectId netId = RVX_NET_INVALID_OBJECT_ID;
+            float32 priority = 0.0f;
+            const ObjectState* state = nullptr;
+            ConnectionObjectState* connectionState = nullptr;
+        };
+
         NetworkManager* m_networkManager = nullptr;
+        ReplicationBudgetConfig m_budget;
+        ReplicationStats m_stats;
         
         // Object registry
         std::unordered_map<NetObjectId, ReplicatedObjectPtr> m_objects;
         std::unordered_map<std::string, ReplicatedObjectFactory> m_factories;
         NetObjectId m_nextNetId = 1;
         
-        // Dirty tracking
-        std::vector<NetObjectId> m_dirtyObjects;
-        std::unordered_map<NetObjectId, float32> m_lastSyncTime;
+        // Dirty tracking and serialized states (server)
+        std::unordered_set<NetObjectId> m_dirtyObjects;
+        std::unordered_map<NetObjectId, ObjectState> m_objectStates;
+
+        // Per-connection baselines and priorities (server)
+        std::unordered_map<ConnectionId, ConnectionState> m_connectionStates;
+        std::vector<SendCandidate> m_candidates;
+
+        // Per-connection relevancy (server, optional)
+        std::unique_ptr<InterestManager> m_interest;
+
+        // Received states and snapshot acks (client)
+        std::unordered_map<NetObjectId, std::deque<ReceivedState>> m_receivedStates;
+        SequenceNumber m_latestReceivedSequence = 0;
+        uint32 m_receivedSequenceBits = 0;
+        bool m_hasReceivedSnapshot = false;
         
-        // Serialization buffer
+        // Serialization buffers
         std::vector<uint8> m_serializationBuffer;
+        BitWriter m_stateWriter;
+        BitWriter m_recordWriter;
+        BitWriter m_packetWriter;
+        std::vector<uint8> m_packetRecords;
         
+        void SerializeObjects(float32 deltaTime);
+        void SendSnapshots(float32 deltaTime);
+        void SendConnectionSnapshots(ConnectionId connectionId, ConnectionState& connection, float32 deltaTime);
+        void AddSendCandidate(NetObjectId netId, const ObjectState& state, ConnectionState& connection,
+                              float32 deltaTime);
+        void DispatchRelevancyChanges();
+        void FlushSnapshot(ConnectionId connectionId, ConnectionState& connection,
+                           SentSnapshot& snapshot, uint32 objectCount);
+        void DropOldestSnapshot(ConnectionState& connection);
+        void WriteObjectRecord(NetObjectId netId, const std::vector<uint8>& state,
+                               const ConnectionObjectState& connectionState);
+        std::span<const uint8> WriteSpawnPacket(const IReplicatedObject& obj);
+        std::span<const uint8> WriteDespawnPacket(NetObjectId netId);
         void BroadcastSpawn(const ReplicatedObjectPtr& obj);
         void BroadcastDespawn(NetObjectId netId);
-        void BroadcastState(const ReplicatedObjectPtr& obj);
+        void SendAck();
         void HandleSpawnPacket(ConnectionId source, BitReader& reader);
         void HandleDespawnPacket(ConnectionId source, BitReader& reader);
         void HandleStatePacket(ConnectionId source, BitReader& reader);
+        void HandleAckPacket(ConnectionId source, BitReader& reader);
     };
 
     /**
@@ -21,6 +21,10 @@ namespace RVX::Net
 {
     /**
      * @brief Read-only bit stream for deserializing network data
+     *
+     * Bits are read LSB-first from a 64-bit scratch word that is refilled a
+     * word at a time, so multi-bit reads cost a shift and a mask rather than
+     * one call per bit. Byte-aligned reads copy straight from the buffer.
      */
     class BitReader
     {
@@ -171,14 +175,28 @@ namespace RVX::Net
         void Reset();
         
     private:
+        void Refill();
+        void SeekToByte(uint32 byteIndex);
+
         const uint8* m_data = nullptr;
         uint32 m_totalBits = 0;
         uint32 m_bitPosition = 0;
         bool m_overflow = false;
+
+        // Unread bits starting at m_bitPosition, LSB first
+        uint64 m_scratch = 0;
+        uint32 m_scratchBits = 0;
+        uint32 m_nextByte = 0;      // First byte not yet loaded into m_scratch
     };
 
     /**
      * @brief Write-only bit stream for serializing network data
+     *
+     * Bits are packed LSB-first into a 64-bit scratch word and stored to the
+     * buffer a whole word at a time. The open word is flushed on Flush(),
+     * GetData(), GetSpan() and ToVector(), and before byte-aligned writes,
+     * which copy straight into the buffer. An external buffer read directly
+     * holds everything written only after one of those calls.
      */
     class BitWriter
     {
@@ -196,6 +214,9 @@ namespace RVX::Net
          * @brief Create writer that writes to external buffer
          */
         BitWriter(uint8* buffer, uint32 capacityBytes);
+
+        BitWriter(BitWriter&&) = default;
+        BitWriter& operator=(BitWriter&&) = default;
         
         // =====================================================================
         // Bit Operations
@@ -303,6 +324,11 @@ namespace RVX::Net
          */
         uint32 GetBytesWritten() const { return (m_bitPosition + 7) / 8; }
         
+        /**
+         * @brief Store bits still held in the scratch word into the buffer
+         */
+        void Flush() const { FlushScratch(); }
+
         /**
          * @brief Get the data buffer
          */
@@ -335,6 +361,9 @@ namespace RVX::Net
         
     private:
         void EnsureCapacity(uint32 additionalBits);
+        void StoreScratch(uint32 byteCount) const;
+        void FlushScratch() const;
+        void RestartScratch();
         
         std::vector<uint8> m_ownedBuffer;
         uint8* m_buffer = nullptr;
@@ -342,6 +371,11 @@ namespace RVX::Net
         uint32 m_bitPosition = 0;
         bool m_ownsBuffer = true;
         bool m_overflow = false;
+
+        // Bits written from byte m_scratchByte on that are not yet stored, LSB first
+        uint64 m_scratch = 0;
+        uint32 m_scratchBits = 0;
+        uint32 m_scratchByte = 0;
     };
 
     // =========================================================================
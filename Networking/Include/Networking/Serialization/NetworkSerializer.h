@@ -143,14 +143,15 @@ namespace RVX::Net
             // Reconstruct the largest component
             float32 d = std::sqrt(std::max(0.0f, 1.0f - a*a - b*b - c*c));
             
+            // Quat's constructor takes (w, x, y, z)
             Quat q;
             switch (largestIndex)
             {
-                case 0: q = Quat(d, a, b, c); break; // x was largest
-                case 1: q = Quat(a, d, b, c); break; // y was largest
-                case 2: q = Quat(a, b, d, c); break; // z was largest
-                case 3: q = Quat(a, b, c, d); break; // w was largest
-                default: q = Quat(0, 0, 0, 1); break;
+                case 0: q = Quat(c, d, a, b); break; // x was largest
+                case 1: q = Quat(c, a, d, b); break; // y was largest
+                case 2: q = Quat(c, a, b, d); break; // z was largest
+                case 3: q = Quat(d, a, b, c); break; // w was largest
+                default: q = Quat(1, 0, 0, 0); break;
             }
             
             return glm::normalize(q);
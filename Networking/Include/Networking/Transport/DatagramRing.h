@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file DatagramRing.h
+ * @brief Fixed-capacity single-producer single-consumer ring of datagram slots
+ */
+
+#include "Networking/NetworkTypes.h"
+
+#include <atomic>
+#include <memory>
+
+namespace RVX::Net
+{
+    /**
+     * @brief One datagram and the socket address it came from or goes to
+     */
+    struct DatagramSlot
+    {
+        /// Large enough for any sockaddr the transports use (sockaddr_in6 is 28 bytes)
+        static constexpr uint32 kMaxAddressBytes = 32;
+
+        alignas(8) uint8 address[kMaxAddressBytes];
+        uint32 addressSize = 0;
+        uint32 size = 0;
+        NetworkTime time;
+        uint8 data[RVX_NET_MAX_PACKET_SIZE];
+    };
+
+    /**
+     * @brief Lock-free ring handing datagrams between two threads
+     *
+     * The slots are allocated once and reused, so the ring doubles as the
+     * packet buffer pool: the producer fills slots in place (a batched
+     * receive can scatter straight into them) and publishes them, and the
+     * consumer reads them in place and hands them back. Neither side
+     * allocates or takes a lock per packet.
+     *
+     * Exactly one thread may call the producer methods and one the consumer
+     * methods. The ring does not grow; when it is full the producer sees no
+     * writable slots and decides whether to wait or drop.
+     */
+    class DatagramRing
+    {
+    public:
+        /// @param capacity Slot count, rounded up to a power of two
+        explicit DatagramRing(uint32 capacity = 2048)
+        {
+            uint32 size = 1;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            m_mask = size - 1;
+            m_slots = std::make_unique<DatagramSlot[]>(size);
+        }
+
+        DatagramRing(const DatagramRing&) = delete;
+        DatagramRing& operator=(const DatagramRing&) = delete;
+
+        uint32 GetCapacity() const { return m_mask + 1; }
+
+        // =====================================================================
+        // Producer
+        // =====================================================================
+
+        /// Slots the producer may fill before publishing
+        uint32 GetWritableCount() const
+        {
+            return GetCapacity() - (m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire));
+        }
+
+        /// The offset-th unpublished slot; offset < GetWritableCount()
+        DatagramSlot& GetWriteSlot(uint32 offset)
+        {
+            return m_slots[(m_head.load(std::memory_order_relaxed) + offset) & m_mask];
+        }
+
+        /// Make the first count unpublished slots visible to the consumer
+        void Publish(uint32 count)
+        {
+            m_head.store(m_head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        }
+
+        // =====================================================================
+        // Consumer
+        // =====================================================================
+
+        /// Published slots the consumer has not released
+        uint32 GetReadableCount() const
+        {
+            return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_relaxed);
+        }
+
+        /// The offset-th published slot; offset < GetReadableCount()
+        const DatagramSlot& GetReadSlot(uint32 offset) const
+        {
+            return m_slots[(m_tail.load(std::memory_order_relaxed) + offset) & m_mask];
+        }
+
+        /// Hand the first count published slots back to the producer
+        void Release(uint32 count)
+        {
+            m_tail.store(m_tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        }
+
+    private:
+        std::unique_ptr<DatagramSlot[]> m_slots;
+        uint32 m_mask = 0;
+
+        // Free-running; only their difference is meaningful. Separate cache
+        // lines so the two threads do not contend on them.
+        alignas(64) std::atomic<uint32> m_head{0};   ///< Written by the producer
+        alignas(64) std::atomic<uint32> m_tail{0};   ///< Written by the consumer
+    };
+
+} // namespace RVX::Net
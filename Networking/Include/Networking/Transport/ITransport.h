@@ -75,6 +75,13 @@ namespace RVX::Net
         
         /// Enable IPv6
         bool enableIPv6 = false;
+
+        /// Move socket I/O to a dedicated thread that batches datagrams
+        /// (UDP on Linux; elsewhere the socket is polled as usual)
+        bool dedicatedIOThread = false;
+
+        /// Datagrams each direction can hold between the I/O thread and the caller
+        uint32 ioQueueCapacity = 2048;
     };
 
     /**
@@ -0,0 +1,125 @@
+#pragma once
+
+/**
+ * @file LoopbackTransport.h
+ * @brief In-process transport for running servers and clients without sockets
+ */
+
+#include "Networking/Transport/ITransport.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace RVX::Net
+{
+    /**
+     * @brief Traffic through one loopback port
+     */
+    struct LoopbackPortStats
+    {
+        uint64 packetsSent = 0;
+        uint64 bytesSent = 0;
+        uint64 packetsReceived = 0;
+        uint64 bytesReceived = 0;
+        uint64 packetsDropped = 0;     ///< Sent to a port nothing is bound to
+    };
+
+    /**
+     * @brief Ports that LoopbackTransports bind to and deliver between
+     *
+     * Packets are routed by port only; host names are ignored. Delivery is
+     * immediate, in order and lossless, so every packet a transport sends is
+     * waiting at its destination on the destination's next ReceiveFrom().
+     * Per-port stats survive the transport unbinding, which lets tests read
+     * the traffic of clients that have already shut down.
+     */
+    class LoopbackNetwork
+    {
+    public:
+        /**
+         * @brief Get traffic counters for a port
+         */
+        LoopbackPortStats GetPortStats(uint16 port) const;
+
+        /**
+         * @brief Zero the traffic counters of every port
+         */
+        void ResetStats();
+
+    private:
+        friend class LoopbackTransport;
+
+        struct Port
+        {
+            std::deque<ReceivedPacket> queue;
+            LoopbackPortStats stats;
+            uint32 unnotified = 0;      ///< Packets not yet passed to the packet callback
+            bool bound = false;
+        };
+
+        bool Bind(uint16& port);
+        void Unbind(uint16 port);
+        TransportResult Deliver(uint16 sourcePort, uint16 destPort, std::span<const uint8> data);
+        TransportResult Receive(uint16 port, ReceivedPacket& outPacket);
+        uint32 TakeUnnotified(uint16 port, std::vector<ReceivedPacket>& outPackets);
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<uint16, Port> m_ports;
+        uint16 m_nextEphemeralPort = 49152;
+    };
+
+    /**
+     * @brief Transport delivering packets through a LoopbackNetwork
+     *
+     * Binds to "127.0.0.1" on the configured port, or on a free ephemeral
+     * port when it is 0.
+     */
+    class LoopbackTransport : public ITransport
+    {
+    public:
+        explicit LoopbackTransport(std::shared_ptr<LoopbackNetwork> network);
+        ~LoopbackTransport() override;
+
+        // =====================================================================
+        // ITransport Implementation
+        // =====================================================================
+
+        TransportResult Initialize(const TransportConfig& config) override;
+        void Shutdown() override;
+        bool IsActive() const override { return m_active; }
+
+        TransportResult SendTo(
+            const NetworkAddress& address,
+            std::span<const uint8> data) override;
+
+        TransportResult ReceiveFrom(ReceivedPacket& outPacket) override;
+
+        /**
+         * @brief Pass packets that arrived since the last Poll() to the packet callback
+         */
+        uint32 Poll(uint32 timeoutMs = 0) override;
+
+        void SetPacketCallback(PacketReceivedCallback callback) override;
+
+        NetworkAddress GetLocalAddress() const override;
+        const char* GetTypeName() const override { return "LoopbackTransport"; }
+        uint32 GetMTU() const override { return RVX_NET_MTU; }
+
+    private:
+        std::shared_ptr<LoopbackNetwork> m_network;
+        uint16 m_port = 0;
+        std::atomic<bool> m_active{false};
+
+        PacketReceivedCallback m_packetCallback;
+        std::vector<ReceivedPacket> m_callbackPackets;
+    };
+
+    /**
+     * @brief Create a loopback transport on a network
+     */
+    TransportPtr CreateLoopbackTransport(std::shared_ptr<LoopbackNetwork> network);
+
+} // namespace RVX::Net
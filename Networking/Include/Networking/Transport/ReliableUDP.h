@@ -22,9 +22,6 @@
 
 namespace RVX::Net
 {
-    // Forward declarations
-    class UDPTransport;
-
     /**
      * @brief Reliable packet header
      */
@@ -113,7 +110,7 @@ namespace RVX::Net
     /**
      * @brief Reliable UDP layer
      * 
-     * Wraps a UDPTransport to provide reliable delivery.
+     * Wraps a transport (UDP or loopback) to provide reliable delivery.
      */
     class ReliableUDP
     {
@@ -128,7 +125,7 @@ namespace RVX::Net
         /**
          * @brief Initialize with underlying transport
          */
-        bool Initialize(std::shared_ptr<UDPTransport> transport,
+        bool Initialize(TransportPtr transport,
                        const ReliableConfig& config = {});
 
         /**
@@ -250,7 +247,7 @@ namespace RVX::Net
             NetworkTime lastAckTime;
         };
 
-        std::shared_ptr<UDPTransport> m_transport;
+        TransportPtr m_transport;
         ReliableConfig m_config;
 
         // Per-address state
@@ -286,7 +283,7 @@ namespace RVX::Net
                                     std::span<const uint8> payload,
                                     const NetworkAddress& source);
         void ResendPendingPackets();
-        void SendAck(const NetworkAddress& address, ChannelId channel);
+        void SendAck(AddressState& state, const NetworkAddress& address, ChannelId channel);
         
         std::vector<uint8> AssembleFragments(const NetworkAddress& address,
                                               SequenceNumber sequence);
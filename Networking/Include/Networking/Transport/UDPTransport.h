@@ -25,11 +25,33 @@ namespace asio
 
 namespace RVX::Net
 {
+    class DatagramIOThread;
+
+    /**
+     * @brief Counters of the dedicated I/O thread
+     */
+    struct UDPIOStats
+    {
+        uint64 sendCalls = 0;           ///< sendmmsg() calls
+        uint64 packetsSent = 0;
+        uint64 sendErrors = 0;          ///< Datagrams dropped by a failed send
+        uint64 receiveCalls = 0;        ///< recvmmsg() calls
+        uint64 packetsReceived = 0;
+        uint64 receiveStalls = 0;       ///< Waits for the caller to drain a full receive queue
+    };
+
     /**
      * @brief UDP transport implementation
      * 
      * Uses ASIO for cross-platform UDP socket operations.
      * Supports both IPv4 and IPv6.
+     *
+     * By default the socket is read from Poll() on the calling thread, one
+     * datagram per handler, and SendTo() sends each datagram directly. With
+     * TransportConfig::dedicatedIOThread on Linux, a DatagramIOThread owns
+     * the socket instead: SendTo() and ReceiveFrom() only copy into and out
+     * of preallocated lock-free rings, and the thread moves the datagrams in
+     * batches with sendmmsg()/recvmmsg().
      */
     class UDPTransport : public ITransport
     {
@@ -78,6 +100,16 @@ namespace RVX::Net
          */
         uint32 GetPendingReceiveCount() const;
 
+        /**
+         * @brief Check if a dedicated I/O thread is serving the socket
+         */
+        bool HasIOThread() const;
+
+        /**
+         * @brief Get the I/O thread's counters (zero without one)
+         */
+        UDPIOStats GetIOStats() const;
+
     private:
         struct Impl;
         std::unique_ptr<Impl> m_impl;
@@ -90,7 +122,15 @@ namespace RVX::Net
         // Receive queue (thread-safe)
         std::queue<ReceivedPacket> m_receiveQueue;
         mutable std::mutex m_receiveMutex;
-        
+
+        // Dedicated I/O thread path
+        std::unique_ptr<DatagramIOThread> m_ioThread;
+        uint32 m_ioNotified = 0;        ///< Received datagrams already passed to the packet callback
+        ReceivedPacket m_callbackPacket;
+
+        TransportResult QueueSend(const NetworkAddress& address, std::span<const uint8> data);
+        void ReadSlot(uint32 offset, ReceivedPacket& outPacket) const;
+
         void StartReceive();
         void HandleReceive(const std::error_code& error, std::size_t bytesReceived);
     };
@@ -19,9 +19,9 @@ namespace RVX::Net
         }
 
         // Create transport
-        m_transport = std::make_shared<UDPTransport>();
+        m_transport = CreateTransport();
         
-        TransportConfig transportConfig;
+        TransportConfig transportConfig = m_config.transport;
         transportConfig.bindPort = port;
         transportConfig.reuseAddress = true;
         
@@ -59,9 +59,9 @@ namespace RVX::Net
         }
 
         // Create transport (bind to any available port)
-        m_transport = std::make_shared<UDPTransport>();
+        m_transport = CreateTransport();
         
-        TransportConfig transportConfig;
+        TransportConfig transportConfig = m_config.transport;
         transportConfig.bindPort = 0; // Auto-assign port
         
         if (m_transport->Initialize(transportConfig) != TransportResult::Success)
@@ -156,6 +156,11 @@ namespace RVX::Net
         RVX_CORE_INFO("NetworkManager stopped");
     }
 
+    void NetworkManager::SetTransportFactory(TransportFactory factory)
+    {
+        m_transportFactory = std::move(factory);
+    }
+
     void NetworkManager::Update(float32 deltaTime)
     {
         if (!m_active)
@@ -585,6 +590,11 @@ namespace RVX::Net
         return stats;
     }
 
+    TransportPtr NetworkManager::CreateTransport() const
+    {
+        return m_transportFactory ? m_transportFactory() : CreateUDPTransport();
+    }
+
     ConnectionPtr NetworkManager::CreateConnection(const NetworkAddress& address)
     {
         std::lock_guard<std::mutex> lock(m_connectionsMutex);
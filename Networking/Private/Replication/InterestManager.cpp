@@ -0,0 +1,387 @@
+#include "Networking/Replication/InterestManager.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace RVX::Net
+{
+    namespace
+    {
+        template<typename T>
+        void SwapRemove(std::vector<T>& values, T value)
+        {
+            auto it = std::find(values.begin(), values.end(), value);
+            if (it != values.end())
+            {
+                *it = values.back();
+                values.pop_back();
+            }
+        }
+
+        template<typename T>
+        bool Contains(const std::vector<T>& values, T value)
+        {
+            return std::find(values.begin(), values.end(), value) != values.end();
+        }
+    } // namespace
+
+    InterestManager::InterestManager(const InterestConfig& config)
+        : m_config(config)
+    {
+    }
+
+    // =========================================================================
+    // Grid
+    // =========================================================================
+
+    InterestManager::CellKey InterestManager::MakeKey(CellCoord cell)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(cell.x)) << 32) | static_cast<uint32>(cell.z);
+    }
+
+    InterestManager::CellCoord InterestManager::CellOf(const Vec3& position) const
+    {
+        return {static_cast<int32>(std::floor(position.x / m_config.cellSize)),
+                static_cast<int32>(std::floor(position.z / m_config.cellSize))};
+    }
+
+    bool InterestManager::IsOutsideCell(CellCoord cell, const Vec3& position) const
+    {
+        const float32 size = m_config.cellSize + 2.0f * m_config.hysteresis;
+        const float32 minX = static_cast<float32>(cell.x) * m_config.cellSize - m_config.hysteresis;
+        const float32 minZ = static_cast<float32>(cell.z) * m_config.cellSize - m_config.hysteresis;
+        return position.x < minX || position.x >= minX + size ||
+               position.z < minZ || position.z >= minZ + size;
+    }
+
+    void InterestManager::ComputeWatchedCells(CellCoord center, float32 radius, std::vector<CellKey>& outKeys) const
+    {
+        outKeys.clear();
+
+        // The viewer and the objects may each be up to the hysteresis outside their cells
+        const float32 reach = radius + 2.0f * m_config.hysteresis;
+        const int32 extent = static_cast<int32>(std::ceil(reach / m_config.cellSize)) + 1;
+
+        for (int32 dz = -extent; dz <= extent; ++dz)
+        {
+            for (int32 dx = -extent; dx <= extent; ++dx)
+            {
+                // Closest distance between a point in the center cell and one in this cell
+                const float32 gapX = static_cast<float32>(std::max(std::abs(dx) - 1, 0)) * m_config.cellSize;
+                const float32 gapZ = static_cast<float32>(std::max(std::abs(dz) - 1, 0)) * m_config.cellSize;
+                if (gapX * gapX + gapZ * gapZ <= reach * reach)
+                {
+                    outKeys.push_back(MakeKey({center.x + dx, center.z + dz}));
+                }
+            }
+        }
+
+        std::sort(outKeys.begin(), outKeys.end());
+    }
+
+    void InterestManager::InsertIntoCell(NetObjectId netId, ObjectEntry& entry)
+    {
+        Cell& cell = m_cells[MakeKey(entry.cell)];
+        entry.slot = static_cast<uint32>(cell.objects.size());
+        cell.objects.push_back(netId);
+    }
+
+    void InterestManager::RemoveFromCell(const ObjectEntry& entry)
+    {
+        Cell& cell = m_cells.at(MakeKey(entry.cell));
+        const NetObjectId moved = cell.objects.back();
+        cell.objects[entry.slot] = moved;
+        m_objects.at(moved).slot = entry.slot;
+        cell.objects.pop_back();
+    }
+
+    void InterestManager::RemoveGlobal(NetObjectId netId)
+    {
+        SwapRemove(m_globalObjects, netId);
+    }
+
+    void InterestManager::EraseCellIfEmpty(CellKey key)
+    {
+        auto it = m_cells.find(key);
+        if (it != m_cells.end() && it->second.objects.empty() && it->second.viewers.empty())
+        {
+            m_cells.erase(it);
+        }
+    }
+
+    void InterestManager::WatchCell(ConnectionId connection, ViewerEntry& viewer, CellKey key)
+    {
+        Cell& cell = m_cells[key];
+        cell.viewers.push_back(connection);
+        for (NetObjectId netId : cell.objects)
+        {
+            Enter(connection, viewer, netId);
+        }
+    }
+
+    void InterestManager::UnwatchCell(ConnectionId connection, ViewerEntry& viewer, CellKey key)
+    {
+        auto it = m_cells.find(key);
+        if (it == m_cells.end())
+            return;
+
+        SwapRemove(it->second.viewers, connection);
+        for (NetObjectId netId : it->second.objects)
+        {
+            Leave(connection, viewer, netId);
+        }
+        EraseCellIfEmpty(key);
+    }
+
+    void InterestManager::Enter(ConnectionId connection, ViewerEntry& viewer, NetObjectId netId)
+    {
+        if (viewer.relevant.insert(netId).second)
+        {
+            m_changes.push_back({connection, netId, true});
+        }
+    }
+
+    void InterestManager::Leave(ConnectionId connection, ViewerEntry& viewer, NetObjectId netId)
+    {
+        if (viewer.relevant.erase(netId) > 0)
+        {
+            m_changes.push_back({connection, netId, false});
+        }
+    }
+
+    // =========================================================================
+    // Objects
+    // =========================================================================
+
+    void InterestManager::SetObjectPosition(NetObjectId netId, const Vec3& position)
+    {
+        auto [it, inserted] = m_objects.try_emplace(netId);
+        ObjectEntry& entry = it->second;
+
+        if (inserted)
+        {
+            entry.cell = CellOf(position);
+            InsertIntoCell(netId, entry);
+            for (ConnectionId connection : m_cells.at(MakeKey(entry.cell)).viewers)
+            {
+                Enter(connection, m_viewers.at(connection), netId);
+            }
+            return;
+        }
+
+        if (entry.global)
+        {
+            RemoveGlobal(netId);
+            entry.global = false;
+            entry.cell = CellOf(position);
+            InsertIntoCell(netId, entry);
+
+            const Cell& cell = m_cells.at(MakeKey(entry.cell));
+            for (auto& [connection, viewer] : m_viewers)
+            {
+                if (!Contains(cell.viewers, connection))
+                {
+                    Leave(connection, viewer, netId);
+                }
+            }
+            return;
+        }
+
+        // Movement within the cell (plus hysteresis) changes nothing
+        if (!IsOutsideCell(entry.cell, position))
+            return;
+
+        const CellKey oldKey = MakeKey(entry.cell);
+        RemoveFromCell(entry);
+        entry.cell = CellOf(position);
+        InsertIntoCell(netId, entry);
+
+        // Only the viewers of one of the two cells see a transition
+        const Cell& oldCell = m_cells.at(oldKey);
+        const Cell& newCell = m_cells.at(MakeKey(entry.cell));
+        for (ConnectionId connection : oldCell.viewers)
+        {
+            if (!Contains(newCell.viewers, connection))
+            {
+                Leave(connection, m_viewers.at(connection), netId);
+            }
+        }
+        for (ConnectionId connection : newCell.viewers)
+        {
+            if (!Contains(oldCell.viewers, connection))
+            {
+                Enter(connection, m_viewers.at(connection), netId);
+            }
+        }
+        EraseCellIfEmpty(oldKey);
+    }
+
+    void InterestManager::SetObjectGlobal(NetObjectId netId)
+    {
+        auto [it, inserted] = m_objects.try_emplace(netId);
+        ObjectEntry& entry = it->second;
+        if (entry.global)
+            return;
+
+        if (!inserted)
+        {
+            const CellKey key = MakeKey(entry.cell);
+            RemoveFromCell(entry);
+            EraseCellIfEmpty(key);
+        }
+
+        entry.global = true;
+        m_globalObjects.push_back(netId);
+        for (auto& [connection, viewer] : m_viewers)
+        {
+            Enter(connection, viewer, netId);
+        }
+    }
+
+    void InterestManager::RemoveObject(NetObjectId netId)
+    {
+        auto it = m_objects.find(netId);
+        if (it == m_objects.end())
+            return;
+
+        const ObjectEntry& entry = it->second;
+        if (entry.global)
+        {
+            RemoveGlobal(netId);
+            for (auto& [connection, viewer] : m_viewers)
+            {
+                Leave(connection, viewer, netId);
+            }
+        }
+        else
+        {
+            const CellKey key = MakeKey(entry.cell);
+            for (ConnectionId connection : m_cells.at(key).viewers)
+            {
+                Leave(connection, m_viewers.at(connection), netId);
+            }
+            RemoveFromCell(entry);
+            EraseCellIfEmpty(key);
+        }
+
+        m_objects.erase(it);
+    }
+
+    bool InterestManager::IsRelevantToAny(NetObjectId netId) const
+    {
+        auto it = m_objects.find(netId);
+        if (it == m_objects.end())
+            return false;
+
+        if (it->second.global)
+            return !m_viewers.empty();
+
+        return !m_cells.at(MakeKey(it->second.cell)).viewers.empty();
+    }
+
+    // =========================================================================
+    // Viewers
+    // =========================================================================
+
+    void InterestManager::AddViewer(ConnectionId connection)
+    {
+        auto [it, inserted] = m_viewers.try_emplace(connection);
+        if (!inserted)
+            return;
+
+        for (NetObjectId netId : m_globalObjects)
+        {
+            Enter(connection, it->second, netId);
+        }
+    }
+
+    void InterestManager::SetViewerPosition(ConnectionId connection, const Vec3& position, float32 radius)
+    {
+        AddViewer(connection);
+        ViewerEntry& viewer = m_viewers.at(connection);
+
+        const float32 viewRadius = radius > 0.0f ? radius : m_config.viewRadius;
+        const bool changedCell = !viewer.hasPosition || IsOutsideCell(viewer.cell, position);
+        if (!changedCell && viewRadius == viewer.radius)
+            return;
+
+        if (changedCell)
+        {
+            viewer.cell = CellOf(position);
+        }
+        viewer.radius = viewRadius;
+        viewer.hasPosition = true;
+
+        // Visit only the cells entering and leaving the view; both lists are sorted
+        ComputeWatchedCells(viewer.cell, viewRadius, m_watchedScratch);
+        const std::vector<CellKey>& before = viewer.watched;
+        const std::vector<CellKey>& after = m_watchedScratch;
+
+        size_t i = 0;
+        size_t j = 0;
+        while (i < before.size() || j < after.size())
+        {
+            if (j == after.size() || (i < before.size() && before[i] < after[j]))
+            {
+                UnwatchCell(connection, viewer, before[i++]);
+            }
+            else if (i == before.size() || after[j] < before[i])
+            {
+                WatchCell(connection, viewer, after[j++]);
+            }
+            else
+            {
+                ++i;
+                ++j;
+            }
+        }
+
+        viewer.watched.swap(m_watchedScratch);
+    }
+
+    void InterestManager::RemoveViewer(ConnectionId connection)
+    {
+        auto it = m_viewers.find(connection);
+        if (it == m_viewers.end())
+            return;
+
+        for (CellKey key : it->second.watched)
+        {
+            auto cellIt = m_cells.find(key);
+            if (cellIt != m_cells.end())
+            {
+                SwapRemove(cellIt->second.viewers, connection);
+                EraseCellIfEmpty(key);
+            }
+        }
+
+        m_viewers.erase(it);
+    }
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    bool InterestManager::IsRelevant(ConnectionId connection, NetObjectId netId) const
+    {
+        auto it = m_viewers.find(connection);
+        return it != m_viewers.end() && it->second.relevant.contains(netId);
+    }
+
+    const std::unordered_set<NetObjectId>* InterestManager::GetRelevantObjects(ConnectionId connection) const
+    {
+        auto it = m_viewers.find(connection);
+        return it != m_viewers.end() ? &it->second.relevant : nullptr;
+    }
+
+    size_t InterestManager::GetRelevantPairCount() const
+    {
+        size_t count = 0;
+        for (const auto& [connection, viewer] : m_viewers)
+        {
+            count += viewer.relevant.size();
+        }
+        return count;
+    }
+
+} // namespace RVX::Net
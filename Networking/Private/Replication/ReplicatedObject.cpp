@@ -1,16 +1,61 @@
 #include "Networking/Replication/ReplicatedObject.h"
+#include "Networking/Replication/InterestManager.h"
 #include "Networking/NetworkManager.h"
 #include "Core/Log.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
 namespace RVX::Net
 {
+    namespace
+    {
+        enum class ReplicationCommand : uint8
+        {
+            Spawn = 0x01,
+            Despawn = 0x02,
+            State = 0x03,       ///< Snapshot of object states for one connection
+            Ack = 0x04          ///< Client acknowledgement of received snapshots
+        };
+
+        // Type, command, sequence and object count
+        constexpr uint32 kSnapshotHeaderBytes = 6;
+
+        // States are diffed against baselines in blocks of this many bytes
+        constexpr uint32 kDeltaBlockBytes = 8;
+
+        // A state in flight is sent again after this long without an ack
+        constexpr float32 kMinResendInterval = 0.1f;
+
+        // Acks cover the newest received snapshot and the 32 before it
+        constexpr int32 kMaxAckAge = 32;
+
+        float32 PriorityWeight(ReplicationPriority priority)
+        {
+            switch (priority)
+            {
+                case ReplicationPriority::Low: return 0.5f;
+                case ReplicationPriority::Normal: return 1.0f;
+                case ReplicationPriority::High: return 2.0f;
+                case ReplicationPriority::Critical: return 8.0f;
+            }
+            return 1.0f;
+        }
+
+        float32 UpdateInterval(const ReplicationConfig& config)
+        {
+            return config.updateRate > 0.0f ? 1.0f / config.updateRate : 0.0f;
+        }
+    } // namespace
+
     // =========================================================================
     // ReplicationManager Implementation
     // =========================================================================
 
     ReplicationManager::ReplicationManager()
     {
-        m_serializationBuffer.reserve(RVX_NET_MAX_PACKET_SIZE);
+        m_serializationBuffer.resize(RVX_NET_MAX_PACKET_SIZE);
     }
 
     ReplicationManager::~ReplicationManager()
@@ -21,6 +66,7 @@ namespace RVX::Net
     void ReplicationManager::Initialize(NetworkManager* networkManager)
     {
         m_networkManager = networkManager;
+        m_stats = {};
         RVX_CORE_INFO("ReplicationManager initialized");
     }
 
@@ -28,7 +74,11 @@ namespace RVX::Net
     {
         m_objects.clear();
         m_dirtyObjects.clear();
-        m_lastSyncTime.clear();
+        m_objectStates.clear();
+        m_connectionStates.clear();
+        m_interest.reset();
+        m_receivedStates.clear();
+        m_hasReceivedSnapshot = false;
         m_nextNetId = 1;
         m_networkManager = nullptr;
     }
@@ -57,10 +107,22 @@ namespace RVX::Net
         m_objects[netId] = obj;
         obj->OnNetworkSpawn();
 
-        // Broadcast spawn to all clients
+        // Spawn on all clients, or on those it is relevant to
         if (m_networkManager && m_networkManager->IsServer())
         {
-            BroadcastSpawn(obj);
+            if (m_interest)
+            {
+                Vec3 position;
+                if (obj->GetReplicationPosition(position))
+                    m_interest->SetObjectPosition(netId, position);
+                else
+                    m_interest->SetObjectGlobal(netId);
+                DispatchRelevancyChanges();
+            }
+            else
+            {
+                BroadcastSpawn(obj);
+            }
         }
 
         RVX_CORE_DEBUG("Spawned network object {} (type: {}, owner: {})", 
@@ -78,19 +140,27 @@ namespace RVX::Net
         auto obj = it->second;
         obj->OnNetworkDespawn();
 
-        // Broadcast despawn
+        // Despawn from all clients, or from those that have it
         if (m_networkManager && m_networkManager->IsServer())
         {
-            BroadcastDespawn(netId);
+            if (m_interest)
+            {
+                m_interest->RemoveObject(netId);
+                DispatchRelevancyChanges();
+            }
+            else
+            {
+                BroadcastDespawn(netId);
+            }
         }
 
         m_objects.erase(it);
-        m_lastSyncTime.erase(netId);
-
-        // Remove from dirty list
-        m_dirtyObjects.erase(
-            std::remove(m_dirtyObjects.begin(), m_dirtyObjects.end(), netId),
-            m_dirtyObjects.end());
+        m_dirtyObjects.erase(netId);
+        m_objectStates.erase(netId);
+        for (auto& [connectionId, connection] : m_connectionStates)
+        {
+            connection.objects.erase(netId);
+        }
 
         RVX_CORE_DEBUG("Despawned network object {}", netId);
     }
@@ -136,53 +206,388 @@ namespace RVX::Net
         if (!m_networkManager->IsServer())
             return;
 
-        // Process dirty objects
+        SerializeObjects(deltaTime);
+        SendSnapshots(deltaTime);
+    }
+
+    void ReplicationManager::ForceSync(NetObjectId netId)
+    {
+        if (GetObject(netId) && m_networkManager && m_networkManager->IsServer())
+        {
+            m_dirtyObjects.insert(netId);
+            m_objectStates[netId].forceSend = true;
+        }
+    }
+
+    void ReplicationManager::MarkDirty(NetObjectId netId)
+    {
+        m_dirtyObjects.insert(netId);
+    }
+
+    void ReplicationManager::SetViewerPosition(ConnectionId connection, const Vec3& position, float32 viewRadius)
+    {
+        ConnectionState& state = m_connectionStates[connection];
+        state.viewerPosition = position;
+        state.hasViewer = true;
+
+        if (m_interest)
+        {
+            m_interest->SetViewerPosition(connection, position, viewRadius);
+        }
+    }
+
+    void ReplicationManager::EnableInterestManagement(const InterestConfig& config)
+    {
+        if (!m_objects.empty())
+        {
+            RVX_CORE_WARN("Interest management enabled with {} objects already spawned", m_objects.size());
+        }
+        m_interest = std::make_unique<InterestManager>(config);
+    }
+
+    bool ReplicationManager::HandlePacket(ConnectionId source, std::span<const uint8> data)
+    {
+        if (data.size() < 2)
+            return false;
+
+        BitReader reader(data);
+        if (reader.ReadUInt8() != static_cast<uint8>(PacketType::Replication))
+            return false;
+
+        switch (static_cast<ReplicationCommand>(reader.ReadUInt8()))
+        {
+            case ReplicationCommand::Spawn: HandleSpawnPacket(source, reader); return true;
+            case ReplicationCommand::Despawn: HandleDespawnPacket(source, reader); return true;
+            case ReplicationCommand::State: HandleStatePacket(source, reader); return true;
+            case ReplicationCommand::Ack: HandleAckPacket(source, reader); return true;
+        }
+        return false;
+    }
+
+    void ReplicationManager::SerializeObjects(float32 deltaTime)
+    {
+        // Each object is serialized at most once per Update, whatever the
+        // number of connections; connections share the resulting bytes
         for (const auto& [netId, obj] : m_objects)
         {
-            auto config = obj->GetReplicationConfig();
-            
-            // Check update rate
-            float32 timeSinceLastSync = 0.0f;
-            auto it = m_lastSyncTime.find(netId);
-            if (it != m_lastSyncTime.end())
+            ObjectState& state = m_objectStates[netId];
+            state.config = obj->GetReplicationConfig();
+            state.hasPosition = obj->GetReplicationPosition(state.position);
+            state.timeSinceSerialize += deltaTime;
+
+            if (m_interest)
             {
-                timeSinceLastSync = it->second + deltaTime;
-                it->second = timeSinceLastSync;
+                if (state.hasPosition)
+                    m_interest->SetObjectPosition(netId, state.position);
+                else
+                    m_interest->SetObjectGlobal(netId);
+
+                // Nobody can see it; it is serialized once a viewer comes near
+                if (!m_interest->IsRelevantToAny(netId))
+                    continue;
             }
-            else
+
+            const bool due = !state.bytes || state.forceSend || m_dirtyObjects.contains(netId) ||
+                             state.timeSinceSerialize >= UpdateInterval(state.config);
+            if (!due)
+                continue;
+
+            m_stateWriter.Reset();
+            NetworkWriter netWriter(m_stateWriter);
+            obj->SerializeState(netWriter);
+            m_stats.serializations++;
+            state.timeSinceSerialize = 0.0f;
+
+            // Unchanged states keep their bytes, so connections holding them stay up to date
+            auto data = m_stateWriter.GetSpan();
+            if (!state.bytes || !std::equal(data.begin(), data.end(), state.bytes->begin(), state.bytes->end()))
+            {
+                state.bytes = std::make_shared<const std::vector<uint8>>(data.begin(), data.end());
+            }
+        }
+
+        m_dirtyObjects.clear();
+    }
+
+    void ReplicationManager::SendSnapshots(float32 deltaTime)
+    {
+        auto connections = m_networkManager->GetConnections();
+
+        // Forget connections that went away
+        for (auto it = m_connectionStates.begin(); it != m_connectionStates.end();)
+        {
+            const bool connected = std::any_of(connections.begin(), connections.end(),
+                [id = it->first](const ConnectionPtr& conn) { return conn->GetId() == id; });
+            if (!connected && m_interest)
             {
-                m_lastSyncTime[netId] = 0.0f;
+                m_interest->RemoveViewer(it->first);
             }
+            it = connected ? std::next(it) : m_connectionStates.erase(it);
+        }
 
-            float32 minInterval = config.updateRate > 0.0f ? 1.0f / config.updateRate : 0.0f;
-            
-            if (timeSinceLastSync >= minInterval)
+        if (m_interest)
+        {
+            // New connections see global objects until they place a viewer
+            for (const auto& conn : connections)
             {
-                BroadcastState(obj);
-                m_lastSyncTime[netId] = 0.0f;
+                if (conn->IsConnected() && !m_interest->HasViewer(conn->GetId()))
+                {
+                    m_connectionStates.try_emplace(conn->GetId());
+                    m_interest->AddViewer(conn->GetId());
+                }
             }
+            DispatchRelevancyChanges();
         }
 
-        // Clear dirty list
-        m_dirtyObjects.clear();
+        for (const auto& conn : connections)
+        {
+            if (conn->IsConnected())
+            {
+                SendConnectionSnapshots(conn->GetId(), m_connectionStates[conn->GetId()], deltaTime);
+            }
+        }
+
+        for (auto& [netId, state] : m_objectStates)
+        {
+            state.forceSend = false;
+        }
     }
 
-    void ReplicationManager::ForceSync(NetObjectId netId)
+    void ReplicationManager::SendConnectionSnapshots(ConnectionId connectionId, ConnectionState& connection,
+                                                     float32 deltaTime)
     {
-        auto obj = GetObject(netId);
-        if (obj && m_networkManager && m_networkManager->IsServer())
+        // Unused budget carries over, up to a quarter second plus one packet
+        const float32 bytesPerSecond = static_cast<float32>(m_budget.bytesPerSecond);
+        connection.byteCredit = std::min(connection.byteCredit + bytesPerSecond * deltaTime,
+                                         bytesPerSecond * 0.25f + static_cast<float32>(m_budget.maxPacketBytes));
+
+        m_candidates.clear();
+        if (m_interest)
+        {
+            // Only objects relevant to this connection, rather than every object
+            if (const auto* relevant = m_interest->GetRelevantObjects(connectionId))
+            {
+                for (NetObjectId netId : *relevant)
+                {
+                    auto it = m_objectStates.find(netId);
+                    if (it != m_objectStates.end())
+                    {
+                        AddSendCandidate(netId, it->second, connection, deltaTime);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (const auto& [netId, state] : m_objectStates)
+            {
+                AddSendCandidate(netId, state, connection, deltaTime);
+            }
+        }
+
+        std::sort(m_candidates.begin(), m_candidates.end(), [](const SendCandidate& a, const SendCandidate& b)
+        {
+            return a.priority != b.priority ? a.priority > b.priority : a.netId < b.netId;
+        });
+
+        SentSnapshot snapshot;
+        uint32 objectCount = 0;
+        m_packetRecords.clear();
+
+        for (size_t i = 0; i < m_candidates.size(); ++i)
         {
-            BroadcastState(obj);
-            m_lastSyncTime[netId] = 0.0f;
+            if (connection.byteCredit <= 0.0f)
+            {
+                m_stats.objectsDeferred += m_candidates.size() - i;
+                break;
+            }
+
+            const SendCandidate& candidate = m_candidates[i];
+            WriteObjectRecord(candidate.netId, *candidate.state->bytes, *candidate.connectionState);
+            auto record = m_recordWriter.GetSpan();
+
+            if (objectCount > 0 && kSnapshotHeaderBytes + m_packetRecords.size() + record.size() > m_budget.maxPacketBytes)
+            {
+                FlushSnapshot(connectionId, connection, snapshot, objectCount);
+                objectCount = 0;
+            }
+
+            m_packetRecords.insert(m_packetRecords.end(), record.begin(), record.end());
+            snapshot.objects.emplace_back(candidate.netId, candidate.state->bytes);
+            objectCount++;
+
+            connection.byteCredit -= static_cast<float32>(record.size());
+            candidate.connectionState->lastSent = candidate.state->bytes;
+            candidate.connectionState->timeSinceSent = 0.0f;
+            candidate.connectionState->priority = 0.0f;
+
+            m_stats.objectsSent++;
+            if (candidate.connectionState->baseline)
+                m_stats.deltaObjectsSent++;
+        }
+
+        if (objectCount > 0)
+        {
+            FlushSnapshot(connectionId, connection, snapshot, objectCount);
         }
     }
 
-    void ReplicationManager::MarkDirty(NetObjectId netId)
+    void ReplicationManager::AddSendCandidate(NetObjectId netId, const ObjectState& state, ConnectionState& connection,
+                                              float32 deltaTime)
     {
-        if (std::find(m_dirtyObjects.begin(), m_dirtyObjects.end(), netId) == m_dirtyObjects.end())
+        if (!state.bytes)
+            return;
+
+        auto [it, inserted] = connection.objects.try_emplace(netId);
+        ConnectionObjectState& objectState = it->second;
+        if (inserted)
         {
-            m_dirtyObjects.push_back(netId);
+            objectState.firstSequence = connection.nextSequence;
         }
+        objectState.timeSinceSent += deltaTime;
+
+        // The connection already acknowledged this state
+        if (state.bytes == objectState.baseline)
+        {
+            objectState.priority = 0.0f;
+            return;
+        }
+
+        // Still in flight; give the ack time to arrive before sending again
+        const float32 resendInterval = std::max(UpdateInterval(state.config), kMinResendInterval);
+        if (state.bytes == objectState.lastSent && objectState.timeSinceSent < resendInterval && !state.forceSend)
+            return;
+
+        float32 distanceWeight = 1.0f;
+        if (connection.hasViewer && state.hasPosition)
+        {
+            const float32 distance = glm::length(state.position - connection.viewerPosition);
+            if (state.config.relevancyDistance > 0.0f && distance > state.config.relevancyDistance)
+                return;
+            if (m_budget.distanceFalloff > 0.0f)
+                distanceWeight = 1.0f / (1.0f + distance / m_budget.distanceFalloff);
+        }
+
+        // Priority grows every Update an object waits, so low-priority
+        // and distant objects are delayed rather than starved
+        objectState.priority += PriorityWeight(state.config.priority) * distanceWeight * deltaTime;
+        m_candidates.push_back({netId, state.forceSend ? FLT_MAX : objectState.priority, &state, &objectState});
+    }
+
+    void ReplicationManager::DispatchRelevancyChanges()
+    {
+        for (const RelevancyChange& change : m_interest->GetChanges())
+        {
+            if (change.relevant)
+            {
+                if (auto obj = GetObject(change.netId))
+                {
+                    m_networkManager->Send(change.connection, WriteSpawnPacket(*obj), DeliveryMode::ReliableOrdered,
+                                           static_cast<ChannelId>(ChannelType::Spawn));
+                }
+                continue;
+            }
+
+            m_networkManager->Send(change.connection, WriteDespawnPacket(change.netId), DeliveryMode::ReliableOrdered,
+                                   static_cast<ChannelId>(ChannelType::Spawn));
+
+            // Should it come back, the client starts again from a full state
+            auto connectionIt = m_connectionStates.find(change.connection);
+            if (connectionIt != m_connectionStates.end())
+            {
+                connectionIt->second.objects.erase(change.netId);
+            }
+        }
+        m_interest->ClearChanges();
+    }
+
+    void ReplicationManager::WriteObjectRecord(NetObjectId netId, const std::vector<uint8>& state,
+                                               const ConnectionObjectState& connectionState)
+    {
+        // Records are byte aligned so they can be concatenated into packets
+        m_recordWriter.Reset();
+        m_recordWriter.WriteVarInt(netId);
+        m_recordWriter.WriteBool(connectionState.baseline != nullptr);
+
+        const uint32 size = static_cast<uint32>(state.size());
+        if (!connectionState.baseline)
+        {
+            m_recordWriter.WriteVarInt(size);
+            m_recordWriter.WriteBytes(state.data(), size);
+            return;
+        }
+
+        // One bit per block, followed by the block's bytes if it differs from the baseline
+        const std::vector<uint8>& baseline = *connectionState.baseline;
+        m_recordWriter.WriteUInt16(static_cast<SequenceNumber>(connectionState.baselineSequence));
+        m_recordWriter.WriteVarInt(size);
+        for (uint32 offset = 0; offset < size; offset += kDeltaBlockBytes)
+        {
+            const uint32 blockBytes = std::min(kDeltaBlockBytes, size - offset);
+            const bool changed = offset + blockBytes > baseline.size() ||
+                                 std::memcmp(state.data() + offset, baseline.data() + offset, blockBytes) != 0;
+            m_recordWriter.WriteBool(changed);
+            if (changed)
+            {
+                uint64 block = 0;
+                for (uint32 i = 0; i < blockBytes; ++i)
+                {
+                    block |= static_cast<uint64>(state[offset + i]) << (i * 8);
+                }
+                m_recordWriter.WriteBits64(block, blockBytes * 8);
+            }
+        }
+        m_recordWriter.AlignToByte();
+    }
+
+    void ReplicationManager::FlushSnapshot(ConnectionId connectionId, ConnectionState& connection,
+                                           SentSnapshot& snapshot, uint32 objectCount)
+    {
+        snapshot.sequence = connection.nextSequence++;
+
+        m_packetWriter.Reset();
+        m_packetWriter.WriteUInt8(static_cast<uint8>(PacketType::Replication));
+        m_packetWriter.WriteUInt8(static_cast<uint8>(ReplicationCommand::State));
+        m_packetWriter.WriteUInt16(static_cast<SequenceNumber>(snapshot.sequence));
+        m_packetWriter.WriteUInt16(static_cast<uint16>(objectCount));
+        m_packetWriter.WriteBytes(m_packetRecords.data(), static_cast<uint32>(m_packetRecords.size()));
+
+        auto data = m_packetWriter.GetSpan();
+        m_networkManager->Send(connectionId, data, DeliveryMode::UnreliableSequenced,
+                               static_cast<ChannelId>(ChannelType::Replication));
+
+        m_stats.snapshotsSent++;
+        m_stats.bytesSent += data.size();
+
+        connection.unacked.push_back(std::move(snapshot));
+        while (connection.unacked.size() > m_budget.maxUnackedSnapshots)
+        {
+            DropOldestSnapshot(connection);
+        }
+
+        snapshot = {};
+        m_packetRecords.clear();
+    }
+
+    void ReplicationManager::DropOldestSnapshot(ConnectionState& connection)
+    {
+        // Acks have stopped arriving for this snapshot. The client keeps only so many states
+        // per object and would drop the baselines still in use, so objects whose baseline
+        // predates it go back to full states until a newer snapshot is acknowledged.
+        const SentSnapshot& snapshot = connection.unacked.front();
+        for (const auto& [netId, state] : snapshot.objects)
+        {
+            auto objectIt = connection.objects.find(netId);
+            if (objectIt == connection.objects.end())
+                continue;
+
+            ConnectionObjectState& objectState = objectIt->second;
+            if (objectState.baseline && snapshot.sequence > objectState.baselineSequence)
+            {
+                objectState.baseline = nullptr;
+            }
+        }
+        connection.unacked.pop_front();
     }
 
     void ReplicationManager::TransferAuthority(NetObjectId netId, ConnectionId newAuthority)
@@ -219,72 +624,68 @@ namespace RVX::Net
         }
     }
 
-    void ReplicationManager::BroadcastSpawn(const ReplicatedObjectPtr& obj)
+    std::span<const uint8> ReplicationManager::WriteSpawnPacket(const IReplicatedObject& obj)
     {
-        if (!m_networkManager)
-            return;
-
-        m_serializationBuffer.clear();
-        BitWriter writer(m_serializationBuffer.data(), RVX_NET_MAX_PACKET_SIZE);
+        BitWriter writer(m_serializationBuffer.data(), static_cast<uint32>(m_serializationBuffer.size()));
 
         // Write spawn packet header
         writer.WriteUInt8(static_cast<uint8>(PacketType::Replication));
-        writer.WriteUInt8(0x01); // Spawn command
-        writer.WriteUInt32(obj->GetNetId());
-        writer.WriteUInt32(obj->GetOwnerId());
-        writer.WriteString(obj->GetTypeName());
+        writer.WriteUInt8(static_cast<uint8>(ReplicationCommand::Spawn));
+        writer.WriteUInt32(obj.GetNetId());
+        writer.WriteUInt32(obj.GetOwnerId());
+        writer.WriteString(obj.GetTypeName());
 
         // Write initial state
         NetworkWriter netWriter(writer);
-        obj->SerializeState(netWriter);
+        obj.SerializeState(netWriter);
 
         auto data = writer.GetSpan();
-        m_networkManager->Broadcast(data, DeliveryMode::ReliableOrdered, 
-                                    static_cast<ChannelId>(ChannelType::Spawn));
+        return {m_serializationBuffer.data(), data.size()};
     }
 
-    void ReplicationManager::BroadcastDespawn(NetObjectId netId)
+    std::span<const uint8> ReplicationManager::WriteDespawnPacket(NetObjectId netId)
     {
-        if (!m_networkManager)
-            return;
-
-        m_serializationBuffer.clear();
-        BitWriter writer(m_serializationBuffer.data(), RVX_NET_MAX_PACKET_SIZE);
+        BitWriter writer(m_serializationBuffer.data(), static_cast<uint32>(m_serializationBuffer.size()));
 
         writer.WriteUInt8(static_cast<uint8>(PacketType::Replication));
-        writer.WriteUInt8(0x02); // Despawn command
+        writer.WriteUInt8(static_cast<uint8>(ReplicationCommand::Despawn));
         writer.WriteUInt32(netId);
 
         auto data = writer.GetSpan();
-        m_networkManager->Broadcast(data, DeliveryMode::ReliableOrdered,
-                                    static_cast<ChannelId>(ChannelType::Spawn));
+        return {m_serializationBuffer.data(), data.size()};
     }
 
-    void ReplicationManager::BroadcastState(const ReplicatedObjectPtr& obj)
+    void ReplicationManager::BroadcastSpawn(const ReplicatedObjectPtr& obj)
     {
         if (!m_networkManager)
             return;
 
-        m_serializationBuffer.clear();
-        BitWriter writer(m_serializationBuffer.data(), RVX_NET_MAX_PACKET_SIZE);
+        m_networkManager->Broadcast(WriteSpawnPacket(*obj), DeliveryMode::ReliableOrdered,
+                                    static_cast<ChannelId>(ChannelType::Spawn));
+    }
 
-        writer.WriteUInt8(static_cast<uint8>(PacketType::Replication));
-        writer.WriteUInt8(0x03); // State update command
-        writer.WriteUInt32(obj->GetNetId());
+    void ReplicationManager::BroadcastDespawn(NetObjectId netId)
+    {
+        if (!m_networkManager)
+            return;
 
-        // Write state
-        NetworkWriter netWriter(writer);
-        obj->SerializeState(netWriter);
+        m_networkManager->Broadcast(WriteDespawnPacket(netId), DeliveryMode::ReliableOrdered,
+                                    static_cast<ChannelId>(ChannelType::Spawn));
+    }
 
-        auto data = writer.GetSpan();
-        
-        // Use appropriate delivery mode based on priority
-        auto config = obj->GetReplicationConfig();
-        DeliveryMode mode = (config.priority == ReplicationPriority::Critical) ?
-            DeliveryMode::ReliableOrdered : DeliveryMode::UnreliableSequenced;
+    void ReplicationManager::SendAck()
+    {
+        if (!m_networkManager)
+            return;
+
+        BitWriter writer(m_serializationBuffer.data(), static_cast<uint32>(m_serializationBuffer.size()));
+        writer.WriteUInt8(static_cast<uint8>(PacketType::Replication));
+        writer.WriteUInt8(static_cast<uint8>(ReplicationCommand::Ack));
+        writer.WriteUInt16(m_latestReceivedSequence);
+        writer.WriteUInt32(m_receivedSequenceBits);
 
-        m_networkManager->Broadcast(data, mode,
-                                    static_cast<ChannelId>(ChannelType::Replication));
+        m_networkManager->SendToServer(writer.GetSpan(), DeliveryMode::Unreliable,
+                                       static_cast<ChannelId>(ChannelType::Replication));
     }
 
     void ReplicationManager::HandleSpawnPacket(ConnectionId source, BitReader& reader)
@@ -344,6 +745,8 @@ namespace RVX::Net
         
         NetObjectId netId = reader.ReadUInt32();
         
+        m_receivedStates.erase(netId);
+
         auto it = m_objects.find(netId);
         if (it != m_objects.end())
         {
@@ -356,22 +759,183 @@ namespace RVX::Net
     void ReplicationManager::HandleStatePacket(ConnectionId source, BitReader& reader)
     {
         (void)source;
-        
-        NetObjectId netId = reader.ReadUInt32();
-        
-        auto obj = GetObject(netId);
-        if (!obj)
+
+        const SequenceNumber sequence = reader.ReadUInt16();
+        const uint32 objectCount = reader.ReadUInt16();
+        bool complete = true;
+
+        std::vector<uint8> state;
+        for (uint32 i = 0; i < objectCount && !reader.HasOverflowed(); ++i)
         {
-            // Object doesn't exist yet - might receive before spawn
+            const NetObjectId netId = reader.ReadVarInt();
+            const bool hasBaseline = reader.ReadBool();
+            std::deque<ReceivedState>& history = m_receivedStates[netId];
+            bool decoded = true;
+
+            if (!hasBaseline)
+            {
+                const uint32 size = reader.ReadVarInt();
+                auto bytes = reader.ReadBytesSpan(size);
+                state.assign(bytes.begin(), bytes.end());
+            }
+            else
+            {
+                const SequenceNumber baselineSequence = reader.ReadUInt16();
+                const uint32 size = reader.ReadVarInt();
+
+                // An idle object's history can span more than half the sequence space, where
+                // ordering no longer holds, so match from the newest end. The server never goes
+                // back to an older baseline, so older states can go.
+                auto match = std::find_if(history.rbegin(), history.rend(), [&](const ReceivedState& received)
+                {
+                    return received.sequence == baselineSequence;
+                });
+                const bool found = match != history.rend();
+                if (found)
+                {
+                    history.erase(history.begin(), std::prev(match.base()));
+                }
+                const std::vector<uint8>* baseline = found ? &history.front().bytes : nullptr;
+                decoded = baseline != nullptr;
+
+                state.assign(size, 0);
+                for (uint32 offset = 0; offset < size; offset += kDeltaBlockBytes)
+                {
+                    const uint32 blockBytes = std::min(kDeltaBlockBytes, size - offset);
+                    if (reader.ReadBool())
+                    {
+                        const uint64 block = reader.ReadBits64(blockBytes * 8);
+                        for (uint32 b = 0; b < blockBytes; ++b)
+                        {
+                            state[offset + b] = static_cast<uint8>(block >> (b * 8));
+                        }
+                    }
+                    else if (baseline && offset + blockBytes <= baseline->size())
+                    {
+                        std::memcpy(state.data() + offset, baseline->data() + offset, blockBytes);
+                    }
+                    else
+                    {
+                        decoded = false;
+                    }
+                }
+                reader.AlignToByte();
+            }
+
+            if (reader.HasOverflowed())
+            {
+                complete = false;
+                break;
+            }
+
+            if (!decoded)
+            {
+                // Leaving the snapshot unacknowledged keeps the server on older baselines
+                RVX_CORE_WARN("Missing replication baseline for object {}", netId);
+                complete = false;
+                continue;
+            }
+
+            auto obj = GetObject(netId);
+
+            // Only apply state if we don't have authority
+            if (obj && !obj->HasAuthority())
+            {
+                BitReader stateReader(state);
+                NetworkReader netReader(stateReader);
+                obj->DeserializeState(netReader);
+            }
+
+            history.push_back({sequence, state});
+            while (history.size() > m_budget.maxUnackedSnapshots + 1)
+            {
+                history.pop_front();
+            }
+        }
+
+        if (!complete)
             return;
+
+        // Acknowledge this snapshot along with the 32 before the newest
+        if (!m_hasReceivedSnapshot || SequenceNewerThan(sequence, m_latestReceivedSequence))
+        {
+            const int32 shift = m_hasReceivedSnapshot ? SequenceDiff(sequence, m_latestReceivedSequence) : 0;
+            m_receivedSequenceBits = shift == 0 || shift > 32 ? 0 :
+                ((shift == 32 ? 0 : m_receivedSequenceBits << shift) | (1u << (shift - 1)));
+            m_latestReceivedSequence = sequence;
+            m_hasReceivedSnapshot = true;
+        }
+        else
+        {
+            const int32 age = SequenceDiff(m_latestReceivedSequence, sequence);
+            if (age >= 1 && age <= 32)
+            {
+                m_receivedSequenceBits |= 1u << (age - 1);
+            }
         }
 
-        // Only apply state if we don't have authority
-        if (obj->HasAuthority())
+        SendAck();
+    }
+
+    void ReplicationManager::HandleAckPacket(ConnectionId source, BitReader& reader)
+    {
+        auto connectionIt = m_connectionStates.find(source);
+        if (connectionIt == m_connectionStates.end())
             return;
 
-        NetworkReader netReader(reader);
-        obj->DeserializeState(netReader);
+        const SequenceNumber latestBits = reader.ReadUInt16();
+        const uint32 bits = reader.ReadUInt32();
+        if (reader.HasOverflowed())
+            return;
+
+        // Acks carry the low 16 bits of a sequence already sent; recover the full one from
+        // the newest sent so comparisons with long-lived baselines never wrap
+        ConnectionState& connection = connectionIt->second;
+        if (connection.nextSequence == 0)
+            return;
+
+        const uint64 newestSent = connection.nextSequence - 1;
+        const int32 behind = SequenceDiff(static_cast<SequenceNumber>(newestSent), latestBits);
+        if (behind < 0 || static_cast<uint64>(behind) > newestSent)
+            return;
+
+        const uint64 latest = newestSent - static_cast<uint64>(behind);
+        for (auto it = connection.unacked.begin(); it != connection.unacked.end();)
+        {
+            const int64 age = static_cast<int64>(latest) - static_cast<int64>(it->sequence);
+            const bool acked = age == 0 || (age >= 1 && age <= kMaxAckAge && (bits & (1u << (age - 1))));
+
+            if (acked)
+            {
+                // The client now holds these states; later deltas are encoded against them
+                for (const auto& [netId, state] : it->objects)
+                {
+                    auto objectIt = connection.objects.find(netId);
+                    if (objectIt == connection.objects.end())
+                        continue;
+
+                    // Sent before the object last became relevant; the client dropped it on despawn
+                    ConnectionObjectState& objectState = objectIt->second;
+                    if (objectState.firstSequence > it->sequence)
+                        continue;
+
+                    if (!objectState.baseline || it->sequence > objectState.baselineSequence)
+                    {
+                        objectState.baseline = state;
+                        objectState.baselineSequence = it->sequence;
+                    }
+                }
+                m_stats.snapshotsAcked++;
+            }
+
+            it = acked ? connection.unacked.erase(it) : std::next(it);
+        }
+
+        // Snapshots more than 32 behind the newest ack can no longer be acknowledged
+        while (!connection.unacked.empty() && latest > connection.unacked.front().sequence + kMaxAckAge)
+        {
+            DropOldestSnapshot(connection);
+        }
     }
 
 } // namespace RVX::Net
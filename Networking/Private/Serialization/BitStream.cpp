@@ -6,6 +6,47 @@
 
 namespace RVX::Net
 {
+    namespace
+    {
+        constexpr uint64 LowBits(uint32 count)
+        {
+            return count >= 64 ? ~0ull : (1ull << count) - 1;
+        }
+
+        // Streams are little-endian regardless of the host
+        uint64 LoadLittleEndian(const uint8* src, uint32 byteCount)
+        {
+            uint64 value = 0;
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                std::memcpy(&value, src, byteCount);
+            }
+            else
+            {
+                for (uint32 i = 0; i < byteCount; ++i)
+                {
+                    value |= static_cast<uint64>(src[i]) << (i * 8);
+                }
+            }
+            return value;
+        }
+
+        void StoreLittleEndian(uint8* dest, uint64 value, uint32 byteCount)
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                std::memcpy(dest, &value, byteCount);
+            }
+            else
+            {
+                for (uint32 i = 0; i < byteCount; ++i)
+                {
+                    dest[i] = static_cast<uint8>(value >> (i * 8));
+                }
+            }
+        }
+    } // namespace
+
     // =========================================================================
     // BitReader Implementation
     // =========================================================================
@@ -23,6 +64,36 @@ namespace RVX::Net
     {
     }
 
+    void BitReader::Refill()
+    {
+        const uint32 sizeBytes = m_totalBits / 8;
+        if (m_nextByte + 8 <= sizeBytes)
+        {
+            // Load a word and keep the whole bytes that fit above the unread bits
+            const uint32 byteCount = (64 - m_scratchBits) / 8;
+            const uint64 word = LoadLittleEndian(m_data + m_nextByte, 8);
+            m_scratch |= (word & LowBits(byteCount * 8)) << m_scratchBits;
+            m_scratchBits += byteCount * 8;
+            m_nextByte += byteCount;
+            return;
+        }
+
+        // Tail of the buffer
+        while (m_scratchBits <= 56 && m_nextByte < sizeBytes)
+        {
+            m_scratch |= static_cast<uint64>(m_data[m_nextByte++]) << m_scratchBits;
+            m_scratchBits += 8;
+        }
+    }
+
+    void BitReader::SeekToByte(uint32 byteIndex)
+    {
+        m_bitPosition = byteIndex * 8;
+        m_nextByte = byteIndex;
+        m_scratch = 0;
+        m_scratchBits = 0;
+    }
+
     bool BitReader::ReadBit()
     {
         if (m_bitPosition >= m_totalBits)
@@ -31,11 +102,7 @@ namespace RVX::Net
             return false;
         }
 
-        uint32 byteIndex = m_bitPosition / 8;
-        uint32 bitIndex = m_bitPosition % 8;
-        m_bitPosition++;
-
-        return (m_data[byteIndex] >> bitIndex) & 1;
+        return ReadBits(1) != 0;
     }
 
     uint32 BitReader::ReadBits(uint32 numBits)
@@ -49,14 +116,15 @@ namespace RVX::Net
             return 0;
         }
 
-        uint32 result = 0;
-        for (uint32 i = 0; i < numBits; ++i)
+        if (m_scratchBits < numBits)
         {
-            if (ReadBit())
-            {
-                result |= (1u << i);
-            }
+            Refill();
         }
+
+        const uint32 result = static_cast<uint32>(m_scratch & LowBits(numBits));
+        m_scratch >>= numBits;
+        m_scratchBits -= numBits;
+        m_bitPosition += numBits;
         return result;
     }
 
@@ -80,7 +148,11 @@ namespace RVX::Net
         uint32 remainder = m_bitPosition % 8;
         if (remainder != 0)
         {
-            m_bitPosition += (8 - remainder);
+            // The rest of a partly read byte is always in the scratch word
+            const uint32 skip = 8 - remainder;
+            m_scratch >>= skip;
+            m_scratchBits -= skip;
+            m_bitPosition += skip;
         }
     }
 
@@ -102,7 +174,7 @@ namespace RVX::Net
         }
 
         std::memcpy(dest, m_data + byteIndex, count);
-        m_bitPosition += count * 8;
+        SeekToByte(byteIndex + count);
     }
 
     std::span<const uint8> BitReader::ReadBytesSpan(uint32 count)
@@ -116,7 +188,7 @@ namespace RVX::Net
             return {};
         }
 
-        m_bitPosition += count * 8;
+        SeekToByte(byteIndex + count);
         return { m_data + byteIndex, count };
     }
 
@@ -203,7 +275,7 @@ namespace RVX::Net
         }
 
         std::string result(reinterpret_cast<const char*>(m_data + byteIndex), length);
-        m_bitPosition += length * 8;
+        SeekToByte(byteIndex + length);
         return result;
     }
 
@@ -226,7 +298,7 @@ namespace RVX::Net
         }
 
         std::string result(reinterpret_cast<const char*>(m_data + byteIndex), actualLength);
-        m_bitPosition += maxLength * 8; // Always consume full fixed length
+        SeekToByte(byteIndex + maxLength); // Always consume full fixed length
         return result;
     }
 
@@ -291,7 +363,7 @@ namespace RVX::Net
 
     void BitReader::Reset()
     {
-        m_bitPosition = 0;
+        SeekToByte(0);
         m_overflow = false;
     }
 
@@ -342,18 +414,33 @@ namespace RVX::Net
         m_capacityBits = newCapacityBytes * 8;
     }
 
-    void BitWriter::WriteBit(bool value)
+    void BitWriter::StoreScratch(uint32 byteCount) const
     {
-        EnsureCapacity(1);
-        if (m_overflow) return;
-
-        if (value)
+        // The last word of a buffer may be partial; its missing bytes are past the end
+        const uint32 capacityBytes = m_capacityBits / 8;
+        if (m_scratchByte < capacityBytes)
         {
-            uint32 byteIndex = m_bitPosition / 8;
-            uint32 bitIndex = m_bitPosition % 8;
-            m_buffer[byteIndex] |= (1u << bitIndex);
+            StoreLittleEndian(m_buffer + m_scratchByte, m_scratch,
+                              std::min(byteCount, capacityBytes - m_scratchByte));
         }
-        m_bitPosition++;
+    }
+
+    void BitWriter::FlushScratch() const
+    {
+        // The word stays open, so flushing again later rewrites the same bytes
+        StoreScratch((m_scratchBits + 7) / 8);
+    }
+
+    void BitWriter::RestartScratch()
+    {
+        m_scratch = 0;
+        m_scratchBits = 0;
+        m_scratchByte = m_bitPosition / 8;
+    }
+
+    void BitWriter::WriteBit(bool value)
+    {
+        WriteBits(value ? 1u : 0u, 1);
     }
 
     void BitWriter::WriteBits(uint32 value, uint32 numBits)
@@ -364,9 +451,18 @@ namespace RVX::Net
         EnsureCapacity(numBits);
         if (m_overflow) return;
 
-        for (uint32 i = 0; i < numBits; ++i)
+        const uint64 bits = value & LowBits(numBits);
+        m_scratch |= bits << m_scratchBits;
+        m_scratchBits += numBits;
+        m_bitPosition += numBits;
+
+        if (m_scratchBits >= 64)
         {
-            WriteBit((value >> i) & 1);
+            // Store the full word and carry the bits that did not fit
+            StoreScratch(8);
+            m_scratchByte += 8;
+            m_scratchBits -= 64;
+            m_scratch = m_scratchBits > 0 ? bits >> (numBits - m_scratchBits) : 0;
         }
     }
 
@@ -390,7 +486,7 @@ namespace RVX::Net
         uint32 remainder = m_bitPosition % 8;
         if (remainder != 0)
         {
-            m_bitPosition += (8 - remainder);
+            WriteBits(0, 8 - remainder);
         }
     }
 
@@ -406,9 +502,11 @@ namespace RVX::Net
         EnsureCapacity(count * 8);
         if (m_overflow) return;
 
+        FlushScratch();
         uint32 byteIndex = m_bitPosition / 8;
         std::memcpy(m_buffer + byteIndex, src, count);
         m_bitPosition += count * 8;
+        RestartScratch();
     }
 
     void BitWriter::WriteBytes(std::span<const uint8> data)
@@ -492,6 +590,7 @@ namespace RVX::Net
         EnsureCapacity(maxLength * 8);
         if (m_overflow) return;
 
+        FlushScratch();
         uint32 byteIndex = m_bitPosition / 8;
         uint32 copyLen = std::min(static_cast<uint32>(str.size()), maxLength);
         
@@ -499,6 +598,7 @@ namespace RVX::Net
         std::memset(m_buffer + byteIndex + copyLen, 0, maxLength - copyLen);
         
         m_bitPosition += maxLength * 8;
+        RestartScratch();
     }
 
     void BitWriter::WriteVarInt(uint32 value)
@@ -545,27 +645,29 @@ namespace RVX::Net
 
     const uint8* BitWriter::GetData() const
     {
+        FlushScratch();
         return m_buffer;
     }
 
     std::span<const uint8> BitWriter::GetSpan() const
     {
+        FlushScratch();
         return { m_buffer, GetBytesWritten() };
     }
 
     std::vector<uint8> BitWriter::ToVector() const
     {
+        FlushScratch();
         return { m_buffer, m_buffer + GetBytesWritten() };
     }
 
     void BitWriter::Reset()
     {
+        // Every byte up to the write position is overwritten, so the old
+        // contents need no clearing
         m_bitPosition = 0;
-        if (m_buffer)
-        {
-            std::memset(m_buffer, 0, (m_capacityBits + 7) / 8);
-        }
         m_overflow = false;
+        RestartScratch();
     }
 
     void BitWriter::Clear()
@@ -579,10 +681,7 @@ namespace RVX::Net
         }
         m_bitPosition = 0;
         m_overflow = false;
-        if (m_buffer)
-        {
-            std::memset(m_buffer, 0, (m_capacityBits + 7) / 8);
-        }
+        RestartScratch();
     }
 
 } // namespace RVX::Net
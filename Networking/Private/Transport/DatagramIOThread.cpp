@@ -0,0 +1,277 @@
+#include "DatagramIOThread.h"
+#include "Core/Log.h"
+
+#if defined(__linux__)
+    #include <algorithm>
+    #include <array>
+    #include <cerrno>
+    #include <cstring>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace RVX::Net
+{
+#if defined(__linux__)
+    namespace
+    {
+        // How long to wait for the game thread to drain a full receive ring
+        constexpr int kReceiveStallWaitMs = 1;
+
+        bool IsWouldBlock(int error)
+        {
+            return error == EAGAIN || error == EWOULDBLOCK || error == EINTR;
+        }
+    } // namespace
+#endif
+
+    DatagramIOThread::DatagramIOThread(uint32 queueCapacity)
+        : m_sendRing(queueCapacity)
+        , m_receiveRing(queueCapacity)
+    {
+    }
+
+    DatagramIOThread::~DatagramIOThread()
+    {
+        Stop();
+    }
+
+    UDPIOStats DatagramIOThread::GetStats() const
+    {
+        UDPIOStats stats;
+        stats.sendCalls = m_sendCalls.load(std::memory_order_relaxed);
+        stats.packetsSent = m_packetsSent.load(std::memory_order_relaxed);
+        stats.sendErrors = m_sendErrors.load(std::memory_order_relaxed);
+        stats.receiveCalls = m_receiveCalls.load(std::memory_order_relaxed);
+        stats.packetsReceived = m_packetsReceived.load(std::memory_order_relaxed);
+        stats.receiveStalls = m_receiveStalls.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+#if defined(__linux__)
+
+    bool DatagramIOThread::Start(intptr_t socket)
+    {
+        if (m_running)
+            return false;
+
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wakeFd < 0)
+        {
+            RVX_CORE_ERROR("Failed to create network I/O wake event: {}", std::strerror(errno));
+            return false;
+        }
+
+        m_socket = socket;
+        m_sendBlocked = false;
+        m_receivePending = true;
+        m_running = true;
+        m_thread = std::thread(&DatagramIOThread::Run, this);
+        return true;
+    }
+
+    void DatagramIOThread::Stop()
+    {
+        if (!m_running.exchange(false))
+            return;
+
+        const uint64 one = 1;
+        (void)write(m_wakeFd, &one, sizeof(one));
+        m_thread.join();
+
+        close(m_wakeFd);
+        m_wakeFd = -1;
+        m_socket = -1;
+
+        // Whatever is left belongs to no one now
+        m_sendRing.Release(m_sendRing.GetReadableCount());
+        m_receiveRing.Release(m_receiveRing.GetReadableCount());
+    }
+
+    void DatagramIOThread::NotifySend()
+    {
+        // Pairs with the fence in Wait(): either the thread sees the new
+        // packets before sleeping, or this sees it asleep and wakes it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleeping.exchange(false, std::memory_order_relaxed))
+        {
+            const uint64 one = 1;
+            (void)write(m_wakeFd, &one, sizeof(one));
+        }
+    }
+
+    void DatagramIOThread::Run()
+    {
+        while (m_running.load(std::memory_order_relaxed))
+        {
+            const uint32 sent = FlushSends();
+            const uint32 received = ReceiveBatch();
+
+            // A full batch means there may be more waiting
+            if (sent < kBatchSize && received < kBatchSize)
+            {
+                Wait();
+            }
+        }
+    }
+
+    uint32 DatagramIOThread::FlushSends()
+    {
+        const uint32 count = std::min(m_sendRing.GetReadableCount(), kBatchSize);
+        if (count == 0 || m_sendBlocked)
+            return 0;
+
+        std::array<mmsghdr, kBatchSize> messages{};
+        std::array<iovec, kBatchSize> buffers{};
+        for (uint32 i = 0; i < count; ++i)
+        {
+            const DatagramSlot& slot = m_sendRing.GetReadSlot(i);
+            buffers[i].iov_base = const_cast<uint8*>(slot.data);
+            buffers[i].iov_len = slot.size;
+            messages[i].msg_hdr.msg_name = const_cast<uint8*>(slot.address);
+            messages[i].msg_hdr.msg_namelen = slot.addressSize;
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        m_sendCalls.fetch_add(1, std::memory_order_relaxed);
+        const int result = sendmmsg(static_cast<int>(m_socket), messages.data(), count, 0);
+        if (result < 0)
+        {
+            if (IsWouldBlock(errno))
+            {
+                // Wait for POLLOUT rather than spinning on a full socket buffer
+                m_sendBlocked = errno != EINTR;
+                return 0;
+            }
+
+            // sendmmsg() stops at the first failing datagram; drop it so the rest can go
+            RVX_CORE_ERROR("Send failed: {}", std::strerror(errno));
+            m_sendErrors.fetch_add(1, std::memory_order_relaxed);
+            m_sendRing.Release(1);
+            return 1;
+        }
+
+        m_packetsSent.fetch_add(static_cast<uint64>(result), std::memory_order_relaxed);
+        m_sendRing.Release(static_cast<uint32>(result));
+        return static_cast<uint32>(result);
+    }
+
+    uint32 DatagramIOThread::ReceiveBatch()
+    {
+        const uint32 count = std::min(m_receiveRing.GetWritableCount(), kBatchSize);
+        if (count == 0 || !m_receivePending)
+            return 0;
+
+        std::array<mmsghdr, kBatchSize> messages{};
+        std::array<iovec, kBatchSize> buffers{};
+        for (uint32 i = 0; i < count; ++i)
+        {
+            DatagramSlot& slot = m_receiveRing.GetWriteSlot(i);
+            buffers[i].iov_base = slot.data;
+            buffers[i].iov_len = sizeof(slot.data);
+            messages[i].msg_hdr.msg_name = slot.address;
+            messages[i].msg_hdr.msg_namelen = DatagramSlot::kMaxAddressBytes;
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        m_receiveCalls.fetch_add(1, std::memory_order_relaxed);
+        const int result = recvmmsg(static_cast<int>(m_socket), messages.data(), count, MSG_DONTWAIT, nullptr);
+        if (result < 0)
+        {
+            if (!IsWouldBlock(errno))
+            {
+                RVX_CORE_WARN("Receive error: {}", std::strerror(errno));
+            }
+            m_receivePending = errno == EINTR;
+            return 0;
+        }
+
+        // A short batch emptied the socket; skip reading until poll() says otherwise
+        m_receivePending = static_cast<uint32>(result) == count;
+
+        const NetworkTime now = std::chrono::steady_clock::now();
+        for (int i = 0; i < result; ++i)
+        {
+            DatagramSlot& slot = m_receiveRing.GetWriteSlot(static_cast<uint32>(i));
+            slot.size = messages[i].msg_len;
+            slot.addressSize = messages[i].msg_hdr.msg_namelen;
+            slot.time = now;
+        }
+
+        m_packetsReceived.fetch_add(static_cast<uint64>(result), std::memory_order_relaxed);
+        m_receiveRing.Publish(static_cast<uint32>(result));
+        return static_cast<uint32>(result);
+    }
+
+    void DatagramIOThread::Wait()
+    {
+        m_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Sends published before the fence are visible now; don't sleep on them
+        const bool sendsPending = m_sendRing.GetReadableCount() > 0;
+        if ((sendsPending && !m_sendBlocked) || !m_running.load(std::memory_order_relaxed))
+        {
+            m_sleeping.store(false, std::memory_order_relaxed);
+            return;
+        }
+
+        // With the receive ring full there is nowhere to read into, so only
+        // watch the socket for reads once the game thread has drained some
+        const bool receiveStalled = m_receiveRing.GetWritableCount() == 0;
+        if (receiveStalled)
+        {
+            m_receiveStalls.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        pollfd fds[2] = {};
+        fds[0].fd = static_cast<int>(m_socket);
+        fds[0].events = static_cast<short>((receiveStalled ? 0 : POLLIN) | (m_sendBlocked ? POLLOUT : 0));
+        fds[1].fd = m_wakeFd;
+        fds[1].events = POLLIN;
+
+        const int ready = poll(fds, 2, receiveStalled ? kReceiveStallWaitMs : -1);
+        m_sleeping.store(false, std::memory_order_relaxed);
+
+        if (ready > 0)
+        {
+            if (fds[0].revents & (POLLIN | POLLERR))
+            {
+                m_receivePending = true;
+            }
+            if (fds[0].revents & (POLLOUT | POLLERR))
+            {
+                m_sendBlocked = false;
+            }
+            if (fds[1].revents & POLLIN)
+            {
+                uint64 value = 0;
+                (void)read(m_wakeFd, &value, sizeof(value));
+            }
+        }
+    }
+
+#else
+
+    bool DatagramIOThread::Start(intptr_t socket)
+    {
+        (void)socket;
+        RVX_CORE_WARN("Dedicated network I/O thread is only available on Linux");
+        return false;
+    }
+
+    void DatagramIOThread::Stop()
+    {
+    }
+
+    void DatagramIOThread::NotifySend()
+    {
+    }
+
+#endif // __linux__
+
+} // namespace RVX::Net
@@ -0,0 +1,90 @@
+#pragma once
+
+/**
+ * @file DatagramIOThread.h
+ * @brief Batched socket I/O on a dedicated thread (Linux)
+ */
+
+#include "Networking/Transport/DatagramRing.h"
+#include "Networking/Transport/UDPTransport.h"
+
+#include <thread>
+
+namespace RVX::Net
+{
+    /**
+     * @brief Moves datagrams between a UDP socket and a pair of rings
+     *
+     * The thread drains the send ring with sendmmsg() and fills the receive
+     * ring with recvmmsg(), up to kBatchSize datagrams per call, straight
+     * from and into the ring slots. When there is nothing to do it sleeps in
+     * poll() on the socket and an eventfd that NotifySend() signals, so an
+     * idle transport costs no CPU and a busy one makes one syscall per batch
+     * rather than one per packet.
+     *
+     * The game thread is the producer of the send ring and the consumer of
+     * the receive ring; this thread is the other side of both.
+     *
+     * Only implemented on Linux; elsewhere Start() fails and the transport
+     * keeps its polled path.
+     */
+    class DatagramIOThread
+    {
+    public:
+        static constexpr uint32 kBatchSize = 64;
+
+        explicit DatagramIOThread(uint32 queueCapacity);
+        ~DatagramIOThread();
+
+        DatagramIOThread(const DatagramIOThread&) = delete;
+        DatagramIOThread& operator=(const DatagramIOThread&) = delete;
+
+        /**
+         * @brief Start serving a bound, non-blocking socket
+         */
+        bool Start(intptr_t socket);
+
+        /**
+         * @brief Stop and join the thread; queued sends are dropped
+         */
+        void Stop();
+
+        DatagramRing& GetSendRing() { return m_sendRing; }
+        DatagramRing& GetReceiveRing() { return m_receiveRing; }
+
+        /**
+         * @brief Wake the thread after publishing to the send ring
+         *
+         * Costs a syscall only when the thread is asleep, so a burst of sends
+         * wakes it once.
+         */
+        void NotifySend();
+
+        UDPIOStats GetStats() const;
+
+    private:
+        void Run();
+        uint32 FlushSends();
+        uint32 ReceiveBatch();
+        void Wait();
+
+        DatagramRing m_sendRing;
+        DatagramRing m_receiveRing;
+
+        intptr_t m_socket = -1;
+        int m_wakeFd = -1;
+        std::thread m_thread;
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_sleeping{false};
+        bool m_sendBlocked = false;       ///< The socket buffer was full on the last send
+        bool m_receivePending = true;     ///< The socket may have datagrams to read
+
+        std::atomic<uint64> m_sendCalls{0};
+        std::atomic<uint64> m_packetsSent{0};
+        std::atomic<uint64> m_sendErrors{0};
+        std::atomic<uint64> m_receiveCalls{0};
+        std::atomic<uint64> m_packetsReceived{0};
+        std::atomic<uint64> m_receiveStalls{0};
+    };
+
+} // namespace RVX::Net
@@ -0,0 +1,233 @@
+#include "Networking/Transport/LoopbackTransport.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+
+namespace RVX::Net
+{
+    namespace
+    {
+        constexpr const char* kLoopbackHost = "127.0.0.1";
+    } // namespace
+
+    // =========================================================================
+    // LoopbackNetwork
+    // =========================================================================
+
+    LoopbackPortStats LoopbackNetwork::GetPortStats(uint16 port) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_ports.find(port);
+        return it != m_ports.end() ? it->second.stats : LoopbackPortStats{};
+    }
+
+    void LoopbackNetwork::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& [number, port] : m_ports)
+        {
+            port.stats = {};
+        }
+    }
+
+    bool LoopbackNetwork::Bind(uint16& port)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (port == 0)
+        {
+            // Search the ephemeral range for a port nothing is bound to
+            for (uint32 attempt = 0; attempt < 16384; ++attempt)
+            {
+                const uint16 candidate = m_nextEphemeralPort;
+                m_nextEphemeralPort = m_nextEphemeralPort == 65535 ? 49152 : m_nextEphemeralPort + 1;
+                if (!m_ports[candidate].bound)
+                {
+                    port = candidate;
+                    break;
+                }
+            }
+            if (port == 0)
+                return false;
+        }
+
+        Port& entry = m_ports[port];
+        if (entry.bound)
+            return false;
+
+        entry.bound = true;
+        return true;
+    }
+
+    void LoopbackNetwork::Unbind(uint16 port)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_ports.find(port);
+        if (it != m_ports.end())
+        {
+            it->second.bound = false;
+            it->second.queue.clear();
+            it->second.unnotified = 0;
+        }
+    }
+
+    TransportResult LoopbackNetwork::Deliver(uint16 sourcePort, uint16 destPort, std::span<const uint8> data)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Port& source = m_ports[sourcePort];
+        source.stats.packetsSent++;
+        source.stats.bytesSent += data.size();
+
+        auto it = m_ports.find(destPort);
+        if (it == m_ports.end() || !it->second.bound)
+        {
+            // Like UDP, sending to a closed port is not an error for the sender
+            source.stats.packetsDropped++;
+            return TransportResult::Success;
+        }
+
+        Port& dest = it->second;
+        ReceivedPacket& packet = dest.queue.emplace_back();
+        packet.source = NetworkAddress(kLoopbackHost, sourcePort);
+        packet.data.assign(data.begin(), data.end());
+        packet.receiveTime = std::chrono::steady_clock::now();
+
+        dest.stats.packetsReceived++;
+        dest.stats.bytesReceived += data.size();
+        dest.unnotified++;
+        return TransportResult::Success;
+    }
+
+    TransportResult LoopbackNetwork::Receive(uint16 port, ReceivedPacket& outPacket)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_ports.find(port);
+        if (it == m_ports.end() || it->second.queue.empty())
+            return TransportResult::WouldBlock;
+
+        Port& entry = it->second;
+        outPacket = std::move(entry.queue.front());
+        entry.queue.pop_front();
+        entry.unnotified = std::min<uint32>(entry.unnotified, static_cast<uint32>(entry.queue.size()));
+        return TransportResult::Success;
+    }
+
+    uint32 LoopbackNetwork::TakeUnnotified(uint16 port, std::vector<ReceivedPacket>& outPackets)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_ports.find(port);
+        if (it == m_ports.end())
+            return 0;
+
+        // The unnotified packets are the newest ones at the back of the queue
+        Port& entry = it->second;
+        const uint32 count = entry.unnotified;
+        outPackets.assign(entry.queue.end() - count, entry.queue.end());
+        entry.unnotified = 0;
+        return count;
+    }
+
+    // =========================================================================
+    // LoopbackTransport
+    // =========================================================================
+
+    LoopbackTransport::LoopbackTransport(std::shared_ptr<LoopbackNetwork> network)
+        : m_network(std::move(network))
+    {
+    }
+
+    LoopbackTransport::~LoopbackTransport()
+    {
+        Shutdown();
+    }
+
+    TransportResult LoopbackTransport::Initialize(const TransportConfig& config)
+    {
+        if (m_active)
+        {
+            RVX_CORE_WARN("LoopbackTransport already initialized");
+            return TransportResult::Error;
+        }
+
+        if (!m_network)
+            return TransportResult::Error;
+
+        uint16 port = config.bindPort;
+        if (!m_network->Bind(port))
+        {
+            RVX_CORE_ERROR("LoopbackTransport could not bind port {}", config.bindPort);
+            return TransportResult::BindFailed;
+        }
+
+        m_port = port;
+        m_active = true;
+        return TransportResult::Success;
+    }
+
+    void LoopbackTransport::Shutdown()
+    {
+        if (!m_active)
+            return;
+
+        m_active = false;
+        m_network->Unbind(m_port);
+        m_port = 0;
+    }
+
+    TransportResult LoopbackTransport::SendTo(const NetworkAddress& address, std::span<const uint8> data)
+    {
+        if (!m_active)
+            return TransportResult::Error;
+
+        if (data.size() > RVX_NET_MTU)
+        {
+            RVX_CORE_WARN("Packet size {} exceeds MTU {}", data.size(), RVX_NET_MTU);
+        }
+
+        return m_network->Deliver(m_port, address.port, data);
+    }
+
+    TransportResult LoopbackTransport::ReceiveFrom(ReceivedPacket& outPacket)
+    {
+        if (!m_active)
+            return TransportResult::Error;
+
+        return m_network->Receive(m_port, outPacket);
+    }
+
+    uint32 LoopbackTransport::Poll(uint32 timeoutMs)
+    {
+        (void)timeoutMs; // Delivery is immediate, there is nothing to wait for
+
+        if (!m_active || !m_packetCallback)
+            return 0;
+
+        const uint32 count = m_network->TakeUnnotified(m_port, m_callbackPackets);
+        for (const ReceivedPacket& packet : m_callbackPackets)
+        {
+            m_packetCallback(packet);
+        }
+        return count;
+    }
+
+    void LoopbackTransport::SetPacketCallback(PacketReceivedCallback callback)
+    {
+        m_packetCallback = std::move(callback);
+    }
+
+    NetworkAddress LoopbackTransport::GetLocalAddress() const
+    {
+        return m_active ? NetworkAddress(kLoopbackHost, m_port) : NetworkAddress{};
+    }
+
+    // =========================================================================
+    // Factory Function
+    // =========================================================================
+
+    TransportPtr CreateLoopbackTransport(std::shared_ptr<LoopbackNetwork> network)
+    {
+        return std::make_shared<LoopbackTransport>(std::move(network));
+    }
+
+} // namespace RVX::Net
@@ -1,5 +1,4 @@
 #include "Networking/Transport/ReliableUDP.h"
-#include "Networking/Transport/UDPTransport.h"
 #include "Core/Log.h"
 
 #include <algorithm>
@@ -40,7 +39,7 @@ namespace RVX::Net
     ReliableUDP::ReliableUDP() = default;
     ReliableUDP::~ReliableUDP() = default;
 
-    bool ReliableUDP::Initialize(std::shared_ptr<UDPTransport> transport,
+    bool ReliableUDP::Initialize(TransportPtr transport,
                                   const ReliableConfig& config)
     {
         if (!transport || !transport->IsActive())
@@ -288,7 +287,7 @@ namespace RVX::Net
                 }
                 
                 // Send ACK
-                SendAck(rawPacket.source, header.channel);
+                SendAck(state, rawPacket.source, header.channel);
                 break;
             }
             case PacketType::ReliableAck:
@@ -376,7 +375,7 @@ namespace RVX::Net
         // Send ACK for reliable packets
         if (header.type == PacketType::ReliableData)
         {
-            SendAck(source, header.channel);
+            SendAck(state, source, header.channel);
         }
 
         // Deliver the packet
@@ -440,10 +439,9 @@ namespace RVX::Net
         }
     }
 
-    void ReliableUDP::SendAck(const NetworkAddress& address, ChannelId channel)
+    void ReliableUDP::SendAck(AddressState& state, const NetworkAddress& address, ChannelId channel)
     {
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-        AddressState& state = GetOrCreateState(address);
+        // Called while processing a received packet, with m_stateMutex already held
         ChannelState& channelState = state.channels[channel];
 
         BitWriter writer(ReliableHeader::kHeaderSize);
@@ -1,4 +1,5 @@
 #include "Networking/Transport/UDPTransport.h"
+#include "DatagramIOThread.h"
 #include "Core/Log.h"
 
 #ifdef _WIN32
@@ -7,8 +8,40 @@
 
 #include <asio.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace RVX::Net
 {
+    namespace
+    {
+        /// Numeric addresses skip the resolver, which would cost a lookup per send
+        bool ResolveEndpoint(asio::io_context& ioContext, const NetworkAddress& address,
+                             asio::ip::udp::endpoint& outEndpoint)
+        {
+            std::error_code ec;
+            asio::ip::address ip = asio::ip::make_address(address.host, ec);
+            if (!ec)
+            {
+                outEndpoint = asio::ip::udp::endpoint(ip, address.port);
+                return true;
+            }
+
+            asio::ip::udp::resolver resolver(ioContext);
+            auto endpoints = resolver.resolve(
+                address.isIPv6 ? asio::ip::udp::v6() : asio::ip::udp::v4(),
+                address.host,
+                std::to_string(address.port),
+                ec);
+
+            if (ec || endpoints.empty())
+                return false;
+
+            outEndpoint = *endpoints.begin();
+            return true;
+        }
+    } // namespace
+
     // =========================================================================
     // Implementation Details
     // =========================================================================
@@ -113,12 +146,28 @@ namespace RVX::Net
 
             m_active = true;
 
-            RVX_CORE_INFO("UDPTransport initialized on {}:{}",
+            if (config.dedicatedIOThread)
+            {
+                // The thread owns the socket from here; asio only closes it
+                m_impl->socket->non_blocking(true);
+                m_ioThread = std::make_unique<DatagramIOThread>(config.ioQueueCapacity);
+                m_ioNotified = 0;
+                if (!m_ioThread->Start(static_cast<intptr_t>(m_impl->socket->native_handle())))
+                {
+                    m_ioThread.reset();
+                }
+            }
+
+            RVX_CORE_INFO("UDPTransport initialized on {}:{}{}",
                           m_impl->localEndpoint.address().to_string(),
-                          m_impl->localEndpoint.port());
+                          m_impl->localEndpoint.port(),
+                          m_ioThread ? " with a dedicated I/O thread" : "");
 
             // Start async receive
-            StartReceive();
+            if (!m_ioThread)
+            {
+                StartReceive();
+            }
 
             return TransportResult::Success;
         }
@@ -140,6 +189,13 @@ namespace RVX::Net
 
         m_active = false;
 
+        // Stop using the socket before it is closed
+        if (m_ioThread)
+        {
+            m_ioThread->Stop();
+            m_ioThread.reset();
+        }
+
         if (m_impl->socket)
         {
             std::error_code ec;
@@ -172,22 +228,20 @@ namespace RVX::Net
             RVX_CORE_WARN("Packet size {} exceeds MTU {}", data.size(), m_mtu);
         }
 
-        try
+        if (m_ioThread)
         {
-            asio::ip::udp::resolver resolver(m_impl->ioContext);
-            auto endpoints = resolver.resolve(
-                address.isIPv6 ? asio::ip::udp::v6() : asio::ip::udp::v4(),
-                address.host,
-                std::to_string(address.port));
+            return QueueSend(address, data);
+        }
 
-            if (endpoints.empty())
+        try
+        {
+            asio::ip::udp::endpoint destEndpoint;
+            if (!ResolveEndpoint(m_impl->ioContext, address, destEndpoint))
             {
                 RVX_CORE_ERROR("Could not resolve address: {}", address.ToString());
                 return TransportResult::InvalidAddress;
             }
 
-            asio::ip::udp::endpoint destEndpoint = *endpoints.begin();
-
             std::error_code ec;
             m_impl->socket->send_to(
                 asio::buffer(data.data(), data.size()),
@@ -215,6 +269,18 @@ namespace RVX::Net
 
     TransportResult UDPTransport::ReceiveFrom(ReceivedPacket& outPacket)
     {
+        if (m_ioThread)
+        {
+            DatagramRing& ring = m_ioThread->GetReceiveRing();
+            if (ring.GetReadableCount() == 0)
+                return TransportResult::WouldBlock;
+
+            ReadSlot(0, outPacket);
+            ring.Release(1);
+            m_ioNotified = m_ioNotified > 0 ? m_ioNotified - 1 : 0;
+            return TransportResult::Success;
+        }
+
         std::lock_guard<std::mutex> lock(m_receiveMutex);
         
         if (m_receiveQueue.empty())
@@ -231,6 +297,24 @@ namespace RVX::Net
         if (!m_active)
             return 0;
 
+        if (m_ioThread)
+        {
+            // The I/O thread has already received; pass on what is new since the last Poll()
+            const DatagramRing& ring = m_ioThread->GetReceiveRing();
+            const uint32 readable = ring.GetReadableCount();
+            if (m_packetCallback)
+            {
+                for (uint32 i = m_ioNotified; i < readable; ++i)
+                {
+                    ReadSlot(i, m_callbackPacket);
+                    m_packetCallback(m_callbackPacket);
+                }
+            }
+            const uint32 arrived = readable - m_ioNotified;
+            m_ioNotified = readable;
+            return arrived;
+        }
+
         try
         {
             // Run pending handlers
@@ -302,15 +386,80 @@ namespace RVX::Net
 
     uint32 UDPTransport::GetPendingSendCount() const
     {
-        return 0; // UDP is connectionless, no send queue
+        if (m_ioThread)
+        {
+            const DatagramRing& ring = m_ioThread->GetSendRing();
+            return ring.GetCapacity() - ring.GetWritableCount();
+        }
+        return 0; // Sent directly, no send queue
     }
 
     uint32 UDPTransport::GetPendingReceiveCount() const
     {
+        if (m_ioThread)
+        {
+            return m_ioThread->GetReceiveRing().GetReadableCount();
+        }
+
         std::lock_guard<std::mutex> lock(m_receiveMutex);
         return static_cast<uint32>(m_receiveQueue.size());
     }
 
+    bool UDPTransport::HasIOThread() const
+    {
+        return m_ioThread != nullptr;
+    }
+
+    UDPIOStats UDPTransport::GetIOStats() const
+    {
+        return m_ioThread ? m_ioThread->GetStats() : UDPIOStats{};
+    }
+
+    TransportResult UDPTransport::QueueSend(const NetworkAddress& address, std::span<const uint8> data)
+    {
+        if (data.size() > RVX_NET_MAX_PACKET_SIZE)
+        {
+            RVX_CORE_ERROR("Packet size {} exceeds the largest datagram {}", data.size(), RVX_NET_MAX_PACKET_SIZE);
+            return TransportResult::SendFailed;
+        }
+
+        DatagramRing& ring = m_ioThread->GetSendRing();
+        if (ring.GetWritableCount() == 0)
+            return TransportResult::WouldBlock;
+
+        asio::ip::udp::endpoint destEndpoint;
+        if (!ResolveEndpoint(m_impl->ioContext, address, destEndpoint))
+        {
+            RVX_CORE_ERROR("Could not resolve address: {}", address.ToString());
+            return TransportResult::InvalidAddress;
+        }
+
+        DatagramSlot& slot = ring.GetWriteSlot(0);
+        slot.addressSize = static_cast<uint32>(destEndpoint.size());
+        std::memcpy(slot.address, destEndpoint.data(), slot.addressSize);
+        slot.size = static_cast<uint32>(data.size());
+        std::memcpy(slot.data, data.data(), data.size());
+
+        ring.Publish(1);
+        m_ioThread->NotifySend();
+        return TransportResult::Success;
+    }
+
+    void UDPTransport::ReadSlot(uint32 offset, ReceivedPacket& outPacket) const
+    {
+        const DatagramSlot& slot = m_ioThread->GetReceiveRing().GetReadSlot(offset);
+
+        asio::ip::udp::endpoint source;
+        std::memcpy(source.data(), slot.address, std::min<size_t>(slot.addressSize, source.capacity()));
+        source.resize(slot.addressSize);
+
+        outPacket.source.host = source.address().to_string();
+        outPacket.source.port = source.port();
+        outPacket.source.isIPv6 = source.address().is_v6();
+        outPacket.receiveTime = slot.time;
+        outPacket.data.assign(slot.data, slot.data + slot.size);
+    }
+
     void UDPTransport::StartReceive()
     {
         if (!m_active || !m_impl->socket)
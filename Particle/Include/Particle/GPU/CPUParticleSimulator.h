@@ -42,11 +42,51 @@ namespace RVX::Particle
         uint64 instanceId = 0;
     };
 
+    /**
+     * @brief Particle attributes stored as one array per component
+     * 
+     * Alive particles occupy [0, count) with no gaps: emission appends and a
+     * dying particle is replaced by the last alive one. Arrays are padded to
+     * a multiple of 4 so simulation kernels can always load whole lanes.
+     */
+    struct CPUParticleStreams
+    {
+        std::vector<float> positionX, positionY, positionZ;
+        std::vector<float> velocityX, velocityY, velocityZ;
+        std::vector<float> colorR, colorG, colorB, colorA;
+        std::vector<float> startColorR, startColorG, startColorB, startColorA;
+        std::vector<float> sizeX, sizeY;
+        std::vector<float> startSizeX, startSizeY;
+        std::vector<float> lifetime, age;
+        std::vector<float> rotation, rotationSpeed;
+        std::vector<uint32> flags;
+        std::vector<uint32> randomSeed;
+        std::vector<uint32> emitterIndex;
+
+        uint32 count = 0;
+
+        /// Allocate storage for capacity particles, all dead
+        void Allocate(uint32 capacity);
+
+        /// Release all storage
+        void Release();
+
+        /// Overwrite particle dst with particle src
+        void Move(uint32 dst, uint32 src);
+
+        /// Gather one particle into AoS form
+        CPUParticle Get(uint32 index) const;
+    };
+
     /**
      * @brief CPU-based particle simulator
      * 
      * Fallback implementation for platforms without Compute Shader support.
-     * Uses JobSystem for parallel simulation where available.
+     * Particles live in SoA streams and are simulated four at a time with
+     * SIMD kernels, in chunks spread over the JobSystem where available.
+     * 
+     * Initialize() accepts a null device for headless simulation (previews
+     * on servers, tests); GPU buffers are then not created or uploaded.
      */
     class CPUParticleSimulator : public IParticleSimulator
     {
@@ -74,7 +114,7 @@ namespace RVX::Particle
         RHIBuffer* GetParticleBuffer() const override { return m_gpuParticleBuffer.Get(); }
         RHIBuffer* GetAliveIndexBuffer() const override { return m_gpuAliveIndexBuffer.Get(); }
         RHIBuffer* GetIndirectDrawBuffer() const override { return m_gpuIndirectDrawBuffer.Get(); }
-        uint32 GetAliveCount() const override { return static_cast<uint32>(m_aliveIndices.size()); }
+        uint32 GetAliveCount() const override { return m_streams.count; }
         uint32 GetMaxParticles() const override { return m_maxParticles; }
 
         bool IsGPUBased() const override { return false; }
@@ -92,32 +132,44 @@ namespace RVX::Particle
         /// Clear queued events
         void ClearQueuedEvents() { m_queuedEvents.clear(); }
 
+        /// Alive particles, [0, GetAliveCount()) of each stream
+        const CPUParticleStreams& GetParticleStreams() const { return m_streams; }
+
     private:
+        /// Curves baked for one Simulate call, sampled per lane
+        struct BakedCurves;
+
+        /// Per-chunk results gathered serially after the parallel kernels
+        struct ChunkOutput
+        {
+            std::vector<uint32> dead;
+            std::vector<ParticleEvent> collisions;
+        };
+
         void EmitParticle(const EmitParams& params, uint32 index);
-        void SimulateParticle(uint32 index, float deltaTime, const SimulateParams& params);
-        void SimulateParticleWithModules(uint32 index, float deltaTime, const CPUSimulateParams& params);
-        void SimulateParallel(float deltaTime, const SimulateParams& params);
-        void SimulateParallelWithModules(float deltaTime, const CPUSimulateParams& params);
+        void SimulateStreams(float deltaTime, const CPUSimulateParams& params, bool collectEvents);
+        void SimulateChunk(uint32 begin, uint32 end, float deltaTime, const CPUSimulateParams& params,
+                           const BakedCurves& curves, bool collectEvents, ChunkOutput& output);
+        void RemoveDeadParticles(const CPUSimulateParams& params, bool collectEvents);
         void UploadToGPU();
         Vec3 GenerateEmitterPosition(const EmitterGPUData& data, float random);
         Vec3 GenerateEmitterVelocity(const EmitterGPUData& data, float random);
-        
-        // Noise sampling
-        float SamplePerlinNoise(const Vec3& pos) const;
-        Vec3 SampleCurlNoise(const Vec3& pos, float epsilon) const;
 
         bool m_initialized = false;
         IRHIDevice* m_device = nullptr;
         uint32 m_maxParticles = 0;
 
         // CPU particle data
-        std::vector<CPUParticle> m_particles;
-        std::vector<uint32> m_aliveIndices;
-        std::vector<uint32> m_deadIndices;
+        CPUParticleStreams m_streams;
+        std::vector<ChunkOutput> m_chunkOutputs;
         
         // Event queue for particle events
         std::vector<ParticleEvent> m_queuedEvents;
 
+        // Staging for UploadToGPU
+        std::vector<GPUParticle> m_uploadParticles;
+        std::vector<uint32> m_uploadIndices;
+
         // GPU upload buffers
         RHIBufferRef m_gpuParticleBuffer;
         RHIBufferRef m_gpuAliveIndexBuffer;
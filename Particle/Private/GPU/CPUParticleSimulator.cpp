@@ -2,13 +2,282 @@
 #include "Particle/Events/ParticleEventHandler.h"
 #include "Core/Log.h"
 #include "Core/Job/JobSystem.h"
+#include "Geometry/Batch/SIMDTypes.h"
 #include <cmath>
 #include <glm/glm.hpp>
-#include <mutex>
 
 namespace RVX::Particle
 {
 
+using Geometry::SIMD::Float4;
+
+namespace
+{
+
+/// Particles per SIMD kernel iteration
+constexpr uint32 kLaneCount = 4;
+
+/// Particles per parallel job; a multiple of kLaneCount
+constexpr uint32 kSimulateChunkSize = 4096;
+
+/// Samples for curves without a GPU LUT size of their own
+constexpr uint32 kCurveLUTSize = 64;
+
+constexpr float kCurlNoiseEpsilon = 0.01f;
+
+uint32 PadToLanes(uint32 count)
+{
+    return (count + kLaneCount - 1) & ~(kLaneCount - 1);
+}
+
+// =============================================================================
+// Curve LUT Sampling
+// =============================================================================
+
+/// Lookup positions of four normalized ages in a LUT
+struct LUTCoords
+{
+    uint32 index[kLaneCount];
+    Float4 fraction;
+};
+
+LUTCoords ComputeLUTCoords(Float4 normalizedAge, uint32 samples)
+{
+    float x[kLaneCount];
+    (normalizedAge * Float4::Splat(static_cast<float>(samples - 1))).Store(x);
+
+    LUTCoords coords;
+    float base[kLaneCount];
+    for (uint32 lane = 0; lane < kLaneCount; ++lane)
+    {
+        coords.index[lane] = std::min(static_cast<uint32>(x[lane]), samples - 2);
+        base[lane] = static_cast<float>(coords.index[lane]);
+    }
+    coords.fraction = Float4::Load(x) - Float4::Load(base);
+    return coords;
+}
+
+/// Linearly filtered LUT lookup, matching a GPU sampler on the same LUT
+Float4 SampleLUT(const std::vector<float>& lut, const LUTCoords& coords)
+{
+    const uint32* i = coords.index;
+    Float4 a(lut[i[0]], lut[i[1]], lut[i[2]], lut[i[3]]);
+    Float4 b(lut[i[0] + 1], lut[i[1] + 1], lut[i[2] + 1], lut[i[3] + 1]);
+    return a + (b - a) * coords.fraction;
+}
+
+// =============================================================================
+// Noise
+// =============================================================================
+
+/// Unit gradient coefficients of the 16 hashed Perlin directions
+struct GradientTable
+{
+    float x[16];
+    float y[16];
+    float z[16];
+};
+
+constexpr GradientTable MakeGradientTable()
+{
+    // grad(h) = (h & 1 ? -u : u) + (h & 2 ? -v : v) with u, v picked from x, y, z
+    GradientTable table{};
+    for (int b = 0; b < 16; ++b)
+    {
+        const float su = (b & 1) ? -1.0f : 1.0f;
+        const float sv = (b & 2) ? -1.0f : 1.0f;
+        float* u = b < 8 ? table.x : table.y;
+        float* v = b < 4 ? table.y : (b == 12 || b == 14 ? table.x : table.z);
+        u[b] += su;
+        v[b] += sv;
+    }
+    return table;
+}
+
+constexpr GradientTable kGradients = MakeGradientTable();
+
+uint32 HashLattice(uint32 x, uint32 y, uint32 z)
+{
+    // Wrapping arithmetic, bit-identical to the signed hash of the GPU path
+    uint32 n = x + y * 57u + z * 113u;
+    n = (n << 13) ^ n;
+    return (n * (n * n * 15731u + 789221u) + 1376312589u) & 0x7fffffffu;
+}
+
+Float4 Fade(Float4 t)
+{
+    return t * t * t * (t * (t * Float4::Splat(6.0f) - Float4::Splat(15.0f)) + Float4::Splat(10.0f));
+}
+
+Float4 Lerp(Float4 a, Float4 b, Float4 t)
+{
+    return a + t * (b - a);
+}
+
+/**
+ * @brief Perlin noise at four points
+ *
+ * Lattice hashing and gradient lookup run per lane; fading, gradient dot
+ * products and trilinear blending run on all four lanes at once.
+ */
+Float4 SamplePerlinNoise4(Float4 px, Float4 py, Float4 pz)
+{
+    float sx[kLaneCount], sy[kLaneCount], sz[kLaneCount];
+    px.Store(sx);
+    py.Store(sy);
+    pz.Store(sz);
+
+    // Gradient coefficients per corner (bit 0 = +x, bit 1 = +y, bit 2 = +z)
+    float gx[8][kLaneCount], gy[8][kLaneCount], gz[8][kLaneCount];
+    float cellX[kLaneCount], cellY[kLaneCount], cellZ[kLaneCount];
+    for (uint32 lane = 0; lane < kLaneCount; ++lane)
+    {
+        cellX[lane] = std::floor(sx[lane]);
+        cellY[lane] = std::floor(sy[lane]);
+        cellZ[lane] = std::floor(sz[lane]);
+        const uint32 X = static_cast<uint32>(static_cast<int>(cellX[lane]) & 255);
+        const uint32 Y = static_cast<uint32>(static_cast<int>(cellY[lane]) & 255);
+        const uint32 Z = static_cast<uint32>(static_cast<int>(cellZ[lane]) & 255);
+
+        for (uint32 corner = 0; corner < 8; ++corner)
+        {
+            const uint32 h = HashLattice(X + (corner & 1), Y + ((corner >> 1) & 1), Z + (corner >> 2)) & 15;
+            gx[corner][lane] = kGradients.x[h];
+            gy[corner][lane] = kGradients.y[h];
+            gz[corner][lane] = kGradients.z[h];
+        }
+    }
+
+    const Float4 x0 = px - Float4::Load(cellX);
+    const Float4 y0 = py - Float4::Load(cellY);
+    const Float4 z0 = pz - Float4::Load(cellZ);
+    const Float4 one = Float4::Splat(1.0f);
+    const Float4 x1 = x0 - one;
+    const Float4 y1 = y0 - one;
+    const Float4 z1 = z0 - one;
+
+    auto grad = [&](uint32 corner) {
+        const Float4 x = (corner & 1) ? x1 : x0;
+        const Float4 y = (corner & 2) ? y1 : y0;
+        const Float4 z = (corner & 4) ? z1 : z0;
+        return Float4::Load(gx[corner]) * x + Float4::Load(gy[corner]) * y + Float4::Load(gz[corner]) * z;
+    };
+
+    const Float4 u = Fade(x0);
+    const Float4 v = Fade(y0);
+    const Float4 w = Fade(z0);
+
+    const Float4 a = Lerp(Lerp(grad(0), grad(1), u), Lerp(grad(2), grad(3), u), v);
+    const Float4 b = Lerp(Lerp(grad(4), grad(5), u), Lerp(grad(6), grad(7), u), v);
+    return Lerp(a, b, w);
+}
+
+/// Curl of the Perlin noise field at four points, by central differences
+void SampleCurlNoise4(Float4 px, Float4 py, Float4 pz, Float4& outX, Float4& outY, Float4& outZ)
+{
+    const Float4 e = Float4::Splat(kCurlNoiseEpsilon);
+
+    const Float4 dy = SamplePerlinNoise4(px, py + e, pz) - SamplePerlinNoise4(px, py - e, pz);
+    const Float4 dz = SamplePerlinNoise4(px, py, pz + e) - SamplePerlinNoise4(px, py, pz - e);
+    const Float4 dx = SamplePerlinNoise4(px + e, py, pz) - SamplePerlinNoise4(px - e, py, pz);
+
+    const Float4 twoEpsilon = Float4::Splat(2.0f * kCurlNoiseEpsilon);
+    outX = (dy - dz) / twoEpsilon;
+    outY = (dz - dx) / twoEpsilon;
+    outZ = (dx - dy) / twoEpsilon;
+}
+
+} // namespace
+
+// =============================================================================
+// CPUParticleStreams
+// =============================================================================
+
+void CPUParticleStreams::Allocate(uint32 capacity)
+{
+    const size_t padded = PadToLanes(capacity);
+
+    // Padding lanes are simulated and ignored; keep them finite
+    for (auto* stream : {&positionX, &positionY, &positionZ, &velocityX, &velocityY, &velocityZ,
+                         &colorR, &colorG, &colorB, &colorA,
+                         &startColorR, &startColorG, &startColorB, &startColorA,
+                         &sizeX, &sizeY, &startSizeX, &startSizeY, &age, &rotation, &rotationSpeed})
+    {
+        stream->assign(padded, 0.0f);
+    }
+    lifetime.assign(padded, 1.0f);
+    flags.assign(padded, 0);
+    randomSeed.assign(padded, 0);
+    emitterIndex.assign(padded, 0);
+    count = 0;
+}
+
+void CPUParticleStreams::Release()
+{
+    *this = CPUParticleStreams();
+}
+
+void CPUParticleStreams::Move(uint32 dst, uint32 src)
+{
+    positionX[dst] = positionX[src];
+    positionY[dst] = positionY[src];
+    positionZ[dst] = positionZ[src];
+    velocityX[dst] = velocityX[src];
+    velocityY[dst] = velocityY[src];
+    velocityZ[dst] = velocityZ[src];
+    colorR[dst] = colorR[src];
+    colorG[dst] = colorG[src];
+    colorB[dst] = colorB[src];
+    colorA[dst] = colorA[src];
+    startColorR[dst] = startColorR[src];
+    startColorG[dst] = startColorG[src];
+    startColorB[dst] = startColorB[src];
+    startColorA[dst] = startColorA[src];
+    sizeX[dst] = sizeX[src];
+    sizeY[dst] = sizeY[src];
+    startSizeX[dst] = startSizeX[src];
+    startSizeY[dst] = startSizeY[src];
+    lifetime[dst] = lifetime[src];
+    age[dst] = age[src];
+    rotation[dst] = rotation[src];
+    rotationSpeed[dst] = rotationSpeed[src];
+    flags[dst] = flags[src];
+    randomSeed[dst] = randomSeed[src];
+    emitterIndex[dst] = emitterIndex[src];
+}
+
+CPUParticle CPUParticleStreams::Get(uint32 index) const
+{
+    CPUParticle p{};
+    p.position = Vec3(positionX[index], positionY[index], positionZ[index]);
+    p.velocity = Vec3(velocityX[index], velocityY[index], velocityZ[index]);
+    p.color = Vec4(colorR[index], colorG[index], colorB[index], colorA[index]);
+    p.startColor = Vec4(startColorR[index], startColorG[index], startColorB[index], startColorA[index]);
+    p.size = Vec2(sizeX[index], sizeY[index]);
+    p.startSize = Vec2(startSizeX[index], startSizeY[index]);
+    p.lifetime = lifetime[index];
+    p.age = age[index];
+    p.rotation = rotation[index];
+    p.rotationSpeed = rotationSpeed[index];
+    p.flags = flags[index];
+    p.emitterIndex = emitterIndex[index];
+    p.randomSeed = randomSeed[index];
+    return p;
+}
+
+// =============================================================================
+// CPUParticleSimulator
+// =============================================================================
+
+/// Module curves baked to LUTs, with the size multiplier folded in
+struct CPUParticleSimulator::BakedCurves
+{
+    std::vector<float> speed;
+    std::vector<float> angularVelocity;
+    std::vector<float> colorR, colorG, colorB, colorA;
+    std::vector<float> sizeX, sizeY;
+};
+
 CPUParticleSimulator::~CPUParticleSimulator()
 {
     Shutdown();
@@ -22,44 +291,38 @@ void CPUParticleSimulator::Initialize(IRHIDevice* device, uint32 maxParticles)
     m_device = device;
     m_maxParticles = maxParticles;
 
-    // Initialize CPU buffers
-    m_particles.resize(maxParticles);
-    m_aliveIndices.reserve(maxParticles);
-    m_deadIndices.reserve(maxParticles);
-
-    // All particles start dead
-    for (uint32 i = 0; i < maxParticles; ++i)
-    {
-        m_deadIndices.push_back(i);
-        m_particles[i].flags = 0;
-    }
+    // Initialize CPU buffers; all particles start dead
+    m_streams.Allocate(maxParticles);
 
     // Initialize RNG
     m_rng.seed(std::random_device{}());
 
-    // Create GPU buffers for rendering
-    RHIBufferDesc particleDesc;
-    particleDesc.size = sizeof(GPUParticle) * maxParticles;
-    particleDesc.usage = RHIBufferUsage::Structured | RHIBufferUsage::ShaderResource;
-    particleDesc.stride = sizeof(GPUParticle);
-    particleDesc.memoryType = RHIMemoryType::Upload;
-    particleDesc.debugName = "CPUParticleBuffer";
-    m_gpuParticleBuffer = m_device->CreateBuffer(particleDesc);
-
-    RHIBufferDesc indexDesc;
-    indexDesc.size = sizeof(uint32) * maxParticles;
-    indexDesc.usage = RHIBufferUsage::Structured | RHIBufferUsage::ShaderResource;
-    indexDesc.stride = sizeof(uint32);
-    indexDesc.memoryType = RHIMemoryType::Upload;
-    indexDesc.debugName = "CPUAliveIndexBuffer";
-    m_gpuAliveIndexBuffer = m_device->CreateBuffer(indexDesc);
-
-    RHIBufferDesc indirectDesc;
-    indirectDesc.size = sizeof(IndirectDrawArgs);
-    indirectDesc.usage = RHIBufferUsage::IndirectArgs;
-    indirectDesc.memoryType = RHIMemoryType::Upload;
-    indirectDesc.debugName = "CPUIndirectDrawBuffer";
-    m_gpuIndirectDrawBuffer = m_device->CreateBuffer(indirectDesc);
+    // Create GPU buffers for rendering, unless simulating headless
+    if (m_device)
+    {
+        RHIBufferDesc particleDesc;
+        particleDesc.size = sizeof(GPUParticle) * maxParticles;
+        particleDesc.usage = RHIBufferUsage::Structured | RHIBufferUsage::ShaderResource;
+        particleDesc.stride = sizeof(GPUParticle);
+        particleDesc.memoryType = RHIMemoryType::Upload;
+        particleDesc.debugName = "CPUParticleBuffer";
+        m_gpuParticleBuffer = m_device->CreateBuffer(particleDesc);
+
+        RHIBufferDesc indexDesc;
+        indexDesc.size = sizeof(uint32) * maxParticles;
+        indexDesc.usage = RHIBufferUsage::Structured | RHIBufferUsage::ShaderResource;
+        indexDesc.stride = sizeof(uint32);
+        indexDesc.memoryType = RHIMemoryType::Upload;
+        indexDesc.debugName = "CPUAliveIndexBuffer";
+        m_gpuAliveIndexBuffer = m_device->CreateBuffer(indexDesc);
+
+        RHIBufferDesc indirectDesc;
+        indirectDesc.size = sizeof(IndirectDrawArgs);
+        indirectDesc.usage = RHIBufferUsage::IndirectArgs;
+        indirectDesc.memoryType = RHIMemoryType::Upload;
+        indirectDesc.debugName = "CPUIndirectDrawBuffer";
+        m_gpuIndirectDrawBuffer = m_device->CreateBuffer(indirectDesc);
+    }
 
     m_initialized = true;
     RVX_CORE_INFO("CPUParticleSimulator: Initialized with {} max particles", maxParticles);
@@ -67,10 +330,11 @@ void CPUParticleSimulator::Initialize(IRHIDevice* device, uint32 maxParticles)
 
 void CPUParticleSimulator::Shutdown()
 {
-    m_particles.clear();
-    m_aliveIndices.clear();
-    m_deadIndices.clear();
-    
+    m_streams.Release();
+    m_chunkOutputs.clear();
+    m_uploadParticles.clear();
+    m_uploadIndices.clear();
+
     m_gpuParticleBuffer.Reset();
     m_gpuAliveIndexBuffer.Reset();
     m_gpuIndirectDrawBuffer.Reset();
@@ -82,18 +346,16 @@ void CPUParticleSimulator::Shutdown()
 
 void CPUParticleSimulator::Emit(const EmitParams& params)
 {
-    if (params.emitCount == 0 || m_deadIndices.empty())
+    const uint32 available = m_maxParticles - m_streams.count;
+    if (params.emitCount == 0 || available == 0)
         return;
 
-    uint32 toEmit = std::min(params.emitCount, static_cast<uint32>(m_deadIndices.size()));
+    uint32 toEmit = std::min(params.emitCount, available);
 
+    // Alive particles stay packed: new ones go right after the last
     for (uint32 i = 0; i < toEmit; ++i)
     {
-        uint32 particleIndex = m_deadIndices.back();
-        m_deadIndices.pop_back();
-        
-        EmitParticle(params, particleIndex);
-        m_aliveIndices.push_back(particleIndex);
+        EmitParticle(params, m_streams.count++);
     }
 
     m_gpuDirty = true;
@@ -101,7 +363,7 @@ void CPUParticleSimulator::Emit(const EmitParams& params)
 
 void CPUParticleSimulator::EmitParticle(const EmitParams& params, uint32 index)
 {
-    CPUParticle& p = m_particles[index];
+    CPUParticleStreams& s = m_streams;
     const EmitterGPUData& data = params.emitterData;
 
     float r1 = m_dist(m_rng);
@@ -111,32 +373,41 @@ void CPUParticleSimulator::EmitParticle(const EmitParams& params, uint32 index)
     float r5 = m_dist(m_rng);
 
     // Position from emitter shape
-    p.position = GenerateEmitterPosition(data, r1);
+    Vec3 position = GenerateEmitterPosition(data, r1);
+    s.positionX[index] = position.x;
+    s.positionY[index] = position.y;
+    s.positionZ[index] = position.z;
 
     // Velocity
     float speed = data.velocityParams.x + (data.velocityParams.y - data.velocityParams.x) * r2;
-    p.velocity = GenerateEmitterVelocity(data, r1) * speed;
+    Vec3 velocity = GenerateEmitterVelocity(data, r1) * speed;
+    s.velocityX[index] = velocity.x;
+    s.velocityY[index] = velocity.y;
+    s.velocityZ[index] = velocity.z;
 
     // Lifetime
-    p.lifetime = data.lifetimeParams.x + (data.lifetimeParams.y - data.lifetimeParams.x) * r3;
-    p.age = 0.0f;
+    s.lifetime[index] = data.lifetimeParams.x + (data.lifetimeParams.y - data.lifetimeParams.x) * r3;
+    s.age[index] = 0.0f;
 
     // Size
     float size = data.sizeParams.x + (data.sizeParams.y - data.sizeParams.x) * r4;
-    p.size = Vec2(size, size);
-    p.startSize = p.size;
+    s.sizeX[index] = s.startSizeX[index] = size;
+    s.sizeY[index] = s.startSizeY[index] = size;
 
     // Color
-    p.color = data.colorStart;
-    p.startColor = p.color;
+    s.colorR[index] = s.startColorR[index] = data.colorStart.x;
+    s.colorG[index] = s.startColorG[index] = data.colorStart.y;
+    s.colorB[index] = s.startColorB[index] = data.colorStart.z;
+    s.colorA[index] = s.startColorA[index] = data.colorStart.w;
 
     // Rotation
-    p.rotation = data.rotationParams.x + (data.rotationParams.y - data.rotationParams.x) * r5;
-    p.rotationSpeed = data.rotationParams.z + (data.rotationParams.w - data.rotationParams.z) * r5;
+    s.rotation[index] = data.rotationParams.x + (data.rotationParams.y - data.rotationParams.x) * r5;
+    s.rotationSpeed[index] = data.rotationParams.z + (data.rotationParams.w - data.rotationParams.z) * r5;
 
     // Flags
-    p.flags = PARTICLE_FLAG_ALIVE;
-    p.randomSeed = params.randomSeed + index;
+    s.flags[index] = PARTICLE_FLAG_ALIVE;
+    s.randomSeed[index] = params.randomSeed + index;
+    s.emitterIndex[index] = 0;
 }
 
 Vec3 CPUParticleSimulator::GenerateEmitterPosition(const EmitterGPUData& data, float random)
@@ -399,476 +670,351 @@ Vec3 CPUParticleSimulator::GenerateEmitterVelocity(const EmitterGPUData& data, f
 
 void CPUParticleSimulator::Simulate(float deltaTime, const SimulateParams& params)
 {
-    if (m_aliveIndices.empty())
-        return;
+    CPUSimulateParams simulateParams;
+    static_cast<SimulateParams&>(simulateParams) = params;
+    simulateParams.totalTime = params.totalTime;
 
-    // Use parallel simulation if JobSystem is available
-    if (m_aliveIndices.size() > 256)
-    {
-        SimulateParallel(deltaTime, params);
-    }
-    else
-    {
-        for (uint32 index : m_aliveIndices)
-        {
-            SimulateParticle(index, deltaTime, params);
-        }
-    }
-
-    // Remove dead particles
-    std::vector<uint32> newAlive;
-    newAlive.reserve(m_aliveIndices.size());
-
-    for (uint32 index : m_aliveIndices)
-    {
-        if (m_particles[index].flags & PARTICLE_FLAG_ALIVE)
-        {
-            newAlive.push_back(index);
-        }
-        else
-        {
-            m_deadIndices.push_back(index);
-        }
-    }
-
-    m_aliveIndices = std::move(newAlive);
-    m_gpuDirty = true;
+    SimulateStreams(deltaTime, simulateParams, false);
 }
 
-void CPUParticleSimulator::SimulateParticle(uint32 index, float deltaTime, const SimulateParams& params)
+void CPUParticleSimulator::SimulateWithModules(float deltaTime, const CPUSimulateParams& params)
 {
-    CPUParticle& p = m_particles[index];
-    const SimulationGPUData& data = params.simulationData;
-
-    // Update age
-    p.age += deltaTime;
-
-    // Check death
-    if (p.age >= p.lifetime)
-    {
-        p.flags &= ~PARTICLE_FLAG_ALIVE;
-        return;
-    }
-
-    float normalizedAge = p.age / p.lifetime;
-
-    // Apply gravity and forces
-    Vec3 gravity = Vec3(data.gravity);
-    Vec3 force = Vec3(data.forceParams);
-    float drag = data.forceParams.w;
-
-    p.velocity += gravity * deltaTime;
-    p.velocity += force * deltaTime;
-    p.velocity *= (1.0f - drag * deltaTime);
-
-    // Update position
-    p.position += p.velocity * deltaTime;
+    m_queuedEvents.clear();
 
-    // Update rotation
-    p.rotation += p.rotationSpeed * deltaTime;
+    SimulateStreams(deltaTime, params, true);
 
-    // Collision (simplified plane collision)
-    if (data.collisionEnabled)
+    // Dispatch events if handler provided
+    if (params.eventHandler && !m_queuedEvents.empty())
     {
-        for (uint32 i = 0; i < data.collisionPlaneCount; ++i)
-        {
-            Vec4 plane = data.collisionPlanes[i];
-            Vec3 normal = Vec3(plane);
-            float dist = dot(p.position, normal) + plane.w;
-            
-            if (dist < p.size.x * data.collisionRadiusScale)
-            {
-                // Reflect velocity
-                p.velocity = glm::reflect(p.velocity, normal) * data.collisionBounce;
-                
-                // Push out of plane
-                p.position += normal * (p.size.x * data.collisionRadiusScale - dist);
-                
-                // Lifetime loss
-                p.lifetime -= p.lifetime * data.collisionLifetimeLoss;
-                
-                // Set collision flag
-                p.flags |= PARTICLE_FLAG_COLLISION;
-            }
-        }
+        params.eventHandler->DispatchEvents(m_queuedEvents);
     }
-
-    // Color/size over lifetime (simplified - just fade alpha)
-    p.color.w = p.startColor.w * (1.0f - normalizedAge);
 }
 
-void CPUParticleSimulator::SimulateWithModules(float deltaTime, const CPUSimulateParams& params)
+void CPUParticleSimulator::SimulateStreams(float deltaTime, const CPUSimulateParams& params, bool collectEvents)
 {
-    if (m_aliveIndices.empty())
+    if (m_streams.count == 0)
         return;
-    
-    m_queuedEvents.clear();
 
-    // Use parallel simulation if enough particles
-    if (m_aliveIndices.size() > 256)
+    // Bake module curves once instead of evaluating them per particle
+    BakedCurves curves;
+    if (params.velocityModule && params.velocityModule->enabled)
+    {
+        curves.speed.resize(kCurveLUTSize);
+        params.velocityModule->speedModifier.BakeToLUT(curves.speed.data(), kCurveLUTSize);
+    }
+    if (params.rotationModule && params.rotationModule->enabled)
     {
-        SimulateParallelWithModules(deltaTime, params);
+        curves.angularVelocity.resize(kCurveLUTSize);
+        params.rotationModule->angularVelocityCurve.BakeToLUT(curves.angularVelocity.data(), kCurveLUTSize);
     }
-    else
+    if (params.colorModule && params.colorModule->enabled)
     {
-        for (uint32 index : m_aliveIndices)
+        Vec4 lut[COLOR_LUT_SIZE];
+        params.colorModule->colorGradient.BakeToLUT(lut, COLOR_LUT_SIZE);
+        for (auto* channel : {&curves.colorR, &curves.colorG, &curves.colorB, &curves.colorA})
+        {
+            channel->resize(COLOR_LUT_SIZE);
+        }
+        for (uint32 i = 0; i < COLOR_LUT_SIZE; ++i)
         {
-            SimulateParticleWithModules(index, deltaTime, params);
+            curves.colorR[i] = lut[i].x;
+            curves.colorG[i] = lut[i].y;
+            curves.colorB[i] = lut[i].z;
+            curves.colorA[i] = lut[i].w;
         }
     }
-
-    // Remove dead particles and queue death events
-    std::vector<uint32> newAlive;
-    newAlive.reserve(m_aliveIndices.size());
-
-    for (uint32 index : m_aliveIndices)
+    if (params.sizeModule && params.sizeModule->enabled)
     {
-        if (m_particles[index].flags & PARTICLE_FLAG_ALIVE)
+        const SizeOverLifetimeModule& size = *params.sizeModule;
+        curves.sizeX.resize(SIZE_LUT_SIZE);
+        curves.sizeY.resize(SIZE_LUT_SIZE);
+        size.sizeCurve.BakeToLUT(curves.sizeX.data(), SIZE_LUT_SIZE);
+        (size.separateAxes ? size.sizeCurveY : size.sizeCurve).BakeToLUT(curves.sizeY.data(), SIZE_LUT_SIZE);
+        for (uint32 i = 0; i < SIZE_LUT_SIZE; ++i)
         {
-            newAlive.push_back(index);
+            curves.sizeX[i] *= size.sizeMultiplier.x;
+            curves.sizeY[i] *= size.sizeMultiplier.y;
         }
-        else
+    }
+
+    // Kernels run on disjoint chunks; deaths and events are applied afterwards
+    const uint32 chunkCount = (m_streams.count + kSimulateChunkSize - 1) / kSimulateChunkSize;
+    if (m_chunkOutputs.size() < chunkCount)
+    {
+        m_chunkOutputs.resize(chunkCount);
+    }
+
+    const uint32 count = m_streams.count;
+    JobSystem::Get().ParallelFor(0, chunkCount,
+        [this, count, deltaTime, &params, &curves, collectEvents](size_t chunk)
         {
-            m_deadIndices.push_back(index);
-            
-            // Queue death event
-            CPUParticle& p = m_particles[index];
-            m_queuedEvents.push_back(MakeDeathEvent(
-                p.position, p.velocity, p.color,
-                p.age, p.lifetime, index, p.emitterIndex, params.instanceId
-            ));
+            const uint32 begin = static_cast<uint32>(chunk) * kSimulateChunkSize;
+            const uint32 end = std::min(begin + kSimulateChunkSize, count);
+            SimulateChunk(begin, end, deltaTime, params, curves, collectEvents, m_chunkOutputs[chunk]);
+        }, 1);
+
+    if (collectEvents)
+    {
+        for (uint32 chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const auto& collisions = m_chunkOutputs[chunk].collisions;
+            m_queuedEvents.insert(m_queuedEvents.end(), collisions.begin(), collisions.end());
         }
     }
 
-    m_aliveIndices = std::move(newAlive);
+    RemoveDeadParticles(params, collectEvents);
     m_gpuDirty = true;
-    
-    // Dispatch events if handler provided
-    if (params.eventHandler && !m_queuedEvents.empty())
-    {
-        params.eventHandler->DispatchEvents(m_queuedEvents);
-    }
 }
 
-void CPUParticleSimulator::SimulateParticleWithModules(uint32 index, float deltaTime, const CPUSimulateParams& params)
+void CPUParticleSimulator::SimulateChunk(uint32 begin, uint32 end, float deltaTime,
+                                         const CPUSimulateParams& params, const BakedCurves& curves,
+                                         bool collectEvents, ChunkOutput& output)
 {
-    CPUParticle& p = m_particles[index];
+    CPUParticleStreams& s = m_streams;
     const SimulationGPUData& data = params.simulationData;
 
-    // Update age
-    p.age += deltaTime;
+    output.dead.clear();
+    output.collisions.clear();
 
-    // Check death
-    if (p.age >= p.lifetime)
-    {
-        p.flags &= ~PARTICLE_FLAG_ALIVE;
-        return;
-    }
+    const Float4 zero = Float4::Zero();
+    const Float4 one = Float4::Splat(1.0f);
+    const Float4 dt = Float4::Splat(deltaTime);
 
-    float normalizedAge = p.age / p.lifetime;
+    // Gravity and constant force
+    const Float4 accelX = Float4::Splat((data.gravity.x + data.forceParams.x) * deltaTime);
+    const Float4 accelY = Float4::Splat((data.gravity.y + data.forceParams.y) * deltaTime);
+    const Float4 accelZ = Float4::Splat((data.gravity.z + data.forceParams.z) * deltaTime);
+    const Float4 dragScale = Float4::Splat(1.0f - data.forceParams.w * deltaTime);
 
-    // Apply gravity and forces
-    Vec3 gravity = Vec3(data.gravity);
-    Vec3 force = Vec3(data.forceParams);
-    float drag = data.forceParams.w;
+    const VelocityOverLifetimeModule* velocityModule = curves.speed.empty() ? nullptr : params.velocityModule;
+    const RotationOverLifetimeModule* rotationModule = curves.angularVelocity.empty() ? nullptr : params.rotationModule;
+    const NoiseModule* noiseModule = params.noiseModule && params.noiseModule->enabled ? params.noiseModule : nullptr;
+    const bool radialVelocity = velocityModule && std::abs(velocityModule->radialVelocity) > 0.001f;
 
-    p.velocity += gravity * deltaTime;
-    p.velocity += force * deltaTime;
-    
-    // Apply velocity over lifetime module
-    if (params.velocityModule && params.velocityModule->enabled)
+    for (uint32 i = begin; i < end; i += kLaneCount)
     {
-        float speedMod = params.velocityModule->speedModifier.Evaluate(normalizedAge);
-        p.velocity *= speedMod;
-        
-        // Add linear velocity
-        Vec3 linearVel = params.velocityModule->linearVelocity;
-        p.velocity += linearVel * deltaTime;
-        
-        // Apply radial velocity (towards/away from origin)
-        if (std::abs(params.velocityModule->radialVelocity) > 0.001f)
+        // Lanes past the last alive particle hold stale data; their results are ignored
+        const int laneMask = end - i >= kLaneCount ? 0xF : (1 << (end - i)) - 1;
+
+        // Age and death
+        const Float4 age = Float4::Load(&s.age[i]) + dt;
+        Float4 lifetime = Float4::Load(&s.lifetime[i]);
+        age.Store(&s.age[i]);
+
+        const Float4 alive = age < lifetime;
+        const int deadLanes = ~alive.MoveMask() & laneMask;
+        const Float4 normalizedAge = (age / lifetime).Min(one).Max(zero);
+
+        Float4 px = Float4::Load(&s.positionX[i]);
+        Float4 py = Float4::Load(&s.positionY[i]);
+        Float4 pz = Float4::Load(&s.positionZ[i]);
+        Float4 vx = Float4::Load(&s.velocityX[i]) + accelX;
+        Float4 vy = Float4::Load(&s.velocityY[i]) + accelY;
+        Float4 vz = Float4::Load(&s.velocityZ[i]) + accelZ;
+
+        // Velocity over lifetime
+        if (velocityModule)
         {
-            Vec3 radialDir = normalize(p.position);
-            if (length(radialDir) > 0.001f)
+            const Float4 speed = SampleLUT(curves.speed, ComputeLUTCoords(normalizedAge, kCurveLUTSize));
+            const Vec3 linear = velocityModule->linearVelocity * deltaTime;
+            vx = vx * speed + Float4::Splat(linear.x);
+            vy = vy * speed + Float4::Splat(linear.y);
+            vz = vz * speed + Float4::Splat(linear.z);
+
+            if (radialVelocity)
             {
-                p.velocity += radialDir * params.velocityModule->radialVelocity * deltaTime;
+                // Away from the origin; particles at the origin get no push
+                const Float4 distance = (px * px + py * py + pz * pz).Sqrt();
+                const Float4 scale = (distance > zero).Select(
+                    Float4::Splat(velocityModule->radialVelocity * deltaTime) / distance, zero);
+                vx += px * scale;
+                vy += py * scale;
+                vz += pz * scale;
             }
         }
-    }
-    
-    // Apply drag
-    p.velocity *= (1.0f - drag * deltaTime);
-    
-    // Apply noise module
-    if (params.noiseModule && params.noiseModule->enabled)
-    {
-        float strength = params.noiseModule->strength;
-        float frequency = params.noiseModule->frequency;
-        float scrollSpeed = params.noiseModule->scrollSpeed;
-        float posAmount = params.noiseModule->positionAmount;
-        
-        Vec3 noisePos = p.position * frequency + Vec3(0.0f, params.totalTime * scrollSpeed, 0.0f);
-        Vec3 noiseOffset = SampleCurlNoise(noisePos, 0.01f);
-        p.velocity += noiseOffset * strength * posAmount * deltaTime;
-    }
 
-    // Update position
-    p.position += p.velocity * deltaTime;
+        // Drag
+        vx *= dragScale;
+        vy *= dragScale;
+        vz *= dragScale;
 
-    // Apply rotation over lifetime module
-    if (params.rotationModule && params.rotationModule->enabled)
-    {
-        float angVelMod = params.rotationModule->angularVelocityCurve.Evaluate(normalizedAge);
-        float angVel = mix(params.rotationModule->angularVelocity.min, 
-                          params.rotationModule->angularVelocity.max,
-                          static_cast<float>(p.randomSeed % 1000) / 1000.0f);
-        p.rotation += angVel * angVelMod * deltaTime;
-    }
-    else
-    {
-        p.rotation += p.rotationSpeed * deltaTime;
-    }
+        // Curl noise
+        if (noiseModule)
+        {
+            const Float4 frequency = Float4::Splat(noiseModule->frequency);
+            const Float4 scroll = Float4::Splat(params.totalTime * noiseModule->scrollSpeed);
+            Float4 nx, ny, nz;
+            SampleCurlNoise4(px * frequency, py * frequency + scroll, pz * frequency, nx, ny, nz);
+
+            const Float4 amount = Float4::Splat(noiseModule->strength * noiseModule->positionAmount * deltaTime);
+            vx += nx * amount;
+            vy += ny * amount;
+            vz += nz * amount;
+        }
 
-    // Collision detection
-    bool collided = false;
-    if (data.collisionEnabled)
-    {
-        for (uint32 i = 0; i < data.collisionPlaneCount; ++i)
+        // Integrate
+        px += vx * dt;
+        py += vy * dt;
+        pz += vz * dt;
+
+        // Rotation
+        Float4 rotation = Float4::Load(&s.rotation[i]);
+        if (rotationModule)
         {
-            Vec4 plane = data.collisionPlanes[i];
-            Vec3 normal = Vec3(plane);
-            float dist = dot(p.position, normal) + plane.w;
-            float radius = p.size.x * data.collisionRadiusScale;
-            
-            if (dist < radius)
+            // Per-particle angular velocity picked by seed, as on the GPU path
+            float pick[kLaneCount];
+            for (uint32 lane = 0; lane < kLaneCount; ++lane)
             {
-                // Reflect velocity
-                p.velocity = glm::reflect(p.velocity, normal) * data.collisionBounce;
-                
-                // Push out of plane
-                p.position += normal * (radius - dist);
-                
-                // Lifetime loss
-                p.lifetime -= p.lifetime * data.collisionLifetimeLoss;
-                
-                // Set collision flag
-                p.flags |= PARTICLE_FLAG_COLLISION;
-                collided = true;
-                
-                // Queue collision event
-                m_queuedEvents.push_back(MakeCollisionEvent(
-                    p.position, p.velocity, normal, p.color,
-                    p.age, p.lifetime, index, p.emitterIndex, params.instanceId
-                ));
+                pick[lane] = static_cast<float>(s.randomSeed[i + lane] % 1000) / 1000.0f;
             }
+            const Float4 minVelocity = Float4::Splat(rotationModule->angularVelocity.min);
+            const Float4 maxVelocity = Float4::Splat(rotationModule->angularVelocity.max);
+            const Float4 angularVelocity = minVelocity + (maxVelocity - minVelocity) * Float4::Load(pick);
+            const Float4 curve = SampleLUT(curves.angularVelocity, ComputeLUTCoords(normalizedAge, kCurveLUTSize));
+            rotation += angularVelocity * curve * dt;
         }
-    }
-
-    // Apply color over lifetime module
-    if (params.colorModule && params.colorModule->enabled)
-    {
-        p.color = params.colorModule->Evaluate(normalizedAge);
-        // Modulate with start color
-        p.color *= p.startColor;
-    }
-    else
-    {
-        // Default: fade alpha
-        p.color = p.startColor;
-        p.color.w *= (1.0f - normalizedAge);
-    }
-
-    // Apply size over lifetime module
-    if (params.sizeModule && params.sizeModule->enabled)
-    {
-        Vec2 sizeMod = params.sizeModule->Evaluate(normalizedAge);
-        p.size = p.startSize * sizeMod;
-    }
-}
-
-void CPUParticleSimulator::SimulateParallelWithModules(float deltaTime, const CPUSimulateParams& params)
-{
-    JobSystem& jobs = JobSystem::Get();
-    
-    if (!jobs.IsInitialized())
-    {
-        // Fall back to serial
-        for (uint32 index : m_aliveIndices)
+        else
         {
-            SimulateParticleWithModules(index, deltaTime, params);
+            rotation += Float4::Load(&s.rotationSpeed[i]) * dt;
         }
-        return;
-    }
+        rotation.Store(&s.rotation[i]);
 
-    // Thread-local event queues
-    std::vector<std::vector<ParticleEvent>> threadEvents(jobs.GetWorkerCount() + 1);
-    
-    jobs.ParallelFor(0, m_aliveIndices.size(),
-        [this, deltaTime, &params, &threadEvents](size_t i)
+        // Plane collision
+        if (data.collisionEnabled)
         {
-            uint32 idx = m_aliveIndices[i];
-            CPUParticle& p = m_particles[idx];
-            const SimulationGPUData& data = params.simulationData;
-            
-            // ... inline simulation for performance (same as SimulateParticleWithModules)
-            p.age += deltaTime;
-            
-            if (p.age >= p.lifetime)
-            {
-                p.flags &= ~PARTICLE_FLAG_ALIVE;
-                return;
-            }
+            const Float4 radius = Float4::Load(&s.sizeX[i]) * Float4::Splat(data.collisionRadiusScale);
+            const Float4 bounce = Float4::Splat(data.collisionBounce);
+            const Float4 lifetimeLoss = Float4::Splat(data.collisionLifetimeLoss);
 
-            float normalizedAge = p.age / p.lifetime;
-            
-            // Forces
-            Vec3 gravity = Vec3(data.gravity);
-            Vec3 force = Vec3(data.forceParams);
-            float drag = data.forceParams.w;
-            
-            p.velocity += gravity * deltaTime;
-            p.velocity += force * deltaTime;
-            p.velocity *= (1.0f - drag * deltaTime);
-            p.position += p.velocity * deltaTime;
-            p.rotation += p.rotationSpeed * deltaTime;
-            
-            // Collision
-            if (data.collisionEnabled)
+            for (uint32 plane = 0; plane < data.collisionPlaneCount; ++plane)
             {
-                for (uint32 ci = 0; ci < data.collisionPlaneCount; ++ci)
+                const Vec4& planeData = data.collisionPlanes[plane];
+                const Float4 nx = Float4::Splat(planeData.x);
+                const Float4 ny = Float4::Splat(planeData.y);
+                const Float4 nz = Float4::Splat(planeData.z);
+
+                const Float4 distance = px * nx + py * ny + pz * nz + Float4::Splat(planeData.w);
+                const Float4 hit = (distance < radius).And(alive);
+                const int hitLanes = hit.MoveMask() & laneMask;
+                if (hitLanes == 0)
+                {
+                    continue;
+                }
+
+                // Reflect and damp the velocity, push out of the plane, lose lifetime
+                const Float4 twoVelocityDotN = Float4::Splat(2.0f) * (vx * nx + vy * ny + vz * nz);
+                const Float4 push = radius - distance;
+                vx = hit.Select((vx - nx * twoVelocityDotN) * bounce, vx);
+                vy = hit.Select((vy - ny * twoVelocityDotN) * bounce, vy);
+                vz = hit.Select((vz - nz * twoVelocityDotN) * bounce, vz);
+                px = hit.Select(px + nx * push, px);
+                py = hit.Select(py + ny * push, py);
+                pz = hit.Select(pz + nz * push, pz);
+                lifetime = hit.Select(lifetime - lifetime * lifetimeLoss, lifetime);
+
+                for (uint32 lane = 0; lane < kLaneCount; ++lane)
                 {
-                    Vec4 plane = data.collisionPlanes[ci];
-                    Vec3 normal = Vec3(plane);
-                    float dist = dot(p.position, normal) + plane.w;
-                    float radius = p.size.x * data.collisionRadiusScale;
-                    
-                    if (dist < radius)
+                    if (!(hitLanes & (1 << lane)))
+                        continue;
+
+                    const uint32 index = i + lane;
+                    s.flags[index] |= PARTICLE_FLAG_COLLISION;
+                    if (collectEvents)
                     {
-                        p.velocity = glm::reflect(p.velocity, normal) * data.collisionBounce;
-                        p.position += normal * (radius - dist);
-                        p.lifetime -= p.lifetime * data.collisionLifetimeLoss;
-                        p.flags |= PARTICLE_FLAG_COLLISION;
+                        output.collisions.push_back(MakeCollisionEvent(
+                            Vec3(px[lane], py[lane], pz[lane]), Vec3(vx[lane], vy[lane], vz[lane]),
+                            Vec3(planeData),
+                            Vec4(s.colorR[index], s.colorG[index], s.colorB[index], s.colorA[index]),
+                            age[lane], lifetime[lane], index, s.emitterIndex[index], params.instanceId));
                     }
                 }
             }
-            
-            // Color over lifetime
-            if (params.colorModule && params.colorModule->enabled)
-            {
-                p.color = params.colorModule->Evaluate(normalizedAge) * p.startColor;
-            }
-            else
-            {
-                p.color = p.startColor;
-                p.color.w *= (1.0f - normalizedAge);
-            }
-            
-            // Size over lifetime
-            if (params.sizeModule && params.sizeModule->enabled)
+            lifetime.Store(&s.lifetime[i]);
+        }
+
+        px.Store(&s.positionX[i]);
+        py.Store(&s.positionY[i]);
+        pz.Store(&s.positionZ[i]);
+        vx.Store(&s.velocityX[i]);
+        vy.Store(&s.velocityY[i]);
+        vz.Store(&s.velocityZ[i]);
+
+        // Color over lifetime, modulated by the start color; default fades alpha
+        const Float4 startR = Float4::Load(&s.startColorR[i]);
+        const Float4 startG = Float4::Load(&s.startColorG[i]);
+        const Float4 startB = Float4::Load(&s.startColorB[i]);
+        const Float4 startA = Float4::Load(&s.startColorA[i]);
+        if (!curves.colorR.empty())
+        {
+            const LUTCoords coords = ComputeLUTCoords(normalizedAge, COLOR_LUT_SIZE);
+            (SampleLUT(curves.colorR, coords) * startR).Store(&s.colorR[i]);
+            (SampleLUT(curves.colorG, coords) * startG).Store(&s.colorG[i]);
+            (SampleLUT(curves.colorB, coords) * startB).Store(&s.colorB[i]);
+            (SampleLUT(curves.colorA, coords) * startA).Store(&s.colorA[i]);
+        }
+        else
+        {
+            startR.Store(&s.colorR[i]);
+            startG.Store(&s.colorG[i]);
+            startB.Store(&s.colorB[i]);
+            (startA * (one - normalizedAge)).Store(&s.colorA[i]);
+        }
+
+        // Size over lifetime
+        if (!curves.sizeX.empty())
+        {
+            const LUTCoords coords = ComputeLUTCoords(normalizedAge, SIZE_LUT_SIZE);
+            (Float4::Load(&s.startSizeX[i]) * SampleLUT(curves.sizeX, coords)).Store(&s.sizeX[i]);
+            (Float4::Load(&s.startSizeY[i]) * SampleLUT(curves.sizeY, coords)).Store(&s.sizeY[i]);
+        }
+
+        for (uint32 lane = 0; deadLanes >> lane; ++lane)
+        {
+            if (deadLanes & (1 << lane))
             {
-                Vec2 sizeMod = params.sizeModule->Evaluate(normalizedAge);
-                p.size = p.startSize * sizeMod;
+                output.dead.push_back(i + lane);
             }
-        });
-}
-
-// Perlin noise implementation for CPU
-float CPUParticleSimulator::SamplePerlinNoise(const Vec3& pos) const
-{
-    // Simplified Perlin noise implementation
-    auto fade = [](float t) { return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f); };
-    auto lerp = [](float a, float b, float t) { return a + t * (b - a); };
-    
-    // Simple hash function
-    auto hash = [](int x, int y, int z) -> int {
-        int n = x + y * 57 + z * 113;
-        n = (n << 13) ^ n;
-        return (n * (n * n * 15731 + 789221) + 1376312589) & 0x7fffffff;
-    };
-    
-    auto grad = [](int h, float x, float y, float z) -> float {
-        int b = h & 15;
-        float u = b < 8 ? x : y;
-        float v = b < 4 ? y : (b == 12 || b == 14 ? x : z);
-        return ((b & 1) ? -u : u) + ((b & 2) ? -v : v);
-    };
-    
-    int X = static_cast<int>(std::floor(pos.x)) & 255;
-    int Y = static_cast<int>(std::floor(pos.y)) & 255;
-    int Z = static_cast<int>(std::floor(pos.z)) & 255;
-    
-    float x = pos.x - std::floor(pos.x);
-    float y = pos.y - std::floor(pos.y);
-    float z = pos.z - std::floor(pos.z);
-    
-    float u = fade(x);
-    float v = fade(y);
-    float w = fade(z);
-    
-    int aaa = hash(X, Y, Z);
-    int aba = hash(X, Y + 1, Z);
-    int aab = hash(X, Y, Z + 1);
-    int abb = hash(X, Y + 1, Z + 1);
-    int baa = hash(X + 1, Y, Z);
-    int bba = hash(X + 1, Y + 1, Z);
-    int bab = hash(X + 1, Y, Z + 1);
-    int bbb = hash(X + 1, Y + 1, Z + 1);
-    
-    float x1 = lerp(grad(aaa, x, y, z), grad(baa, x - 1, y, z), u);
-    float x2 = lerp(grad(aba, x, y - 1, z), grad(bba, x - 1, y - 1, z), u);
-    float y1 = lerp(x1, x2, v);
-    
-    float x3 = lerp(grad(aab, x, y, z - 1), grad(bab, x - 1, y, z - 1), u);
-    float x4 = lerp(grad(abb, x, y - 1, z - 1), grad(bbb, x - 1, y - 1, z - 1), u);
-    float y2 = lerp(x3, x4, v);
-    
-    return lerp(y1, y2, w);
+        }
+    }
 }
 
-Vec3 CPUParticleSimulator::SampleCurlNoise(const Vec3& pos, float epsilon) const
+void CPUParticleSimulator::RemoveDeadParticles(const CPUSimulateParams& params, bool collectEvents)
 {
-    Vec3 curl;
-    
-    float n1 = SamplePerlinNoise(pos + Vec3(0, epsilon, 0));
-    float n2 = SamplePerlinNoise(pos - Vec3(0, epsilon, 0));
-    float n3 = SamplePerlinNoise(pos + Vec3(0, 0, epsilon));
-    float n4 = SamplePerlinNoise(pos - Vec3(0, 0, epsilon));
-    float n5 = SamplePerlinNoise(pos + Vec3(epsilon, 0, 0));
-    float n6 = SamplePerlinNoise(pos - Vec3(epsilon, 0, 0));
-    
-    curl.x = (n1 - n2) - (n3 - n4);
-    curl.y = (n3 - n4) - (n5 - n6);
-    curl.z = (n5 - n6) - (n1 - n2);
-    
-    return curl / (2.0f * epsilon);
-}
+    CPUParticleStreams& s = m_streams;
+    const uint32 chunkCount = (s.count + kSimulateChunkSize - 1) / kSimulateChunkSize;
 
-void CPUParticleSimulator::SimulateParallel(float deltaTime, const SimulateParams& params)
-{
-    JobSystem& jobs = JobSystem::Get();
-    
-    if (!jobs.IsInitialized())
+    // Highest index first: everything above the current index is alive, so
+    // the last particle can fill its slot
+    for (uint32 chunk = chunkCount; chunk-- > 0;)
     {
-        // Fall back to serial
-        for (uint32 index : m_aliveIndices)
+        const std::vector<uint32>& dead = m_chunkOutputs[chunk].dead;
+        for (auto it = dead.rbegin(); it != dead.rend(); ++it)
         {
-            SimulateParticle(index, deltaTime, params);
+            const uint32 index = *it;
+            if (collectEvents)
+            {
+                m_queuedEvents.push_back(MakeDeathEvent(
+                    Vec3(s.positionX[index], s.positionY[index], s.positionZ[index]),
+                    Vec3(s.velocityX[index], s.velocityY[index], s.velocityZ[index]),
+                    Vec4(s.colorR[index], s.colorG[index], s.colorB[index], s.colorA[index]),
+                    s.age[index], s.lifetime[index], index, s.emitterIndex[index], params.instanceId));
+            }
+
+            const uint32 last = --s.count;
+            if (index != last)
+            {
+                s.Move(index, last);
+            }
+            s.flags[last] = 0;
         }
-        return;
     }
-
-    jobs.ParallelFor(0, m_aliveIndices.size(),
-        [this, deltaTime, &params](size_t i)
-        {
-            SimulateParticle(m_aliveIndices[i], deltaTime, params);
-        });
 }
 
 void CPUParticleSimulator::PrepareRender(RHICommandContext& ctx)
 {
     (void)ctx;
-    
-    if (!m_gpuDirty)
+
+    if (!m_gpuDirty || !m_device)
         return;
 
     UploadToGPU();
@@ -877,40 +1023,43 @@ void CPUParticleSimulator::PrepareRender(RHICommandContext& ctx)
 
 void CPUParticleSimulator::UploadToGPU()
 {
-    if (m_aliveIndices.empty())
+    const uint32 count = m_streams.count;
+    if (count == 0)
         return;
 
     // Convert CPU particles to GPU format and upload
-    std::vector<GPUParticle> gpuParticles(m_aliveIndices.size());
-    
-    for (size_t i = 0; i < m_aliveIndices.size(); ++i)
+    const CPUParticleStreams& s = m_streams;
+    m_uploadParticles.resize(count);
+    for (uint32 i = 0; i < count; ++i)
     {
-        const CPUParticle& cpu = m_particles[m_aliveIndices[i]];
-        GPUParticle& gpu = gpuParticles[i];
-        
-        gpu.position = cpu.position;
-        gpu.lifetime = cpu.lifetime;
-        gpu.velocity = cpu.velocity;
-        gpu.age = cpu.age;
-        gpu.color = cpu.color;
-        gpu.size = cpu.size;
-        gpu.rotation = cpu.rotation;
-        gpu.flags = cpu.flags;
+        GPUParticle& gpu = m_uploadParticles[i];
+        gpu.position = Vec3(s.positionX[i], s.positionY[i], s.positionZ[i]);
+        gpu.lifetime = s.lifetime[i];
+        gpu.velocity = Vec3(s.velocityX[i], s.velocityY[i], s.velocityZ[i]);
+        gpu.age = s.age[i];
+        gpu.color = Vec4(s.colorR[i], s.colorG[i], s.colorB[i], s.colorA[i]);
+        gpu.size = Vec2(s.sizeX[i], s.sizeY[i]);
+        gpu.rotation = s.rotation[i];
+        gpu.flags = s.flags[i];
     }
 
     // Upload particle data
-    m_gpuParticleBuffer->Upload(gpuParticles.data(), gpuParticles.size());
+    m_gpuParticleBuffer->Upload(m_uploadParticles.data(), m_uploadParticles.size());
 
     // Upload alive indices (0, 1, 2, ... for sequential access)
-    std::vector<uint32> indices(m_aliveIndices.size());
-    for (size_t i = 0; i < indices.size(); ++i)
-        indices[i] = static_cast<uint32>(i);
-    m_gpuAliveIndexBuffer->Upload(indices.data(), indices.size());
+    if (m_uploadIndices.size() < count)
+    {
+        const uint32 first = static_cast<uint32>(m_uploadIndices.size());
+        m_uploadIndices.resize(count);
+        for (uint32 i = first; i < count; ++i)
+            m_uploadIndices[i] = i;
+    }
+    m_gpuAliveIndexBuffer->Upload(m_uploadIndices.data(), count);
 
     // Update indirect draw args
     IndirectDrawArgs args = {};
     args.indexCountPerInstance = 6;
-    args.instanceCount = static_cast<uint32>(m_aliveIndices.size());
+    args.instanceCount = count;
     args.startIndexLocation = 0;
     args.baseVertexLocation = 0;
     args.startInstanceLocation = 0;
@@ -919,13 +1068,9 @@ void CPUParticleSimulator::UploadToGPU()
 
 void CPUParticleSimulator::Clear()
 {
-    // Move all alive to dead
-    for (uint32 index : m_aliveIndices)
-    {
-        m_particles[index].flags = 0;
-        m_deadIndices.push_back(index);
-    }
-    m_aliveIndices.clear();
+    // Flags of alive particles only; the rest are already clear
+    std::fill(m_streams.flags.begin(), m_streams.flags.begin() + m_streams.count, 0u);
+    m_streams.count = 0;
     m_gpuDirty = true;
 }
 
@@ -0,0 +1,151 @@
+/**
+ * @file Broadphase.h
+ * @brief Pair generation for the built-in physics backend
+ */
+
+#pragma once
+
+#include "Physics/Broadphase/DynamicAABBTree.h"
+#include <unordered_set>
+#include <vector>
+
+namespace RVX::Physics
+{
+
+/**
+ * @brief Potentially colliding proxy pair
+ *
+ * Pairs persist while their fat bounds overlap, so narrowphase state such
+ * as `touching` carries over from one step to the next.
+ */
+struct BroadphasePair
+{
+    int32 proxyA = DynamicAABBTree::NullNode;   ///< Always the smaller proxy id
+    int32 proxyB = DynamicAABBTree::NullNode;
+    bool touching = false;                      ///< Narrowphase result of the last step
+};
+
+/**
+ * @brief Broadphase built on a dynamic AABB tree with a persistent pair cache
+ *
+ * Only proxies whose fat bounds changed since the last UpdatePairs() are
+ * queried against the tree, so the per-step cost scales with the number of
+ * moving proxies rather than with the square of the proxy count.
+ *
+ * Usage:
+ * @code
+ * int32 proxy = broadphase.AddProxy(bounds, body);
+ * // each step
+ * broadphase.MoveProxy(proxy, newBounds, velocity * dt);
+ * broadphase.UpdatePairs();
+ * for (BroadphasePair& pair : broadphase.GetPairs()) { ... }
+ * @endcode
+ */
+class Broadphase
+{
+public:
+    /// Return false to reject a pair before it enters the cache
+    using PairFilter = bool (*)(void* userDataA, void* userDataB);
+
+    struct Stats
+    {
+        size_t proxyCount = 0;
+        size_t pairCount = 0;
+        size_t movedProxyCount = 0;     ///< Proxies re-queried by the last update
+        size_t addedPairCount = 0;
+        size_t removedPairCount = 0;
+        int32 treeHeight = 0;
+    };
+
+    // =========================================================================
+    // Proxies
+    // =========================================================================
+
+    int32 AddProxy(const AABB& bounds, void* userData);
+
+    /**
+     * @brief Remove a proxy and every cached pair that references it
+     *
+     * The pairs are dropped silently; they do not show up in GetRemovedPairs().
+     */
+    void RemoveProxy(int32 proxyId);
+
+    /**
+     * @brief Update a proxy's bounds
+     * @param displacement Expected motion over the next step
+     */
+    void MoveProxy(int32 proxyId, const AABB& bounds, const Vec3& displacement);
+
+    /// Re-query a proxy on the next update even if its fat bounds did not change
+    void TouchProxy(int32 proxyId);
+
+    void* GetUserData(int32 proxyId) const { return m_tree.GetUserData(proxyId); }
+
+    // =========================================================================
+    // Pairs
+    // =========================================================================
+
+    /**
+     * @brief Drop pairs whose fat bounds separated and add pairs for moved proxies
+     */
+    void UpdatePairs();
+
+    /// Cached pairs; callers may update `touching` in place
+    std::vector<BroadphasePair>& GetPairs() { return m_pairs; }
+    const std::vector<BroadphasePair>& GetPairs() const { return m_pairs; }
+
+    /// Pairs dropped by the last UpdatePairs(), with their final `touching` state
+    const std::vector<BroadphasePair>& GetRemovedPairs() const { return m_removedPairs; }
+
+    void SetPairFilter(PairFilter filter) { m_pairFilter = filter; }
+
+    // =========================================================================
+    // Queries & Statistics
+    // =========================================================================
+
+    /// Visit every proxy whose fat bounds overlap the box
+    template<typename Callback>
+    void Query(const AABB& bounds, Callback&& callback) const
+    {
+        m_tree.Query(bounds, std::forward<Callback>(callback));
+    }
+
+    /// Visit proxies whose fat bounds a ray crosses; see DynamicAABBTree::RayCast
+    template<typename Callback>
+    void RayCast(const Vec3& origin, const Vec3& direction, float maxDistance, Callback&& callback) const
+    {
+        m_tree.RayCast(origin, direction, maxDistance, std::forward<Callback>(callback));
+    }
+
+    const DynamicAABBTree& GetTree() const { return m_tree; }
+    const Stats& GetStats() const { return m_stats; }
+
+    /// Remove every proxy and pair
+    void Clear();
+
+private:
+    static uint64 PairKey(int32 proxyA, int32 proxyB)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(proxyA)) << 32) | static_cast<uint32>(proxyB);
+    }
+
+    void BufferMove(int32 proxyId);
+    bool IsBuffered(int32 proxyId) const
+    {
+        return static_cast<size_t>(proxyId) < m_moveFlags.size() && m_moveFlags[proxyId] != 0;
+    }
+
+    DynamicAABBTree m_tree;
+
+    std::vector<int32> m_moveBuffer;
+    std::vector<uint8> m_moveFlags;         // Indexed by proxy id
+
+    std::vector<BroadphasePair> m_pairs;
+    std::vector<BroadphasePair> m_removedPairs;
+    std::unordered_set<uint64> m_pairKeys;
+
+    PairFilter m_pairFilter = nullptr;
+    Stats m_stats;
+};
+
+} // namespace RVX::Physics
@@ -0,0 +1,243 @@
+/**
+ * @file DynamicAABBTree.h
+ * @brief Incrementally updated AABB tree with fat leaf bounds
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Core/Assert.h"
+#include "Core/Math/AABB.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace RVX::Physics
+{
+
+/**
+ * @brief Dynamic AABB tree for the built-in broadphase
+ *
+ * Each proxy is stored in a leaf whose bounds are "fat": the tight bounds
+ * inflated by a margin and stretched along the last displacement. A proxy
+ * only leaves its leaf when its tight bounds escape the fat bounds, so
+ * bodies that move a little every step rarely touch the tree.
+ *
+ * Inserts choose the sibling with the lowest surface area cost and the
+ * tree is kept height-balanced with AVL-style rotations.
+ */
+class DynamicAABBTree
+{
+public:
+    static constexpr int32 NullNode = -1;
+    static constexpr int32 MaxQueryDepth = 256;
+
+    DynamicAABBTree();
+
+    // =========================================================================
+    // Proxies
+    // =========================================================================
+
+    /**
+     * @brief Insert a proxy
+     * @param bounds Tight bounds, the stored leaf bounds are fattened by the margin
+     * @return Proxy id, stable until DestroyProxy
+     */
+    int32 CreateProxy(const AABB& bounds, void* userData);
+
+    void DestroyProxy(int32 proxyId);
+
+    /**
+     * @brief Update a proxy after its owner moved
+     * @param displacement Motion since the last update, used to predict the fat bounds
+     * @return true if the proxy was reinserted (its fat bounds changed)
+     */
+    bool MoveProxy(int32 proxyId, const AABB& bounds, const Vec3& displacement);
+
+    void* GetUserData(int32 proxyId) const { return m_nodes[proxyId].userData; }
+
+    AABB GetFatBounds(int32 proxyId) const
+    {
+        return AABB(m_nodes[proxyId].min, m_nodes[proxyId].max);
+    }
+
+    bool FatBoundsOverlap(int32 proxyA, int32 proxyB) const
+    {
+        const Node& a = m_nodes[proxyA];
+        const Node& b = m_nodes[proxyB];
+        return Overlaps(a.min, a.max, b.min, b.max);
+    }
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    /**
+     * @brief Visit every proxy whose fat bounds overlap the box
+     * @param callback bool(int32 proxyId), return false to stop the query
+     */
+    template<typename Callback>
+    void Query(const AABB& bounds, Callback&& callback) const
+    {
+        if (m_root == NullNode)
+            return;
+
+        const Vec3 queryMin = bounds.GetMin();
+        const Vec3 queryMax = bounds.GetMax();
+
+        // The tree is height balanced, so the stack never gets deeper than its height + 1
+        int32 stack[MaxQueryDepth];
+        int32 stackSize = 0;
+        stack[stackSize++] = m_root;
+
+        while (stackSize > 0)
+        {
+            const int32 nodeId = stack[--stackSize];
+
+            const Node& node = m_nodes[nodeId];
+            if (!Overlaps(node.min, node.max, queryMin, queryMax))
+                continue;
+
+            if (node.IsLeaf())
+            {
+                if (!callback(nodeId))
+                    return;
+            }
+            else
+            {
+                RVX_ASSERT(stackSize + 2 <= MaxQueryDepth);
+                stack[stackSize++] = node.child1;
+                stack[stackSize++] = node.child2;
+            }
+        }
+    }
+
+    /**
+     * @brief Visit proxies whose fat bounds a ray segment crosses, nearer subtrees first
+     * @param direction Normalized ray direction
+     * @param callback float(int32 proxyId, float maxDistance); return the new maximum
+     *        distance (a hit distance clips the ray), maxDistance to continue unchanged,
+     *        or 0 to stop
+     */
+    template<typename Callback>
+    void RayCast(const Vec3& origin, const Vec3& direction, float maxDistance, Callback&& callback) const
+    {
+        if (m_root == NullNode)
+            return;
+
+        // Clamp instead of dividing by zero so axis-aligned rays never produce 0 * inf
+        auto inverse = [](float d) { return std::abs(d) > 1e-12f ? 1.0f / d : (d < 0.0f ? -1e30f : 1e30f); };
+        const Vec3 invDirection(inverse(direction.x), inverse(direction.y), inverse(direction.z));
+
+        // Entry distances ride along on the stack, so a subtree is skipped
+        // without retesting once a closer hit has clipped the ray
+        struct Entry
+        {
+            int32 nodeId;
+            float distance;
+        };
+        Entry stack[MaxQueryDepth];
+        int32 stackSize = 0;
+
+        const float rootEntry = RayEntry(m_nodes[m_root], origin, invDirection, maxDistance);
+        if (rootEntry <= maxDistance)
+            stack[stackSize++] = {m_root, rootEntry};
+
+        while (stackSize > 0)
+        {
+            const Entry entry = stack[--stackSize];
+            if (entry.distance > maxDistance)
+                continue;
+
+            const Node& node = m_nodes[entry.nodeId];
+            if (node.IsLeaf())
+            {
+                maxDistance = callback(entry.nodeId, maxDistance);
+                if (maxDistance <= 0.0f)
+                    return;
+                continue;
+            }
+
+            const float entry1 = RayEntry(m_nodes[node.child1], origin, invDirection, maxDistance);
+            const float entry2 = RayEntry(m_nodes[node.child2], origin, invDirection, maxDistance);
+            RVX_ASSERT(stackSize + 2 <= MaxQueryDepth);
+
+            // Push the farther child first so the nearer one is visited next
+            const Entry first{node.child1, entry1};
+            const Entry second{node.child2, entry2};
+            const Entry& nearer = entry1 <= entry2 ? first : second;
+            const Entry& farther = entry1 <= entry2 ? second : first;
+            if (farther.distance <= maxDistance)
+                stack[stackSize++] = farther;
+            if (nearer.distance <= maxDistance)
+                stack[stackSize++] = nearer;
+        }
+    }
+
+    // =========================================================================
+    // Configuration & Statistics
+    // =========================================================================
+
+    /// Margin added on every side of a proxy's tight bounds
+    void SetMargin(float margin) { m_margin = margin; }
+    float GetMargin() const { return m_margin; }
+
+    size_t GetProxyCount() const { return m_proxyCount; }
+    int32 GetHeight() const { return m_root == NullNode ? 0 : m_nodes[m_root].height; }
+
+    /// Sum of node surface areas over the root area; lower means tighter trees
+    float GetAreaRatio() const;
+
+    /// Check parent links, heights and bounds; intended for tests
+    bool Validate() const;
+
+private:
+    struct Node
+    {
+        Vec3 min{0.0f};
+        Vec3 max{0.0f};
+        void* userData = nullptr;
+        int32 parent = NullNode;      // next free node while on the free list
+        int32 child1 = NullNode;
+        int32 child2 = NullNode;
+        int32 height = -1;            // 0 for leaves, -1 for free nodes
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    static bool Overlaps(const Vec3& minA, const Vec3& maxA, const Vec3& minB, const Vec3& maxB)
+    {
+        return minA.x <= maxB.x && maxA.x >= minB.x &&
+               minA.y <= maxB.y && maxA.y >= minB.y &&
+               minA.z <= maxB.z && maxA.z >= minB.z;
+    }
+
+    /// Distance at which the ray enters the node, or infinity if it misses within maxDistance
+    static float RayEntry(const Node& node, const Vec3& origin, const Vec3& invDirection, float maxDistance)
+    {
+        const Vec3 t1 = (node.min - origin) * invDirection;
+        const Vec3 t2 = (node.max - origin) * invDirection;
+        const Vec3 tNear = glm::min(t1, t2);
+        const Vec3 tFar = glm::max(t1, t2);
+        const float entry = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        const float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxDistance));
+        return entry <= exit ? entry : std::numeric_limits<float>::infinity();
+    }
+
+    int32 AllocateNode();
+    void FreeNode(int32 nodeId);
+    void InsertLeaf(int32 leaf);
+    void RemoveLeaf(int32 leaf);
+    int32 Balance(int32 nodeId);
+    void RefitAncestors(int32 nodeId);
+    bool ValidateNode(int32 nodeId) const;
+
+    std::vector<Node> m_nodes;
+    int32 m_root = NullNode;
+    int32 m_freeList = NullNode;
+    size_t m_proxyCount = 0;
+    float m_margin = 0.1f;
+};
+
+} // namespace RVX::Physics
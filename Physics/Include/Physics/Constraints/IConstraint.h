@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Physics/PhysicsTypes.h"
+#include <cfloat>
 #include <memory>
 
 namespace RVX::Physics
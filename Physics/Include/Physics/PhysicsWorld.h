@@ -7,8 +7,10 @@
 
 #include "Physics/PhysicsTypes.h"
 #include "Physics/RigidBody.h"
+#include "Physics/Broadphase/Broadphase.h"
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
 
@@ -18,6 +20,9 @@ namespace RVX::Physics
 class CollisionShape;
 class IConstraint;
 using Constraint = IConstraint;  // Alias for compatibility
+struct ContactConstraint;
+struct SimulationIsland;
+class IslandBuilder;
 
 /**
  * @brief Physics world configuration
@@ -31,6 +36,48 @@ struct PhysicsWorldConfig
     int velocitySteps = 10;
     int positionSteps = 2;
     float fixedTimeStep = 1.0f / 60.0f;
+
+    bool enableSleeping = true;
+    float sleepLinearVelocity = 0.1f;       // Bodies slower than this count as resting
+    float sleepAngularVelocity = 0.1f;
+    float timeToSleep = 0.5f;               // Seconds a whole island must rest before it sleeps
+
+    bool parallelIslands = true;            // Solve independent islands on the JobSystem
+};
+
+/**
+ * @brief One ray of a batched raycast
+ */
+struct RaycastCommand
+{
+    Vec3 origin{0.0f};
+    Vec3 direction{0.0f, 0.0f, 1.0f};   ///< Normalized
+    float maxDistance = 1000.0f;
+    uint32 layerMask = 0xFFFFFFFF;
+};
+
+/**
+ * @brief One sweep of a batched shape cast
+ */
+struct ShapeCastCommand
+{
+    const CollisionShape* shape = nullptr;  ///< Convex shape; must outlive the batch
+    Vec3 origin{0.0f};
+    Quat rotation{1, 0, 0, 0};
+    Vec3 direction{0.0f, 0.0f, 1.0f};       ///< Normalized
+    float maxDistance = 1000.0f;
+    uint32 layerMask = 0xFFFFFFFF;
+};
+
+/**
+ * @brief One test of a batched overlap query
+ */
+struct OverlapCommand
+{
+    const CollisionShape* shape = nullptr;  ///< Convex shape; must outlive the batch
+    Vec3 position{0.0f};
+    Quat rotation{1, 0, 0, 0};
+    uint32 layerMask = 0xFFFFFFFF;
 };
 
 /**
@@ -73,7 +120,7 @@ class PhysicsWorld
 public:
     using Ptr = std::shared_ptr<PhysicsWorld>;
 
-    PhysicsWorld() = default;
+    PhysicsWorld();
     ~PhysicsWorld();
 
     // Non-copyable
@@ -114,6 +161,18 @@ public:
      */
     float GetTimeStep() const { return m_config.fixedTimeStep; }
 
+    /**
+     * @brief Counters from the last internal step
+     */
+    struct StepStats
+    {
+        size_t islandCount = 0;         ///< Awake islands that were solved
+        size_t awakeBodyCount = 0;
+        size_t contactCount = 0;
+        size_t jobCount = 0;            ///< Island batches handed to the JobSystem
+    };
+    const StepStats& GetStepStats() const { return m_stepStats; }
+
     /**
      * @brief Set gravity
      */
@@ -223,6 +282,41 @@ public:
     size_t OverlapSphere(const Vec3& center, float radius,
                          std::vector<BodyHandle>& bodies, uint32 layerMask = 0xFFFFFFFF) const;
 
+    /**
+     * @brief Sweep a convex shape through the world
+     * @param direction Sweep direction (normalized)
+     * @return True if hit something; a shape starting in overlap hits at fraction 0
+     */
+    bool ShapeCast(const CollisionShape& shape, const Vec3& origin, const Quat& rotation,
+                   const Vec3& direction, float maxDistance, ShapeCastHit& hit,
+                   uint32 layerMask = 0xFFFFFFFF) const;
+
+    /**
+     * @brief Find bodies overlapping a convex shape
+     */
+    size_t OverlapShape(const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                        std::vector<BodyHandle>& bodies, uint32 layerMask = 0xFFFFFFFF) const;
+
+    /**
+     * @brief Run many raycasts, split across the JobSystem
+     * @param hits One result per command; must be as long as commands
+     */
+    void RaycastBatch(std::span<const RaycastCommand> commands, std::span<RaycastHit> hits) const;
+
+    /**
+     * @brief Run many shape casts, split across the JobSystem
+     * @param hits One result per command; must be as long as commands
+     */
+    void ShapeCastBatch(std::span<const ShapeCastCommand> commands, std::span<ShapeCastHit> hits) const;
+
+    /**
+     * @brief Run many overlap queries, split across the JobSystem
+     *
+     * Bodies overlapping command i are bodies[offsets[i]] .. bodies[offsets[i + 1] - 1].
+     */
+    void OverlapBatch(std::span<const OverlapCommand> commands,
+                      std::vector<BodyHandle>& bodies, std::vector<uint32>& offsets) const;
+
     // =========================================================================
     // Callbacks
     // =========================================================================
@@ -264,7 +358,19 @@ public:
      * @brief Get debug draw data
      */
     void GetDebugDrawData(std::vector<Vec3>& lines, std::vector<Vec4>& colors,
-                          const DebugDrawOptions& options = {}) const;
+                          const DebugDrawOptions& options) const;
+
+    void GetDebugDrawData(std::vector<Vec3>& lines, std::vector<Vec4>& colors) const
+    {
+        // Overload instead of a defaulted argument: GCC and Clang reject `= {}` for a nested
+        // struct with member initializers before the enclosing class is complete
+        GetDebugDrawData(lines, colors, DebugDrawOptions{});
+    }
+
+    /**
+     * @brief Built-in broadphase, for statistics and debugging
+     */
+    const Broadphase& GetBroadphase() const { return m_broadphase; }
 
 private:
     // =========================================================================
@@ -277,9 +383,39 @@ private:
     void StepInternal(float dt);
 
     /**
-     * @brief Update body sleep states
+     * @brief Refit body proxies and refresh the cached pairs
+     */
+    void UpdateBroadphase(float dt);
+
+    /**
+     * @brief Refit the proxies of bodies solved this step so queries see their new poses
+     */
+    void RefitSolvedProxies(float dt);
+
+    /**
+     * @brief Refit one body's proxy after it was moved or reshaped outside the step
      */
-    void UpdateSleepStates();
+    void RefreshProxy(BodyHandle body);
+
+    /**
+     * @brief Run the narrowphase on cached pairs and queue contact events
+     */
+    void UpdateContacts(std::vector<ContactConstraint>& contacts);
+
+    /**
+     * @brief Invoke callbacks for events queued during the step
+     */
+    void DispatchEvents();
+
+    /**
+     * @brief Integrate and solve one island; touches no body outside it
+     */
+    void SolveIsland(const SimulationIsland& island, float dt);
+
+    /**
+     * @brief Advance sleep timers and put the island to sleep once all its bodies rest
+     */
+    void UpdateSleepStates(const SimulationIsland& island, float dt);
 
     // =========================================================================
     // Data Members
@@ -289,9 +425,15 @@ private:
     bool m_initialized = false;
 
     std::vector<std::unique_ptr<RigidBody>> m_bodies;
+    std::vector<int32> m_bodyProxies;               // Broadphase proxy per entry in m_bodies
     std::unordered_map<uint64, size_t> m_bodyLookup;
     uint64 m_nextBodyId = 1;
 
+    Broadphase m_broadphase;
+    std::unique_ptr<IslandBuilder> m_islandBuilder;
+    std::vector<uint32> m_islandBatches;            // First island of each job, plus an end marker
+    StepStats m_stepStats;
+
     std::vector<std::shared_ptr<Constraint>> m_constraints;
     uint64 m_nextConstraintId = 1;
 
@@ -302,6 +444,13 @@ private:
     CollisionCallback m_onTriggerEnter;
     CollisionCallback m_onTriggerExit;
 
+    struct PendingEvent
+    {
+        CollisionEvent event;
+        bool begin = false;
+    };
+    std::vector<PendingEvent> m_pendingEvents;
+
     // Backend-specific implementation pointer
     void* m_backendData = nullptr;
 };
@@ -66,6 +66,10 @@ public:
 
     BodyHandle GetHandle() const { return BodyHandle(m_id); }
 
+    /// Slot in the owning PhysicsWorld's body list, maintained by the world
+    uint32 GetWorldIndex() const { return m_worldIndex; }
+    void SetWorldIndex(uint32 index) { m_worldIndex = index; }
+
     // =========================================================================
     // Type
     // =========================================================================
@@ -161,11 +165,22 @@ public:
     // Shapes
     // =========================================================================
 
+    /**
+     * @brief Shape attached to the body, placed relative to the body origin
+     */
+    struct ShapeInstance
+    {
+        std::shared_ptr<CollisionShape> shape;
+        Vec3 offset;
+        Quat rotation;
+    };
+
     void AddShape(std::shared_ptr<CollisionShape> shape,
                   const Vec3& offset = Vec3(0.0f),
                   const Quat& rotation = Quat(1,0,0,0));
 
     size_t GetShapeCount() const { return m_shapes.size(); }
+    const std::vector<ShapeInstance>& GetShapes() const { return m_shapes; }
 
     /**
      * @brief Get world-space axis-aligned bounding box
@@ -188,6 +203,10 @@ public:
     bool CanSleep() const { return m_allowSleep; }
     void SetAllowSleep(bool allow);
 
+    /// Seconds the body has stayed below the sleep velocity thresholds; reset on wake-up
+    float GetSleepTimer() const { return m_sleepTimer; }
+    void SetSleepTimer(float seconds) { m_sleepTimer = seconds; }
+
     // =========================================================================
     // User Data
     // =========================================================================
@@ -197,6 +216,7 @@ public:
 
 private:
     uint64 m_id = 0;
+    uint32 m_worldIndex = 0;
     BodyType m_type = BodyType::Dynamic;
 
     Vec3 m_position{0.0f};
@@ -221,13 +241,8 @@ private:
 
     bool m_sleeping = false;
     bool m_allowSleep = true;
+    float m_sleepTimer = 0.0f;
 
-    struct ShapeInstance
-    {
-        std::shared_ptr<CollisionShape> shape;
-        Vec3 offset;
-        Quat rotation;
-    };
     std::vector<ShapeInstance> m_shapes;
 
     void* m_userData = nullptr;
@@ -574,6 +574,14 @@ public:
     uint32 GetDepth() const { return m_depth; }
     const Vec3& GetScale() const { return m_scale; }
 
+    /**
+     * @brief Get the scaled height of a grid sample
+     */
+    float GetSampleHeight(uint32 ix, uint32 iz) const
+    {
+        return m_heights[iz * m_width + ix] * m_scale.y;
+    }
+
     /**
      * @brief Get height at a world position
      */
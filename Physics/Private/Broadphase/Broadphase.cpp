@@ -0,0 +1,149 @@
+/**
+ * @file Broadphase.cpp
+ * @brief Broadphase implementation
+ */
+
+#include "Physics/Broadphase/Broadphase.h"
+#include <algorithm>
+
+namespace RVX::Physics
+{
+
+int32 Broadphase::AddProxy(const AABB& bounds, void* userData)
+{
+    const int32 proxyId = m_tree.CreateProxy(bounds, userData);
+    BufferMove(proxyId);
+    return proxyId;
+}
+
+void Broadphase::RemoveProxy(int32 proxyId)
+{
+    if (IsBuffered(proxyId))
+    {
+        m_moveFlags[proxyId] = 0;
+        auto it = std::find(m_moveBuffer.begin(), m_moveBuffer.end(), proxyId);
+        if (it != m_moveBuffer.end())
+            *it = DynamicAABBTree::NullNode;
+    }
+
+    // The id is recycled by the tree, so nothing may keep referring to it
+    auto references = [proxyId](const BroadphasePair& pair)
+    {
+        return pair.proxyA == proxyId || pair.proxyB == proxyId;
+    };
+
+    for (const BroadphasePair& pair : m_pairs)
+    {
+        if (references(pair))
+            m_pairKeys.erase(PairKey(pair.proxyA, pair.proxyB));
+    }
+    m_pairs.erase(std::remove_if(m_pairs.begin(), m_pairs.end(), references), m_pairs.end());
+    m_removedPairs.erase(std::remove_if(m_removedPairs.begin(), m_removedPairs.end(), references),
+                         m_removedPairs.end());
+
+    m_tree.DestroyProxy(proxyId);
+}
+
+void Broadphase::MoveProxy(int32 proxyId, const AABB& bounds, const Vec3& displacement)
+{
+    if (m_tree.MoveProxy(proxyId, bounds, displacement))
+        BufferMove(proxyId);
+}
+
+void Broadphase::TouchProxy(int32 proxyId)
+{
+    BufferMove(proxyId);
+}
+
+void Broadphase::BufferMove(int32 proxyId)
+{
+    if (static_cast<size_t>(proxyId) >= m_moveFlags.size())
+        m_moveFlags.resize(static_cast<size_t>(proxyId) + 1, 0);
+
+    if (m_moveFlags[proxyId] == 0)
+    {
+        m_moveFlags[proxyId] = 1;
+        m_moveBuffer.push_back(proxyId);
+    }
+}
+
+void Broadphase::UpdatePairs()
+{
+    m_removedPairs.clear();
+    const size_t pairCountBefore = m_pairs.size();
+
+    // Fat bounds only change on reinsertion, but either side of any pair may have moved
+    size_t writeIndex = 0;
+    for (size_t i = 0; i < m_pairs.size(); ++i)
+    {
+        const BroadphasePair& pair = m_pairs[i];
+        if (m_tree.FatBoundsOverlap(pair.proxyA, pair.proxyB))
+        {
+            m_pairs[writeIndex++] = pair;
+        }
+        else
+        {
+            m_pairKeys.erase(PairKey(pair.proxyA, pair.proxyB));
+            m_removedPairs.push_back(pair);
+        }
+    }
+    m_pairs.resize(writeIndex);
+    const size_t keptPairCount = m_pairs.size();
+
+    size_t movedCount = 0;
+    for (const int32 queryProxy : m_moveBuffer)
+    {
+        if (queryProxy == DynamicAABBTree::NullNode)
+            continue;
+        ++movedCount;
+
+        void* queryUserData = m_tree.GetUserData(queryProxy);
+        m_tree.Query(m_tree.GetFatBounds(queryProxy), [&](int32 otherProxy)
+        {
+            if (otherProxy == queryProxy)
+                return true;
+
+            // When both moved, only the query from the larger id adds the pair
+            if (otherProxy > queryProxy && m_moveFlags[otherProxy] != 0)
+                return true;
+
+            if (m_pairFilter && !m_pairFilter(queryUserData, m_tree.GetUserData(otherProxy)))
+                return true;
+
+            const int32 proxyA = std::min(queryProxy, otherProxy);
+            const int32 proxyB = std::max(queryProxy, otherProxy);
+            if (m_pairKeys.insert(PairKey(proxyA, proxyB)).second)
+            {
+                m_pairs.push_back({proxyA, proxyB, false});
+            }
+            return true;
+        });
+    }
+
+    for (const int32 proxyId : m_moveBuffer)
+    {
+        if (proxyId != DynamicAABBTree::NullNode)
+            m_moveFlags[proxyId] = 0;
+    }
+    m_moveBuffer.clear();
+
+    m_stats.proxyCount = m_tree.GetProxyCount();
+    m_stats.pairCount = m_pairs.size();
+    m_stats.movedProxyCount = movedCount;
+    m_stats.addedPairCount = m_pairs.size() - keptPairCount;
+    m_stats.removedPairCount = pairCountBefore - keptPairCount;
+    m_stats.treeHeight = m_tree.GetHeight();
+}
+
+void Broadphase::Clear()
+{
+    m_tree = DynamicAABBTree();
+    m_moveBuffer.clear();
+    m_moveFlags.clear();
+    m_pairs.clear();
+    m_removedPairs.clear();
+    m_pairKeys.clear();
+    m_stats = Stats{};
+}
+
+} // namespace RVX::Physics
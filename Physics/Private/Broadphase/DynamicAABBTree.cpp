@@ -0,0 +1,426 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * @brief DynamicAABBTree implementation
+ */
+
+#include "Physics/Broadphase/DynamicAABBTree.h"
+#include <algorithm>
+
+namespace RVX::Physics
+{
+
+namespace
+{
+
+float SurfaceArea(const Vec3& min, const Vec3& max)
+{
+    const Vec3 d = max - min;
+    return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+float UnionArea(const Vec3& minA, const Vec3& maxA, const Vec3& minB, const Vec3& maxB)
+{
+    return SurfaceArea(glm::min(minA, minB), glm::max(maxA, maxB));
+}
+
+bool Contains(const Vec3& outerMin, const Vec3& outerMax, const Vec3& innerMin, const Vec3& innerMax)
+{
+    return outerMin.x <= innerMin.x && outerMin.y <= innerMin.y && outerMin.z <= innerMin.z &&
+           innerMax.x <= outerMax.x && innerMax.y <= outerMax.y && innerMax.z <= outerMax.z;
+}
+
+} // namespace
+
+DynamicAABBTree::DynamicAABBTree() = default;
+
+// =========================================================================
+// Proxies
+// =========================================================================
+
+int32 DynamicAABBTree::CreateProxy(const AABB& bounds, void* userData)
+{
+    const int32 proxyId = AllocateNode();
+    Node& node = m_nodes[proxyId];
+    node.min = bounds.GetMin() - Vec3(m_margin);
+    node.max = bounds.GetMax() + Vec3(m_margin);
+    node.userData = userData;
+    node.height = 0;
+
+    InsertLeaf(proxyId);
+    ++m_proxyCount;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32 proxyId)
+{
+    RVX_ASSERT(proxyId >= 0 && proxyId < static_cast<int32>(m_nodes.size()));
+    RVX_ASSERT(m_nodes[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxyCount;
+}
+
+bool DynamicAABBTree::MoveProxy(int32 proxyId, const AABB& bounds, const Vec3& displacement)
+{
+    RVX_ASSERT(proxyId >= 0 && proxyId < static_cast<int32>(m_nodes.size()));
+    Node& node = m_nodes[proxyId];
+    RVX_ASSERT(node.IsLeaf());
+
+    const Vec3 tightMin = bounds.GetMin();
+    const Vec3 tightMax = bounds.GetMax();
+
+    // Predict where the proxy is heading so fast bodies stay in their leaf longer
+    Vec3 fatMin = tightMin - Vec3(m_margin);
+    Vec3 fatMax = tightMax + Vec3(m_margin);
+    const Vec3 stretch = displacement * 2.0f;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (stretch[axis] < 0.0f)
+            fatMin[axis] += stretch[axis];
+        else
+            fatMax[axis] += stretch[axis];
+    }
+
+    if (Contains(node.min, node.max, tightMin, tightMax))
+    {
+        // Still enclosed; keep the leaf unless it has become much larger than needed
+        const Vec3 hugeMin = fatMin - Vec3(4.0f * m_margin);
+        const Vec3 hugeMax = fatMax + Vec3(4.0f * m_margin);
+        if (Contains(hugeMin, hugeMax, node.min, node.max))
+            return false;
+    }
+
+    RemoveLeaf(proxyId);
+    node.min = fatMin;
+    node.max = fatMax;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+// =========================================================================
+// Statistics
+// =========================================================================
+
+float DynamicAABBTree::GetAreaRatio() const
+{
+    if (m_root == NullNode)
+        return 0.0f;
+
+    const float rootArea = SurfaceArea(m_nodes[m_root].min, m_nodes[m_root].max);
+    if (rootArea <= 0.0f)
+        return 0.0f;
+
+    float totalArea = 0.0f;
+    for (const Node& node : m_nodes)
+    {
+        if (node.height >= 0)
+            totalArea += SurfaceArea(node.min, node.max);
+    }
+    return totalArea / rootArea;
+}
+
+bool DynamicAABBTree::Validate() const
+{
+    if (m_root != NullNode && m_nodes[m_root].parent != NullNode)
+        return false;
+
+    if (!ValidateNode(m_root))
+        return false;
+
+    size_t freeCount = 0;
+    for (int32 freeIndex = m_freeList; freeIndex != NullNode; freeIndex = m_nodes[freeIndex].parent)
+    {
+        if (m_nodes[freeIndex].height != -1)
+            return false;
+        ++freeCount;
+    }
+
+    // A tree with n leaves has n - 1 internal nodes
+    const size_t usedCount = m_proxyCount == 0 ? 0 : 2 * m_proxyCount - 1;
+    return usedCount + freeCount == m_nodes.size();
+}
+
+bool DynamicAABBTree::ValidateNode(int32 nodeId) const
+{
+    if (nodeId == NullNode)
+        return true;
+
+    const Node& node = m_nodes[nodeId];
+    if (node.IsLeaf())
+        return node.child2 == NullNode && node.height == 0;
+
+    const Node& child1 = m_nodes[node.child1];
+    const Node& child2 = m_nodes[node.child2];
+    if (child1.parent != nodeId || child2.parent != nodeId)
+        return false;
+
+    if (node.height != 1 + std::max(child1.height, child2.height))
+        return false;
+
+    if (node.min != glm::min(child1.min, child2.min) || node.max != glm::max(child1.max, child2.max))
+        return false;
+
+    return ValidateNode(node.child1) && ValidateNode(node.child2);
+}
+
+// =========================================================================
+// Node Pool
+// =========================================================================
+
+int32 DynamicAABBTree::AllocateNode()
+{
+    if (m_freeList == NullNode)
+    {
+        m_nodes.emplace_back();
+        return static_cast<int32>(m_nodes.size() - 1);
+    }
+
+    const int32 nodeId = m_freeList;
+    m_freeList = m_nodes[nodeId].parent;
+    m_nodes[nodeId] = Node{};
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int32 nodeId)
+{
+    Node& node = m_nodes[nodeId];
+    node = Node{};
+    node.parent = m_freeList;
+    m_freeList = nodeId;
+}
+
+// =========================================================================
+// Tree Maintenance
+// =========================================================================
+
+void DynamicAABBTree::InsertLeaf(int32 leaf)
+{
+    if (m_root == NullNode)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    const Vec3 leafMin = m_nodes[leaf].min;
+    const Vec3 leafMax = m_nodes[leaf].max;
+
+    // Descend towards the sibling that adds the least surface area to the tree
+    int32 index = m_root;
+    while (!m_nodes[index].IsLeaf())
+    {
+        const Node& node = m_nodes[index];
+        const float area = SurfaceArea(node.min, node.max);
+        const float combinedArea = UnionArea(node.min, node.max, leafMin, leafMax);
+
+        // Cost of pairing the leaf with this node under a new parent
+        const float cost = 2.0f * combinedArea;
+
+        // Every ancestor below here grows by the same amount
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32 childId)
+        {
+            const Node& child = m_nodes[childId];
+            const float grownArea = UnionArea(child.min, child.max, leafMin, leafMax);
+            return child.IsLeaf()
+                ? grownArea + inheritanceCost
+                : grownArea - SurfaceArea(child.min, child.max) + inheritanceCost;
+        };
+
+        const float cost1 = childCost(node.child1);
+        const float cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int32 sibling = index;
+    const int32 oldParent = m_nodes[sibling].parent;
+    const int32 newParent = AllocateNode();
+
+    Node& parentNode = m_nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.min = glm::min(leafMin, m_nodes[sibling].min);
+    parentNode.max = glm::max(leafMax, m_nodes[sibling].max);
+    parentNode.height = m_nodes[sibling].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+
+    if (oldParent != NullNode)
+    {
+        if (m_nodes[oldParent].child1 == sibling)
+            m_nodes[oldParent].child1 = newParent;
+        else
+            m_nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    RefitAncestors(newParent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int32 leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = NullNode;
+        return;
+    }
+
+    const int32 parent = m_nodes[leaf].parent;
+    const int32 grandParent = m_nodes[parent].parent;
+    const int32 sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    FreeNode(parent);
+    m_nodes[leaf].parent = NullNode;
+
+    if (grandParent == NullNode)
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = NullNode;
+        return;
+    }
+
+    // Splice the sibling into the grandparent and shrink the ancestors
+    if (m_nodes[grandParent].child1 == parent)
+        m_nodes[grandParent].child1 = sibling;
+    else
+        m_nodes[grandParent].child2 = sibling;
+    m_nodes[sibling].parent = grandParent;
+
+    RefitAncestors(grandParent);
+}
+
+void DynamicAABBTree::RefitAncestors(int32 nodeId)
+{
+    int32 index = nodeId;
+    while (index != NullNode)
+    {
+        index = Balance(index);
+
+        Node& node = m_nodes[index];
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.min = glm::min(child1.min, child2.min);
+        node.max = glm::max(child1.max, child2.max);
+
+        index = node.parent;
+    }
+}
+
+int32 DynamicAABBTree::Balance(int32 iA)
+{
+    Node& A = m_nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+        return iA;
+
+    const int32 iB = A.child1;
+    const int32 iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+
+    const int32 balance = C.height - B.height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        const int32 iF = C.child1;
+        const int32 iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != NullNode)
+        {
+            if (m_nodes[C.parent].child1 == iA)
+                m_nodes[C.parent].child1 = iC;
+            else
+                m_nodes[C.parent].child2 = iC;
+        }
+        else
+        {
+            m_root = iC;
+        }
+
+        // The taller grandchild stays under C, the shorter one moves to A
+        const int32 iKeep = F.height > G.height ? iF : iG;
+        const int32 iMove = F.height > G.height ? iG : iF;
+        Node& keep = m_nodes[iKeep];
+        Node& move = m_nodes[iMove];
+
+        C.child2 = iKeep;
+        A.child2 = iMove;
+        move.parent = iA;
+
+        A.min = glm::min(B.min, move.min);
+        A.max = glm::max(B.max, move.max);
+        A.height = 1 + std::max(B.height, move.height);
+
+        C.min = glm::min(A.min, keep.min);
+        C.max = glm::max(A.max, keep.max);
+        C.height = 1 + std::max(A.height, keep.height);
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        const int32 iD = B.child1;
+        const int32 iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != NullNode)
+        {
+            if (m_nodes[B.parent].child1 == iA)
+                m_nodes[B.parent].child1 = iB;
+            else
+                m_nodes[B.parent].child2 = iB;
+        }
+        else
+        {
+            m_root = iB;
+        }
+
+        const int32 iKeep = D.height > E.height ? iD : iE;
+        const int32 iMove = D.height > E.height ? iE : iD;
+        Node& keep = m_nodes[iKeep];
+        Node& move = m_nodes[iMove];
+
+        B.child2 = iKeep;
+        A.child1 = iMove;
+        move.parent = iA;
+
+        A.min = glm::min(C.min, move.min);
+        A.max = glm::max(C.max, move.max);
+        A.height = 1 + std::max(C.height, move.height);
+
+        B.min = glm::min(A.min, keep.min);
+        B.max = glm::max(A.max, keep.max);
+        B.height = 1 + std::max(A.height, keep.height);
+
+        return iB;
+    }
+
+    return iA;
+}
+
+} // namespace RVX::Physics
@@ -3,356 +3,634 @@
  * @brief Built-in collision detection using Geometry module algorithms
  */
 
-#include "Physics/PhysicsTypes.h"
-#include "Physics/RigidBody.h"
+#include "CollisionDetection.h"
 #include "Physics/Shapes/CollisionShape.h"
-#include <vector>
+#include "Geometry/Collision/EPA.h"
+#include "Geometry/Collision/GJK.h"
+#include "Geometry/Collision/SAT.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace RVX::Physics
 {
 
-/**
- * @brief Collision pair for broadphase
- */
-struct CollisionPair
+namespace
 {
-    RigidBody* bodyA = nullptr;
-    RigidBody* bodyB = nullptr;
-};
+
+void CapsuleSegment(const CapsuleShape& capsule, const Vec3& position, const Quat& rotation,
+                    Vec3& outA, Vec3& outB)
+{
+    const Vec3 axis = rotation * Vec3(0, capsule.GetHalfHeight(), 0);
+    outA = position - axis;
+    outB = position + axis;
+}
+
+void FlipResult(CollisionResult& result)
+{
+    result.normal = -result.normal;
+    std::swap(result.pointA, result.pointB);
+}
 
 /**
- * @brief Detailed collision result
+ * @brief Box corners that are deepest along a direction: a vertex, an edge or a face
  */
-struct CollisionResult
+struct SupportFeature
 {
-    bool colliding = false;
-    Vec3 normal{0, 1, 0};       // From A to B
-    float depth = 0.0f;
-    Vec3 pointA{0};
-    Vec3 pointB{0};
-    RigidBody* bodyA = nullptr;
-    RigidBody* bodyB = nullptr;
+    Vec3 centroid{0.0f};
+    int vertexCount = 0;
+    float spread = 0.0f;        // Sum of squared distances to the centroid
 };
 
-/**
- * @brief Built-in collision detection system
- * 
- * Uses algorithms from Geometry module:
- * - GJK for intersection testing
- * - EPA for penetration depth
- * - SAT for OBB-OBB (optimized)
- */
-class CollisionDetection
+SupportFeature BoxSupportFeature(const Geometry::OBB& box, const Vec3& direction)
 {
-public:
-    // =========================================================================
-    // Broadphase
-    // =========================================================================
-
-    /**
-     * @brief Simple AABB overlap test for broadphase
-     */
-    static bool AABBOverlap(const Vec3& minA, const Vec3& maxA,
-                            const Vec3& minB, const Vec3& maxB)
+    const Vec3 axes[3] = {box.orientation * Vec3(1, 0, 0), box.orientation * Vec3(0, 1, 0), box.orientation * Vec3(0, 0, 1)};
+    Vec3 corners[8];
+    float depths[8];
+    float maxDepth = std::numeric_limits<float>::lowest();
+    for (int i = 0; i < 8; ++i)
     {
-        return (minA.x <= maxB.x && maxA.x >= minB.x) &&
-               (minA.y <= maxB.y && maxA.y >= minB.y) &&
-               (minA.z <= maxB.z && maxA.z >= minB.z);
+        corners[i] = box.center +
+                     axes[0] * ((i & 1) ? box.halfExtents.x : -box.halfExtents.x) +
+                     axes[1] * ((i & 2) ? box.halfExtents.y : -box.halfExtents.y) +
+                     axes[2] * ((i & 4) ? box.halfExtents.z : -box.halfExtents.z);
+        depths[i] = dot(corners[i], direction);
+        maxDepth = std::max(maxDepth, depths[i]);
     }
 
-    /**
-     * @brief Get world-space AABB for a body
-     */
-    static void GetBodyAABB(const RigidBody& body, Vec3& outMin, Vec3& outMax)
+    // Nearly level corners belong to the same feature
+    const float tolerance = 0.01f * (box.halfExtents.x + box.halfExtents.y + box.halfExtents.z) + 1e-4f;
+
+    SupportFeature feature;
+    for (int i = 0; i < 8; ++i)
     {
-        // Start with zero AABB at position
-        outMin = outMax = body.GetPosition();
-
-        // Expand by shape bounds (simplified - uses bounding radius)
-        // A full implementation would transform each shape's local AABB
-        float radius = 1.0f;  // Default radius
-        
-        // Would iterate over body shapes here
-        // For now, use a conservative estimate
-
-        outMin -= Vec3(radius);
-        outMax += Vec3(radius);
+        if (depths[i] >= maxDepth - tolerance)
+        {
+            feature.centroid += corners[i];
+            ++feature.vertexCount;
+        }
     }
+    feature.centroid /= static_cast<float>(feature.vertexCount);
 
-    /**
-     * @brief Brute-force broadphase (O(n^2))
-     */
-    static void BroadphaseNaive(const std::vector<RigidBody*>& bodies,
-                                std::vector<CollisionPair>& outPairs)
+    for (int i = 0; i < 8; ++i)
     {
-        outPairs.clear();
-
-        for (size_t i = 0; i < bodies.size(); ++i)
+        if (depths[i] >= maxDepth - tolerance)
         {
-            for (size_t j = i + 1; j < bodies.size(); ++j)
-            {
-                RigidBody* a = bodies[i];
-                RigidBody* b = bodies[j];
-
-                // Skip if both static
-                if (a->IsStatic() && b->IsStatic())
-                    continue;
-
-                // Skip if both sleeping
-                if (a->IsSleeping() && b->IsSleeping())
-                    continue;
-
-                // AABB test
-                Vec3 minA, maxA, minB, maxB;
-                GetBodyAABB(*a, minA, maxA);
-                GetBodyAABB(*b, minB, maxB);
-
-                if (AABBOverlap(minA, maxA, minB, maxB))
-                {
-                    outPairs.push_back({a, b});
-                }
-            }
+            const Vec3 offset = corners[i] - feature.centroid;
+            feature.spread += dot(offset, offset);
         }
     }
+    return feature;
+}
 
-    // =========================================================================
-    // Narrowphase - Primitive Tests
-    // =========================================================================
+/**
+ * @brief Place a single box-box contact on the smaller of the two touching features
+ *
+ * A box resting on a larger box gets its contact under its own face center,
+ * so the contact impulse does not tip it over.
+ */
+void BoxBoxContactPoints(const Geometry::OBB& boxA, const Geometry::OBB& boxB,
+                         const Vec3& normal, float depth, CollisionResult& result)
+{
+    const SupportFeature featureA = BoxSupportFeature(boxA, normal);
+    const SupportFeature featureB = BoxSupportFeature(boxB, -normal);
+
+    const bool useA = featureA.vertexCount != featureB.vertexCount
+        ? featureA.vertexCount < featureB.vertexCount
+        : featureA.spread < featureB.spread;
 
-    /**
-     * @brief Sphere vs Sphere collision
-     */
-    static bool SphereSphere(const Vec3& centerA, float radiusA,
-                             const Vec3& centerB, float radiusB,
-                             CollisionResult& result)
+    if (useA)
     {
-        Vec3 diff = centerB - centerA;
-        float distSq = dot(diff, diff);
-        float radiusSum = radiusA + radiusB;
+        result.pointA = featureA.centroid;
+        result.pointB = featureA.centroid - normal * depth;
+    }
+    else
+    {
+        result.pointB = featureB.centroid;
+        result.pointA = featureB.centroid + normal * depth;
+    }
+}
 
-        if (distSq > radiusSum * radiusSum)
-        {
-            result.colliding = false;
-            return false;
-        }
+bool CollideConvex(const CollisionShape& shapeA, const Vec3& positionA, const Quat& rotationA,
+                   const CollisionShape& shapeB, const Vec3& positionB, const Quat& rotationB,
+                   CollisionResult& result)
+{
+    const WorldConvexShape a(shapeA, positionA, rotationA);
+    const WorldConvexShape b(shapeB, positionB, rotationB);
 
-        float dist = std::sqrt(distSq);
-        
-        result.colliding = true;
-        result.normal = dist > 0.0001f ? diff / dist : Vec3(0, 1, 0);
-        result.depth = radiusSum - dist;
-        result.pointA = centerA + result.normal * radiusA;
-        result.pointB = centerB - result.normal * radiusB;
+    Geometry::Simplex simplex;
+    const Geometry::GJKResult gjk = Geometry::GJK::Query(a, b, 32, &simplex);
+    if (!gjk.intersecting)
+    {
+        result.colliding = false;
+        return false;
+    }
 
-        return true;
+    const Geometry::EPAResult epa = Geometry::EPA::Query(a, b, simplex);
+    if (!epa.valid)
+    {
+        // Grazing contact without a measurable depth
+        result.colliding = false;
+        return false;
+    }
+
+    result.colliding = true;
+    result.normal = epa.normal;
+    result.depth = epa.depth;
+
+    // EPA's barycentric points drift on large flat faces such as the ground, so anchor
+    // the contact on the deepest point of the smaller shape instead
+    if (shapeA.GetBoundingRadius() <= shapeB.GetBoundingRadius())
+    {
+        result.pointA = a.Support(epa.normal);
+        result.pointB = result.pointA - epa.normal * epa.depth;
+    }
+    else
+    {
+        result.pointB = b.Support(-epa.normal);
+        result.pointA = result.pointB + epa.normal * epa.depth;
+    }
+    return true;
+}
+
+/// Box vs sphere via SAT; false with `resolved` unset when the sphere center is inside the box
+bool CollideBoxSphere(const BoxShape& box, const Vec3& boxPosition, const Quat& boxRotation,
+                      const SphereShape& sphere, const Vec3& sphereCenter,
+                      CollisionResult& result, bool& resolved)
+{
+    const Geometry::OBB obb(boxPosition, box.GetHalfExtents(), boxRotation);
+
+    Geometry::ContactManifold manifold;
+    resolved = true;
+    if (!Geometry::SATTestOBBSphere(obb, sphereCenter, sphere.GetRadius(), &manifold))
+    {
+        result.colliding = false;
+        return false;
+    }
+
+    // The closest point degenerates to the center itself, which gives no usable normal
+    const Geometry::ContactPoint& contact = manifold.contacts[0];
+    if (contact.depth >= sphere.GetRadius() - 1e-6f)
+    {
+        resolved = false;
+        return false;
     }
 
-    /**
-     * @brief Sphere vs Capsule collision
-     */
-    static bool SphereCapsule(const Vec3& sphereCenter, float sphereRadius,
-                              const Vec3& capsuleA, const Vec3& capsuleB, float capsuleRadius,
-                              CollisionResult& result)
+    result.colliding = true;
+    result.normal = manifold.normal;
+    result.depth = contact.depth;
+    result.pointA = contact.pointA;
+    result.pointB = contact.pointB;
+    return true;
+}
+
+} // namespace
+
+Vec3 WorldConvexShape::LocalSupport(const Vec3& d) const
+{
+    auto sign = [](float value) { return value < 0.0f ? -1.0f : 1.0f; };
+    auto direction = [](const Vec3& v)
     {
-        // Find closest point on capsule segment to sphere center
-        Vec3 ab = capsuleB - capsuleA;
-        float t = dot(sphereCenter - capsuleA, ab);
-        float denom = dot(ab, ab);
-        
-        if (denom > 0.0001f)
+        const float len = length(v);
+        return len > 1e-8f ? v / len : Vec3(1, 0, 0);
+    };
+
+    switch (m_shape.GetType())
+    {
+        case ShapeType::Sphere:
+            return direction(d) * static_cast<const SphereShape&>(m_shape).GetRadius();
+
+        case ShapeType::Box:
         {
-            t = std::clamp(t / denom, 0.0f, 1.0f);
+            const Vec3& he = static_cast<const BoxShape&>(m_shape).GetHalfExtents();
+            return Vec3(sign(d.x) * he.x, sign(d.y) * he.y, sign(d.z) * he.z);
         }
-        else
+
+        case ShapeType::Capsule:
         {
-            t = 0.0f;
+            const auto& capsule = static_cast<const CapsuleShape&>(m_shape);
+            return Vec3(0, sign(d.y) * capsule.GetHalfHeight(), 0) + direction(d) * capsule.GetRadius();
         }
 
-        Vec3 closestOnCapsule = capsuleA + ab * t;
+        case ShapeType::Cylinder:
+        {
+            const auto& cylinder = static_cast<const CylinderShape&>(m_shape);
+            const Vec3 radial(d.x, 0.0f, d.z);
+            const float radialLen = length(radial);
+            const Vec3 rim = radialLen > 1e-8f ? radial * (cylinder.GetRadius() / radialLen) : Vec3(0.0f);
+            return rim + Vec3(0, sign(d.y) * cylinder.GetHalfHeight(), 0);
+        }
+
+        case ShapeType::ConvexHull:
+            return static_cast<const ConvexHullShape&>(m_shape).Support(d);
 
-        // Now it's a sphere-sphere test
-        return SphereSphere(sphereCenter, sphereRadius,
-                           closestOnCapsule, capsuleRadius, result);
+        default:
+            return Vec3(0.0f);
     }
+}
 
-    /**
-     * @brief Sphere vs Box (AABB) collision
-     */
-    static bool SphereBox(const Vec3& sphereCenter, float sphereRadius,
-                          const Vec3& boxCenter, const Vec3& boxHalfExtents,
-                          CollisionResult& result)
-    {
-        // Clamp sphere center to box
-        Vec3 boxMin = boxCenter - boxHalfExtents;
-        Vec3 boxMax = boxCenter + boxHalfExtents;
+// =========================================================================
+// Broadphase
+// =========================================================================
 
-        Vec3 closest;
-        closest.x = std::clamp(sphereCenter.x, boxMin.x, boxMax.x);
-        closest.y = std::clamp(sphereCenter.y, boxMin.y, boxMax.y);
-        closest.z = std::clamp(sphereCenter.z, boxMin.z, boxMax.z);
+void CollisionDetection::GetBodyAABB(const RigidBody& body, Vec3& outMin, Vec3& outMax)
+{
+    const RigidBody::AABB bounds = body.GetAABB();
+    outMin = bounds.min;
+    outMax = bounds.max;
+}
 
-        Vec3 diff = sphereCenter - closest;
-        float distSq = dot(diff, diff);
+void CollisionDetection::BroadphaseNaive(const std::vector<RigidBody*>& bodies,
+                                         std::vector<CollisionPair>& outPairs)
+{
+    outPairs.clear();
 
-        if (distSq > sphereRadius * sphereRadius)
+    for (size_t i = 0; i < bodies.size(); ++i)
+    {
+        for (size_t j = i + 1; j < bodies.size(); ++j)
         {
-            result.colliding = false;
+            RigidBody* a = bodies[i];
+            RigidBody* b = bodies[j];
+
+            // Skip if both static
+            if (a->IsStatic() && b->IsStatic())
+                continue;
+
+            // Skip if both sleeping
+            if (a->IsSleeping() && b->IsSleeping())
+                continue;
+
+            // AABB test
+            Vec3 minA, maxA, minB, maxB;
+            GetBodyAABB(*a, minA, maxA);
+            GetBodyAABB(*b, minB, maxB);
+
+            if (AABBOverlap(minA, maxA, minB, maxB))
+            {
+                outPairs.push_back({a, b});
+            }
+        }
+    }
+}
+
+// =========================================================================
+// Narrowphase - Dispatch
+// =========================================================================
+
+bool CollisionDetection::IsSupported(const CollisionShape& shape)
+{
+    switch (shape.GetType())
+    {
+        case ShapeType::Sphere:
+        case ShapeType::Box:
+        case ShapeType::Capsule:
+        case ShapeType::Cylinder:
+        case ShapeType::ConvexHull:
+            return true;
+        default:
             return false;
+    }
+}
+
+bool CollisionDetection::CollideBodies(RigidBody& bodyA, RigidBody& bodyB, CollisionResult& result)
+{
+    result = CollisionResult{};
+
+    for (const RigidBody::ShapeInstance& instanceA : bodyA.GetShapes())
+    {
+        if (!instanceA.shape || !IsSupported(*instanceA.shape))
+            continue;
+
+        const Vec3 positionA = bodyA.GetPosition() + bodyA.GetRotation() * instanceA.offset;
+        const Quat rotationA = bodyA.GetRotation() * instanceA.rotation;
+
+        for (const RigidBody::ShapeInstance& instanceB : bodyB.GetShapes())
+        {
+            if (!instanceB.shape || !IsSupported(*instanceB.shape))
+                continue;
+
+            const Vec3 positionB = bodyB.GetPosition() + bodyB.GetRotation() * instanceB.offset;
+            const Quat rotationB = bodyB.GetRotation() * instanceB.rotation;
+
+            CollisionResult shapeResult;
+            if (CollideShapes(*instanceA.shape, positionA, rotationA,
+                              *instanceB.shape, positionB, rotationB, shapeResult) &&
+                (!result.colliding || shapeResult.depth > result.depth))
+            {
+                result = shapeResult;
+                result.shapeA = instanceA.shape.get();
+                result.shapeB = instanceB.shape.get();
+            }
         }
+    }
 
-        float dist = std::sqrt(distSq);
+    result.bodyA = &bodyA;
+    result.bodyB = &bodyB;
+    return result.colliding;
+}
 
-        result.colliding = true;
-        result.normal = dist > 0.0001f ? diff / dist : Vec3(0, 1, 0);
-        result.depth = sphereRadius - dist;
-        result.pointA = closest;
-        result.pointB = sphereCenter - result.normal * sphereRadius;
+bool CollisionDetection::CollideShapes(const CollisionShape& shapeA, const Vec3& positionA, const Quat& rotationA,
+                                       const CollisionShape& shapeB, const Vec3& positionB, const Quat& rotationB,
+                                       CollisionResult& result)
+{
+    result.colliding = false;
+
+    const ShapeType typeA = shapeA.GetType();
+    const ShapeType typeB = shapeB.GetType();
+
+    if (typeA == ShapeType::Sphere && typeB == ShapeType::Sphere)
+    {
+        return SphereSphere(positionA, static_cast<const SphereShape&>(shapeA).GetRadius(),
+                            positionB, static_cast<const SphereShape&>(shapeB).GetRadius(), result);
+    }
 
+    if (typeA == ShapeType::Sphere && typeB == ShapeType::Capsule)
+    {
+        const auto& capsule = static_cast<const CapsuleShape&>(shapeB);
+        Vec3 segA, segB;
+        CapsuleSegment(capsule, positionB, rotationB, segA, segB);
+        return SphereCapsule(positionA, static_cast<const SphereShape&>(shapeA).GetRadius(),
+                             segA, segB, capsule.GetRadius(), result);
+    }
+
+    if (typeA == ShapeType::Capsule && typeB == ShapeType::Sphere)
+    {
+        if (!CollideShapes(shapeB, positionB, rotationB, shapeA, positionA, rotationA, result))
+            return false;
+        FlipResult(result);
         return true;
     }
 
-    /**
-     * @brief Capsule vs Capsule collision
-     */
-    static bool CapsuleCapsule(const Vec3& a1, const Vec3& a2, float radiusA,
-                               const Vec3& b1, const Vec3& b2, float radiusB,
-                               CollisionResult& result)
+    if (typeA == ShapeType::Capsule && typeB == ShapeType::Capsule)
     {
-        // Find closest points between two line segments
-        Vec3 d1 = a2 - a1;
-        Vec3 d2 = b2 - b1;
-        Vec3 r = a1 - b1;
+        const auto& capsuleA = static_cast<const CapsuleShape&>(shapeA);
+        const auto& capsuleB = static_cast<const CapsuleShape&>(shapeB);
+        Vec3 a1, a2, b1, b2;
+        CapsuleSegment(capsuleA, positionA, rotationA, a1, a2);
+        CapsuleSegment(capsuleB, positionB, rotationB, b1, b2);
+        return CapsuleCapsule(a1, a2, capsuleA.GetRadius(), b1, b2, capsuleB.GetRadius(), result);
+    }
 
-        float a = dot(d1, d1);
-        float e = dot(d2, d2);
-        float f = dot(d2, r);
+    if (typeA == ShapeType::Box && typeB == ShapeType::Box)
+    {
+        const Geometry::OBB obbA(positionA, static_cast<const BoxShape&>(shapeA).GetHalfExtents(), rotationA);
+        const Geometry::OBB obbB(positionB, static_cast<const BoxShape&>(shapeB).GetHalfExtents(), rotationB);
 
-        float s = 0.0f, t = 0.0f;
+        Geometry::ContactManifold manifold;
+        if (!Geometry::SATTestOBB(obbA, obbB, &manifold))
+            return false;
 
-        if (a <= 0.0001f && e <= 0.0001f)
+        result.colliding = true;
+        result.normal = manifold.normal;
+        result.depth = manifold.contacts[0].depth;
+        BoxBoxContactPoints(obbA, obbB, result.normal, result.depth, result);
+        return true;
+    }
+
+    if (typeA == ShapeType::Box && typeB == ShapeType::Sphere)
+    {
+        bool resolved = false;
+        const bool hit = CollideBoxSphere(static_cast<const BoxShape&>(shapeA), positionA, rotationA,
+                                          static_cast<const SphereShape&>(shapeB), positionB, result, resolved);
+        if (resolved)
+            return hit;
+    }
+
+    if (typeA == ShapeType::Sphere && typeB == ShapeType::Box)
+    {
+        bool resolved = false;
+        const bool hit = CollideBoxSphere(static_cast<const BoxShape&>(shapeB), positionB, rotationB,
+                                          static_cast<const SphereShape&>(shapeA), positionA, result, resolved);
+        if (resolved)
         {
-            // Both segments are points
-            s = t = 0.0f;
+            if (hit)
+                FlipResult(result);
+            return hit;
         }
-        else if (a <= 0.0001f)
+    }
+
+    // Everything else, and deep box/sphere overlaps, go through GJK + EPA
+    return CollideConvex(shapeA, positionA, rotationA, shapeB, positionB, rotationB, result);
+}
+
+// =========================================================================
+// Narrowphase - Primitive Tests
+// =========================================================================
+
+bool CollisionDetection::SphereSphere(const Vec3& centerA, float radiusA,
+                                      const Vec3& centerB, float radiusB,
+                                      CollisionResult& result)
+{
+    Vec3 diff = centerB - centerA;
+    float distSq = dot(diff, diff);
+    float radiusSum = radiusA + radiusB;
+
+    if (distSq > radiusSum * radiusSum)
+    {
+        result.colliding = false;
+        return false;
+    }
+
+    float dist = std::sqrt(distSq);
+    
+    result.colliding = true;
+    result.normal = dist > 0.0001f ? diff / dist : Vec3(0, 1, 0);
+    result.depth = radiusSum - dist;
+    result.pointA = centerA + result.normal * radiusA;
+    result.pointB = centerB - result.normal * radiusB;
+
+    return true;
+}
+
+bool CollisionDetection::SphereCapsule(const Vec3& sphereCenter, float sphereRadius,
+                                       const Vec3& capsuleA, const Vec3& capsuleB, float capsuleRadius,
+                                       CollisionResult& result)
+{
+    // Find closest point on capsule segment to sphere center
+    Vec3 ab = capsuleB - capsuleA;
+    float t = dot(sphereCenter - capsuleA, ab);
+    float denom = dot(ab, ab);
+    
+    if (denom > 0.0001f)
+    {
+        t = std::clamp(t / denom, 0.0f, 1.0f);
+    }
+    else
+    {
+        t = 0.0f;
+    }
+
+    Vec3 closestOnCapsule = capsuleA + ab * t;
+
+    // Now it's a sphere-sphere test
+    return SphereSphere(sphereCenter, sphereRadius,
+                       closestOnCapsule, capsuleRadius, result);
+}
+
+bool CollisionDetection::SphereBox(const Vec3& sphereCenter, float sphereRadius,
+                                   const Vec3& boxCenter, const Vec3& boxHalfExtents,
+                                   CollisionResult& result)
+{
+    // Clamp sphere center to box
+    Vec3 boxMin = boxCenter - boxHalfExtents;
+    Vec3 boxMax = boxCenter + boxHalfExtents;
+
+    Vec3 closest;
+    closest.x = std::clamp(sphereCenter.x, boxMin.x, boxMax.x);
+    closest.y = std::clamp(sphereCenter.y, boxMin.y, boxMax.y);
+    closest.z = std::clamp(sphereCenter.z, boxMin.z, boxMax.z);
+
+    Vec3 diff = sphereCenter - closest;
+    float distSq = dot(diff, diff);
+
+    if (distSq > sphereRadius * sphereRadius)
+    {
+        result.colliding = false;
+        return false;
+    }
+
+    float dist = std::sqrt(distSq);
+
+    result.colliding = true;
+    result.normal = dist > 0.0001f ? diff / dist : Vec3(0, 1, 0);
+    result.depth = sphereRadius - dist;
+    result.pointA = closest;
+    result.pointB = sphereCenter - result.normal * sphereRadius;
+
+    return true;
+}
+
+bool CollisionDetection::CapsuleCapsule(const Vec3& a1, const Vec3& a2, float radiusA,
+                                        const Vec3& b1, const Vec3& b2, float radiusB,
+                                        CollisionResult& result)
+{
+    // Find closest points between two line segments
+    Vec3 d1 = a2 - a1;
+    Vec3 d2 = b2 - b1;
+    Vec3 r = a1 - b1;
+
+    float a = dot(d1, d1);
+    float e = dot(d2, d2);
+    float f = dot(d2, r);
+
+    float s = 0.0f, t = 0.0f;
+
+    if (a <= 0.0001f && e <= 0.0001f)
+    {
+        // Both segments are points
+        s = t = 0.0f;
+    }
+    else if (a <= 0.0001f)
+    {
+        // First segment is a point
+        s = 0.0f;
+        t = std::clamp(f / e, 0.0f, 1.0f);
+    }
+    else
+    {
+        float c = dot(d1, r);
+        if (e <= 0.0001f)
         {
-            // First segment is a point
-            s = 0.0f;
-            t = std::clamp(f / e, 0.0f, 1.0f);
+            // Second segment is a point
+            t = 0.0f;
+            s = std::clamp(-c / a, 0.0f, 1.0f);
         }
         else
         {
-            float c = dot(d1, r);
-            if (e <= 0.0001f)
+            float b = dot(d1, d2);
+            float denom = a * e - b * b;
+
+            if (denom != 0.0f)
+            {
+                s = std::clamp((b * f - c * e) / denom, 0.0f, 1.0f);
+            }
+            else
+            {
+                s = 0.0f;
+            }
+
+            t = (b * s + f) / e;
+
+            if (t < 0.0f)
             {
-                // Second segment is a point
                 t = 0.0f;
                 s = std::clamp(-c / a, 0.0f, 1.0f);
             }
-            else
+            else if (t > 1.0f)
             {
-                float b = dot(d1, d2);
-                float denom = a * e - b * b;
-
-                if (denom != 0.0f)
-                {
-                    s = std::clamp((b * f - c * e) / denom, 0.0f, 1.0f);
-                }
-                else
-                {
-                    s = 0.0f;
-                }
-
-                t = (b * s + f) / e;
-
-                if (t < 0.0f)
-                {
-                    t = 0.0f;
-                    s = std::clamp(-c / a, 0.0f, 1.0f);
-                }
-                else if (t > 1.0f)
-                {
-                    t = 1.0f;
-                    s = std::clamp((b - c) / a, 0.0f, 1.0f);
-                }
+                t = 1.0f;
+                s = std::clamp((b - c) / a, 0.0f, 1.0f);
             }
         }
+    }
 
-        Vec3 closestA = a1 + d1 * s;
-        Vec3 closestB = b1 + d2 * t;
+    Vec3 closestA = a1 + d1 * s;
+    Vec3 closestB = b1 + d2 * t;
 
-        return SphereSphere(closestA, radiusA, closestB, radiusB, result);
-    }
+    return SphereSphere(closestA, radiusA, closestB, radiusB, result);
+}
 
-    // =========================================================================
-    // Raycast
-    // =========================================================================
+// =========================================================================
+// Raycast
+// =========================================================================
 
-    /**
-     * @brief Ray vs Sphere intersection
-     */
-    static bool RaySphere(const Vec3& origin, const Vec3& direction, float maxDist,
-                          const Vec3& center, float radius,
-                          float& outT, Vec3& outPoint, Vec3& outNormal)
-    {
-        Vec3 oc = origin - center;
-        float a = dot(direction, direction);
-        float b = 2.0f * dot(oc, direction);
-        float c = dot(oc, oc) - radius * radius;
-        float discriminant = b * b - 4.0f * a * c;
+bool CollisionDetection::RaySphere(const Vec3& origin, const Vec3& direction, float maxDist,
+                                   const Vec3& center, float radius,
+                                   float& outT, Vec3& outPoint, Vec3& outNormal)
+{
+    Vec3 oc = origin - center;
+    float a = dot(direction, direction);
+    float b = 2.0f * dot(oc, direction);
+    float c = dot(oc, oc) - radius * radius;
+    float discriminant = b * b - 4.0f * a * c;
 
-        if (discriminant < 0)
-            return false;
+    if (discriminant < 0)
+        return false;
 
-        float sqrtD = std::sqrt(discriminant);
-        float t = (-b - sqrtD) / (2.0f * a);
+    float sqrtD = std::sqrt(discriminant);
+    float t = (-b - sqrtD) / (2.0f * a);
 
-        if (t < 0)
-            t = (-b + sqrtD) / (2.0f * a);
+    if (t < 0)
+        t = (-b + sqrtD) / (2.0f * a);
 
-        if (t < 0 || t > maxDist)
-            return false;
+    if (t < 0 || t > maxDist)
+        return false;
 
-        outT = t;
-        outPoint = origin + direction * t;
-        outNormal = normalize(outPoint - center);
+    outT = t;
+    outPoint = origin + direction * t;
+    outNormal = normalize(outPoint - center);
 
-        return true;
-    }
+    return true;
+}
 
-    /**
-     * @brief Ray vs AABB intersection
-     */
-    static bool RayAABB(const Vec3& origin, const Vec3& direction, float maxDist,
-                        const Vec3& minBounds, const Vec3& maxBounds,
-                        float& outT, Vec3& outNormal)
-    {
-        Vec3 invDir = Vec3(1.0f) / direction;
-        Vec3 t0 = (minBounds - origin) * invDir;
-        Vec3 t1 = (maxBounds - origin) * invDir;
+bool CollisionDetection::RayAABB(const Vec3& origin, const Vec3& direction, float maxDist,
+                                 const Vec3& minBounds, const Vec3& maxBounds,
+                                 float& outT, Vec3& outNormal)
+{
+    Vec3 invDir = Vec3(1.0f) / direction;
+    Vec3 t0 = (minBounds - origin) * invDir;
+    Vec3 t1 = (maxBounds - origin) * invDir;
 
-        Vec3 tmin = glm::min(t0, t1);
-        Vec3 tmax = glm::max(t0, t1);
+    Vec3 tmin = glm::min(t0, t1);
+    Vec3 tmax = glm::max(t0, t1);
 
-        float tNear = std::max(std::max(tmin.x, tmin.y), tmin.z);
-        float tFar = std::min(std::min(tmax.x, tmax.y), tmax.z);
+    float tNear = std::max(std::max(tmin.x, tmin.y), tmin.z);
+    float tFar = std::min(std::min(tmax.x, tmax.y), tmax.z);
 
-        if (tNear > tFar || tFar < 0 || tNear > maxDist)
-            return false;
+    if (tNear > tFar || tFar < 0 || tNear > maxDist)
+        return false;
 
-        outT = tNear >= 0 ? tNear : tFar;
+    outT = tNear >= 0 ? tNear : tFar;
 
-        // Determine hit normal
-        if (tmin.x >= tmin.y && tmin.x >= tmin.z)
-            outNormal = Vec3(direction.x < 0 ? 1.0f : -1.0f, 0, 0);
-        else if (tmin.y >= tmin.x && tmin.y >= tmin.z)
-            outNormal = Vec3(0, direction.y < 0 ? 1.0f : -1.0f, 0);
-        else
-            outNormal = Vec3(0, 0, direction.z < 0 ? 1.0f : -1.0f);
+    // Determine hit normal
+    if (tmin.x >= tmin.y && tmin.x >= tmin.z)
+        outNormal = Vec3(direction.x < 0 ? 1.0f : -1.0f, 0, 0);
+    else if (tmin.y >= tmin.x && tmin.y >= tmin.z)
+        outNormal = Vec3(0, direction.y < 0 ? 1.0f : -1.0f, 0);
+    else
+        outNormal = Vec3(0, 0, direction.z < 0 ? 1.0f : -1.0f);
 
-        return true;
-    }
-};
+    return true;
+}
 
 } // namespace RVX::Physics
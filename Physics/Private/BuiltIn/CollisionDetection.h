@@ -0,0 +1,181 @@
+/**
+ * @file CollisionDetection.h
+ * @brief Built-in collision detection using Geometry module algorithms
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Physics/RigidBody.h"
+#include "Geometry/Collision/IConvexShape.h"
+#include <vector>
+
+namespace RVX::Physics
+{
+
+class CollisionShape;
+
+/**
+ * @brief Support mapping of a convex shape placed in the world, for GJK/EPA
+ *
+ * Spheres, boxes, capsules, cylinders and convex hulls have a support
+ * mapping; other shapes map every direction to their origin.
+ */
+class WorldConvexShape final : public Geometry::IConvexShape
+{
+public:
+    WorldConvexShape(const CollisionShape& shape, const Vec3& position, const Quat& rotation)
+        : m_shape(shape), m_position(position), m_rotation(rotation) {}
+
+    Vec3 Support(const Vec3& direction) const override
+    {
+        const Vec3 localDir = glm::conjugate(m_rotation) * direction;
+        return m_position + m_rotation * LocalSupport(localDir);
+    }
+
+    Vec3 GetCenter() const override { return m_position; }
+
+private:
+    Vec3 LocalSupport(const Vec3& direction) const;
+
+    const CollisionShape& m_shape;
+    Vec3 m_position;
+    Quat m_rotation;
+};
+
+/**
+ * @brief Collision pair for broadphase
+ */
+struct CollisionPair
+{
+    RigidBody* bodyA = nullptr;
+    RigidBody* bodyB = nullptr;
+};
+
+/**
+ * @brief Detailed collision result
+ */
+struct CollisionResult
+{
+    bool colliding = false;
+    Vec3 normal{0, 1, 0};       // From A to B
+    float depth = 0.0f;
+    Vec3 pointA{0};
+    Vec3 pointB{0};
+    RigidBody* bodyA = nullptr;
+    RigidBody* bodyB = nullptr;
+    const CollisionShape* shapeA = nullptr;     // Shapes that produced the deepest contact
+    const CollisionShape* shapeB = nullptr;
+};
+
+/**
+ * @brief Built-in collision detection system
+ *
+ * Uses algorithms from Geometry module:
+ * - GJK for intersection testing
+ * - EPA for penetration depth
+ * - SAT for OBB-OBB (optimized)
+ */
+class CollisionDetection
+{
+public:
+    // =========================================================================
+    // Broadphase
+    // =========================================================================
+
+    /**
+     * @brief Simple AABB overlap test for broadphase
+     */
+    static bool AABBOverlap(const Vec3& minA, const Vec3& maxA,
+                            const Vec3& minB, const Vec3& maxB)
+    {
+        return (minA.x <= maxB.x && maxA.x >= minB.x) &&
+               (minA.y <= maxB.y && maxA.y >= minB.y) &&
+               (minA.z <= maxB.z && maxA.z >= minB.z);
+    }
+
+    /**
+     * @brief Get world-space AABB for a body
+     */
+    static void GetBodyAABB(const RigidBody& body, Vec3& outMin, Vec3& outMax);
+
+    /**
+     * @brief Brute-force broadphase (O(n^2)), kept as a reference for the tree broadphase
+     */
+    static void BroadphaseNaive(const std::vector<RigidBody*>& bodies,
+                                std::vector<CollisionPair>& outPairs);
+
+    // =========================================================================
+    // Narrowphase - Dispatch
+    // =========================================================================
+
+    /**
+     * @brief Collide every shape of two bodies and keep the deepest contact
+     *
+     * Spheres, boxes, capsules, cylinders and convex hulls are supported;
+     * mesh, height field and compound shapes are skipped.
+     */
+    static bool CollideBodies(RigidBody& bodyA, RigidBody& bodyB, CollisionResult& result);
+
+    /**
+     * @brief Collide two world-space shapes
+     */
+    static bool CollideShapes(const CollisionShape& shapeA, const Vec3& positionA, const Quat& rotationA,
+                              const CollisionShape& shapeB, const Vec3& positionB, const Quat& rotationB,
+                              CollisionResult& result);
+
+    /// True if the narrowphase can handle the shape
+    static bool IsSupported(const CollisionShape& shape);
+
+    // =========================================================================
+    // Narrowphase - Primitive Tests
+    // =========================================================================
+
+    /**
+     * @brief Sphere vs Sphere collision
+     */
+    static bool SphereSphere(const Vec3& centerA, float radiusA,
+                             const Vec3& centerB, float radiusB,
+                             CollisionResult& result);
+
+    /**
+     * @brief Sphere vs Capsule collision
+     */
+    static bool SphereCapsule(const Vec3& sphereCenter, float sphereRadius,
+                              const Vec3& capsuleA, const Vec3& capsuleB, float capsuleRadius,
+                              CollisionResult& result);
+
+    /**
+     * @brief Sphere vs Box (AABB) collision
+     */
+    static bool SphereBox(const Vec3& sphereCenter, float sphereRadius,
+                          const Vec3& boxCenter, const Vec3& boxHalfExtents,
+                          CollisionResult& result);
+
+    /**
+     * @brief Capsule vs Capsule collision
+     */
+    static bool CapsuleCapsule(const Vec3& a1, const Vec3& a2, float radiusA,
+                               const Vec3& b1, const Vec3& b2, float radiusB,
+                               CollisionResult& result);
+
+    // =========================================================================
+    // Raycast
+    // =========================================================================
+
+    /**
+     * @brief Ray vs Sphere intersection
+     */
+    static bool RaySphere(const Vec3& origin, const Vec3& direction, float maxDist,
+                          const Vec3& center, float radius,
+                          float& outT, Vec3& outPoint, Vec3& outNormal);
+
+    /**
+     * @brief Ray vs AABB intersection
+     */
+    static bool RayAABB(const Vec3& origin, const Vec3& direction, float maxDist,
+                        const Vec3& minBounds, const Vec3& maxBounds,
+                        float& outT, Vec3& outNormal);
+};
+
+} // namespace RVX::Physics
@@ -0,0 +1,168 @@
+/**
+ * @file CollisionResponse.h
+ * @brief Collision response and impulse resolution
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Physics/RigidBody.h"
+
+namespace RVX::Physics
+{
+
+/**
+ * @brief Contact between two bodies, ready for the solver
+ */
+struct ContactConstraint
+{
+    RigidBody* bodyA = nullptr;
+    RigidBody* bodyB = nullptr;
+    Vec3 normal{0, 1, 0};       // From A to B
+    float depth = 0.0f;
+    Vec3 pointA{0};
+    Vec3 pointB{0};
+    float restitution = 0.0f;
+    float friction = 0.0f;
+};
+
+/**
+ * @brief Collision response calculator
+ * 
+ * Implements impulse-based collision resolution with:
+ * - Elastic/inelastic collisions (restitution)
+ * - Friction (Coulomb model)
+ * - Position correction (Baumgarte stabilization)
+ *
+ * Only dynamic bodies respond; static and kinematic bodies act as infinite mass.
+ */
+class CollisionResponse
+{
+public:
+    /**
+     * @brief Compute collision impulse between two bodies
+     * 
+     * @param bodyA First body (can be null for static world)
+     * @param bodyB Second body
+     * @param normal Collision normal (from A to B)
+     * @param pointA Contact point on A
+     * @param pointB Contact point on B
+     * @param restitution Combined coefficient of restitution
+     * @return Impulse magnitude
+     */
+    static float ComputeImpulse(RigidBody* bodyA, RigidBody* bodyB,
+                                const Vec3& normal,
+                                const Vec3& pointA, const Vec3& pointB,
+                                float restitution);
+
+    /**
+     * @brief Apply collision impulse to bodies
+     */
+    static void ApplyImpulse(RigidBody* bodyA, RigidBody* bodyB,
+                             const Vec3& impulse,
+                             const Vec3& pointA, const Vec3& pointB);
+
+    /**
+     * @brief Resolve collision between two bodies
+     */
+    static void ResolveCollision(RigidBody* bodyA, RigidBody* bodyB,
+                                 const Vec3& normal, float depth,
+                                 const Vec3& pointA, const Vec3& pointB,
+                                 float restitution, float friction);
+
+    /**
+     * @brief Apply normal and friction impulses without touching positions
+     */
+    static void ResolveVelocity(RigidBody* bodyA, RigidBody* bodyB,
+                                const Vec3& normal,
+                                const Vec3& pointA, const Vec3& pointB,
+                                float restitution, float friction);
+
+    /**
+     * @brief Apply friction impulse
+     */
+    static void ApplyFriction(RigidBody* bodyA, RigidBody* bodyB,
+                              const Vec3& normal,
+                              const Vec3& pointA, const Vec3& pointB,
+                              float normalImpulse, float friction);
+
+    /**
+     * @brief Correct penetration with position adjustment
+     * 
+     * Uses Baumgarte stabilization: move bodies apart by a fraction of penetration
+     */
+    static void CorrectPosition(RigidBody* bodyA, RigidBody* bodyB,
+                                const Vec3& normal, float depth,
+                                float slop = 0.005f, float percent = 0.2f);
+
+    /**
+     * @brief Compute combined restitution from two materials
+     */
+    static float CombineRestitution(float restA, float restB)
+    {
+        // Average (alternative: max, multiply, etc.)
+        return (restA + restB) * 0.5f;
+    }
+
+    /**
+     * @brief Compute combined friction from two materials
+     */
+    static float CombineFriction(float fricA, float fricB);
+};
+
+/**
+ * @brief Sequential impulse constraint solver
+ */
+class SequentialImpulseSolver
+{
+public:
+    /**
+     * @brief Solve all constraints iteratively, then push penetrating bodies apart once
+     */
+    template<typename ContactContainer>
+    static void Solve(ContactContainer& contacts, int iterations)
+    {
+        for (int iter = 0; iter < iterations; ++iter)
+        {
+            SolveVelocities(contacts);
+        }
+        CorrectPositions(contacts);
+    }
+
+    /**
+     * @brief One velocity iteration over every contact
+     *
+     * Exposed separately so callers can interleave contacts with joints.
+     */
+    template<typename ContactContainer>
+    static void SolveVelocities(ContactContainer& contacts)
+    {
+        for (auto& contact : contacts)
+        {
+            CollisionResponse::ResolveVelocity(
+                contact.bodyA, contact.bodyB,
+                contact.normal,
+                contact.pointA, contact.pointB,
+                contact.restitution, contact.friction
+            );
+        }
+    }
+
+    /**
+     * @brief Single Baumgarte pass; running it per iteration would over-correct
+     */
+    template<typename ContactContainer>
+    static void CorrectPositions(ContactContainer& contacts)
+    {
+        for (auto& contact : contacts)
+        {
+            if (contact.depth > 0.001f)
+            {
+                CollisionResponse::CorrectPosition(contact.bodyA, contact.bodyB,
+                                                   contact.normal, contact.depth);
+            }
+        }
+    }
+};
+
+} // namespace RVX::Physics
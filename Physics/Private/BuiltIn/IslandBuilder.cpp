@@ -0,0 +1,209 @@
+/**
+ * @file IslandBuilder.cpp
+ * @brief Simulation island construction
+ */
+
+#include "IslandBuilder.h"
+#include "Physics/Constraints/IConstraint.h"
+#include <algorithm>
+#include <numeric>
+
+namespace RVX::Physics
+{
+
+uint32 IslandBuilder::SlotOf(const RigidBody* body, std::span<const std::unique_ptr<RigidBody>> bodies)
+{
+    if (!body || !body->IsDynamic())
+        return InvalidIndex;
+
+    const uint32 index = body->GetWorldIndex();
+    return index < bodies.size() && bodies[index].get() == body ? index : InvalidIndex;
+}
+
+uint32 IslandBuilder::Find(uint32 index)
+{
+    while (m_parent[index] != index)
+    {
+        // Path halving
+        m_parent[index] = m_parent[m_parent[index]];
+        index = m_parent[index];
+    }
+    return index;
+}
+
+void IslandBuilder::Union(uint32 a, uint32 b)
+{
+    a = Find(a);
+    b = Find(b);
+    if (a != b)
+        m_parent[std::max(a, b)] = std::min(a, b);
+}
+
+void IslandBuilder::Build(std::span<const std::unique_ptr<RigidBody>> bodies,
+                          const Broadphase& broadphase,
+                          std::span<const ContactConstraint> contacts,
+                          std::span<const std::shared_ptr<IConstraint>> constraints)
+{
+    Clear();
+
+    const size_t bodyCount = bodies.size();
+    m_parent.resize(bodyCount);
+    std::iota(m_parent.begin(), m_parent.end(), 0u);
+
+    // 1. Link dynamic bodies through touching pairs and joints. Pairs between two sleeping
+    //    bodies keep their last result, so a wake-up spreads through a whole stack at once.
+    for (const BroadphasePair& pair : broadphase.GetPairs())
+    {
+        if (!pair.touching)
+            continue;
+
+        const auto* bodyA = static_cast<const RigidBody*>(broadphase.GetUserData(pair.proxyA));
+        const auto* bodyB = static_cast<const RigidBody*>(broadphase.GetUserData(pair.proxyB));
+        if (bodyA->IsTrigger() || bodyB->IsTrigger())
+            continue;
+
+        const uint32 slotA = SlotOf(bodyA, bodies);
+        const uint32 slotB = SlotOf(bodyB, bodies);
+        if (slotA != InvalidIndex && slotB != InvalidIndex)
+            Union(slotA, slotB);
+    }
+
+    for (const auto& constraint : constraints)
+    {
+        if (!constraint || !constraint->IsEnabled() || constraint->IsBroken())
+            continue;
+
+        const uint32 slotA = SlotOf(constraint->GetBodyA(), bodies);
+        const uint32 slotB = SlotOf(constraint->GetBodyB(), bodies);
+        if (slotA != InvalidIndex && slotB != InvalidIndex)
+            Union(slotA, slotB);
+    }
+
+    // 2. An island is simulated if any of its bodies is awake
+    m_rootAwake.assign(bodyCount, 0);
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        const RigidBody& body = *bodies[i];
+        if (body.IsDynamic() && !body.IsSleeping())
+            m_rootAwake[Find(static_cast<uint32>(i))] = 1;
+    }
+
+    // 3. Number the awake islands and count their bodies
+    m_rootIsland.assign(bodyCount, InvalidIndex);
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        if (!bodies[i]->IsDynamic())
+            continue;
+
+        const uint32 root = Find(static_cast<uint32>(i));
+        if (!m_rootAwake[root])
+            continue;
+
+        if (m_rootIsland[root] == InvalidIndex)
+        {
+            m_rootIsland[root] = static_cast<uint32>(m_islands.size());
+            m_islands.emplace_back();
+        }
+        ++m_islands[m_rootIsland[root]].bodyCount;
+    }
+
+    // 4. Counting sort bodies, contacts and joints into per-island ranges
+    auto islandOf = [&](const RigidBody* bodyA, const RigidBody* bodyB)
+    {
+        uint32 slot = SlotOf(bodyA, bodies);
+        if (slot == InvalidIndex)
+            slot = SlotOf(bodyB, bodies);
+        return slot == InvalidIndex ? InvalidIndex : m_rootIsland[Find(slot)];
+    };
+
+    m_contactIslands.resize(contacts.size());
+    for (size_t i = 0; i < contacts.size(); ++i)
+    {
+        const uint32 island = islandOf(contacts[i].bodyA, contacts[i].bodyB);
+        m_contactIslands[i] = island;
+        if (island != InvalidIndex)
+            ++m_islands[island].contactCount;
+    }
+
+    m_constraintIslands.resize(constraints.size());
+    for (size_t i = 0; i < constraints.size(); ++i)
+    {
+        const IConstraint* constraint = constraints[i].get();
+        uint32 island = InvalidIndex;
+        if (constraint && constraint->IsEnabled() && !constraint->IsBroken())
+            island = islandOf(constraint->GetBodyA(), constraint->GetBodyB());
+
+        m_constraintIslands[i] = island;
+        if (island != InvalidIndex)
+            ++m_islands[island].constraintCount;
+    }
+
+    uint32 bodyOffset = 0;
+    uint32 contactOffset = 0;
+    uint32 constraintOffset = 0;
+    for (SimulationIsland& island : m_islands)
+    {
+        island.bodyBegin = bodyOffset;
+        island.contactBegin = contactOffset;
+        island.constraintBegin = constraintOffset;
+        bodyOffset += island.bodyCount;
+        contactOffset += island.contactCount;
+        constraintOffset += island.constraintCount;
+
+        // Counts are rebuilt as the fill cursor below
+        island.bodyCount = 0;
+        island.contactCount = 0;
+        island.constraintCount = 0;
+    }
+
+    m_bodies.resize(bodyOffset);
+    m_contacts.resize(contactOffset);
+    m_constraints.resize(constraintOffset);
+
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        RigidBody* body = bodies[i].get();
+        if (!body->IsDynamic())
+            continue;
+
+        const uint32 island = m_rootIsland[Find(static_cast<uint32>(i))];
+        if (island == InvalidIndex)
+            continue;
+
+        // Woken by a contact or joint with an awake body
+        body->WakeUp();
+
+        SimulationIsland& target = m_islands[island];
+        m_bodies[target.bodyBegin + target.bodyCount++] = body;
+    }
+
+    for (size_t i = 0; i < contacts.size(); ++i)
+    {
+        const uint32 island = m_contactIslands[i];
+        if (island == InvalidIndex)
+            continue;
+
+        SimulationIsland& target = m_islands[island];
+        m_contacts[target.contactBegin + target.contactCount++] = contacts[i];
+    }
+
+    for (size_t i = 0; i < constraints.size(); ++i)
+    {
+        const uint32 island = m_constraintIslands[i];
+        if (island == InvalidIndex)
+            continue;
+
+        SimulationIsland& target = m_islands[island];
+        m_constraints[target.constraintBegin + target.constraintCount++] = constraints[i].get();
+    }
+}
+
+void IslandBuilder::Clear()
+{
+    m_islands.clear();
+    m_bodies.clear();
+    m_contacts.clear();
+    m_constraints.clear();
+}
+
+} // namespace RVX::Physics
@@ -0,0 +1,109 @@
+/**
+ * @file IslandBuilder.h
+ * @brief Simulation islands for sleeping and parallel solving
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Physics/RigidBody.h"
+#include "Physics/Broadphase/Broadphase.h"
+#include "CollisionResponse.h"
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace RVX::Physics
+{
+
+class IConstraint;
+
+/**
+ * @brief Bodies, contacts and joints that can only affect each other
+ *
+ * Ranges index into the owning IslandBuilder's arrays.
+ */
+struct SimulationIsland
+{
+    uint32 bodyBegin = 0;
+    uint32 bodyCount = 0;
+    uint32 contactBegin = 0;
+    uint32 contactCount = 0;
+    uint32 constraintBegin = 0;
+    uint32 constraintCount = 0;
+};
+
+/**
+ * @brief Groups awake dynamic bodies into islands with union-find
+ *
+ * Dynamic bodies are linked by touching pairs and active joints; static
+ * and kinematic bodies never link islands, so an island can be solved
+ * without reading anything another island writes. Sleeping bodies linked to
+ * an awake body are woken, and islands whose bodies all sleep are left out.
+ *
+ * Usage:
+ * @code
+ * builder.Build(bodies, broadphase, contacts, constraints);
+ * for (const SimulationIsland& island : builder.GetIslands())
+ *     Solve(builder.GetBodies(island), builder.GetContacts(island), ...);
+ * @endcode
+ */
+class IslandBuilder
+{
+public:
+    /**
+     * @brief Rebuild islands for the current step
+     * @param bodies World body list; each body's world index must match its slot
+     * @param broadphase Pair cache whose `touching` flags link bodies
+     * @param contacts Contacts from this step's narrowphase
+     * @param constraints World joints; disabled and broken joints are skipped
+     */
+    void Build(std::span<const std::unique_ptr<RigidBody>> bodies,
+               const Broadphase& broadphase,
+               std::span<const ContactConstraint> contacts,
+               std::span<const std::shared_ptr<IConstraint>> constraints);
+
+    const std::vector<SimulationIsland>& GetIslands() const { return m_islands; }
+
+    std::span<RigidBody* const> GetBodies(const SimulationIsland& island) const
+    {
+        return {m_bodies.data() + island.bodyBegin, island.bodyCount};
+    }
+
+    std::span<ContactConstraint> GetContacts(const SimulationIsland& island)
+    {
+        return {m_contacts.data() + island.contactBegin, island.contactCount};
+    }
+
+    std::span<IConstraint* const> GetConstraints(const SimulationIsland& island) const
+    {
+        return {m_constraints.data() + island.constraintBegin, island.constraintCount};
+    }
+
+    /// Dynamic bodies in all islands, including ones woken by this build
+    size_t GetAwakeBodyCount() const { return m_bodies.size(); }
+
+    void Clear();
+
+private:
+    static constexpr uint32 InvalidIndex = ~0u;
+
+    uint32 Find(uint32 index);
+    void Union(uint32 a, uint32 b);
+
+    /// Union-find slot of a dynamic body, InvalidIndex for anything else
+    static uint32 SlotOf(const RigidBody* body, std::span<const std::unique_ptr<RigidBody>> bodies);
+
+    std::vector<uint32> m_parent;           // Union-find forest over world indices
+    std::vector<uint8> m_rootAwake;
+    std::vector<uint32> m_rootIsland;
+
+    std::vector<SimulationIsland> m_islands;
+    std::vector<RigidBody*> m_bodies;       // Grouped by island
+    std::vector<ContactConstraint> m_contacts;
+    std::vector<IConstraint*> m_constraints;
+    std::vector<uint32> m_contactIslands;   // Scratch for the counting sort
+    std::vector<uint32> m_constraintIslands;
+};
+
+} // namespace RVX::Physics
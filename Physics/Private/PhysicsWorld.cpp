@@ -6,8 +6,13 @@
 #include "Physics/PhysicsWorld.h"
 #include "Physics/Shapes/CollisionShape.h"
 #include "Physics/Constraints/IConstraint.h"
-#include "Core/Math/Intersection.h"
-#include "Core/Math/Ray.h"
+#include "BuiltIn/CollisionDetection.h"
+#include "BuiltIn/CollisionResponse.h"
+#include "BuiltIn/IslandBuilder.h"
+#include "Query/RaycastQuery.h"
+#include "Query/ShapeQuery.h"
+#include "Core/Assert.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Math/AABB.h"
 #include <algorithm>
 #include <cmath>
@@ -15,6 +20,41 @@
 namespace RVX::Physics
 {
 
+namespace
+{
+
+/// Pairs need at least one dynamic body; static and kinematic bodies never respond
+bool ShouldPairBodies(void* userDataA, void* userDataB)
+{
+    const auto* bodyA = static_cast<const RigidBody*>(userDataA);
+    const auto* bodyB = static_cast<const RigidBody*>(userDataB);
+    return bodyA->IsDynamic() || bodyB->IsDynamic();
+}
+
+AABB ProxyBounds(const RigidBody& body)
+{
+    const RigidBody::AABB bounds = body.GetAABB();
+    return AABB(bounds.min, bounds.max);
+}
+
+/// Island batches smaller than this are not worth a job of their own
+constexpr size_t kMinIslandBatchCost = 64;
+
+/// Batched queries hand this many commands to each job
+constexpr size_t kQueryChunkSize = 64;
+
+size_t QueryChunkCount(size_t commandCount)
+{
+    return (commandCount + kQueryChunkSize - 1) / kQueryChunkSize;
+}
+
+} // namespace
+
+PhysicsWorld::PhysicsWorld()
+    : m_islandBuilder(std::make_unique<IslandBuilder>())
+{
+}
+
 PhysicsWorld::~PhysicsWorld()
 {
     Shutdown();
@@ -23,6 +63,7 @@ PhysicsWorld::~PhysicsWorld()
 bool PhysicsWorld::Initialize(const PhysicsWorldConfig& config)
 {
     m_config = config;
+    m_broadphase.SetPairFilter(&ShouldPairBodies);
     
 #ifdef RVX_PHYSICS_JOLT
     // Jolt Physics initialization would go here
@@ -40,7 +81,11 @@ bool PhysicsWorld::Initialize(const PhysicsWorldConfig& config)
 void PhysicsWorld::Shutdown()
 {
     m_bodies.clear();
+    m_bodyProxies.clear();
     m_bodyLookup.clear();
+    m_broadphase.Clear();
+    m_pendingEvents.clear();
+    m_islandBuilder->Clear();
     m_constraints.clear();
     m_initialized = false;
     
@@ -70,13 +115,79 @@ void PhysicsWorld::StepInternal(float dt)
     // m_physicsSystem->Update(dt, ...);
 #else
     // Built-in physics step
-    
-    // 1. Apply forces and integrate velocities
-    for (auto& body : m_bodies)
+
+    // 1. Refresh broadphase pairs and generate contacts
+    UpdateBroadphase(dt);
+
+    std::vector<ContactConstraint> contacts;
+    contacts.reserve(m_broadphase.GetPairs().size());
+    UpdateContacts(contacts);
+
+    // 2. Group awake bodies into islands; sleeping islands drop out of the step entirely
+    m_islandBuilder->Build(m_bodies, m_broadphase, contacts, m_constraints);
+    const std::vector<SimulationIsland>& islands = m_islandBuilder->GetIslands();
+
+    // 3. Solve islands, batched so each job carries a similar amount of work
+    JobSystem& jobs = JobSystem::Get();
+    const size_t jobTarget = jobs.GetWorkerCount() * 4;
+    const size_t batchCost = std::max(kMinIslandBatchCost,
+        jobTarget > 0 ? (m_islandBuilder->GetAwakeBodyCount() + contacts.size()) / jobTarget : 0);
+
+    m_islandBatches.clear();
+    size_t cost = batchCost;
+    for (size_t i = 0; i < islands.size(); ++i)
     {
-        if (!body || !body->IsDynamic() || body->IsSleeping())
-            continue;
+        if (cost >= batchCost)
+        {
+            m_islandBatches.push_back(static_cast<uint32>(i));
+            cost = 0;
+        }
+        cost += islands[i].bodyCount + islands[i].contactCount;
+    }
+    const size_t batchCount = m_islandBatches.size();
+    m_islandBatches.push_back(static_cast<uint32>(islands.size()));
+
+    auto solveBatch = [&](size_t batch)
+    {
+        for (uint32 i = m_islandBatches[batch]; i < m_islandBatches[batch + 1]; ++i)
+        {
+            SolveIsland(islands[i], dt);
+        }
+    };
 
+    if (m_config.parallelIslands && batchCount > 1)
+    {
+        jobs.ParallelFor(0, batchCount, solveBatch, 1);
+    }
+    else
+    {
+        for (size_t batch = 0; batch < batchCount; ++batch)
+        {
+            solveBatch(batch);
+        }
+    }
+
+    // 4. Queries between steps read the tree, so refit what the solver moved
+    RefitSolvedProxies(dt);
+
+    m_stepStats.islandCount = islands.size();
+    m_stepStats.awakeBodyCount = m_islandBuilder->GetAwakeBodyCount();
+    m_stepStats.contactCount = contacts.size();
+    m_stepStats.jobCount = m_config.parallelIslands && batchCount > 1 ? batchCount : 0;
+
+    DispatchEvents();
+#endif
+}
+
+void PhysicsWorld::SolveIsland(const SimulationIsland& island, float dt)
+{
+    const std::span<RigidBody* const> bodies = m_islandBuilder->GetBodies(island);
+    std::span<ContactConstraint> contacts = m_islandBuilder->GetContacts(island);
+    const std::span<IConstraint* const> constraints = m_islandBuilder->GetConstraints(island);
+
+    // 1. Apply forces and integrate velocities
+    for (RigidBody* body : bodies)
+    {
         // Apply gravity
         Vec3 gravity = m_config.gravity * body->GetGravityScale();
         Vec3 velocity = body->GetLinearVelocity();
@@ -95,24 +206,25 @@ void PhysicsWorld::StepInternal(float dt)
         body->SetAngularVelocity(angularVelocity);
     }
 
-    // 2. Solve constraints
+    // 2. Solve constraints and contacts
+    for (IConstraint* constraint : constraints)
+    {
+        constraint->PreSolve(dt);
+    }
+
     for (int iter = 0; iter < m_config.velocitySteps; ++iter)
     {
-        for (auto& constraint : m_constraints)
+        for (IConstraint* constraint : constraints)
         {
-            if (constraint && constraint->IsEnabled() && !constraint->IsBroken())
-            {
-                constraint->SolveVelocity(dt);
-            }
+            constraint->SolveVelocity(dt);
         }
+
+        SequentialImpulseSolver::SolveVelocities(contacts);
     }
 
     // 3. Integrate positions
-    for (auto& body : m_bodies)
+    for (RigidBody* body : bodies)
     {
-        if (!body || !body->IsDynamic() || body->IsSleeping())
-            continue;
-
         Vec3 position = body->GetPosition();
         Quat rotation = body->GetRotation();
         
@@ -131,40 +243,198 @@ void PhysicsWorld::StepInternal(float dt)
         body->ClearForces();
     }
 
-    // 4. Solve position constraints
+    // 4. Push penetrating bodies apart, then solve position constraints
+    SequentialImpulseSolver::CorrectPositions(contacts);
+
     for (int iter = 0; iter < m_config.positionSteps; ++iter)
     {
-        for (auto& constraint : m_constraints)
+        for (IConstraint* constraint : constraints)
         {
-            if (constraint && constraint->IsEnabled() && !constraint->IsBroken())
-            {
-                constraint->SolvePosition(dt);
-            }
+            constraint->SolvePosition(dt);
         }
     }
-    
-    // 5. Check for sleeping bodies
-    UpdateSleepStates();
-#endif
+
+    // 5. Check whether the island can sleep
+    UpdateSleepStates(island, dt);
 }
 
-void PhysicsWorld::UpdateSleepStates()
+void PhysicsWorld::UpdateBroadphase(float dt)
 {
-    const float sleepThreshold = 0.1f;
-    
-    for (auto& body : m_bodies)
+    for (size_t i = 0; i < m_bodies.size(); ++i)
     {
-        if (!body || !body->IsDynamic() || !body->CanSleep())
+        const RigidBody& body = *m_bodies[i];
+        if (body.IsSleeping())
             continue;
 
-        float linearSpeed = length(body->GetLinearVelocity());
-        float angularSpeed = length(body->GetAngularVelocity());
-        
-        if (linearSpeed < sleepThreshold && angularSpeed < sleepThreshold)
+        m_broadphase.MoveProxy(m_bodyProxies[i], ProxyBounds(body), body.GetLinearVelocity() * dt);
+    }
+
+    m_broadphase.UpdatePairs();
+}
+
+void PhysicsWorld::RefitSolvedProxies(float dt)
+{
+    for (const SimulationIsland& island : m_islandBuilder->GetIslands())
+    {
+        for (const RigidBody* body : m_islandBuilder->GetBodies(island))
+        {
+            m_broadphase.MoveProxy(m_bodyProxies[body->GetWorldIndex()], ProxyBounds(*body),
+                                   body->GetLinearVelocity() * dt);
+        }
+    }
+}
+
+void PhysicsWorld::RefreshProxy(BodyHandle handle)
+{
+    auto it = m_bodyLookup.find(handle.GetId());
+    if (it == m_bodyLookup.end()) return;
+
+    m_broadphase.MoveProxy(m_bodyProxies[it->second], ProxyBounds(*m_bodies[it->second]), Vec3(0.0f));
+}
+
+void PhysicsWorld::UpdateContacts(std::vector<ContactConstraint>& contacts)
+{
+    contacts.clear();
+
+    auto isActive = [](const RigidBody& body)
+    {
+        if (body.IsKinematic())
+            return dot(body.GetLinearVelocity(), body.GetLinearVelocity()) > 0.0f ||
+                   dot(body.GetAngularVelocity(), body.GetAngularVelocity()) > 0.0f;
+        return body.IsDynamic() && !body.IsSleeping();
+    };
+
+    auto queueEvent = [this](const RigidBody& bodyA, const RigidBody& bodyB,
+                             const CollisionResult* result, bool begin)
+    {
+        PendingEvent pending;
+        pending.begin = begin;
+        pending.event.bodyIdA = bodyA.GetId();
+        pending.event.bodyIdB = bodyB.GetId();
+        pending.event.contactPoint = result ? (result->pointA + result->pointB) * 0.5f : Vec3(0.0f);
+        pending.event.contactNormal = result ? result->normal : Vec3(0.0f);
+        pending.event.impulse = 0.0f;
+        pending.event.isTrigger = bodyA.IsTrigger() || bodyB.IsTrigger();
+        m_pendingEvents.push_back(pending);
+    };
+
+    for (BroadphasePair& pair : m_broadphase.GetPairs())
+    {
+        auto* bodyA = static_cast<RigidBody*>(m_broadphase.GetUserData(pair.proxyA));
+        auto* bodyB = static_cast<RigidBody*>(m_broadphase.GetUserData(pair.proxyB));
+
+        // Nothing moves if neither side is awake and dynamic or a moving kinematic; keep the
+        // last result
+        const bool activeA = isActive(*bodyA);
+        const bool activeB = isActive(*bodyB);
+        if (!activeA && !activeB)
+            continue;
+
+        CollisionResult result;
+        const bool touching = CollisionDetection::CollideBodies(*bodyA, *bodyB, result);
+
+        if (touching != pair.touching)
+        {
+            queueEvent(*bodyA, *bodyB, touching ? &result : nullptr, touching);
+            pair.touching = touching;
+        }
+
+        if (!touching || bodyA->IsTrigger() || bodyB->IsTrigger())
+            continue;
+
+        // A moving kinematic body has no island to carry a wake-up, so wake the sleeper here
+        if (activeA)
+            bodyB->WakeUp();
+        if (activeB)
+            bodyA->WakeUp();
+
+        const PhysicsMaterial materialA = result.shapeA ? result.shapeA->GetMaterial() : PhysicsMaterial::Default();
+        const PhysicsMaterial materialB = result.shapeB ? result.shapeB->GetMaterial() : PhysicsMaterial::Default();
+
+        ContactConstraint& contact = contacts.emplace_back();
+        contact.bodyA = bodyA;
+        contact.bodyB = bodyB;
+        contact.normal = result.normal;
+        contact.depth = result.depth;
+        contact.pointA = result.pointA;
+        contact.pointB = result.pointB;
+        contact.restitution = CollisionResponse::CombineRestitution(materialA.restitution, materialB.restitution);
+        contact.friction = CollisionResponse::CombineFriction(materialA.friction, materialB.friction);
+    }
+
+    // Pairs whose fat bounds separated this step
+    for (const BroadphasePair& pair : m_broadphase.GetRemovedPairs())
+    {
+        if (!pair.touching)
+            continue;
+
+        const auto* bodyA = static_cast<const RigidBody*>(m_broadphase.GetUserData(pair.proxyA));
+        const auto* bodyB = static_cast<const RigidBody*>(m_broadphase.GetUserData(pair.proxyB));
+        queueEvent(*bodyA, *bodyB, nullptr, false);
+    }
+}
+
+void PhysicsWorld::DispatchEvents()
+{
+    if (m_pendingEvents.empty())
+        return;
+
+    // Callbacks may create or destroy bodies, so dispatch from a detached list
+    std::vector<PendingEvent> events;
+    events.swap(m_pendingEvents);
+
+    for (const PendingEvent& pending : events)
+    {
+        const CollisionCallback& callback = pending.event.isTrigger
+            ? (pending.begin ? m_onTriggerEnter : m_onTriggerExit)
+            : (pending.begin ? m_onCollisionEnter : m_onCollisionExit);
+
+        if (callback)
+            callback(pending.event);
+    }
+
+    events.clear();
+    if (m_pendingEvents.empty())
+        m_pendingEvents.swap(events);
+}
+
+void PhysicsWorld::UpdateSleepStates(const SimulationIsland& island, float dt)
+{
+    if (!m_config.enableSleeping)
+        return;
+
+    const float linearThresholdSq = m_config.sleepLinearVelocity * m_config.sleepLinearVelocity;
+    const float angularThresholdSq = m_config.sleepAngularVelocity * m_config.sleepAngularVelocity;
+
+    // The island sleeps as a unit once its most recently disturbed body has rested long enough
+    float minSleepTimer = m_config.timeToSleep;
+    for (RigidBody* body : m_islandBuilder->GetBodies(island))
+    {
+        const Vec3 linearVelocity = body->GetLinearVelocity();
+        const Vec3 angularVelocity = body->GetAngularVelocity();
+
+        if (!body->CanSleep() ||
+            dot(linearVelocity, linearVelocity) > linearThresholdSq ||
+            dot(angularVelocity, angularVelocity) > angularThresholdSq)
+        {
+            body->SetSleepTimer(0.0f);
+        }
+        else
         {
-            // Would accumulate sleep timer here
-            // body->SetSleeping(true);
+            body->SetSleepTimer(body->GetSleepTimer() + dt);
         }
+
+        minSleepTimer = std::min(minSleepTimer, body->GetSleepTimer());
+    }
+
+    if (minSleepTimer < m_config.timeToSleep)
+        return;
+
+    for (RigidBody* body : m_islandBuilder->GetBodies(island))
+    {
+        body->SetLinearVelocity(Vec3(0.0f));
+        body->SetAngularVelocity(Vec3(0.0f));
+        body->SetSleeping(true);
     }
 }
 
@@ -182,6 +452,8 @@ BodyHandle PhysicsWorld::CreateBody(const RigidBodyDesc& desc)
 
     // TODO: Create backend body
 
+    body->SetWorldIndex(static_cast<uint32>(m_bodies.size()));
+    m_bodyProxies.push_back(m_broadphase.AddProxy(ProxyBounds(*body), body.get()));
     m_bodyLookup[id] = m_bodies.size();
     m_bodies.push_back(std::move(body));
 
@@ -197,13 +469,29 @@ void PhysicsWorld::DestroyBody(BodyHandle handle)
     
     // TODO: Destroy backend body
 
+    // Whatever rested on this body has to fall again
+    const int32 proxy = m_bodyProxies[index];
+    for (const BroadphasePair& pair : m_broadphase.GetPairs())
+    {
+        if (pair.touching && (pair.proxyA == proxy || pair.proxyB == proxy))
+        {
+            const int32 other = pair.proxyA == proxy ? pair.proxyB : pair.proxyA;
+            static_cast<RigidBody*>(m_broadphase.GetUserData(other))->WakeUp();
+        }
+    }
+
+    m_broadphase.RemoveProxy(proxy);
+
     // Swap and pop
     if (index != m_bodies.size() - 1)
     {
         m_bodies[index] = std::move(m_bodies.back());
+        m_bodyProxies[index] = m_bodyProxies.back();
+        m_bodies[index]->SetWorldIndex(static_cast<uint32>(index));
         m_bodyLookup[m_bodies[index]->GetId()] = index;
     }
     m_bodies.pop_back();
+    m_bodyProxies.pop_back();
     m_bodyLookup.erase(it);
 }
 
@@ -224,6 +512,7 @@ const RigidBody* PhysicsWorld::GetBody(BodyHandle handle) const
 void PhysicsWorld::SetBodyPosition(BodyHandle body, const Vec3& position)
 {
     if (auto* b = GetBody(body)) b->SetPosition(position);
+    RefreshProxy(body);
 }
 
 Vec3 PhysicsWorld::GetBodyPosition(BodyHandle body) const
@@ -235,6 +524,7 @@ Vec3 PhysicsWorld::GetBodyPosition(BodyHandle body) const
 void PhysicsWorld::SetBodyRotation(BodyHandle body, const Quat& rotation)
 {
     if (auto* b = GetBody(body)) b->SetRotation(rotation);
+    RefreshProxy(body);
 }
 
 Quat PhysicsWorld::GetBodyRotation(BodyHandle body) const
@@ -286,6 +576,7 @@ void PhysicsWorld::AddShape(BodyHandle body, std::shared_ptr<CollisionShape> sha
     if (auto* b = GetBody(body))
     {
         b->AddShape(std::move(shape), offset, rotation);
+        RefreshProxy(body);
     }
 }
 
@@ -306,77 +597,43 @@ bool PhysicsWorld::Raycast(const Vec3& origin, const Vec3& direction, float maxD
                            RaycastHit& hit, uint32 layerMask) const
 {
     hit = RaycastHit{};
+    const Vec3 dir = glm::normalize(direction);
 
-    float closestDist = maxDistance;
-    bool foundHit = false;
-
-    // Normalize direction
-    Vec3 dir = glm::normalize(direction);
-
-    for (auto& body : m_bodies)
+    // Each exact hit clips the ray, so farther subtrees are culled as the search goes
+    m_broadphase.RayCast(origin, dir, maxDistance, [&](int32 proxyId, float distance)
     {
-        if (!body) continue;
+        const auto* body = static_cast<const RigidBody*>(m_broadphase.GetUserData(proxyId));
+        if (!(body->GetLayer() & layerMask))
+            return distance;
 
-        // Check layer mask
-        if (!(body->GetLayer() & layerMask)) continue;
-
-        // Get body AABB
-        RigidBody::AABB aabb = body->GetAABB();
-        AABB box(aabb.min, aabb.max);
-
-        // Ray-AABB intersection test
-        float tMin = 0.0f, tMax = 0.0f;
-        Ray ray(origin, dir);
-        if (RayAABBIntersect(ray, box, tMin, tMax))
+        RaycastHit bodyHit;
+        if (RaycastQuery::RayCastBody(*body, origin, dir, distance, bodyHit))
         {
-            if (tMin < closestDist && tMin >= 0.0f)
-            {
-                closestDist = tMin;
-                foundHit = true;
-                hit.hit = true;
-                hit.distance = tMin;
-                hit.point = origin + dir * tMin;
-                hit.bodyId = body->GetId();
-                // Simplified normal calculation - point towards ray origin
-                hit.normal = -dir;
-            }
+            hit = bodyHit;
+            return hit.distance;
         }
-    }
+        return distance;
+    });
 
-    return foundHit;
+    return hit.hit;
 }
 
 size_t PhysicsWorld::RaycastAll(const Vec3& origin, const Vec3& direction, float maxDistance,
                                 std::vector<RaycastHit>& hits, uint32 layerMask) const
 {
     hits.clear();
+    const Vec3 dir = glm::normalize(direction);
 
-    Vec3 dir = glm::normalize(direction);
-
-    for (auto& body : m_bodies)
+    m_broadphase.RayCast(origin, dir, maxDistance, [&](int32 proxyId, float distance)
     {
-        if (!body) continue;
-        if (!(body->GetLayer() & layerMask)) continue;
-
-        RigidBody::AABB aabb = body->GetAABB();
-        AABB box(aabb.min, aabb.max);
-
-        float tMin = 0.0f, tMax = 0.0f;
-        Ray ray(origin, dir);
-        if (RayAABBIntersect(ray, box, tMin, tMax))
+        const auto* body = static_cast<const RigidBody*>(m_broadphase.GetUserData(proxyId));
+        RaycastHit hit;
+        if ((body->GetLayer() & layerMask) && RaycastQuery::RayCastBody(*body, origin, dir, distance, hit))
         {
-            if (tMin < maxDistance && tMin >= 0.0f)
-            {
-                RaycastHit hit;
-                hit.hit = true;
-                hit.distance = tMin;
-                hit.point = origin + dir * tMin;
-                hit.bodyId = body->GetId();
-                hit.normal = -dir;
-                hits.push_back(hit);
-            }
+            hits.push_back(hit);
         }
-    }
+        return distance;
+    });
 
     // Sort by distance
     std::sort(hits.begin(), hits.end(), [](const RaycastHit& a, const RaycastHit& b) {
@@ -388,69 +645,150 @@ size_t PhysicsWorld::RaycastAll(const Vec3& origin, const Vec3& direction, float
 
 bool PhysicsWorld::SphereCast(const Vec3& origin, float radius, const Vec3& direction,
                               float maxDistance, ShapeCastHit& hit, uint32 layerMask) const
+{
+    const SphereShape sphere(radius);
+    return ShapeCast(sphere, origin, Quat(1, 0, 0, 0), direction, maxDistance, hit, layerMask);
+}
+
+size_t PhysicsWorld::OverlapSphere(const Vec3& center, float radius,
+                                   std::vector<BodyHandle>& bodies, uint32 layerMask) const
+{
+    const SphereShape sphere(radius);
+    return OverlapShape(sphere, center, Quat(1, 0, 0, 0), bodies, layerMask);
+}
+
+bool PhysicsWorld::ShapeCast(const CollisionShape& shape, const Vec3& origin, const Quat& rotation,
+                             const Vec3& direction, float maxDistance, ShapeCastHit& hit,
+                             uint32 layerMask) const
 {
     hit = ShapeCastHit{};
+    const Vec3 dir = glm::normalize(direction);
 
-    float closestDist = maxDistance;
-    bool foundHit = false;
+    AABB sweepBounds = ShapeQuery::ComputeBounds(shape, origin, rotation);
+    sweepBounds.Expand(ShapeQuery::ComputeBounds(shape, origin + dir * maxDistance, rotation));
 
-    Vec3 dir = glm::normalize(direction);
+    float closest = maxDistance;
+    m_broadphase.Query(sweepBounds, [&](int32 proxyId)
+    {
+        const auto* body = static_cast<const RigidBody*>(m_broadphase.GetUserData(proxyId));
+        if (!(body->GetLayer() & layerMask))
+            return true;
 
-    for (auto& body : m_bodies)
+        ShapeCastHit bodyHit;
+        if (ShapeQuery::CastBody(shape, origin, rotation, dir, closest, *body, bodyHit))
+        {
+            closest = bodyHit.fraction * closest;
+            hit = bodyHit;
+        }
+        return true;
+    });
+
+    if (hit.hit)
     {
-        if (!body) continue;
-        if (!(body->GetLayer() & layerMask)) continue;
+        hit.fraction = maxDistance > 0.0f ? closest / maxDistance : 0.0f;
+    }
+    return hit.hit;
+}
 
-        RigidBody::AABB bodyAABB = body->GetAABB();
+size_t PhysicsWorld::OverlapShape(const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                                  std::vector<BodyHandle>& bodies, uint32 layerMask) const
+{
+    bodies.clear();
 
-        // Expand AABB by radius
-        Vec3 expandedMin = bodyAABB.min - Vec3(radius);
-        Vec3 expandedMax = bodyAABB.max + Vec3(radius);
-        AABB expandedBox(expandedMin, expandedMax);
+    m_broadphase.Query(ShapeQuery::ComputeBounds(shape, position, rotation), [&](int32 proxyId)
+    {
+        const auto* body = static_cast<const RigidBody*>(m_broadphase.GetUserData(proxyId));
+        if ((body->GetLayer() & layerMask) && ShapeQuery::OverlapBody(shape, position, rotation, *body))
+        {
+            bodies.push_back(body->GetHandle());
+        }
+        return true;
+    });
+
+    return bodies.size();
+}
+
+void PhysicsWorld::RaycastBatch(std::span<const RaycastCommand> commands, std::span<RaycastHit> hits) const
+{
+    RVX_ASSERT(hits.size() >= commands.size());
 
-        float tMin = 0.0f, tMax = 0.0f;
-        Ray ray(origin, dir);
-        if (RayAABBIntersect(ray, expandedBox, tMin, tMax))
+    auto runChunk = [&](size_t chunk)
+    {
+        const size_t end = std::min(commands.size(), (chunk + 1) * kQueryChunkSize);
+        for (size_t i = chunk * kQueryChunkSize; i < end; ++i)
         {
-            if (tMin < closestDist && tMin >= 0.0f)
-            {
-                closestDist = tMin;
-                foundHit = true;
-                hit.hit = true;
-                hit.fraction = tMin / maxDistance;
-                hit.point = origin + dir * tMin;
-                hit.bodyId = body->GetId();
-                hit.normal = -dir;
-            }
+            const RaycastCommand& command = commands[i];
+            Raycast(command.origin, command.direction, command.maxDistance, hits[i], command.layerMask);
         }
-    }
+    };
 
-    return foundHit;
+    JobSystem::Get().ParallelFor(0, QueryChunkCount(commands.size()), runChunk, 1);
 }
 
-size_t PhysicsWorld::OverlapSphere(const Vec3& center, float radius,
-                                   std::vector<BodyHandle>& bodies, uint32 layerMask) const
+void PhysicsWorld::ShapeCastBatch(std::span<const ShapeCastCommand> commands, std::span<ShapeCastHit> hits) const
 {
-    bodies.clear();
+    RVX_ASSERT(hits.size() >= commands.size());
 
-    for (auto& body : m_bodies)
+    auto runChunk = [&](size_t chunk)
     {
-        if (!body) continue;
-        if (!(body->GetLayer() & layerMask)) continue;
+        const size_t end = std::min(commands.size(), (chunk + 1) * kQueryChunkSize);
+        for (size_t i = chunk * kQueryChunkSize; i < end; ++i)
+        {
+            const ShapeCastCommand& command = commands[i];
+            hits[i] = ShapeCastHit{};
+            if (command.shape)
+            {
+                ShapeCast(*command.shape, command.origin, command.rotation, command.direction,
+                          command.maxDistance, hits[i], command.layerMask);
+            }
+        }
+    };
+
+    JobSystem::Get().ParallelFor(0, QueryChunkCount(commands.size()), runChunk, 1);
+}
 
-        RigidBody::AABB aabb = body->GetAABB();
+void PhysicsWorld::OverlapBatch(std::span<const OverlapCommand> commands,
+                                std::vector<BodyHandle>& bodies, std::vector<uint32>& offsets) const
+{
+    const size_t chunkCount = QueryChunkCount(commands.size());
 
-        // Check if sphere intersects AABB
-        Vec3 closestPoint = glm::clamp(center, aabb.min, aabb.max);
-        float dist = glm::length(closestPoint - center);
+    // Each chunk collects into its own list; the lists are concatenated in command order
+    std::vector<std::vector<BodyHandle>> chunkBodies(chunkCount);
+    offsets.assign(commands.size() + 1, 0);
 
-        if (dist < radius)
+    auto runChunk = [&](size_t chunk)
+    {
+        std::vector<BodyHandle> found;
+        const size_t end = std::min(commands.size(), (chunk + 1) * kQueryChunkSize);
+        for (size_t i = chunk * kQueryChunkSize; i < end; ++i)
         {
-            bodies.push_back(body->GetHandle());
+            const OverlapCommand& command = commands[i];
+            if (command.shape)
+            {
+                OverlapShape(*command.shape, command.position, command.rotation, found, command.layerMask);
+            }
+            else
+            {
+                found.clear();
+            }
+            chunkBodies[chunk].insert(chunkBodies[chunk].end(), found.begin(), found.end());
+            offsets[i + 1] = static_cast<uint32>(found.size());
         }
+    };
+
+    JobSystem::Get().ParallelFor(0, chunkCount, runChunk, 1);
+
+    for (size_t i = 0; i < commands.size(); ++i)
+    {
+        offsets[i + 1] += offsets[i];
     }
 
-    return bodies.size();
+    bodies.clear();
+    bodies.reserve(offsets.back());
+    for (const auto& chunk : chunkBodies)
+    {
+        bodies.insert(bodies.end(), chunk.begin(), chunk.end());
+    }
 }
 
 void PhysicsWorld::GetDebugDrawData(std::vector<Vec3>& lines, std::vector<Vec4>& colors,
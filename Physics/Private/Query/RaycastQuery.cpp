@@ -1,14 +1,439 @@
 /**
  * @file RaycastQuery.cpp
- * @brief Raycast query implementation stub
+ * @brief Exact ray tests against collision shapes
  */
 
-#include "Physics/PhysicsTypes.h"
+#include "RaycastQuery.h"
+#include "ShapeQuery.h"
+#include "BuiltIn/CollisionDetection.h"
+#include "Core/Math/Intersection.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace RVX::Physics
 {
 
-// Raycast implementation is in PhysicsWorld.cpp
-// This file is for future specialized query implementations
+namespace
+{
+
+constexpr float kParallelEpsilon = 1e-12f;
+
+/// Nearest entry of a local ray into a sphere; the origin must be outside
+bool RaySphere(const Vec3& origin, const Vec3& direction, const Vec3& center, float radius,
+               float maxDistance, float& outDistance)
+{
+    // Solve from the point of closest approach rather than b^2 - c, which
+    // cancels badly for distant origins (Ray Tracing Gems, ch. 7)
+    const Vec3 m = origin - center;
+    const float b = -dot(m, direction);
+    const Vec3 closest = m + direction * b;
+    const float disc = radius * radius - dot(closest, closest);
+    if (disc < 0.0f)
+        return false;
+
+    const float t = b - std::sqrt(disc);
+    if (t < 0.0f || t > maxDistance)
+        return false;
+
+    outDistance = t;
+    return true;
+}
+
+bool RaySphereShape(const SphereShape& sphere, const Vec3& origin, const Vec3& direction,
+                    float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    const float radius = sphere.GetRadius();
+    if (dot(origin, origin) <= radius * radius)
+        return false;
+
+    if (!RaySphere(origin, direction, Vec3(0.0f), radius, maxDistance, outDistance))
+        return false;
+
+    outNormal = (origin + direction * outDistance) / radius;
+    return true;
+}
+
+bool RayBoxShape(const BoxShape& box, const Vec3& origin, const Vec3& direction,
+                 float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    const Vec3& he = box.GetHalfExtents();
+    float tEnter = -std::numeric_limits<float>::max();
+    float tExit = std::numeric_limits<float>::max();
+    int enterAxis = 0;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        if (std::abs(direction[i]) < kParallelEpsilon)
+        {
+            if (origin[i] < -he[i] || origin[i] > he[i])
+                return false;
+            continue;
+        }
+
+        const float inv = 1.0f / direction[i];
+        float t0 = (-he[i] - origin[i]) * inv;
+        float t1 = (he[i] - origin[i]) * inv;
+        if (t0 > t1)
+            std::swap(t0, t1);
+
+        if (t0 > tEnter)
+        {
+            tEnter = t0;
+            enterAxis = i;
+        }
+        tExit = std::min(tExit, t1);
+        if (tEnter > tExit)
+            return false;
+    }
+
+    // Starting inside, or the box is behind the ray
+    if (tEnter < 0.0f || tEnter > maxDistance)
+        return false;
+
+    outDistance = tEnter;
+    outNormal = Vec3(0.0f);
+    outNormal[enterAxis] = direction[enterAxis] > 0.0f ? -1.0f : 1.0f;
+    return true;
+}
+
+/// Ray against the side of a Y-aligned cylinder of given half height
+bool RayCylinderSide(const Vec3& origin, const Vec3& direction, float radius, float halfHeight,
+                     float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    const float a = direction.x * direction.x + direction.z * direction.z;
+    if (a < kParallelEpsilon)
+        return false;
+
+    const float b = origin.x * direction.x + origin.z * direction.z;
+    const float c = origin.x * origin.x + origin.z * origin.z - radius * radius;
+    const float disc = b * b - a * c;
+    if (disc < 0.0f)
+        return false;
+
+    const float t = (-b - std::sqrt(disc)) / a;
+    if (t < 0.0f || t > maxDistance)
+        return false;
+
+    const Vec3 point = origin + direction * t;
+    if (std::abs(point.y) > halfHeight)
+        return false;
+
+    outDistance = t;
+    outNormal = Vec3(point.x, 0.0f, point.z) / radius;
+    return true;
+}
+
+bool RayCapsuleShape(const CapsuleShape& capsule, const Vec3& origin, const Vec3& direction,
+                     float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    const float radius = capsule.GetRadius();
+    const float halfHeight = capsule.GetHalfHeight();
+
+    const Vec3 axisPoint(0.0f, std::clamp(origin.y, -halfHeight, halfHeight), 0.0f);
+    const Vec3 offset = origin - axisPoint;
+    if (dot(offset, offset) <= radius * radius)
+        return false;
+
+    bool found = RayCylinderSide(origin, direction, radius, halfHeight, maxDistance, outDistance, outNormal);
+
+    for (float capY : {-halfHeight, halfHeight})
+    {
+        const Vec3 center(0.0f, capY, 0.0f);
+        float t;
+        if (RaySphere(origin, direction, center, radius, found ? outDistance : maxDistance, t) &&
+            (!found || t < outDistance))
+        {
+            found = true;
+            outDistance = t;
+            outNormal = (origin + direction * t - center) / radius;
+        }
+    }
+
+    return found;
+}
+
+bool RayCylinderShape(const CylinderShape& cylinder, const Vec3& origin, const Vec3& direction,
+                      float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    const float radius = cylinder.GetRadius();
+    const float halfHeight = cylinder.GetHalfHeight();
+
+    if (std::abs(origin.y) <= halfHeight && origin.x * origin.x + origin.z * origin.z <= radius * radius)
+        return false;
+
+    bool found = RayCylinderSide(origin, direction, radius, halfHeight, maxDistance, outDistance, outNormal);
+
+    if (std::abs(direction.y) >= kParallelEpsilon)
+    {
+        // Only the cap facing the ray can be entered
+        const float capY = direction.y > 0.0f ? -halfHeight : halfHeight;
+        const float t = (capY - origin.y) / direction.y;
+        const Vec3 point = origin + direction * t;
+        if (t >= 0.0f && t <= maxDistance && (!found || t < outDistance) &&
+            point.x * point.x + point.z * point.z <= radius * radius)
+        {
+            found = true;
+            outDistance = t;
+            outNormal = Vec3(0.0f, direction.y > 0.0f ? -1.0f : 1.0f, 0.0f);
+        }
+    }
+
+    return found;
+}
+
+/// Nearest two-sided triangle hit; the normal faces the ray origin
+bool RayTriangle(const Ray& ray, const Vec3& v0, const Vec3& v1, const Vec3& v2,
+                 float& outDistance, Vec3& outNormal)
+{
+    float t, u, v;
+    if (!RayTriangleIntersect(ray, v0, v1, v2, t, u, v))
+        return false;
+
+    Vec3 normal = cross(v1 - v0, v2 - v0);
+    const float len = length(normal);
+    if (len <= 0.0f)
+        return false;
+
+    normal /= len;
+    outDistance = t;
+    outNormal = dot(normal, ray.direction) > 0.0f ? -normal : normal;
+    return true;
+}
+
+bool RayTriangleMeshShape(const TriangleMeshShape& mesh, const Vec3& origin, const Vec3& direction,
+                          float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    Ray ray(origin, direction, 0.0f, maxDistance);
+    bool found = false;
+    for (const auto& tri : mesh.GetTriangles())
+    {
+        float t;
+        Vec3 normal;
+        if (RayTriangle(ray, tri.v0, tri.v1, tri.v2, t, normal))
+        {
+            found = true;
+            ray.tMax = t;
+            outDistance = t;
+            outNormal = normal;
+        }
+    }
+    return found;
+}
+
+/// Walk the cells under the ray in order (Amanatides-Woo) and stop at the first hit
+bool RayHeightFieldShape(const HeightFieldShape& field, const Vec3& origin, const Vec3& direction,
+                         float maxDistance, float& outDistance, Vec3& outNormal)
+{
+    if (field.GetWidth() < 2 || field.GetDepth() < 2)
+        return false;
+
+    Vec3 boundsMin, boundsMax;
+    field.GetLocalBounds(boundsMin, boundsMax);
+
+    // Clip the ray to the field's bounds
+    float tEnter = 0.0f;
+    float tExit = maxDistance;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (std::abs(direction[i]) < kParallelEpsilon)
+        {
+            if (origin[i] < boundsMin[i] || origin[i] > boundsMax[i])
+                return false;
+            continue;
+        }
+
+        float t0 = (boundsMin[i] - origin[i]) / direction[i];
+        float t1 = (boundsMax[i] - origin[i]) / direction[i];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        tEnter = std::max(tEnter, t0);
+        tExit = std::min(tExit, t1);
+        if (tEnter > tExit)
+            return false;
+    }
+
+    const Vec3& scale = field.GetScale();
+    const int maxCellX = static_cast<int>(field.GetWidth()) - 2;
+    const int maxCellZ = static_cast<int>(field.GetDepth()) - 2;
+
+    const Vec3 start = origin + direction * tEnter;
+    int x = std::clamp(static_cast<int>(std::floor((start.x - boundsMin.x) / scale.x)), 0, maxCellX);
+    int z = std::clamp(static_cast<int>(std::floor((start.z - boundsMin.z) / scale.z)), 0, maxCellZ);
+
+    const int stepX = direction.x > 0.0f ? 1 : -1;
+    const int stepZ = direction.z > 0.0f ? 1 : -1;
+    const float inf = std::numeric_limits<float>::max();
+    const bool moveX = std::abs(direction.x) >= kParallelEpsilon;
+    const bool moveZ = std::abs(direction.z) >= kParallelEpsilon;
+    const float deltaX = moveX ? scale.x / std::abs(direction.x) : inf;
+    const float deltaZ = moveZ ? scale.z / std::abs(direction.z) : inf;
+    float nextX = moveX ? (boundsMin.x + (x + (stepX > 0 ? 1 : 0)) * scale.x - origin.x) / direction.x : inf;
+    float nextZ = moveZ ? (boundsMin.z + (z + (stepZ > 0 ? 1 : 0)) * scale.z - origin.z) / direction.z : inf;
+
+    const Ray ray(origin, direction, 0.0f, maxDistance);
+    while (true)
+    {
+        Vec3 v00, v10, v01, v11;
+        ShapeQuery::GetHeightFieldCell(field, static_cast<uint32>(x), static_cast<uint32>(z), v00, v10, v01, v11);
+
+        // A hit inside this cell's footprint is nearer than any later cell
+        bool found = false;
+        float t;
+        Vec3 normal;
+        if (RayTriangle(ray, v00, v11, v10, t, normal))
+        {
+            found = true;
+            outDistance = t;
+            outNormal = normal;
+        }
+        if (RayTriangle(ray, v00, v01, v11, t, normal) && (!found || t < outDistance))
+        {
+            found = true;
+            outDistance = t;
+            outNormal = normal;
+        }
+        if (found)
+            return true;
+
+        if (nextX < nextZ)
+        {
+            if (nextX > tExit)
+                return false;
+            x += stepX;
+            nextX += deltaX;
+        }
+        else
+        {
+            if (nextZ > tExit)
+                return false;
+            z += stepZ;
+            nextZ += deltaZ;
+        }
+
+        if (x < 0 || x > maxCellX || z < 0 || z > maxCellZ)
+            return false;
+    }
+}
+
+bool RayConvexHullShape(const CollisionShape& hull, const Vec3& position, const Quat& rotation,
+                        const Vec3& origin, const Vec3& direction, float maxDistance,
+                        float& outDistance, Vec3& outNormal)
+{
+    const Geometry::ConvexSphere point(origin, 0.0f);
+    const WorldConvexShape target(hull, position, rotation);
+
+    Vec3 hitPoint;
+    if (!ShapeQuery::CastConvex(point, direction, maxDistance, target, outDistance, hitPoint, outNormal))
+        return false;
+
+    // Origin inside the hull
+    return outDistance > 0.0f;
+}
+
+} // anonymous namespace
+
+bool RaycastQuery::RayCastShape(const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                                const Vec3& origin, const Vec3& direction, float maxDistance,
+                                float& outDistance, Vec3& outNormal)
+{
+    if (shape.GetType() == ShapeType::ConvexHull)
+        return RayConvexHullShape(shape, position, rotation, origin, direction, maxDistance, outDistance, outNormal);
+
+    if (shape.GetType() == ShapeType::Compound)
+    {
+        bool found = false;
+        for (const auto& child : static_cast<const CompoundShape&>(shape).GetChildren())
+        {
+            float t;
+            Vec3 normal;
+            if (RayCastShape(*child.shape, position + rotation * child.offset, rotation * child.rotation,
+                             origin, direction, found ? outDistance : maxDistance, t, normal) &&
+                (!found || t < outDistance))
+            {
+                found = true;
+                outDistance = t;
+                outNormal = normal;
+            }
+        }
+        return found;
+    }
+
+    // Everything else is tested in the shape's local frame
+    const Quat inverse = glm::conjugate(rotation);
+    const Vec3 localOrigin = inverse * (origin - position);
+    const Vec3 localDirection = inverse * direction;
+
+    Vec3 localNormal;
+    bool found = false;
+    switch (shape.GetType())
+    {
+        case ShapeType::Sphere:
+            found = RaySphereShape(static_cast<const SphereShape&>(shape), localOrigin, localDirection,
+                                   maxDistance, outDistance, localNormal);
+            break;
+        case ShapeType::Box:
+            found = RayBoxShape(static_cast<const BoxShape&>(shape), localOrigin, localDirection,
+                                maxDistance, outDistance, localNormal);
+            break;
+        case ShapeType::Capsule:
+            found = RayCapsuleShape(static_cast<const CapsuleShape&>(shape), localOrigin, localDirection,
+                                    maxDistance, outDistance, localNormal);
+            break;
+        case ShapeType::Cylinder:
+            found = RayCylinderShape(static_cast<const CylinderShape&>(shape), localOrigin, localDirection,
+                                     maxDistance, outDistance, localNormal);
+            break;
+        case ShapeType::TriangleMesh:
+            found = RayTriangleMeshShape(static_cast<const TriangleMeshShape&>(shape), localOrigin, localDirection,
+                                         maxDistance, outDistance, localNormal);
+            break;
+        case ShapeType::HeightField:
+            found = RayHeightFieldShape(static_cast<const HeightFieldShape&>(shape), localOrigin, localDirection,
+                                        maxDistance, outDistance, localNormal);
+            break;
+        default:
+            break;
+    }
+
+    if (found)
+        outNormal = rotation * localNormal;
+    return found;
+}
+
+bool RaycastQuery::RayCastBody(const RigidBody& body, const Vec3& origin, const Vec3& direction,
+                               float maxDistance, RaycastHit& hit)
+{
+    const Vec3 bodyPosition = body.GetPosition();
+    const Quat bodyRotation = body.GetRotation();
+    const auto& shapes = body.GetShapes();
+
+    bool found = false;
+    float best = maxDistance;
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        const auto& instance = shapes[i];
+        float distance;
+        Vec3 normal;
+        if (RayCastShape(*instance.shape, bodyPosition + bodyRotation * instance.offset,
+                         bodyRotation * instance.rotation, origin, direction, best, distance, normal) &&
+            (!found || distance < best))
+        {
+            found = true;
+            best = distance;
+            hit.normal = normal;
+            hit.shapeIndex = static_cast<uint32>(i);
+        }
+    }
+
+    if (found)
+    {
+        hit.hit = true;
+        hit.distance = best;
+        hit.point = origin + direction * best;
+        hit.bodyId = body.GetId();
+    }
+    return found;
+}
 
 } // namespace RVX::Physics
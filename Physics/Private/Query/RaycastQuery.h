@@ -0,0 +1,43 @@
+/**
+ * @file RaycastQuery.h
+ * @brief Exact ray tests against collision shapes
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Physics/RigidBody.h"
+#include "Physics/Shapes/CollisionShape.h"
+
+namespace RVX::Physics
+{
+
+/**
+ * @brief Ray tests against a single placed shape
+ *
+ * Spheres, boxes, capsules and cylinders are solved analytically, convex
+ * hulls by conservative advancement, mesh triangles two-sided and height
+ * fields by walking the cells under the ray. Rays that start inside a
+ * solid shape do not hit it.
+ */
+class RaycastQuery
+{
+public:
+    /**
+     * @brief Cast a ray against a shape placed in the world
+     * @param direction Normalized ray direction
+     * @param outNormal World-space surface normal facing the ray origin
+     */
+    static bool RayCastShape(const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                             const Vec3& origin, const Vec3& direction, float maxDistance,
+                             float& outDistance, Vec3& outNormal);
+
+    /**
+     * @brief Cast a ray against every shape of a body
+     * @param hit Closest hit, including the index of the shape that was hit
+     */
+    static bool RayCastBody(const RigidBody& body, const Vec3& origin, const Vec3& direction,
+                            float maxDistance, RaycastHit& hit);
+};
+
+} // namespace RVX::Physics
@@ -1,321 +1,557 @@
 /**
  * @file ShapeQuery.cpp
- * @brief Shape-based spatial queries (overlap, sweep, etc.)
+ * @brief Shape-based spatial queries (overlap, sweep, distance)
  */
 
-#include "Physics/PhysicsTypes.h"
-#include "Physics/RigidBody.h"
-#include "Physics/Shapes/CollisionShape.h"
-#include <vector>
-#include <cmath>
-#include <algorithm>
+#include "ShapeQuery.h"
+#include "BuiltIn/CollisionDetection.h"
+#include <limits>
 
 namespace RVX::Physics
 {
 
+namespace
+{
+
+constexpr int kMaxDistanceIterations = 32;
+constexpr int kMaxCastIterations = 32;
+constexpr float kOverlapDistanceSq = 1e-10f;   // Origin inside the simplex for all practical purposes
+constexpr float kRelativeTolerance = 1e-6f;    // GJK stops once a step gains less than this fraction
+constexpr float kTouchDistance = 1e-4f;
+constexpr float kCastTarget = 1e-3f;           // Gap conservative advancement stops at
+
+struct SimplexVertex
+{
+    Vec3 a;     // Support point on A
+    Vec3 b;     // Support point on B
+    Vec3 w;     // a - b
+};
+
 /**
- * @brief Shape query system for spatial queries
- * 
- * Provides:
- * - Sphere/box/capsule overlap queries
- * - Shape sweep tests (for CCD)
- * - Point containment tests
+ * @brief GJK simplex that reduces itself to the feature closest to the origin
+ *
+ * Closest-feature tests follow Ericson, Real-Time Collision Detection 5.1.
  */
-class ShapeQuery
+struct Simplex
 {
-public:
-    // =========================================================================
-    // Overlap Queries
-    // =========================================================================
-
-    /**
-     * @brief Find all bodies overlapping a sphere
-     */
-    static size_t OverlapSphere(const Vec3& center, float radius,
-                                const std::vector<RigidBody*>& bodies,
-                                std::vector<RigidBody*>& outBodies,
-                                uint32 layerMask = 0xFFFFFFFF)
+    SimplexVertex v[4];
+    float lambda[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+    int count = 0;
+
+    Vec3 Solve()
     {
-        outBodies.clear();
+        switch (count)
+        {
+            case 1:  lambda[0] = 1.0f; return v[0].w;
+            case 2:  return SolveSegment();
+            case 3:  return SolveTriangle();
+            default: return SolveTetrahedron();
+        }
+    }
 
-        for (auto* body : bodies)
+    void Witness(Vec3& pointA, Vec3& pointB) const
+    {
+        pointA = Vec3(0.0f);
+        pointB = Vec3(0.0f);
+        for (int i = 0; i < count; ++i)
         {
-            if (!body) continue;
-            
-            // Layer check
-            if ((body->GetLayer() & layerMask) == 0)
-                continue;
+            pointA += lambda[i] * v[i].a;
+            pointB += lambda[i] * v[i].b;
+        }
+    }
 
-            // Simple distance check (would need shape-specific tests for accuracy)
-            Vec3 toBody = body->GetPosition() - center;
-            float dist = length(toBody);
+private:
+    void Keep(int i0)
+    {
+        v[0] = v[i0];
+        lambda[0] = 1.0f;
+        count = 1;
+    }
 
-            // Estimate body radius from shapes
-            float bodyRadius = 1.0f;  // Default estimate
-            // Would iterate body shapes here
+    void Keep(int i0, int i1, float l0, float l1)
+    {
+        const SimplexVertex a = v[i0], b = v[i1];
+        v[0] = a; v[1] = b;
+        lambda[0] = l0; lambda[1] = l1;
+        count = 2;
+    }
 
-            if (dist < radius + bodyRadius)
-            {
-                outBodies.push_back(body);
-            }
+    Vec3 SolveSegment()
+    {
+        const Vec3 ab = v[1].w - v[0].w;
+        const float lenSq = dot(ab, ab);
+        const float t = lenSq > 0.0f ? -dot(v[0].w, ab) / lenSq : 0.0f;
+        if (t <= 0.0f)
+        {
+            Keep(0);
+            return v[0].w;
         }
-
-        return outBodies.size();
+        if (t >= 1.0f)
+        {
+            Keep(1);
+            return v[0].w;
+        }
+        lambda[0] = 1.0f - t;
+        lambda[1] = t;
+        return v[0].w + t * ab;
     }
 
-    /**
-     * @brief Find all bodies overlapping a box
-     */
-    static size_t OverlapBox(const Vec3& center, const Vec3& halfExtents,
-                             const Quat& rotation,
-                             const std::vector<RigidBody*>& bodies,
-                             std::vector<RigidBody*>& outBodies,
-                             uint32 layerMask = 0xFFFFFFFF)
+    Vec3 SolveTriangle()
     {
-        outBodies.clear();
-
-        // Compute box AABB (conservative)
-        Mat3 rotMat = mat3_cast(rotation);
-        Vec3 absExtents(
-            std::abs(rotMat[0][0]) * halfExtents.x + 
-            std::abs(rotMat[1][0]) * halfExtents.y + 
-            std::abs(rotMat[2][0]) * halfExtents.z,
-            std::abs(rotMat[0][1]) * halfExtents.x + 
-            std::abs(rotMat[1][1]) * halfExtents.y + 
-            std::abs(rotMat[2][1]) * halfExtents.z,
-            std::abs(rotMat[0][2]) * halfExtents.x + 
-            std::abs(rotMat[1][2]) * halfExtents.y + 
-            std::abs(rotMat[2][2]) * halfExtents.z
-        );
-
-        Vec3 boxMin = center - absExtents;
-        Vec3 boxMax = center + absExtents;
-
-        for (auto* body : bodies)
+        const Vec3 a = v[0].w, b = v[1].w, c = v[2].w;
+        const Vec3 ab = b - a, ac = c - a;
+
+        const float d1 = dot(ab, -a), d2 = dot(ac, -a);
+        if (d1 <= 0.0f && d2 <= 0.0f)
         {
-            if (!body) continue;
+            Keep(0);
+            return a;
+        }
 
-            if ((body->GetLayer() & layerMask) == 0)
-                continue;
+        const float d3 = dot(ab, -b), d4 = dot(ac, -b);
+        if (d3 >= 0.0f && d4 <= d3)
+        {
+            Keep(1);
+            return b;
+        }
 
-            // AABB overlap for now
-            Vec3 bodyMin, bodyMax;
-            GetBodyAABB(*body, bodyMin, bodyMax);
+        const float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        {
+            const float t = d1 / (d1 - d3);
+            Keep(0, 1, 1.0f - t, t);
+            return a + t * ab;
+        }
 
-            if (AABBOverlap(boxMin, boxMax, bodyMin, bodyMax))
-            {
-                outBodies.push_back(body);
-            }
+        const float d5 = dot(ab, -c), d6 = dot(ac, -c);
+        if (d6 >= 0.0f && d5 <= d6)
+        {
+            Keep(2);
+            return c;
+        }
+
+        const float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        {
+            const float t = d2 / (d2 - d6);
+            Keep(0, 2, 1.0f - t, t);
+            return a + t * ac;
+        }
+
+        const float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+        {
+            const float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            Keep(1, 2, 1.0f - t, t);
+            return b + t * (c - b);
+        }
+
+        const float sum = va + vb + vc;
+        if (sum <= 0.0f)
+        {
+            // Degenerate triangle: fall back to its longest edge
+            const float lenAB = dot(ab, ab), lenAC = dot(ac, ac), lenBC = dot(c - b, c - b);
+            if (lenAC > lenAB && lenAC >= lenBC)
+                Keep(0, 2, 0.5f, 0.5f);
+            else if (lenBC > lenAB)
+                Keep(1, 2, 0.5f, 0.5f);
+            count = 2;
+            return SolveSegment();
         }
 
-        return outBodies.size();
+        const float denom = 1.0f / sum;
+        const float tb = vb * denom, tc = vc * denom;
+        lambda[0] = 1.0f - tb - tc;
+        lambda[1] = tb;
+        lambda[2] = tc;
+        return a + ab * tb + ac * tc;
     }
 
-    /**
-     * @brief Find all bodies overlapping a capsule
-     */
-    static size_t OverlapCapsule(const Vec3& pointA, const Vec3& pointB,
-                                  float radius,
-                                  const std::vector<RigidBody*>& bodies,
-                                  std::vector<RigidBody*>& outBodies,
-                                  uint32 layerMask = 0xFFFFFFFF)
+    Vec3 SolveTetrahedron()
     {
-        outBodies.clear();
+        static constexpr int kFaces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+        const Vec3 n0 = cross(v[1].w - v[0].w, v[2].w - v[0].w);
+        const bool flat = std::abs(dot(v[3].w - v[0].w, n0)) <= 1e-12f;
 
-        // Capsule AABB
-        Vec3 capsuleMin = glm::min(pointA, pointB) - Vec3(radius);
-        Vec3 capsuleMax = glm::max(pointA, pointB) + Vec3(radius);
+        Simplex best;
+        float bestDistSq = std::numeric_limits<float>::max();
+        Vec3 bestPoint(0.0f);
+        bool outside = false;
 
-        for (auto* body : bodies)
+        for (const auto& face : kFaces)
         {
-            if (!body) continue;
+            const Vec3& a = v[face[0]].w;
+            const Vec3 n = cross(v[face[1]].w - a, v[face[2]].w - a);
+            const float signOrigin = dot(-a, n);
+            const float signOpposite = dot(v[face[3]].w - a, n);
 
-            if ((body->GetLayer() & layerMask) == 0)
+            // Only faces with the origin on their outer side can hold the closest point
+            if (!flat && signOrigin * signOpposite >= 0.0f)
                 continue;
 
-            Vec3 bodyMin, bodyMax;
-            GetBodyAABB(*body, bodyMin, bodyMax);
-
-            if (AABBOverlap(capsuleMin, capsuleMax, bodyMin, bodyMax))
+            outside = true;
+            Simplex tri;
+            tri.v[0] = v[face[0]];
+            tri.v[1] = v[face[1]];
+            tri.v[2] = v[face[2]];
+            tri.count = 3;
+            const Vec3 point = tri.SolveTriangle();
+            const float distSq = dot(point, point);
+            if (distSq < bestDistSq)
             {
-                // More precise check would go here
-                outBodies.push_back(body);
+                bestDistSq = distSq;
+                bestPoint = point;
+                best = tri;
             }
         }
 
-        return outBodies.size();
+        if (!outside)
+        {
+            // Origin inside the tetrahedron
+            return Vec3(0.0f);
+        }
+
+        *this = best;
+        return bestPoint;
     }
+};
 
-    // =========================================================================
-    // Sweep Tests (CCD)
-    // =========================================================================
-
-    /**
-     * @brief Sweep a sphere through the world
-     */
-    static bool SweepSphere(const Vec3& start, float radius,
-                            const Vec3& direction, float maxDistance,
-                            const std::vector<RigidBody*>& bodies,
-                            ShapeCastHit& outHit,
-                            uint32 layerMask = 0xFFFFFFFF)
-    {
-        outHit = ShapeCastHit{};
-        outHit.fraction = 1.0f;
-        bool hit = false;
+/// Convex shape moved along a sweep
+class TranslatedConvexShape final : public Geometry::IConvexShape
+{
+public:
+    TranslatedConvexShape(const Geometry::IConvexShape& shape, const Vec3& offset)
+        : m_shape(shape), m_offset(offset) {}
 
-        Vec3 normalizedDir = length(direction) > 0.001f 
-            ? normalize(direction) : Vec3(0, 0, 1);
+    Vec3 Support(const Vec3& direction) const override { return m_shape.Support(direction) + m_offset; }
+    Vec3 GetCenter() const override { return m_shape.GetCenter() + m_offset; }
 
-        for (auto* body : bodies)
-        {
-            if (!body) continue;
+private:
+    const Geometry::IConvexShape& m_shape;
+    Vec3 m_offset;
+};
 
-            if ((body->GetLayer() & layerMask) == 0)
-                continue;
+bool IsTouching(const ConvexDistanceResult& result)
+{
+    return result.overlapping || result.distance <= kTouchDistance;
+}
 
-            // Simple sphere sweep against body center
-            Vec3 bodyPos = body->GetPosition();
-            float bodyRadius = 1.0f;  // Estimate
+/// Bounds of a box after rotation and translation
+AABB TransformBounds(const Vec3& min, const Vec3& max, const Vec3& translation, const Quat& rotation)
+{
+    const Mat3 m = glm::mat3_cast(rotation);
+    const Vec3 center = translation + m * ((min + max) * 0.5f);
+    const Vec3 half = (max - min) * 0.5f;
 
-            // Sphere-sphere sweep
-            float hitFraction;
-            if (SphereSweepSphere(start, radius, normalizedDir, maxDistance,
-                                  bodyPos, bodyRadius, hitFraction))
-            {
-                if (hitFraction < outHit.fraction)
-                {
-                    outHit.hit = true;
-                    outHit.fraction = hitFraction;
-                    outHit.point = start + normalizedDir * (hitFraction * maxDistance);
-                    outHit.normal = normalize(outHit.point - bodyPos);
-                    outHit.bodyId = body->GetId();
-                    hit = true;
-                }
-            }
-        }
+    Vec3 extent;
+    for (int i = 0; i < 3; ++i)
+        extent[i] = std::abs(m[0][i]) * half.x + std::abs(m[1][i]) * half.y + std::abs(m[2][i]) * half.z;
 
-        return hit;
-    }
+    return AABB(center - extent, center + extent);
+}
 
-    /**
-     * @brief Sweep a box through the world
-     */
-    static bool SweepBox(const Vec3& start, const Vec3& halfExtents,
-                         const Quat& rotation,
-                         const Vec3& direction, float maxDistance,
-                         const std::vector<RigidBody*>& bodies,
-                         ShapeCastHit& outHit,
-                         uint32 layerMask = 0xFFFFFFFF)
-    {
-        // Use sphere sweep with bounding radius for now
-        float boundingRadius = length(halfExtents);
-        return SweepSphere(start, boundingRadius, direction, maxDistance,
-                           bodies, outHit, layerMask);
-    }
+/// World bounds expressed in a shape's local frame
+AABB ToLocalBounds(const AABB& worldBounds, const Vec3& position, const Quat& rotation)
+{
+    const Quat inverse = glm::conjugate(rotation);
+    return TransformBounds(worldBounds.GetMin(), worldBounds.GetMax(), inverse * -position, inverse);
+}
 
-    // =========================================================================
-    // Point Queries
-    // =========================================================================
+} // anonymous namespace
 
-    /**
-     * @brief Check if a point is inside any body
-     */
-    static RigidBody* PointQuery(const Vec3& point,
-                                  const std::vector<RigidBody*>& bodies,
-                                  uint32 layerMask = 0xFFFFFFFF)
+ConvexDistanceResult ShapeQuery::ConvexDistance(const Geometry::IConvexShape& a, const Geometry::IConvexShape& b)
+{
+    ConvexDistanceResult result;
+
+    Vec3 direction = a.GetCenter() - b.GetCenter();
+    if (dot(direction, direction) < 1e-12f)
+        direction = Vec3(1, 0, 0);
+
+    Simplex simplex;
+    const Vec3 supportA = a.Support(-direction);
+    const Vec3 supportB = b.Support(direction);
+    simplex.v[0] = {supportA, supportB, supportA - supportB};
+    simplex.count = 1;
+
+    Vec3 closest = simplex.v[0].w;
+    for (int iteration = 0; iteration < kMaxDistanceIterations; ++iteration)
     {
-        for (auto* body : bodies)
+        const float distSq = dot(closest, closest);
+        if (distSq <= kOverlapDistanceSq)
         {
-            if (!body) continue;
+            result.overlapping = true;
+            break;
+        }
 
-            if ((body->GetLayer() & layerMask) == 0)
-                continue;
+        const Vec3 sa = a.Support(-closest);
+        const Vec3 sb = b.Support(closest);
+        const Vec3 w = sa - sb;
 
-            Vec3 bodyMin, bodyMax;
-            GetBodyAABB(*body, bodyMin, bodyMax);
+        // The new support point cannot bring the simplex meaningfully closer
+        if (distSq - dot(closest, w) <= kRelativeTolerance * distSq)
+            break;
 
-            if (PointInAABB(point, bodyMin, bodyMax))
-            {
-                // More precise shape check would go here
-                return body;
-            }
+        bool duplicate = false;
+        for (int i = 0; i < simplex.count; ++i)
+        {
+            const Vec3 delta = simplex.v[i].w - w;
+            duplicate |= dot(delta, delta) <= 1e-12f;
         }
+        if (duplicate)
+            break;
 
-        return nullptr;
+        simplex.v[simplex.count++] = {sa, sb, w};
+        closest = simplex.Solve();
+
+        if (simplex.count == 4)
+        {
+            result.overlapping = true;
+            break;
+        }
     }
 
-    /**
-     * @brief Get closest point on a body to a given point
-     */
-    static Vec3 ClosestPoint(const Vec3& point, RigidBody* body)
+    simplex.Witness(result.pointA, result.pointB);
+    result.distance = result.overlapping ? 0.0f : length(closest);
+    return result;
+}
+
+bool ShapeQuery::CastConvex(const Geometry::IConvexShape& shape, const Vec3& direction, float maxDistance,
+                            const Geometry::IConvexShape& target,
+                            float& outDistance, Vec3& outPoint, Vec3& outNormal)
+{
+    float t = 0.0f;
+    for (int iteration = 0; iteration < kMaxCastIterations; ++iteration)
     {
-        if (!body) return point;
+        const TranslatedConvexShape moved(shape, direction * t);
+        const ConvexDistanceResult result = ConvexDistance(moved, target);
 
-        // Simplified: clamp to body AABB
-        Vec3 bodyMin, bodyMax;
-        GetBodyAABB(*body, bodyMin, bodyMax);
+        if (result.overlapping || result.distance <= kCastTarget)
+        {
+            outDistance = t;
+            if (result.overlapping)
+            {
+                outPoint = moved.GetCenter();
+                outNormal = -direction;
+            }
+            else
+            {
+                const Vec3 separation = result.pointA - result.pointB;
+                const float len = length(separation);
+                outPoint = result.pointB;
+                outNormal = len > 1e-8f ? separation / len : -direction;
+            }
+            return true;
+        }
 
-        return Vec3(
-            std::clamp(point.x, bodyMin.x, bodyMax.x),
-            std::clamp(point.y, bodyMin.y, bodyMax.y),
-            std::clamp(point.z, bodyMin.z, bodyMax.z)
-        );
+        // Advance up to the plane through the closest points
+        const Vec3 normal = (result.pointA - result.pointB) / result.distance;
+        const float approach = -dot(direction, normal);
+        if (approach <= 1e-6f)
+            return false;
+
+        t += (result.distance - 0.5f * kCastTarget) / approach;
+        if (t > maxDistance)
+            return false;
     }
 
-private:
-    static void GetBodyAABB(const RigidBody& body, Vec3& outMin, Vec3& outMax)
+    return false;
+}
+
+bool ShapeQuery::CastShape(const CollisionShape& castShape, const Vec3& origin, const Quat& castRotation,
+                           const Vec3& direction, float maxDistance,
+                           const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                           float& outDistance, Vec3& outPoint, Vec3& outNormal)
+{
+    if (!IsConvex(castShape))
+        return false;
+
+    const WorldConvexShape moving(castShape, origin, castRotation);
+
+    switch (shape.GetType())
     {
-        Vec3 pos = body.GetPosition();
-        float radius = 1.0f;  // Default estimate
+        case ShapeType::TriangleMesh:
+        case ShapeType::HeightField:
+        {
+            AABB sweepBounds = ComputeBounds(castShape, origin, castRotation);
+            sweepBounds.Expand(ComputeBounds(castShape, origin + direction * maxDistance, castRotation));
+            const AABB localBounds = ToLocalBounds(sweepBounds, position, rotation);
+
+            bool found = false;
+            float best = maxDistance;
+            ForEachTriangle(shape, localBounds.GetMin(), localBounds.GetMax(),
+                [&](const Vec3& v0, const Vec3& v1, const Vec3& v2)
+                {
+                    const Geometry::ConvexTriangle triangle(position + rotation * v0,
+                                                            position + rotation * v1,
+                                                            position + rotation * v2);
+                    float distance;
+                    Vec3 point, normal;
+                    if (CastConvex(moving, direction, best, triangle, distance, point, normal) &&
+                        (!found || distance < best))
+                    {
+                        found = true;
+                        best = distance;
+                        outPoint = point;
+                        outNormal = normal;
+                    }
+                    return true;
+                });
+
+            if (found)
+                outDistance = best;
+            return found;
+        }
 
-        outMin = pos - Vec3(radius);
-        outMax = pos + Vec3(radius);
+        case ShapeType::Compound:
+        {
+            bool found = false;
+            float best = maxDistance;
+            for (const auto& child : static_cast<const CompoundShape&>(shape).GetChildren())
+            {
+                float distance;
+                Vec3 point, normal;
+                if (CastShape(castShape, origin, castRotation, direction, best, *child.shape,
+                              position + rotation * child.offset, rotation * child.rotation,
+                              distance, point, normal) &&
+                    (!found || distance < best))
+                {
+                    found = true;
+                    best = distance;
+                    outPoint = point;
+                    outNormal = normal;
+                }
+            }
+
+            if (found)
+                outDistance = best;
+            return found;
+        }
+
+        default:
+        {
+            const WorldConvexShape target(shape, position, rotation);
+            return CastConvex(moving, direction, maxDistance, target, outDistance, outPoint, outNormal);
+        }
     }
+}
+
+bool ShapeQuery::CastBody(const CollisionShape& castShape, const Vec3& origin, const Quat& castRotation,
+                          const Vec3& direction, float maxDistance,
+                          const RigidBody& body, ShapeCastHit& hit)
+{
+    const Vec3 bodyPosition = body.GetPosition();
+    const Quat bodyRotation = body.GetRotation();
 
-    static bool AABBOverlap(const Vec3& minA, const Vec3& maxA,
-                            const Vec3& minB, const Vec3& maxB)
+    bool found = false;
+    float best = maxDistance;
+    for (const auto& instance : body.GetShapes())
     {
-        return (minA.x <= maxB.x && maxA.x >= minB.x) &&
-               (minA.y <= maxB.y && maxA.y >= minB.y) &&
-               (minA.z <= maxB.z && maxA.z >= minB.z);
+        float distance;
+        Vec3 point, normal;
+        if (CastShape(castShape, origin, castRotation, direction, best, *instance.shape,
+                      bodyPosition + bodyRotation * instance.offset, bodyRotation * instance.rotation,
+                      distance, point, normal) &&
+            (!found || distance < best))
+        {
+            found = true;
+            best = distance;
+            hit.point = point;
+            hit.normal = normal;
+        }
     }
 
-    static bool PointInAABB(const Vec3& point, const Vec3& min, const Vec3& max)
+    if (found)
     {
-        return point.x >= min.x && point.x <= max.x &&
-               point.y >= min.y && point.y <= max.y &&
-               point.z >= min.z && point.z <= max.z;
+        hit.hit = true;
+        hit.fraction = maxDistance > 0.0f ? best / maxDistance : 0.0f;
+        hit.bodyId = body.GetId();
     }
+    return found;
+}
+
+bool ShapeQuery::OverlapShape(const CollisionShape& queryShape, const Vec3& queryPosition, const Quat& queryRotation,
+                              const CollisionShape& shape, const Vec3& position, const Quat& rotation)
+{
+    if (!IsConvex(queryShape))
+        return false;
+
+    const WorldConvexShape query(queryShape, queryPosition, queryRotation);
 
-    static bool SphereSweepSphere(const Vec3& start, float radiusA,
-                                   const Vec3& direction, float maxDistance,
-                                   const Vec3& center, float radiusB,
-                                   float& outFraction)
+    switch (shape.GetType())
     {
-        // Treat as ray vs expanded sphere
-        float combinedRadius = radiusA + radiusB;
-        
-        Vec3 oc = start - center;
-        float a = dot(direction, direction);
-        float b = 2.0f * dot(oc, direction);
-        float c = dot(oc, oc) - combinedRadius * combinedRadius;
-        
-        float discriminant = b * b - 4.0f * a * c;
-        if (discriminant < 0)
+        case ShapeType::TriangleMesh:
+        case ShapeType::HeightField:
+        {
+            const AABB localBounds = ToLocalBounds(ComputeBounds(queryShape, queryPosition, queryRotation),
+                                                   position, rotation);
+            bool overlapping = false;
+            ForEachTriangle(shape, localBounds.GetMin(), localBounds.GetMax(),
+                [&](const Vec3& v0, const Vec3& v1, const Vec3& v2)
+                {
+                    const Geometry::ConvexTriangle triangle(position + rotation * v0,
+                                                            position + rotation * v1,
+                                                            position + rotation * v2);
+                    overlapping = IsTouching(ConvexDistance(query, triangle));
+                    return !overlapping;
+                });
+            return overlapping;
+        }
+
+        case ShapeType::Compound:
+        {
+            for (const auto& child : static_cast<const CompoundShape&>(shape).GetChildren())
+            {
+                if (OverlapShape(queryShape, queryPosition, queryRotation, *child.shape,
+                                 position + rotation * child.offset, rotation * child.rotation))
+                    return true;
+            }
             return false;
+        }
 
-        float sqrtD = std::sqrt(discriminant);
-        float t = (-b - sqrtD) / (2.0f * a);
+        default:
+        {
+            const WorldConvexShape target(shape, position, rotation);
+            return IsTouching(ConvexDistance(query, target));
+        }
+    }
+}
 
-        if (t < 0)
-            t = (-b + sqrtD) / (2.0f * a);
+bool ShapeQuery::OverlapBody(const CollisionShape& queryShape, const Vec3& queryPosition, const Quat& queryRotation,
+                             const RigidBody& body)
+{
+    const Vec3 bodyPosition = body.GetPosition();
+    const Quat bodyRotation = body.GetRotation();
 
-        if (t < 0 || t > maxDistance)
-            return false;
+    for (const auto& instance : body.GetShapes())
+    {
+        if (OverlapShape(queryShape, queryPosition, queryRotation, *instance.shape,
+                         bodyPosition + bodyRotation * instance.offset, bodyRotation * instance.rotation))
+            return true;
+    }
+    return false;
+}
 
-        outFraction = t / maxDistance;
-        return true;
+bool ShapeQuery::IsConvex(const CollisionShape& shape)
+{
+    switch (shape.GetType())
+    {
+        case ShapeType::Sphere:
+        case ShapeType::Box:
+        case ShapeType::Capsule:
+        case ShapeType::Cylinder:
+        case ShapeType::ConvexHull:
+            return true;
+        default:
+            return false;
     }
-};
+}
+
+AABB ShapeQuery::ComputeBounds(const CollisionShape& shape, const Vec3& position, const Quat& rotation)
+{
+    Vec3 localMin, localMax;
+    shape.GetLocalBounds(localMin, localMax);
+    return TransformBounds(localMin, localMax, position, rotation);
+}
 
 } // namespace RVX::Physics
@@ -0,0 +1,171 @@
+/**
+ * @file ShapeQuery.h
+ * @brief Narrowphase shape queries (distance, sweep, overlap)
+ */
+
+#pragma once
+
+#include "Physics/PhysicsTypes.h"
+#include "Physics/RigidBody.h"
+#include "Physics/Shapes/CollisionShape.h"
+#include "Core/Math/AABB.h"
+#include "Geometry/Collision/IConvexShape.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RVX::Physics
+{
+
+/**
+ * @brief Closest points between two convex shapes
+ */
+struct ConvexDistanceResult
+{
+    bool overlapping = false;
+    float distance = 0.0f;
+    Vec3 pointA{0};             ///< Closest point on shape A
+    Vec3 pointB{0};             ///< Closest point on shape B
+};
+
+/**
+ * @brief Exact queries against a single placed shape
+ *
+ * Convex shapes (sphere, box, capsule, cylinder, convex hull) are handled
+ * through their support mapping; triangle meshes and height fields are
+ * visited triangle by triangle inside the query bounds, and compounds
+ * recurse into their children. The query shape of a sweep or overlap
+ * must itself be convex.
+ *
+ * Geometry::GJK only answers intersection, so distances come from a GJK
+ * that keeps the closest point on its simplex and reports witness points.
+ */
+class ShapeQuery
+{
+public:
+    /// Distance between two convex shapes; closest points are valid when separated
+    static ConvexDistanceResult ConvexDistance(const Geometry::IConvexShape& a,
+                                               const Geometry::IConvexShape& b);
+
+    /**
+     * @brief Sweep a convex shape along a direction until it touches another
+     *
+     * Uses conservative advancement: each step moves the shape up to the
+     * plane separating the current closest points, so it never tunnels.
+     * A shape that starts overlapping reports a hit at distance 0 with the
+     * normal opposing the sweep.
+     *
+     * @param shape Convex shape placed at its start pose
+     * @param direction Normalized sweep direction
+     * @param outNormal Surface normal of the target, pointing at the swept shape
+     */
+    static bool CastConvex(const Geometry::IConvexShape& shape, const Vec3& direction, float maxDistance,
+                           const Geometry::IConvexShape& target,
+                           float& outDistance, Vec3& outPoint, Vec3& outNormal);
+
+    /// Sweep a convex shape against any shape type
+    static bool CastShape(const CollisionShape& castShape, const Vec3& origin, const Quat& castRotation,
+                          const Vec3& direction, float maxDistance,
+                          const CollisionShape& shape, const Vec3& position, const Quat& rotation,
+                          float& outDistance, Vec3& outPoint, Vec3& outNormal);
+
+    /**
+     * @brief Sweep a convex shape against every shape of a body
+     * @param hit Closest hit; fraction is relative to maxDistance
+     */
+    static bool CastBody(const CollisionShape& castShape, const Vec3& origin, const Quat& castRotation,
+                         const Vec3& direction, float maxDistance,
+                         const RigidBody& body, ShapeCastHit& hit);
+
+    /// Test a convex shape against any shape type; touching counts as overlap
+    static bool OverlapShape(const CollisionShape& queryShape, const Vec3& queryPosition, const Quat& queryRotation,
+                             const CollisionShape& shape, const Vec3& position, const Quat& rotation);
+
+    /// Test a convex shape against every shape of a body
+    static bool OverlapBody(const CollisionShape& queryShape, const Vec3& queryPosition, const Quat& queryRotation,
+                            const RigidBody& body);
+
+    /// Whether a shape has a support mapping
+    static bool IsConvex(const CollisionShape& shape);
+
+    /// World-space bounds of a placed shape
+    static AABB ComputeBounds(const CollisionShape& shape, const Vec3& position, const Quat& rotation);
+
+    /**
+     * @brief Visit the triangles of a mesh or height field that touch local bounds
+     *
+     * Height field cells are split along the (x, z) -> (x + 1, z + 1) diagonal.
+     * The callback receives local-space vertices and returns false to stop.
+     */
+    template<typename Callback>
+    static void ForEachTriangle(const CollisionShape& shape, const Vec3& localMin, const Vec3& localMax,
+                                Callback&& callback)
+    {
+        if (shape.GetType() == ShapeType::TriangleMesh)
+        {
+            for (const auto& tri : static_cast<const TriangleMeshShape&>(shape).GetTriangles())
+            {
+                const Vec3 triMin = glm::min(tri.v0, glm::min(tri.v1, tri.v2));
+                const Vec3 triMax = glm::max(tri.v0, glm::max(tri.v1, tri.v2));
+                if (triMax.x < localMin.x || triMin.x > localMax.x ||
+                    triMax.y < localMin.y || triMin.y > localMax.y ||
+                    triMax.z < localMin.z || triMin.z > localMax.z)
+                    continue;
+
+                if (!callback(tri.v0, tri.v1, tri.v2))
+                    return;
+            }
+        }
+        else if (shape.GetType() == ShapeType::HeightField)
+        {
+            const auto& field = static_cast<const HeightFieldShape&>(shape);
+            if (field.GetWidth() < 2 || field.GetDepth() < 2)
+                return;
+
+            const Vec3& scale = field.GetScale();
+            const float originX = -0.5f * (field.GetWidth() - 1) * scale.x;
+            const float originZ = -0.5f * (field.GetDepth() - 1) * scale.z;
+            const int maxCellX = static_cast<int>(field.GetWidth()) - 2;
+            const int maxCellZ = static_cast<int>(field.GetDepth()) - 2;
+
+            const int x0 = std::max(0, static_cast<int>(std::floor((localMin.x - originX) / scale.x)));
+            const int z0 = std::max(0, static_cast<int>(std::floor((localMin.z - originZ) / scale.z)));
+            const int x1 = std::min(maxCellX, static_cast<int>(std::floor((localMax.x - originX) / scale.x)));
+            const int z1 = std::min(maxCellZ, static_cast<int>(std::floor((localMax.z - originZ) / scale.z)));
+
+            for (int z = z0; z <= z1; ++z)
+            {
+                for (int x = x0; x <= x1; ++x)
+                {
+                    Vec3 v00, v10, v01, v11;
+                    GetHeightFieldCell(field, static_cast<uint32>(x), static_cast<uint32>(z), v00, v10, v01, v11);
+
+                    const float cellMinY = std::min(std::min(v00.y, v10.y), std::min(v01.y, v11.y));
+                    const float cellMaxY = std::max(std::max(v00.y, v10.y), std::max(v01.y, v11.y));
+                    if (cellMaxY < localMin.y || cellMinY > localMax.y)
+                        continue;
+
+                    if (!callback(v00, v11, v10) || !callback(v00, v01, v11))
+                        return;
+                }
+            }
+        }
+    }
+
+    /// Local-space corners of height field cell (ix, iz)
+    static void GetHeightFieldCell(const HeightFieldShape& field, uint32 ix, uint32 iz,
+                                   Vec3& v00, Vec3& v10, Vec3& v01, Vec3& v11)
+    {
+        const Vec3& scale = field.GetScale();
+        const float x0 = (static_cast<float>(ix) - 0.5f * (field.GetWidth() - 1)) * scale.x;
+        const float z0 = (static_cast<float>(iz) - 0.5f * (field.GetDepth() - 1)) * scale.z;
+        const float x1 = x0 + scale.x;
+        const float z1 = z0 + scale.z;
+
+        v00 = Vec3(x0, field.GetSampleHeight(ix, iz), z0);
+        v10 = Vec3(x1, field.GetSampleHeight(ix + 1, iz), z0);
+        v01 = Vec3(x0, field.GetSampleHeight(ix, iz + 1), z1);
+        v11 = Vec3(x1, field.GetSampleHeight(ix + 1, iz + 1), z1);
+    }
+};
+
+} // namespace RVX::Physics
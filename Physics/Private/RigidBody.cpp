@@ -194,13 +194,16 @@ void RigidBody::AddShape(std::shared_ptr<CollisionShape> shape,
 void RigidBody::SetSleeping(bool sleep)
 {
     if (m_type == BodyType::Static) return;
+    if (!sleep && m_sleeping) m_sleepTimer = 0.0f;
     m_sleeping = sleep;
 }
 
 void RigidBody::WakeUp()
 {
-    if (m_type == BodyType::Static) return;
+    if (m_type == BodyType::Static || !m_sleeping) return;
+    // Only the transition restarts the timer; the solver wakes awake bodies constantly
     m_sleeping = false;
+    m_sleepTimer = 0.0f;
 }
 
 void RigidBody::SetAllowSleep(bool allow)
@@ -248,8 +251,8 @@ RigidBody::AABB RigidBody::GetAABB() const
 
         for (const auto& corner : corners)
         {
-            // Apply rotation using quaternion
-            Vec3 rotated = instance.rotation * (corner - instance.offset) + instance.offset;
+            // Place the corner in body space: rotate about the shape origin, then offset
+            Vec3 rotated = instance.offset + instance.rotation * corner;
             // Apply world transform
             Vec3 worldPos = Vec3(worldMat * Vec4(rotated, 1.0f));
             result.min = glm::min(result.min, worldPos);
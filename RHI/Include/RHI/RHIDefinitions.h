@@ -16,7 +16,8 @@ namespace RVX
         DX12,
         Vulkan,
         Metal,
-        OpenGL
+        OpenGL,
+        Null        // Headless, in-memory device for CPU-side tests and benchmarks
     };
 
     inline const char* ToString(RHIBackendType type)
@@ -29,6 +30,7 @@ namespace RVX
             case RHIBackendType::Vulkan: return "Vulkan";
             case RHIBackendType::Metal:  return "Metal";
             case RHIBackendType::OpenGL: return "OpenGL";
+            case RHIBackendType::Null:   return "Null";
             default:                     return "Unknown";
         }
     }
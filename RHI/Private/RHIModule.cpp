@@ -26,6 +26,11 @@ namespace RVX { std::unique_ptr<IRHIDevice> CreateMetalDevice(const RHIDeviceDes
 namespace RVX { std::unique_ptr<IRHIDevice> CreateOpenGLDevice(const RHIDeviceDesc& desc); }
 #endif
 
+#if RVX_ENABLE_NULL
+// Forward declaration - implemented in RHI_Null
+namespace RVX { std::unique_ptr<IRHIDevice> CreateNullDevice(const RHIDeviceDesc& desc); }
+#endif
+
 namespace RVX
 {
     std::unique_ptr<IRHIDevice> CreateRHIDevice(RHIBackendType backend, const RHIDeviceDesc& desc)
@@ -59,6 +64,11 @@ namespace RVX
                 return CreateOpenGLDevice(desc);
 #endif
 
+#if RVX_ENABLE_NULL
+            case RHIBackendType::Null:
+                return CreateNullDevice(desc);
+#endif
+
             default:
                 RVX_RHI_ERROR("Unsupported or disabled backend: {}", ToString(backend));
                 return nullptr;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "RHI/RHIDevice.h"
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Device Statistics
+    // =============================================================================
+    /**
+     * @brief Work a Null device has accepted since creation or the last reset
+     *
+     * Command counters accumulate when a command context is submitted, so
+     * recorded but unsubmitted work does not show up. Resource counters are
+     * live object counts and are not affected by ResetNullDeviceStats.
+     */
+    struct NullDeviceStats
+    {
+        // Live resources
+        uint32 bufferCount = 0;
+        uint32 textureCount = 0;
+        uint32 descriptorSetCount = 0;
+        uint32 pipelineCount = 0;
+
+        // Submitted commands
+        uint64 submissions = 0;           ///< SubmitCommandContext(s) calls
+        uint64 commandContexts = 0;       ///< Contexts across those submissions
+        uint64 renderPasses = 0;
+        uint64 drawCalls = 0;             ///< Draw, DrawIndexed and each indirect draw
+        uint64 instances = 0;             ///< Instances across direct draws
+        uint64 primitives = 0;            ///< Vertices or indices times instances, / 3
+        uint64 dispatches = 0;
+        uint64 pipelineBinds = 0;
+        uint64 descriptorSetBinds = 0;
+        uint64 vertexBufferBinds = 0;
+        uint64 bufferBarriers = 0;
+        uint64 textureBarriers = 0;
+        uint64 copies = 0;
+
+        // Usage errors found by validation (each is also logged)
+        uint64 validationErrors = 0;
+    };
+
+    // Factory function - implemented in RHI_Null
+    std::unique_ptr<IRHIDevice> CreateNullDevice(const RHIDeviceDesc& desc);
+
+    /**
+     * @brief Statistics of a Null device
+     * @return nullptr if the device is not a Null device
+     */
+    const NullDeviceStats* GetNullDeviceStats(const IRHIDevice& device);
+
+    /**
+     * @brief Clear the command and validation counters of a Null device
+     */
+    void ResetNullDeviceStats(IRHIDevice& device);
+
+} // namespace RVX
@@ -0,0 +1,795 @@
+#include "NullCommandContext.h"
+#include "NullResources.h"
+#include "NullPipeline.h"
+
+#include <cstring>
+
+namespace RVX
+{
+    namespace
+    {
+        bool CoversWholeBuffer(const RHIBufferBarrier& barrier)
+        {
+            return barrier.offset == 0 &&
+                   (barrier.size == RVX_WHOLE_SIZE || barrier.size >= barrier.buffer->GetSize());
+        }
+
+        bool CoversWholeTexture(const RHITextureBarrier& barrier)
+        {
+            const RHISubresourceRange& range = barrier.subresourceRange;
+            return range.baseMipLevel == 0 && range.baseArrayLayer == 0 &&
+                   (range.mipLevelCount == RVX_ALL_MIPS || range.mipLevelCount >= barrier.texture->GetMipLevels()) &&
+                   (range.arrayLayerCount == RVX_ALL_LAYERS || range.arrayLayerCount >= barrier.texture->GetArraySize());
+        }
+
+        uint64 ToPrimitives(uint64 elementCount, uint64 instanceCount)
+        {
+            return elementCount / 3 * instanceCount;
+        }
+    } // namespace
+
+    NullCommandContext::NullCommandContext(NullDeviceStateRef state, RHICommandQueueType queueType)
+        : m_deviceState(std::move(state))
+        , m_queueType(queueType)
+    {
+    }
+
+    NullCommandContext::~NullCommandContext() = default;
+
+    // =============================================================================
+    // Lifecycle
+    // =============================================================================
+    void NullCommandContext::Begin()
+    {
+        if (m_recording)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Begin called on a context that is already recording");
+        }
+
+        Reset();
+        m_recording = true;
+    }
+
+    void NullCommandContext::End()
+    {
+        if (!m_recording)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "End called on a context that is not recording");
+            return;
+        }
+        if (m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "End called inside a render pass");
+            m_inRenderPass = false;
+        }
+        if (m_eventDepth != 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "End called with {} unclosed debug events", m_eventDepth);
+            m_eventDepth = 0;
+        }
+
+        m_recording = false;
+        m_ended = true;
+    }
+
+    void NullCommandContext::Reset()
+    {
+        m_recording = false;
+        m_ended = false;
+        m_inRenderPass = false;
+        m_eventDepth = 0;
+        m_pipeline = nullptr;
+        m_indexBuffer = nullptr;
+        m_stats = {};
+        m_pendingSignals.clear();
+    }
+
+    void NullCommandContext::Submit(NullDeviceStats& stats)
+    {
+        if (m_recording)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Submitting a context that is still recording");
+        }
+        else if (!m_ended)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Submitting a context with nothing recorded");
+        }
+
+        stats.commandContexts++;
+        stats.renderPasses += m_stats.renderPasses;
+        stats.drawCalls += m_stats.drawCalls;
+        stats.instances += m_stats.instances;
+        stats.primitives += m_stats.primitives;
+        stats.dispatches += m_stats.dispatches;
+        stats.pipelineBinds += m_stats.pipelineBinds;
+        stats.descriptorSetBinds += m_stats.descriptorSetBinds;
+        stats.vertexBufferBinds += m_stats.vertexBufferBinds;
+        stats.bufferBarriers += m_stats.bufferBarriers;
+        stats.textureBarriers += m_stats.textureBarriers;
+        stats.copies += m_stats.copies;
+
+        // The "GPU" has finished the moment the work is submitted. Recorded
+        // work is kept, so resubmitting a context counts and signals again.
+        for (const auto& [fence, value] : m_pendingSignals)
+        {
+            fence->Signal(value);
+        }
+    }
+
+    bool NullCommandContext::CheckRecording(const char* command)
+    {
+        if (!m_recording)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} recorded outside Begin/End", command);
+            return false;
+        }
+        return true;
+    }
+
+    // =============================================================================
+    // Debug Markers
+    // =============================================================================
+    void NullCommandContext::BeginEvent(const char* name, uint32 color)
+    {
+        (void)name;
+        (void)color;
+        m_eventDepth++;
+    }
+
+    void NullCommandContext::EndEvent()
+    {
+        if (m_eventDepth == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "EndEvent without a matching BeginEvent");
+            return;
+        }
+        m_eventDepth--;
+    }
+
+    void NullCommandContext::SetMarker(const char* name, uint32 color)
+    {
+        (void)name;
+        (void)color;
+    }
+
+    // =============================================================================
+    // Resource Barriers
+    // =============================================================================
+    void NullCommandContext::ApplyBufferBarrier(const RHIBufferBarrier& barrier)
+    {
+        if (!barrier.buffer)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Buffer barrier without a buffer");
+            return;
+        }
+
+        auto* buffer = static_cast<NullBuffer*>(barrier.buffer);
+        const RHIResourceState tracked = buffer->GetTrackedState();
+        if (!IsNullUntrackedState(tracked) && !IsNullUntrackedState(barrier.stateBefore) &&
+            tracked != barrier.stateBefore)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Buffer '{}' barrier expects state {} but it is in state {}",
+                                      buffer->GetDebugName(), static_cast<uint32>(barrier.stateBefore),
+                                      static_cast<uint32>(tracked));
+        }
+
+        // Partial ranges leave the buffer in mixed states, which are not tracked
+        buffer->SetTrackedState(CoversWholeBuffer(barrier) ? barrier.stateAfter : RHIResourceState::Undefined);
+        m_stats.bufferBarriers++;
+    }
+
+    void NullCommandContext::ApplyTextureBarrier(const RHITextureBarrier& barrier)
+    {
+        if (!barrier.texture)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Texture barrier without a texture");
+            return;
+        }
+
+        auto* texture = static_cast<NullTexture*>(barrier.texture);
+        const RHIResourceState tracked = texture->GetTrackedState();
+        if (!IsNullUntrackedState(tracked) && !IsNullUntrackedState(barrier.stateBefore) &&
+            tracked != barrier.stateBefore)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Texture '{}' barrier expects state {} but it is in state {}",
+                                      texture->GetDebugName(), static_cast<uint32>(barrier.stateBefore),
+                                      static_cast<uint32>(tracked));
+        }
+
+        texture->SetTrackedState(CoversWholeTexture(barrier) ? barrier.stateAfter : RHIResourceState::Undefined);
+        m_stats.textureBarriers++;
+    }
+
+    void NullCommandContext::BufferBarrier(const RHIBufferBarrier& barrier)
+    {
+        if (CheckRecording("BufferBarrier"))
+        {
+            ApplyBufferBarrier(barrier);
+        }
+    }
+
+    void NullCommandContext::TextureBarrier(const RHITextureBarrier& barrier)
+    {
+        if (CheckRecording("TextureBarrier"))
+        {
+            ApplyTextureBarrier(barrier);
+        }
+    }
+
+    void NullCommandContext::Barriers(
+        std::span<const RHIBufferBarrier> bufferBarriers,
+        std::span<const RHITextureBarrier> textureBarriers)
+    {
+        if (!CheckRecording("Barriers"))
+        {
+            return;
+        }
+
+        for (const auto& barrier : bufferBarriers)
+        {
+            ApplyBufferBarrier(barrier);
+        }
+        for (const auto& barrier : textureBarriers)
+        {
+            ApplyTextureBarrier(barrier);
+        }
+    }
+
+    void NullCommandContext::BeginBarrier(const RHIBufferBarrier& barrier)
+    {
+        (void)barrier;
+        CheckRecording("BeginBarrier");
+    }
+
+    void NullCommandContext::BeginBarrier(const RHITextureBarrier& barrier)
+    {
+        (void)barrier;
+        CheckRecording("BeginBarrier");
+    }
+
+    void NullCommandContext::EndBarrier(const RHIBufferBarrier& barrier)
+    {
+        BufferBarrier(barrier);
+    }
+
+    void NullCommandContext::EndBarrier(const RHITextureBarrier& barrier)
+    {
+        TextureBarrier(barrier);
+    }
+
+    // =============================================================================
+    // Render Pass
+    // =============================================================================
+    void NullCommandContext::CheckAttachment(RHITextureView* view, RHIResourceState expected, const char* kind, uint32 index)
+    {
+        if (!view)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Render pass {} attachment {} has no view", kind, index);
+            return;
+        }
+
+        auto* texture = static_cast<NullTexture*>(view->GetTexture());
+        const RHIResourceState tracked = texture->GetTrackedState();
+        const bool readOnlyDepth = expected == RHIResourceState::DepthRead && tracked == RHIResourceState::DepthWrite;
+        if (!IsNullUntrackedState(tracked) && tracked != expected && !readOnlyDepth)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Render pass {} attachment '{}' is in state {} instead of {}",
+                                      kind, texture->GetDebugName(), static_cast<uint32>(tracked),
+                                      static_cast<uint32>(expected));
+        }
+    }
+
+    void NullCommandContext::BeginRenderPass(const RHIRenderPassDesc& desc)
+    {
+        if (!CheckRecording("BeginRenderPass"))
+        {
+            return;
+        }
+        if (m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "BeginRenderPass inside another render pass");
+        }
+
+        for (uint32 i = 0; i < desc.colorAttachmentCount; ++i)
+        {
+            CheckAttachment(desc.colorAttachments[i].view, RHIResourceState::RenderTarget, "color", i);
+        }
+        if (desc.hasDepthStencil)
+        {
+            CheckAttachment(desc.depthStencilAttachment.view,
+                            desc.depthStencilAttachment.readOnly ? RHIResourceState::DepthRead : RHIResourceState::DepthWrite,
+                            "depth", 0);
+        }
+
+        m_inRenderPass = true;
+        m_stats.renderPasses++;
+    }
+
+    void NullCommandContext::EndRenderPass()
+    {
+        if (!m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "EndRenderPass without a matching BeginRenderPass");
+            return;
+        }
+        m_inRenderPass = false;
+    }
+
+    // =============================================================================
+    // Pipeline and Resource Binding
+    // =============================================================================
+    void NullCommandContext::SetPipeline(RHIPipeline* pipeline)
+    {
+        if (!CheckRecording("SetPipeline"))
+        {
+            return;
+        }
+
+        m_pipeline = static_cast<NullPipeline*>(pipeline);
+        m_stats.pipelineBinds++;
+    }
+
+    void NullCommandContext::SetVertexBuffer(uint32 slot, RHIBuffer* buffer, uint64 offset)
+    {
+        (void)slot;
+        if (!CheckRecording("SetVertexBuffer"))
+        {
+            return;
+        }
+        if (buffer && offset > buffer->GetSize())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Vertex buffer '{}' offset {} exceeds size {}",
+                                      buffer->GetDebugName(), offset, buffer->GetSize());
+        }
+        m_stats.vertexBufferBinds++;
+    }
+
+    void NullCommandContext::SetVertexBuffers(uint32 startSlot, std::span<RHIBuffer* const> buffers, std::span<const uint64> offsets)
+    {
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            SetVertexBuffer(startSlot + static_cast<uint32>(i), buffers[i], i < offsets.size() ? offsets[i] : 0);
+        }
+    }
+
+    void NullCommandContext::SetIndexBuffer(RHIBuffer* buffer, RHIFormat format, uint64 offset)
+    {
+        (void)offset;
+        if (!CheckRecording("SetIndexBuffer"))
+        {
+            return;
+        }
+        if (format != RHIFormat::R16_UINT && format != RHIFormat::R32_UINT)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Index buffer format must be R16_UINT or R32_UINT");
+        }
+        m_indexBuffer = buffer;
+    }
+
+    void NullCommandContext::SetDescriptorSet(uint32 slot, RHIDescriptorSet* set, std::span<const uint32> dynamicOffsets)
+    {
+        if (!CheckRecording("SetDescriptorSet"))
+        {
+            return;
+        }
+        if (slot >= RVX_MAX_DESCRIPTOR_SETS)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set slot {} exceeds the limit of {}",
+                                      slot, RVX_MAX_DESCRIPTOR_SETS);
+            return;
+        }
+        if (!set)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "SetDescriptorSet with a null set at slot {}", slot);
+            return;
+        }
+
+        auto* nullSet = static_cast<NullDescriptorSet*>(set);
+        if (const NullDescriptorSetLayout* layout = nullSet->GetLayout())
+        {
+            if (dynamicOffsets.size() != layout->GetDynamicBindingCount())
+            {
+                RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' needs {} dynamic offsets, got {}",
+                                          set->GetDebugName(), layout->GetDynamicBindingCount(), dynamicOffsets.size());
+            }
+        }
+
+        if (m_pipeline && m_pipeline->GetLayout() && slot >= m_pipeline->GetLayout()->GetSetLayoutCount())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set slot {} is not in the bound pipeline's layout", slot);
+        }
+
+        m_stats.descriptorSetBinds++;
+    }
+
+    void NullCommandContext::SetPushConstants(const void* data, uint32 size, uint32 offset)
+    {
+        if (!CheckRecording("SetPushConstants"))
+        {
+            return;
+        }
+        if (!data)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "SetPushConstants without data");
+        }
+        if (m_pipeline && m_pipeline->GetLayout() && offset + size > m_pipeline->GetLayout()->GetPushConstantSize())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Push constants [{}, +{}) exceed the layout's {} bytes",
+                                      offset, size, m_pipeline->GetLayout()->GetPushConstantSize());
+        }
+    }
+
+    // =============================================================================
+    // Viewport and Scissor
+    // =============================================================================
+    void NullCommandContext::SetViewport(const RHIViewport& viewport)
+    {
+        (void)viewport;
+        CheckRecording("SetViewport");
+    }
+
+    void NullCommandContext::SetViewports(std::span<const RHIViewport> viewports)
+    {
+        (void)viewports;
+        CheckRecording("SetViewports");
+    }
+
+    void NullCommandContext::SetScissor(const RHIRect& scissor)
+    {
+        (void)scissor;
+        CheckRecording("SetScissor");
+    }
+
+    void NullCommandContext::SetScissors(std::span<const RHIRect> scissors)
+    {
+        (void)scissors;
+        CheckRecording("SetScissors");
+    }
+
+    // =============================================================================
+    // Draw and Dispatch
+    // =============================================================================
+    bool NullCommandContext::CheckDraw(const char* command)
+    {
+        if (!CheckRecording(command))
+        {
+            return false;
+        }
+
+        bool valid = true;
+        if (!m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} outside a render pass", command);
+            valid = false;
+        }
+        if (!m_pipeline || m_pipeline->IsCompute())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} without a graphics pipeline bound", command);
+            valid = false;
+        }
+        return valid;
+    }
+
+    bool NullCommandContext::CheckDispatch(const char* command)
+    {
+        if (!CheckRecording(command))
+        {
+            return false;
+        }
+
+        bool valid = true;
+        if (m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} inside a render pass", command);
+            valid = false;
+        }
+        if (!m_pipeline || !m_pipeline->IsCompute())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} without a compute pipeline bound", command);
+            valid = false;
+        }
+        return valid;
+    }
+
+    void NullCommandContext::CheckBufferRange(RHIBuffer* buffer, uint64 offset, uint64 size, const char* command)
+    {
+        if (!buffer)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} without a buffer", command);
+            return;
+        }
+        if (offset > buffer->GetSize() || size > buffer->GetSize() - offset)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "{} range [{}, +{}) exceeds buffer '{}' size {}",
+                                      command, offset, size, buffer->GetDebugName(), buffer->GetSize());
+        }
+    }
+
+    void NullCommandContext::Draw(uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance)
+    {
+        (void)firstVertex;
+        (void)firstInstance;
+        if (!CheckDraw("Draw"))
+        {
+            return;
+        }
+
+        m_stats.drawCalls++;
+        m_stats.instances += instanceCount;
+        m_stats.primitives += ToPrimitives(vertexCount, instanceCount);
+    }
+
+    void NullCommandContext::DrawIndexed(uint32 indexCount, uint32 instanceCount, uint32 firstIndex, int32 vertexOffset, uint32 firstInstance)
+    {
+        (void)firstIndex;
+        (void)vertexOffset;
+        (void)firstInstance;
+        if (!CheckDraw("DrawIndexed"))
+        {
+            return;
+        }
+        if (!m_indexBuffer)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "DrawIndexed without an index buffer bound");
+            return;
+        }
+
+        m_stats.drawCalls++;
+        m_stats.instances += instanceCount;
+        m_stats.primitives += ToPrimitives(indexCount, instanceCount);
+    }
+
+    void NullCommandContext::DrawIndirect(RHIBuffer* buffer, uint64 offset, uint32 drawCount, uint32 stride)
+    {
+        if (!CheckDraw("DrawIndirect"))
+        {
+            return;
+        }
+        CheckBufferRange(buffer, offset, drawCount == 0 ? 0 : uint64(drawCount - 1) * stride + 16, "DrawIndirect");
+
+        // Argument contents are GPU data, so only the draws are counted
+        m_stats.drawCalls += drawCount;
+    }
+
+    void NullCommandContext::DrawIndexedIndirect(RHIBuffer* buffer, uint64 offset, uint32 drawCount, uint32 stride)
+    {
+        if (!CheckDraw("DrawIndexedIndirect"))
+        {
+            return;
+        }
+        if (!m_indexBuffer)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "DrawIndexedIndirect without an index buffer bound");
+            return;
+        }
+        CheckBufferRange(buffer, offset, drawCount == 0 ? 0 : uint64(drawCount - 1) * stride + 20, "DrawIndexedIndirect");
+
+        m_stats.drawCalls += drawCount;
+    }
+
+    void NullCommandContext::Dispatch(uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ)
+    {
+        if (!CheckDispatch("Dispatch"))
+        {
+            return;
+        }
+        if (groupCountX == 0 || groupCountY == 0 || groupCountZ == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Dispatch with an empty group count ({}, {}, {})",
+                                      groupCountX, groupCountY, groupCountZ);
+        }
+        m_stats.dispatches++;
+    }
+
+    void NullCommandContext::DispatchIndirect(RHIBuffer* buffer, uint64 offset)
+    {
+        if (!CheckDispatch("DispatchIndirect"))
+        {
+            return;
+        }
+        CheckBufferRange(buffer, offset, 12, "DispatchIndirect");
+        m_stats.dispatches++;
+    }
+
+    // =============================================================================
+    // Copy Operations
+    // =============================================================================
+    void NullCommandContext::CopyBuffer(RHIBuffer* src, RHIBuffer* dst, uint64 srcOffset, uint64 dstOffset, uint64 size)
+    {
+        if (!CheckRecording("CopyBuffer"))
+        {
+            return;
+        }
+        if (m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyBuffer inside a render pass");
+        }
+        CheckBufferRange(src, srcOffset, size, "CopyBuffer source");
+        CheckBufferRange(dst, dstOffset, size, "CopyBuffer destination");
+        if (src && dst && src == dst && srcOffset < dstOffset + size && dstOffset < srcOffset + size)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyBuffer source and destination ranges overlap");
+        }
+
+        // CPU-visible buffers hold real data, so copies between them are performed
+        if (src && dst && src->GetMemoryType() != RHIMemoryType::Default && dst->GetMemoryType() != RHIMemoryType::Default &&
+            srcOffset + size <= src->GetSize() && dstOffset + size <= dst->GetSize())
+        {
+            auto* srcData = static_cast<uint8*>(src->Map());
+            auto* dstData = static_cast<uint8*>(dst->Map());
+            std::memmove(dstData + dstOffset, srcData + srcOffset, static_cast<size_t>(size));
+            dst->Unmap();
+            src->Unmap();
+        }
+
+        m_stats.copies++;
+    }
+
+    void NullCommandContext::CopyTexture(RHITexture* src, RHITexture* dst, const RHITextureCopyDesc& desc)
+    {
+        (void)desc;
+        if (!CheckRecording("CopyTexture"))
+        {
+            return;
+        }
+        if (!src || !dst)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyTexture without a source or destination");
+            return;
+        }
+        if (m_inRenderPass)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyTexture inside a render pass");
+        }
+        m_stats.copies++;
+    }
+
+    void NullCommandContext::CopyBufferToTexture(RHIBuffer* src, RHITexture* dst, const RHIBufferTextureCopyDesc& desc)
+    {
+        if (!CheckRecording("CopyBufferToTexture"))
+        {
+            return;
+        }
+        if (!dst)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyBufferToTexture without a destination");
+            return;
+        }
+        CheckBufferRange(src, desc.bufferOffset, 0, "CopyBufferToTexture");
+        m_stats.copies++;
+    }
+
+    void NullCommandContext::CopyTextureToBuffer(RHITexture* src, RHIBuffer* dst, const RHIBufferTextureCopyDesc& desc)
+    {
+        if (!CheckRecording("CopyTextureToBuffer"))
+        {
+            return;
+        }
+        if (!src)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "CopyTextureToBuffer without a source");
+            return;
+        }
+        CheckBufferRange(dst, desc.bufferOffset, 0, "CopyTextureToBuffer");
+        m_stats.copies++;
+    }
+
+    // =============================================================================
+    // Query Operations
+    // =============================================================================
+    void NullCommandContext::BeginQuery(RHIQueryPool* pool, uint32 index)
+    {
+        if (CheckRecording("BeginQuery") && (!pool || index >= pool->GetCount()))
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "BeginQuery index {} out of range", index);
+        }
+    }
+
+    void NullCommandContext::EndQuery(RHIQueryPool* pool, uint32 index)
+    {
+        if (CheckRecording("EndQuery") && (!pool || index >= pool->GetCount()))
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "EndQuery index {} out of range", index);
+        }
+    }
+
+    void NullCommandContext::WriteTimestamp(RHIQueryPool* pool, uint32 index)
+    {
+        if (CheckRecording("WriteTimestamp") && (!pool || index >= pool->GetCount()))
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "WriteTimestamp index {} out of range", index);
+        }
+    }
+
+    void NullCommandContext::ResolveQueries(RHIQueryPool* pool, uint32 firstQuery, uint32 queryCount,
+                                            RHIBuffer* destBuffer, uint64 destOffset)
+    {
+        if (!CheckRecording("ResolveQueries"))
+        {
+            return;
+        }
+        if (!pool || uint64(firstQuery) + queryCount > pool->GetCount())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "ResolveQueries range [{}, +{}) out of range", firstQuery, queryCount);
+            return;
+        }
+        CheckBufferRange(destBuffer, destOffset, uint64(queryCount) * sizeof(uint64), "ResolveQueries");
+    }
+
+    void NullCommandContext::ResetQueries(RHIQueryPool* pool, uint32 firstQuery, uint32 queryCount)
+    {
+        if (CheckRecording("ResetQueries") && (!pool || uint64(firstQuery) + queryCount > pool->GetCount()))
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "ResetQueries range [{}, +{}) out of range", firstQuery, queryCount);
+        }
+    }
+
+    // =============================================================================
+    // Dynamic State
+    // =============================================================================
+    void NullCommandContext::SetStencilReference(uint32 reference)
+    {
+        (void)reference;
+        CheckRecording("SetStencilReference");
+    }
+
+    void NullCommandContext::SetBlendConstants(const float constants[4])
+    {
+        (void)constants;
+        CheckRecording("SetBlendConstants");
+    }
+
+    void NullCommandContext::SetDepthBias(float constantFactor, float slopeFactor, float clamp)
+    {
+        (void)constantFactor;
+        (void)slopeFactor;
+        (void)clamp;
+        CheckRecording("SetDepthBias");
+    }
+
+    void NullCommandContext::SetDepthBounds(float minDepth, float maxDepth)
+    {
+        if (CheckRecording("SetDepthBounds") && minDepth > maxDepth)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "SetDepthBounds with min {} above max {}", minDepth, maxDepth);
+        }
+    }
+
+    void NullCommandContext::SetStencilReferenceSeparate(uint32 frontRef, uint32 backRef)
+    {
+        (void)frontRef;
+        (void)backRef;
+        CheckRecording("SetStencilReferenceSeparate");
+    }
+
+    void NullCommandContext::SetLineWidth(float width)
+    {
+        (void)width;
+        CheckRecording("SetLineWidth");
+    }
+
+    // =============================================================================
+    // Synchronization
+    // =============================================================================
+    void NullCommandContext::SignalFence(RHIFence* fence, uint64 value)
+    {
+        if (!CheckRecording("SignalFence"))
+        {
+            return;
+        }
+        if (!fence)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "SignalFence without a fence");
+            return;
+        }
+        m_pendingSignals.emplace_back(RHIFenceRef(fence), value);
+    }
+
+    void NullCommandContext::WaitFence(RHIFence* fence, uint64 value)
+    {
+        (void)fence;
+        (void)value;
+        CheckRecording("WaitFence");
+    }
+
+} // namespace RVX
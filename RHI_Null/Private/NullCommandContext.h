@@ -0,0 +1,161 @@
+#pragma once
+
+#include "NullCommon.h"
+#include "Null/NullDevice.h"
+#include "RHI/RHICommandContext.h"
+
+#include <utility>
+#include <vector>
+
+namespace RVX
+{
+    class NullPipeline;
+    class NullFence;
+
+    // =============================================================================
+    // Null Command Context
+    // =============================================================================
+    /**
+     * @brief Command context that validates and counts commands instead of recording them
+     *
+     * Barriers are checked against, and update, the state tracked on the
+     * resource at record time, so contexts must be recorded in the order
+     * they will be submitted for the checks to be meaningful. Counters are
+     * handed to the device on submit.
+     */
+    class NullCommandContext : public RHICommandContext
+    {
+    public:
+        NullCommandContext(NullDeviceStateRef state, RHICommandQueueType queueType);
+        ~NullCommandContext() override;
+
+        // =========================================================================
+        // Lifecycle
+        // =========================================================================
+        void Begin() override;
+        void End() override;
+        void Reset() override;
+
+        // =========================================================================
+        // Debug Markers
+        // =========================================================================
+        void BeginEvent(const char* name, uint32 color) override;
+        void EndEvent() override;
+        void SetMarker(const char* name, uint32 color) override;
+
+        // =========================================================================
+        // Resource Barriers
+        // =========================================================================
+        void BufferBarrier(const RHIBufferBarrier& barrier) override;
+        void TextureBarrier(const RHITextureBarrier& barrier) override;
+        void Barriers(
+            std::span<const RHIBufferBarrier> bufferBarriers,
+            std::span<const RHITextureBarrier> textureBarriers) override;
+
+        // Split barriers: the end half applies the transition
+        void BeginBarrier(const RHIBufferBarrier& barrier) override;
+        void BeginBarrier(const RHITextureBarrier& barrier) override;
+        void EndBarrier(const RHIBufferBarrier& barrier) override;
+        void EndBarrier(const RHITextureBarrier& barrier) override;
+
+        // =========================================================================
+        // Render Pass
+        // =========================================================================
+        void BeginRenderPass(const RHIRenderPassDesc& desc) override;
+        void EndRenderPass() override;
+
+        // =========================================================================
+        // Pipeline and Resource Binding
+        // =========================================================================
+        void SetPipeline(RHIPipeline* pipeline) override;
+        void SetVertexBuffer(uint32 slot, RHIBuffer* buffer, uint64 offset) override;
+        void SetVertexBuffers(uint32 startSlot, std::span<RHIBuffer* const> buffers, std::span<const uint64> offsets) override;
+        void SetIndexBuffer(RHIBuffer* buffer, RHIFormat format, uint64 offset) override;
+        void SetDescriptorSet(uint32 slot, RHIDescriptorSet* set, std::span<const uint32> dynamicOffsets) override;
+        void SetPushConstants(const void* data, uint32 size, uint32 offset) override;
+
+        // =========================================================================
+        // Viewport and Scissor
+        // =========================================================================
+        void SetViewport(const RHIViewport& viewport) override;
+        void SetViewports(std::span<const RHIViewport> viewports) override;
+        void SetScissor(const RHIRect& scissor) override;
+        void SetScissors(std::span<const RHIRect> scissors) override;
+
+        // =========================================================================
+        // Draw and Dispatch
+        // =========================================================================
+        void Draw(uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance) override;
+        void DrawIndexed(uint32 indexCount, uint32 instanceCount, uint32 firstIndex, int32 vertexOffset, uint32 firstInstance) override;
+        void DrawIndirect(RHIBuffer* buffer, uint64 offset, uint32 drawCount, uint32 stride) override;
+        void DrawIndexedIndirect(RHIBuffer* buffer, uint64 offset, uint32 drawCount, uint32 stride) override;
+        void Dispatch(uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) override;
+        void DispatchIndirect(RHIBuffer* buffer, uint64 offset) override;
+
+        // =========================================================================
+        // Copy Operations
+        // =========================================================================
+        void CopyBuffer(RHIBuffer* src, RHIBuffer* dst, uint64 srcOffset, uint64 dstOffset, uint64 size) override;
+        void CopyTexture(RHITexture* src, RHITexture* dst, const RHITextureCopyDesc& desc) override;
+        void CopyBufferToTexture(RHIBuffer* src, RHITexture* dst, const RHIBufferTextureCopyDesc& desc) override;
+        void CopyTextureToBuffer(RHITexture* src, RHIBuffer* dst, const RHIBufferTextureCopyDesc& desc) override;
+
+        // =========================================================================
+        // Query Operations
+        // =========================================================================
+        void BeginQuery(RHIQueryPool* pool, uint32 index) override;
+        void EndQuery(RHIQueryPool* pool, uint32 index) override;
+        void WriteTimestamp(RHIQueryPool* pool, uint32 index) override;
+        void ResolveQueries(RHIQueryPool* pool, uint32 firstQuery, uint32 queryCount,
+                            RHIBuffer* destBuffer, uint64 destOffset) override;
+        void ResetQueries(RHIQueryPool* pool, uint32 firstQuery, uint32 queryCount) override;
+
+        // =========================================================================
+        // Dynamic State
+        // =========================================================================
+        void SetStencilReference(uint32 reference) override;
+        void SetBlendConstants(const float constants[4]) override;
+        void SetDepthBias(float constantFactor, float slopeFactor, float clamp) override;
+        void SetDepthBounds(float minDepth, float maxDepth) override;
+        void SetStencilReferenceSeparate(uint32 frontRef, uint32 backRef) override;
+        void SetLineWidth(float width) override;
+
+        // =========================================================================
+        // Synchronization
+        // =========================================================================
+        void SignalFence(RHIFence* fence, uint64 value) override;
+        void WaitFence(RHIFence* fence, uint64 value) override;
+
+        // =========================================================================
+        // Null Specific
+        // =========================================================================
+        RHICommandQueueType GetQueueType() const { return m_queueType; }
+
+        /// Check the context can be submitted, add its counters to stats and apply its fence signals
+        void Submit(NullDeviceStats& stats);
+
+    private:
+        bool CheckRecording(const char* command);
+        void ApplyBufferBarrier(const RHIBufferBarrier& barrier);
+        void ApplyTextureBarrier(const RHITextureBarrier& barrier);
+        void CheckAttachment(RHITextureView* view, RHIResourceState expected, const char* kind, uint32 index);
+        bool CheckDraw(const char* command);
+        bool CheckDispatch(const char* command);
+        void CheckBufferRange(RHIBuffer* buffer, uint64 offset, uint64 size, const char* command);
+
+        NullDeviceStateRef m_deviceState;
+        RHICommandQueueType m_queueType;
+
+        bool m_recording = false;
+        bool m_ended = false;
+        bool m_inRenderPass = false;
+        uint32 m_eventDepth = 0;
+        NullPipeline* m_pipeline = nullptr;
+        RHIBuffer* m_indexBuffer = nullptr;
+
+        // Only the command counters are used; resource counts come from the device
+        NullDeviceStats m_stats;
+        std::vector<std::pair<RHIFenceRef, uint64>> m_pendingSignals;
+    };
+
+} // namespace RVX
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Core/Log.h"
+#include "RHI/RHIDefinitions.h"
+
+#include <atomic>
+#include <memory>
+
+// Only the first validation errors are logged; all of them are counted
+#define RVX_NULL_VALIDATION_ERROR(state, ...)                                                         \
+    do                                                                                                \
+    {                                                                                                 \
+        if ((state).validationErrors.fetch_add(1, std::memory_order_relaxed) < ::RVX::kNullMaxLoggedValidationErrors) \
+        {                                                                                             \
+            RVX_RHI_ERROR("[Null] " __VA_ARGS__);                                                     \
+        }                                                                                             \
+    } while (0)
+
+namespace RVX
+{
+    constexpr uint64 kNullMaxLoggedValidationErrors = 32;
+
+    // =============================================================================
+    // Shared Device State
+    // =============================================================================
+    /**
+     * @brief Counters shared by a Null device and every object it created
+     *
+     * Resources hold a reference so they can outlive the device (deferred
+     * deletion releases them after the device is gone) without dangling.
+     */
+    struct NullDeviceState
+    {
+        std::atomic<uint32> bufferCount{0};
+        std::atomic<uint32> textureCount{0};
+        std::atomic<uint32> descriptorSetCount{0};
+        std::atomic<uint32> pipelineCount{0};
+
+        std::atomic<uint64> bufferMemory{0};
+        std::atomic<uint64> textureMemory{0};
+        std::atomic<uint64> renderTargetMemory{0};
+        std::atomic<uint64> peakMemory{0};
+
+        std::atomic<uint64> validationErrors{0};
+
+        void AddMemory(std::atomic<uint64>& category, uint64 bytes)
+        {
+            category.fetch_add(bytes, std::memory_order_relaxed);
+            const uint64 total = GetTotalMemory();
+            uint64 peak = peakMemory.load(std::memory_order_relaxed);
+            while (total > peak && !peakMemory.compare_exchange_weak(peak, total, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void RemoveMemory(std::atomic<uint64>& category, uint64 bytes)
+        {
+            category.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        uint64 GetTotalMemory() const
+        {
+            return bufferMemory.load(std::memory_order_relaxed) +
+                   textureMemory.load(std::memory_order_relaxed) +
+                   renderTargetMemory.load(std::memory_order_relaxed);
+        }
+    };
+
+    using NullDeviceStateRef = std::shared_ptr<NullDeviceState>;
+
+    // Resource states that carry no contents to validate a transition against
+    inline bool IsNullUntrackedState(RHIResourceState state)
+    {
+        return state == RHIResourceState::Undefined || state == RHIResourceState::Common;
+    }
+
+} // namespace RVX
@@ -0,0 +1,416 @@
+#include "NullDevice.h"
+#include "NullResources.h"
+#include "NullPipeline.h"
+#include "NullCommandContext.h"
+
+#include <algorithm>
+
+namespace RVX
+{
+    // =============================================================================
+    // Factory Functions
+    // =============================================================================
+    std::unique_ptr<IRHIDevice> CreateNullDevice(const RHIDeviceDesc& desc)
+    {
+        auto device = std::make_unique<NullDevice>();
+        if (!device->Initialize(desc))
+        {
+            RVX_RHI_ERROR("Failed to create Null Device");
+            return nullptr;
+        }
+        return device;
+    }
+
+    const NullDeviceStats* GetNullDeviceStats(const IRHIDevice& device)
+    {
+        if (device.GetBackendType() != RHIBackendType::Null)
+        {
+            return nullptr;
+        }
+        return &static_cast<const NullDevice&>(device).GetStats();
+    }
+
+    void ResetNullDeviceStats(IRHIDevice& device)
+    {
+        if (device.GetBackendType() == RHIBackendType::Null)
+        {
+            static_cast<NullDevice&>(device).ResetStats();
+        }
+    }
+
+    // =============================================================================
+    // Construction
+    // =============================================================================
+    NullDevice::NullDevice()
+        : m_state(std::make_shared<NullDeviceState>())
+    {
+    }
+
+    NullDevice::~NullDevice()
+    {
+        if (m_resourceGroupDepth != 0)
+        {
+            RVX_RHI_WARN("[Null] Device destroyed with {} open resource groups", m_resourceGroupDepth);
+        }
+    }
+
+    bool NullDevice::Initialize(const RHIDeviceDesc& desc)
+    {
+        (void)desc;
+        InitializeCapabilities();
+        RVX_RHI_INFO("Null Device initialized (no GPU work will be executed)");
+        return true;
+    }
+
+    void NullDevice::InitializeCapabilities()
+    {
+        m_capabilities.backendType = RHIBackendType::Null;
+        m_capabilities.adapterName = "Null Device";
+        m_capabilities.driverVersion = "1.0";
+
+        // Report the feature set of the most capable backend so render code
+        // takes the same paths it would on real hardware
+        m_capabilities.supportsAsyncCompute = true;
+        m_capabilities.supportsDepthBounds = true;
+        m_capabilities.supportsDynamicLineWidth = true;
+        m_capabilities.supportsSeparateStencilRef = true;
+        m_capabilities.supportsSplitBarrier = true;
+        m_capabilities.supportsSecondaryCommandBuffer = true;
+        m_capabilities.supportsMemoryBudgetQuery = true;
+        m_capabilities.supportsPersistentMapping = true;
+    }
+
+    // =============================================================================
+    // Resource Creation
+    // =============================================================================
+    RHIBufferRef NullDevice::CreateBuffer(const RHIBufferDesc& desc)
+    {
+        if (desc.size == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateBuffer with size 0 ('{}')", desc.debugName ? desc.debugName : "");
+            return nullptr;
+        }
+        return Ref<NullBuffer>(new NullBuffer(m_state, desc));
+    }
+
+    RHITextureRef NullDevice::CreateTexture(const RHITextureDesc& desc)
+    {
+        if (desc.width == 0 || desc.height == 0 || desc.depth == 0 || desc.format == RHIFormat::Unknown)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateTexture with an empty extent or unknown format ('{}')",
+                                      desc.debugName ? desc.debugName : "");
+            return nullptr;
+        }
+        return Ref<NullTexture>(new NullTexture(m_state, desc));
+    }
+
+    RHITextureViewRef NullDevice::CreateTextureView(RHITexture* texture, const RHITextureViewDesc& desc)
+    {
+        if (!texture)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateTextureView without a texture");
+            return nullptr;
+        }
+
+        const RHISubresourceRange& range = desc.subresourceRange;
+        if (range.baseMipLevel >= texture->GetMipLevels() || range.baseArrayLayer >= texture->GetArraySize())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Texture view of '{}' starts outside the texture (mip {}, layer {})",
+                                      texture->GetDebugName(), range.baseMipLevel, range.baseArrayLayer);
+        }
+        return Ref<NullTextureView>(new NullTextureView(texture, desc));
+    }
+
+    RHISamplerRef NullDevice::CreateSampler(const RHISamplerDesc& desc)
+    {
+        return Ref<NullSampler>(new NullSampler(desc));
+    }
+
+    RHIShaderRef NullDevice::CreateShader(const RHIShaderDesc& desc)
+    {
+        return Ref<NullShader>(new NullShader(desc));
+    }
+
+    // =============================================================================
+    // Memory Heap Management
+    // =============================================================================
+    RHIHeapRef NullDevice::CreateHeap(const RHIHeapDesc& desc)
+    {
+        return Ref<NullHeap>(new NullHeap(m_state, desc));
+    }
+
+    RHITextureRef NullDevice::CreatePlacedTexture(RHIHeap* heap, uint64 offset, const RHITextureDesc& desc)
+    {
+        const uint64 size = NullTexture::ComputeSize(desc);
+        if (!heap || offset + size > heap->GetSize())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Placed texture '{}' [{}, +{}) does not fit its heap",
+                                      desc.debugName ? desc.debugName : "", offset, size);
+            return nullptr;
+        }
+        return Ref<NullTexture>(new NullTexture(m_state, desc, true));
+    }
+
+    RHIBufferRef NullDevice::CreatePlacedBuffer(RHIHeap* heap, uint64 offset, const RHIBufferDesc& desc)
+    {
+        if (!heap || offset + desc.size > heap->GetSize())
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Placed buffer '{}' [{}, +{}) does not fit its heap",
+                                      desc.debugName ? desc.debugName : "", offset, desc.size);
+            return nullptr;
+        }
+        return Ref<NullBuffer>(new NullBuffer(m_state, desc, true));
+    }
+
+    IRHIDevice::MemoryRequirements NullDevice::GetTextureMemoryRequirements(const RHITextureDesc& desc)
+    {
+        // Same placement alignment as D3D12 and typical Vulkan drivers
+        constexpr uint64 kTextureAlignment = 64 * 1024;
+
+        MemoryRequirements requirements;
+        requirements.alignment = kTextureAlignment;
+        requirements.size = (NullTexture::ComputeSize(desc) + kTextureAlignment - 1) / kTextureAlignment * kTextureAlignment;
+        return requirements;
+    }
+
+    IRHIDevice::MemoryRequirements NullDevice::GetBufferMemoryRequirements(const RHIBufferDesc& desc)
+    {
+        constexpr uint64 kBufferAlignment = 256;
+
+        MemoryRequirements requirements;
+        requirements.alignment = kBufferAlignment;
+        requirements.size = (desc.size + kBufferAlignment - 1) / kBufferAlignment * kBufferAlignment;
+        return requirements;
+    }
+
+    // =============================================================================
+    // Pipeline
+    // =============================================================================
+    RHIDescriptorSetLayoutRef NullDevice::CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc)
+    {
+        return Ref<NullDescriptorSetLayout>(new NullDescriptorSetLayout(desc));
+    }
+
+    RHIPipelineLayoutRef NullDevice::CreatePipelineLayout(const RHIPipelineLayoutDesc& desc)
+    {
+        if (desc.setLayouts.size() > RVX_MAX_DESCRIPTOR_SETS)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Pipeline layout has {} sets, the limit is {}",
+                                      desc.setLayouts.size(), RVX_MAX_DESCRIPTOR_SETS);
+        }
+        if (desc.pushConstantSize > m_capabilities.maxPushConstantSize)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Pipeline layout push constants of {} bytes exceed the limit of {}",
+                                      desc.pushConstantSize, m_capabilities.maxPushConstantSize);
+        }
+        return Ref<NullPipelineLayout>(new NullPipelineLayout(desc));
+    }
+
+    RHIPipelineRef NullDevice::CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc)
+    {
+        if (!desc.vertexShader)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Graphics pipeline '{}' has no vertex shader",
+                                      desc.debugName ? desc.debugName : "");
+            return nullptr;
+        }
+        return Ref<NullPipeline>(new NullPipeline(m_state, desc.pipelineLayout, false, desc.debugName));
+    }
+
+    RHIPipelineRef NullDevice::CreateComputePipeline(const RHIComputePipelineDesc& desc)
+    {
+        if (!desc.computeShader)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "Compute pipeline '{}' has no compute shader",
+                                      desc.debugName ? desc.debugName : "");
+            return nullptr;
+        }
+        return Ref<NullPipeline>(new NullPipeline(m_state, desc.pipelineLayout, true, desc.debugName));
+    }
+
+    RHIDescriptorSetRef NullDevice::CreateDescriptorSet(const RHIDescriptorSetDesc& desc)
+    {
+        if (!desc.layout)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateDescriptorSet without a layout");
+            return nullptr;
+        }
+        return Ref<NullDescriptorSet>(new NullDescriptorSet(m_state, desc));
+    }
+
+    RHIQueryPoolRef NullDevice::CreateQueryPool(const RHIQueryPoolDesc& desc)
+    {
+        return Ref<NullQueryPool>(new NullQueryPool(desc));
+    }
+
+    // =============================================================================
+    // Command Context
+    // =============================================================================
+    RHICommandContextRef NullDevice::CreateCommandContext(RHICommandQueueType type)
+    {
+        return Ref<NullCommandContext>(new NullCommandContext(m_state, type));
+    }
+
+    void NullDevice::SubmitCommandContext(RHICommandContext* context, RHIFence* signalFence)
+    {
+        RHICommandContext* contexts[] = {context};
+        SubmitCommandContexts(contexts, signalFence);
+    }
+
+    void NullDevice::SubmitCommandContexts(std::span<RHICommandContext* const> contexts, RHIFence* signalFence)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_statsMutex);
+            m_stats.submissions++;
+            for (RHICommandContext* context : contexts)
+            {
+                if (!context)
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_state, "Submitting a null command context");
+                    continue;
+                }
+                static_cast<NullCommandContext*>(context)->Submit(m_stats);
+            }
+        }
+
+        if (signalFence)
+        {
+            // Matches the GPU backends, which signal one past the completed value
+            signalFence->Signal(signalFence->GetCompletedValue() + 1);
+        }
+    }
+
+    // =============================================================================
+    // SwapChain
+    // =============================================================================
+    RHISwapChainRef NullDevice::CreateSwapChain(const RHISwapChainDesc& desc)
+    {
+        return Ref<NullSwapChain>(new NullSwapChain(m_state, desc));
+    }
+
+    // =============================================================================
+    // Synchronization
+    // =============================================================================
+    RHIFenceRef NullDevice::CreateFence(uint64 initialValue)
+    {
+        return Ref<NullFence>(new NullFence(initialValue));
+    }
+
+    void NullDevice::WaitForFence(RHIFence* fence, uint64 value)
+    {
+        if (fence)
+        {
+            fence->Wait(value, UINT64_MAX);
+        }
+    }
+
+    void NullDevice::WaitIdle()
+    {
+        // All submitted work has already completed
+    }
+
+    // =============================================================================
+    // Frame Management
+    // =============================================================================
+    void NullDevice::BeginFrame()
+    {
+        if (m_inFrame)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "BeginFrame called twice without EndFrame");
+        }
+        m_inFrame = true;
+    }
+
+    void NullDevice::EndFrame()
+    {
+        if (!m_inFrame)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "EndFrame called without BeginFrame");
+        }
+        m_inFrame = false;
+        m_frameIndex = (m_frameIndex + 1) % RVX_MAX_FRAME_COUNT;
+    }
+
+    // =============================================================================
+    // Upload Resources
+    // =============================================================================
+    RHIStagingBufferRef NullDevice::CreateStagingBuffer(const RHIStagingBufferDesc& desc)
+    {
+        if (desc.size == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateStagingBuffer with size 0");
+            return nullptr;
+        }
+        return Ref<NullStagingBuffer>(new NullStagingBuffer(m_state, desc));
+    }
+
+    RHIRingBufferRef NullDevice::CreateRingBuffer(const RHIRingBufferDesc& desc)
+    {
+        if (desc.size == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "CreateRingBuffer with size 0");
+            return nullptr;
+        }
+        return Ref<NullRingBuffer>(new NullRingBuffer(m_state, desc));
+    }
+
+    // =============================================================================
+    // Memory Statistics
+    // =============================================================================
+    RHIMemoryStats NullDevice::GetMemoryStats() const
+    {
+        RHIMemoryStats stats;
+        stats.bufferMemory = m_state->bufferMemory.load(std::memory_order_relaxed);
+        stats.textureMemory = m_state->textureMemory.load(std::memory_order_relaxed);
+        stats.renderTargetMemory = m_state->renderTargetMemory.load(std::memory_order_relaxed);
+        stats.totalAllocated = stats.bufferMemory + stats.textureMemory + stats.renderTargetMemory;
+        stats.totalUsed = stats.totalAllocated;
+        stats.currentUsageBytes = stats.totalAllocated;
+        stats.peakUsage = m_state->peakMemory.load(std::memory_order_relaxed);
+        stats.allocationCount = m_state->bufferCount.load(std::memory_order_relaxed) +
+                                m_state->textureCount.load(std::memory_order_relaxed);
+        stats.budgetBytes = UINT64_MAX;
+        return stats;
+    }
+
+    // =============================================================================
+    // Debug Resource Groups
+    // =============================================================================
+    void NullDevice::BeginResourceGroup(const char* name)
+    {
+        (void)name;
+        m_resourceGroupDepth++;
+    }
+
+    void NullDevice::EndResourceGroup()
+    {
+        if (m_resourceGroupDepth == 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_state, "EndResourceGroup without a matching BeginResourceGroup");
+            return;
+        }
+        m_resourceGroupDepth--;
+    }
+
+    // =============================================================================
+    // Statistics
+    // =============================================================================
+    const NullDeviceStats& NullDevice::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.bufferCount = m_state->bufferCount.load(std::memory_order_relaxed);
+        m_stats.textureCount = m_state->textureCount.load(std::memory_order_relaxed);
+        m_stats.descriptorSetCount = m_state->descriptorSetCount.load(std::memory_order_relaxed);
+        m_stats.pipelineCount = m_state->pipelineCount.load(std::memory_order_relaxed);
+        m_stats.validationErrors = m_state->validationErrors.load(std::memory_order_relaxed);
+        return m_stats;
+    }
+
+    void NullDevice::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats = {};
+        m_state->validationErrors.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace RVX
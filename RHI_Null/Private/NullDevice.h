@@ -0,0 +1,128 @@
+#pragma once
+
+#include "NullCommon.h"
+#include "Null/NullDevice.h"
+
+#include <mutex>
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Device
+    // =============================================================================
+    /**
+     * @brief IRHIDevice that keeps everything in system memory
+     *
+     * Nothing is sent to a GPU: submitted work completes immediately, fences
+     * signal at submission and waits return at once. What the device does do
+     * is allocate, track resource states, count the work it is given and
+     * report API misuse, which makes it suitable for CPU-side render tests
+     * and benchmarks on machines without a GPU.
+     */
+    class NullDevice : public IRHIDevice
+    {
+    public:
+        NullDevice();
+        ~NullDevice() override;
+
+        bool Initialize(const RHIDeviceDesc& desc);
+
+        // =========================================================================
+        // Resource Creation
+        // =========================================================================
+        RHIBufferRef CreateBuffer(const RHIBufferDesc& desc) override;
+        RHITextureRef CreateTexture(const RHITextureDesc& desc) override;
+        RHITextureViewRef CreateTextureView(RHITexture* texture, const RHITextureViewDesc& desc) override;
+        RHISamplerRef CreateSampler(const RHISamplerDesc& desc) override;
+        RHIShaderRef CreateShader(const RHIShaderDesc& desc) override;
+
+        // Memory Heap Management
+        RHIHeapRef CreateHeap(const RHIHeapDesc& desc) override;
+        RHITextureRef CreatePlacedTexture(RHIHeap* heap, uint64 offset, const RHITextureDesc& desc) override;
+        RHIBufferRef CreatePlacedBuffer(RHIHeap* heap, uint64 offset, const RHIBufferDesc& desc) override;
+        MemoryRequirements GetTextureMemoryRequirements(const RHITextureDesc& desc) override;
+        MemoryRequirements GetBufferMemoryRequirements(const RHIBufferDesc& desc) override;
+
+        // Pipeline
+        RHIDescriptorSetLayoutRef CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc) override;
+        RHIPipelineLayoutRef CreatePipelineLayout(const RHIPipelineLayoutDesc& desc) override;
+        RHIPipelineRef CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc) override;
+        RHIPipelineRef CreateComputePipeline(const RHIComputePipelineDesc& desc) override;
+
+        // Descriptor Set
+        RHIDescriptorSetRef CreateDescriptorSet(const RHIDescriptorSetDesc& desc) override;
+
+        // Query Pool
+        RHIQueryPoolRef CreateQueryPool(const RHIQueryPoolDesc& desc) override;
+
+        // =========================================================================
+        // Command Context
+        // =========================================================================
+        RHICommandContextRef CreateCommandContext(RHICommandQueueType type) override;
+        void SubmitCommandContext(RHICommandContext* context, RHIFence* signalFence) override;
+        void SubmitCommandContexts(std::span<RHICommandContext* const> contexts, RHIFence* signalFence) override;
+
+        // =========================================================================
+        // SwapChain
+        // =========================================================================
+        RHISwapChainRef CreateSwapChain(const RHISwapChainDesc& desc) override;
+
+        // =========================================================================
+        // Synchronization
+        // =========================================================================
+        RHIFenceRef CreateFence(uint64 initialValue) override;
+        void WaitForFence(RHIFence* fence, uint64 value) override;
+        void WaitIdle() override;
+
+        // =========================================================================
+        // Frame Management
+        // =========================================================================
+        void BeginFrame() override;
+        void EndFrame() override;
+        uint32 GetCurrentFrameIndex() const override { return m_frameIndex; }
+
+        // =========================================================================
+        // Upload Resources
+        // =========================================================================
+        RHIStagingBufferRef CreateStagingBuffer(const RHIStagingBufferDesc& desc) override;
+        RHIRingBufferRef CreateRingBuffer(const RHIRingBufferDesc& desc) override;
+
+        // =========================================================================
+        // Memory Statistics
+        // =========================================================================
+        RHIMemoryStats GetMemoryStats() const override;
+
+        // =========================================================================
+        // Debug Resource Groups
+        // =========================================================================
+        void BeginResourceGroup(const char* name) override;
+        void EndResourceGroup() override;
+
+        // =========================================================================
+        // Capabilities
+        // =========================================================================
+        const RHICapabilities& GetCapabilities() const override { return m_capabilities; }
+        RHIBackendType GetBackendType() const override { return RHIBackendType::Null; }
+
+        // =========================================================================
+        // Null Specific
+        // =========================================================================
+        const NullDeviceStats& GetStats() const;
+        void ResetStats();
+
+    private:
+        void InitializeCapabilities();
+
+        NullDeviceStateRef m_state;
+        RHICapabilities m_capabilities;
+        uint32 m_frameIndex = 0;
+        bool m_inFrame = false;
+        uint32 m_resourceGroupDepth = 0;
+
+        // Guards m_stats; contexts may be submitted from several threads.
+        // Live resource counts are refreshed into m_stats when it is read.
+        mutable std::mutex m_statsMutex;
+        mutable NullDeviceStats m_stats;
+    };
+
+} // namespace RVX
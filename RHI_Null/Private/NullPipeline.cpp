@@ -0,0 +1,193 @@
+#include "NullPipeline.h"
+
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHITexture.h"
+
+#include <algorithm>
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Descriptor Set Layout Implementation
+    // =============================================================================
+    NullDescriptorSetLayout::NullDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc)
+        : m_entries(desc.entries)
+    {
+        for (const auto& entry : m_entries)
+        {
+            if (entry.isDynamic ||
+                entry.type == RHIBindingType::DynamicUniformBuffer ||
+                entry.type == RHIBindingType::DynamicStorageBuffer)
+            {
+                ++m_dynamicBindingCount;
+            }
+        }
+
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+    }
+
+    const RHIBindingLayoutEntry* NullDescriptorSetLayout::FindEntry(uint32 binding) const
+    {
+        for (const auto& entry : m_entries)
+        {
+            if (entry.binding == binding)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    // =============================================================================
+    // Null Pipeline Layout Implementation
+    // =============================================================================
+    NullPipelineLayout::NullPipelineLayout(const RHIPipelineLayoutDesc& desc)
+        : m_pushConstantSize(desc.pushConstantSize)
+    {
+        m_setLayouts.reserve(desc.setLayouts.size());
+        for (RHIDescriptorSetLayout* setLayout : desc.setLayouts)
+        {
+            m_setLayouts.push_back(RHIDescriptorSetLayoutRef(setLayout));
+        }
+
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+    }
+
+    NullDescriptorSetLayout* NullPipelineLayout::GetSetLayout(uint32 index) const
+    {
+        if (index >= m_setLayouts.size())
+        {
+            return nullptr;
+        }
+        return static_cast<NullDescriptorSetLayout*>(m_setLayouts[index].Get());
+    }
+
+    // =============================================================================
+    // Null Pipeline Implementation
+    // =============================================================================
+    NullPipeline::NullPipeline(NullDeviceStateRef state, RHIPipelineLayout* layout, bool isCompute, const char* debugName)
+        : m_deviceState(std::move(state))
+        , m_layout(layout)
+        , m_isCompute(isCompute)
+    {
+        if (debugName && debugName[0])
+        {
+            SetDebugName(debugName);
+        }
+
+        m_deviceState->pipelineCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    NullPipeline::~NullPipeline()
+    {
+        m_deviceState->pipelineCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // =============================================================================
+    // Null Descriptor Set Implementation
+    // =============================================================================
+    NullDescriptorSet::NullDescriptorSet(NullDeviceStateRef state, const RHIDescriptorSetDesc& desc)
+        : m_deviceState(std::move(state))
+        , m_layout(static_cast<NullDescriptorSetLayout*>(desc.layout))
+    {
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+
+        m_deviceState->descriptorSetCount.fetch_add(1, std::memory_order_relaxed);
+        Update(desc.bindings);
+    }
+
+    NullDescriptorSet::~NullDescriptorSet()
+    {
+        m_deviceState->descriptorSetCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void NullDescriptorSet::Update(const std::vector<RHIDescriptorBinding>& bindings)
+    {
+        for (const auto& binding : bindings)
+        {
+            ValidateBinding(binding);
+
+            auto it = std::find_if(m_bindings.begin(), m_bindings.end(),
+                [&](const RHIDescriptorBinding& existing) { return existing.binding == binding.binding; });
+            if (it != m_bindings.end())
+            {
+                *it = binding;
+            }
+            else
+            {
+                m_bindings.push_back(binding);
+            }
+        }
+    }
+
+    void NullDescriptorSet::ValidateBinding(const RHIDescriptorBinding& binding) const
+    {
+        if (!m_layout)
+        {
+            return;
+        }
+
+        const RHIBindingLayoutEntry* entry = m_layout->FindEntry(binding.binding);
+        if (!entry)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' binds slot {} which is not in its layout",
+                                      GetDebugName(), binding.binding);
+            return;
+        }
+
+        switch (entry->type)
+        {
+            case RHIBindingType::UniformBuffer:
+            case RHIBindingType::DynamicUniformBuffer:
+            case RHIBindingType::StorageBuffer:
+            case RHIBindingType::DynamicStorageBuffer:
+                if (!binding.buffer)
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' slot {} expects a buffer",
+                                              GetDebugName(), binding.binding);
+                }
+                else if (binding.range != RVX_WHOLE_SIZE && binding.offset + binding.range > binding.buffer->GetSize())
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' slot {} range [{}, +{}) exceeds buffer size {}",
+                                              GetDebugName(), binding.binding, binding.offset, binding.range,
+                                              binding.buffer->GetSize());
+                }
+                break;
+
+            case RHIBindingType::SampledTexture:
+            case RHIBindingType::StorageTexture:
+                if (!binding.textureView)
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' slot {} expects a texture view",
+                                              GetDebugName(), binding.binding);
+                }
+                break;
+
+            case RHIBindingType::Sampler:
+                if (!binding.sampler)
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' slot {} expects a sampler",
+                                              GetDebugName(), binding.binding);
+                }
+                break;
+
+            case RHIBindingType::CombinedTextureSampler:
+                if (!binding.textureView || !binding.sampler)
+                {
+                    RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Descriptor set '{}' slot {} expects a texture view and sampler",
+                                              GetDebugName(), binding.binding);
+                }
+                break;
+        }
+    }
+
+} // namespace RVX
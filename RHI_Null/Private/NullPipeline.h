@@ -0,0 +1,94 @@
+#pragma once
+
+#include "NullCommon.h"
+#include "RHI/RHIPipeline.h"
+#include "RHI/RHIDescriptor.h"
+
+#include <vector>
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Descriptor Set Layout
+    // =============================================================================
+    class NullDescriptorSetLayout : public RHIDescriptorSetLayout
+    {
+    public:
+        explicit NullDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc);
+
+        const std::vector<RHIBindingLayoutEntry>& GetEntries() const { return m_entries; }
+        const RHIBindingLayoutEntry* FindEntry(uint32 binding) const;
+
+        /// Number of dynamic offsets SetDescriptorSet must supply for this layout
+        uint32 GetDynamicBindingCount() const { return m_dynamicBindingCount; }
+
+    private:
+        std::vector<RHIBindingLayoutEntry> m_entries;
+        uint32 m_dynamicBindingCount = 0;
+    };
+
+    // =============================================================================
+    // Null Pipeline Layout
+    // =============================================================================
+    class NullPipelineLayout : public RHIPipelineLayout
+    {
+    public:
+        explicit NullPipelineLayout(const RHIPipelineLayoutDesc& desc);
+
+        uint32 GetSetLayoutCount() const { return static_cast<uint32>(m_setLayouts.size()); }
+        NullDescriptorSetLayout* GetSetLayout(uint32 index) const;
+        uint32 GetPushConstantSize() const { return m_pushConstantSize; }
+
+    private:
+        std::vector<RHIDescriptorSetLayoutRef> m_setLayouts;
+        uint32 m_pushConstantSize = 0;
+    };
+
+    // =============================================================================
+    // Null Pipeline
+    // =============================================================================
+    class NullPipeline : public RHIPipeline
+    {
+    public:
+        NullPipeline(NullDeviceStateRef state, RHIPipelineLayout* layout, bool isCompute, const char* debugName);
+        ~NullPipeline() override;
+
+        bool IsCompute() const override { return m_isCompute; }
+
+        NullPipelineLayout* GetLayout() const { return static_cast<NullPipelineLayout*>(m_layout.Get()); }
+
+    private:
+        NullDeviceStateRef m_deviceState;
+        RHIPipelineLayoutRef m_layout;
+        bool m_isCompute = false;
+    };
+
+    // =============================================================================
+    // Null Descriptor Set
+    // =============================================================================
+    /**
+     * @brief Descriptor set that checks its bindings against the layout
+     *
+     * Bindings are stored as given; nothing is kept alive by the set, matching
+     * the lifetime rules of the GPU backends.
+     */
+    class NullDescriptorSet : public RHIDescriptorSet
+    {
+    public:
+        NullDescriptorSet(NullDeviceStateRef state, const RHIDescriptorSetDesc& desc);
+        ~NullDescriptorSet() override;
+
+        void Update(const std::vector<RHIDescriptorBinding>& bindings) override;
+
+        NullDescriptorSetLayout* GetLayout() const { return m_layout; }
+        const std::vector<RHIDescriptorBinding>& GetBindings() const { return m_bindings; }
+
+    private:
+        void ValidateBinding(const RHIDescriptorBinding& binding) const;
+
+        NullDeviceStateRef m_deviceState;
+        NullDescriptorSetLayout* m_layout = nullptr;
+        std::vector<RHIDescriptorBinding> m_bindings;
+    };
+
+} // namespace RVX
@@ -0,0 +1,368 @@
+#include "NullResources.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Buffer Implementation
+    // =============================================================================
+    NullBuffer::NullBuffer(NullDeviceStateRef state, const RHIBufferDesc& desc, bool placed)
+        : m_deviceState(std::move(state))
+        , m_desc(desc)
+        , m_placed(placed)
+    {
+        if (desc.memoryType != RHIMemoryType::Default)
+        {
+            m_storage.resize(static_cast<size_t>(desc.size));
+        }
+
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+
+        m_deviceState->bufferCount.fetch_add(1, std::memory_order_relaxed);
+        // Placed buffers live in heap memory that was already accounted for
+        if (!m_placed)
+        {
+            m_deviceState->AddMemory(m_deviceState->bufferMemory, desc.size);
+        }
+    }
+
+    NullBuffer::~NullBuffer()
+    {
+        if (m_mapCount.load(std::memory_order_relaxed) != 0)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Buffer '{}' destroyed while mapped", GetDebugName());
+        }
+
+        m_deviceState->bufferCount.fetch_sub(1, std::memory_order_relaxed);
+        if (!m_placed)
+        {
+            m_deviceState->RemoveMemory(m_deviceState->bufferMemory, m_desc.size);
+        }
+    }
+
+    void* NullBuffer::Map()
+    {
+        if (m_desc.memoryType == RHIMemoryType::Default)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Map called on GPU-only buffer '{}'", GetDebugName());
+            return nullptr;
+        }
+
+        m_mapCount.fetch_add(1, std::memory_order_relaxed);
+        return m_storage.data();
+    }
+
+    void NullBuffer::Unmap()
+    {
+        uint32 count = m_mapCount.load(std::memory_order_relaxed);
+        do
+        {
+            if (count == 0)
+            {
+                RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Unmap called on unmapped buffer '{}'", GetDebugName());
+                return;
+            }
+        } while (!m_mapCount.compare_exchange_weak(count, count - 1, std::memory_order_relaxed));
+    }
+
+    // =============================================================================
+    // Null Texture Implementation
+    // =============================================================================
+    NullTexture::NullTexture(NullDeviceStateRef state, const RHITextureDesc& desc, bool placed)
+        : m_deviceState(std::move(state))
+        , m_desc(desc)
+        , m_placed(placed)
+    {
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+
+        m_deviceState->textureCount.fetch_add(1, std::memory_order_relaxed);
+        if (!m_placed)
+        {
+            m_deviceState->AddMemory(GetMemoryCategory(), ComputeSize(desc));
+        }
+    }
+
+    NullTexture::~NullTexture()
+    {
+        m_deviceState->textureCount.fetch_sub(1, std::memory_order_relaxed);
+        if (!m_placed)
+        {
+            m_deviceState->RemoveMemory(GetMemoryCategory(), ComputeSize(m_desc));
+        }
+    }
+
+    uint64 NullTexture::ComputeSize(const RHITextureDesc& desc)
+    {
+        const uint64 bytesPerPixel = std::max<uint32>(GetFormatBytesPerPixel(desc.format), 1);
+        const uint64 samples = static_cast<uint64>(desc.sampleCount);
+
+        uint64 width = desc.width;
+        uint64 height = desc.height;
+        uint64 depth = desc.depth;
+        uint64 total = 0;
+        for (uint32 mip = 0; mip < std::max<uint32>(desc.mipLevels, 1); ++mip)
+        {
+            total += width * height * depth * bytesPerPixel;
+            width = std::max<uint64>(width / 2, 1);
+            height = std::max<uint64>(height / 2, 1);
+            if (desc.dimension == RHITextureDimension::Texture3D)
+            {
+                depth = std::max<uint64>(depth / 2, 1);
+            }
+        }
+
+        return total * std::max<uint32>(desc.arraySize, 1) * std::max<uint64>(samples, 1);
+    }
+
+    std::atomic<uint64>& NullTexture::GetMemoryCategory() const
+    {
+        if (HasFlag(m_desc.usage, RHITextureUsage::RenderTarget) ||
+            HasFlag(m_desc.usage, RHITextureUsage::DepthStencil))
+        {
+            return m_deviceState->renderTargetMemory;
+        }
+        return m_deviceState->textureMemory;
+    }
+
+    // =============================================================================
+    // Null Texture View Implementation
+    // =============================================================================
+    NullTextureView::NullTextureView(RHITexture* texture, const RHITextureViewDesc& desc)
+        : m_texture(texture)
+        , m_format(desc.format == RHIFormat::Unknown ? texture->GetFormat() : desc.format)
+        , m_subresourceRange(desc.subresourceRange)
+    {
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+    }
+
+    // =============================================================================
+    // Null Shader Implementation
+    // =============================================================================
+    NullShader::NullShader(const RHIShaderDesc& desc)
+        : m_stage(desc.stage)
+    {
+        if (desc.bytecode && desc.bytecodeSize > 0)
+        {
+            const uint8* bytes = static_cast<const uint8*>(desc.bytecode);
+            m_bytecode.assign(bytes, bytes + desc.bytecodeSize);
+        }
+
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+    }
+
+    // =============================================================================
+    // Null Heap Implementation
+    // =============================================================================
+    NullHeap::NullHeap(NullDeviceStateRef state, const RHIHeapDesc& desc)
+        : m_deviceState(std::move(state))
+        , m_desc(desc)
+    {
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+
+        m_deviceState->AddMemory(m_deviceState->textureMemory, desc.size);
+    }
+
+    NullHeap::~NullHeap()
+    {
+        m_deviceState->RemoveMemory(m_deviceState->textureMemory, m_desc.size);
+    }
+
+    // =============================================================================
+    // Null Fence Implementation
+    // =============================================================================
+    void NullFence::Signal(uint64 value)
+    {
+        // Fence values only move forward, as on the GPU backends
+        uint64 current = m_value.load(std::memory_order_relaxed);
+        while (value > current && !m_value.compare_exchange_weak(current, value, std::memory_order_release))
+        {
+        }
+    }
+
+    void NullFence::SignalOnQueue(uint64 value, RHICommandQueueType queueType)
+    {
+        (void)queueType;
+        Signal(value);
+    }
+
+    void NullFence::Wait(uint64 value, uint64 timeoutNs)
+    {
+        (void)timeoutNs;
+        if (GetCompletedValue() < value)
+        {
+            RVX_RHI_WARN("[Null] Waiting for fence value {} that was never signaled (completed {})",
+                         value, GetCompletedValue());
+        }
+    }
+
+    // =============================================================================
+    // Null SwapChain Implementation
+    // =============================================================================
+    NullSwapChain::NullSwapChain(NullDeviceStateRef state, const RHISwapChainDesc& desc)
+        : m_deviceState(std::move(state))
+        , m_desc(desc)
+    {
+        m_desc.bufferCount = std::max<uint32>(m_desc.bufferCount, 1);
+        m_desc.width = std::max<uint32>(m_desc.width, 1);
+        m_desc.height = std::max<uint32>(m_desc.height, 1);
+
+        if (desc.debugName && desc.debugName[0])
+        {
+            SetDebugName(desc.debugName);
+        }
+
+        CreateBackBuffers();
+    }
+
+    void NullSwapChain::CreateBackBuffers()
+    {
+        m_backBufferViews.clear();
+        m_backBuffers.clear();
+
+        for (uint32 i = 0; i < m_desc.bufferCount; ++i)
+        {
+            RHITextureDesc textureDesc = RHITextureDesc::Texture2D(
+                m_desc.width, m_desc.height, m_desc.format, RHITextureUsage::RenderTarget | RHITextureUsage::CopySrc);
+            textureDesc.debugName = "NullBackBuffer";
+
+            auto texture = Ref<NullTexture>(new NullTexture(m_deviceState, textureDesc));
+            // Back buffers start out presentable, like a freshly created DXGI/Vulkan swapchain image
+            texture->SetTrackedState(RHIResourceState::Present);
+
+            RHITextureViewDesc viewDesc;
+            m_backBufferViews.push_back(Ref<NullTextureView>(new NullTextureView(texture.Get(), viewDesc)));
+            m_backBuffers.push_back(texture);
+        }
+
+        m_currentIndex = 0;
+    }
+
+    void NullSwapChain::Present()
+    {
+        auto* backBuffer = static_cast<NullTexture*>(m_backBuffers[m_currentIndex].Get());
+        const RHIResourceState state = backBuffer->GetTrackedState();
+        if (state != RHIResourceState::Present && !IsNullUntrackedState(state))
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Presenting back buffer {} in state {} instead of Present",
+                                      m_currentIndex, static_cast<uint32>(state));
+        }
+
+        m_currentIndex = (m_currentIndex + 1) % m_desc.bufferCount;
+    }
+
+    void NullSwapChain::Resize(uint32 width, uint32 height)
+    {
+        if (width == 0 || height == 0)
+        {
+            return;
+        }
+
+        m_desc.width = width;
+        m_desc.height = height;
+        CreateBackBuffers();
+    }
+
+    // =============================================================================
+    // Null Staging Buffer Implementation
+    // =============================================================================
+    NullStagingBuffer::NullStagingBuffer(NullDeviceStateRef state, const RHIStagingBufferDesc& desc)
+        : m_deviceState(std::move(state))
+    {
+        RHIBufferDesc bufferDesc;
+        bufferDesc.size = desc.size;
+        bufferDesc.usage = RHIBufferUsage::None;
+        bufferDesc.memoryType = RHIMemoryType::Upload;
+        bufferDesc.debugName = desc.debugName;
+        m_buffer = Ref<NullBuffer>(new NullBuffer(m_deviceState, bufferDesc));
+    }
+
+    void* NullStagingBuffer::Map(uint64 offset, uint64 size)
+    {
+        const uint64 bufferSize = m_buffer->GetSize();
+        const uint64 mapSize = size == RVX_WHOLE_SIZE ? bufferSize - std::min(offset, bufferSize) : size;
+        if (offset > bufferSize || mapSize > bufferSize - offset)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Staging buffer map [{}, +{}) exceeds size {}",
+                                      offset, mapSize, bufferSize);
+            return nullptr;
+        }
+
+        auto* data = static_cast<uint8*>(m_buffer->Map());
+        return data ? data + offset : nullptr;
+    }
+
+    void NullStagingBuffer::Unmap()
+    {
+        m_buffer->Unmap();
+    }
+
+    // =============================================================================
+    // Null Ring Buffer Implementation
+    // =============================================================================
+    NullRingBuffer::NullRingBuffer(NullDeviceStateRef state, const RHIRingBufferDesc& desc)
+        : m_deviceState(std::move(state))
+        , m_alignment(std::max<uint32>(desc.alignment, 1))
+    {
+        RHIBufferDesc bufferDesc;
+        bufferDesc.size = desc.size;
+        bufferDesc.usage = RHIBufferUsage::Constant;
+        bufferDesc.memoryType = RHIMemoryType::Upload;
+        bufferDesc.debugName = desc.debugName;
+        m_buffer = Ref<NullBuffer>(new NullBuffer(m_deviceState, bufferDesc));
+
+        // Persistently mapped, matching the GPU backends
+        m_mapped = static_cast<uint8*>(m_buffer->Map());
+    }
+
+    NullRingBuffer::~NullRingBuffer()
+    {
+        m_buffer->Unmap();
+    }
+
+    RHIRingAllocation NullRingBuffer::Allocate(uint64 size)
+    {
+        const uint64 alignedSize = (size + m_alignment - 1) / m_alignment * m_alignment;
+        const uint64 bufferSize = m_buffer->GetSize();
+
+        // Work completes at submit, so only allocations since the last Reset are live
+        if (size == 0 || m_head + alignedSize > bufferSize)
+        {
+            RVX_NULL_VALIDATION_ERROR(*m_deviceState, "Ring buffer allocation of {} bytes failed ({} of {} used)",
+                                      size, m_head, bufferSize);
+            return {};
+        }
+
+        RHIRingAllocation allocation;
+        allocation.cpuAddress = m_mapped + m_head;
+        allocation.gpuOffset = m_head;
+        allocation.size = alignedSize;
+        allocation.buffer = m_buffer.Get();
+
+        m_head += alignedSize;
+        return allocation;
+    }
+
+    void NullRingBuffer::Reset(uint32 frameIndex)
+    {
+        (void)frameIndex;
+        m_head = 0;
+    }
+
+} // namespace RVX
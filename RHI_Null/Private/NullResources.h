@@ -0,0 +1,269 @@
+#pragma once
+
+#include "NullCommon.h"
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHITexture.h"
+#include "RHI/RHISampler.h"
+#include "RHI/RHIShader.h"
+#include "RHI/RHIHeap.h"
+#include "RHI/RHIQuery.h"
+#include "RHI/RHISynchronization.h"
+#include "RHI/RHISwapChain.h"
+#include "RHI/RHIUpload.h"
+
+#include <vector>
+
+namespace RVX
+{
+    // =============================================================================
+    // Null Buffer
+    // =============================================================================
+    /**
+     * @brief In-memory buffer
+     *
+     * Upload and readback buffers own CPU storage so Map works as it would on
+     * a GPU backend. Default (GPU-only) buffers only record their size, which
+     * keeps large vertex and structured buffers free; mapping one is a usage
+     * error.
+     */
+    class NullBuffer : public RHIBuffer
+    {
+    public:
+        NullBuffer(NullDeviceStateRef state, const RHIBufferDesc& desc, bool placed = false);
+        ~NullBuffer() override;
+
+        // RHIBuffer interface
+        uint64 GetSize() const override { return m_desc.size; }
+        RHIBufferUsage GetUsage() const override { return m_desc.usage; }
+        RHIMemoryType GetMemoryType() const override { return m_desc.memoryType; }
+        uint32 GetStride() const override { return m_desc.stride; }
+        void* Map() override;
+        void Unmap() override;
+
+        // Null Specific
+        RHIResourceState GetTrackedState() const { return m_state.load(std::memory_order_relaxed); }
+        void SetTrackedState(RHIResourceState state) { m_state.store(state, std::memory_order_relaxed); }
+
+    private:
+        NullDeviceStateRef m_deviceState;
+        RHIBufferDesc m_desc;
+        bool m_placed = false;
+        std::vector<uint8> m_storage;
+        std::atomic<uint32> m_mapCount{0};
+        std::atomic<RHIResourceState> m_state{RHIResourceState::Common};
+    };
+
+    // =============================================================================
+    // Null Texture
+    // =============================================================================
+    class NullTexture : public RHITexture
+    {
+    public:
+        NullTexture(NullDeviceStateRef state, const RHITextureDesc& desc, bool placed = false);
+        ~NullTexture() override;
+
+        // RHITexture interface
+        uint32 GetWidth() const override { return m_desc.width; }
+        uint32 GetHeight() const override { return m_desc.height; }
+        uint32 GetDepth() const override { return m_desc.depth; }
+        uint32 GetMipLevels() const override { return m_desc.mipLevels; }
+        uint32 GetArraySize() const override { return m_desc.arraySize; }
+        RHIFormat GetFormat() const override { return m_desc.format; }
+        RHITextureUsage GetUsage() const override { return m_desc.usage; }
+        RHITextureDimension GetDimension() const override { return m_desc.dimension; }
+        RHISampleCount GetSampleCount() const override { return m_desc.sampleCount; }
+
+        // Null Specific
+        /// Whole-texture state; Undefined after a partial-range barrier until the next full one
+        RHIResourceState GetTrackedState() const { return m_state.load(std::memory_order_relaxed); }
+        void SetTrackedState(RHIResourceState state) { m_state.store(state, std::memory_order_relaxed); }
+
+        /// Bytes the texture would occupy, including its mip chain
+        static uint64 ComputeSize(const RHITextureDesc& desc);
+
+    private:
+        std::atomic<uint64>& GetMemoryCategory() const;
+
+        NullDeviceStateRef m_deviceState;
+        RHITextureDesc m_desc;
+        bool m_placed = false;
+        std::atomic<RHIResourceState> m_state{RHIResourceState::Common};
+    };
+
+    // =============================================================================
+    // Null Texture View
+    // =============================================================================
+    class NullTextureView : public RHITextureView
+    {
+    public:
+        NullTextureView(RHITexture* texture, const RHITextureViewDesc& desc);
+
+        RHITexture* GetTexture() const override { return m_texture.Get(); }
+        RHIFormat GetFormat() const override { return m_format; }
+        const RHISubresourceRange& GetSubresourceRange() const override { return m_subresourceRange; }
+
+    private:
+        RHITextureRef m_texture;
+        RHIFormat m_format = RHIFormat::Unknown;
+        RHISubresourceRange m_subresourceRange;
+    };
+
+    // =============================================================================
+    // Null Sampler
+    // =============================================================================
+    class NullSampler : public RHISampler
+    {
+    public:
+        explicit NullSampler(const RHISamplerDesc& desc) : m_desc(desc) {}
+
+        const RHISamplerDesc& GetDesc() const { return m_desc; }
+
+    private:
+        RHISamplerDesc m_desc;
+    };
+
+    // =============================================================================
+    // Null Shader
+    // =============================================================================
+    class NullShader : public RHIShader
+    {
+    public:
+        explicit NullShader(const RHIShaderDesc& desc);
+
+        RHIShaderStage GetStage() const override { return m_stage; }
+        const std::vector<uint8>& GetBytecode() const override { return m_bytecode; }
+
+    private:
+        RHIShaderStage m_stage = RHIShaderStage::None;
+        std::vector<uint8> m_bytecode;
+    };
+
+    // =============================================================================
+    // Null Heap
+    // =============================================================================
+    class NullHeap : public RHIHeap
+    {
+    public:
+        NullHeap(NullDeviceStateRef state, const RHIHeapDesc& desc);
+        ~NullHeap() override;
+
+        uint64 GetSize() const override { return m_desc.size; }
+        RHIHeapType GetType() const override { return m_desc.type; }
+        RHIHeapFlags GetFlags() const override { return m_desc.flags; }
+
+    private:
+        NullDeviceStateRef m_deviceState;
+        RHIHeapDesc m_desc;
+    };
+
+    // =============================================================================
+    // Null Query Pool
+    // =============================================================================
+    class NullQueryPool : public RHIQueryPool
+    {
+    public:
+        explicit NullQueryPool(const RHIQueryPoolDesc& desc) : m_desc(desc) {}
+
+        RHIQueryType GetType() const override { return m_desc.type; }
+        uint32 GetCount() const override { return m_desc.count; }
+        uint64 GetTimestampFrequency() const override { return 1000000000ull; }
+
+    private:
+        RHIQueryPoolDesc m_desc;
+    };
+
+    // =============================================================================
+    // Null Fence
+    // =============================================================================
+    /**
+     * @brief Fence whose signals complete immediately
+     *
+     * Submitted work finishes at submission on the Null device, so GPU-side
+     * signals land when the context is submitted and waits never block.
+     */
+    class NullFence : public RHIFence
+    {
+    public:
+        explicit NullFence(uint64 initialValue) : m_value(initialValue) {}
+
+        uint64 GetCompletedValue() const override { return m_value.load(std::memory_order_acquire); }
+        void Signal(uint64 value) override;
+        void SignalOnQueue(uint64 value, RHICommandQueueType queueType) override;
+        void Wait(uint64 value, uint64 timeoutNs) override;
+
+    private:
+        std::atomic<uint64> m_value{0};
+    };
+
+    // =============================================================================
+    // Null SwapChain
+    // =============================================================================
+    class NullSwapChain : public RHISwapChain
+    {
+    public:
+        NullSwapChain(NullDeviceStateRef state, const RHISwapChainDesc& desc);
+
+        RHITexture* GetCurrentBackBuffer() override { return m_backBuffers[m_currentIndex].Get(); }
+        RHITextureView* GetCurrentBackBufferView() override { return m_backBufferViews[m_currentIndex].Get(); }
+        uint32 GetCurrentBackBufferIndex() const override { return m_currentIndex; }
+
+        void Present() override;
+        void Resize(uint32 width, uint32 height) override;
+
+        uint32 GetWidth() const override { return m_desc.width; }
+        uint32 GetHeight() const override { return m_desc.height; }
+        RHIFormat GetFormat() const override { return m_desc.format; }
+        uint32 GetBufferCount() const override { return m_desc.bufferCount; }
+
+    private:
+        void CreateBackBuffers();
+
+        NullDeviceStateRef m_deviceState;
+        RHISwapChainDesc m_desc;
+        uint32 m_currentIndex = 0;
+        std::vector<RHITextureRef> m_backBuffers;
+        std::vector<RHITextureViewRef> m_backBufferViews;
+    };
+
+    // =============================================================================
+    // Null Staging Buffer
+    // =============================================================================
+    class NullStagingBuffer : public RHIStagingBuffer
+    {
+    public:
+        NullStagingBuffer(NullDeviceStateRef state, const RHIStagingBufferDesc& desc);
+
+        void* Map(uint64 offset, uint64 size) override;
+        void Unmap() override;
+        uint64 GetSize() const override { return m_buffer->GetSize(); }
+        RHIBuffer* GetBuffer() const override { return m_buffer.Get(); }
+
+    private:
+        NullDeviceStateRef m_deviceState;
+        Ref<NullBuffer> m_buffer;
+    };
+
+    // =============================================================================
+    // Null Ring Buffer
+    // =============================================================================
+    class NullRingBuffer : public RHIRingBuffer
+    {
+    public:
+        NullRingBuffer(NullDeviceStateRef state, const RHIRingBufferDesc& desc);
+        ~NullRingBuffer() override;
+
+        RHIRingAllocation Allocate(uint64 size) override;
+        void Reset(uint32 frameIndex) override;
+        RHIBuffer* GetBuffer() const override { return m_buffer.Get(); }
+        uint64 GetSize() const override { return m_buffer->GetSize(); }
+        uint32 GetAlignment() const override { return m_alignment; }
+
+    private:
+        NullDeviceStateRef m_deviceState;
+        Ref<NullBuffer> m_buffer;
+        uint8* m_mapped = nullptr;
+        uint32 m_alignment = 256;
+        uint64 m_head = 0;
+    };
+
+} // namespace RVX
@@ -9,6 +9,8 @@
 #include "Render/Context/FrameSynchronizer.h"
 #include <memory>
 #include <array>
+#include <span>
+#include <vector>
 
 namespace RVX
 {
@@ -135,6 +137,19 @@ namespace RVX
          */
         void EndFrame();
 
+        /**
+         * @brief Open extra graphics contexts for multi-threaded recording
+         * @param count Number of contexts to record into
+         * @return Open contexts in submission order, starting with the current graphics context
+         *
+         * Must be called between BeginFrame and EndFrame. The returned contexts
+         * may be recorded on different threads. Afterwards GetGraphicsContext()
+         * returns a fresh context that is submitted after them, so anything
+         * recorded later lands behind the parallel work. EndFrame submits every
+         * context of the frame in order.
+         */
+        std::span<RHICommandContext* const> BeginParallelRecording(uint32_t count);
+
         /**
          * @brief Present the frame to the screen
          */
@@ -184,6 +199,7 @@ namespace RVX
     private:
         void CreateCommandContexts();
         void DestroyCommandContexts();
+        RHICommandContext* AcquireFrameContext();
 
         RenderContextConfig m_config;
         bool m_initialized = false;
@@ -196,6 +212,13 @@ namespace RVX
         // Per-frame command contexts
         std::array<RHICommandContextRef, RVX_MAX_FRAME_COUNT> m_graphicsContexts;
         std::array<RHICommandContextRef, RVX_MAX_FRAME_COUNT> m_computeContexts;
+
+        // Extra graphics contexts for parallel recording, grown on demand per frame slot
+        std::array<std::vector<RHICommandContextRef>, RVX_MAX_FRAME_COUNT> m_extraGraphicsContexts;
+        uint32_t m_extraContextsUsed = 0;
+        RHICommandContext* m_currentGraphicsContext = nullptr;
+        std::vector<RHICommandContext*> m_frameSubmitList;   // Graphics contexts of this frame, in order
+        std::vector<RHICommandContext*> m_parallelContexts;
         
         // Async compute fences for graphics-compute synchronization
         std::array<RHIFenceRef, RVX_MAX_FRAME_COUNT> m_computeFences;
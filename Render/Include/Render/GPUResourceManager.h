@@ -214,6 +214,10 @@ namespace RVX
         /// Transition a resident texture to the requested state if needed
         bool TransitionTexture(Resource::ResourceId textureId, RHICommandContext& ctx, RHIResourceState desiredState);
 
+        /// Same as above, but appends the barrier to outBarriers for recording later
+        bool TransitionTexture(Resource::ResourceId textureId, std::vector<RHITextureBarrier>& outBarriers,
+                               RHIResourceState desiredState);
+
         /// Check if a resource is GPU-resident
         bool IsResident(Resource::ResourceId id) const;
 
@@ -11,6 +11,7 @@
 #include "RHI/RHI.h"
 #include <functional>
 #include <memory>
+#include <span>
 
 namespace RVX
 {
@@ -53,6 +54,29 @@ namespace RVX
         Copy,
     };
 
+    // =============================================================================
+    // Render Graph Record Range
+    // =============================================================================
+    /**
+     * @brief Slice of a parallel pass's items recorded into one command context
+     *
+     * A parallel pass may be split into chunks that are recorded on different
+     * threads into consecutive command contexts. Chunk 0 is recorded first on
+     * the GPU timeline, so work that must happen once (clears, barriers) goes
+     * in the first chunk.
+     */
+    struct RGRecordRange
+    {
+        uint32 begin = 0;
+        uint32 end = 0;
+        uint32 chunkIndex = 0;
+        uint32 chunkCount = 1;
+
+        uint32 Count() const { return end - begin; }
+        bool IsFirst() const { return chunkIndex == 0; }
+        bool IsLast() const { return chunkIndex + 1 == chunkCount; }
+    };
+
     // =============================================================================
     // Render Graph Builder
     // =============================================================================
@@ -123,6 +147,24 @@ namespace RVX
             std::function<void(RenderGraphBuilder&, Data&)> setup,
             std::function<void(const Data&, RHICommandContext&)> execute);
 
+        /**
+         * @brief Add a pass whose recording can be split across threads
+         * @param prepare Runs on the executing thread, in pass order, before any
+         *                recording starts. Does all work that touches shared
+         *                state (uploads, descriptor sets, state tracking) and
+         *                returns the number of items to record.
+         * @param record Records the items of one range. May run on a worker
+         *               thread concurrently with other ranges and passes, so it
+         *               must only read the prepared data.
+         */
+        template<typename Data>
+        void AddParallelPass(
+            const char* name,
+            RenderGraphPassType type,
+            std::function<void(RenderGraphBuilder&, Data&)> setup,
+            std::function<uint32(Data&)> prepare,
+            std::function<void(const Data&, RHICommandContext&, const RGRecordRange&)> record);
+
         // Compile the graph
         void Compile();
 
@@ -144,6 +186,37 @@ namespace RVX
                           RHIFence* computeFence,
                           uint64 frameIndex = 0);
 
+        /**
+         * @brief Execute the graph recording into several command contexts
+         * @param contexts Open graphics contexts, submitted by the caller in span order
+         *
+         * The compiled pass list is cut into contiguous segments, one per
+         * context, balanced by the item counts of parallel passes; parallel
+         * passes with enough items are also split into chunks. Each pass's
+         * barriers are recorded at its start, so any cut is a safe barrier
+         * boundary as long as the contexts are submitted in order. Segments
+         * are recorded on JobSystem workers; segments holding passes added
+         * with AddPass() are recorded on the calling thread, since their
+         * execute callbacks may touch shared state. Export barriers go into
+         * the last context.
+         */
+        void ExecuteParallel(std::span<RHICommandContext* const> contexts);
+
+        /// Minimum items of a parallel pass per recorded chunk (default 64)
+        void SetParallelRecordingGranularity(uint32 minItemsPerChunk);
+
+        struct ExecuteStats
+        {
+            uint32 contextCount = 0;         // Contexts the last execute recorded into
+            uint32 recordUnitCount = 0;      // Passes plus extra chunks of split passes
+            uint32 splitPassCount = 0;       // Parallel passes split over several contexts
+            uint32 workerSegmentCount = 0;   // Segments recorded on JobSystem workers
+            double prepareTimeMs = 0.0;
+            double recordTimeMs = 0.0;
+        };
+
+        const ExecuteStats& GetExecuteStats() const;
+
         struct CompileStats
         {
             // Pass statistics
@@ -174,6 +247,14 @@ namespace RVX
             uint64 memoryWithoutAliasing = 0;  // Total memory if no aliasing
             uint64 memoryWithAliasing = 0;      // Actual memory used with aliasing
             uint32 transientHeapCount = 0;
+
+            // Compile cache statistics (hit/miss counts and saved time accumulate over the graph's lifetime)
+            bool compiledFromCache = false;     // Whether the last Compile() replayed a cached result
+            uint64 graphSignature = 0;          // Hash of the pass/resource signature that was compiled
+            uint32 compileCacheHits = 0;
+            uint32 compileCacheMisses = 0;
+            double compileTimeMs = 0.0;         // Time spent in the last Compile()
+            double compileTimeSavedMs = 0.0;    // Full compile time avoided by replays
             
             // Memory savings percentage (0-100)
             float GetMemorySavingsPercent() const {
@@ -181,6 +262,13 @@ namespace RVX
                 return 100.0f * (1.0f - static_cast<float>(memoryWithAliasing) / 
                     static_cast<float>(memoryWithoutAliasing));
             }
+
+            // Compile cache hit rate percentage (0-100)
+            float GetCompileCacheHitRate() const {
+                uint32 total = compileCacheHits + compileCacheMisses;
+                if (total == 0) return 0.0f;
+                return 100.0f * static_cast<float>(compileCacheHits) / static_cast<float>(total);
+            }
         };
 
         const CompileStats& GetCompileStats() const;
@@ -189,6 +277,20 @@ namespace RVX
         void SetMemoryAliasingEnabled(bool enabled);
         bool IsMemoryAliasingEnabled() const;
 
+        /**
+         * @brief Compile cache control
+         *
+         * Compile() hashes the pass and resource signature of the graph. When it
+         * matches the previous compile, the cached execution order, culling,
+         * barriers and aliases are replayed instead of recompiling. Transient
+         * resources are still created each frame and barriers are rebound to
+         * them and to the imported resources given this frame. The cache
+         * survives Clear() but holds no RHI objects.
+         */
+        void SetCompileCacheEnabled(bool enabled);
+        bool IsCompileCacheEnabled() const;
+        void InvalidateCompileCache();
+
         // Debug/Visualization
         std::string ExportGraphviz() const;
         bool SaveGraphviz(const char* filename) const;
@@ -203,6 +305,13 @@ namespace RVX
             std::function<void(RenderGraphBuilder&)> setup,
             std::function<void(RHICommandContext&)> execute);
 
+        void AddParallelPassInternal(
+            const char* name,
+            RenderGraphPassType type,
+            std::function<void(RenderGraphBuilder&)> setup,
+            std::function<uint32()> prepare,
+            std::function<void(RHICommandContext&, const RGRecordRange&)> record);
+
         class Impl;
         std::unique_ptr<Impl> m_impl;
     };
@@ -228,4 +337,30 @@ namespace RVX
             });
     }
 
+    template<typename Data>
+    void RenderGraph::AddParallelPass(
+        const char* name,
+        RenderGraphPassType type,
+        std::function<void(RenderGraphBuilder&, Data&)> setup,
+        std::function<uint32(Data&)> prepare,
+        std::function<void(const Data&, RHICommandContext&, const RGRecordRange&)> record)
+    {
+        auto data = std::make_shared<Data>();
+        AddParallelPassInternal(
+            name,
+            type,
+            [data, setup](RenderGraphBuilder& builder)
+            {
+                setup(builder, *data);
+            },
+            [data, prepare]() -> uint32
+            {
+                return prepare ? prepare(*data) : 0;
+            },
+            [data, record](RHICommandContext& ctx, const RGRecordRange& range)
+            {
+                record(*data, ctx, range);
+            });
+    }
+
 } // namespace RVX
@@ -66,11 +66,15 @@ namespace RVX
      * 
      * Implements clustered forward shading:
      * 1. Divide view frustum into 3D grid of clusters
-     * 2. Compute cluster AABBs
-     * 3. Cull lights against clusters
+     * 2. Compute cluster AABBs (cached until the projection changes)
+     * 3. Bin each light into the cluster range its bounds cover, testing
+     *    only those clusters; spot lights use a cone test
      * 4. Create light index lists
      * 5. Shade pixels using their cluster's light list
      * 
+     * Light assignment runs in parallel across depth slices on the
+     * JobSystem, or serially if it is not initialized.
+     * 
      * Benefits:
      * - O(1) light lookup per pixel
      * - Scales well with many lights
@@ -182,6 +186,7 @@ namespace RVX
             uint32 totalLightAssignments = 0;
             uint32 maxLightsInCluster = 0;
             float avgLightsPerCluster = 0.0f;
+            uint32 clusterTests = 0;        ///< Light-vs-cluster tests performed
         };
 
         Statistics GetStatistics() const { return m_stats; }
@@ -192,16 +197,47 @@ namespace RVX
         void SetDebugVisualization(bool enable) { m_debugVisualize = enable; }
         bool IsDebugVisualizationEnabled() const { return m_debugVisualize; }
 
-    private:
+        /**
+         * @brief View-space bounds of a cluster
+         */
         struct ClusterAABB
         {
             Vec4 minPoint;  // .w unused
             Vec4 maxPoint;  // .w unused
         };
 
+        /// Cluster bounds, indexed like the cluster buffer
+        const std::vector<ClusterAABB>& GetClusterAABBs() const { return m_clusterAABBs; }
+
+        /// Cluster offsets and counts of the last AssignLights()
+        const std::vector<GPUCluster>& GetClusters() const { return m_clusters; }
+
+        /// Light index lists of the last AssignLights()
+        const std::vector<LightIndex>& GetLightIndices() const { return m_lightIndices; }
+
+    private:
+        /// View-space light bounds and the depth slices they cover
+        struct LightBounds
+        {
+            Vec3 center;            ///< Bounding sphere used for binning
+            float radius = 0.0f;
+            Vec3 position;          ///< Light position
+            float range = 0.0f;
+            Vec3 direction;         ///< Spot lights only
+            float cosAngle = 0.0f;  ///< Cosine of the outer cone angle
+            float sinAngle = 0.0f;
+            uint16 lightIndex = 0;
+            uint16 lightType = 0;   ///< 0 = point, 1 = spot
+            uint32 firstSlice = 0;
+            uint32 lastSlice = 0;
+        };
+
         void BuildClusterAABBs();
         void ClearClusters();
-        bool IntersectsCluster(const ClusterAABB& cluster, const Vec3& lightPos, float range);
+        void AddLightBounds(LightBounds bounds);
+        void AssignSlice(uint32 z);
+        static bool IntersectsCluster(const ClusterAABB& cluster, const Vec3& lightPos, float range);
+        static bool IntersectsCone(const ClusterAABB& cluster, const LightBounds& light);
 
         IRHIDevice* m_device = nullptr;
         ClusteringConfig m_config;
@@ -218,6 +254,21 @@ namespace RVX
         std::vector<GPUCluster> m_clusters;
         std::vector<LightIndex> m_lightIndices;
 
+        // Cluster AABBs are valid for this projection
+        Mat4 m_clusterProjMatrix;
+        bool m_clusterAABBsValid = false;
+
+        // Per-slice extents for binning: depth range of each slice, and
+        // the x range of each column and y range of each row within it
+        std::vector<Vec2> m_sliceDepthBounds;
+        std::vector<Vec2> m_columnBounds;
+        std::vector<Vec2> m_rowBounds;
+
+        // Light assignment scratch
+        std::vector<LightBounds> m_lightBounds;
+        std::vector<LightIndex> m_clusterLights;    ///< maxLightsPerCluster slots per cluster
+        std::vector<uint32> m_sliceTests;
+
         // GPU buffers
         RHIBufferRef m_clusterAABBBuffer;
         RHIBufferRef m_clusterBuffer;
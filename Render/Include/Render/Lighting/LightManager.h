@@ -150,8 +150,8 @@ namespace RVX
         uint32 GetPointLightCount() const { return static_cast<uint32>(m_pointLights.size()); }
         uint32 GetSpotLightCount() const { return static_cast<uint32>(m_spotLights.size()); }
 
-        static constexpr uint32 MaxPointLights = 256;
-        static constexpr uint32 MaxSpotLights = 128;
+        static constexpr uint32 MaxPointLights = 1024;
+        static constexpr uint32 MaxSpotLights = 512;
 
     private:
         void EnsureBuffers();
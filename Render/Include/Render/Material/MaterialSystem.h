@@ -56,6 +56,12 @@ namespace RVX
         // Material Binding Data
         // =====================================================================
 
+        /**
+         * @brief Make a material's constants current for the next set 2 bind
+         *
+         * Constants are written once per material per frame; later calls for
+         * the same material in that frame select the slot already written.
+         */
         void UpdateMaterialConstants(const Resource::MaterialResource* materialResource,
                                      ResourceViewCache* viewCache);
         RHIDescriptorSet* GetOrCreateMaterialSet(const Resource::MaterialResource* materialResource,
@@ -138,6 +144,7 @@ namespace RVX
         uint64 m_materialConstantStride = 0;
         uint64 m_materialConstantCursor = 0;
         uint64 m_currentMaterialConstantOffset = 0;
+        std::unordered_map<const Resource::MaterialResource*, uint64> m_frameMaterialConstantOffsets;
 
         RHITextureRef m_defaultWhiteTexture;
         RHITextureRef m_defaultNormalTexture;
@@ -7,16 +7,17 @@
 
 #include "Render/Passes/IRenderPass.h"
 #include "Render/Graph/RenderGraph.h"
+#include "Render/GPUResourceManager.h"
+#include "Render/PipelineCache.h"
 #include "Render/Renderer/RenderDrawItem.h"
+#include <array>
 #include <cstdint>
 #include <vector>
 
 namespace RVX
 {
     // Forward declarations
-    class GPUResourceManager;
     class MaterialSystem;
-    class PipelineCache;
     class RenderScene;
 
     /**
@@ -24,6 +25,16 @@ namespace RVX
      * 
      * Renders all opaque geometry in the scene with front-to-back sorting
      * for optimal early-z rejection.
+     *
+     * Consecutive draw items that share mesh, submesh and material are merged
+     * into one instanced draw. The world matrices of every instance are
+     * uploaded to the PipelineCache object ring in a single write per frame,
+     * and each draw binds the object window at its first instance.
+     *
+     * The pass is added as a parallel RenderGraph pass: all bindings are
+     * resolved up front on the render thread, and the draw list can then be
+     * recorded in chunks on several threads. Chunks after the first reopen
+     * the render pass with load instead of clear.
      * 
      * Uses separate vertex buffer slots:
      *   Slot 0: Position
@@ -44,6 +55,7 @@ namespace RVX
 
         void Setup(RenderGraphBuilder& builder, const ViewData& view) override;
         void Execute(RHICommandContext& ctx, const ViewData& view) override;
+        void AddToGraph(RenderGraph& graph, const ViewData& view) override;
 
         // =====================================================================
         // Resource Dependencies
@@ -75,7 +87,48 @@ namespace RVX
          */
         void SetRenderTargets(RHITextureView* colorTargetView, RHITextureView* depthTargetView);
 
+        // =====================================================================
+        // Statistics
+        // =====================================================================
+
+        struct Statistics
+        {
+            uint32_t drawItems = 0;     ///< Draw items submitted to the pass
+            uint32_t drawCalls = 0;     ///< Instanced draws issued for them
+        };
+
+        const Statistics& GetStatistics() const { return m_stats; }
+
     private:
+        /// Run of consecutive draw items drawn with one DrawIndexed
+        struct InstancedDraw
+        {
+            uint64_t meshId = 0;
+            uint32_t submeshIndex = 0;
+            const Resource::MaterialResource* materialResource = nullptr;
+            uint32_t firstInstance = 0;
+            uint32_t instanceCount = 0;
+        };
+
+        /// Instanced draw with every binding resolved, recordable from any thread
+        struct DrawPacket
+        {
+            uint32_t meshIndex = 0;           // Into m_meshBuffers
+            uint32_t submeshIndex = 0;
+            uint32_t instanceCount = 0;
+            RHIDescriptorSet* materialSet = nullptr;
+            std::array<uint32, 1> objectDynamicOffsets = {};
+            std::array<uint32, 1> materialDynamicOffsets = {};
+        };
+
+        void BuildInstancedDraws(const std::vector<RenderDrawItem>& drawItems);
+
+        /// Resolve this frame's draws on the render thread, returns the draw packet count
+        uint32_t PrepareDraws(const ViewData& view);
+
+        /// Record a range of the prepared draw packets
+        void RecordDraws(RHICommandContext& ctx, const ViewData& view, const RGRecordRange& range) const;
+
         RGTextureHandle m_colorTargetHandle;
         RGTextureHandle m_depthTargetHandle;
 
@@ -94,6 +147,19 @@ namespace RVX
         // Device reference
         IRHIDevice* m_device = nullptr;
 
+        // Per-frame instancing scratch, reused across frames
+        std::vector<InstancedDraw> m_instancedDraws;
+        std::vector<ObjectConstants> m_instanceData;
+        Statistics m_stats;
+
+        // Prepared for recording, read-only while chunks are recorded
+        bool m_prepared = false;
+        RHIPipeline* m_pipeline = nullptr;
+        RHIDescriptorSet* m_frameSet = nullptr;
+        RHIDescriptorSet* m_objectSet = nullptr;
+        std::vector<RHITextureBarrier> m_textureBarriers;
+        std::vector<MeshGPUBuffers> m_meshBuffers;
+        std::vector<DrawPacket> m_drawPackets;
     };
 
 } // namespace RVX
@@ -10,13 +10,16 @@
  */
 
 #include "Render/Passes/IRenderPass.h"
+#include "Render/PipelineCache.h"
 #include "Core/MathTypes.h"
+#include "Core/Math/Frustum.h"
+#include <array>
+#include <vector>
 
 namespace RVX
 {
     class RenderScene;
     class GPUResourceManager;
-    class PipelineCache;
 
     /**
      * @brief Cascade info for CSM
@@ -37,6 +40,7 @@ namespace RVX
         float cascadeSplitLambda = 0.95f;    // PSSM split scheme parameter
         float shadowBias = 0.005f;           // Depth bias to reduce shadow acne
         float normalBias = 0.02f;            // Normal offset bias
+        float casterDistance = 200.0f;       // Extra depth toward the light for off-screen casters
     };
 
     /**
@@ -48,6 +52,8 @@ namespace RVX
      * - Runs before opaque pass (priority 200)
      * - Renders depth-only to shadow maps
      * - Supports CSM for directional lights
+     * - Added as a parallel RenderGraph pass: the cascade draws are resolved
+     *   on the render thread and can be recorded in chunks on several threads
      */
     class ShadowPass : public IRenderPass
     {
@@ -67,6 +73,7 @@ namespace RVX
 
         void Setup(RenderGraphBuilder& builder, const ViewData& view) override;
         void Execute(RHICommandContext& ctx, const ViewData& view) override;
+        void AddToGraph(RenderGraph& graph, const ViewData& view) override;
 
         // =========================================================================
         // Configuration
@@ -91,6 +98,14 @@ namespace RVX
          */
         const std::vector<ShadowCascade>& GetCascades() const { return m_cascades; }
 
+        /**
+         * @brief Get the shadow casters that survived culling for a cascade
+         */
+        const std::vector<uint32_t>& GetCascadeVisibleObjects(uint32_t cascadeIndex) const
+        {
+            return m_cascadeVisibleObjects[cascadeIndex];
+        }
+
         /**
          * @brief Get the shadow map texture (after execution)
          */
@@ -100,8 +115,25 @@ namespace RVX
         bool IsEnabled() const override { return m_enabled; }
 
     private:
+        /// Shadow caster draw with its bindings resolved, recordable from any thread
+        struct DrawPacket
+        {
+            RHIBuffer* positionBuffer = nullptr;
+            RHIBuffer* indexBuffer = nullptr;
+            std::array<uint32, 1> objectDynamicOffset = {};
+            uint32_t indexCount = 0;
+            uint32_t indexOffset = 0;
+            int32_t baseVertex = 0;
+        };
+
         void CreateShadowMap();
-        void RenderCascade(RHICommandContext& ctx, uint32_t cascadeIndex);
+        void CullCascades();
+
+        /// Resolve the draws of every cascade on the render thread, returns the draw packet count
+        uint32_t PrepareDraws();
+
+        /// Record a range of the prepared draw packets, one render pass per cascade touched
+        void RecordDraws(RHICommandContext& ctx, const RGRecordRange& range) const;
 
         bool m_enabled = false;  // Disabled by default until light is configured
         GPUResourceManager* m_gpuResources = nullptr;
@@ -114,11 +146,23 @@ namespace RVX
         float m_lightIntensity = 1.0f;
 
         std::vector<ShadowCascade> m_cascades;
+
+        // Per-cascade culling, all cascades are culled in one RenderScene pass
+        std::vector<Frustum> m_cascadeFrustums;
+        std::vector<std::vector<uint32_t>> m_cascadeVisibleObjects;
         
         // Shadow map resources
         RHITexture* m_shadowMapTexture = nullptr;
         RHITextureRef m_ownedShadowMap;
         std::vector<RHITextureViewRef> m_cascadeViews;
+
+        // Prepared for recording, read-only while chunks are recorded
+        RHIPipeline* m_pipeline = nullptr;
+        RHIDescriptorSet* m_frameSet = nullptr;
+        RHIDescriptorSet* m_objectSet = nullptr;
+        std::vector<DrawPacket> m_drawPackets;
+        std::vector<uint32_t> m_cascadeFirstPacket;  // Packet range of cascade i: [first[i], first[i + 1])
+        std::vector<ObjectConstants> m_instanceData;
     };
 
 } // namespace RVX
@@ -8,7 +8,7 @@
  * - Shader compilation with ShaderManager
  * - Stable frame/object/material descriptor set layouts
  * - Graphics pipeline creation and caching
- * - Frame and object constant buffer management
+ * - Frame constants and the frame-ring-buffered per-object instance data
  */
 
 #include "Core/Assert.h"
@@ -19,6 +19,7 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace RVX
@@ -41,22 +42,41 @@ namespace RVX
     };
 
     /**
-     * @brief Object constants structure (matches HLSL cbuffer)
+     * @brief Per-instance object data (matches one element of the HLSL ObjectWorld array)
      */
     struct ObjectConstants
     {
         Mat4 world;
     };
 
+    static_assert(sizeof(ObjectConstants) == 64, "ObjectConstants must match the HLSL float4x4 array stride");
+
     /**
      * @brief Pipeline cache for graphics pipelines
      *
      * The default material pipeline uses three descriptor sets:
      * set 0 = frame, set 1 = object, set 2 = material.
+     *
+     * Set 1 exposes a window of MaxObjectInstancesPerDraw ObjectConstants
+     * that the vertex shader indexes with SV_InstanceID. The window's start
+     * is the dynamic offset, so an instanced draw binds the offset of its
+     * first instance and reads the rest from the same window. The backing
+     * upload buffer holds one region per frame in flight and BeginFrame
+     * moves to the next, so this frame's writes never touch data the GPU
+     * may still be reading.
      */
     class PipelineCache
     {
     public:
+        /// Instances a single draw can address through the object window (64 KB)
+        static constexpr uint32 MaxObjectInstancesPerDraw = 1024;
+
+        /// Instance granularity that keeps window offsets on the 256-byte constant alignment
+        static constexpr uint32 ObjectInstanceAlignment = 256 / sizeof(ObjectConstants);
+
+        /// Returned by UploadObjectInstances when this frame's region has no room left
+        static constexpr uint64 InvalidObjectUpload = std::numeric_limits<uint64>::max();
+
         PipelineCache();
         ~PipelineCache();
 
@@ -129,7 +149,7 @@ namespace RVX
         // =====================================================================
 
         /**
-         * @brief Reset transient per-draw constant slots for a new frame
+         * @brief Advance to the next frame's object region and reset its slots
          */
         void BeginFrame();
 
@@ -173,10 +193,30 @@ namespace RVX
         void UpdateViewConstants(const ViewData& view);
 
         /**
-         * @brief Update per-object constants
+         * @brief Update per-object constants for a single, non-instanced draw
          * @param worldMatrix The object's world matrix
+         * @return False if this frame's region is full; skip the draw
          */
-        void UpdateObjectConstants(const Mat4& worldMatrix);
+        bool UpdateObjectConstants(const Mat4& worldMatrix);
+
+        /**
+         * @brief Copy a batch of per-instance data into this frame's region with one write
+         * @param instances Instance data; callers keep each draw's first instance
+         *                  a multiple of ObjectInstanceAlignment
+         * @return Byte offset of instances[0], to be passed to GetObjectInstanceDynamicOffset,
+         *         or InvalidObjectUpload if the region cannot hold them; skip their draws
+         */
+        uint64 UploadObjectInstances(std::span<const ObjectConstants> instances);
+
+        /**
+         * @brief Dynamic offset that points the object window at one uploaded instance
+         * @param uploadOffset Offset returned by UploadObjectInstances
+         * @param firstInstance Index of the draw's first instance within that upload
+         */
+        static std::array<uint32, 1> GetObjectInstanceDynamicOffset(uint64 uploadOffset, uint32 firstInstance)
+        {
+            return BuildSingleDynamicOffset(uploadOffset + static_cast<uint64>(firstInstance) * sizeof(ObjectConstants));
+        }
 
         // =====================================================================
         // Render Target Format
@@ -211,7 +251,7 @@ namespace RVX
         bool CreateObjectConstantBuffer();
         RHIDescriptorSetRef CreateFrameDescriptorSet();
         RHIDescriptorSetRef CreateObjectDescriptorSet();
-        uint64 AllocateObjectConstantSlot();
+        uint64 AllocateObjectInstances(uint64 count);
 
         IRHIDevice* m_device = nullptr;
         std::string m_shaderDir;
@@ -241,8 +281,9 @@ namespace RVX
         RHIBufferRef m_objectConstantBuffer;
         RHIDescriptorSetRef m_frameDescriptorSet;
         RHIDescriptorSetRef m_objectDescriptorSet;
-        uint64 m_objectConstantStride = 0;
-        uint64 m_objectConstantCursor = 0;
+        uint64 m_objectFrameRegionSize = 0;
+        uint32 m_objectFrameIndex = 0;
+        uint64 m_objectConstantCursor = 0;         ///< Bytes used in the current frame's region
         uint64 m_currentObjectConstantOffset = 0;
 
         // Render target format
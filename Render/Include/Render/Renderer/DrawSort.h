@@ -0,0 +1,54 @@
+#pragma once
+
+/**
+ * @file DrawSort.h
+ * @brief Radix sort for 64-bit draw sort keys
+ */
+
+#include "Core/Types.h"
+#include <vector>
+
+namespace RVX
+{
+    /**
+     * @brief Sort key paired with the index of the item it orders
+     */
+    struct DrawSortEntry
+    {
+        uint64 key = 0;
+        uint32 index = 0;
+    };
+
+    /**
+     * @brief Scratch memory reused across sorts
+     *
+     * Keep one per sorting call site so buffers only grow during warm-up
+     * and no allocation happens in steady-state frames.
+     */
+    struct DrawSortScratch
+    {
+        std::vector<DrawSortEntry> entries;
+        std::vector<DrawSortEntry> buffer;
+        std::vector<uint32> chunkCounts;
+    };
+
+    /**
+     * @brief Stable LSD radix sort of entries by key, ascending
+     *
+     * Sorts one byte per pass and skips bytes that are identical across all
+     * keys, so lists whose keys share high bits (same pass, few materials)
+     * take fewer passes. Large lists split each pass across the JobSystem.
+     */
+    void RadixSortDrawEntries(std::vector<DrawSortEntry>& entries, DrawSortScratch& scratch);
+
+    /// Hash an id so that nearby ids spread over the key bits
+    uint64 HashDrawSortBits(uint64 value);
+
+    /**
+     * @brief Map a distance to 31 bits whose integer order matches float order
+     *
+     * Negative and non-finite distances map to zero.
+     */
+    uint32 QuantizeDrawSortDepth(float depth);
+
+} // namespace RVX
@@ -7,6 +7,8 @@
 
 #include "Core/Types.h"
 #include "Render/Material/MaterialClassification.h"
+#include "Render/Renderer/DrawSort.h"
+#include <vector>
 
 namespace RVX
 {
@@ -27,7 +29,24 @@ namespace RVX
         uint64 sortKey = 0;
     };
 
-    uint64 BuildOpaqueDrawSortKey(const RenderDrawItem& item);
-    uint64 BuildTransparentDrawSortKey(const RenderDrawItem& item);
+    /**
+     * @brief Build the canonical 64-bit sort key for a draw item
+     *
+     * Layout, most significant bits first:
+     * - Opaque / masked: pass (2) | material (24) | mesh + submesh (16) | depth (22), front-to-back
+     * - Transparent:     pass (2) | inverted depth (30) | material (24) | mesh (8), back-to-front
+     *
+     * Material and mesh fields are hashes of the ids, so equal ids always share
+     * a field value and unrelated ids rarely do.
+     */
+    uint64 BuildDrawSortKey(const RenderDrawItem& item);
+
+    /**
+     * @brief Sort draw items by their sortKey using a radix sort
+     * @param itemScratch Reused storage for the reordered items
+     */
+    void SortDrawItems(std::vector<RenderDrawItem>& items,
+                       DrawSortScratch& scratch,
+                       std::vector<RenderDrawItem>& itemScratch);
 
 } // namespace RVX
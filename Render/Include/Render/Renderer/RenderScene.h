@@ -2,18 +2,23 @@
 
 /**
  * @file RenderScene.h
- * @brief Render scene - snapshot of scene data for rendering
+ * @brief Render scene - retained render-side copy of scene data
  */
 
 #include "Core/Types.h"
 #include "Core/MathTypes.h"
 #include "Core/Math/AABB.h"
+#include "Render/Renderer/DrawSort.h"
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 namespace RVX
 {
     class World;
     class Camera;
+    class Frustum;
+    class PrimitiveComponent;
     namespace Resource
     {
         class MaterialResource;
@@ -84,27 +89,50 @@ namespace RVX
     /**
      * @brief Render scene - contains all renderable objects for a frame
      * 
-     * RenderScene is a snapshot of the game world's renderable state.
-     * It is collected from the World/Scene each frame and passed to
-     * the SceneRenderer for rendering.
+     * RenderScene is the render-side view of the game world's renderable
+     * state. It is synchronized from the World/Scene each frame and passed
+     * to the SceneRenderer for rendering.
+     * 
+     * Primitive components are retained across frames: each one owns an
+     * object for as long as it is registered and renderable, and only
+     * primitives reported changed by the SceneManager are re-extracted.
+     * Objects are densely packed, so object indices are stable within a
+     * frame but may move when another primitive is removed.
+     * 
+     * Legacy MeshRendererComponent objects, lights and objects added with
+     * AddObject() are transient and rebuilt on every collect.
+     * 
+     * Retained objects are also kept in a two-level culling hierarchy
+     * (Morton-ordered packets of 4 objects, clusters of 64) that is refit
+     * when objects move and rebuilt when objects are added or removed.
+     * Culling tests 4 boxes per SIMD instruction, splits large scenes
+     * into partitions on the JobSystem and can cull several views (main
+     * camera, shadow cascades, cube faces) in one call.
      * 
      * This separation allows:
-     * - Thread-safe rendering (scene snapshot is immutable)
+     * - Thread-safe rendering (scene snapshot is immutable during a frame)
      * - Multiple views of the same scene
      * - Efficient culling and sorting
      */
     class RenderScene
     {
     public:
+        /// Which objects a cull considers
+        enum class CullFilter : uint8_t
+        {
+            Visible,        ///< Objects with visible set (camera views)
+            ShadowCasters   ///< Objects with castsShadow set (shadow views)
+        };
+
         RenderScene() = default;
 
         /**
-         * @brief Clear the scene for the next frame
+         * @brief Drop all objects, lights and retained primitive state
          */
         void Clear();
 
         /**
-         * @brief Collect renderable objects from a World
+         * @brief Synchronize renderable objects with a World
          * @param world The world to collect from
          */
         void CollectFromWorld(World* world);
@@ -116,6 +144,30 @@ namespace RVX
          */
         void CullAgainstCamera(const Camera& camera, std::vector<uint32_t>& outVisibleIndices) const;
 
+        /**
+         * @brief Cull objects against a single frustum
+         * @param frustum The view frustum
+         * @param outVisibleIndices Output: indices of objects that are not outside
+         * @param filter Which objects to consider
+         */
+        void CullFrustum(const Frustum& frustum,
+                         std::vector<uint32_t>& outVisibleIndices,
+                         CullFilter filter = CullFilter::Visible) const;
+
+        /**
+         * @brief Cull objects against several frustums in one pass
+         *
+         * Results match Frustum::IsVisible per object. Retained objects come
+         * first in hierarchy order, followed by transient objects.
+         *
+         * @param frustums One frustum per view
+         * @param outVisibleIndices One output list per view (same size as frustums)
+         * @param filter Which objects to consider
+         */
+        void CullFrustums(std::span<const Frustum> frustums,
+                          std::span<std::vector<uint32_t>> outVisibleIndices,
+                          CullFilter filter) const;
+
         /**
          * @brief Sort visible objects for optimal rendering
          * @param visibleIndices The indices to sort
@@ -130,7 +182,7 @@ namespace RVX
         const std::vector<RenderObject>& GetObjects() const { return m_objects; }
         const std::vector<RenderLight>& GetLights() const { return m_lights; }
 
-        void AddObject(const RenderObject& obj) { m_objects.push_back(obj); }
+        void AddObject(const RenderObject& obj);
         void AddLight(const RenderLight& light) { m_lights.push_back(light); }
 
         size_t GetObjectCount() const { return m_objects.size(); }
@@ -139,9 +191,104 @@ namespace RVX
         const RenderObject& GetObject(size_t index) const { return m_objects[index]; }
         const RenderLight& GetLight(size_t index) const { return m_lights[index]; }
 
+        /// Number of leading objects owned by retained primitives
+        size_t GetRetainedObjectCount() const { return m_retainedObjectCount; }
+
+        /// Primitives re-extracted by the last CollectFromWorld
+        size_t GetLastExtractedCount() const { return m_lastExtractedCount; }
+
     private:
+        friend class RenderSceneCollector;
+
+        static constexpr uint32_t InvalidObjectIndex = ~0u;
+
+        // Culling flags mirrored per object
+        static constexpr uint8_t CullFlagVisible = 1u << 0;
+        static constexpr uint8_t CullFlagCastsShadow = 1u << 1;
+
+        /// Four boxes in SoA layout, loaded directly into SIMD registers
+        struct alignas(16) CullBounds4
+        {
+            float minX[4], minY[4], minZ[4];
+            float maxX[4], maxY[4], maxZ[4];
+
+            void SetLane(int lane, const AABB& box);
+            void ClearLane(int lane);
+        };
+
+        /// Four retained objects; lanes with zero flags are empty or invalid
+        struct CullPacket
+        {
+            CullBounds4 bounds;
+            uint32_t objectIndex[4] = {};
+            uint8_t flags[4] = {};
+        };
+
+        /// Bounds of four clusters of CullClusterPackets packets each
+        struct CullClusterGroup
+        {
+            CullBounds4 bounds;
+            uint8_t flags[4] = {};    // union of the cluster's object flags
+        };
+
+        static constexpr uint32_t CullClusterPackets = 16;
+        static constexpr uint32_t CullGroupObjects = 4 * CullClusterPackets * 4;
+
+        /// Retained state for one primitive, indexed by its render id
+        struct PrimitiveRecord
+        {
+            uint32_t objectIndex = InvalidObjectIndex;
+            uint64_t ownerId = 0;
+            bool controlsOwner = false;   // owner's legacy MeshRenderer is suppressed
+            bool pending = false;         // registered but its mesh is not loaded yet
+        };
+
+        RenderObject& AcquireRetainedObject(uint32_t renderId);
+        void ReleaseRetainedObject(uint32_t renderId);
+        void RefreshCullData(uint32_t objectIndex);
+        void ResetRetained();
+        void ResetTransient();
+
+        // Culling hierarchy
+        void UpdateCullHierarchy();
+        void BuildCullHierarchy();
+        void WriteCullSlot(uint32_t slot, uint32_t objectIndex);
+        void RefitCullCluster(uint32_t cluster);
+        void CullRetainedGroups(std::span<const Frustum> frustums, uint32_t firstGroup, uint32_t endGroup,
+                                uint8_t requiredFlag, std::vector<uint32_t>* outLists, uint32_t* outCounts) const;
+
+        // Objects: [0, m_retainedObjectCount) retained, the rest transient.
+        // Bounds and culling flags are mirrored in SoA arrays for culling.
         std::vector<RenderObject> m_objects;
+        std::vector<AABB> m_objectBounds;
+        std::vector<uint8_t> m_objectFlags;
         std::vector<RenderLight> m_lights;
+
+        // Retained primitive state
+        size_t m_retainedObjectCount = 0;
+        std::vector<uint32_t> m_objectRenderIds;
+        std::vector<PrimitiveRecord> m_primitiveRecords;
+        std::vector<uint32_t> m_pendingRenderIds;
+        std::unordered_map<uint64_t, uint32_t> m_primitiveOwnerCounts;
+        uint64_t m_changeEpoch = 0;
+        size_t m_lastExtractedCount = 0;
+
+        // Change lists swapped with the SceneManager each collect
+        std::vector<uint32_t> m_removedRenderIds;
+        std::vector<PrimitiveComponent*> m_dirtyPrimitives;
+
+        // Culling hierarchy over retained objects
+        std::vector<CullPacket> m_cullPackets;
+        std::vector<CullClusterGroup> m_cullGroups;
+        std::vector<uint32_t> m_cullSlots;          // object index -> packet * 4 + lane
+        std::vector<uint32_t> m_cullRefitObjects;   // retained objects refreshed since the last update
+        std::vector<uint8_t> m_cullClusterDirty;
+        std::vector<uint64_t> m_cullSortKeys;
+        size_t m_cullRefitsSinceBuild = 0;
+        bool m_cullHierarchyDirty = false;
+
+        // Reused by SortVisibleObjects, which only the render thread calls
+        mutable DrawSortScratch m_visibleSortScratch;
     };
 
 } // namespace RVX
@@ -181,6 +181,21 @@ namespace RVX
         const std::vector<RenderDrawItem>& GetMaskedDrawItems() const { return m_maskedDrawItems; }
         const std::vector<RenderDrawItem>& GetTransparentDrawItems() const { return m_transparentDrawItems; }
 
+        // =====================================================================
+        // Statistics
+        // =====================================================================
+
+        struct FrameStats
+        {
+            uint32 visibleObjectCount = 0;
+            uint32 drawItemCount = 0;
+            float visibleSortTimeMs = 0.0f;   // RenderScene::SortVisibleObjects
+            float drawItemSortTimeMs = 0.0f;  // Opaque, masked and transparent draw lists
+        };
+
+        /// Get CPU timings of the last SetupView
+        const FrameStats& GetFrameStats() const { return m_frameStats; }
+
         /// Set shader directory (must be set before Initialize)
         void SetShaderDirectory(const std::string& dir) { m_shaderDir = dir; }
 
@@ -207,6 +222,9 @@ namespace RVX
         std::vector<RenderDrawItem> m_opaqueDrawItems;
         std::vector<RenderDrawItem> m_maskedDrawItems;
         std::vector<RenderDrawItem> m_transparentDrawItems;
+        DrawSortScratch m_drawSortScratch;
+        std::vector<RenderDrawItem> m_drawItemScratch;
+        FrameStats m_frameStats;
         
         std::string m_shaderDir;
         DepthPrepass* m_depthPrepass = nullptr;  // Cached pointer to optional depth prepass
@@ -169,11 +169,17 @@ void RenderContext::BeginFrame()
     }
 
     // Reset and begin the command context for this frame
+    m_currentGraphicsContext = nullptr;
+    m_extraContextsUsed = 0;
+    m_frameSubmitList.clear();
+
     RHICommandContext* ctx = GetGraphicsContext();
     if (ctx)
     {
         ctx->Reset();
         ctx->Begin();
+        m_currentGraphicsContext = ctx;
+        m_frameSubmitList.push_back(ctx);
     }
 
     m_frameActive = true;
@@ -187,19 +193,28 @@ void RenderContext::EndFrame()
         return;
     }
 
-    // End the command context
+    // End the command contexts, including those opened for parallel recording
     RHICommandContext* ctx = GetGraphicsContext();
-    if (ctx)
+    for (RHICommandContext* frameCtx : m_frameSubmitList)
     {
-        ctx->End();
+        frameCtx->End();
     }
 
     // Submit commands
     if (m_device && ctx)
     {
         RHIFence* fence = m_frameSynchronizer.GetFence(m_frameIndex);
-        m_device->SubmitCommandContext(ctx, fence);
+        if (m_frameSubmitList.size() > 1)
+        {
+            m_device->SubmitCommandContexts(m_frameSubmitList, fence);
+        }
+        else
+        {
+            m_device->SubmitCommandContext(ctx, fence);
+        }
     }
+    m_frameSubmitList.clear();
+    m_currentGraphicsContext = nullptr;
 
     // Signal frame completion
     m_frameSynchronizer.SignalFrame(m_frameIndex);
@@ -213,6 +228,63 @@ void RenderContext::EndFrame()
     m_frameActive = false;
 }
 
+std::span<RHICommandContext* const> RenderContext::BeginParallelRecording(uint32_t count)
+{
+    m_parallelContexts.clear();
+
+    RHICommandContext* current = GetGraphicsContext();
+    if (!m_frameActive || !current || count == 0)
+    {
+        RVX_CORE_WARN("RenderContext: BeginParallelRecording needs an active frame");
+        return {};
+    }
+
+    // The current context keeps what was recorded so far and takes the first slot
+    m_parallelContexts.push_back(current);
+    while (m_parallelContexts.size() < count)
+    {
+        RHICommandContext* ctx = AcquireFrameContext();
+        if (!ctx)
+            break;
+        m_parallelContexts.push_back(ctx);
+    }
+
+    // Later recording goes into a continuation context behind the parallel ones
+    RHICommandContext* continuation = AcquireFrameContext();
+    if (!continuation)
+    {
+        m_parallelContexts.resize(1);
+        return m_parallelContexts;
+    }
+    m_currentGraphicsContext = continuation;
+
+    return m_parallelContexts;
+}
+
+RHICommandContext* RenderContext::AcquireFrameContext()
+{
+    if (!m_device || m_frameIndex >= RVX_MAX_FRAME_COUNT)
+        return nullptr;
+
+    auto& pool = m_extraGraphicsContexts[m_frameIndex];
+    if (m_extraContextsUsed == pool.size())
+    {
+        RHICommandContextRef ctx = m_device->CreateCommandContext(RHICommandQueueType::Graphics);
+        if (!ctx)
+        {
+            RVX_CORE_ERROR("RenderContext: Failed to create parallel graphics context for frame {}", m_frameIndex);
+            return nullptr;
+        }
+        pool.push_back(std::move(ctx));
+    }
+
+    RHICommandContext* ctx = pool[m_extraContextsUsed++].Get();
+    ctx->Reset();
+    ctx->Begin();
+    m_frameSubmitList.push_back(ctx);
+    return ctx;
+}
+
 void RenderContext::Present()
 {
     if (m_swapChain)
@@ -237,6 +309,8 @@ void RenderContext::WaitIdle()
 
 RHICommandContext* RenderContext::GetGraphicsContext() const
 {
+    if (m_currentGraphicsContext)
+        return m_currentGraphicsContext;
     if (m_frameIndex >= RVX_MAX_FRAME_COUNT)
         return nullptr;
     return m_graphicsContexts[m_frameIndex].Get();
@@ -303,10 +377,15 @@ void RenderContext::DestroyCommandContexts()
     for (uint32_t i = 0; i < RVX_MAX_FRAME_COUNT; ++i)
     {
         m_graphicsContexts[i].Reset();
+        m_extraGraphicsContexts[i].clear();
         m_computeContexts[i].Reset();
         m_computeFences[i].Reset();
         m_computeFenceValues[i] = 0;
     }
+    m_extraContextsUsed = 0;
+    m_currentGraphicsContext = nullptr;
+    m_frameSubmitList.clear();
+    m_parallelContexts.clear();
 }
 
 } // namespace RVX
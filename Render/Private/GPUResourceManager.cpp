@@ -233,6 +233,24 @@ bool GPUResourceManager::TransitionTexture(Resource::ResourceId textureId, RHICo
     return true;
 }
 
+bool GPUResourceManager::TransitionTexture(Resource::ResourceId textureId, std::vector<RHITextureBarrier>& outBarriers,
+                                           RHIResourceState desiredState)
+{
+    auto it = m_textureGPUData.find(textureId);
+    if (it == m_textureGPUData.end() || !it->second.isResident || !it->second.texture)
+        return false;
+
+    TextureGPUData& data = it->second;
+    if (data.currentState != desiredState)
+    {
+        outBarriers.push_back({data.texture.Get(), data.currentState, desiredState, RHISubresourceRange::All()});
+        data.currentState = desiredState;
+    }
+
+    data.lastUsedFrame = m_currentFrame;
+    return true;
+}
+
 void GPUResourceManager::ProcessPendingUploads(float timeBudgetMs)
 {
     if (!m_device)
@@ -1,4 +1,5 @@
 #include "RenderGraphInternal.h"
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 
@@ -46,6 +47,11 @@ namespace RVX
 
     void RenderGraph::SetDevice(IRHIDevice* device)
     {
+        if (m_impl->device != device)
+        {
+            // The cached plan was compiled for the previous device
+            m_impl->compileCache.Invalidate();
+        }
         m_impl->device = device;
     }
 
@@ -183,6 +189,20 @@ namespace RVX
         m_impl->passes.push_back(std::move(pass));
     }
 
+    void RenderGraph::AddParallelPassInternal(
+        const char* name,
+        RenderGraphPassType type,
+        std::function<void(RenderGraphBuilder&)> setup,
+        std::function<uint32()> prepare,
+        std::function<void(RHICommandContext&, const RGRecordRange&)> record)
+    {
+        AddPassInternal(name, type, std::move(setup), nullptr);
+
+        Pass& pass = m_impl->passes.back();
+        pass.prepare = std::move(prepare);
+        pass.record = std::move(record);
+    }
+
     RGTextureHandle RenderGraphBuilder::Read(RGTextureHandle texture, RHIShaderStage stages)
     {
         if (!m_impl || !m_impl->pass || !texture.IsValid())
@@ -320,7 +340,7 @@ namespace RVX
 
     void RenderGraph::Compile()
     {
-        CompileRenderGraph(*m_impl);
+        CompileRenderGraphCached(*m_impl);
     }
 
     void RenderGraph::Execute(RHICommandContext& ctx)
@@ -328,6 +348,21 @@ namespace RVX
         ExecuteRenderGraph(*m_impl, ctx);
     }
 
+    void RenderGraph::ExecuteParallel(std::span<RHICommandContext* const> contexts)
+    {
+        ExecuteRenderGraphParallel(*m_impl, contexts);
+    }
+
+    void RenderGraph::SetParallelRecordingGranularity(uint32 minItemsPerChunk)
+    {
+        m_impl->parallelGranularity = std::max(minItemsPerChunk, 1u);
+    }
+
+    const RenderGraph::ExecuteStats& RenderGraph::GetExecuteStats() const
+    {
+        return m_impl->executeStats;
+    }
+
     void RenderGraph::ExecuteAsync(RHICommandContext& graphicsCtx,
                                    RHICommandContext* computeCtx,
                                    RHIFence* computeFence,
@@ -351,8 +386,28 @@ namespace RVX
         return m_impl->enableMemoryAliasing;
     }
 
+    void RenderGraph::SetCompileCacheEnabled(bool enabled)
+    {
+        m_impl->enableCompileCache = enabled;
+        if (!enabled)
+        {
+            m_impl->compileCache.Invalidate();
+        }
+    }
+
+    bool RenderGraph::IsCompileCacheEnabled() const
+    {
+        return m_impl->enableCompileCache;
+    }
+
+    void RenderGraph::InvalidateCompileCache()
+    {
+        m_impl->compileCache.Invalidate();
+    }
+
     void RenderGraph::Clear()
     {
+        // The compile cache is kept so the next frame can replay it
         m_impl->passes.clear();
         m_impl->textures.clear();
         m_impl->buffers.clear();
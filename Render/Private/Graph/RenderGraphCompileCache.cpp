@@ -0,0 +1,370 @@
+#include "RenderGraphInternal.h"
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+
+namespace RVX
+{
+    namespace
+    {
+        class SignatureHasher
+        {
+        public:
+            void Add(uint64 value)
+            {
+                // splitmix64 finalizer folded into the running hash
+                value += 0x9E3779B97F4A7C15ULL;
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+                value ^= value >> 31;
+                m_hash = (m_hash ^ value) * 0x100000001B3ULL;
+            }
+
+            template<typename Enum>
+            void AddEnum(Enum value)
+            {
+                Add(static_cast<uint64>(value));
+            }
+
+            void Add(std::string_view text)
+            {
+                Add(static_cast<uint64>(std::hash<std::string_view>{}(text)));
+            }
+
+            uint64 Get() const { return m_hash; }
+
+        private:
+            uint64 m_hash = 0xCBF29CE484222325ULL;
+        };
+
+        // Index of the first earlier import that shares this pointer, so that graphs
+        // importing one resource through several handles do not replay onto graphs
+        // that import distinct resources (barrier merging is keyed on pointers).
+        template<typename Resource, typename GetPointer>
+        uint64 FindDuplicateImport(const std::vector<Resource>& resources, size_t index, GetPointer getPointer)
+        {
+            const auto* pointer = getPointer(resources[index]);
+            for (size_t i = 0; i < index; ++i)
+            {
+                if (resources[i].imported && getPointer(resources[i]) == pointer)
+                    return i;
+            }
+            return UINT64_MAX;
+        }
+
+        // Index of the resource a barrier transitions. Duplicate imports share a pointer,
+        // so the first match resolves to the same object on replay.
+        template<typename Resource, typename GetPointer, typename Pointer>
+        uint32 FindBarrierResource(const std::vector<Resource>& resources, GetPointer getPointer, const Pointer* pointer)
+        {
+            for (size_t i = 0; i < resources.size(); ++i)
+            {
+                if (getPointer(resources[i]) == pointer)
+                    return static_cast<uint32>(i);
+            }
+            return RVX_INVALID_INDEX;
+        }
+
+        void StorePass(CompiledPass& dst, const Pass& src, const RenderGraphImpl& graph)
+        {
+            dst.readTextures = src.readTextures;
+            dst.writeTextures = src.writeTextures;
+            dst.readBuffers = src.readBuffers;
+            dst.writeBuffers = src.writeBuffers;
+            dst.culled = src.culled;
+            dst.textureBarriers = src.textureBarriers;
+            dst.bufferBarriers = src.bufferBarriers;
+            dst.aliasingBarriers = src.aliasingBarriers;
+
+            dst.textureBarrierResources.clear();
+            for (const auto& barrier : src.textureBarriers)
+            {
+                dst.textureBarrierResources.push_back(FindBarrierResource(graph.textures,
+                    [](const TextureResource& r) { return r.GetTexture(); }, barrier.texture));
+            }
+            dst.bufferBarrierResources.clear();
+            for (const auto& barrier : src.bufferBarriers)
+            {
+                dst.bufferBarrierResources.push_back(FindBarrierResource(graph.buffers,
+                    [](const BufferResource& r) { return r.GetBuffer(); }, barrier.buffer));
+            }
+        }
+
+        void ReplayPass(Pass& dst, const CompiledPass& src, const RenderGraphImpl& graph)
+        {
+            dst.readTextures = src.readTextures;
+            dst.writeTextures = src.writeTextures;
+            dst.readBuffers = src.readBuffers;
+            dst.writeBuffers = src.writeBuffers;
+            dst.culled = src.culled;
+            dst.textureBarriers = src.textureBarriers;
+            dst.bufferBarriers = src.bufferBarriers;
+            dst.aliasingBarriers = src.aliasingBarriers;
+
+            // Point the barriers at this frame's imported and transient resources
+            for (size_t i = 0; i < dst.textureBarriers.size(); ++i)
+            {
+                const uint32 index = src.textureBarrierResources[i];
+                dst.textureBarriers[i].texture = index < graph.textures.size() ? graph.textures[index].GetTexture() : nullptr;
+            }
+            for (size_t i = 0; i < dst.bufferBarriers.size(); ++i)
+            {
+                const uint32 index = src.bufferBarrierResources[i];
+                dst.bufferBarriers[i].buffer = index < graph.buffers.size() ? graph.buffers[index].GetBuffer() : nullptr;
+            }
+        }
+
+        void StoreCompiledRenderGraph(RenderGraphImpl& graph, uint64 signature, double compileTimeMs)
+        {
+            auto& cache = graph.compileCache;
+            cache.valid = true;
+            cache.signature = signature;
+            cache.textures = graph.textures;
+            cache.buffers = graph.buffers;
+            cache.transientHeaps = graph.transientHeaps;
+
+            // Keep the plan only. Replays create their own transient resources and heaps, so
+            // barriers recorded from Undefined stay correct and no frame reuses resources an
+            // earlier frame may still have in flight.
+            for (auto& resource : cache.textures)
+                resource.texture = nullptr;
+            for (auto& resource : cache.buffers)
+                resource.buffer = nullptr;
+            for (auto& heap : cache.transientHeaps)
+                heap.heap = nullptr;
+
+            cache.passes.resize(graph.passes.size());
+            for (size_t i = 0; i < graph.passes.size(); ++i)
+            {
+                StorePass(cache.passes[i], graph.passes[i], graph);
+            }
+            cache.executionOrder = graph.executionOrder;
+            cache.stats = graph.stats;
+            cache.totalMemoryWithoutAliasing = graph.totalMemoryWithoutAliasing;
+            cache.totalMemoryWithAliasing = graph.totalMemoryWithAliasing;
+            cache.aliasedTextureCount = graph.aliasedTextureCount;
+            cache.aliasedBufferCount = graph.aliasedBufferCount;
+            cache.fullCompileTimeMs = compileTimeMs;
+        }
+
+        bool ReplayCompiledRenderGraph(RenderGraphImpl& graph, uint64 signature)
+        {
+            const auto& cache = graph.compileCache;
+            if (!cache.valid || cache.signature != signature)
+                return false;
+
+            // The signature covers the counts, but a mismatch here would index out of range
+            if (cache.passes.size() != graph.passes.size() ||
+                cache.textures.size() != graph.textures.size() ||
+                cache.buffers.size() != graph.buffers.size())
+            {
+                return false;
+            }
+
+            // Imported resources may be different objects with the same description
+            // (e.g. the swap chain back buffer)
+            for (size_t i = 0; i < graph.textures.size(); ++i)
+            {
+                auto& resource = graph.textures[i];
+                RHITexture* importedRaw = resource.importedRaw;
+                RHITextureDesc desc = resource.desc;
+
+                resource = cache.textures[i];
+                resource.importedRaw = importedRaw;
+                resource.desc = desc;
+            }
+
+            for (size_t i = 0; i < graph.buffers.size(); ++i)
+            {
+                auto& resource = graph.buffers[i];
+                RHIBuffer* importedRaw = resource.importedRaw;
+                RHIBufferDesc desc = resource.desc;
+
+                resource = cache.buffers[i];
+                resource.importedRaw = importedRaw;
+                resource.desc = desc;
+            }
+
+            // Creation resets the tracked states; the executor needs the final ones for exports
+            graph.transientHeaps = cache.transientHeaps;
+            CreateTransientResources(graph);
+            for (size_t i = 0; i < graph.textures.size(); ++i)
+            {
+                graph.textures[i].currentState = cache.textures[i].currentState;
+            }
+            for (size_t i = 0; i < graph.buffers.size(); ++i)
+            {
+                graph.buffers[i].currentState = cache.buffers[i].currentState;
+            }
+
+            for (size_t i = 0; i < graph.passes.size(); ++i)
+            {
+                ReplayPass(graph.passes[i], cache.passes[i], graph);
+            }
+
+            graph.executionOrder = cache.executionOrder;
+            graph.stats = cache.stats;
+            graph.totalMemoryWithoutAliasing = cache.totalMemoryWithoutAliasing;
+            graph.totalMemoryWithAliasing = cache.totalMemoryWithAliasing;
+            graph.aliasedTextureCount = cache.aliasedTextureCount;
+            graph.aliasedBufferCount = cache.aliasedBufferCount;
+            return true;
+        }
+    }
+
+    void RenderGraphCompileCache::Invalidate()
+    {
+        valid = false;
+        signature = 0;
+        textures.clear();
+        buffers.clear();
+        passes.clear();
+        executionOrder.clear();
+        transientHeaps.clear();
+        stats = {};
+        totalMemoryWithoutAliasing = 0;
+        totalMemoryWithAliasing = 0;
+        aliasedTextureCount = 0;
+        aliasedBufferCount = 0;
+        fullCompileTimeMs = 0.0;
+    }
+
+    // =============================================================================
+    // Graph Signature
+    // Everything the compiler reads except imported resource pointers, which are
+    // rebound on replay.
+    // =============================================================================
+    uint64 ComputeRenderGraphSignature(const RenderGraphImpl& graph)
+    {
+        SignatureHasher hasher;
+        hasher.Add(static_cast<uint64>(reinterpret_cast<uintptr_t>(graph.device)));
+        hasher.Add(graph.enableMemoryAliasing ? 1u : 0u);
+
+        hasher.Add(static_cast<uint64>(graph.textures.size()));
+        for (size_t i = 0; i < graph.textures.size(); ++i)
+        {
+            const auto& resource = graph.textures[i];
+            hasher.Add(resource.imported ? 1u : 0u);
+            if (resource.imported)
+            {
+                hasher.Add(resource.importedRaw ? 1u : 0u);
+                hasher.Add(FindDuplicateImport(graph.textures, i,
+                    [](const TextureResource& r) { return r.importedRaw; }));
+            }
+            hasher.Add(resource.desc.width);
+            hasher.Add(resource.desc.height);
+            hasher.Add(resource.desc.depth);
+            hasher.Add(resource.desc.mipLevels);
+            hasher.Add(resource.desc.arraySize);
+            hasher.AddEnum(resource.desc.format);
+            hasher.AddEnum(resource.desc.usage);
+            hasher.AddEnum(resource.desc.dimension);
+            hasher.AddEnum(resource.desc.sampleCount);
+            hasher.AddEnum(resource.initialState);
+            hasher.Add(resource.exportState.has_value() ? 1u : 0u);
+            if (resource.exportState)
+                hasher.AddEnum(*resource.exportState);
+        }
+
+        hasher.Add(static_cast<uint64>(graph.buffers.size()));
+        for (size_t i = 0; i < graph.buffers.size(); ++i)
+        {
+            const auto& resource = graph.buffers[i];
+            hasher.Add(resource.imported ? 1u : 0u);
+            if (resource.imported)
+            {
+                hasher.Add(resource.importedRaw ? 1u : 0u);
+                hasher.Add(FindDuplicateImport(graph.buffers, i,
+                    [](const BufferResource& r) { return r.importedRaw; }));
+            }
+            hasher.Add(resource.desc.size);
+            hasher.AddEnum(resource.desc.usage);
+            hasher.AddEnum(resource.desc.memoryType);
+            hasher.Add(resource.desc.stride);
+            hasher.AddEnum(resource.initialState);
+            hasher.Add(resource.exportState.has_value() ? 1u : 0u);
+            if (resource.exportState)
+                hasher.AddEnum(*resource.exportState);
+        }
+
+        hasher.Add(static_cast<uint64>(graph.passes.size()));
+        for (const auto& pass : graph.passes)
+        {
+            hasher.Add(std::string_view(pass.name));
+            hasher.AddEnum(pass.type);
+            hasher.Add(static_cast<uint64>(pass.usages.size()));
+            for (const auto& usage : pass.usages)
+            {
+                hasher.AddEnum(usage.type);
+                hasher.Add(usage.index);
+                hasher.AddEnum(usage.desiredState);
+                hasher.AddEnum(usage.access);
+                hasher.AddEnum(usage.stages);
+                hasher.Add(usage.hasSubresourceRange ? 1u : 0u);
+                if (usage.hasSubresourceRange)
+                {
+                    hasher.Add(usage.subresourceRange.baseMipLevel);
+                    hasher.Add(usage.subresourceRange.mipLevelCount);
+                    hasher.Add(usage.subresourceRange.baseArrayLayer);
+                    hasher.Add(usage.subresourceRange.arrayLayerCount);
+                    hasher.AddEnum(usage.subresourceRange.aspect);
+                }
+                hasher.Add(usage.hasRange ? 1u : 0u);
+                if (usage.hasRange)
+                {
+                    hasher.Add(usage.offset);
+                    hasher.Add(usage.size);
+                }
+            }
+        }
+
+        return hasher.Get();
+    }
+
+    // =============================================================================
+    // Cached Compile
+    // =============================================================================
+    void CompileRenderGraphCached(RenderGraphImpl& graph)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        auto elapsedMs = [&start]()
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        };
+
+        auto& cache = graph.compileCache;
+        uint64 signature = ComputeRenderGraphSignature(graph);
+
+        if (graph.enableCompileCache && ReplayCompiledRenderGraph(graph, signature))
+        {
+            double replayTimeMs = elapsedMs();
+            cache.hits++;
+            cache.timeSavedMs += std::max(0.0, cache.fullCompileTimeMs - replayTimeMs);
+
+            graph.stats.compiledFromCache = true;
+            graph.stats.compileTimeMs = replayTimeMs;
+        }
+        else
+        {
+            cache.Invalidate();
+            CompileRenderGraph(graph);
+
+            double compileTimeMs = elapsedMs();
+            if (graph.enableCompileCache)
+            {
+                cache.misses++;
+                StoreCompiledRenderGraph(graph, signature, compileTimeMs);
+            }
+
+            graph.stats.compiledFromCache = false;
+            graph.stats.compileTimeMs = compileTimeMs;
+        }
+
+        graph.stats.graphSignature = signature;
+        graph.stats.compileCacheHits = cache.hits;
+        graph.stats.compileCacheMisses = cache.misses;
+        graph.stats.compileTimeSavedMs = cache.timeSavedMs;
+    }
+
+} // namespace RVX
@@ -1,137 +1,330 @@
 #include "RenderGraphInternal.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Log.h"
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 
 namespace RVX
 {
-    void ExecuteRenderGraph(RenderGraphImpl& graph, RHICommandContext& ctx)
+    namespace
     {
-        if (!graph.executionOrder.empty())
+        using Clock = std::chrono::steady_clock;
+
+        double ElapsedMs(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        // Passes in execution order, skipping culled ones
+        void CollectExecutedPasses(const RenderGraphImpl& graph, std::vector<uint32>& out)
         {
-            for (uint32 passIndex : graph.executionOrder)
+            out.clear();
+            if (!graph.executionOrder.empty())
             {
-                const auto& pass = graph.passes[passIndex];
-                if (pass.culled)
-                    continue;
-                ctx.BeginEvent(pass.name.c_str());
-
-                // Note: Aliasing barriers for placed resources
-                // Currently handled implicitly via Undefined -> desired state transitions
-                // When a placed resource is first used, its state is Undefined, which tells
-                // the GPU that previous contents are invalid (equivalent to aliasing barrier)
-                // Future: Could add explicit RHI AliasingBarrier support for more control
-                // if (!pass.aliasingBarriers.empty())
-                // {
-                //     ctx.AliasingBarriers(graph, pass.aliasingBarriers);
-                // }
-
-                if (!pass.bufferBarriers.empty() || !pass.textureBarriers.empty())
+                for (uint32 passIndex : graph.executionOrder)
                 {
-                    ctx.Barriers(pass.bufferBarriers, pass.textureBarriers);
+                    if (!graph.passes[passIndex].culled)
+                        out.push_back(passIndex);
                 }
-                if (pass.execute)
+            }
+            else
+            {
+                for (uint32 passIndex = 0; passIndex < graph.passes.size(); ++passIndex)
                 {
-                    pass.execute(ctx);
+                    if (!graph.passes[passIndex].culled)
+                        out.push_back(passIndex);
                 }
-                ctx.EndEvent();
             }
         }
-        else
+
+        void RecordPassBarriers(const Pass& pass, RHICommandContext& ctx)
+        {
+            // Note: Aliasing barriers for placed resources
+            // Currently handled implicitly via Undefined -> desired state transitions
+            // When a placed resource is first used, its state is Undefined, which tells
+            // the GPU that previous contents are invalid (equivalent to aliasing barrier)
+            // Future: Could add explicit RHI AliasingBarrier support for more control
+            // if (!pass.aliasingBarriers.empty())
+            // {
+            //     ctx.AliasingBarriers(graph, pass.aliasingBarriers);
+            // }
+
+            if (!pass.bufferBarriers.empty() || !pass.textureBarriers.empty())
+            {
+                ctx.Barriers(pass.bufferBarriers, pass.textureBarriers);
+            }
+        }
+
+        void RecordExportBarriers(RenderGraphImpl& graph, RHICommandContext& ctx)
         {
-            for (const auto& pass : graph.passes)
+            std::vector<RHIBufferBarrier> exportBufferBarriers;
+            std::vector<RHITextureBarrier> exportTextureBarriers;
+
+            for (auto& resource : graph.textures)
             {
-                if (pass.culled)
+                if (!resource.exportState || !resource.GetTexture())
                     continue;
-                ctx.BeginEvent(pass.name.c_str());
-                if (!pass.bufferBarriers.empty() || !pass.textureBarriers.empty())
+
+                RHIResourceState desired = *resource.exportState;
+                if (resource.hasSubresourceTracking)
                 {
-                    ctx.Barriers(pass.bufferBarriers, pass.textureBarriers);
+                    uint32 baseMip = 0;
+                    uint32 mipCount = resource.desc.mipLevels;
+                    uint32 baseLayer = 0;
+                    uint32 layerCount = resource.desc.arraySize;
+                    for (uint32 mip = baseMip; mip < baseMip + mipCount; ++mip)
+                    {
+                        for (uint32 layer = baseLayer; layer < baseLayer + layerCount; ++layer)
+                        {
+                            uint32 key = mip + layer * resource.desc.mipLevels;
+                            auto it = resource.subresourceStates.find(key);
+                            RHIResourceState current = (it != resource.subresourceStates.end()) ? it->second : resource.currentState;
+                            if (current != desired)
+                            {
+                                exportTextureBarriers.push_back(
+                                    {resource.GetTexture(),
+                                     current,
+                                     desired,
+                                     RHISubresourceRange{mip, 1, layer, 1, RHITextureAspect::Color}});
+                            }
+                        }
+                    }
+                    resource.subresourceStates.clear();
+                    resource.hasSubresourceTracking = false;
+                    resource.currentState = desired;
                 }
-                if (pass.execute)
+                else if (resource.currentState != desired)
                 {
-                    pass.execute(ctx);
+                    exportTextureBarriers.push_back(
+                        {resource.GetTexture(), resource.currentState, desired, RHISubresourceRange::All()});
+                    resource.currentState = desired;
                 }
-                ctx.EndEvent();
             }
-        }
-
-        std::vector<RHIBufferBarrier> exportBufferBarriers;
-        std::vector<RHITextureBarrier> exportTextureBarriers;
 
-        for (auto& resource : graph.textures)
-        {
-            if (!resource.exportState || !resource.GetTexture())
-                continue;
-
-            RHIResourceState desired = *resource.exportState;
-            if (resource.hasSubresourceTracking)
+            for (auto& resource : graph.buffers)
             {
-                uint32 baseMip = 0;
-                uint32 mipCount = resource.desc.mipLevels;
-                uint32 baseLayer = 0;
-                uint32 layerCount = resource.desc.arraySize;
-                for (uint32 mip = baseMip; mip < baseMip + mipCount; ++mip)
+                if (!resource.exportState || !resource.GetBuffer())
+                    continue;
+
+                RHIResourceState desired = *resource.exportState;
+                if (resource.hasRangeTracking)
                 {
-                    for (uint32 layer = baseLayer; layer < baseLayer + layerCount; ++layer)
+                    for (const auto& range : resource.rangeStates)
                     {
-                        uint32 key = mip + layer * resource.desc.mipLevels;
-                        auto it = resource.subresourceStates.find(key);
-                        RHIResourceState current = (it != resource.subresourceStates.end()) ? it->second : resource.currentState;
-                        if (current != desired)
+                        if (range.state != desired)
                         {
-                            exportTextureBarriers.push_back(
-                                {resource.GetTexture(),
-                                 current,
-                                 desired,
-                                 RHISubresourceRange{mip, 1, layer, 1, RHITextureAspect::Color}});
+                            exportBufferBarriers.push_back(
+                                {resource.GetBuffer(), range.state, desired, range.offset, range.size});
                         }
                     }
+                    resource.rangeStates.clear();
+                    resource.hasRangeTracking = false;
+                    resource.currentState = desired;
+                }
+                else if (resource.currentState != desired)
+                {
+                    exportBufferBarriers.push_back(
+                        {resource.GetBuffer(), resource.currentState, desired, 0, RVX_WHOLE_SIZE});
+                    resource.currentState = desired;
                 }
-                resource.subresourceStates.clear();
-                resource.hasSubresourceTracking = false;
-                resource.currentState = desired;
             }
-            else if (resource.currentState != desired)
+
+            if (!exportBufferBarriers.empty() || !exportTextureBarriers.empty())
+            {
+                ctx.Barriers(exportBufferBarriers, exportTextureBarriers);
+            }
+        }
+
+        // A pass, or one chunk of a split parallel pass, recorded into a single context
+        struct RecordUnit
+        {
+            uint32 passIndex = 0;
+            RGRecordRange range;
+            uint64 cost = 0;
+        };
+
+        void RecordUnitCommands(const RenderGraphImpl& graph, const RecordUnit& unit, RHICommandContext& ctx)
+        {
+            const Pass& pass = graph.passes[unit.passIndex];
+            ctx.BeginEvent(pass.name.c_str());
+            if (unit.range.IsFirst())
+            {
+                RecordPassBarriers(pass, ctx);
+            }
+            if (pass.IsParallel())
+            {
+                pass.record(ctx, unit.range);
+            }
+            else if (pass.execute)
+            {
+                pass.execute(ctx);
+            }
+            ctx.EndEvent();
+        }
+    } // namespace
+
+    void ExecuteRenderGraph(RenderGraphImpl& graph, RHICommandContext& ctx)
+    {
+        const auto recordStart = Clock::now();
+        std::vector<uint32> passes;
+        CollectExecutedPasses(graph, passes);
+
+        graph.executeStats = {};
+        graph.executeStats.contextCount = 1;
+
+        for (uint32 passIndex : passes)
+        {
+            RecordUnit unit;
+            unit.passIndex = passIndex;
+
+            const Pass& pass = graph.passes[passIndex];
+            if (pass.IsParallel())
             {
-                exportTextureBarriers.push_back(
-                    {resource.GetTexture(), resource.currentState, desired, RHISubresourceRange::All()});
-                resource.currentState = desired;
+                const auto prepareStart = Clock::now();
+                unit.range.end = pass.prepare ? pass.prepare() : 0;
+                graph.executeStats.prepareTimeMs += ElapsedMs(prepareStart);
             }
+
+            RecordUnitCommands(graph, unit, ctx);
+            ++graph.executeStats.recordUnitCount;
+        }
+
+        RecordExportBarriers(graph, ctx);
+        graph.executeStats.recordTimeMs = ElapsedMs(recordStart) - graph.executeStats.prepareTimeMs;
+    }
+
+    void ExecuteRenderGraphParallel(RenderGraphImpl& graph, std::span<RHICommandContext* const> contexts)
+    {
+        if (contexts.empty())
+            return;
+
+        if (contexts.size() == 1)
+        {
+            ExecuteRenderGraph(graph, *contexts[0]);
+            return;
         }
 
-        for (auto& resource : graph.buffers)
+        const uint32 contextCount = static_cast<uint32>(contexts.size());
+        const uint32 granularity = std::max(graph.parallelGranularity, 1u);
+
+        graph.executeStats = {};
+        graph.executeStats.contextCount = contextCount;
+
+        // Phase 1: prepare parallel passes in order on this thread and cut them into chunks.
+        // Passes added with AddPass() cost one chunk's worth of items.
+        const auto prepareStart = Clock::now();
+        std::vector<uint32> passes;
+        CollectExecutedPasses(graph, passes);
+
+        std::vector<RecordUnit> units;
+        units.reserve(passes.size());
+        uint64 totalCost = 0;
+        for (uint32 passIndex : passes)
         {
-            if (!resource.exportState || !resource.GetBuffer())
+            const Pass& pass = graph.passes[passIndex];
+            if (!pass.IsParallel())
+            {
+                RecordUnit& unit = units.emplace_back();
+                unit.passIndex = passIndex;
+                unit.cost = granularity;
+                totalCost += unit.cost;
                 continue;
+            }
 
-            RHIResourceState desired = *resource.exportState;
-            if (resource.hasRangeTracking)
+            const uint32 itemCount = pass.prepare ? pass.prepare() : 0;
+            const uint32 chunkCount = std::clamp(itemCount / granularity, 1u, contextCount);
+            if (chunkCount > 1)
             {
-                for (const auto& range : resource.rangeStates)
-                {
-                    if (range.state != desired)
-                    {
-                        exportBufferBarriers.push_back(
-                            {resource.GetBuffer(), range.state, desired, range.offset, range.size});
-                    }
-                }
-                resource.rangeStates.clear();
-                resource.hasRangeTracking = false;
-                resource.currentState = desired;
+                ++graph.executeStats.splitPassCount;
             }
-            else if (resource.currentState != desired)
+
+            for (uint32 chunk = 0; chunk < chunkCount; ++chunk)
             {
-                exportBufferBarriers.push_back(
-                    {resource.GetBuffer(), resource.currentState, desired, 0, RVX_WHOLE_SIZE});
-                resource.currentState = desired;
+                RecordUnit& unit = units.emplace_back();
+                unit.passIndex = passIndex;
+                unit.range.begin = static_cast<uint32>(static_cast<uint64>(itemCount) * chunk / chunkCount);
+                unit.range.end = static_cast<uint32>(static_cast<uint64>(itemCount) * (chunk + 1) / chunkCount);
+                unit.range.chunkIndex = chunk;
+                unit.range.chunkCount = chunkCount;
+                unit.cost = std::max<uint64>(unit.range.Count(), 1);
+                totalCost += unit.cost;
             }
         }
+        graph.executeStats.prepareTimeMs = ElapsedMs(prepareStart);
+        graph.executeStats.recordUnitCount = static_cast<uint32>(units.size());
 
-        if (!exportBufferBarriers.empty() || !exportTextureBarriers.empty())
+        // Assign units to contexts by where their cost starts. The segment index
+        // never decreases, so each context gets a contiguous run of units and
+        // submitting the contexts in order keeps the compiled barrier order.
+        std::vector<uint32> segmentBegin(contextCount + 1, static_cast<uint32>(units.size()));
+        std::vector<bool> segmentHasLegacyPass(contextCount, false);
+        uint64 costBefore = 0;
+        uint32 segment = 0;
+        segmentBegin[0] = 0;
+        for (uint32 unitIndex = 0; unitIndex < units.size(); ++unitIndex)
         {
-            ctx.Barriers(exportBufferBarriers, exportTextureBarriers);
+            const uint32 unitSegment = static_cast<uint32>(
+                std::min<uint64>(contextCount - 1, costBefore * contextCount / std::max<uint64>(totalCost, 1)));
+            while (segment < unitSegment)
+            {
+                segmentBegin[++segment] = unitIndex;
+            }
+            if (!graph.passes[units[unitIndex].passIndex].IsParallel())
+            {
+                segmentHasLegacyPass[segment] = true;
+            }
+            costBefore += units[unitIndex].cost;
         }
+        while (segment < contextCount)
+        {
+            segmentBegin[++segment] = static_cast<uint32>(units.size());
+        }
+
+        const auto recordSegment = [&](uint32 segmentIndex)
+        {
+            RHICommandContext& ctx = *contexts[segmentIndex];
+            for (uint32 unitIndex = segmentBegin[segmentIndex]; unitIndex < segmentBegin[segmentIndex + 1]; ++unitIndex)
+            {
+                RecordUnitCommands(graph, units[unitIndex], ctx);
+            }
+        };
+
+        // Phase 2: record. Worker segments only run record callbacks on prepared data;
+        // segments with execute callbacks stay on this thread, in order.
+        const auto recordStart = Clock::now();
+        JobSystem& jobs = JobSystem::Get();
+        const bool useWorkers = jobs.GetWorkerCount() > 0;
+        std::atomic<uint32> pendingSegments{0};
+
+        for (uint32 segmentIndex = 0; segmentIndex < contextCount; ++segmentIndex)
+        {
+            const bool empty = segmentBegin[segmentIndex] == segmentBegin[segmentIndex + 1];
+            if (!useWorkers || empty || segmentHasLegacyPass[segmentIndex])
+                continue;
+
+            pendingSegments.fetch_add(1, std::memory_order_relaxed);
+            ++graph.executeStats.workerSegmentCount;
+            jobs.SubmitDetached([&recordSegment, &pendingSegments, segmentIndex]()
+            {
+                recordSegment(segmentIndex);
+                pendingSegments.fetch_sub(1, std::memory_order_acq_rel);
+            }, JobPriority::High);
+        }
+
+        for (uint32 segmentIndex = 0; segmentIndex < contextCount; ++segmentIndex)
+        {
+            if (!useWorkers || segmentHasLegacyPass[segmentIndex])
+            {
+                recordSegment(segmentIndex);
+            }
+        }
+
+        jobs.WaitUntil([&pendingSegments]() { return pendingSegments.load(std::memory_order_acquire) == 0; });
+
+        RecordExportBarriers(graph, *contexts.back());
+        graph.executeStats.recordTimeMs = ElapsedMs(recordStart);
     }
 
     void ExecuteRenderGraphAsync(RenderGraphImpl& graph,
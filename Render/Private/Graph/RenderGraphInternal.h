@@ -140,6 +140,57 @@ namespace RVX
         std::vector<RHIBufferBarrier> bufferBarriers;
         std::vector<AliasingBarrier> aliasingBarriers;  // For memory aliasing
         std::function<void(RHICommandContext&)> execute;
+
+        // Parallel passes (AddParallelPass) set these instead of execute
+        std::function<uint32()> prepare;
+        std::function<void(RHICommandContext&, const RGRecordRange&)> record;
+
+        bool IsParallel() const { return static_cast<bool>(record); }
+    };
+
+    // =============================================================================
+    // Compile Cache - compiled result of the last full compile
+    // =============================================================================
+    struct CompiledPass
+    {
+        std::vector<uint32> readTextures;
+        std::vector<uint32> writeTextures;
+        std::vector<uint32> readBuffers;
+        std::vector<uint32> writeBuffers;
+        bool culled = false;
+        std::vector<RHITextureBarrier> textureBarriers;
+        std::vector<RHIBufferBarrier> bufferBarriers;
+        std::vector<AliasingBarrier> aliasingBarriers;
+        std::vector<uint32> textureBarrierResources;    // Resource index of each barrier
+        std::vector<uint32> bufferBarrierResources;
+    };
+
+    struct RenderGraphCompileCache
+    {
+        bool valid = false;
+        uint64 signature = 0;
+
+        // Resources as they were after the full compile: tracked states, lifetimes
+        // and aliases, without the RHI objects. Transient resources and heaps are
+        // created again on replay and barriers are rebound by resource index.
+        std::vector<TextureResource> textures;
+        std::vector<BufferResource> buffers;
+        std::vector<CompiledPass> passes;
+        std::vector<uint32> executionOrder;
+        std::vector<TransientHeap> transientHeaps;
+        RenderGraph::CompileStats stats;
+        uint64 totalMemoryWithoutAliasing = 0;
+        uint64 totalMemoryWithAliasing = 0;
+        uint32 aliasedTextureCount = 0;
+        uint32 aliasedBufferCount = 0;
+        double fullCompileTimeMs = 0.0;
+
+        // Lifetime statistics, kept across invalidation
+        uint32 hits = 0;
+        uint32 misses = 0;
+        double timeSavedMs = 0.0;
+
+        void Invalidate();
     };
 
     struct RenderGraphImpl
@@ -160,10 +211,21 @@ namespace RVX
         uint64 totalMemoryWithAliasing = 0;
         uint32 aliasedTextureCount = 0;
         uint32 aliasedBufferCount = 0;
+
+        // Compile cache
+        RenderGraphCompileCache compileCache;
+        bool enableCompileCache = true;
+
+        // Multi-context recording
+        uint32 parallelGranularity = 64;
+        RenderGraph::ExecuteStats executeStats;
     };
 
     void CompileRenderGraph(RenderGraphImpl& graph);
+    void CompileRenderGraphCached(RenderGraphImpl& graph);
+    uint64 ComputeRenderGraphSignature(const RenderGraphImpl& graph);
     void ExecuteRenderGraph(RenderGraphImpl& graph, RHICommandContext& ctx);
+    void ExecuteRenderGraphParallel(RenderGraphImpl& graph, std::span<RHICommandContext* const> contexts);
     void ExecuteRenderGraphAsync(RenderGraphImpl& graph,
                                   RHICommandContext& graphicsCtx,
                                   RHICommandContext* computeCtx,
@@ -173,5 +235,6 @@ namespace RVX
     // Memory aliasing functions
     void CalculateResourceLifetimes(RenderGraphImpl& graph);
     void ComputeMemoryAliases(RenderGraphImpl& graph);
+    void CreateTransientResources(RenderGraphImpl& graph);
     
 } // namespace RVX
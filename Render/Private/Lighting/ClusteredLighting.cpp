@@ -5,8 +5,10 @@
 
 #include "Render/Lighting/ClusteredLighting.h"
 #include "Render/Lighting/LightManager.h"
+#include "Core/Job/JobSystem.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace RVX
 {
@@ -26,6 +28,12 @@ void ClusteredLighting::Initialize(IRHIDevice* device, const ClusteringConfig& c
     m_clusterAABBs.resize(totalClusters);
     m_clusters.resize(totalClusters);
     m_lightIndices.reserve(totalClusters * m_config.maxLightsPerCluster);
+    m_clusterLights.resize(static_cast<size_t>(totalClusters) * m_config.maxLightsPerCluster);
+    m_sliceDepthBounds.resize(m_config.clusterCountZ);
+    m_columnBounds.resize(m_config.clusterCountZ * m_config.clusterCountX);
+    m_rowBounds.resize(m_config.clusterCountZ * m_config.clusterCountY);
+    m_sliceTests.resize(m_config.clusterCountZ);
+    m_clusterAABBsValid = false;
 
     // Create GPU buffers
     if (m_device)
@@ -60,8 +68,9 @@ void ClusteredLighting::Shutdown()
 
 void ClusteredLighting::Reconfigure(const ClusteringConfig& config)
 {
+    IRHIDevice* device = m_device;
     Shutdown();
-    Initialize(m_device, config);
+    Initialize(device, config);
 }
 
 void ClusteredLighting::BeginFrame(const Mat4& viewMatrix, const Mat4& projMatrix,
@@ -69,12 +78,17 @@ void ClusteredLighting::BeginFrame(const Mat4& viewMatrix, const Mat4& projMatri
 {
     m_viewMatrix = viewMatrix;
     m_projMatrix = projMatrix;
-    m_invProjMatrix = inverse(projMatrix);
     m_screenWidth = screenWidth;
     m_screenHeight = screenHeight;
 
-    // Rebuild cluster AABBs if view parameters changed significantly
-    BuildClusterAABBs();
+    // Cluster AABBs are in view space: only the projection moves them
+    if (!m_clusterAABBsValid || projMatrix != m_clusterProjMatrix)
+    {
+        m_invProjMatrix = inverse(projMatrix);
+        BuildClusterAABBs();
+        m_clusterProjMatrix = projMatrix;
+        m_clusterAABBsValid = true;
+    }
     ClearClusters();
 }
 
@@ -88,6 +102,11 @@ void ClusteredLighting::BuildClusterAABBs()
     float logFar = std::log(farZ);
     float logRange = logFar - logNear;
 
+    const Vec2 emptyBounds(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest());
+    std::fill(m_sliceDepthBounds.begin(), m_sliceDepthBounds.end(), emptyBounds);
+    std::fill(m_columnBounds.begin(), m_columnBounds.end(), emptyBounds);
+    std::fill(m_rowBounds.begin(), m_rowBounds.end(), emptyBounds);
+
     for (uint32 z = 0; z < m_config.clusterCountZ; ++z)
     {
         for (uint32 y = 0; y < m_config.clusterCountY; ++y)
@@ -119,28 +138,36 @@ void ClusteredLighting::BuildClusterAABBs()
                 Vec3 minPoint(std::numeric_limits<float>::max());
                 Vec3 maxPoint(std::numeric_limits<float>::lowest());
 
-                // Unproject 8 corners
-                float corners[8][4] = {
-                    {minX, minY, 0, 1}, {maxX, minY, 0, 1},
-                    {minX, maxY, 0, 1}, {maxX, maxY, 0, 1},
-                    {minX, minY, 1, 1}, {maxX, minY, 1, 1},
-                    {minX, maxY, 1, 1}, {maxX, maxY, 1, 1}
+                // Unproject the 4 screen corners to view rays and cut each
+                // ray at the slice's near and far view depth
+                float corners[4][2] = {
+                    {minX, minY}, {maxX, minY},
+                    {minX, maxY}, {maxX, maxY}
                 };
 
-                for (int i = 0; i < 8; ++i)
+                for (int i = 0; i < 4; ++i)
                 {
-                    float depth = (i < 4) ? minZ : maxZ;
-                    Vec4 clip(corners[i][0], corners[i][1], 
-                             (depth - nearZ) / (farZ - nearZ), 1.0f);
-                    Vec4 view = m_invProjMatrix * clip;
-                    view /= view.w;
-
-                    minPoint = min(minPoint, Vec3(view));
-                    maxPoint = max(maxPoint, Vec3(view));
+                    Vec4 view = m_invProjMatrix * Vec4(corners[i][0], corners[i][1], 0.5f, 1.0f);
+                    Vec3 ray = Vec3(view) / view.w;
+                    ray /= std::abs(ray.z);
+
+                    for (float depth : {minZ, maxZ})
+                    {
+                        minPoint = min(minPoint, ray * depth);
+                        maxPoint = max(maxPoint, ray * depth);
+                    }
                 }
 
                 m_clusterAABBs[index].minPoint = Vec4(minPoint, 0);
                 m_clusterAABBs[index].maxPoint = Vec4(maxPoint, 0);
+
+                // Grow the slice, column and row extents used for binning
+                Vec2& depth = m_sliceDepthBounds[z];
+                Vec2& column = m_columnBounds[z * m_config.clusterCountX + x];
+                Vec2& row = m_rowBounds[z * m_config.clusterCountY + y];
+                depth = Vec2(std::min(depth.x, minPoint.z), std::max(depth.y, maxPoint.z));
+                column = Vec2(std::min(column.x, minPoint.x), std::max(column.y, maxPoint.x));
+                row = Vec2(std::min(row.x, minPoint.y), std::max(row.y, maxPoint.y));
             }
         }
     }
@@ -159,72 +186,110 @@ void ClusteredLighting::ClearClusters()
     m_stats = {};
 }
 
+namespace
+{
+    /// First and last of count ranges overlapping [minValue, maxValue]
+    bool FindOverlap(const Vec2* ranges, uint32 count, float minValue, float maxValue,
+                     uint32& outFirst, uint32& outLast)
+    {
+        bool found = false;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            if (ranges[i].x <= maxValue && ranges[i].y >= minValue)
+            {
+                if (!found)
+                {
+                    outFirst = i;
+                    found = true;
+                }
+                outLast = i;
+            }
+        }
+        return found;
+    }
+} // namespace
+
 void ClusteredLighting::AssignLights(const LightManager& lightManager)
 {
     const auto& pointLights = lightManager.GetPointLights();
     const auto& spotLights = lightManager.GetSpotLights();
 
-    // Transform lights to view space
-    std::vector<Vec3> pointLightPositionsView;
-    pointLightPositionsView.reserve(pointLights.size());
-    
-    for (const auto& light : pointLights)
+    // Transform lights to view space once and find the depth slices they cover.
+    // Point lights go first so each cluster lists its point lights before its spots.
+    m_lightBounds.clear();
+    m_lightBounds.reserve(pointLights.size() + spotLights.size());
+
+    for (uint32 li = 0; li < pointLights.size(); ++li)
     {
-        Vec4 viewPos = m_viewMatrix * Vec4(light.position, 1.0f);
-        pointLightPositionsView.push_back(Vec3(viewPos));
+        LightBounds bounds;
+        bounds.position = Vec3(m_viewMatrix * Vec4(pointLights[li].position, 1.0f));
+        bounds.range = pointLights[li].range;
+        bounds.center = bounds.position;
+        bounds.radius = bounds.range;
+        bounds.lightIndex = static_cast<uint16>(li);
+        bounds.lightType = 0;  // Point light
+        AddLightBounds(bounds);
     }
 
-    // Assign lights to clusters
-    for (uint32 i = 0; i < m_clusters.size(); ++i)
+    for (uint32 li = 0; li < spotLights.size(); ++li)
     {
-        m_clusters[i].offset = static_cast<uint32>(m_lightIndices.size());
-        m_clusters[i].count = 0;
-
-        const auto& aabb = m_clusterAABBs[i];
-
-        // Test point lights
-        for (uint32 li = 0; li < pointLights.size(); ++li)
+        const GPUSpotLight& light = spotLights[li];
+
+        LightBounds bounds;
+        bounds.position = Vec3(m_viewMatrix * Vec4(light.position, 1.0f));
+        bounds.range = light.range;
+        bounds.direction = normalize(Vec3(m_viewMatrix * Vec4(light.direction, 0.0f)));
+        bounds.cosAngle = std::clamp(light.outerConeAngle, -1.0f, 1.0f);
+        bounds.sinAngle = std::sqrt(1.0f - bounds.cosAngle * bounds.cosAngle);
+        bounds.lightIndex = static_cast<uint16>(li);
+        bounds.lightType = 1;  // Spot light
+
+        // Smallest sphere around the cone
+        if (bounds.cosAngle >= 0.70710678f)
         {
-            if (IntersectsCluster(aabb, pointLightPositionsView[li], pointLights[li].range))
-            {
-                if (m_clusters[i].count < m_config.maxLightsPerCluster)
-                {
-                    LightIndex idx;
-                    idx.lightIndex = static_cast<uint16>(li);
-                    idx.lightType = 0;  // Point light
-                    m_lightIndices.push_back(idx);
-                    m_clusters[i].count++;
-                    m_clusters[i].pointCount++;
-                }
-            }
+            bounds.radius = bounds.range / (2.0f * bounds.cosAngle);
+            bounds.center = bounds.position + bounds.direction * bounds.radius;
         }
-
-        // Test spot lights (similar process)
-        for (uint32 li = 0; li < spotLights.size(); ++li)
+        else if (bounds.cosAngle > 0.0f)
         {
-            Vec4 viewPos = m_viewMatrix * Vec4(spotLights[li].position, 1.0f);
-            if (IntersectsCluster(aabb, Vec3(viewPos), spotLights[li].range))
-            {
-                if (m_clusters[i].count < m_config.maxLightsPerCluster)
-                {
-                    LightIndex idx;
-                    idx.lightIndex = static_cast<uint16>(li);
-                    idx.lightType = 1;  // Spot light
-                    m_lightIndices.push_back(idx);
-                    m_clusters[i].count++;
-                    m_clusters[i].spotCount++;
-                }
-            }
+            bounds.radius = bounds.range * bounds.sinAngle;
+            bounds.center = bounds.position + bounds.direction * (bounds.range * bounds.cosAngle);
+        }
+        else
+        {
+            bounds.radius = bounds.range;
+            bounds.center = bounds.position;
         }
+        AddLightBounds(bounds);
+    }
+
+    // Slices own disjoint clusters and scratch lists, so they run in parallel
+    JobSystem::Get().ParallelFor(0, m_config.clusterCountZ, [this](size_t z) {
+        AssignSlice(static_cast<uint32>(z));
+    }, 1);
+
+    // Pack the per-cluster lists into one index list
+    m_lightIndices.clear();
+    m_stats = {};
+    for (uint32 i = 0; i < m_clusters.size(); ++i)
+    {
+        GPUCluster& cluster = m_clusters[i];
+        const LightIndex* lights = m_clusterLights.data() + static_cast<size_t>(i) * m_config.maxLightsPerCluster;
+        cluster.offset = static_cast<uint32>(m_lightIndices.size());
+        m_lightIndices.insert(m_lightIndices.end(), lights, lights + cluster.count);
 
         // Update stats
-        if (m_clusters[i].count > 0)
+        if (cluster.count > 0)
         {
             m_stats.activeClusters++;
-            m_stats.totalLightAssignments += m_clusters[i].count;
-            m_stats.maxLightsInCluster = std::max(m_stats.maxLightsInCluster, m_clusters[i].count);
+            m_stats.totalLightAssignments += cluster.count;
+            m_stats.maxLightsInCluster = std::max(m_stats.maxLightsInCluster, cluster.count);
         }
     }
+    for (uint32 tests : m_sliceTests)
+    {
+        m_stats.clusterTests += tests;
+    }
 
     if (m_stats.activeClusters > 0)
     {
@@ -233,6 +298,75 @@ void ClusteredLighting::AssignLights(const LightManager& lightManager)
     }
 }
 
+void ClusteredLighting::AddLightBounds(LightBounds bounds)
+{
+    // Lights entirely before the first or beyond the last slice touch nothing
+    if (FindOverlap(m_sliceDepthBounds.data(), m_config.clusterCountZ,
+                    bounds.center.z - bounds.radius, bounds.center.z + bounds.radius,
+                    bounds.firstSlice, bounds.lastSlice))
+    {
+        m_lightBounds.push_back(bounds);
+    }
+}
+
+void ClusteredLighting::AssignSlice(uint32 z)
+{
+    const uint32 countX = m_config.clusterCountX;
+    const uint32 countY = m_config.clusterCountY;
+    const uint32 maxLights = m_config.maxLightsPerCluster;
+    const uint32 sliceBase = z * countX * countY;
+
+    for (uint32 i = sliceBase; i < sliceBase + countX * countY; ++i)
+    {
+        m_clusters[i] = GPUCluster{};
+    }
+
+    uint32 tests = 0;
+    for (const LightBounds& light : m_lightBounds)
+    {
+        if (z < light.firstSlice || z > light.lastSlice)
+            continue;
+
+        // Cluster rectangle covered by the light's bounding sphere in this slice
+        uint32 firstX = 0, lastX = 0, firstY = 0, lastY = 0;
+        if (!FindOverlap(&m_columnBounds[z * countX], countX,
+                         light.center.x - light.radius, light.center.x + light.radius, firstX, lastX) ||
+            !FindOverlap(&m_rowBounds[z * countY], countY,
+                         light.center.y - light.radius, light.center.y + light.radius, firstY, lastY))
+        {
+            continue;
+        }
+
+        for (uint32 y = firstY; y <= lastY; ++y)
+        {
+            for (uint32 x = firstX; x <= lastX; ++x)
+            {
+                const uint32 index = sliceBase + y * countX + x;
+                GPUCluster& cluster = m_clusters[index];
+                if (cluster.count >= maxLights)
+                    continue;
+
+                tests++;
+                const bool hit = light.lightType == 0
+                    ? IntersectsCluster(m_clusterAABBs[index], light.position, light.range)
+                    : IntersectsCone(m_clusterAABBs[index], light);
+                if (!hit)
+                    continue;
+
+                LightIndex& entry = m_clusterLights[static_cast<size_t>(index) * maxLights + cluster.count];
+                entry.lightIndex = light.lightIndex;
+                entry.lightType = light.lightType;
+                cluster.count++;
+                if (light.lightType == 0)
+                    cluster.pointCount++;
+                else
+                    cluster.spotCount++;
+            }
+        }
+    }
+    m_sliceTests[z] = tests;
+}
+
 bool ClusteredLighting::IntersectsCluster(const ClusterAABB& cluster, 
                                            const Vec3& lightPos, float range)
 {
@@ -247,6 +381,34 @@ bool ClusteredLighting::IntersectsCluster(const ClusterAABB& cluster,
     return distSq <= (range * range);
 }
 
+bool ClusteredLighting::IntersectsCone(const ClusterAABB& cluster, const LightBounds& light)
+{
+    // Within range of the apex at all
+    if (!IntersectsCluster(cluster, light.position, light.range))
+        return false;
+
+    // Cones wider than a hemisphere: the range test is all we do
+    if (light.cosAngle <= 0.0f)
+        return true;
+
+    // Cone against the AABB's bounding sphere
+    Vec3 minP(cluster.minPoint);
+    Vec3 maxP(cluster.maxPoint);
+    Vec3 center = (minP + maxP) * 0.5f;
+    float sphereRadius = length(maxP - center);
+
+    Vec3 v = center - light.position;
+    float vLenSq = dot(v, v);
+    float vAxis = dot(v, light.direction);
+    float distanceToCone = light.cosAngle * std::sqrt(std::max(vLenSq - vAxis * vAxis, 0.0f))
+                         - vAxis * light.sinAngle;
+
+    bool outsideAngle = distanceToCone > sphereRadius;
+    bool beyondRange = vAxis > sphereRadius + light.range;
+    bool behindApex = vAxis < -sphereRadius;
+    return !(outsideAngle || beyondRange || behindApex);
+}
+
 void ClusteredLighting::UpdateGPUBuffers(RHICommandContext& /*ctx*/)
 {
     // Update cluster buffer
@@ -91,6 +91,7 @@ void MaterialSystem::Shutdown()
         return;
 
     m_materialDescriptorCache.clear();
+    m_frameMaterialConstantOffsets.clear();
     m_defaultMaterialSet.Reset();
     m_defaultSampler.Reset();
     m_defaultWhiteTextureView.Reset();
@@ -112,6 +113,7 @@ void MaterialSystem::BeginFrame()
 {
     m_materialConstantCursor = 0;
     m_currentMaterialConstantOffset = 0;
+    m_frameMaterialConstantOffsets.clear();
 }
 
 void MaterialSystem::UpdateMaterialConstants(const Resource::MaterialResource* materialResource,
@@ -120,10 +122,18 @@ void MaterialSystem::UpdateMaterialConstants(const Resource::MaterialResource* m
     if (!m_materialConstantBuffer)
         return;
 
+    auto it = m_frameMaterialConstantOffsets.find(materialResource);
+    if (it != m_frameMaterialConstantOffsets.end())
+    {
+        m_currentMaterialConstantOffset = it->second;
+        return;
+    }
+
     const ResolvedMaterialTextures textures = ResolveMaterialTextures(materialResource, viewCache);
     const MaterialGPUConstants constants = BuildConstants(materialResource, textures);
 
     const uint64 offset = AllocateMaterialConstantSlot();
+    m_frameMaterialConstantOffsets.emplace(materialResource, offset);
     void* mapped = m_materialConstantBuffer->Map();
     if (mapped)
     {
@@ -96,8 +96,11 @@ void DepthPrepass::Execute(RHICommandContext& ctx, const ViewData& view)
                 return;  // Mesh not uploaded yet
             }
 
-            // Update per-object constants (world matrix)
-            m_pipelineCache->UpdateObjectConstants(obj.worldMatrix);
+            // Update per-object constants (world matrix); skipped once this frame's are used up
+            if (!m_pipelineCache->UpdateObjectConstants(obj.worldMatrix))
+            {
+                return;
+            }
 
             RHIDescriptorSet* frameSet = m_pipelineCache->GetFrameDescriptorSet();
             if (frameSet)
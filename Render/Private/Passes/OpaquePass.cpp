@@ -28,16 +28,17 @@ namespace
     }
 
     void TransitionVisibleMaterialTextures(const std::vector<RenderDrawItem>& drawItems,
-                                           GPUResourceManager& gpuResources, RHICommandContext& ctx)
+                                           GPUResourceManager& gpuResources,
+                                           std::vector<RHITextureBarrier>& barriers)
     {
-        const auto transitionTexture = [&gpuResources, &ctx](
+        const auto transitionTexture = [&gpuResources, &barriers](
                                            Resource::ResourceHandle<Resource::TextureResource> textureHandle)
         {
             Resource::TextureResource* textureResource = textureHandle.Get();
             if (!textureResource || !gpuResources.IsGPUReady(textureResource->GetId()))
                 return;
 
-            gpuResources.TransitionTexture(textureResource->GetId(), ctx, RHIResourceState::ShaderResource);
+            gpuResources.TransitionTexture(textureResource->GetId(), barriers, RHIResourceState::ShaderResource);
         };
 
         for (const RenderDrawItem& item : drawItems)
@@ -53,28 +54,6 @@ namespace
             transitionTexture(material->GetEmissiveTexture());
         }
     }
-
-    template <typename DrawFunc>
-    void ForEachOpaqueDrawItem(const std::vector<RenderDrawItem>* opaqueDrawItems,
-                               const std::vector<RenderDrawItem>* maskedDrawItems,
-                               DrawFunc&& drawFunc)
-    {
-        if (opaqueDrawItems)
-        {
-            for (const RenderDrawItem& item : *opaqueDrawItems)
-            {
-                drawFunc(item);
-            }
-        }
-
-        if (maskedDrawItems)
-        {
-            for (const RenderDrawItem& item : *maskedDrawItems)
-            {
-                drawFunc(item);
-            }
-        }
-    }
 } // namespace
 
 void OpaquePass::OnAdd(IRHIDevice* device)
@@ -117,6 +96,42 @@ void OpaquePass::SetRenderTargets(RHITextureView* colorTargetView, RHITextureVie
     m_depthTargetView = depthTargetView;
 }
 
+void OpaquePass::BuildInstancedDraws(const std::vector<RenderDrawItem>& drawItems)
+{
+    for (const RenderDrawItem& item : drawItems)
+    {
+        if (item.objectIndex >= m_renderScene->GetObjectCount())
+            continue;
+
+        const RenderObject& obj = m_renderScene->GetObject(item.objectIndex);
+        const Resource::MaterialResource* materialResource =
+            item.materialResource ? item.materialResource : ResolveMaterialResource(obj, item.submeshIndex);
+
+        // Items arrive sorted by material then mesh, so equal keys are adjacent
+        InstancedDraw* draw = m_instancedDraws.empty() ? nullptr : &m_instancedDraws.back();
+        if (!draw || draw->meshId != obj.meshId || draw->submeshIndex != item.submeshIndex ||
+            draw->materialResource != materialResource ||
+            draw->instanceCount >= PipelineCache::MaxObjectInstancesPerDraw)
+        {
+            // Each draw binds the object window at its first instance, which
+            // must sit on the constant-buffer offset alignment
+            const size_t alignment = PipelineCache::ObjectInstanceAlignment;
+            m_instanceData.resize((m_instanceData.size() + alignment - 1) / alignment * alignment);
+
+            InstancedDraw& newDraw = m_instancedDraws.emplace_back();
+            newDraw.meshId = obj.meshId;
+            newDraw.submeshIndex = item.submeshIndex;
+            newDraw.materialResource = materialResource;
+            newDraw.firstInstance = static_cast<uint32_t>(m_instanceData.size());
+            draw = &newDraw;
+        }
+
+        m_instanceData.push_back(ObjectConstants{obj.worldMatrix});
+        ++draw->instanceCount;
+        ++m_stats.drawItems;
+    }
+}
+
 void OpaquePass::Setup(RenderGraphBuilder& builder, const ViewData& view)
 {
     // Declare that we write to the color target
@@ -135,42 +150,182 @@ void OpaquePass::Setup(RenderGraphBuilder& builder, const ViewData& view)
 
 void OpaquePass::Execute(RHICommandContext& ctx, const ViewData& view)
 {
+    RGRecordRange range;
+    range.end = PrepareDraws(view);
+    RecordDraws(ctx, view, range);
+}
+
+void OpaquePass::AddToGraph(RenderGraph& graph, const ViewData& view)
+{
+    struct PassData
+    {
+        OpaquePass* pass;
+        const ViewData* viewData;
+    };
+
+    graph.AddParallelPass<PassData>(
+        GetName(),
+        GetPassType(),
+        [this, &view](RenderGraphBuilder& builder, PassData& data)
+        {
+            data.pass = this;
+            data.viewData = &view;
+            Setup(builder, view);
+        },
+        [](PassData& data) -> uint32
+        {
+            return data.pass->PrepareDraws(*data.viewData);
+        },
+        [](const PassData& data, RHICommandContext& ctx, const RGRecordRange& range)
+        {
+            data.pass->RecordDraws(ctx, *data.viewData, range);
+        });
+}
+
+uint32_t OpaquePass::PrepareDraws(const ViewData& view)
+{
+    m_prepared = false;
+    m_stats = {};
+    m_textureBarriers.clear();
+    m_meshBuffers.clear();
+    m_drawPackets.clear();
+
     // Validate dependencies
     if (!m_pipelineCache || !m_pipelineCache->IsInitialized())
     {
         RVX_CORE_WARN("OpaquePass: PipelineCache not available (initialized: {})",
                       m_pipelineCache ? m_pipelineCache->IsInitialized() : false);
-        return;
+        return 0;
     }
 
     if (!m_materialSystem || !m_materialSystem->IsInitialized())
     {
         RVX_CORE_WARN("OpaquePass: MaterialSystem not available");
-        return;
+        return 0;
     }
 
     if (!m_colorTargetView)
     {
         RVX_CORE_WARN("OpaquePass: No color target view set");
-        return;
+        return 0;
     }
 
+    m_prepared = true;
+
     if (m_gpuResources)
     {
         if (m_opaqueDrawItems)
-            TransitionVisibleMaterialTextures(*m_opaqueDrawItems, *m_gpuResources, ctx);
+            TransitionVisibleMaterialTextures(*m_opaqueDrawItems, *m_gpuResources, m_textureBarriers);
         if (m_maskedDrawItems)
-            TransitionVisibleMaterialTextures(*m_maskedDrawItems, *m_gpuResources, ctx);
+            TransitionVisibleMaterialTextures(*m_maskedDrawItems, *m_gpuResources, m_textureBarriers);
+    }
+
+    m_pipeline = m_pipelineCache->GetOpaquePipeline();
+    if (!m_pipeline)
+    {
+        RVX_CORE_WARN("OpaquePass: No opaque pipeline available");
+        return 0;
+    }
+
+    m_frameSet = m_pipelineCache->GetFrameDescriptorSet();
+    m_objectSet = m_pipelineCache->GetObjectDescriptorSet();
+
+    if (!m_renderScene || !m_gpuResources)
+    {
+        // Log why we're not drawing
+        if (!m_renderScene) RVX_CORE_DEBUG("OpaquePass: No render scene");
+        if (!m_opaqueDrawItems && !m_maskedDrawItems) RVX_CORE_DEBUG("OpaquePass: No draw items");
+        if (!m_gpuResources) RVX_CORE_DEBUG("OpaquePass: No GPU resources");
+        return 0;
+    }
+
+    // Merge draw items into instanced draws and upload all instances at once
+    m_instancedDraws.clear();
+    m_instanceData.clear();
+
+    if (m_opaqueDrawItems)
+        BuildInstancedDraws(*m_opaqueDrawItems);
+    if (m_maskedDrawItems)
+        BuildInstancedDraws(*m_maskedDrawItems);
+
+    const uint64 instanceUploadOffset = m_pipelineCache->UploadObjectInstances(m_instanceData);
+    if (instanceUploadOffset == PipelineCache::InvalidObjectUpload)
+    {
+        // No room for this frame's instances; drawing them would read other draws' constants
+        return 0;
+    }
+
+    uint64 meshId = 0;
+    bool meshValid = false;
+    const Resource::MaterialResource* material = nullptr;
+    bool materialResolved = false;
+    RHIDescriptorSet* materialSet = nullptr;
+    std::array<uint32, 1> materialDynamicOffsets = {};
+
+    for (const InstancedDraw& draw : m_instancedDraws)
+    {
+        // Get GPU buffers once per run of draws sharing a mesh
+        if (!meshValid || draw.meshId != meshId)
+        {
+            MeshGPUBuffers buffers = m_gpuResources->GetMeshBuffers(draw.meshId);
+            meshId = draw.meshId;
+            meshValid = buffers.IsValid();
+            if (!meshValid)
+            {
+                continue;  // Mesh not uploaded yet
+            }
+            m_meshBuffers.push_back(std::move(buffers));
+        }
+
+        if (draw.submeshIndex >= m_meshBuffers.back().submeshes.size())
+        {
+            continue;
+        }
+
+        // Material constants are written once per run of draws sharing a material
+        if (!materialResolved || draw.materialResource != material)
+        {
+            m_materialSystem->UpdateMaterialConstants(draw.materialResource, view.viewCache);
+            materialSet = m_materialSystem->GetOrCreateMaterialSet(draw.materialResource, view.viewCache);
+            materialDynamicOffsets = m_materialSystem->GetCurrentMaterialDynamicOffset();
+            material = draw.materialResource;
+            materialResolved = true;
+        }
+
+        DrawPacket& packet = m_drawPackets.emplace_back();
+        packet.meshIndex = static_cast<uint32_t>(m_meshBuffers.size() - 1);
+        packet.submeshIndex = draw.submeshIndex;
+        packet.instanceCount = draw.instanceCount;
+        packet.materialSet = materialSet;
+        packet.objectDynamicOffsets =
+            PipelineCache::GetObjectInstanceDynamicOffset(instanceUploadOffset, draw.firstInstance);
+        packet.materialDynamicOffsets = materialDynamicOffsets;
     }
 
-    // 1. Begin render pass using builder pattern
+    m_stats.drawCalls = static_cast<uint32_t>(m_drawPackets.size());
+    return static_cast<uint32_t>(m_drawPackets.size());
+}
+
+void OpaquePass::RecordDraws(RHICommandContext& ctx, const ViewData& view, const RGRecordRange& range) const
+{
+    if (!m_prepared)
+        return;
+
+    if (range.IsFirst() && !m_textureBarriers.empty())
+    {
+        ctx.Barriers({}, m_textureBarriers);
+    }
+
+    // 1. Begin render pass; only the first chunk clears
+    const RHILoadOp loadOp = range.IsFirst() ? RHILoadOp::Clear : RHILoadOp::Load;
+
     RHIRenderPassDesc rpDesc;
-    rpDesc.AddColorAttachment(m_colorTargetView, RHILoadOp::Clear, RHIStoreOp::Store,
+    rpDesc.AddColorAttachment(m_colorTargetView, loadOp, RHIStoreOp::Store,
                               {0.1f, 0.1f, 0.15f, 1.0f});
 
     if (m_depthTargetView)
     {
-        rpDesc.SetDepthStencil(m_depthTargetView, RHILoadOp::Clear, RHIStoreOp::Store,
+        rpDesc.SetDepthStencil(m_depthTargetView, loadOp, RHIStoreOp::Store,
                                1.0f, 0);
     }
 
@@ -181,58 +336,36 @@ void OpaquePass::Execute(RHICommandContext& ctx, const ViewData& view)
     ctx.SetScissor(view.GetRHIScissor());
 
     // 3. Bind pipeline
-    RHIPipeline* pipeline = m_pipelineCache->GetOpaquePipeline();
-    if (!pipeline)
+    if (!m_pipeline)
     {
-        RVX_CORE_WARN("OpaquePass: No opaque pipeline available");
         ctx.EndRenderPass();
         return;
     }
-    ctx.SetPipeline(pipeline);
+    ctx.SetPipeline(m_pipeline);
 
     // 4. Bind frame constants descriptor set
-    RHIDescriptorSet* frameSet = m_pipelineCache->GetFrameDescriptorSet();
-    if (frameSet)
+    if (m_frameSet)
     {
-        ctx.SetDescriptorSet(0, frameSet);
+        ctx.SetDescriptorSet(0, m_frameSet);
     }
 
-    // 5. Draw each visible object
-    if (m_renderScene && m_gpuResources)
+    // 5. Draw this chunk, rebinding only what changes between packets
+    const DrawPacket* previous = nullptr;
+    for (uint32_t i = range.begin; i < range.end && i < m_drawPackets.size(); ++i)
     {
-        ForEachOpaqueDrawItem(
-            m_opaqueDrawItems, m_maskedDrawItems,
-            [&](const RenderDrawItem& item)
-        {
-            if (item.objectIndex >= m_renderScene->GetObjectCount())
-                return;
-
-            const RenderObject& obj = m_renderScene->GetObject(item.objectIndex);
-
-            // Get GPU buffers for this mesh
-            MeshGPUBuffers buffers = m_gpuResources->GetMeshBuffers(obj.meshId);
-            if (!buffers.IsValid())
-            {
-                return;  // Mesh not uploaded yet
-            }
-
-            // Update per-object constants (world matrix)
-            m_pipelineCache->UpdateObjectConstants(obj.worldMatrix);
-            RHIDescriptorSet* objectSet = m_pipelineCache->GetObjectDescriptorSet();
-            if (objectSet)
-            {
-                const auto objectDynamicOffsets = m_pipelineCache->GetCurrentObjectDynamicOffset();
-                ctx.SetDescriptorSet(1, objectSet, objectDynamicOffsets);
-            }
+        const DrawPacket& packet = m_drawPackets[i];
+        const MeshGPUBuffers& buffers = m_meshBuffers[packet.meshIndex];
 
+        if (!previous || packet.meshIndex != previous->meshIndex)
+        {
             // Bind SEPARATE vertex buffers to different slots
             ctx.SetVertexBuffer(0, buffers.positionBuffer);  // Slot 0: Position
-            
+
             if (buffers.normalBuffer)
             {
                 ctx.SetVertexBuffer(1, buffers.normalBuffer);  // Slot 1: Normal
             }
-            
+
             if (buffers.uvBuffer)
             {
                 ctx.SetVertexBuffer(2, buffers.uvBuffer);  // Slot 2: UV
@@ -245,34 +378,25 @@ void OpaquePass::Execute(RHICommandContext& ctx, const ViewData& view)
 
             // Bind index buffer
             ctx.SetIndexBuffer(buffers.indexBuffer, RHIFormat::R32_UINT);
+        }
 
-            if (item.submeshIndex >= buffers.submeshes.size())
-            {
-                return;
-            }
-
-            const SubmeshGPUInfo& submesh = buffers.submeshes[item.submeshIndex];
-            const Resource::MaterialResource* materialResource =
-                item.materialResource ? item.materialResource : ResolveMaterialResource(obj, item.submeshIndex);
-            m_materialSystem->UpdateMaterialConstants(materialResource, view.viewCache);
+        // Point the object window at this draw's first instance
+        if (m_objectSet)
+        {
+            ctx.SetDescriptorSet(1, m_objectSet, packet.objectDynamicOffsets);
+        }
 
-            RHIDescriptorSet* materialSet = m_materialSystem->GetOrCreateMaterialSet(materialResource, view.viewCache);
-            if (materialSet)
-            {
-                const auto materialDynamicOffsets = m_materialSystem->GetCurrentMaterialDynamicOffset();
-                ctx.SetDescriptorSet(2, materialSet, materialDynamicOffsets);
-            }
+        if (packet.materialSet &&
+            (!previous || packet.materialSet != previous->materialSet ||
+             packet.materialDynamicOffsets != previous->materialDynamicOffsets))
+        {
+            ctx.SetDescriptorSet(2, packet.materialSet, packet.materialDynamicOffsets);
+        }
 
-            ctx.DrawIndexed(submesh.indexCount, 1,
-                            submesh.indexOffset, submesh.baseVertex, 0);
-        });
-    }
-    else
-    {
-        // Log why we're not drawing
-        if (!m_renderScene) RVX_CORE_DEBUG("OpaquePass: No render scene");
-        if (!m_opaqueDrawItems && !m_maskedDrawItems) RVX_CORE_DEBUG("OpaquePass: No draw items");
-        if (!m_gpuResources) RVX_CORE_DEBUG("OpaquePass: No GPU resources");
+        const SubmeshGPUInfo& submesh = buffers.submeshes[packet.submeshIndex];
+        ctx.DrawIndexed(submesh.indexCount, packet.instanceCount,
+                        submesh.indexOffset, submesh.baseVertex, 0);
+        previous = &packet;
     }
 
     // 6. End render pass
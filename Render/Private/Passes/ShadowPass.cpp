@@ -10,6 +10,7 @@
 #include "Render/PipelineCache.h"
 #include "RHI/RHIRenderPass.h"
 #include "Core/Log.h"
+#include <algorithm>
 #include <cmath>
 
 namespace RVX
@@ -18,6 +19,7 @@ namespace RVX
 ShadowPass::ShadowPass()
 {
     m_cascades.resize(4);  // Default 4 cascades
+    m_cascadeVisibleObjects.resize(4);
 }
 
 void ShadowPass::SetResources(GPUResourceManager* gpuResources, PipelineCache* pipelineCache)
@@ -35,6 +37,7 @@ void ShadowPass::SetConfig(const ShadowPassConfig& config)
 {
     m_config = config;
     m_cascades.resize(config.numCascades);
+    m_cascadeVisibleObjects.resize(config.numCascades);
 }
 
 void ShadowPass::SetDirectionalLight(const Vec3& direction, const Vec3& color, float intensity)
@@ -66,12 +69,10 @@ void ShadowPass::CalculateCascades(const ViewData& view)
         m_cascades[i].splitDepth = (splitDepth - nearClip) / range;
     }
 
-    // Calculate light view-projection matrix for each cascade
-    // Note: This is a simplified implementation. A full implementation would:
-    // 1. Calculate the frustum corners for each cascade split
-    // 2. Transform corners to world space
-    // 3. Fit an orthographic projection to encompass the frustum
-    // 4. Stabilize the shadow map to prevent shimmer
+    // Calculate light view-projection matrix for each cascade.
+    // Each cascade is fitted to the bounding sphere of its slice of the view
+    // frustum; the sphere does not change as the camera rotates, which keeps
+    // the projection size stable. Texel snapping is not done yet.
 
     Vec3 lightDir = m_lightDirection;
     // Normalize
@@ -83,13 +84,74 @@ void ShadowPass::CalculateCascades(const ViewData& view)
         lightDir.z /= len;
     }
 
-    // Simplified: Create a basic orthographic light projection centered on view
+    const Vec3 lightUp = std::abs(lightDir.y) > 0.99f ? Vec3(0.0f, 0.0f, 1.0f) : Vec3(0.0f, 1.0f, 0.0f);
+    const float tanHalfFov = std::tan(view.fieldOfView * 0.5f);
+
+    float sliceNear = nearClip;
     for (uint32_t i = 0; i < m_cascades.size(); ++i)
     {
-        // Simple orthographic projection for directional light
-        // A full implementation would calculate proper bounds from frustum corners
-        m_cascades[i].viewProjection = Mat4Identity();  // Placeholder
+        const float sliceFar = nearClip + m_cascades[i].splitDepth * range;
+
+        // Slice corners in world space
+        Vec3 corners[8];
+        int cornerCount = 0;
+        for (float depth : {sliceNear, sliceFar})
+        {
+            const float halfHeight = depth * tanHalfFov;
+            const float halfWidth = halfHeight * view.aspectRatio;
+            for (float sx : {-1.0f, 1.0f})
+            {
+                for (float sy : {-1.0f, 1.0f})
+                {
+                    const Vec4 viewCorner(sx * halfWidth, sy * halfHeight, -depth, 1.0f);
+                    corners[cornerCount++] = Vec3(view.inverseViewMatrix * viewCorner);
+                }
+            }
+        }
+
+        Vec3 center(0.0f);
+        for (const Vec3& corner : corners)
+        {
+            center += corner;
+        }
+        center /= 8.0f;
+
+        float radius = 0.0f;
+        for (const Vec3& corner : corners)
+        {
+            radius = std::max(radius, length(corner - center));
+        }
+
+        // Pull the eye back so casters between the light and the slice still land in the map
+        const float pullBack = radius + m_config.casterDistance;
+        const Mat4 lightView = glm::lookAt(center - lightDir * pullBack, center, lightUp);
+        const Mat4 lightProj = glm::ortho(-radius, radius, -radius, radius, 0.0f, pullBack + radius);
+        m_cascades[i].viewProjection = lightProj * lightView;
+
+        sliceNear = sliceFar;
+    }
+}
+
+void ShadowPass::CullCascades()
+{
+    m_cascadeVisibleObjects.resize(m_cascades.size());
+    if (!m_renderScene)
+    {
+        for (auto& visible : m_cascadeVisibleObjects)
+        {
+            visible.clear();
+        }
+        return;
+    }
+
+    m_cascadeFrustums.resize(m_cascades.size());
+    for (size_t i = 0; i < m_cascades.size(); ++i)
+    {
+        m_cascadeFrustums[i].ExtractFromMatrix(m_cascades[i].viewProjection);
     }
+
+    m_renderScene->CullFrustums(m_cascadeFrustums, m_cascadeVisibleObjects,
+                                RenderScene::CullFilter::ShadowCasters);
 }
 
 void ShadowPass::Setup(RenderGraphBuilder& builder, const ViewData& view)
@@ -99,92 +161,200 @@ void ShadowPass::Setup(RenderGraphBuilder& builder, const ViewData& view)
     // Shadow pass creates its own render targets (shadow maps)
     // These would be transient textures in a full RenderGraph implementation
     CalculateCascades(view);
+    CullCascades();
 }
 
 void ShadowPass::Execute(RHICommandContext& ctx, const ViewData& view)
 {
     (void)view;
 
+    RGRecordRange range;
+    range.end = PrepareDraws();
+    RecordDraws(ctx, range);
+}
+
+void ShadowPass::AddToGraph(RenderGraph& graph, const ViewData& view)
+{
+    struct PassData
+    {
+        ShadowPass* pass;
+    };
+
+    graph.AddParallelPass<PassData>(
+        GetName(),
+        GetPassType(),
+        [this, &view](RenderGraphBuilder& builder, PassData& data)
+        {
+            data.pass = this;
+            Setup(builder, view);
+        },
+        [](PassData& data) -> uint32
+        {
+            return data.pass->PrepareDraws();
+        },
+        [](const PassData& data, RHICommandContext& ctx, const RGRecordRange& range)
+        {
+            data.pass->RecordDraws(ctx, range);
+        });
+}
+
+uint32_t ShadowPass::PrepareDraws()
+{
+    m_pipeline = nullptr;
+    m_drawPackets.clear();
+    m_instanceData.clear();
+    m_cascadeFirstPacket.assign(m_cascades.size() + 1, 0);
+
     if (!m_pipelineCache || !m_renderScene || !m_gpuResources)
     {
-        return;
+        return 0;
     }
 
     // Get depth-only pipeline for shadow rendering
-    RHIPipeline* shadowPipeline = m_pipelineCache->GetDepthOnlyPipeline();
-    if (!shadowPipeline)
+    m_pipeline = m_pipelineCache->GetDepthOnlyPipeline();
+    if (!m_pipeline)
     {
         // Shadow pipeline not available yet
-        return;
+        return 0;
     }
 
-    // Render each cascade
-    for (uint32_t i = 0; i < static_cast<uint32_t>(m_cascades.size()); ++i)
-    {
-        RenderCascade(ctx, i);
-    }
-}
+    m_frameSet = m_pipelineCache->GetFrameDescriptorSet();
+    m_objectSet = m_pipelineCache->GetObjectDescriptorSet();
 
-void ShadowPass::RenderCascade(RHICommandContext& ctx, uint32_t cascadeIndex)
-{
-    if (cascadeIndex >= m_cascadeViews.size() || !m_cascadeViews[cascadeIndex])
+    // Each caster gets its own object window, aligned for the dynamic offset
+    // In a full implementation: lightViewProj * worldMatrix
+    const size_t alignment = PipelineCache::ObjectInstanceAlignment;
+    std::vector<uint32_t> packetInstances;
+
+    for (uint32_t cascadeIndex = 0; cascadeIndex < static_cast<uint32_t>(m_cascades.size()); ++cascadeIndex)
     {
-        return;  // Cascade view not created
+        m_cascadeFirstPacket[cascadeIndex] = static_cast<uint32_t>(m_drawPackets.size());
+
+        const bool hasView = cascadeIndex < m_cascadeViews.size() && m_cascadeViews[cascadeIndex];
+        if (!hasView)
+            continue;  // Cascade view not created
+
+        // Draw the shadow casters that survived this cascade's cull
+        for (uint32_t objectIndex : m_cascadeVisibleObjects[cascadeIndex])
+        {
+            const RenderObject& obj = m_renderScene->GetObject(objectIndex);
+
+            MeshGPUBuffers buffers = m_gpuResources->GetMeshBuffers(obj.meshId);
+            if (!buffers.IsValid())
+                continue;
+
+            const uint32_t instance = static_cast<uint32_t>(m_instanceData.size());
+            m_instanceData.push_back(ObjectConstants{obj.worldMatrix});
+            m_instanceData.resize((m_instanceData.size() + alignment - 1) / alignment * alignment);
+
+            for (const SubmeshGPUInfo& submesh : buffers.submeshes)
+            {
+                DrawPacket& packet = m_drawPackets.emplace_back();
+                packet.positionBuffer = buffers.positionBuffer;
+                packet.indexBuffer = buffers.indexBuffer;
+                packet.indexCount = submesh.indexCount;
+                packet.indexOffset = submesh.indexOffset;
+                packet.baseVertex = submesh.baseVertex;
+                packetInstances.push_back(instance);
+            }
+        }
     }
+    m_cascadeFirstPacket[m_cascades.size()] = static_cast<uint32_t>(m_drawPackets.size());
 
-    // Begin shadow render pass for this cascade
-    RHIRenderPassDesc rpDesc;
-    rpDesc.SetDepthStencil(m_cascadeViews[cascadeIndex].Get(), 
-                           RHILoadOp::Clear, RHIStoreOp::Store, 1.0f, 0);
+    if (!m_instanceData.empty())
+    {
+        const uint64 instanceUploadOffset = m_pipelineCache->UploadObjectInstances(m_instanceData);
+        if (instanceUploadOffset == PipelineCache::InvalidObjectUpload)
+        {
+            // No room for the casters this frame; the cascades are still cleared
+            m_drawPackets.clear();
+            m_cascadeFirstPacket.assign(m_cascades.size() + 1, 0);
+            return 0;
+        }
 
-    ctx.BeginRenderPass(rpDesc);
+        for (size_t i = 0; i < m_drawPackets.size(); ++i)
+        {
+            m_drawPackets[i].objectDynamicOffset =
+                PipelineCache::GetObjectInstanceDynamicOffset(instanceUploadOffset, packetInstances[i]);
+        }
+    }
 
-    // Set viewport for this cascade slice
-    uint32_t size = m_config.shadowMapSize;
-    RHIViewport viewport{0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size), 0.0f, 1.0f};
-    ctx.SetViewport(viewport);
+    return static_cast<uint32_t>(m_drawPackets.size());
+}
 
-    RHIRect scissor{0, 0, size, size};
-    ctx.SetScissor(scissor);
+void ShadowPass::RecordDraws(RHICommandContext& ctx, const RGRecordRange& range) const
+{
+    if (!m_pipeline)
+        return;
 
-    // Bind shadow pipeline
-    RHIPipeline* pipeline = m_pipelineCache->GetDepthOnlyPipeline();
-    if (pipeline)
+    // A cascade is cleared by the chunk holding its first packet; an empty
+    // cascade belongs to the chunk its position falls in (or the last one)
+    const auto ownsPosition = [&range](uint32_t position)
     {
-        ctx.SetPipeline(pipeline);
-    }
+        return (position >= range.begin && position < range.end) ||
+               (range.IsLast() && position == range.end);
+    };
 
-    // Draw all shadow-casting objects
-    for (size_t i = 0; i < m_renderScene->GetObjectCount(); ++i)
+    for (uint32_t cascadeIndex = 0; cascadeIndex < static_cast<uint32_t>(m_cascades.size()); ++cascadeIndex)
     {
-        const RenderObject& obj = m_renderScene->GetObject(i);
-        
-        if (!obj.castsShadow)
+        if (cascadeIndex >= m_cascadeViews.size() || !m_cascadeViews[cascadeIndex])
+            continue;  // Cascade view not created
+
+        const uint32_t cascadeBegin = m_cascadeFirstPacket[cascadeIndex];
+        const uint32_t cascadeEnd = m_cascadeFirstPacket[cascadeIndex + 1];
+        const uint32_t drawBegin = std::max(cascadeBegin, range.begin);
+        const uint32_t drawEnd = std::min(cascadeEnd, range.end);
+        const bool clear = ownsPosition(cascadeBegin);
+        if (!clear && drawBegin >= drawEnd)
             continue;
 
-        MeshGPUBuffers buffers = m_gpuResources->GetMeshBuffers(obj.meshId);
-        if (!buffers.IsValid())
-            continue;
+        // Begin shadow render pass for this cascade
+        RHIRenderPassDesc rpDesc;
+        rpDesc.SetDepthStencil(m_cascadeViews[cascadeIndex].Get(),
+                               clear ? RHILoadOp::Clear : RHILoadOp::Load, RHIStoreOp::Store, 1.0f, 0);
+
+        ctx.BeginRenderPass(rpDesc);
+
+        // Set viewport for this cascade slice
+        uint32_t size = m_config.shadowMapSize;
+        RHIViewport viewport{0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size), 0.0f, 1.0f};
+        ctx.SetViewport(viewport);
 
-        // Update object constants with light-space matrix
-        // In a full implementation: lightViewProj * worldMatrix
-        if (m_pipelineCache)
+        RHIRect scissor{0, 0, size, size};
+        ctx.SetScissor(scissor);
+
+        // Bind shadow pipeline
+        ctx.SetPipeline(m_pipeline);
+        if (m_frameSet)
         {
-            m_pipelineCache->UpdateObjectConstants(obj.worldMatrix);
+            ctx.SetDescriptorSet(0, m_frameSet);
         }
 
-        // Bind vertex buffers
-        ctx.SetVertexBuffer(0, buffers.positionBuffer);
-        ctx.SetIndexBuffer(buffers.indexBuffer, RHIFormat::R32_UINT);
-
-        // Draw
-        for (const SubmeshGPUInfo& submesh : buffers.submeshes)
+        const DrawPacket* previous = nullptr;
+        for (uint32_t i = drawBegin; i < drawEnd; ++i)
         {
-            ctx.DrawIndexed(submesh.indexCount, 1, submesh.indexOffset, submesh.baseVertex, 0);
+            const DrawPacket& packet = m_drawPackets[i];
+
+            // Bind vertex buffers
+            if (!previous || packet.positionBuffer != previous->positionBuffer ||
+                packet.indexBuffer != previous->indexBuffer)
+            {
+                ctx.SetVertexBuffer(0, packet.positionBuffer);
+                ctx.SetIndexBuffer(packet.indexBuffer, RHIFormat::R32_UINT);
+            }
+
+            if (m_objectSet && (!previous || packet.objectDynamicOffset != previous->objectDynamicOffset))
+            {
+                ctx.SetDescriptorSet(1, m_objectSet, packet.objectDynamicOffset);
+            }
+
+            // Draw
+            ctx.DrawIndexed(packet.indexCount, 1, packet.indexOffset, packet.baseVertex, 0);
+            previous = &packet;
         }
-    }
 
-    ctx.EndRenderPass();
+        ctx.EndRenderPass();
+    }
 }
 
 void ShadowPass::CreateShadowMap()
@@ -134,8 +134,11 @@ void TransparentPass::Execute(RHICommandContext& ctx, const ViewData& view)
                 continue;  // Mesh not uploaded yet
             }
 
-            // Update per-object constants (world matrix)
-            m_pipelineCache->UpdateObjectConstants(obj.worldMatrix);
+            // Update per-object constants (world matrix); skipped once this frame's are used up
+            if (!m_pipelineCache->UpdateObjectConstants(obj.worldMatrix))
+            {
+                continue;
+            }
             RHIDescriptorSet* objectSet = m_pipelineCache->GetObjectDescriptorSet();
             if (objectSet)
             {
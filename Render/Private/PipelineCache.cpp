@@ -9,6 +9,7 @@
 #include "ShaderCompiler/ShaderCompiler.h"
 #include "ShaderCompiler/ShaderManager.h"
 
+#include <algorithm>
 #include <cstring>
 #include <filesystem>
 
@@ -20,6 +21,12 @@ namespace
     constexpr uint64 RVX_CONSTANT_BUFFER_ALIGNMENT = 256;
     constexpr uint64 RVX_MAX_DRAW_CONSTANTS_PER_FRAME = 8192;
 
+    // Each frame region holds as many instances as 8192 single draws used to
+    // take as 256-byte slots
+    constexpr uint64 RVX_OBJECT_FRAME_REGION_SIZE = RVX_MAX_DRAW_CONSTANTS_PER_FRAME * RVX_CONSTANT_BUFFER_ALIGNMENT;
+    constexpr uint64 RVX_OBJECT_WINDOW_SIZE =
+        static_cast<uint64>(PipelineCache::MaxObjectInstancesPerDraw) * sizeof(ObjectConstants);
+
     uint64 AlignConstantBufferSize(uint64 size)
     {
         return (size + RVX_CONSTANT_BUFFER_ALIGNMENT - 1) & ~(RVX_CONSTANT_BUFFER_ALIGNMENT - 1);
@@ -241,8 +248,9 @@ bool PipelineCache::CreatePipelineLayout()
 
 void PipelineCache::BeginFrame()
 {
+    m_objectFrameIndex = (m_objectFrameIndex + 1) % RVX_MAX_FRAME_COUNT;
     m_objectConstantCursor = 0;
-    m_currentObjectConstantOffset = 0;
+    m_currentObjectConstantOffset = m_objectFrameIndex * m_objectFrameRegionSize;
 }
 
 RHIDescriptorSet* PipelineCache::GetFrameDescriptorSet()
@@ -309,10 +317,12 @@ bool PipelineCache::CreateViewConstantBuffer()
 
 bool PipelineCache::CreateObjectConstantBuffer()
 {
-    m_objectConstantStride = AlignConstantBufferSize(sizeof(ObjectConstants));
+    m_objectFrameRegionSize = RVX_OBJECT_FRAME_REGION_SIZE;
 
+    // One region per frame in flight, plus one window of slack so a draw
+    // bound at the end of the last region still sees a full window
     RHIBufferDesc cbDesc;
-    cbDesc.size = m_objectConstantStride * RVX_MAX_DRAW_CONSTANTS_PER_FRAME;
+    cbDesc.size = m_objectFrameRegionSize * RVX_MAX_FRAME_COUNT + RVX_OBJECT_WINDOW_SIZE;
     cbDesc.usage = RHIBufferUsage::Constant;
     cbDesc.memoryType = RHIMemoryType::Upload;
     cbDesc.debugName = "ObjectConstantBuffer";
@@ -348,7 +358,7 @@ RHIDescriptorSetRef PipelineCache::CreateObjectDescriptorSet()
     RHIDescriptorSetDesc descSetDesc;
     descSetDesc.layout = m_setLayouts[1].Get();
     descSetDesc.debugName = "DefaultObjectDescriptorSet";
-    descSetDesc.BindBuffer(0, m_objectConstantBuffer.Get(), 0, m_objectConstantStride);
+    descSetDesc.BindBuffer(0, m_objectConstantBuffer.Get(), 0, RVX_OBJECT_WINDOW_SIZE);
 
     return m_device->CreateDescriptorSet(descSetDesc);
 }
@@ -420,24 +430,24 @@ RHIPipelineRef PipelineCache::CreateDefaultLitPipeline(const char* debugName,
     return m_device->CreateGraphicsPipeline(pipelineDesc);
 }
 
-uint64 PipelineCache::AllocateObjectConstantSlot()
+uint64 PipelineCache::AllocateObjectInstances(uint64 count)
 {
-    if (m_objectConstantStride == 0)
-        m_objectConstantStride = AlignConstantBufferSize(sizeof(ObjectConstants));
+    const uint64 regionBase = m_objectFrameIndex * m_objectFrameRegionSize;
+    const uint64 size = AlignConstantBufferSize(count * sizeof(ObjectConstants));
 
-    if (m_objectConstantCursor >= RVX_MAX_DRAW_CONSTANTS_PER_FRAME)
+    // Sharing a slot would hand the draws each other's constants, and a window
+    // placed past the region could run off the end of the buffer
+    if (m_objectConstantCursor + size > m_objectFrameRegionSize)
     {
         RVX_VERIFY(false,
-                   "PipelineCache: Object constant buffer exhausted for this frame (max {} draws). "
-                   "Reusing the final slot to avoid wrapping over earlier draw constants.",
-                   RVX_MAX_DRAW_CONSTANTS_PER_FRAME);
-        const uint64 offset = (RVX_MAX_DRAW_CONSTANTS_PER_FRAME - 1) * m_objectConstantStride;
-        m_currentObjectConstantOffset = offset;
-        return offset;
+                   "PipelineCache: Object constant buffer exhausted for this frame ({} bytes requested, {} of {} used). "
+                   "Skipping the draws that need it.",
+                   size, m_objectConstantCursor, m_objectFrameRegionSize);
+        return InvalidObjectUpload;
     }
 
-    const uint64 offset = m_objectConstantCursor * m_objectConstantStride;
-    ++m_objectConstantCursor;
+    const uint64 offset = regionBase + m_objectConstantCursor;
+    m_objectConstantCursor += size;
     m_currentObjectConstantOffset = offset;
     return offset;
 }
@@ -468,21 +478,43 @@ void PipelineCache::UpdateViewConstants(const ViewData& view)
     }
 }
 
-void PipelineCache::UpdateObjectConstants(const Mat4& worldMatrix)
+bool PipelineCache::UpdateObjectConstants(const Mat4& worldMatrix)
 {
     if (!m_objectConstantBuffer)
-        return;
+        return false;
 
     ObjectConstants constants;
     constants.world = worldMatrix;
 
-    const uint64 offset = AllocateObjectConstantSlot();
+    const uint64 offset = AllocateObjectInstances(1);
+    if (offset == InvalidObjectUpload)
+        return false;
+
     void* mapped = m_objectConstantBuffer->Map();
     if (mapped)
     {
         std::memcpy(static_cast<uint8*>(mapped) + offset, &constants, sizeof(ObjectConstants));
         m_objectConstantBuffer->Unmap();
     }
+    return true;
+}
+
+uint64 PipelineCache::UploadObjectInstances(std::span<const ObjectConstants> instances)
+{
+    if (!m_objectConstantBuffer || instances.empty())
+        return 0;
+
+    const uint64 offset = AllocateObjectInstances(instances.size());
+    if (offset == InvalidObjectUpload)
+        return InvalidObjectUpload;
+
+    void* mapped = m_objectConstantBuffer->Map();
+    if (mapped)
+    {
+        std::memcpy(static_cast<uint8*>(mapped) + offset, instances.data(), instances.size_bytes());
+        m_objectConstantBuffer->Unmap();
+    }
+    return offset;
 }
 
 } // namespace RVX
@@ -0,0 +1,179 @@
+/**
+ * @file DrawSort.cpp
+ * @brief Radix sort for 64-bit draw sort keys
+ */
+
+#include "Render/Renderer/DrawSort.h"
+#include "Core/Job/JobSystem.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace RVX
+{
+    namespace
+    {
+        constexpr uint32 kRadixBits = 8;
+        constexpr uint32 kRadixBuckets = 1u << kRadixBits;
+        constexpr uint32 kKeyDigits = 64 / kRadixBits;
+
+        /// Lists this short are insertion sorted; histogram setup costs more than it saves
+        constexpr size_t kInsertionSortThreshold = 64;
+
+        /// Each parallel chunk handles at least this many entries per pass
+        constexpr size_t kMinEntriesPerChunk = 16384;
+
+        uint32 KeyDigit(uint64 key, uint32 digit)
+        {
+            return static_cast<uint32>(key >> (digit * kRadixBits)) & (kRadixBuckets - 1);
+        }
+
+        void InsertionSort(std::vector<DrawSortEntry>& entries)
+        {
+            for (size_t i = 1; i < entries.size(); ++i)
+            {
+                const DrawSortEntry entry = entries[i];
+                size_t j = i;
+                while (j > 0 && entries[j - 1].key > entry.key)
+                {
+                    entries[j] = entries[j - 1];
+                    --j;
+                }
+                entries[j] = entry;
+            }
+        }
+
+        void ScatterPass(const DrawSortEntry* src, DrawSortEntry* dst, size_t count,
+                         uint32 digit, const uint32* histogram)
+        {
+            uint32 offsets[kRadixBuckets];
+            uint32 running = 0;
+            for (uint32 bucket = 0; bucket < kRadixBuckets; ++bucket)
+            {
+                offsets[bucket] = running;
+                running += histogram[bucket];
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[offsets[KeyDigit(src[i].key, digit)]++] = src[i];
+            }
+        }
+
+        void ParallelScatterPass(const DrawSortEntry* src, DrawSortEntry* dst, size_t count,
+                                 uint32 digit, size_t chunkCount, std::vector<uint32>& chunkCounts)
+        {
+            const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+            chunkCounts.assign(chunkCount * kRadixBuckets, 0);
+
+            JobSystem& jobs = JobSystem::Get();
+            jobs.ParallelFor(0, chunkCount, [&](size_t chunk)
+            {
+                uint32* counts = chunkCounts.data() + chunk * kRadixBuckets;
+                const size_t end = std::min(count, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    ++counts[KeyDigit(src[i].key, digit)];
+                }
+            }, 1);
+
+            // Turn counts into write offsets: bucket-major, then chunk order, which keeps the pass stable
+            uint32 running = 0;
+            for (uint32 bucket = 0; bucket < kRadixBuckets; ++bucket)
+            {
+                for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+                {
+                    uint32& slot = chunkCounts[chunk * kRadixBuckets + bucket];
+                    const uint32 bucketCount = slot;
+                    slot = running;
+                    running += bucketCount;
+                }
+            }
+
+            jobs.ParallelFor(0, chunkCount, [&](size_t chunk)
+            {
+                uint32* offsets = chunkCounts.data() + chunk * kRadixBuckets;
+                const size_t end = std::min(count, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    dst[offsets[KeyDigit(src[i].key, digit)]++] = src[i];
+                }
+            }, 1);
+        }
+    } // namespace
+
+    void RadixSortDrawEntries(std::vector<DrawSortEntry>& entries, DrawSortScratch& scratch)
+    {
+        const size_t count = entries.size();
+        if (count <= kInsertionSortThreshold)
+        {
+            InsertionSort(entries);
+            return;
+        }
+
+        // One read pass builds every digit's histogram; digits with a single bucket are skipped
+        uint32 histograms[kKeyDigits][kRadixBuckets] = {};
+        for (const DrawSortEntry& entry : entries)
+        {
+            for (uint32 digit = 0; digit < kKeyDigits; ++digit)
+            {
+                ++histograms[digit][KeyDigit(entry.key, digit)];
+            }
+        }
+
+        const size_t workerCount = JobSystem::Get().GetWorkerCount();
+        const size_t chunkCount = workerCount > 1
+            ? std::min(workerCount, count / kMinEntriesPerChunk)
+            : 1;
+
+        scratch.buffer.resize(count);
+        DrawSortEntry* src = entries.data();
+        DrawSortEntry* dst = scratch.buffer.data();
+        bool inScratch = false;
+
+        for (uint32 digit = 0; digit < kKeyDigits; ++digit)
+        {
+            if (histograms[digit][KeyDigit(src[0].key, digit)] == count)
+                continue;
+
+            if (chunkCount > 1)
+            {
+                ParallelScatterPass(src, dst, count, digit, chunkCount, scratch.chunkCounts);
+            }
+            else
+            {
+                ScatterPass(src, dst, count, digit, histograms[digit]);
+            }
+
+            std::swap(src, dst);
+            inScratch = !inScratch;
+        }
+
+        // Hand the sorted storage back without copying; the old buffer becomes scratch
+        if (inScratch)
+        {
+            entries.swap(scratch.buffer);
+        }
+    }
+
+    uint64 HashDrawSortBits(uint64 value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    uint32 QuantizeDrawSortDepth(float depth)
+    {
+        if (!std::isfinite(depth) || depth <= 0.0f)
+            return 0;
+
+        // Positive IEEE floats compare like their bit patterns; the sign bit is always clear here
+        return std::bit_cast<uint32>(depth);
+    }
+
+} // namespace RVX
@@ -1,37 +1,57 @@
 #include "Render/Renderer/RenderDrawItem.h"
 
-#include <algorithm>
-#include <cmath>
-#include <limits>
-
 namespace RVX
 {
     namespace
     {
-        uint64 MixSortBits(uint64 value)
+        constexpr uint32 kPassShift = 62;
+
+        uint64 FieldBits(uint64 value, uint32 bitCount)
         {
-            value ^= value >> 33;
-            value *= 0xff51afd7ed558ccdULL;
-            value ^= value >> 33;
-            value *= 0xc4ceb9fe1a85ec53ULL;
-            value ^= value >> 33;
-            return value;
+            return value & ((1ULL << bitCount) - 1);
         }
     } // namespace
 
-    uint64 BuildOpaqueDrawSortKey(const RenderDrawItem& item)
+    uint64 BuildDrawSortKey(const RenderDrawItem& item)
     {
-        const uint64 materialBits = MixSortBits(item.materialId) & 0xFFFF'FFFFULL;
-        const uint64 meshBits = MixSortBits(item.meshId) & 0xFFFF'0000ULL;
-        return (materialBits << 32) | meshBits | static_cast<uint64>(item.submeshIndex);
+        const uint64 pass = static_cast<uint64>(item.renderMode) << kPassShift;
+        const uint64 material = HashDrawSortBits(item.materialId);
+        const uint32 depth = QuantizeDrawSortDepth(item.depthFromCamera);
+
+        if (item.renderMode == MaterialRenderMode::Transparent)
+        {
+            const uint64 backToFront = FieldBits(~(depth >> 1), 30);
+            const uint64 mesh = HashDrawSortBits(item.meshId);
+            return pass | (backToFront << 32) | (FieldBits(material, 24) << 8) | FieldBits(mesh, 8);
+        }
+
+        const uint64 mesh = HashDrawSortBits(item.meshId ^ (static_cast<uint64>(item.submeshIndex) << 48));
+        const uint64 frontToBack = depth >> 9;
+        return pass | (FieldBits(material, 24) << 38) | (FieldBits(mesh, 16) << 22) | frontToBack;
     }
 
-    uint64 BuildTransparentDrawSortKey(const RenderDrawItem& item)
+    void SortDrawItems(std::vector<RenderDrawItem>& items,
+                       DrawSortScratch& scratch,
+                       std::vector<RenderDrawItem>& itemScratch)
     {
-        const float safeDepth = std::isfinite(item.depthFromCamera) ? item.depthFromCamera : 0.0f;
-        const float clampedDepth = std::clamp(safeDepth, 0.0f, 1000000.0f);
-        const uint64 depthBits = static_cast<uint64>(clampedDepth * 1000.0f);
-        return (depthBits << 24) | (MixSortBits(item.materialId) & 0x00FF'FFFFULL);
+        if (items.size() < 2)
+            return;
+
+        scratch.entries.resize(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            scratch.entries[i] = {items[i].sortKey, static_cast<uint32>(i)};
+        }
+
+        RadixSortDrawEntries(scratch.entries, scratch);
+
+        // Gather into scratch rather than permuting in place; draw items are too large to swap around
+        itemScratch.resize(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            itemScratch[i] = items[scratch.entries[i].index];
+        }
+        items.swap(itemScratch);
     }
 
 } // namespace RVX
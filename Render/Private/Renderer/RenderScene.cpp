@@ -6,16 +6,62 @@
 #include "Render/Renderer/RenderScene.h"
 #include "RenderSceneCollector.h"
 #include "Runtime/Camera/Camera.h"
+#include "Core/Assert.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Math/Frustum.h"
 #include "Core/Log.h"
+#include "Geometry/Batch/BatchIntersect.h"
 #include <algorithm>
 
 namespace RVX
 {
 
+namespace
+{
+    /// Below this many retained objects per partition, culling stays on the calling thread
+    constexpr size_t kMinObjectsPerPartition = 4096;
+
+    /// Spread the low 10 bits of v so there are two zero bits between each
+    uint32_t ExpandMortonBits(uint32_t v)
+    {
+        v &= 0x3FF;
+        v = (v | (v << 16)) & 0x030000FF;
+        v = (v | (v << 8)) & 0x0300F00F;
+        v = (v | (v << 4)) & 0x030C30C3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    }
+
+    uint32_t LaneFlagMask(const uint8_t (&flags)[4], uint8_t requiredFlag)
+    {
+        uint32_t mask = 0;
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if (flags[lane] & requiredFlag)
+                mask |= 1u << lane;
+        }
+        return mask;
+    }
+
+    template<typename Bounds>
+    Geometry::SIMD::BatchAABB4 LoadBatch(const Bounds& bounds)
+    {
+        using Geometry::SIMD::Float4;
+
+        Geometry::SIMD::BatchAABB4 batch;
+        batch.minX = Float4::LoadAligned(bounds.minX);
+        batch.minY = Float4::LoadAligned(bounds.minY);
+        batch.minZ = Float4::LoadAligned(bounds.minZ);
+        batch.maxX = Float4::LoadAligned(bounds.maxX);
+        batch.maxY = Float4::LoadAligned(bounds.maxY);
+        batch.maxZ = Float4::LoadAligned(bounds.maxZ);
+        return batch;
+    }
+} // namespace
+
 void RenderScene::Clear()
 {
-    m_objects.clear();
+    ResetRetained();
     m_lights.clear();
 }
 
@@ -24,51 +70,480 @@ void RenderScene::CollectFromWorld(World* world)
     RenderSceneCollector::Collect(*this, world);
 }
 
-void RenderScene::CullAgainstCamera(const Camera& camera, std::vector<uint32_t>& outVisibleIndices) const
+void RenderScene::AddObject(const RenderObject& obj)
+{
+    m_objects.push_back(obj);
+    m_objectBounds.push_back(obj.bounds);
+    m_objectFlags.push_back(static_cast<uint8_t>((obj.visible ? CullFlagVisible : 0) |
+                                                 (obj.castsShadow ? CullFlagCastsShadow : 0)));
+}
+
+// =============================================================================
+// Retained Objects
+// =============================================================================
+
+RenderObject& RenderScene::AcquireRetainedObject(uint32_t renderId)
+{
+    if (renderId >= m_primitiveRecords.size())
+    {
+        m_primitiveRecords.resize(renderId + 1);
+    }
+
+    PrimitiveRecord& record = m_primitiveRecords[renderId];
+    if (record.objectIndex != InvalidObjectIndex)
+    {
+        return m_objects[record.objectIndex];
+    }
+
+    // Retained objects are only added while the transient tail is empty
+    RVX_ASSERT(m_objects.size() == m_retainedObjectCount);
+
+    record.objectIndex = static_cast<uint32_t>(m_retainedObjectCount++);
+    m_objects.emplace_back();
+    m_objectBounds.emplace_back();
+    m_objectFlags.push_back(0);
+    m_objectRenderIds.push_back(renderId);
+    m_cullHierarchyDirty = true;
+    return m_objects.back();
+}
+
+void RenderScene::ReleaseRetainedObject(uint32_t renderId)
+{
+    if (renderId >= m_primitiveRecords.size())
+        return;
+
+    PrimitiveRecord& record = m_primitiveRecords[renderId];
+    if (record.objectIndex == InvalidObjectIndex)
+        return;
+
+    RVX_ASSERT(m_objects.size() == m_retainedObjectCount);
+
+    // Swap-remove keeps retained objects dense
+    const uint32_t index = record.objectIndex;
+    const uint32_t last = static_cast<uint32_t>(m_retainedObjectCount - 1);
+    if (index != last)
+    {
+        std::swap(m_objects[index], m_objects[last]);
+        m_objectBounds[index] = m_objectBounds[last];
+        m_objectFlags[index] = m_objectFlags[last];
+        m_objectRenderIds[index] = m_objectRenderIds[last];
+        m_primitiveRecords[m_objectRenderIds[index]].objectIndex = index;
+    }
+
+    m_objects.pop_back();
+    m_objectBounds.pop_back();
+    m_objectFlags.pop_back();
+    m_objectRenderIds.pop_back();
+    --m_retainedObjectCount;
+    record.objectIndex = InvalidObjectIndex;
+    m_cullHierarchyDirty = true;
+}
+
+void RenderScene::RefreshCullData(uint32_t objectIndex)
 {
-    outVisibleIndices.clear();
-    outVisibleIndices.reserve(m_objects.size());
+    const RenderObject& object = m_objects[objectIndex];
+    m_objectBounds[objectIndex] = object.bounds;
+    m_objectFlags[objectIndex] = static_cast<uint8_t>((object.visible ? CullFlagVisible : 0) |
+                                                      (object.castsShadow ? CullFlagCastsShadow : 0));
+
+    if (objectIndex < m_retainedObjectCount && !m_cullHierarchyDirty)
+    {
+        m_cullRefitObjects.push_back(objectIndex);
+    }
+}
+
+void RenderScene::ResetRetained()
+{
+    m_objects.clear();
+    m_objectBounds.clear();
+    m_objectFlags.clear();
+
+    m_retainedObjectCount = 0;
+    m_objectRenderIds.clear();
+    m_primitiveRecords.clear();
+    m_pendingRenderIds.clear();
+    m_primitiveOwnerCounts.clear();
+    m_changeEpoch = 0;
+    m_lastExtractedCount = 0;
+
+    m_cullPackets.clear();
+    m_cullGroups.clear();
+    m_cullSlots.clear();
+    m_cullRefitObjects.clear();
+    m_cullClusterDirty.clear();
+    m_cullRefitsSinceBuild = 0;
+    m_cullHierarchyDirty = false;
+}
+
+void RenderScene::ResetTransient()
+{
+    m_objects.resize(m_retainedObjectCount);
+    m_objectBounds.resize(m_retainedObjectCount);
+    m_objectFlags.resize(m_retainedObjectCount);
+    m_lights.clear();
+}
+
+// =============================================================================
+// Culling Hierarchy
+// =============================================================================
+
+void RenderScene::CullBounds4::SetLane(int lane, const AABB& box)
+{
+    minX[lane] = box.GetMin().x;
+    minY[lane] = box.GetMin().y;
+    minZ[lane] = box.GetMin().z;
+    maxX[lane] = box.GetMax().x;
+    maxY[lane] = box.GetMax().y;
+    maxZ[lane] = box.GetMax().z;
+}
+
+void RenderScene::CullBounds4::ClearLane(int lane)
+{
+    // Inverted box: every plane test rejects it
+    constexpr float INF = 1e30f;
+    minX[lane] = minY[lane] = minZ[lane] = INF;
+    maxX[lane] = maxY[lane] = maxZ[lane] = -INF;
+}
+
+void RenderScene::UpdateCullHierarchy()
+{
+    // Refits loosen clusters as objects drift apart; rebuild once the scene has churned through
+    if (m_cullHierarchyDirty || m_cullRefitsSinceBuild > 2 * m_retainedObjectCount)
+    {
+        BuildCullHierarchy();
+        m_cullRefitObjects.clear();
+        return;
+    }
+
+    for (uint32_t objectIndex : m_cullRefitObjects)
+    {
+        const uint32_t slot = m_cullSlots[objectIndex];
+        WriteCullSlot(slot, objectIndex);
+        m_cullClusterDirty[slot / (CullClusterPackets * 4)] = 1;
+    }
+
+    for (uint32_t objectIndex : m_cullRefitObjects)
+    {
+        const uint32_t cluster = m_cullSlots[objectIndex] / (CullClusterPackets * 4);
+        if (m_cullClusterDirty[cluster])
+        {
+            RefitCullCluster(cluster);
+            m_cullClusterDirty[cluster] = 0;
+        }
+    }
+
+    m_cullRefitsSinceBuild += m_cullRefitObjects.size();
+    m_cullRefitObjects.clear();
+}
+
+void RenderScene::BuildCullHierarchy()
+{
+    const uint32_t objectCount = static_cast<uint32_t>(m_retainedObjectCount);
+
+    // Order objects along a Morton curve so packets and clusters are spatially compact
+    AABB centerBounds;
+    for (uint32_t i = 0; i < objectCount; ++i)
+    {
+        if (m_objectBounds[i].IsValid())
+        {
+            centerBounds.Expand(m_objectBounds[i].GetCenter());
+        }
+    }
+
+    const Vec3 origin = centerBounds.IsValid() ? centerBounds.GetMin() : Vec3(0.0f);
+    const Vec3 extent = centerBounds.IsValid() ? centerBounds.GetSize() : Vec3(0.0f);
+    const Vec3 scale(extent.x > 0.0f ? 1023.0f / extent.x : 0.0f,
+                     extent.y > 0.0f ? 1023.0f / extent.y : 0.0f,
+                     extent.z > 0.0f ? 1023.0f / extent.z : 0.0f);
+
+    m_cullSortKeys.resize(objectCount);
+    for (uint32_t i = 0; i < objectCount; ++i)
+    {
+        uint32_t code = 0;
+        if (m_objectBounds[i].IsValid())
+        {
+            const Vec3 q = (m_objectBounds[i].GetCenter() - origin) * scale;
+            code = (ExpandMortonBits(static_cast<uint32_t>(q.x)) << 2) |
+                   (ExpandMortonBits(static_cast<uint32_t>(q.y)) << 1) |
+                   ExpandMortonBits(static_cast<uint32_t>(q.z));
+        }
+        m_cullSortKeys[i] = (static_cast<uint64_t>(code) << 32) | i;
+    }
+    std::sort(m_cullSortKeys.begin(), m_cullSortKeys.end());
 
+    const uint32_t packetCount = (objectCount + 3) / 4;
+    m_cullPackets.resize(packetCount);
+    m_cullSlots.resize(objectCount);
+    for (uint32_t slot = 0; slot < objectCount; ++slot)
+    {
+        const uint32_t objectIndex = static_cast<uint32_t>(m_cullSortKeys[slot]);
+        m_cullSlots[objectIndex] = slot;
+        WriteCullSlot(slot, objectIndex);
+    }
+    for (uint32_t slot = objectCount; slot < packetCount * 4; ++slot)
+    {
+        CullPacket& packet = m_cullPackets[slot / 4];
+        packet.bounds.ClearLane(slot % 4);
+        packet.objectIndex[slot % 4] = InvalidObjectIndex;
+        packet.flags[slot % 4] = 0;
+    }
+
+    const uint32_t clusterCount = (packetCount + CullClusterPackets - 1) / CullClusterPackets;
+    m_cullGroups.resize((clusterCount + 3) / 4);
+    m_cullClusterDirty.assign(clusterCount, 0);
+    for (uint32_t cluster = 0; cluster < m_cullGroups.size() * 4; ++cluster)
+    {
+        RefitCullCluster(cluster);
+    }
+
+    m_cullRefitsSinceBuild = 0;
+    m_cullHierarchyDirty = false;
+}
+
+void RenderScene::WriteCullSlot(uint32_t slot, uint32_t objectIndex)
+{
+    CullPacket& packet = m_cullPackets[slot / 4];
+    const int lane = static_cast<int>(slot % 4);
+    const AABB& bounds = m_objectBounds[objectIndex];
+
+    // Invalid bounds are never visible (Frustum::Intersects reports them outside)
+    if (bounds.IsValid())
+    {
+        packet.bounds.SetLane(lane, bounds);
+        packet.flags[lane] = m_objectFlags[objectIndex];
+    }
+    else
+    {
+        packet.bounds.ClearLane(lane);
+        packet.flags[lane] = 0;
+    }
+    packet.objectIndex[lane] = objectIndex;
+}
+
+void RenderScene::RefitCullCluster(uint32_t cluster)
+{
+    AABB bounds;
+    uint8_t flags = 0;
+
+    const size_t firstPacket = static_cast<size_t>(cluster) * CullClusterPackets;
+    const size_t endPacket = std::min(firstPacket + CullClusterPackets, m_cullPackets.size());
+    for (size_t p = firstPacket; p < endPacket; ++p)
+    {
+        const CullPacket& packet = m_cullPackets[p];
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if (!packet.flags[lane])
+                continue;
+
+            bounds.Expand(AABB(
+                Vec3(packet.bounds.minX[lane], packet.bounds.minY[lane], packet.bounds.minZ[lane]),
+                Vec3(packet.bounds.maxX[lane], packet.bounds.maxY[lane], packet.bounds.maxZ[lane])));
+            flags |= packet.flags[lane];
+        }
+    }
+
+    CullClusterGroup& group = m_cullGroups[cluster / 4];
+    const int lane = static_cast<int>(cluster % 4);
+    if (flags)
+    {
+        group.bounds.SetLane(lane, bounds);
+    }
+    else
+    {
+        group.bounds.ClearLane(lane);
+    }
+    group.flags[lane] = flags;
+}
+
+// =============================================================================
+// Culling
+// =============================================================================
+
+void RenderScene::CullAgainstCamera(const Camera& camera, std::vector<uint32_t>& outVisibleIndices) const
+{
     // Extract frustum from camera
     Frustum frustum;
     frustum.ExtractFromMatrix(camera.GetViewProjection());
 
-    for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i)
+    CullFrustum(frustum, outVisibleIndices, CullFilter::Visible);
+}
+
+void RenderScene::CullFrustum(const Frustum& frustum,
+                              std::vector<uint32_t>& outVisibleIndices,
+                              CullFilter filter) const
+{
+    CullFrustums(std::span<const Frustum>(&frustum, 1),
+                 std::span<std::vector<uint32_t>>(&outVisibleIndices, 1),
+                 filter);
+}
+
+void RenderScene::CullFrustums(std::span<const Frustum> frustums,
+                               std::span<std::vector<uint32_t>> outVisibleIndices,
+                               CullFilter filter) const
+{
+    RVX_ASSERT(frustums.size() == outVisibleIndices.size());
+    const size_t viewCount = std::min(frustums.size(), outVisibleIndices.size());
+    if (viewCount == 0)
+        return;
+
+    const uint8_t requiredFlag = filter == CullFilter::Visible ? CullFlagVisible : CullFlagCastsShadow;
+
+    // Retained objects: each partition writes into its own region of the output
+    // (sized for the worst case), then the regions are compacted in order.
+    const uint32_t groupCount = static_cast<uint32_t>(m_cullGroups.size());
+    for (size_t v = 0; v < viewCount; ++v)
     {
-        const RenderObject& obj = m_objects[i];
-        
-        if (!obj.visible)
+        outVisibleIndices[v].resize(static_cast<size_t>(groupCount) * CullGroupObjects);
+    }
+
+    JobSystem& jobs = JobSystem::Get();
+    size_t partitionCount = std::min(jobs.GetWorkerCount() * 2,
+                                     m_retainedObjectCount / kMinObjectsPerPartition);
+    partitionCount = std::clamp<size_t>(partitionCount, 1, std::max<uint32_t>(groupCount, 1));
+    const uint32_t groupsPerPartition =
+        static_cast<uint32_t>((groupCount + partitionCount - 1) / partitionCount);
+
+    std::vector<uint32_t> counts(partitionCount * viewCount, 0);
+    auto cullPartition = [&](size_t partition)
+    {
+        const uint32_t firstGroup = static_cast<uint32_t>(partition) * groupsPerPartition;
+        const uint32_t endGroup = std::min(firstGroup + groupsPerPartition, groupCount);
+        if (firstGroup < endGroup)
+        {
+            CullRetainedGroups(frustums.first(viewCount), firstGroup, endGroup, requiredFlag,
+                               outVisibleIndices.data(), &counts[partition * viewCount]);
+        }
+    };
+
+    if (partitionCount > 1)
+    {
+        jobs.ParallelFor(0, partitionCount, cullPartition, 1);
+    }
+    else
+    {
+        cullPartition(0);
+    }
+
+    for (size_t v = 0; v < viewCount; ++v)
+    {
+        auto& out = outVisibleIndices[v];
+        size_t write = 0;
+        for (size_t partition = 0; partition < partitionCount; ++partition)
+        {
+            const size_t read = partition * groupsPerPartition * CullGroupObjects;
+            const uint32_t count = counts[partition * viewCount + v];
+            if (read != write)
+            {
+                std::copy(out.begin() + read, out.begin() + read + count, out.begin() + write);
+            }
+            write += count;
+        }
+        out.resize(write);
+    }
+
+    // Transient objects are few; test them 4 at a time straight from the SoA arrays
+    for (size_t first = m_retainedObjectCount; first < m_objectBounds.size(); first += 4)
+    {
+        const int count = static_cast<int>(std::min<size_t>(4, m_objectBounds.size() - first));
+
+        uint32_t laneMask = 0;
+        for (int lane = 0; lane < count; ++lane)
+        {
+            if ((m_objectFlags[first + lane] & requiredFlag) && m_objectBounds[first + lane].IsValid())
+                laneMask |= 1u << lane;
+        }
+        if (!laneMask)
             continue;
 
-        if (frustum.IsVisible(obj.bounds))
+        Geometry::SIMD::BatchAABB4 batch;
+        batch.Load(&m_objectBounds[first], count);
+
+        for (size_t v = 0; v < viewCount; ++v)
         {
-            outVisibleIndices.push_back(i);
+            uint32_t insideMask = 0;
+            const uint32_t hitMask = Geometry::SIMD::FrustumBatchAABBTest(frustums[v], batch, insideMask) & laneMask;
+            for (int lane = 0; lane < count; ++lane)
+            {
+                if (hitMask & (1u << lane))
+                    outVisibleIndices[v].push_back(static_cast<uint32_t>(first + lane));
+            }
         }
     }
 }
 
-void RenderScene::SortVisibleObjects(std::vector<uint32_t>& visibleIndices, const Vec3& cameraPosition) const
+void RenderScene::CullRetainedGroups(std::span<const Frustum> frustums, uint32_t firstGroup, uint32_t endGroup,
+                                     uint8_t requiredFlag, std::vector<uint32_t>* outLists, uint32_t* outCounts) const
 {
-    // Sort by material/mesh for batching, with depth as secondary sort
-    std::sort(visibleIndices.begin(), visibleIndices.end(),
-        [this, &cameraPosition](uint32_t a, uint32_t b)
+    for (size_t v = 0; v < frustums.size(); ++v)
+    {
+        const Frustum& frustum = frustums[v];
+        uint32_t* out = outLists[v].data() + static_cast<size_t>(firstGroup) * CullGroupObjects;
+        uint32_t count = 0;
+
+        for (uint32_t g = firstGroup; g < endGroup; ++g)
         {
-            const RenderObject& objA = m_objects[a];
-            const RenderObject& objB = m_objects[b];
-
-            // Primary sort: by sort key (material + mesh hash)
-            if (objA.sortKey != objB.sortKey)
-                return objA.sortKey < objB.sortKey;
-
-            // Secondary sort: front-to-back for opaque objects
-            Vec3 centerA = objA.bounds.GetCenter();
-            Vec3 centerB = objB.bounds.GetCenter();
-            Vec3 diffA = centerA - cameraPosition;
-            Vec3 diffB = centerB - cameraPosition;
-            float distA = dot(diffA, diffA);  // length squared
-            float distB = dot(diffB, diffB);
-            return distA < distB;
-        });
+            const CullClusterGroup& group = m_cullGroups[g];
+            const uint32_t groupMask = LaneFlagMask(group.flags, requiredFlag);
+            if (!groupMask)
+                continue;
+
+            uint32_t clustersInside = 0;
+            const uint32_t clusterMask =
+                Geometry::SIMD::FrustumBatchAABBTest(frustum, LoadBatch(group.bounds), clustersInside) & groupMask;
+
+            for (int clusterLane = 0; clusterLane < 4; ++clusterLane)
+            {
+                if (!(clusterMask & (1u << clusterLane)))
+                    continue;
+
+                // A fully inside cluster accepts its objects without testing them
+                const bool inside = (clustersInside & (1u << clusterLane)) != 0;
+                const size_t firstPacket = (static_cast<size_t>(g) * 4 + clusterLane) * CullClusterPackets;
+                const size_t endPacket = std::min(firstPacket + CullClusterPackets, m_cullPackets.size());
+
+                for (size_t p = firstPacket; p < endPacket; ++p)
+                {
+                    const CullPacket& packet = m_cullPackets[p];
+                    uint32_t hitMask = LaneFlagMask(packet.flags, requiredFlag);
+                    if (hitMask && !inside)
+                    {
+                        uint32_t insideMask = 0;
+                        hitMask &= Geometry::SIMD::FrustumBatchAABBTest(frustum, LoadBatch(packet.bounds), insideMask);
+                    }
+
+                    for (int lane = 0; lane < 4; ++lane)
+                    {
+                        if (hitMask & (1u << lane))
+                            out[count++] = packet.objectIndex[lane];
+                    }
+                }
+            }
+        }
+
+        outCounts[v] = count;
+    }
+}
+
+void RenderScene::SortVisibleObjects(std::vector<uint32_t>& visibleIndices, const Vec3& cameraPosition) const
+{
+    // Sort by material/mesh for batching, with depth as secondary sort.
+    // Key: hashed object sort key (40 bits) | bounds-center distance (24 bits)
+    m_visibleSortScratch.entries.resize(visibleIndices.size());
+    for (size_t i = 0; i < visibleIndices.size(); ++i)
+    {
+        const RenderObject& obj = m_objects[visibleIndices[i]];
+        const float distance = length(obj.bounds.GetCenter() - cameraPosition);
+        const uint64_t batchBits = HashDrawSortBits(obj.sortKey) & 0xFF'FFFF'FFFFULL;
+        const uint64_t depthBits = QuantizeDrawSortDepth(distance) >> 7;
+        m_visibleSortScratch.entries[i] = {(batchBits << 24) | depthBits, visibleIndices[i]};
+    }
+
+    RadixSortDrawEntries(m_visibleSortScratch.entries, m_visibleSortScratch);
+
+    for (size_t i = 0; i < visibleIndices.size(); ++i)
+    {
+        visibleIndices[i] = m_visibleSortScratch.entries[i].index;
+    }
 }
 
 } // namespace RVX
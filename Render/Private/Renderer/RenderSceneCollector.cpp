@@ -16,21 +16,23 @@
 
 #include <glm/gtc/matrix_inverse.hpp>
 
+#include <algorithm>
+
 namespace RVX
 {
 
 void RenderSceneCollector::Collect(RenderScene& outScene, World* world)
 {
-    outScene.Clear();
-
-    if (!world)
-        return;
-
-    SceneManager* sceneManager = world->GetSceneManager();
+    SceneManager* sceneManager = world ? world->GetSceneManager() : nullptr;
     if (!sceneManager)
+    {
+        outScene.Clear();
         return;
+    }
 
-    const auto primitiveControlledEntities = CollectRegisteredPrimitives(outScene, sceneManager);
+    outScene.ResetTransient();
+    SyncPrimitives(outScene, sceneManager);
+    outScene.UpdateCullHierarchy();
 
     const auto& entities = sceneManager->GetEntities();
     for (const auto& [handle, entity] : entities)
@@ -38,53 +40,163 @@ void RenderSceneCollector::Collect(RenderScene& outScene, World* world)
         (void)handle;
         if (entity && entity->IsRoot())
         {
-            CollectEntity(outScene, entity.get(), Mat4Identity(), primitiveControlledEntities);
+            CollectEntity(outScene, entity.get(), Mat4Identity());
         }
     }
 }
 
-std::unordered_set<SceneEntity::Handle> RenderSceneCollector::CollectRegisteredPrimitives(
-    RenderScene& outScene,
-    SceneManager* sceneManager)
+void RenderSceneCollector::SyncPrimitives(RenderScene& outScene, SceneManager* sceneManager)
 {
-    std::unordered_set<SceneEntity::Handle> primitiveControlledEntities;
-    if (!sceneManager)
-        return primitiveControlledEntities;
+    outScene.m_lastExtractedCount = 0;
+
+    const bool incremental = sceneManager->ConsumePrimitiveRenderChanges(
+        outScene.m_changeEpoch, outScene.m_removedRenderIds, outScene.m_dirtyPrimitives);
+
+    if (!incremental)
+    {
+        // First sync, or another scene drained the queue: rebuild from the registry
+        const uint64 epoch = outScene.m_changeEpoch;
+        outScene.ResetRetained();
+        outScene.m_changeEpoch = epoch;
+
+        for (PrimitiveComponent* primitive : sceneManager->GetPrimitives())
+        {
+            UpdatePrimitive(outScene, primitive);
+        }
+        return;
+    }
 
-    for (PrimitiveComponent* primitive : sceneManager->GetPrimitives())
+    // Removals first: a freed render id may already be reused by a dirty primitive
+    for (uint32 renderId : outScene.m_removedRenderIds)
     {
-        if (!primitive || !primitive->HasRenderData())
-            continue;
+        RemovePrimitive(outScene, renderId);
+    }
+
+    for (PrimitiveComponent* primitive : outScene.m_dirtyPrimitives)
+    {
+        UpdatePrimitive(outScene, primitive);
+    }
+
+    PollPendingPrimitives(outScene, sceneManager);
+}
+
+void RenderSceneCollector::UpdatePrimitive(RenderScene& outScene, PrimitiveComponent* primitive)
+{
+    if (!primitive || primitive->GetRenderId() == PrimitiveComponent::InvalidRenderId)
+        return;
 
-        auto* entity = dynamic_cast<SceneEntity*>(primitive->GetOwner());
-        if (!entity || !entity->IsActive())
-            continue;
+    const uint32 renderId = primitive->GetRenderId();
+    if (renderId >= outScene.m_primitiveRecords.size())
+    {
+        outScene.m_primitiveRecords.resize(renderId + 1);
+    }
 
-        primitiveControlledEntities.insert(entity->GetHandle());
+    auto* entity = dynamic_cast<SceneEntity*>(primitive->GetOwner());
+    const bool ownerActive = entity && entity->IsActive();
+    const bool hasRenderData = ownerActive && primitive->HasRenderData();
 
-        if (!primitive->IsEnabled() || !primitive->IsVisible())
+    // Owner bookkeeping decides whether the legacy MeshRenderer path is suppressed
+    {
+        auto& record = outScene.m_primitiveRecords[renderId];
+        const uint64 ownerId = entity ? entity->GetHandle() : 0;
+        if (record.controlsOwner && (!hasRenderData || record.ownerId != ownerId))
+        {
+            auto it = outScene.m_primitiveOwnerCounts.find(record.ownerId);
+            if (it != outScene.m_primitiveOwnerCounts.end() && --it->second == 0)
+            {
+                outScene.m_primitiveOwnerCounts.erase(it);
+            }
+            record.controlsOwner = false;
+        }
+        if (hasRenderData && !record.controlsOwner)
         {
-            continue;
+            ++outScene.m_primitiveOwnerCounts[ownerId];
+            record.controlsOwner = true;
         }
+        record.ownerId = ownerId;
 
-        primitive->CollectRenderData(outScene);
+        // Mesh loading does not notify the scene, so poll until render data shows up
+        const bool pending = ownerActive && !hasRenderData;
+        if (pending && !record.pending)
+        {
+            outScene.m_pendingRenderIds.push_back(renderId);
+        }
+        record.pending = pending;
+    }
+
+    if (!hasRenderData || !primitive->IsEnabled() || !primitive->IsVisible())
+    {
+        outScene.ReleaseRetainedObject(renderId);
+        return;
     }
 
-    return primitiveControlledEntities;
+    RenderObject& object = outScene.AcquireRetainedObject(renderId);
+    primitive->ExtractRenderObject(object);
+    outScene.RefreshCullData(outScene.m_primitiveRecords[renderId].objectIndex);
+    outScene.m_lastExtractedCount++;
+}
+
+void RenderSceneCollector::RemovePrimitive(RenderScene& outScene, uint32 renderId)
+{
+    if (renderId >= outScene.m_primitiveRecords.size())
+        return;
+
+    outScene.ReleaseRetainedObject(renderId);
+
+    auto& record = outScene.m_primitiveRecords[renderId];
+    if (record.controlsOwner)
+    {
+        auto it = outScene.m_primitiveOwnerCounts.find(record.ownerId);
+        if (it != outScene.m_primitiveOwnerCounts.end() && --it->second == 0)
+        {
+            outScene.m_primitiveOwnerCounts.erase(it);
+        }
+    }
+
+    if (record.pending)
+    {
+        auto& pendingIds = outScene.m_pendingRenderIds;
+        pendingIds.erase(std::remove(pendingIds.begin(), pendingIds.end(), renderId), pendingIds.end());
+    }
+
+    record = RenderScene::PrimitiveRecord{};
+}
+
+void RenderSceneCollector::PollPendingPrimitives(RenderScene& outScene, SceneManager* sceneManager)
+{
+    auto& pendingIds = outScene.m_pendingRenderIds;
+
+    size_t writeIndex = 0;
+    for (size_t readIndex = 0; readIndex < pendingIds.size(); ++readIndex)
+    {
+        const uint32 renderId = pendingIds[readIndex];
+        auto& record = outScene.m_primitiveRecords[renderId];
+        PrimitiveComponent* primitive = sceneManager->GetPrimitiveByRenderId(renderId);
+        if (primitive && primitive->HasRenderData())
+        {
+            record.pending = false;
+            UpdatePrimitive(outScene, primitive);
+        }
+
+        if (record.pending)
+        {
+            pendingIds[writeIndex++] = renderId;
+        }
+    }
+    pendingIds.resize(writeIndex);
 }
 
 void RenderSceneCollector::CollectEntity(
     RenderScene& outScene,
     SceneEntity* entity,
-    const Mat4& parentMatrix,
-    const std::unordered_set<SceneEntity::Handle>& primitiveControlledEntities)
+    const Mat4& parentMatrix)
 {
     if (!entity || !entity->IsActive())
         return;
 
     Mat4 worldMatrix = parentMatrix * entity->GetLocalMatrix();
 
-    if (primitiveControlledEntities.find(entity->GetHandle()) == primitiveControlledEntities.end())
+    if (outScene.m_primitiveOwnerCounts.find(entity->GetHandle()) == outScene.m_primitiveOwnerCounts.end())
     {
         if (auto* renderer = entity->GetComponent<MeshRendererComponent>())
         {
@@ -154,7 +266,7 @@ void RenderSceneCollector::CollectEntity(
 
     for (auto* child : entity->GetChildren())
     {
-        CollectEntity(outScene, child, worldMatrix, primitiveControlledEntities);
+        CollectEntity(outScene, child, worldMatrix);
     }
 }
 
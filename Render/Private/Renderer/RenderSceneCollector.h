@@ -2,22 +2,24 @@
 
 /**
  * @file RenderSceneCollector.h
- * @brief Collects renderable data from World/Scene into RenderScene snapshots
+ * @brief Synchronizes renderable data from World/Scene into a RenderScene
  */
 
 #include "Core/MathTypes.h"
 #include "Scene/SceneEntity.h"
 
-#include <unordered_set>
-
 namespace RVX
 {
+    class PrimitiveComponent;
     class RenderScene;
     class SceneManager;
     class World;
 
     /**
      * @brief Converts scene entities and components into render-thread friendly data.
+     *
+     * Primitive components are synchronized incrementally from the
+     * SceneManager's change queue; legacy entity components are re-walked.
      */
     class RenderSceneCollector
     {
@@ -25,13 +27,13 @@ namespace RVX
         static void Collect(RenderScene& outScene, World* world);
 
     private:
-        static std::unordered_set<SceneEntity::Handle> CollectRegisteredPrimitives(
-            RenderScene& outScene,
-            SceneManager* sceneManager);
+        static void SyncPrimitives(RenderScene& outScene, SceneManager* sceneManager);
+        static void UpdatePrimitive(RenderScene& outScene, PrimitiveComponent* primitive);
+        static void RemovePrimitive(RenderScene& outScene, uint32 renderId);
+        static void PollPendingPrimitives(RenderScene& outScene, SceneManager* sceneManager);
         static void CollectEntity(RenderScene& outScene,
                                   SceneEntity* entity,
-                                  const Mat4& parentMatrix,
-                                  const std::unordered_set<SceneEntity::Handle>& primitiveControlledEntities);
+                                  const Mat4& parentMatrix);
     };
 
 } // namespace RVX
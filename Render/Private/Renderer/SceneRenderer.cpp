@@ -15,13 +15,21 @@
 #include "Renderer/RenderFrameResourceBinder.h"
 #include "Renderer/RenderPassRegistry.h"
 #include "Runtime/Camera/Camera.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Log.h"
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 
 namespace RVX
 {
 
+namespace
+{
+    // Beyond this, command list overhead outweighs the extra recording threads
+    constexpr size_t MaxParallelRecordingContexts = 8;
+} // namespace
+
 SceneRenderer::SceneRenderer() = default;
 
 SceneRenderer::~SceneRenderer()
@@ -226,7 +234,12 @@ void SceneRenderer::SetupView(const Camera& camera, World* world)
     m_renderScene.CullAgainstCamera(camera, m_visibleObjectIndices);
 
     // Sort visible objects for optimal rendering
+    const auto sortStart = std::chrono::high_resolution_clock::now();
     m_renderScene.SortVisibleObjects(m_visibleObjectIndices, m_viewData.cameraPosition);
+    m_frameStats.visibleSortTimeMs = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - sortStart).count();
+    m_frameStats.visibleObjectCount = static_cast<uint32>(m_visibleObjectIndices.size());
+
     BuildMaterialDrawLists();
 
     // Mark visible meshes as used for GPU resource management
@@ -296,36 +309,32 @@ void SceneRenderer::BuildMaterialDrawLists()
             item.renderMode = mode;
             item.depthFromCamera = length(Vec3(obj.worldMatrix[3]) - m_viewData.cameraPosition);
 
+            item.sortKey = BuildDrawSortKey(item);
+
             if (mode == MaterialRenderMode::Transparent)
             {
-                item.sortKey = BuildTransparentDrawSortKey(item);
                 m_transparentDrawItems.push_back(item);
             }
             else if (mode == MaterialRenderMode::Masked)
             {
-                item.sortKey = BuildOpaqueDrawSortKey(item);
                 m_maskedDrawItems.push_back(item);
             }
             else
             {
-                item.sortKey = BuildOpaqueDrawSortKey(item);
                 m_opaqueDrawItems.push_back(item);
             }
         }
     }
 
-    const auto sortFrontToBack = [](const RenderDrawItem& lhs, const RenderDrawItem& rhs)
-    {
-        return lhs.sortKey < rhs.sortKey;
-    };
-    std::sort(m_opaqueDrawItems.begin(), m_opaqueDrawItems.end(), sortFrontToBack);
-    std::sort(m_maskedDrawItems.begin(), m_maskedDrawItems.end(), sortFrontToBack);
-
-    std::sort(m_transparentDrawItems.begin(), m_transparentDrawItems.end(),
-              [](const RenderDrawItem& lhs, const RenderDrawItem& rhs)
-              {
-                  return lhs.depthFromCamera > rhs.depthFromCamera;
-              });
+    // Opaque and masked keys sort front-to-back, transparent keys back-to-front
+    const auto sortStart = std::chrono::high_resolution_clock::now();
+    SortDrawItems(m_opaqueDrawItems, m_drawSortScratch, m_drawItemScratch);
+    SortDrawItems(m_maskedDrawItems, m_drawSortScratch, m_drawItemScratch);
+    SortDrawItems(m_transparentDrawItems, m_drawSortScratch, m_drawItemScratch);
+    m_frameStats.drawItemSortTimeMs = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - sortStart).count();
+    m_frameStats.drawItemCount = static_cast<uint32>(
+        m_opaqueDrawItems.size() + m_maskedDrawItems.size() + m_transparentDrawItems.size());
 }
 
 void SceneRenderer::Render()
@@ -379,9 +388,21 @@ void SceneRenderer::Render()
     // Compile the render graph (computes barriers, memory aliasing, pass culling)
     m_renderGraph->Compile();
 
-    // Execute through RenderGraph for automatic barrier management
+    // Execute through RenderGraph for automatic barrier management. With job
+    // workers available the passes are recorded into several contexts at once.
     RHICommandContext* ctx = m_renderContext->GetGraphicsContext();
-    if (ctx)
+    const size_t workerCount = JobSystem::Get().GetWorkerCount();
+    if (ctx && workerCount > 0)
+    {
+        const uint32_t contextCount = static_cast<uint32_t>(
+            std::min<size_t>(workerCount + 1, MaxParallelRecordingContexts));
+        const auto contexts = m_renderContext->BeginParallelRecording(contextCount);
+        if (!contexts.empty())
+        {
+            m_renderGraph->ExecuteParallel(contexts);
+        }
+    }
+    else if (ctx)
     {
         m_renderGraph->Execute(*ctx);
     }
@@ -4,7 +4,8 @@
 //
 // Descriptor sets:
 //   set 0 / space0: frame data
-//   set 1 / space1: object data
+//   set 1 / space1: object data, a window of per-instance world matrices
+//                   indexed by SV_InstanceID
 //   set 2 / space2: material data
 //
 // Vertex inputs come from separate vertex buffers:
@@ -26,6 +27,9 @@
 #define MATERIAL_ALPHA_MASK 1
 #define MATERIAL_ALPHA_BLEND 2
 
+// Must match PipelineCache::MaxObjectInstancesPerDraw
+#define MAX_OBJECT_INSTANCES_PER_DRAW 1024
+
 // =============================================================================
 // Constant Buffers
 // =============================================================================
@@ -41,7 +45,7 @@ cbuffer ViewConstants : register(b0, space0)
 
 cbuffer ObjectConstants : register(b0, space1)
 {
-    float4x4 World;
+    float4x4 ObjectWorld[MAX_OBJECT_INSTANCES_PER_DRAW];
 };
 
 cbuffer MaterialConstants : register(b0, space2)
@@ -93,10 +97,12 @@ struct PSInput
 // Vertex Shader
 // =============================================================================
 
-PSInput VSMain(VSInput input)
+PSInput VSMain(VSInput input, uint instanceId : SV_InstanceID)
 {
     PSInput output;
 
+    float4x4 World = ObjectWorld[instanceId];
+
     float4 worldPos = mul(World, float4(input.Position, 1.0));
     output.WorldPos = worldPos.xyz;
     output.Position = mul(ViewProjection, worldPos);
@@ -22,6 +22,7 @@
 #include <atomic>
 #include <thread>
 #include <filesystem>
+#include <chrono>
 
 namespace RVX::Resource
 {
@@ -71,6 +72,9 @@ namespace RVX::Resource
 
         /// Ignore patterns (glob-style)
         std::vector<std::string> ignorePatterns;
+
+        /// Poll even where native notifications are available (e.g. network mounts)
+        bool forcePolling = false;
     };
 
     /**
@@ -82,6 +86,15 @@ namespace RVX::Resource
      * - macOS: FSEvents
      * 
      * Falls back to polling if native watching is not available.
+     *
+     * On Linux every watched directory (and, for recursive watches, every
+     * subdirectory) gets an inotify watch on one shared instance. Bursts of
+     * events for a path are coalesced into a single change that is reported
+     * once the path has been quiet for the debounce delay, so a save that
+     * writes, truncates and renames shows up as one Modified. If the kernel
+     * queue overflows, the native watches are rescanned against their
+     * recorded timestamps; a watch that cannot be kept (e.g. the inotify
+     * watch limit is hit) drops back to polling.
      */
     class FileWatcher
     {
@@ -176,6 +189,23 @@ namespace RVX::Resource
         bool IsWatching(const std::string& path) const;
 
     private:
+        /// Native events for one path, held until the path goes quiet
+        struct NativeChange
+        {
+            std::string oldPath;        // Set when the change began as a rename
+            bool existedBefore = false; // Whether the path was known when the first event arrived
+            std::chrono::steady_clock::time_point firstEvent;
+            std::chrono::steady_clock::time_point lastEvent;
+        };
+
+        /// What ScanNativeDirectory() reports for the files it finds
+        enum class NativeScan : uint8_t
+        {
+            Baseline,   // Record timestamps without reporting
+            Created,    // A new directory; report every file
+            Resync      // Report files that differ from their timestamps, and missing ones
+        };
+
         struct WatchEntry
         {
             uint32_t id;
@@ -189,6 +219,17 @@ namespace RVX::Resource
 
             // Platform-specific handle
             void* nativeHandle = nullptr;
+
+            // Native notifications (inotify on Linux)
+            bool native = false;
+            std::unordered_map<std::string, NativeChange> nativeChanges;
+        };
+
+        /// One inotify watch; directories shared by several watches have one
+        struct NativeDirectory
+        {
+            std::string path;
+            std::vector<uint32_t> watchIds;
         };
 
         struct PendingEvent
@@ -214,6 +255,12 @@ namespace RVX::Resource
         std::thread m_backgroundThread;
         std::atomic<bool> m_stopRequested{false};
 
+        // Native watching; the maps are guarded by m_watchMutex
+        int m_nativeFd = -1;                                           // inotify instance
+        int m_wakeFd = -1;                                             // Interrupts WaitForChanges()
+        std::unordered_map<int, NativeDirectory> m_nativeDirectories;  // By watch descriptor
+        std::unordered_map<std::string, int> m_nativeDescriptors;      // By directory path
+
         // Internal methods
         void PollChanges();
         void BackgroundLoop();
@@ -227,6 +274,16 @@ namespace RVX::Resource
         bool SetupNativeWatch(WatchEntry& entry);
         void TeardownNativeWatch(WatchEntry& entry);
         void ProcessNativeEvents();
+        void OpenNativeWatcher();
+        void CloseNativeWatcher();
+        void WaitForChanges();
+        void WakeBackground();
+        bool AddNativeDirectory(WatchEntry& entry, const std::string& directory);
+        void ReleaseNativeDirectories(uint32_t watchId, const std::string& directory);
+        bool ScanNativeDirectory(WatchEntry& entry, const std::string& directory, NativeScan scan);
+        void ForgetNativeDirectory(WatchEntry& entry, const std::string& directory);
+        void NoteNativeChange(WatchEntry& entry, const std::string& path, const std::string& movedFrom);
+        void FlushNativeChanges(WatchEntry& entry, std::chrono::steady_clock::time_point now);
     };
 
 } // namespace RVX::Resource
@@ -4,33 +4,68 @@
 #include <algorithm>
 #include <chrono>
 #include <regex>
+#include <unordered_set>
 
 // Platform-specific includes
 #ifdef _WIN32
     #define WIN32_LEAN_AND_MEAN
     #include <windows.h>
 #elif defined(__linux__)
+    #include <sys/eventfd.h>
     #include <sys/inotify.h>
     #include <unistd.h>
     #include <poll.h>
+    #include <cerrno>
+    #include <cstring>
 #elif defined(__APPLE__)
     #include <CoreServices/CoreServices.h>
 #endif
 
 namespace RVX::Resource
 {
+    namespace
+    {
+        using SteadyTime = std::chrono::steady_clock::time_point;
+
+        /// How often the background thread polls watches without native notifications
+        constexpr uint32_t kPollIntervalMs = 100;
+
+        /// A path that never goes quiet is still reported at least this often
+        constexpr std::chrono::milliseconds kNativeMaxDelay{1000};
+
+        /// When a coalesced native change is ready to be reported
+        SteadyTime NativeChangeDue(SteadyTime firstEvent, SteadyTime lastEvent, uint32_t debounceMs)
+        {
+            const std::chrono::milliseconds debounce(debounceMs);
+            return std::min(lastEvent + debounce, firstEvent + std::max(debounce, kNativeMaxDelay));
+        }
+
+        /// Absolute, without a trailing separator, so paths built from events match the scanned ones
+        std::filesystem::path NormalizePath(const std::string& path)
+        {
+            std::filesystem::path fsPath = std::filesystem::absolute(path).lexically_normal();
+            if (!fsPath.has_filename() && fsPath.has_relative_path())
+            {
+                fsPath = fsPath.parent_path();
+            }
+            return fsPath;
+        }
+    } // namespace
+
     // =========================================================================
     // Construction
     // =========================================================================
 
     FileWatcher::FileWatcher()
     {
+        OpenNativeWatcher();
     }
 
     FileWatcher::~FileWatcher()
     {
         StopBackground();
         UnwatchAll();
+        CloseNativeWatcher();
     }
 
     // =========================================================================
@@ -43,7 +78,7 @@ namespace RVX::Resource
     {
         std::lock_guard<std::mutex> lock(m_watchMutex);
 
-        std::filesystem::path fsPath = std::filesystem::absolute(path);
+        std::filesystem::path fsPath = NormalizePath(path);
         if (!std::filesystem::exists(fsPath))
         {
             RVX_CORE_WARN("FileWatcher: Path does not exist: {}", path);
@@ -57,20 +92,23 @@ namespace RVX::Resource
         entry.options = options;
         entry.callback = std::move(callback);
 
-        // Initialize file timestamps for polling
-        InitializeTimestamps(entry);
-
-        // Try to set up native watch
-        if (!SetupNativeWatch(entry))
+        // Native watches record the initial timestamps themselves, after the
+        // watches are in place so nothing slips between the scan and them
+        if (options.forcePolling || !SetupNativeWatch(entry))
         {
+            InitializeTimestamps(entry);
             RVX_CORE_INFO("FileWatcher: Using polling for: {}", path);
         }
 
-        m_watches[entry.id] = std::move(entry);
+        const uint32_t id = entry.id;
+        m_watches[id] = std::move(entry);
 
-        RVX_CORE_INFO("FileWatcher: Watching {} (id={})", path, m_watches[entry.id - 1].id);
+        RVX_CORE_INFO("FileWatcher: Watching {} (id={})", path, id);
 
-        return entry.id;
+        // The background thread may be asleep with no reason to poll yet
+        WakeBackground();
+
+        return id;
     }
 
     uint32_t FileWatcher::WatchFile(const std::string& path, FileChangeCallback callback)
@@ -169,6 +207,7 @@ namespace RVX::Resource
         }
 
         m_stopRequested.store(true);
+        WakeBackground();
 
         if (m_backgroundThread.joinable())
         {
@@ -193,7 +232,7 @@ namespace RVX::Resource
     bool FileWatcher::IsWatching(const std::string& path) const
     {
         std::lock_guard<std::mutex> lock(m_watchMutex);
-        std::filesystem::path fsPath = std::filesystem::absolute(path);
+        std::filesystem::path fsPath = NormalizePath(path);
 
         for (const auto& [id, entry] : m_watches)
         {
@@ -215,6 +254,11 @@ namespace RVX::Resource
 
         for (auto& [id, entry] : m_watches)
         {
+            if (entry.native)
+            {
+                continue;
+            }
+
             if (!entry.isDirectory)
             {
                 // Single file watch
@@ -338,7 +382,7 @@ namespace RVX::Resource
         {
             ProcessNativeEvents();
             PollChanges();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            WaitForChanges();
         }
     }
 
@@ -484,12 +528,609 @@ namespace RVX::Resource
     }
 
     // =========================================================================
-    // Platform-Specific (Stubs - polling fallback)
+    // Native Change Tracking
+    // =========================================================================
+
+    bool FileWatcher::ScanNativeDirectory(WatchEntry& entry, const std::string& directory, NativeScan scan)
+    {
+        // Watch first, then scan, so a file written in between is either
+        // found by the scan or reported by the watch
+        if (!AddNativeDirectory(entry, directory))
+        {
+            return false;
+        }
+
+        std::unordered_set<std::string> seen;
+        std::error_code error;
+        auto it = std::filesystem::recursive_directory_iterator(
+            directory, std::filesystem::directory_options::skip_permission_denied, error);
+
+        for (; !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+        {
+            const auto& dirEntry = *it;
+            std::error_code entryError;
+
+            if (dirEntry.is_directory(entryError) && !dirEntry.is_symlink(entryError))
+            {
+                if (!entry.options.recursive)
+                {
+                    it.disable_recursion_pending();
+                }
+                else if (!AddNativeDirectory(entry, dirEntry.path().string()))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (!dirEntry.is_regular_file(entryError))
+            {
+                continue;
+            }
+
+            std::string filePath = dirEntry.path().string();
+            if (ShouldIgnore(filePath, entry.options))
+            {
+                continue;
+            }
+
+            const auto writeTime = dirEntry.last_write_time(entryError);
+            switch (scan)
+            {
+                case NativeScan::Baseline:
+                    entry.fileTimestamps[filePath] = writeTime;
+                    break;
+                case NativeScan::Created:
+                    NoteNativeChange(entry, filePath, {});
+                    break;
+                case NativeScan::Resync:
+                {
+                    auto known = entry.fileTimestamps.find(filePath);
+                    if (known == entry.fileTimestamps.end() || known->second != writeTime)
+                    {
+                        NoteNativeChange(entry, filePath, {});
+                    }
+                    seen.insert(std::move(filePath));
+                    break;
+                }
+            }
+        }
+
+        // Only a complete walk can tell that a known file is gone
+        if (scan == NativeScan::Resync && !error)
+        {
+            const std::string prefix = directory + '/';
+            for (const auto& [filePath, writeTime] : entry.fileTimestamps)
+            {
+                if (filePath.starts_with(prefix) && seen.find(filePath) == seen.end())
+                {
+                    NoteNativeChange(entry, filePath, {});
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void FileWatcher::ForgetNativeDirectory(WatchEntry& entry, const std::string& directory)
+    {
+        // A directory moved away takes its files without an event for each
+        const std::string prefix = directory + '/';
+        for (const auto& [filePath, writeTime] : entry.fileTimestamps)
+        {
+            if (filePath.starts_with(prefix))
+            {
+                NoteNativeChange(entry, filePath, {});
+            }
+        }
+
+        ReleaseNativeDirectories(entry.id, directory);
+    }
+
+    void FileWatcher::NoteNativeChange(WatchEntry& entry, const std::string& path, const std::string& movedFrom)
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        auto [it, inserted] = entry.nativeChanges.try_emplace(path);
+        NativeChange& change = it->second;
+        if (inserted)
+        {
+            change.existedBefore = entry.fileTimestamps.find(path) != entry.fileTimestamps.end();
+            change.firstEvent = now;
+        }
+        change.lastEvent = now;
+
+        // A known file moved onto a new name is one rename rather than a
+        // delete and a create
+        if (!movedFrom.empty() && movedFrom != path && !change.existedBefore && change.oldPath.empty())
+        {
+            auto from = entry.nativeChanges.find(movedFrom);
+            if (from != entry.nativeChanges.end() && from->second.existedBefore && from->second.oldPath.empty())
+            {
+                change.oldPath = movedFrom;
+                change.firstEvent = std::min(change.firstEvent, from->second.firstEvent);
+                entry.nativeChanges.erase(from);
+            }
+        }
+    }
+
+    void FileWatcher::FlushNativeChanges(WatchEntry& entry, std::chrono::steady_clock::time_point now)
+    {
+        for (auto it = entry.nativeChanges.begin(); it != entry.nativeChanges.end();)
+        {
+            const std::string& path = it->first;
+            const NativeChange& change = it->second;
+
+            if (now < NativeChangeDue(change.firstEvent, change.lastEvent, entry.options.debounceMs))
+            {
+                ++it;
+                continue;
+            }
+
+            // Report the net effect of everything since the first event
+            std::error_code error;
+            FileChangeEvent event;
+            event.path = path;
+            bool report = true;
+
+            if (std::filesystem::is_regular_file(path, error))
+            {
+                event.timestamp = std::filesystem::last_write_time(path, error);
+
+                auto known = entry.fileTimestamps.find(path);
+                if (!change.oldPath.empty())
+                {
+                    event.type = FileChangeType::Renamed;
+                    event.oldPath = change.oldPath;
+                }
+                else if (known == entry.fileTimestamps.end())
+                {
+                    event.type = FileChangeType::Created;
+                }
+                else
+                {
+                    // Attribute-only changes and events already covered by a scan leave the time alone
+                    event.type = FileChangeType::Modified;
+                    report = known->second != event.timestamp;
+                }
+
+                entry.fileTimestamps[path] = event.timestamp;
+                if (!change.oldPath.empty())
+                {
+                    entry.fileTimestamps.erase(change.oldPath);
+                }
+            }
+            else
+            {
+                event.timestamp = std::filesystem::file_time_type::clock::now();
+                event.type = FileChangeType::Deleted;
+
+                if (!change.oldPath.empty())
+                {
+                    // Renamed and then removed: only the original name was ever reported
+                    event.path = change.oldPath;
+                    entry.fileTimestamps.erase(change.oldPath);
+                }
+                else
+                {
+                    // Created and removed within the window: nothing to report
+                    report = entry.fileTimestamps.erase(path) > 0;
+                }
+            }
+
+            if (report)
+            {
+                EnqueueEvent(entry.id, event);
+            }
+            it = entry.nativeChanges.erase(it);
+        }
+    }
+
+    // =========================================================================
+    // Platform-Specific
     // =========================================================================
 
+#if defined(__linux__)
+
+    namespace
+    {
+        constexpr uint32_t kNativeMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                                         IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF |
+                                         IN_EXCL_UNLINK | IN_ONLYDIR;
+
+        /// Room for a few hundred events per read()
+        constexpr size_t kNativeBufferSize = 64 * 1024;
+    } // namespace
+
+    void FileWatcher::OpenNativeWatcher()
+    {
+        m_nativeFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_nativeFd < 0)
+        {
+            RVX_CORE_WARN("FileWatcher: inotify unavailable ({}), falling back to polling", std::strerror(errno));
+        }
+
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    void FileWatcher::CloseNativeWatcher()
+    {
+        if (m_nativeFd >= 0)
+        {
+            close(m_nativeFd);
+            m_nativeFd = -1;
+        }
+        if (m_wakeFd >= 0)
+        {
+            close(m_wakeFd);
+            m_wakeFd = -1;
+        }
+    }
+
     bool FileWatcher::SetupNativeWatch(WatchEntry& entry)
     {
-        // For now, use polling fallback on all platforms
+        if (m_nativeFd < 0)
+        {
+            return false;
+        }
+
+        // A single file is watched through its directory so that editors
+        // which save by replacing the file keep being seen
+        bool watching = false;
+        if (entry.isDirectory)
+        {
+            watching = ScanNativeDirectory(entry, entry.path, NativeScan::Baseline);
+        }
+        else if (AddNativeDirectory(entry, std::filesystem::path(entry.path).parent_path().string()))
+        {
+            InitializeTimestamps(entry);
+            watching = true;
+        }
+
+        if (!watching)
+        {
+            ReleaseNativeDirectories(entry.id, {});
+            entry.fileTimestamps.clear();
+            return false;
+        }
+
+        entry.native = true;
+        return true;
+    }
+
+    void FileWatcher::TeardownNativeWatch(WatchEntry& entry)
+    {
+        if (entry.native)
+        {
+            ReleaseNativeDirectories(entry.id, {});
+            entry.nativeChanges.clear();
+            entry.native = false;
+        }
+    }
+
+    bool FileWatcher::AddNativeDirectory(WatchEntry& entry, const std::string& directory)
+    {
+        int descriptor = -1;
+        auto known = m_nativeDescriptors.find(directory);
+        if (known != m_nativeDescriptors.end())
+        {
+            descriptor = known->second;
+        }
+        else
+        {
+            descriptor = inotify_add_watch(m_nativeFd, directory.c_str(), kNativeMask);
+            if (descriptor < 0)
+            {
+                if (errno == ENOENT || errno == ENOTDIR)
+                {
+                    // Removed before we got to it; its parent reports that
+                    return true;
+                }
+
+                RVX_CORE_WARN("FileWatcher: Cannot watch {}: {}{}", directory, std::strerror(errno),
+                              errno == ENOSPC ? " (raise fs.inotify.max_user_watches)" : "");
+                return false;
+            }
+
+            // The same directory reached through another path shares the descriptor
+            auto [nativeIt, inserted] = m_nativeDirectories.try_emplace(descriptor);
+            if (inserted)
+            {
+                nativeIt->second.path = directory;
+                m_nativeDescriptors[directory] = descriptor;
+            }
+        }
+
+        auto& watchIds = m_nativeDirectories[descriptor].watchIds;
+        if (std::find(watchIds.begin(), watchIds.end(), entry.id) == watchIds.end())
+        {
+            watchIds.push_back(entry.id);
+        }
+        return true;
+    }
+
+    void FileWatcher::ReleaseNativeDirectories(uint32_t watchId, const std::string& directory)
+    {
+        // An empty directory releases everything the watch holds
+        const std::string prefix = directory + '/';
+
+        for (auto it = m_nativeDirectories.begin(); it != m_nativeDirectories.end();)
+        {
+            NativeDirectory& native = it->second;
+            const bool inside = directory.empty() || native.path == directory || native.path.starts_with(prefix);
+            auto id = std::find(native.watchIds.begin(), native.watchIds.end(), watchId);
+            if (!inside || id == native.watchIds.end())
+            {
+                ++it;
+                continue;
+            }
+
+            native.watchIds.erase(id);
+            if (!native.watchIds.empty())
+            {
+                ++it;
+                continue;
+            }
+
+            inotify_rm_watch(m_nativeFd, it->first);
+            m_nativeDescriptors.erase(native.path);
+            it = m_nativeDirectories.erase(it);
+        }
+    }
+
+    void FileWatcher::ProcessNativeEvents()
+    {
+        if (m_nativeFd < 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_watchMutex);
+
+        alignas(inotify_event) char buffer[kNativeBufferSize];
+        std::unordered_map<uint32_t, std::string> moves;    // Rename cookie -> old path
+        std::vector<uint32_t> lostWatches;
+        bool overflowed = false;
+
+        for (;;)
+        {
+            const ssize_t length = read(m_nativeFd, buffer, sizeof(buffer));
+            if (length < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (length <= 0)
+            {
+                break;
+            }
+
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    overflowed = true;
+                    continue;
+                }
+
+                auto nativeIt = m_nativeDirectories.find(event->wd);
+                if (nativeIt == m_nativeDirectories.end())
+                {
+                    // Released already; the kernel is confirming it
+                    continue;
+                }
+                NativeDirectory& directory = nativeIt->second;
+
+                if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+                {
+                    // Subdirectories are handled through their parent, but a
+                    // watch whose root went away has to fall back to polling
+                    for (uint32_t id : directory.watchIds)
+                    {
+                        auto watchIt = m_watches.find(id);
+                        if (watchIt == m_watches.end())
+                        {
+                            continue;
+                        }
+
+                        const WatchEntry& entry = watchIt->second;
+                        const std::string root = entry.isDirectory ?
+                            entry.path : std::filesystem::path(entry.path).parent_path().string();
+                        if (root == directory.path)
+                        {
+                            lostWatches.push_back(id);
+                        }
+                    }
+
+                    if (event->mask & IN_IGNORED)
+                    {
+                        m_nativeDescriptors.erase(directory.path);
+                        m_nativeDirectories.erase(nativeIt);
+                    }
+                    continue;
+                }
+
+                if (event->len == 0)
+                {
+                    continue;
+                }
+
+                const std::string path = directory.path + '/' + event->name;
+
+                std::string movedFrom;
+                if (event->mask & IN_MOVED_FROM)
+                {
+                    moves[event->cookie] = path;
+                }
+                else if (event->mask & IN_MOVED_TO)
+                {
+                    auto move = moves.find(event->cookie);
+                    if (move != moves.end())
+                    {
+                        movedFrom = std::move(move->second);
+                        moves.erase(move);
+                    }
+                }
+
+                // Indexed: a new subdirectory can add to the list (aliased paths)
+                for (size_t i = 0; i < directory.watchIds.size(); ++i)
+                {
+                    auto watchIt = m_watches.find(directory.watchIds[i]);
+                    if (watchIt == m_watches.end() || !watchIt->second.native)
+                    {
+                        continue;
+                    }
+                    WatchEntry& entry = watchIt->second;
+
+                    if (event->mask & IN_ISDIR)
+                    {
+                        if (!entry.isDirectory || !entry.options.recursive)
+                        {
+                            continue;
+                        }
+
+                        if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                        {
+                            // Files may have landed before the new watch did
+                            if (!ScanNativeDirectory(entry, path, NativeScan::Created))
+                            {
+                                lostWatches.push_back(entry.id);
+                            }
+                        }
+                        else if (event->mask & IN_MOVED_FROM)
+                        {
+                            ForgetNativeDirectory(entry, path);
+                        }
+                        continue;
+                    }
+
+                    const bool relevant = entry.isDirectory ?
+                        !ShouldIgnore(path, entry.options) : path == entry.path;
+                    if (relevant)
+                    {
+                        NoteNativeChange(entry, path, movedFrom);
+                    }
+                }
+            }
+        }
+
+        if (overflowed)
+        {
+            // Events were dropped and there is no telling which, so compare
+            // every native watch against what it last reported
+            RVX_CORE_WARN("FileWatcher: inotify queue overflowed, rescanning native watches");
+            for (auto& [id, entry] : m_watches)
+            {
+                if (!entry.native)
+                {
+                    continue;
+                }
+
+                if (!entry.isDirectory)
+                {
+                    NoteNativeChange(entry, entry.path, {});
+                }
+                else if (!ScanNativeDirectory(entry, entry.path, NativeScan::Resync))
+                {
+                    lostWatches.push_back(id);
+                }
+            }
+        }
+
+        for (uint32_t id : lostWatches)
+        {
+            auto watchIt = m_watches.find(id);
+            if (watchIt == m_watches.end() || !watchIt->second.native)
+            {
+                continue;
+            }
+
+            // Report what is known so polling starts from consistent timestamps
+            WatchEntry& entry = watchIt->second;
+            FlushNativeChanges(entry, std::chrono::steady_clock::time_point::max());
+            TeardownNativeWatch(entry);
+            RVX_CORE_WARN("FileWatcher: Lost native watch, using polling for: {}", entry.path);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& [id, entry] : m_watches)
+        {
+            if (entry.native && !entry.nativeChanges.empty())
+            {
+                FlushNativeChanges(entry, now);
+            }
+        }
+    }
+
+    void FileWatcher::WaitForChanges()
+    {
+        // Sleep until the kernel has events, a held change is due, or a
+        // polled watch needs its next pass; with only quiet native watches
+        // that is indefinitely
+        int timeoutMs = m_wakeFd < 0 ? static_cast<int>(kPollIntervalMs) : -1;
+        {
+            std::lock_guard<std::mutex> lock(m_watchMutex);
+            const auto now = std::chrono::steady_clock::now();
+
+            auto waitAtMost = [&timeoutMs](int64_t ms)
+            {
+                const int clamped = static_cast<int>(std::clamp<int64_t>(ms, 0, kPollIntervalMs));
+                timeoutMs = timeoutMs < 0 ? clamped : std::min(timeoutMs, clamped);
+            };
+
+            for (const auto& [id, entry] : m_watches)
+            {
+                if (!entry.native)
+                {
+                    waitAtMost(kPollIntervalMs);
+                    continue;
+                }
+
+                for (const auto& [path, change] : entry.nativeChanges)
+                {
+                    const auto due = NativeChangeDue(change.firstEvent, change.lastEvent, entry.options.debounceMs);
+                    waitAtMost(std::chrono::ceil<std::chrono::milliseconds>(due - now).count());
+                }
+            }
+        }
+
+        pollfd fds[2] = {};
+        fds[0].fd = m_nativeFd;
+        fds[0].events = POLLIN;
+        fds[1].fd = m_wakeFd;
+        fds[1].events = POLLIN;
+
+        if (poll(fds, 2, timeoutMs) > 0 && (fds[1].revents & POLLIN))
+        {
+            uint64_t value = 0;
+            (void)read(m_wakeFd, &value, sizeof(value));
+        }
+    }
+
+    void FileWatcher::WakeBackground()
+    {
+        if (m_wakeFd >= 0)
+        {
+            const uint64_t one = 1;
+            (void)write(m_wakeFd, &one, sizeof(one));
+        }
+    }
+
+#else
+
+    void FileWatcher::OpenNativeWatcher()
+    {
+    }
+
+    void FileWatcher::CloseNativeWatcher()
+    {
+    }
+
+    bool FileWatcher::SetupNativeWatch(WatchEntry& entry)
+    {
+        // For now, use polling fallback on other platforms
         // TODO: Implement platform-specific watching
         return false;
     }
@@ -506,10 +1147,30 @@ namespace RVX::Resource
         }
     }
 
+    bool FileWatcher::AddNativeDirectory(WatchEntry& entry, const std::string& directory)
+    {
+        return false;
+    }
+
+    void FileWatcher::ReleaseNativeDirectories(uint32_t watchId, const std::string& directory)
+    {
+    }
+
     void FileWatcher::ProcessNativeEvents()
     {
         // Process platform-specific events
         // TODO: Implement platform-specific event processing
     }
 
+    void FileWatcher::WaitForChanges()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
+    }
+
+    void FileWatcher::WakeBackground()
+    {
+    }
+
+#endif // __linux__
+
 } // namespace RVX::Resource
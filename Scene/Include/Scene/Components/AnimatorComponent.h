@@ -223,9 +223,25 @@ public:
     /// Check if pose is valid
     bool HasValidPose() const;
 
+    // =========================================================================
+    // Batched Evaluation
+    // =========================================================================
+
+    /// Leave pose evaluation to a batched pass (see AnimationSubsystem);
+    /// Tick then only advances the state machine
+    void SetBatchedEvaluation(bool batched);
+    bool IsBatchedEvaluation() const { return m_batchedEvaluation; }
+
+    /// Check if Tick advanced the state machine and is waiting for its pose
+    bool IsAwaitingBatchedPose() const { return m_awaitingBatchedPose; }
+
+    /// Finish a batched update with the pose evaluated for this frame
+    void ApplyBatchedPose(const Animation::SkeletonPose& pose);
+
 private:
     void UpdateAnimation(float deltaTime);
-    void ApplyPoseToSkeleton();
+    void FinishUpdate(const Animation::SkeletonPose& pose);
+    void ApplyPoseToSkeleton(const Animation::SkeletonPose& pose);
     void ExtractRootMotion();
     void ProcessAnimationEvents();
 
@@ -246,6 +262,8 @@ private:
     AnimatorUpdateMode m_updateMode = AnimatorUpdateMode::Normal;
     AnimatorCullingMode m_cullingMode = AnimatorCullingMode::AlwaysAnimate;
     bool m_isCulled = false;
+    bool m_batchedEvaluation = false;
+    bool m_awaitingBatchedPose = false;
 
     // IK state
     Vec3 m_lookAtPosition{0.0f};
@@ -183,6 +183,7 @@ public:
 private:
     void ComputeGlobalPoses();
     void ComputeSkinningMatrices();
+    bool HasBoneOverrides() const;
 
     // Skeleton data
     std::shared_ptr<Animation::Skeleton> m_skeleton;
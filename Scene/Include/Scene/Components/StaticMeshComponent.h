@@ -44,17 +44,17 @@ namespace RVX
         Resource::ResourceHandle<Resource::MaterialResource> GetMaterial(size_t submeshIndex) const;
         size_t GetSubmeshCount() const;
         size_t GetMaterialOverrideCount() const { return m_materialOverrides.size(); }
-        void ClearMaterialOverrides() { m_materialOverrides.clear(); }
+        void ClearMaterialOverrides();
 
         // =====================================================================
         // Rendering Properties
         // =====================================================================
 
         bool CastsShadow() const { return m_castsShadow; }
-        void SetCastsShadow(bool castsShadow) { m_castsShadow = castsShadow; }
+        void SetCastsShadow(bool castsShadow);
 
         bool ReceivesShadow() const { return m_receivesShadow; }
-        void SetReceivesShadow(bool receivesShadow) { m_receivesShadow = receivesShadow; }
+        void SetReceivesShadow(bool receivesShadow);
 
         // =====================================================================
         // Render Extraction
@@ -62,6 +62,7 @@ namespace RVX
 
         bool HasRenderData() const override;
         void CollectRenderData(RenderScene& scene) const override;
+        void ExtractRenderObject(RenderObject& outObject) const override;
 
     private:
         Resource::ResourceHandle<Resource::MeshResource> m_mesh;
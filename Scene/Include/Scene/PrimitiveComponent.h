@@ -12,6 +12,8 @@
 namespace RVX
 {
     class RenderScene;
+    class SceneManager;
+    struct RenderObject;
 
     /**
      * @brief Base class for scene components that can contribute render data.
@@ -33,7 +35,7 @@ namespace RVX
         void OnUnregister() override;
 
         bool IsVisible() const { return m_visible; }
-        void SetVisible(bool visible) { m_visible = visible; }
+        void SetVisible(bool visible);
         void SetEnabled(bool enabled) override;
 
         uint32 GetLayerMask() const { return m_layerMask; }
@@ -58,10 +60,27 @@ namespace RVX
         virtual bool HasRenderData() const { return false; }
         virtual void CollectRenderData(RenderScene& scene) const { (void)scene; }
 
+        /// Write this primitive's render data into a retained object, reusing its storage
+        virtual void ExtractRenderObject(RenderObject& outObject) const { (void)outObject; }
+
+        // =====================================================================
+        // Render Change Tracking
+        // =====================================================================
+
+        static constexpr uint32 InvalidRenderId = ~0u;
+
+        /// Dense id assigned by SceneManager while registered; retained render scenes index by it
+        uint32 GetRenderId() const { return m_renderId; }
+
+        /// Queue this primitive for re-extraction by retained render scenes
+        void MarkRenderStateDirty();
+
     protected:
         void OnTransformChanged() override;
 
     private:
+        friend class SceneManager;
+
         void MarkSpatialDirty();
 
         bool m_visible = true;
@@ -70,6 +89,8 @@ namespace RVX
         mutable AABB m_cachedWorldBounds;
         mutable bool m_boundsDirty = true;
         bool m_spatialDirty = true;
+        uint32 m_renderId = InvalidRenderId;
+        bool m_renderDirty = false;
     };
 
 } // namespace RVX
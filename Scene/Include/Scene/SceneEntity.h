@@ -100,11 +100,7 @@ namespace RVX
         virtual EntityType GetEntityType() const { return EntityType::Node; }
 
         bool IsActive() const override { return m_active; }
-        void SetActive(bool active) override
-        {
-            Actor::SetActive(active);
-            m_active = active;
-        }
+        void SetActive(bool active) override;
 
         void SetLayerMask(uint32_t mask) { m_layerMask = mask; }
         void SetLayer(uint32_t layer) { m_layerMask = 1u << layer; }
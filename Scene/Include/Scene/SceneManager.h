@@ -186,6 +186,34 @@ namespace RVX
         void UnregisterPrimitive(PrimitiveComponent* primitive);
         const std::vector<PrimitiveComponent*>& GetPrimitives() const { return m_primitives; }
 
+        /// Look up a registered primitive by its render id (nullptr if the id is free)
+        PrimitiveComponent* GetPrimitiveByRenderId(uint32 renderId) const;
+
+        // =====================================================================
+        // Render Change Tracking
+        // =====================================================================
+
+        /// Queue a registered primitive for re-extraction (deduplicated per frame)
+        void MarkPrimitiveRenderDirty(PrimitiveComponent* primitive);
+
+        /**
+         * @brief Hand queued primitive changes to a retained render scene
+         *
+         * The change queue has a single consumer. The consumer passes back the
+         * epoch it received last time; if another consumer drained the queue in
+         * between (or the scene was shut down), the queues are discarded, a new
+         * epoch is returned and the call returns false to request a full resync
+         * from GetPrimitives().
+         *
+         * @param inOutEpoch Consumer epoch, 0 for a consumer that never synced
+         * @param outRemovedIds Render ids released since the last call
+         * @param outDirty Primitives added or changed since the last call
+         * @return true if the outputs are a valid incremental delta
+         */
+        bool ConsumePrimitiveRenderChanges(uint64& inOutEpoch,
+                                           std::vector<uint32>& outRemovedIds,
+                                           std::vector<PrimitiveComponent*>& outDirty);
+
         // =====================================================================
         // Asset Integration (for future Asset module)
         // =====================================================================
@@ -320,6 +348,15 @@ namespace RVX
         std::vector<std::unique_ptr<PrimitiveSpatialProxy>> m_retiredPrimitiveSpatialProxies;
         Spatial::EntityHandle m_nextPrimitiveSpatialHandle = s_primitiveSpatialHandleStart;
 
+        // Render change tracking
+        std::vector<PrimitiveComponent*> m_primitivesByRenderId;
+        std::vector<uint32> m_freeRenderIds;
+        std::vector<PrimitiveComponent*> m_renderDirtyPrimitives;
+        std::vector<uint32> m_renderRemovedIds;
+        std::vector<bool> m_renderRemovalQueued;    // By render id; keeps m_renderRemovedIds unique
+        uint64 m_renderChangeEpoch = 0;
+        bool m_renderConsumerSynced = false;        // Removals are only queued once a consumer has synced
+
         // Spatial indexing
         Spatial::SpatialIndexPtr m_spatialIndex;
         std::vector<SceneEntity*> m_dirtyEntities;
@@ -334,6 +371,8 @@ namespace RVX
         PrimitiveSpatialProxy* GetPrimitiveSpatialProxy(PrimitiveComponent* primitive) const;
         bool IsPrimitiveSpatiallyIndexable(const PrimitiveComponent* primitive) const;
         bool HasDirtyPrimitiveSpatialProxy() const;
+        void ResetRenderChangeTracking();
+        void QueueRenderRemoval(uint32 renderId);
         void AppendUniqueEntity(const SpatialQueryTarget& target,
                                 std::vector<SceneEntity*>& outEntities) const;
         void AppendUniquePrimitive(const SpatialQueryTarget& target,
@@ -314,6 +314,23 @@ bool AnimatorComponent::HasValidPose() const
     return m_stateMachine != nullptr && m_stateMachine->GetSkeleton() != nullptr;
 }
 
+void AnimatorComponent::SetBatchedEvaluation(bool batched)
+{
+    m_batchedEvaluation = batched;
+    m_awaitingBatchedPose = false;
+}
+
+void AnimatorComponent::ApplyBatchedPose(const Animation::SkeletonPose& pose)
+{
+    if (!m_awaitingBatchedPose)
+    {
+        return;
+    }
+
+    m_awaitingBatchedPose = false;
+    FinishUpdate(pose);
+}
+
 void AnimatorComponent::UpdateAnimation(float deltaTime)
 {
     if (!m_stateMachine)
@@ -321,9 +338,22 @@ void AnimatorComponent::UpdateAnimation(float deltaTime)
         return;
     }
 
+    // Batched: advance states here, the batch evaluates the pose later in the frame
+    if (m_batchedEvaluation)
+    {
+        m_stateMachine->Advance(deltaTime);
+        m_awaitingBatchedPose = true;
+        return;
+    }
+
     // Update state machine
     m_stateMachine->Update(deltaTime);
 
+    FinishUpdate(m_stateMachine->GetOutputPose());
+}
+
+void AnimatorComponent::FinishUpdate(const Animation::SkeletonPose& pose)
+{
     // Extract root motion if enabled
     if (m_applyRootMotion)
     {
@@ -333,22 +363,20 @@ void AnimatorComponent::UpdateAnimation(float deltaTime)
     // Apply pose to skeleton
     if (!m_isCulled || m_cullingMode != AnimatorCullingMode::CullUpdateTransforms)
     {
-        ApplyPoseToSkeleton();
+        ApplyPoseToSkeleton(pose);
     }
 
     // Process animation events
     ProcessAnimationEvents();
 }
 
-void AnimatorComponent::ApplyPoseToSkeleton()
+void AnimatorComponent::ApplyPoseToSkeleton(const Animation::SkeletonPose& pose)
 {
-    if (!m_skeletonComponent || !m_stateMachine)
+    if (!m_skeletonComponent)
     {
         return;
     }
 
-    // Get output pose and apply to skeleton component
-    const Animation::SkeletonPose& pose = m_stateMachine->GetOutputPose();
     m_skeletonComponent->SetPose(pose);
 }
 
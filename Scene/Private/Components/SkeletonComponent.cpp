@@ -2,6 +2,7 @@
 #include "Scene/SceneEntity.h"
 #include "Animation/Data/Skeleton.h"
 #include "Animation/Runtime/SkeletonPose.h"
+#include <algorithm>
 
 namespace RVX
 {
@@ -118,9 +119,22 @@ void SkeletonComponent::SetPose(const Animation::SkeletonPose& pose)
     // Copy pose data
     *m_currentPose = pose;
 
+    m_boundsDirty = true;
+
+    // A pose skinned ahead of time (e.g. by a batched animation pass) is
+    // adopted as is unless bone overrides need the matrices rebuilt
+    if (!pose.AreSkinningMatricesDirty() && pose.GetBoneCount() == m_skinningMatrices.size() &&
+        !HasBoneOverrides())
+    {
+        m_globalPoses = pose.GetGlobalTransforms();
+        m_skinningMatrices = pose.GetSkinningMatrices();
+        m_posesDirty = false;
+        m_skinningDirty = false;
+        return;
+    }
+
     m_posesDirty = true;
     m_skinningDirty = true;
-    m_boundsDirty = true;
 }
 
 void SkeletonComponent::ResetToBindPose()
@@ -149,12 +163,12 @@ int SkeletonComponent::FindBoneIndex(const std::string& boneName) const
 
 Mat4 SkeletonComponent::GetBoneLocalTransform(int boneIndex) const
 {
-    if (!m_currentPose || boneIndex < 0 || boneIndex >= static_cast<int>(m_currentPose->GetLocalTransforms().size()))
+    if (!m_currentPose || boneIndex < 0 || boneIndex >= static_cast<int>(m_currentPose->GetBoneCount()))
     {
         return Mat4(1.0f);
     }
 
-    return m_currentPose->GetLocalTransforms()[boneIndex].ToMatrix();
+    return m_currentPose->GetLocalTransform(static_cast<size_t>(boneIndex)).ToMatrix();
 }
 
 Mat4 SkeletonComponent::GetBoneLocalTransform(const std::string& boneName) const
@@ -340,6 +354,12 @@ void SkeletonComponent::UpdateAttachments()
     }
 }
 
+bool SkeletonComponent::HasBoneOverrides() const
+{
+    return std::any_of(m_boneOverrides.begin(), m_boneOverrides.end(),
+        [](const BoneOverride& o) { return o.hasPosition || o.hasRotation; });
+}
+
 void SkeletonComponent::ComputeGlobalPoses()
 {
     if (!m_skeleton || !m_currentPose)
@@ -348,12 +368,12 @@ void SkeletonComponent::ComputeGlobalPoses()
     }
 
     const auto& bones = m_skeleton->bones;
-    const auto& localTransforms = m_currentPose->GetLocalTransforms();
+    const Animation::SkeletonPose& pose = *m_currentPose;
 
     for (size_t i = 0; i < bones.size(); ++i)
     {
         // Get local transform from pose
-        Mat4 local = localTransforms[i].ToMatrix();
+        Mat4 local = pose.GetLocalTransform(i).ToMatrix();
 
         // Apply overrides
         if (m_boneOverrides[i].hasRotation)
@@ -15,6 +15,7 @@ void StaticMeshComponent::SetMesh(Resource::ResourceHandle<Resource::MeshResourc
 {
     m_mesh = std::move(mesh);
     m_materialOverrides.clear();
+    MarkRenderStateDirty();
 
     if (!m_mesh.IsValid())
     {
@@ -45,6 +46,31 @@ void StaticMeshComponent::SetMaterial(size_t submeshIndex,
         m_materialOverrides.resize(submeshIndex + 1);
     }
     m_materialOverrides[submeshIndex] = std::move(material);
+    MarkRenderStateDirty();
+}
+
+void StaticMeshComponent::ClearMaterialOverrides()
+{
+    m_materialOverrides.clear();
+    MarkRenderStateDirty();
+}
+
+void StaticMeshComponent::SetCastsShadow(bool castsShadow)
+{
+    if (m_castsShadow == castsShadow)
+        return;
+
+    m_castsShadow = castsShadow;
+    MarkRenderStateDirty();
+}
+
+void StaticMeshComponent::SetReceivesShadow(bool receivesShadow)
+{
+    if (m_receivesShadow == receivesShadow)
+        return;
+
+    m_receivesShadow = receivesShadow;
+    MarkRenderStateDirty();
 }
 
 Resource::ResourceHandle<Resource::MaterialResource> StaticMeshComponent::GetMaterial(size_t submeshIndex) const
@@ -88,35 +114,39 @@ void StaticMeshComponent::CollectRenderData(RenderScene& scene) const
     if (!HasRenderData())
         return;
 
-    const Mat4 worldMatrix = GetWorldTransform();
-
     RenderObject object;
-    object.worldMatrix = worldMatrix;
-    object.normalMatrix = glm::inverseTranspose(Mat4(Mat3(worldMatrix)));
-    object.bounds = GetWorldBounds();
-    object.meshResource = m_mesh.Get();
-    object.meshId = m_mesh.GetId();
-    object.castsShadow = m_castsShadow;
-    object.receivesShadow = m_receivesShadow;
-    object.visible = IsVisible();
-
-    if (auto* entity = dynamic_cast<SceneEntity*>(GetOwner()))
-    {
-        object.entityId = entity->GetHandle();
-    }
+    ExtractRenderObject(object);
+    scene.AddObject(object);
+}
+
+void StaticMeshComponent::ExtractRenderObject(RenderObject& outObject) const
+{
+    const Mat4& worldMatrix = GetWorldTransform();
 
+    outObject.worldMatrix = worldMatrix;
+    outObject.normalMatrix = glm::inverseTranspose(Mat4(Mat3(worldMatrix)));
+    outObject.bounds = GetWorldBounds();
+    outObject.meshResource = m_mesh.Get();
+    outObject.meshId = m_mesh.GetId();
+    outObject.castsShadow = m_castsShadow;
+    outObject.receivesShadow = m_receivesShadow;
+    outObject.visible = IsVisible();
+
+    auto* entity = dynamic_cast<SceneEntity*>(GetOwner());
+    outObject.entityId = entity ? entity->GetHandle() : 0;
+
+    // resize() keeps the capacity of a retained object, so re-extraction does not allocate
     const size_t submeshCount = GetSubmeshCount();
-    object.materialIds.resize(submeshCount);
-    object.materialResources.resize(submeshCount);
+    outObject.materialIds.resize(submeshCount);
+    outObject.materialResources.resize(submeshCount);
     for (size_t i = 0; i < submeshCount; ++i)
     {
         auto material = GetMaterial(i);
-        object.materialIds[i] = material.IsValid() ? material.GetId() : 0;
-        object.materialResources[i] = material.Get();
+        outObject.materialIds[i] = material.IsValid() ? material.GetId() : 0;
+        outObject.materialResources[i] = material.Get();
     }
 
-    object.sortKey = object.materialIds.empty() ? 0 : object.materialIds[0];
-    scene.AddObject(object);
+    outObject.sortKey = outObject.materialIds.empty() ? 0 : outObject.materialIds[0];
 }
 
 } // namespace RVX
@@ -23,6 +23,15 @@ void PrimitiveComponent::OnUnregister()
     entity->GetSceneManager()->UnregisterPrimitive(this);
 }
 
+void PrimitiveComponent::SetVisible(bool visible)
+{
+    if (m_visible == visible)
+        return;
+
+    m_visible = visible;
+    MarkRenderStateDirty();
+}
+
 void PrimitiveComponent::SetEnabled(bool enabled)
 {
     if (IsEnabled() == enabled)
@@ -30,6 +39,7 @@ void PrimitiveComponent::SetEnabled(bool enabled)
 
     ActorComponent::SetEnabled(enabled);
     MarkSpatialDirty();
+    MarkRenderStateDirty();
 }
 
 void PrimitiveComponent::SetLayerMask(uint32 layerMask)
@@ -46,6 +56,7 @@ void PrimitiveComponent::SetLocalBounds(const AABB& bounds)
     m_localBounds = bounds;
     m_boundsDirty = true;
     MarkSpatialDirty();
+    MarkRenderStateDirty();
 }
 
 AABB PrimitiveComponent::GetWorldBounds() const
@@ -62,6 +73,19 @@ void PrimitiveComponent::OnTransformChanged()
 {
     m_boundsDirty = true;
     MarkSpatialDirty();
+    MarkRenderStateDirty();
+}
+
+void PrimitiveComponent::MarkRenderStateDirty()
+{
+    if (m_renderDirty || m_renderId == InvalidRenderId)
+        return;
+
+    auto* entity = dynamic_cast<SceneEntity*>(GetOwner());
+    if (entity && entity->GetSceneManager())
+    {
+        entity->GetSceneManager()->MarkPrimitiveRenderDirty(this);
+    }
 }
 
 void PrimitiveComponent::MarkSpatialDirty()
@@ -1,4 +1,5 @@
 #include "Scene/SceneEntity.h"
+#include "Scene/PrimitiveComponent.h"
 #include "Scene/SceneManager.h"
 
 #include <glm/gtc/matrix_transform.hpp>
@@ -304,6 +305,26 @@ AABB SceneEntity::ComputeBoundsFromComponents() const
     return combined;
 }
 
+void SceneEntity::SetActive(bool active)
+{
+    const bool activeChanged = m_active != active;
+
+    Actor::SetActive(active);
+    m_active = active;
+
+    if (activeChanged)
+    {
+        // Primitive render state depends on the owner being active
+        for (const auto& component : GetActorComponents())
+        {
+            if (auto* primitive = dynamic_cast<PrimitiveComponent*>(component.get()))
+            {
+                primitive->MarkRenderStateDirty();
+            }
+        }
+    }
+}
+
 const Vec3& SceneEntity::GetPosition() const
 {
     return m_compatRootComponent ? m_compatRootComponent->GetRelativeLocation() : m_position;
@@ -6,12 +6,24 @@
 #include "Scene/PrimitiveComponent.h"
 
 #include <algorithm>
+#include <atomic>
 #include <unordered_set>
 #include <utility>
 
 namespace RVX
 {
 
+namespace
+{
+    // Epochs are unique across all scene managers so a render scene that
+    // switches worlds can never mistake another manager's queue for its own.
+    uint64 NextRenderChangeEpoch()
+    {
+        static std::atomic<uint64> s_nextEpoch{1};
+        return s_nextEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+} // namespace
+
 class SceneManager::PrimitiveSpatialProxy : public Spatial::ISpatialEntity
 {
 public:
@@ -74,7 +86,10 @@ private:
     PrimitiveComponent* m_primitive = nullptr;
 };
 
-SceneManager::SceneManager() = default;
+SceneManager::SceneManager()
+    : m_renderChangeEpoch(NextRenderChangeEpoch())
+{
+}
 
 SceneManager::~SceneManager()
 {
@@ -126,6 +141,7 @@ void SceneManager::Shutdown()
     m_spatialProxyByHandle.clear();
     m_retiredPrimitiveSpatialProxies.clear();
     m_nextPrimitiveSpatialHandle = s_primitiveSpatialHandleStart;
+    ResetRenderChangeTracking();
     m_dirtyEntities.clear();
     m_spatialIndex.reset();
 
@@ -304,6 +320,22 @@ void SceneManager::RegisterPrimitive(PrimitiveComponent* primitive)
     m_spatialProxyByHandle[proxyPtr->GetHandle()] = proxyPtr;
     m_primitiveSpatialProxies[primitive] = std::move(proxy);
     m_indexNeedsRebuild = true;
+
+    uint32 renderId;
+    if (!m_freeRenderIds.empty())
+    {
+        renderId = m_freeRenderIds.back();
+        m_freeRenderIds.pop_back();
+        m_primitivesByRenderId[renderId] = primitive;
+    }
+    else
+    {
+        renderId = static_cast<uint32>(m_primitivesByRenderId.size());
+        m_primitivesByRenderId.push_back(primitive);
+    }
+    primitive->m_renderId = renderId;
+    primitive->m_renderDirty = false;
+    MarkPrimitiveRenderDirty(primitive);
 }
 
 void SceneManager::UnregisterPrimitive(PrimitiveComponent* primitive)
@@ -329,6 +361,25 @@ void SceneManager::UnregisterPrimitive(PrimitiveComponent* primitive)
     m_primitives.erase(std::remove(m_primitives.begin(), m_primitives.end(), primitive), m_primitives.end());
     m_indexNeedsRebuild = true;
 
+    if (primitive->m_renderId != PrimitiveComponent::InvalidRenderId)
+    {
+        if (primitive->m_renderDirty)
+        {
+            auto dirtyIt = std::find(m_renderDirtyPrimitives.begin(), m_renderDirtyPrimitives.end(), primitive);
+            if (dirtyIt != m_renderDirtyPrimitives.end())
+            {
+                *dirtyIt = m_renderDirtyPrimitives.back();
+                m_renderDirtyPrimitives.pop_back();
+            }
+        }
+
+        QueueRenderRemoval(primitive->m_renderId);
+        m_primitivesByRenderId[primitive->m_renderId] = nullptr;
+        m_freeRenderIds.push_back(primitive->m_renderId);
+        primitive->m_renderId = PrimitiveComponent::InvalidRenderId;
+        primitive->m_renderDirty = false;
+    }
+
     if (m_initialized && m_spatialIndex)
     {
         RebuildSpatialIndex();
@@ -341,6 +392,98 @@ void SceneManager::UnregisterPrimitive(PrimitiveComponent* primitive)
     }
 }
 
+PrimitiveComponent* SceneManager::GetPrimitiveByRenderId(uint32 renderId) const
+{
+    return renderId < m_primitivesByRenderId.size() ? m_primitivesByRenderId[renderId] : nullptr;
+}
+
+void SceneManager::MarkPrimitiveRenderDirty(PrimitiveComponent* primitive)
+{
+    if (!primitive || primitive->m_renderDirty || primitive->m_renderId == PrimitiveComponent::InvalidRenderId)
+        return;
+
+    primitive->m_renderDirty = true;
+    m_renderDirtyPrimitives.push_back(primitive);
+}
+
+bool SceneManager::ConsumePrimitiveRenderChanges(uint64& inOutEpoch,
+                                                 std::vector<uint32>& outRemovedIds,
+                                                 std::vector<PrimitiveComponent*>& outDirty)
+{
+    outRemovedIds.clear();
+    outDirty.clear();
+
+    if (inOutEpoch != m_renderChangeEpoch)
+    {
+        // Unknown consumer: the queued delta is relative to someone else's state
+        for (PrimitiveComponent* primitive : m_renderDirtyPrimitives)
+        {
+            primitive->m_renderDirty = false;
+        }
+        m_renderDirtyPrimitives.clear();
+        m_renderRemovedIds.clear();
+        m_renderRemovalQueued.assign(m_renderRemovalQueued.size(), false);
+
+        m_renderChangeEpoch = NextRenderChangeEpoch();
+        m_renderConsumerSynced = true;
+        inOutEpoch = m_renderChangeEpoch;
+        return false;
+    }
+
+    // Swap so both sides keep their capacity from frame to frame
+    outRemovedIds.swap(m_renderRemovedIds);
+    outDirty.swap(m_renderDirtyPrimitives);
+
+    for (uint32 renderId : outRemovedIds)
+    {
+        m_renderRemovalQueued[renderId] = false;
+    }
+    for (PrimitiveComponent* primitive : outDirty)
+    {
+        primitive->m_renderDirty = false;
+    }
+    return true;
+}
+
+void SceneManager::QueueRenderRemoval(uint32 renderId)
+{
+    // Before the first sync there is nothing to remove from: the consumer
+    // starts from GetPrimitives(). A recycled id only needs removing once,
+    // so a world nobody renders, or churn between syncs, stays bounded.
+    if (!m_renderConsumerSynced)
+        return;
+
+    if (renderId >= m_renderRemovalQueued.size())
+    {
+        m_renderRemovalQueued.resize(m_primitivesByRenderId.size(), false);
+    }
+    if (!m_renderRemovalQueued[renderId])
+    {
+        m_renderRemovalQueued[renderId] = true;
+        m_renderRemovedIds.push_back(renderId);
+    }
+}
+
+void SceneManager::ResetRenderChangeTracking()
+{
+    for (PrimitiveComponent* primitive : m_primitivesByRenderId)
+    {
+        if (primitive)
+        {
+            primitive->m_renderId = PrimitiveComponent::InvalidRenderId;
+            primitive->m_renderDirty = false;
+        }
+    }
+
+    m_primitivesByRenderId.clear();
+    m_freeRenderIds.clear();
+    m_renderDirtyPrimitives.clear();
+    m_renderRemovedIds.clear();
+    m_renderRemovalQueued.clear();
+    m_renderChangeEpoch = NextRenderChangeEpoch();
+    m_renderConsumerSynced = false;
+}
+
 Spatial::EntityHandle SceneManager::AllocatePrimitiveSpatialHandle()
 {
     const auto invalid = Spatial::InvalidEntityHandle;
@@ -27,6 +27,15 @@ namespace RVX::Spatial
 
         /// Whether to use SAH or simple median split
         bool useSAH = true;
+
+        /// Apply tree rotations while refitting to counter quality loss
+        bool enableRotations = true;
+
+        /// Rebuild when the refitted tree's SAH cost exceeds the last build by this factor
+        float rebuildQualityThreshold = 1.5f;
+
+        /// Rebuild instead of refitting when more than this fraction of entities changed
+        float maxIncrementalRatio = 0.25f;
     };
 
     /**
@@ -36,7 +45,12 @@ namespace RVX::Spatial
      * - SAH (Surface Area Heuristic) construction
      * - Efficient frustum culling
      * - Ray intersection queries
-     * - Incremental updates
+     * - Incremental updates: Commit() refits the ancestors of moved leaves,
+     *   inserts/removes leaves in O(log n) and only falls back to a full
+     *   rebuild when the SAH cost degrades past BVHConfig::rebuildQualityThreshold
+     * - Queries run on a flattened 4-wide copy of the tree (BVH4): child and
+     *   leaf bounds are stored SoA and tested four at a time with SIMD, and
+     *   traversal uses an explicit stack instead of recursion
      */
     class BVHIndex : public ISpatialIndex
     {
@@ -84,13 +98,14 @@ namespace RVX::Spatial
         IndexStats GetStats() const override;
         void DebugDraw(IDebugRenderer* renderer, int maxDepth = -1) const override;
 
-        size_t GetEntityCount() const override { return m_entities.size(); }
+        size_t GetEntityCount() const override { return m_entityIndex.size(); }
         AABB GetWorldBounds() const override;
 
     private:
         struct Node
         {
             AABB bounds;
+            int parent = -1;
             int leftChild = -1;   // -1 means leaf
             int rightChild = -1;
             int firstPrimitive = 0;
@@ -99,35 +114,103 @@ namespace RVX::Spatial
             bool IsLeaf() const { return leftChild < 0; }
         };
 
+        /// Four boxes in SoA layout; empty or invalid lanes are cleared in laneMask
+        struct alignas(16) BoundsSoA4
+        {
+            float minX[4], minY[4], minZ[4];
+            float maxX[4], maxY[4], maxZ[4];
+            uint32_t laneMask = 0;
+
+            void SetLane(int lane, const AABB& bounds);
+            void ClearLane(int lane);
+        };
+
+        /// BVH4 node collapsed from up to three levels of the binary tree
+        struct FlatNode
+        {
+            BoundsSoA4 bounds;
+            int child[4];           // inner: flat node index, leaf: first packet index
+            int primitiveCount[4];  // 0 for inner children
+        };
+
+        /// Leaf entities packed four per SIMD test
+        struct PrimitivePacket
+        {
+            BoundsSoA4 bounds;
+            int slot[4];
+        };
+
         BVHConfig m_config;
         std::vector<Node> m_nodes;
+        std::vector<int> m_freeNodes;
+        int m_root = -1;
+
+        // Entity slots; removed slots hold nullptr and are recycled via m_freeSlots
         std::vector<ISpatialEntity*> m_entities;
+        std::vector<AABB> m_entityBounds;
+        std::vector<int> m_entityLeaf;
+        std::vector<size_t> m_freeSlots;
         std::vector<int> m_primitiveIndices;
         std::unordered_map<EntityHandle, size_t> m_entityIndex;
+        size_t m_deadPrimitiveCount = 0;
 
         // Pending updates
         std::vector<ISpatialEntity*> m_pendingInserts;
         std::vector<EntityHandle> m_pendingRemoves;
-        bool m_needsRebuild = false;
+        std::vector<ISpatialEntity*> m_pendingUpdates;
+
+        // Flattened BVH4 used by queries, rebuilt after topology changes and
+        // patched in place when Commit() only refits bounds
+        std::vector<FlatNode> m_flatNodes;
+        std::vector<PrimitivePacket> m_packets;
+        std::vector<int> m_nodeFlatLane;    // binary node -> flat node * 4 + lane
+        std::vector<int> m_slotPacketLane;  // entity slot -> packet * 4 + lane
+        bool m_flatDirty = false;
+
+        // Tree quality tracking (sum of area * cost weight over all nodes)
+        float m_sahAccum = 0.0f;
+        float m_buildSAHCost = 0.0f;
+
+        // Update statistics
+        size_t m_rebuildCount = 0;
+        size_t m_refitCount = 0;
+        size_t m_rotationCount = 0;
+        float m_buildTimeMs = 0.0f;
+        float m_refitTimeMs = 0.0f;
+        float m_totalBuildTimeMs = 0.0f;
+        float m_totalRefitTimeMs = 0.0f;
 
         // Build helpers
-        int BuildRecursive(int start, int end, int depth);
+        int BuildRecursive(int start, int end, int parent, int depth);
         int FindBestSplit(int start, int end, int& outAxis, float& outPos);
         int Partition(int start, int end, int axis, float splitPos);
+        void RebuildFromLiveEntities();
+
+        // Incremental update helpers
+        int AllocateNode();
+        void FreeNode(int nodeIdx);
+        size_t AllocateSlot(ISpatialEntity* entity);
+        void InsertLeaf(ISpatialEntity* entity);
+        void RemoveLeaf(EntityHandle handle);
+        void RemoveEmptyLeafNode(int leafIdx);
+        void RefitUpwards(int nodeIdx);
+        void TryRotate(int nodeIdx);
+        void ReplaceChild(int parentIdx, int oldChild, int newChild);
+        AABB ComputeNodeBounds(int nodeIdx) const;
+        void SetNodeBounds(int nodeIdx, const AABB& bounds);
+        float NodeCost(const Node& node) const;
+        float GetSAHCost() const;
+        void SetEntityBounds(size_t slot, const AABB& bounds);
+
+        // Flattening
+        void Flatten();
+        int FlattenRecursive(int nodeIdx);
+        int FlattenLeaf(int nodeIdx);
 
         // Query helpers
-        void QueryFrustumRecursive(int nodeIdx, const Frustum& frustum,
-            const QueryFilter& filter, std::vector<QueryResult>& results) const;
-        void QueryBoxRecursive(int nodeIdx, const AABB& box,
-            const QueryFilter& filter, std::vector<QueryResult>& results) const;
-        void QuerySphereRecursive(int nodeIdx, const Vec3& center, float radius,
-            const QueryFilter& filter, std::vector<QueryResult>& results) const;
-        bool QueryRayRecursive(int nodeIdx, const Ray& ray,
-            const QueryFilter& filter, float& closestT, QueryResult& result) const;
-        void QueryRayAllRecursive(int nodeIdx, const Ray& ray,
-            const QueryFilter& filter, std::vector<QueryResult>& results) const;
-
-        bool IntersectRayBox(const Ray& ray, const AABB& box, float& tMin, float& tMax) const;
+        template<typename BatchTest, typename Emit>
+        void QueryOverlap(BatchTest&& test, Emit&& emit, const QueryFilter& filter) const;
+        void AppendResult(int slot, std::vector<QueryResult>& results) const;
     };
 
 } // namespace RVX::Spatial
@@ -0,0 +1,165 @@
+#pragma once
+
+/**
+ * @file GridIndex.h
+ * @brief Hashed uniform grid spatial index implementation
+ */
+
+#include "Spatial/Index/ISpatialIndex.h"
+#include <unordered_map>
+
+namespace RVX::Spatial
+{
+    /**
+     * @brief Grid configuration
+     */
+    struct GridConfig
+    {
+        /// Edge length of a cell; pick roughly the size of a typical entity
+        float cellSize = 16.0f;
+
+        /// Entities covering more cells than this are kept in a separate oversized list
+        int maxCellsPerEntity = 64;
+    };
+
+    /**
+     * @brief Hashed uniform grid spatial index
+     *
+     * Features:
+     * - Unbounded world: cells are allocated on demand in a hash map and
+     *   released by Commit() once they empty out
+     * - O(1) insert/remove; updates that stay in the same cells are free
+     * - 3D-DDA ray traversal with early out for nearest-hit queries
+     * - Entities much larger than a cell are tested linearly instead of
+     *   being duplicated into many cells
+     */
+    class GridIndex : public ISpatialIndex
+    {
+    public:
+        explicit GridIndex(const GridConfig& config = {});
+        ~GridIndex() override;
+
+        // =====================================================================
+        // ISpatialIndex Implementation
+        // =====================================================================
+
+        void Build(std::span<ISpatialEntity*> entities) override;
+        void Clear() override;
+        void Insert(ISpatialEntity* entity) override;
+        void Remove(EntityHandle handle) override;
+        void Update(ISpatialEntity* entity) override;
+        void Commit() override;
+
+        void QueryFrustum(
+            const Frustum& frustum,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        void QueryBox(
+            const AABB& box,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        void QuerySphere(
+            const Vec3& center,
+            float radius,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        bool QueryRay(
+            const Ray& ray,
+            const QueryFilter& filter,
+            QueryResult& outResult) const override;
+
+        void QueryRayAll(
+            const Ray& ray,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        IndexStats GetStats() const override;
+        void DebugDraw(IDebugRenderer* renderer, int maxDepth = -1) const override;
+
+        size_t GetEntityCount() const override { return m_entityIndex.size(); }
+        AABB GetWorldBounds() const override;
+
+    private:
+        struct Cell
+        {
+            IVec3 coord{0};
+            AABB contentBounds;       // union of registered entity bounds, reset when emptied
+            std::vector<int> slots;
+        };
+
+        struct EntityRecord
+        {
+            ISpatialEntity* entity = nullptr;
+            AABB bounds;
+            IVec3 minCell{0};
+            IVec3 maxCell{-1};
+            bool oversized = false;
+            bool registered = false;
+
+            bool SpansMultipleCells() const { return minCell != maxCell; }
+        };
+
+        GridConfig m_config;
+        float m_invCellSize = 1.0f / 16.0f;
+
+        std::vector<Cell> m_cells;
+        std::unordered_map<uint64_t, int> m_cellLookup;
+        std::vector<EntityRecord> m_records;
+        std::vector<int> m_freeSlots;
+        std::vector<int> m_oversized;
+        std::unordered_map<EntityHandle, int> m_entityIndex;
+
+        // Occupied cell range, used to clip ray traversal
+        IVec3 m_occupiedMin{0};
+        IVec3 m_occupiedMax{-1};
+
+        // Largest extent of a celled entity; pads block bounds so culling stays conservative
+        float m_maxEntitySize = 0.0f;
+
+        // Per-Commit bookkeeping: cells that emptied, and the largest extents that left and
+        // arrived, to tell whether m_maxEntitySize has to be recomputed
+        std::vector<int> m_emptiedCells;
+        float m_removedMaxExtent = 0.0f;
+        float m_addedMaxExtent = 0.0f;
+
+        // Pending updates
+        std::vector<ISpatialEntity*> m_pendingInserts;
+        std::vector<EntityHandle> m_pendingRemoves;
+        std::vector<ISpatialEntity*> m_pendingUpdates;
+
+        // Statistics
+        size_t m_rebuildCount = 0;
+        size_t m_refitCount = 0;
+        float m_buildTimeMs = 0.0f;
+        float m_refitTimeMs = 0.0f;
+        float m_totalBuildTimeMs = 0.0f;
+        float m_totalRefitTimeMs = 0.0f;
+
+        // Cell management
+        static uint64_t HashCell(const IVec3& coord);
+        IVec3 CellCoord(const Vec3& position) const;
+        AABB CellBounds(const IVec3& coord) const;
+        const Cell* FindCell(const IVec3& coord) const;
+        int FindOrCreateCell(const IVec3& coord);
+        void ExpandCellContent(const EntityRecord& record);
+        void ReleaseEmptyCells();
+        void RecomputeMaxEntitySize();
+
+        // Entity management
+        int AllocateSlot(ISpatialEntity* entity);
+        void Register(int slot);
+        void Unregister(int slot);
+
+        // Query helpers
+        template<typename CellTest, typename EntityTest>
+        void QueryCells(const IVec3& minCell, const IVec3& maxCell,
+            CellTest&& cellTest, EntityTest&& entityTest,
+            const QueryFilter& filter, std::vector<QueryResult>& results) const;
+
+        void AppendResult(int slot, std::vector<QueryResult>& results) const;
+    };
+
+} // namespace RVX::Spatial
@@ -26,6 +26,17 @@ namespace RVX::Spatial
         int maxDepth = 0;
         float avgEntitiesPerLeaf = 0.0f;
         float buildTimeMs = 0.0f;
+
+        // Incremental update statistics (cumulative since construction)
+        size_t rebuildCount = 0;        ///< Full rebuilds performed
+        size_t refitCount = 0;          ///< Incremental commits (refit / insert / remove)
+        size_t rotationCount = 0;       ///< Tree rotations applied while refitting
+        float refitTimeMs = 0.0f;       ///< Duration of the last incremental commit
+        float totalBuildTimeMs = 0.0f;
+        float totalRefitTimeMs = 0.0f;
+
+        /// Current SAH cost relative to the last full build (1.0 = freshly built)
+        float qualityRatio = 1.0f;
     };
 
     /**
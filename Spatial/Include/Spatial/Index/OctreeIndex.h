@@ -0,0 +1,169 @@
+#pragma once
+
+/**
+ * @file OctreeIndex.h
+ * @brief Loose octree spatial index implementation
+ */
+
+#include "Spatial/Index/ISpatialIndex.h"
+#include <unordered_map>
+
+namespace RVX::Spatial
+{
+    /**
+     * @brief Octree configuration
+     */
+    struct OctreeConfig
+    {
+        /// Initial root bounds (invalid = derived from the first entities, grows on demand)
+        AABB worldBounds;
+
+        /// Loose factor: node bounds are expanded by this factor around their center
+        float looseness = 2.0f;
+
+        /// Maximum subdivision depth
+        int maxDepth = 10;
+
+        /// Entities a node holds before it is split into children
+        int maxEntitiesPerNode = 8;
+
+        /// Nodes are never subdivided below this half-size
+        float minHalfSize = 0.5f;
+    };
+
+    /**
+     * @brief Loose octree spatial index
+     *
+     * Features:
+     * - Each entity lives in exactly one node (no duplication)
+     * - O(depth) insert/remove/update; updates that stay inside the
+     *   node's loose bounds do not touch the tree at all
+     * - Root grows automatically to cover entities outside the world bounds
+     * - Fully-contained frustum nodes skip per-entity tests
+     */
+    class OctreeIndex : public ISpatialIndex
+    {
+    public:
+        explicit OctreeIndex(const OctreeConfig& config = {});
+        ~OctreeIndex() override;
+
+        // =====================================================================
+        // ISpatialIndex Implementation
+        // =====================================================================
+
+        void Build(std::span<ISpatialEntity*> entities) override;
+        void Clear() override;
+        void Insert(ISpatialEntity* entity) override;
+        void Remove(EntityHandle handle) override;
+        void Update(ISpatialEntity* entity) override;
+        void Commit() override;
+
+        void QueryFrustum(
+            const Frustum& frustum,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        void QueryBox(
+            const AABB& box,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        void QuerySphere(
+            const Vec3& center,
+            float radius,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        bool QueryRay(
+            const Ray& ray,
+            const QueryFilter& filter,
+            QueryResult& outResult) const override;
+
+        void QueryRayAll(
+            const Ray& ray,
+            const QueryFilter& filter,
+            std::vector<QueryResult>& outResults) const override;
+
+        IndexStats GetStats() const override;
+        void DebugDraw(IDebugRenderer* renderer, int maxDepth = -1) const override;
+
+        size_t GetEntityCount() const override { return m_entityIndex.size(); }
+        AABB GetWorldBounds() const override;
+
+    private:
+        struct Node
+        {
+            Vec3 center{0.0f};
+            float halfSize = 0.0f;
+            AABB looseBounds;
+            int parent = -1;
+            int firstChild = -1;      // 8 contiguous children, -1 means leaf
+            int depth = 0;
+            int subtreeCount = 0;     // entities in this node and all descendants
+            std::vector<int> slots;   // entities stored directly in this node
+
+            bool IsLeaf() const { return firstChild < 0; }
+        };
+
+        struct EntityRecord
+        {
+            ISpatialEntity* entity = nullptr;
+            AABB bounds;
+            int node = -1;
+            int indexInNode = -1;
+        };
+
+        OctreeConfig m_config;
+        std::vector<Node> m_nodes;            // node 0 is always the root
+        std::vector<int> m_freeChildBlocks;   // first index of released 8-node blocks
+        std::vector<EntityRecord> m_records;
+        std::vector<int> m_freeSlots;
+        std::unordered_map<EntityHandle, int> m_entityIndex;
+
+        // Pending updates
+        std::vector<ISpatialEntity*> m_pendingInserts;
+        std::vector<EntityHandle> m_pendingRemoves;
+        std::vector<ISpatialEntity*> m_pendingUpdates;
+
+        // Statistics
+        size_t m_rebuildCount = 0;
+        size_t m_refitCount = 0;
+        float m_buildTimeMs = 0.0f;
+        float m_refitTimeMs = 0.0f;
+        float m_totalBuildTimeMs = 0.0f;
+        float m_totalRefitTimeMs = 0.0f;
+
+        // Tree management
+        void InitRoot(const Vec3& center, float halfSize);
+        void GrowRoot(const AABB& bounds);
+        int AllocateChildBlock(int parentIdx);
+        void SplitNode(int nodeIdx);
+        void CollapseNode(int nodeIdx);
+        void SetNodeExtent(int nodeIdx, const Vec3& center, float halfSize, int depth);
+        int ChildIndexFor(const Node& node, const Vec3& point) const;
+        bool CanSplit(const Node& node) const;
+        bool FitsInChildren(const Node& node, const AABB& bounds) const;
+        int FindTargetNode(const AABB& bounds) const;
+
+        // Entity management
+        void InsertRecord(int slot);
+        void AttachToNode(int slot, int nodeIdx);
+        void DetachFromNode(int slot);
+        void AdjustSubtreeCount(int nodeIdx, int delta);
+
+        // Query helpers
+        void QueryFrustumRecursive(int nodeIdx, const Frustum& frustum, bool fullyInside,
+            const QueryFilter& filter, std::vector<QueryResult>& results) const;
+        void QueryBoxRecursive(int nodeIdx, const AABB& box,
+            const QueryFilter& filter, std::vector<QueryResult>& results) const;
+        void QuerySphereRecursive(int nodeIdx, const Sphere& sphere,
+            const QueryFilter& filter, std::vector<QueryResult>& results) const;
+        void QueryRayRecursive(int nodeIdx, const Ray& ray,
+            const QueryFilter& filter, float& closestT, QueryResult& result, bool& hit) const;
+        void QueryRayAllRecursive(int nodeIdx, const Ray& ray,
+            const QueryFilter& filter, std::vector<QueryResult>& results) const;
+
+        void AppendResult(int slot, std::vector<QueryResult>& results) const;
+    };
+
+} // namespace RVX::Spatial
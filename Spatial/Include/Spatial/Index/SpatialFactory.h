@@ -7,6 +7,8 @@
 
 #include "Spatial/Index/ISpatialIndex.h"
 #include "Spatial/Index/BVHIndex.h"
+#include "Spatial/Index/OctreeIndex.h"
+#include "Spatial/Index/GridIndex.h"
 #include <string>
 
 namespace RVX::Spatial
@@ -17,8 +19,8 @@ namespace RVX::Spatial
     enum class SpatialIndexType
     {
         BVH,        // Bounding Volume Hierarchy (default)
-        Octree,     // Octree (future)
-        Grid        // Uniform grid (future)
+        Octree,     // Loose octree, cheap incremental updates
+        Grid        // Hashed uniform grid, best for many small moving entities
     };
 
     /**
@@ -33,6 +35,12 @@ namespace RVX::Spatial
         /// Create a BVH with specific configuration
         static SpatialIndexPtr CreateBVH(const BVHConfig& config = {});
 
+        /// Create an octree with specific configuration
+        static SpatialIndexPtr CreateOctree(const OctreeConfig& config = {});
+
+        /// Create a uniform grid with specific configuration
+        static SpatialIndexPtr CreateGrid(const GridConfig& config = {});
+
         /// Get name of spatial index type
         static const char* GetTypeName(SpatialIndexType type);
     };
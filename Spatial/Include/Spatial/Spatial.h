@@ -5,7 +5,7 @@
  * @brief Unified header for Spatial module
  * 
  * The Spatial module provides:
- * - Spatial index interfaces and implementations (BVH, Octree)
+ * - Spatial index interfaces and implementations (BVH, Octree, Grid)
  * - Unified query API for culling, picking, and range queries
  * 
  * Note: Geometric primitives (AABB, Sphere, Frustum, Ray) are now in Core/Math.
@@ -22,4 +22,7 @@
 // Index
 #include "Spatial/Index/ISpatialEntity.h"
 #include "Spatial/Index/ISpatialIndex.h"
+#include "Spatial/Index/BVHIndex.h"
+#include "Spatial/Index/OctreeIndex.h"
+#include "Spatial/Index/GridIndex.h"
 #include "Spatial/Index/SpatialFactory.h"
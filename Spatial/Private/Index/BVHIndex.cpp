@@ -1,7 +1,9 @@
 #include "Spatial/Index/BVHIndex.h"
 #include "Spatial/Query/QueryFilter.h"
+#include "Geometry/Batch/BatchIntersect.h"
 #include <algorithm>
 #include <chrono>
+#include <limits>
 
 namespace RVX::Spatial
 {
@@ -21,64 +23,160 @@ void BVHIndex::Build(std::span<ISpatialEntity*> entities)
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Copy entities and create primitive indices
-    m_entities.assign(entities.begin(), entities.end());
+    // Copy entities, cache their bounds and create primitive indices
+    m_entities.reserve(entities.size());
+    for (auto* entity : entities)
+    {
+        if (entity) m_entities.push_back(entity);
+    }
+    m_entityBounds.resize(m_entities.size());
+    m_entityLeaf.assign(m_entities.size(), -1);
     m_primitiveIndices.resize(m_entities.size());
     
     for (size_t i = 0; i < m_entities.size(); ++i)
     {
         m_primitiveIndices[i] = static_cast<int>(i);
+        m_entityBounds[i] = m_entities[i]->GetWorldBounds();
         m_entityIndex[m_entities[i]->GetHandle()] = i;
     }
 
-    // Reserve nodes (worst case: 2n-1 nodes for n primitives)
-    m_nodes.reserve(2 * m_entities.size());
+    if (!m_entities.empty())
+    {
+        // Reserve nodes (worst case: 2n-1 nodes for n primitives)
+        m_nodes.reserve(2 * m_entities.size());
+
+        // Build recursively
+        m_root = BuildRecursive(0, static_cast<int>(m_primitiveIndices.size()), -1, 0);
+        m_buildSAHCost = GetSAHCost();
+    }
 
-    // Build recursively
-    BuildRecursive(0, static_cast<int>(m_primitiveIndices.size()), 0);
+    Flatten();
 
     auto endTime = std::chrono::high_resolution_clock::now();
-    float buildTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-
-    // Store build time in stats (we'd need a member for this)
-    (void)buildTime;
+    m_buildTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalBuildTimeMs += m_buildTimeMs;
+    m_rebuildCount++;
 }
 
 void BVHIndex::Clear()
 {
     m_nodes.clear();
+    m_freeNodes.clear();
+    m_root = -1;
     m_entities.clear();
+    m_entityBounds.clear();
+    m_entityLeaf.clear();
+    m_freeSlots.clear();
     m_primitiveIndices.clear();
     m_entityIndex.clear();
+    m_deadPrimitiveCount = 0;
+    m_flatNodes.clear();
+    m_packets.clear();
+    m_nodeFlatLane.clear();
+    m_slotPacketLane.clear();
+    m_flatDirty = false;
     m_pendingInserts.clear();
     m_pendingRemoves.clear();
-    m_needsRebuild = false;
+    m_pendingUpdates.clear();
+    m_sahAccum = 0.0f;
+    m_buildSAHCost = 0.0f;
 }
 
 void BVHIndex::Insert(ISpatialEntity* entity)
 {
     if (!entity) return;
     m_pendingInserts.push_back(entity);
-    m_needsRebuild = true;
 }
 
 void BVHIndex::Remove(EntityHandle handle)
 {
+    // Removals are applied before insertions, so drop an earlier pending insert
+    m_pendingInserts.erase(
+        std::remove_if(m_pendingInserts.begin(), m_pendingInserts.end(),
+            [handle](ISpatialEntity* entity) { return entity->GetHandle() == handle; }),
+        m_pendingInserts.end());
     m_pendingRemoves.push_back(handle);
-    m_needsRebuild = true;
 }
 
 void BVHIndex::Update(ISpatialEntity* entity)
 {
     if (!entity) return;
-    // For now, mark for rebuild
-    // TODO: Implement incremental update
-    m_needsRebuild = true;
+    m_pendingUpdates.push_back(entity);
 }
 
 void BVHIndex::Commit()
 {
-    if (!m_needsRebuild) return;
+    if (m_pendingInserts.empty() && m_pendingRemoves.empty() && m_pendingUpdates.empty())
+    {
+        return;
+    }
+
+    // Large batches are cheaper (and produce a better tree) as a full rebuild
+    const size_t changeCount = m_pendingInserts.size() + m_pendingRemoves.size() + m_pendingUpdates.size();
+    const float changeRatio = static_cast<float>(changeCount) /
+                              std::max(1.0f, static_cast<float>(m_entityIndex.size()));
+
+    if (m_root < 0 || changeRatio > m_config.maxIncrementalRatio)
+    {
+        RebuildFromLiveEntities();
+        return;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Process removals
+    for (auto handle : m_pendingRemoves)
+    {
+        RemoveLeaf(handle);
+    }
+    m_pendingRemoves.clear();
+
+    // Refit moved entities; entities unknown to the index are ignored
+    for (auto* entity : m_pendingUpdates)
+    {
+        auto it = m_entityIndex.find(entity->GetHandle());
+        if (it == m_entityIndex.end()) continue;
+
+        const size_t slot = it->second;
+        m_entities[slot] = entity;
+        SetEntityBounds(slot, entity->GetWorldBounds());
+        RefitUpwards(m_entityLeaf[slot]);
+    }
+    m_pendingUpdates.clear();
+
+    // Process insertions
+    for (auto* entity : m_pendingInserts)
+    {
+        InsertLeaf(entity);
+    }
+    m_pendingInserts.clear();
+
+    // Rebuild once refits have degraded the tree or fragmented the primitive list
+    const bool degraded = m_buildSAHCost > 0.0f &&
+                          GetSAHCost() > m_buildSAHCost * m_config.rebuildQualityThreshold;
+    const bool fragmented = m_deadPrimitiveCount > m_entityIndex.size() + 64;
+
+    // Pure refits were already patched into the flat tree; a rebuild flattens on its own
+    if (m_flatDirty && !degraded && !fragmented)
+    {
+        Flatten();
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_refitTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalRefitTimeMs += m_refitTimeMs;
+    m_refitCount++;
+
+    if (degraded || fragmented)
+    {
+        RebuildFromLiveEntities();
+    }
+}
+
+void BVHIndex::RebuildFromLiveEntities()
+{
+    std::vector<ISpatialEntity*> liveEntities;
+    liveEntities.reserve(m_entityIndex.size() + m_pendingInserts.size());
 
     // Process removals
     for (auto handle : m_pendingRemoves)
@@ -86,50 +184,440 @@ void BVHIndex::Commit()
         auto it = m_entityIndex.find(handle);
         if (it != m_entityIndex.end())
         {
-            size_t idx = it->second;
-            m_entities[idx] = nullptr;
+            m_entities[it->second] = nullptr;
             m_entityIndex.erase(it);
         }
     }
-    m_pendingRemoves.clear();
 
-    // Compact and add insertions
-    std::vector<ISpatialEntity*> newEntities;
+    // Compact and add insertions (skip entities that are already indexed)
     for (auto* entity : m_entities)
     {
-        if (entity) newEntities.push_back(entity);
+        if (entity) liveEntities.push_back(entity);
     }
     for (auto* entity : m_pendingInserts)
     {
-        if (entity) newEntities.push_back(entity);
+        if (entity && m_entityIndex.find(entity->GetHandle()) == m_entityIndex.end())
+        {
+            liveEntities.push_back(entity);
+        }
     }
-    m_pendingInserts.clear();
 
-    // Rebuild
-    Build(newEntities);
-    m_needsRebuild = false;
+    // Build() clears all pending work
+    Build(liveEntities);
 }
 
-int BVHIndex::BuildRecursive(int start, int end, int depth)
+// =============================================================================
+// Incremental Update
+// =============================================================================
+
+int BVHIndex::AllocateNode()
 {
-    int nodeIdx = static_cast<int>(m_nodes.size());
+    if (!m_freeNodes.empty())
+    {
+        int nodeIdx = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[nodeIdx] = Node{};
+        return nodeIdx;
+    }
+
     m_nodes.emplace_back();
+    return static_cast<int>(m_nodes.size()) - 1;
+}
+
+void BVHIndex::FreeNode(int nodeIdx)
+{
+    m_nodes[nodeIdx] = Node{};
+    m_freeNodes.push_back(nodeIdx);
+}
+
+size_t BVHIndex::AllocateSlot(ISpatialEntity* entity)
+{
+    size_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        m_entities[slot] = entity;
+        m_entityBounds[slot] = entity->GetWorldBounds();
+        m_entityLeaf[slot] = -1;
+    }
+    else
+    {
+        slot = m_entities.size();
+        m_entities.push_back(entity);
+        m_entityBounds.push_back(entity->GetWorldBounds());
+        m_entityLeaf.push_back(-1);
+    }
+
+    m_entityIndex[entity->GetHandle()] = slot;
+    return slot;
+}
+
+void BVHIndex::InsertLeaf(ISpatialEntity* entity)
+{
+    if (!entity) return;
+
+    // Re-inserting an indexed entity is treated as a move
+    auto existing = m_entityIndex.find(entity->GetHandle());
+    if (existing != m_entityIndex.end())
+    {
+        const size_t slot = existing->second;
+        m_entities[slot] = entity;
+        SetEntityBounds(slot, entity->GetWorldBounds());
+        RefitUpwards(m_entityLeaf[slot]);
+        return;
+    }
+
+    m_flatDirty = true;
+    const size_t slot = AllocateSlot(entity);
+    const AABB& bounds = m_entityBounds[slot];
+
+    if (m_root < 0)
+    {
+        m_root = AllocateNode();
+        Node& leaf = m_nodes[m_root];
+        leaf.firstPrimitive = static_cast<int>(m_primitiveIndices.size());
+        leaf.primitiveCount = 1;
+        m_primitiveIndices.push_back(static_cast<int>(slot));
+        m_entityLeaf[slot] = m_root;
+        SetNodeBounds(m_root, bounds);
+        m_buildSAHCost = GetSAHCost();
+        return;
+    }
+
+    // Descend towards the cheapest sibling (branch cost = area growth it causes)
+    int sibling = m_root;
+    while (!m_nodes[sibling].IsLeaf())
+    {
+        const Node& node = m_nodes[sibling];
+        const float area = node.bounds.SurfaceArea();
+        const float combinedArea = node.bounds.Union(bounds).SurfaceArea();
+
+        // Cost of pairing with this node, and the growth every descendant inherits
+        const float pairCost = 2.0f * combinedArea;
+        const float inheritedCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int childIdx) {
+            const Node& child = m_nodes[childIdx];
+            const float enlarged = child.bounds.Union(bounds).SurfaceArea();
+            return child.IsLeaf() ? enlarged + inheritedCost
+                                  : enlarged - child.bounds.SurfaceArea() + inheritedCost;
+        };
+
+        const float leftCost = childCost(node.leftChild);
+        const float rightCost = childCost(node.rightChild);
+
+        if (pairCost < leftCost && pairCost < rightCost) break;
+
+        sibling = leftCost < rightCost ? node.leftChild : node.rightChild;
+    }
+
+    // Grow a leaf that still has room; relocate its range to the end of the primitive list
+    if (m_nodes[sibling].IsLeaf() && m_nodes[sibling].primitiveCount < m_config.maxLeafSize)
+    {
+        Node& leaf = m_nodes[sibling];
+        const int end = leaf.firstPrimitive + leaf.primitiveCount;
+        if (end != static_cast<int>(m_primitiveIndices.size()))
+        {
+            const int newFirst = static_cast<int>(m_primitiveIndices.size());
+            for (int i = leaf.firstPrimitive; i < end; ++i)
+            {
+                m_primitiveIndices.push_back(m_primitiveIndices[i]);
+            }
+            m_deadPrimitiveCount += leaf.primitiveCount;
+            leaf.firstPrimitive = newFirst;
+        }
+
+        m_sahAccum -= NodeCost(leaf);
+        m_primitiveIndices.push_back(static_cast<int>(slot));
+        leaf.primitiveCount++;
+        m_sahAccum += NodeCost(leaf);
+
+        m_entityLeaf[slot] = sibling;
+        RefitUpwards(sibling);
+        return;
+    }
+
+    // Otherwise pair the sibling with a new single-entity leaf under a new parent
+    const int newLeaf = AllocateNode();
+    m_nodes[newLeaf].firstPrimitive = static_cast<int>(m_primitiveIndices.size());
+    m_nodes[newLeaf].primitiveCount = 1;
+    m_primitiveIndices.push_back(static_cast<int>(slot));
+    m_entityLeaf[slot] = newLeaf;
+    SetNodeBounds(newLeaf, bounds);
+
+    const int oldParent = m_nodes[sibling].parent;
+    const int newParent = AllocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].leftChild = sibling;
+    m_nodes[newParent].rightChild = newLeaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[newLeaf].parent = newParent;
+    SetNodeBounds(newParent, m_nodes[sibling].bounds.Union(bounds));
+
+    if (oldParent < 0)
+    {
+        m_root = newParent;
+    }
+    else
+    {
+        ReplaceChild(oldParent, sibling, newParent);
+        RefitUpwards(oldParent);
+    }
+}
+
+void BVHIndex::RemoveLeaf(EntityHandle handle)
+{
+    auto it = m_entityIndex.find(handle);
+    if (it == m_entityIndex.end()) return;
+
+    const size_t slot = it->second;
+    const int leafIdx = m_entityLeaf[slot];
+    m_flatDirty = true;
+    m_entityIndex.erase(it);
+    m_entities[slot] = nullptr;
+    m_entityLeaf[slot] = -1;
+    m_freeSlots.push_back(slot);
+
+    // Swap-remove the primitive from the leaf's range
+    Node& leaf = m_nodes[leafIdx];
+    const int last = leaf.firstPrimitive + leaf.primitiveCount - 1;
+    for (int i = leaf.firstPrimitive; i <= last; ++i)
+    {
+        if (m_primitiveIndices[i] == static_cast<int>(slot))
+        {
+            std::swap(m_primitiveIndices[i], m_primitiveIndices[last]);
+            break;
+        }
+    }
+
+    m_sahAccum -= NodeCost(leaf);
+    leaf.primitiveCount--;
+    m_deadPrimitiveCount++;
+
+    if (leaf.primitiveCount == 0)
+    {
+        RemoveEmptyLeafNode(leafIdx);
+    }
+    else
+    {
+        m_sahAccum += NodeCost(leaf);
+        RefitUpwards(leafIdx);
+    }
+}
+
+void BVHIndex::RemoveEmptyLeafNode(int leafIdx)
+{
+    // The leaf's cost has already been removed from m_sahAccum
+    const int parent = m_nodes[leafIdx].parent;
+    FreeNode(leafIdx);
+
+    if (parent < 0)
+    {
+        m_root = -1;
+        return;
+    }
+
+    // Collapse the parent: the sibling takes its place
+    const int sibling = m_nodes[parent].leftChild == leafIdx
+        ? m_nodes[parent].rightChild
+        : m_nodes[parent].leftChild;
+    const int grandParent = m_nodes[parent].parent;
+
+    m_sahAccum -= NodeCost(m_nodes[parent]);
+    FreeNode(parent);
+    m_nodes[sibling].parent = grandParent;
+
+    if (grandParent < 0)
+    {
+        m_root = sibling;
+    }
+    else
+    {
+        ReplaceChild(grandParent, parent, sibling);
+        RefitUpwards(grandParent);
+    }
+}
+
+void BVHIndex::RefitUpwards(int nodeIdx)
+{
+    while (nodeIdx >= 0)
+    {
+        const AABB bounds = ComputeNodeBounds(nodeIdx);
+        const AABB& current = m_nodes[nodeIdx].bounds;
+
+        // Ancestors are already consistent once a node stops changing
+        if (bounds.GetMin() == current.GetMin() && bounds.GetMax() == current.GetMax())
+        {
+            break;
+        }
+
+        SetNodeBounds(nodeIdx, bounds);
+
+        if (m_config.enableRotations && !m_nodes[nodeIdx].IsLeaf())
+        {
+            TryRotate(nodeIdx);
+        }
+
+        nodeIdx = m_nodes[nodeIdx].parent;
+    }
+}
+
+void BVHIndex::TryRotate(int nodeIdx)
+{
+    // Swap one child with a grandchild on the other side when that shrinks
+    // the other side's bounds (Kopta et al., "Fast, Effective BVH Updates")
+    const Node& node = m_nodes[nodeIdx];
+    const int children[2] = {node.leftChild, node.rightChild};
+
+    float bestGain = 0.0f;
+    int bestChild = -1;
+    int bestParent = -1;
+    int bestGrandChild = -1;
+
+    for (int side = 0; side < 2; ++side)
+    {
+        const int child = children[side];
+        const int other = children[1 - side];
+        const Node& otherNode = m_nodes[other];
+        if (otherNode.IsLeaf()) continue;
+
+        const float otherArea = otherNode.bounds.SurfaceArea();
+        const int grandChildren[2] = {otherNode.leftChild, otherNode.rightChild};
+
+        for (int g = 0; g < 2; ++g)
+        {
+            // After swapping child <-> grandChildren[g], 'other' bounds the child and the remaining grandchild
+            const AABB rotated = m_nodes[child].bounds.Union(m_nodes[grandChildren[1 - g]].bounds);
+            const float gain = otherArea - rotated.SurfaceArea();
+            if (gain > bestGain)
+            {
+                bestGain = gain;
+                bestChild = child;
+                bestParent = other;
+                bestGrandChild = grandChildren[g];
+            }
+        }
+    }
+
+    if (bestChild < 0) return;
+
+    m_flatDirty = true;
+    ReplaceChild(nodeIdx, bestChild, bestGrandChild);
+    m_nodes[bestGrandChild].parent = nodeIdx;
+    ReplaceChild(bestParent, bestGrandChild, bestChild);
+    m_nodes[bestChild].parent = bestParent;
+    SetNodeBounds(bestParent, ComputeNodeBounds(bestParent));
+
+    m_rotationCount++;
+}
+
+void BVHIndex::ReplaceChild(int parentIdx, int oldChild, int newChild)
+{
+    Node& parent = m_nodes[parentIdx];
+    if (parent.leftChild == oldChild)
+    {
+        parent.leftChild = newChild;
+    }
+    else
+    {
+        parent.rightChild = newChild;
+    }
+}
+
+AABB BVHIndex::ComputeNodeBounds(int nodeIdx) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (!node.IsLeaf())
+    {
+        return m_nodes[node.leftChild].bounds.Union(m_nodes[node.rightChild].bounds);
+    }
+
+    AABB bounds;
+    for (int i = 0; i < node.primitiveCount; ++i)
+    {
+        bounds.Expand(m_entityBounds[m_primitiveIndices[node.firstPrimitive + i]]);
+    }
+    return bounds;
+}
+
+void BVHIndex::SetNodeBounds(int nodeIdx, const AABB& bounds)
+{
     Node& node = m_nodes[nodeIdx];
+    m_sahAccum -= NodeCost(node);
+    node.bounds = bounds;
+    m_sahAccum += NodeCost(node);
+
+    // Keep the flat copy in sync while the topology is unchanged
+    if (!m_flatDirty && nodeIdx < static_cast<int>(m_nodeFlatLane.size()))
+    {
+        const int lane = m_nodeFlatLane[nodeIdx];
+        if (lane >= 0)
+        {
+            m_flatNodes[lane >> 2].bounds.SetLane(lane & 3, bounds);
+        }
+    }
+}
+
+void BVHIndex::SetEntityBounds(size_t slot, const AABB& bounds)
+{
+    m_entityBounds[slot] = bounds;
+
+    if (!m_flatDirty && slot < m_slotPacketLane.size())
+    {
+        const int lane = m_slotPacketLane[slot];
+        if (lane >= 0)
+        {
+            m_packets[lane >> 2].bounds.SetLane(lane & 3, bounds);
+        }
+    }
+}
+
+float BVHIndex::NodeCost(const Node& node) const
+{
+    const float weight = node.IsLeaf()
+        ? node.primitiveCount * m_config.intersectionCost
+        : m_config.traversalCost;
+    return node.bounds.SurfaceArea() * weight;
+}
+
+float BVHIndex::GetSAHCost() const
+{
+    if (m_root < 0) return 0.0f;
+    const float rootArea = m_nodes[m_root].bounds.SurfaceArea();
+    return rootArea > 0.0f ? m_sahAccum / rootArea : 0.0f;
+}
+
+// =============================================================================
+// Build
+// =============================================================================
+
+int BVHIndex::BuildRecursive(int start, int end, int parent, int depth)
+{
+    const int nodeIdx = AllocateNode();
+    m_nodes[nodeIdx].parent = parent;
 
     // Compute bounds
-    node.bounds.Reset();
+    AABB bounds;
     for (int i = start; i < end; ++i)
     {
-        node.bounds.Expand(m_entities[m_primitiveIndices[i]]->GetWorldBounds());
+        bounds.Expand(m_entityBounds[m_primitiveIndices[i]]);
     }
+    m_nodes[nodeIdx].bounds = bounds;
 
     int primitiveCount = end - start;
 
     // Create leaf if few primitives
     if (primitiveCount <= m_config.maxLeafSize)
     {
+        Node& node = m_nodes[nodeIdx];
         node.firstPrimitive = start;
         node.primitiveCount = primitiveCount;
+        for (int i = start; i < end; ++i)
+        {
+            m_entityLeaf[m_primitiveIndices[i]] = nodeIdx;
+        }
+        m_sahAccum += NodeCost(node);
         return nodeIdx;
     }
 
@@ -144,10 +632,10 @@ int BVHIndex::BuildRecursive(int start, int end, int depth)
     else
     {
         // Simple median split on longest axis
-        Vec3 size = node.bounds.GetSize();
+        Vec3 size = bounds.GetSize();
         if (size.y > size.x && size.y > size.z) bestAxis = 1;
         else if (size.z > size.x) bestAxis = 2;
-        bestPos = node.bounds.GetCenter()[bestAxis];
+        bestPos = bounds.GetCenter()[bestAxis];
     }
 
     // Partition primitives
@@ -159,9 +647,12 @@ int BVHIndex::BuildRecursive(int start, int end, int depth)
         mid = (start + end) / 2;
     }
 
-    // Build children
-    node.leftChild = BuildRecursive(start, mid, depth + 1);
-    node.rightChild = BuildRecursive(mid, end, depth + 1);
+    // Build children (recursion may reallocate m_nodes, so no references are held)
+    const int leftChild = BuildRecursive(start, mid, nodeIdx, depth + 1);
+    const int rightChild = BuildRecursive(mid, end, nodeIdx, depth + 1);
+    m_nodes[nodeIdx].leftChild = leftChild;
+    m_nodes[nodeIdx].rightChild = rightChild;
+    m_sahAccum += NodeCost(m_nodes[nodeIdx]);
 
     return nodeIdx;
 }
@@ -176,7 +667,7 @@ int BVHIndex::FindBestSplit(int start, int end, int& outAxis, float& outPos)
     AABB parentBounds;
     for (int i = start; i < end; ++i)
     {
-        parentBounds.Expand(m_entities[m_primitiveIndices[i]]->GetWorldBounds());
+        parentBounds.Expand(m_entityBounds[m_primitiveIndices[i]]);
     }
 
     float parentArea = parentBounds.SurfaceArea();
@@ -203,7 +694,7 @@ int BVHIndex::FindBestSplit(int start, int end, int& outAxis, float& outPos)
 
             for (int i = start; i < end; ++i)
             {
-                AABB primBounds = m_entities[m_primitiveIndices[i]]->GetWorldBounds();
+                const AABB& primBounds = m_entityBounds[m_primitiveIndices[i]];
                 float center = primBounds.GetCenter()[axis];
 
                 if (center < splitPos)
@@ -253,7 +744,7 @@ int BVHIndex::Partition(int start, int end, int axis, float splitPos)
 
     while (left <= right)
     {
-        float centerLeft = m_entities[m_primitiveIndices[left]]->GetWorldBounds().GetCenter()[axis];
+        float centerLeft = m_entityBounds[m_primitiveIndices[left]].GetCenter()[axis];
         
         if (centerLeft < splitPos)
         {
@@ -269,219 +760,440 @@ int BVHIndex::Partition(int start, int end, int axis, float splitPos)
     return left;
 }
 
-void BVHIndex::QueryFrustum(
-    const Frustum& frustum,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& outResults) const
+// =============================================================================
+// Flattening (BVH4)
+// =============================================================================
+
+void BVHIndex::BoundsSoA4::SetLane(int lane, const AABB& bounds)
 {
-    if (m_nodes.empty()) return;
-    QueryFrustumRecursive(0, frustum, filter, outResults);
+    if (!bounds.IsValid())
+    {
+        ClearLane(lane);
+        return;
+    }
+
+    minX[lane] = bounds.GetMin().x;
+    minY[lane] = bounds.GetMin().y;
+    minZ[lane] = bounds.GetMin().z;
+    maxX[lane] = bounds.GetMax().x;
+    maxY[lane] = bounds.GetMax().y;
+    maxZ[lane] = bounds.GetMax().z;
+    laneMask |= 1u << lane;
 }
 
-void BVHIndex::QueryFrustumRecursive(
-    int nodeIdx,
-    const Frustum& frustum,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& results) const
+void BVHIndex::BoundsSoA4::ClearLane(int lane)
 {
-    const Node& node = m_nodes[nodeIdx];
+    // Inverted box: rejected by the overlap, sphere and frustum tests even without the mask
+    constexpr float kEmpty = 1e30f;
+    minX[lane] = minY[lane] = minZ[lane] = kEmpty;
+    maxX[lane] = maxY[lane] = maxZ[lane] = -kEmpty;
+    laneMask &= ~(1u << lane);
+}
+
+void BVHIndex::Flatten()
+{
+    m_flatNodes.clear();
+    m_packets.clear();
+    m_nodeFlatLane.assign(m_nodes.size(), -1);
+    m_slotPacketLane.assign(m_entities.size(), -1);
+    m_flatDirty = false;
+
+    if (m_root < 0) return;
+
+    if (m_nodes[m_root].IsLeaf())
+    {
+        // A single leaf still gets a root node so traversal has one entry point
+        FlatNode root;
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            root.bounds.ClearLane(lane);
+            root.child[lane] = -1;
+            root.primitiveCount[lane] = 0;
+        }
+
+        root.bounds.SetLane(0, m_nodes[m_root].bounds);
+        root.child[0] = FlattenLeaf(m_root);
+        root.primitiveCount[0] = m_nodes[m_root].primitiveCount;
+        m_flatNodes.push_back(root);
+        m_nodeFlatLane[m_root] = 0;
+        return;
+    }
+
+    FlattenRecursive(m_root);
+}
 
-    // Check frustum intersection
-    auto intersection = frustum.Intersects(node.bounds);
-    if (intersection == IntersectionResult::Outside) return;
+int BVHIndex::FlattenRecursive(int nodeIdx)
+{
+    const int flatIdx = static_cast<int>(m_flatNodes.size());
+    m_flatNodes.emplace_back();
 
-    if (node.IsLeaf())
+    // Collapse up to two more binary levels, always opening the largest inner child
+    int lanes[4] = {m_nodes[nodeIdx].leftChild, m_nodes[nodeIdx].rightChild, -1, -1};
+    int laneCount = 2;
+    while (laneCount < 4)
     {
-        // Test individual primitives
-        for (int i = 0; i < node.primitiveCount; ++i)
+        int expand = -1;
+        float bestArea = -1.0f;
+        for (int i = 0; i < laneCount; ++i)
         {
-            ISpatialEntity* entity = m_entities[m_primitiveIndices[node.firstPrimitive + i]];
-            
-            if (!filter.Accepts(entity)) continue;
-            
-            if (frustum.IsVisible(entity->GetWorldBounds()))
+            const Node& candidate = m_nodes[lanes[i]];
+            if (!candidate.IsLeaf() && candidate.bounds.SurfaceArea() > bestArea)
             {
-                QueryResult result;
-                result.handle = entity->GetHandle();
-                result.userData = entity->GetUserData();
-                results.push_back(result);
+                bestArea = candidate.bounds.SurfaceArea();
+                expand = i;
             }
         }
+        if (expand < 0) break;
+
+        const Node& opened = m_nodes[lanes[expand]];
+        lanes[laneCount++] = opened.rightChild;
+        lanes[expand] = opened.leftChild;
     }
-    else
+
+    // Children are emitted depth-first, so a subtree occupies a contiguous range
+    for (int lane = 0; lane < 4; ++lane)
     {
-        QueryFrustumRecursive(node.leftChild, frustum, filter, results);
-        QueryFrustumRecursive(node.rightChild, frustum, filter, results);
+        int child = -1;
+        int primitiveCount = 0;
+
+        if (lane < laneCount)
+        {
+            const Node& node = m_nodes[lanes[lane]];
+            primitiveCount = node.IsLeaf() ? node.primitiveCount : 0;
+            child = node.IsLeaf() ? FlattenLeaf(lanes[lane]) : FlattenRecursive(lanes[lane]);
+            m_nodeFlatLane[lanes[lane]] = flatIdx * 4 + lane;
+        }
+
+        // Recursion may reallocate m_flatNodes, so the node is looked up again here
+        FlatNode& flat = m_flatNodes[flatIdx];
+        flat.child[lane] = child;
+        flat.primitiveCount[lane] = primitiveCount;
+        if (lane < laneCount)
+        {
+            flat.bounds.SetLane(lane, m_nodes[lanes[lane]].bounds);
+        }
+        else
+        {
+            flat.bounds.ClearLane(lane);
+        }
     }
-}
 
-void BVHIndex::QueryBox(
-    const BoundingBox& box,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& outResults) const
-{
-    if (m_nodes.empty()) return;
-    QueryBoxRecursive(0, box, filter, outResults);
+    return flatIdx;
 }
 
-void BVHIndex::QueryBoxRecursive(
-    int nodeIdx,
-    const BoundingBox& box,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& results) const
+int BVHIndex::FlattenLeaf(int nodeIdx)
 {
     const Node& node = m_nodes[nodeIdx];
+    const int firstPacket = static_cast<int>(m_packets.size());
 
-    if (!node.bounds.Overlaps(box)) return;
-
-    if (node.IsLeaf())
+    for (int i = 0; i < node.primitiveCount; ++i)
     {
-        for (int i = 0; i < node.primitiveCount; ++i)
+        const int lane = i & 3;
+        if (lane == 0)
         {
-            ISpatialEntity* entity = m_entities[m_primitiveIndices[node.firstPrimitive + i]];
-            
-            if (!filter.Accepts(entity)) continue;
-            
-            if (entity->GetWorldBounds().Overlaps(box))
+            m_packets.emplace_back();
+            for (int l = 0; l < 4; ++l)
             {
-                QueryResult result;
-                result.handle = entity->GetHandle();
-                result.userData = entity->GetUserData();
-                results.push_back(result);
+                m_packets.back().bounds.ClearLane(l);
+                m_packets.back().slot[l] = -1;
             }
         }
+
+        const int slot = m_primitiveIndices[node.firstPrimitive + i];
+        PrimitivePacket& packet = m_packets.back();
+        packet.slot[lane] = slot;
+        packet.bounds.SetLane(lane, m_entityBounds[slot]);
+        m_slotPacketLane[slot] = (static_cast<int>(m_packets.size()) - 1) * 4 + lane;
     }
-    else
-    {
-        QueryBoxRecursive(node.leftChild, box, filter, results);
-        QueryBoxRecursive(node.rightChild, box, filter, results);
-    }
-}
 
-void BVHIndex::QuerySphere(
-    const Vec3& center,
-    float radius,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& outResults) const
-{
-    if (m_nodes.empty()) return;
-    QuerySphereRecursive(0, center, radius, filter, outResults);
+    return firstPacket;
 }
 
-void BVHIndex::QuerySphereRecursive(
-    int nodeIdx,
-    const Vec3& center,
-    float radius,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& results) const
+// =============================================================================
+// Queries
+// =============================================================================
+
+namespace
 {
-    const Node& node = m_nodes[nodeIdx];
+    /// Small LIFO for iterative traversal; spills to the heap only for very deep trees
+    template<typename T, int InlineCapacity = 64>
+    class TraversalStack
+    {
+    public:
+        bool Empty() const { return m_size == 0; }
 
-    // Check sphere-box intersection
-    Sphere sphere(center, radius);
-    if (!sphere.Overlaps(node.bounds)) return;
+        void Push(const T& value)
+        {
+            if (m_size < InlineCapacity)
+            {
+                m_inline[m_size] = value;
+            }
+            else
+            {
+                m_overflow.push_back(value);
+            }
+            ++m_size;
+        }
 
-    if (node.IsLeaf())
-    {
-        for (int i = 0; i < node.primitiveCount; ++i)
+        T Pop()
         {
-            ISpatialEntity* entity = m_entities[m_primitiveIndices[node.firstPrimitive + i]];
-            
-            if (!filter.Accepts(entity)) continue;
-            
-            if (sphere.Overlaps(entity->GetWorldBounds()))
+            --m_size;
+            if (m_size < InlineCapacity)
             {
-                QueryResult result;
-                result.handle = entity->GetHandle();
-                result.distance = glm::length(entity->GetWorldBounds().GetCenter() - center);
-                result.sortKey = result.distance;
-                result.userData = entity->GetUserData();
-                results.push_back(result);
+                return m_inline[m_size];
             }
+            T value = m_overflow.back();
+            m_overflow.pop_back();
+            return value;
         }
+
+    private:
+        T m_inline[InlineCapacity];
+        std::vector<T> m_overflow;
+        int m_size = 0;
+    };
+
+    struct RayStackEntry
+    {
+        int node;
+        float tEntry;
+    };
+
+    struct OverlapStackEntry
+    {
+        int node;
+        bool fullyInside;
+    };
+
+    template<typename Bounds>
+    Geometry::SIMD::BatchAABB4 LoadBatch(const Bounds& bounds)
+    {
+        using Geometry::SIMD::Float4;
+
+        Geometry::SIMD::BatchAABB4 batch;
+        batch.minX = Float4::LoadAligned(bounds.minX);
+        batch.minY = Float4::LoadAligned(bounds.minY);
+        batch.minZ = Float4::LoadAligned(bounds.minZ);
+        batch.maxX = Float4::LoadAligned(bounds.maxX);
+        batch.maxY = Float4::LoadAligned(bounds.maxY);
+        batch.maxZ = Float4::LoadAligned(bounds.maxZ);
+        return batch;
     }
-    else
+
+    /// Entry distances for leaf tests are not clamped to tMin, so entities
+    /// containing the ray origin are rejected exactly like the scalar test did
+    Ray UnclampedRay(const Ray& ray)
     {
-        QuerySphereRecursive(node.leftChild, center, radius, filter, results);
-        QuerySphereRecursive(node.rightChild, center, radius, filter, results);
+        Ray unclamped = ray;
+        unclamped.tMin = std::numeric_limits<float>::lowest();
+        return unclamped;
     }
-}
+} // anonymous namespace
 
-bool BVHIndex::QueryRay(
-    const Ray& ray,
-    const QueryFilter& filter,
-    QueryResult& outResult) const
+template<typename BatchTest, typename Emit>
+void BVHIndex::QueryOverlap(BatchTest&& test, Emit&& emit, const QueryFilter& filter) const
 {
-    if (m_nodes.empty()) return false;
+    if (m_flatNodes.empty()) return;
 
-    float closestT = ray.tMax;
-    bool hit = QueryRayRecursive(0, ray, filter, closestT, outResult);
-    
-    if (hit)
+    TraversalStack<OverlapStackEntry> stack;
+    stack.Push({0, false});
+
+    while (!stack.Empty())
     {
-        outResult.distance = closestT;
-        outResult.sortKey = closestT;
+        const OverlapStackEntry entry = stack.Pop();
+        const FlatNode& node = m_flatNodes[entry.node];
+
+        // Children of a fully contained node are contained as well
+        uint32_t hitMask = node.bounds.laneMask;
+        uint32_t insideMask = hitMask;
+        if (!entry.fullyInside)
+        {
+            hitMask &= test(LoadBatch(node.bounds), insideMask);
+            insideMask &= hitMask;
+        }
+
+        // Push in reverse so the first child is visited first
+        for (int lane = 3; lane >= 0; --lane)
+        {
+            if (!(hitMask & (1u << lane))) continue;
+
+            const bool inside = (insideMask & (1u << lane)) != 0;
+            if (node.primitiveCount[lane] == 0)
+            {
+                stack.Push({node.child[lane], inside});
+                continue;
+            }
+
+            const int packetCount = (node.primitiveCount[lane] + 3) / 4;
+            for (int p = 0; p < packetCount; ++p)
+            {
+                const PrimitivePacket& packet = m_packets[node.child[lane] + p];
+
+                uint32_t entityMask = packet.bounds.laneMask;
+                if (!inside)
+                {
+                    uint32_t entityInside;
+                    entityMask &= test(LoadBatch(packet.bounds), entityInside);
+                }
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    if (!(entityMask & (1u << i))) continue;
+
+                    const int slot = packet.slot[i];
+                    if (filter.Accepts(m_entities[slot]))
+                    {
+                        emit(slot);
+                    }
+                }
+            }
+        }
     }
+}
+
+void BVHIndex::AppendResult(int slot, std::vector<QueryResult>& results) const
+{
+    ISpatialEntity* entity = m_entities[slot];
+    QueryResult result;
+    result.handle = entity->GetHandle();
+    result.userData = entity->GetUserData();
+    results.push_back(result);
+}
+
+void BVHIndex::QueryFrustum(
+    const Frustum& frustum,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    QueryOverlap(
+        [&frustum](const Geometry::SIMD::BatchAABB4& boxes, uint32_t& outInside) {
+            return Geometry::SIMD::FrustumBatchAABBTest(frustum, boxes, outInside);
+        },
+        [&](int slot) { AppendResult(slot, outResults); },
+        filter);
+}
+
+void BVHIndex::QueryBox(
+    const BoundingBox& box,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (!box.IsValid()) return;
+
+    QueryOverlap(
+        [&box](const Geometry::SIMD::BatchAABB4& boxes, uint32_t& outInside) {
+            outInside = 0;
+            return Geometry::SIMD::AABBBatchOverlapTest(box, boxes);
+        },
+        [&](int slot) { AppendResult(slot, outResults); },
+        filter);
+}
 
-    return hit;
+void BVHIndex::QuerySphere(
+    const Vec3& center,
+    float radius,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    const Sphere sphere(center, radius);
+    if (!sphere.IsValid()) return;
+
+    QueryOverlap(
+        [&sphere](const Geometry::SIMD::BatchAABB4& boxes, uint32_t& outInside) {
+            outInside = 0;
+            return Geometry::SIMD::SphereBatchAABBTest(sphere, boxes);
+        },
+        [&](int slot) {
+            AppendResult(slot, outResults);
+            outResults.back().distance = glm::length(m_entityBounds[slot].GetCenter() - center);
+            outResults.back().sortKey = outResults.back().distance;
+        },
+        filter);
 }
 
-bool BVHIndex::QueryRayRecursive(
-    int nodeIdx,
+bool BVHIndex::QueryRay(
     const Ray& ray,
     const QueryFilter& filter,
-    float& closestT,
-    QueryResult& result) const
+    QueryResult& outResult) const
 {
-    const Node& node = m_nodes[nodeIdx];
+    if (m_flatNodes.empty()) return false;
 
-    float tMin, tMax;
-    if (!IntersectRayBox(ray, node.bounds, tMin, tMax)) return false;
-    if (tMin > closestT) return false;
+    const Ray leafRay = UnclampedRay(ray);
+    float closestT = ray.tMax;
+    int closestSlot = -1;
 
-    bool hit = false;
+    TraversalStack<RayStackEntry> stack;
+    stack.Push({0, ray.tMin});
 
-    if (node.IsLeaf())
+    while (!stack.Empty())
     {
-        for (int i = 0; i < node.primitiveCount; ++i)
+        const RayStackEntry entry = stack.Pop();
+        if (entry.tEntry > closestT) continue;
+
+        const FlatNode& node = m_flatNodes[entry.node];
+
+        Geometry::SIMD::Float4 tNear, tFar;
+        const uint32_t hitMask = Geometry::SIMD::RayBatchAABBIntersect(ray, LoadBatch(node.bounds), tNear, tFar) &
+                                 node.bounds.laneMask;
+
+        // Leaves are tested right away; inner children are pushed far to near
+        int innerLanes[4];
+        int innerCount = 0;
+
+        for (int lane = 0; lane < 4; ++lane)
         {
-            ISpatialEntity* entity = m_entities[m_primitiveIndices[node.firstPrimitive + i]];
-            
-            if (!filter.Accepts(entity)) continue;
+            if (!(hitMask & (1u << lane)) || tNear[lane] > closestT) continue;
+
+            if (node.primitiveCount[lane] == 0)
+            {
+                innerLanes[innerCount++] = lane;
+                continue;
+            }
 
-            float t1, t2;
-            if (IntersectRayBox(ray, entity->GetWorldBounds(), t1, t2))
+            const int packetCount = (node.primitiveCount[lane] + 3) / 4;
+            for (int p = 0; p < packetCount; ++p)
             {
-                if (t1 < closestT && t1 >= ray.tMin)
+                const PrimitivePacket& packet = m_packets[node.child[lane] + p];
+
+                Geometry::SIMD::Float4 tEnter, tExit;
+                const uint32_t entityMask = Geometry::SIMD::RayBatchAABBIntersect(
+                    leafRay, LoadBatch(packet.bounds), tEnter, tExit) & packet.bounds.laneMask;
+
+                for (int i = 0; i < 4; ++i)
                 {
-                    closestT = t1;
-                    result.handle = entity->GetHandle();
-                    result.userData = entity->GetUserData();
-                    hit = true;
+                    if (!(entityMask & (1u << i))) continue;
+
+                    const float t = tEnter[i];
+                    if (t < ray.tMin || t >= closestT) continue;
+                    if (!filter.Accepts(m_entities[packet.slot[i]])) continue;
+
+                    closestT = t;
+                    closestSlot = packet.slot[i];
                 }
             }
         }
-    }
-    else
-    {
-        // Visit closer child first
-        int firstChild = node.leftChild;
-        int secondChild = node.rightChild;
-
-        float t1Left, t2Left, t1Right, t2Right;
-        bool hitLeft = IntersectRayBox(ray, m_nodes[node.leftChild].bounds, t1Left, t2Left);
-        bool hitRight = IntersectRayBox(ray, m_nodes[node.rightChild].bounds, t1Right, t2Right);
 
-        if (hitLeft && hitRight && t1Right < t1Left)
+        for (int i = 1; i < innerCount; ++i)
         {
-            std::swap(firstChild, secondChild);
+            for (int j = i; j > 0 && tNear[innerLanes[j]] > tNear[innerLanes[j - 1]]; --j)
+            {
+                std::swap(innerLanes[j], innerLanes[j - 1]);
+            }
+        }
+        for (int i = 0; i < innerCount; ++i)
+        {
+            stack.Push({node.child[innerLanes[i]], tNear[innerLanes[i]]});
         }
-
-        if (QueryRayRecursive(firstChild, ray, filter, closestT, result)) hit = true;
-        if (QueryRayRecursive(secondChild, ray, filter, closestT, result)) hit = true;
     }
 
-    return hit;
+    if (closestSlot < 0) return false;
+
+    ISpatialEntity* entity = m_entities[closestSlot];
+    outResult.handle = entity->GetHandle();
+    outResult.userData = entity->GetUserData();
+    outResult.distance = closestT;
+    outResult.sortKey = closestT;
+    return true;
 }
 
 void BVHIndex::QueryRayAll(
@@ -489,77 +1201,82 @@ void BVHIndex::QueryRayAll(
     const QueryFilter& filter,
     std::vector<QueryResult>& outResults) const
 {
-    if (m_nodes.empty()) return;
-    QueryRayAllRecursive(0, ray, filter, outResults);
-    
-    // Sort by distance
-    std::sort(outResults.begin(), outResults.end());
-}
+    if (m_flatNodes.empty()) return;
 
-void BVHIndex::QueryRayAllRecursive(
-    int nodeIdx,
-    const Ray& ray,
-    const QueryFilter& filter,
-    std::vector<QueryResult>& results) const
-{
-    const Node& node = m_nodes[nodeIdx];
+    const Ray leafRay = UnclampedRay(ray);
 
-    float tMin, tMax;
-    if (!IntersectRayBox(ray, node.bounds, tMin, tMax)) return;
+    TraversalStack<int> stack;
+    stack.Push(0);
 
-    if (node.IsLeaf())
+    while (!stack.Empty())
     {
-        for (int i = 0; i < node.primitiveCount; ++i)
+        const FlatNode& node = m_flatNodes[stack.Pop()];
+
+        Geometry::SIMD::Float4 tNear, tFar;
+        const uint32_t hitMask = Geometry::SIMD::RayBatchAABBIntersect(ray, LoadBatch(node.bounds), tNear, tFar) &
+                                 node.bounds.laneMask;
+
+        for (int lane = 0; lane < 4; ++lane)
         {
-            ISpatialEntity* entity = m_entities[m_primitiveIndices[node.firstPrimitive + i]];
-            
-            if (!filter.Accepts(entity)) continue;
+            if (!(hitMask & (1u << lane))) continue;
+
+            if (node.primitiveCount[lane] == 0)
+            {
+                stack.Push(node.child[lane]);
+                continue;
+            }
 
-            float t1, t2;
-            if (IntersectRayBox(ray, entity->GetWorldBounds(), t1, t2))
+            const int packetCount = (node.primitiveCount[lane] + 3) / 4;
+            for (int p = 0; p < packetCount; ++p)
             {
-                if (t1 >= ray.tMin && t1 <= ray.tMax)
+                const PrimitivePacket& packet = m_packets[node.child[lane] + p];
+
+                Geometry::SIMD::Float4 tEnter, tExit;
+                const uint32_t entityMask = Geometry::SIMD::RayBatchAABBIntersect(
+                    leafRay, LoadBatch(packet.bounds), tEnter, tExit) & packet.bounds.laneMask;
+
+                for (int i = 0; i < 4; ++i)
                 {
-                    QueryResult result;
-                    result.handle = entity->GetHandle();
-                    result.distance = t1;
-                    result.sortKey = t1;
-                    result.userData = entity->GetUserData();
-                    results.push_back(result);
+                    if (!(entityMask & (1u << i))) continue;
+
+                    const float t = tEnter[i];
+                    if (t < ray.tMin || t > ray.tMax) continue;
+                    if (!filter.Accepts(m_entities[packet.slot[i]])) continue;
+
+                    AppendResult(packet.slot[i], outResults);
+                    outResults.back().distance = t;
+                    outResults.back().sortKey = t;
                 }
             }
         }
     }
-    else
-    {
-        QueryRayAllRecursive(node.leftChild, ray, filter, results);
-        QueryRayAllRecursive(node.rightChild, ray, filter, results);
-    }
-}
 
-bool BVHIndex::IntersectRayBox(const Ray& ray, const AABB& box, float& tMin, float& tMax) const
-{
-    Vec3 invDir = 1.0f / ray.direction;
-    Vec3 t0 = (box.GetMin() - ray.origin) * invDir;
-    Vec3 t1 = (box.GetMax() - ray.origin) * invDir;
-
-    Vec3 tSmall = glm::min(t0, t1);
-    Vec3 tBig = glm::max(t0, t1);
-
-    tMin = glm::max(glm::max(tSmall.x, tSmall.y), tSmall.z);
-    tMax = glm::min(glm::min(tBig.x, tBig.y), tBig.z);
-
-    return tMax >= tMin && tMax >= 0.0f;
+    // Sort by distance
+    std::sort(outResults.begin(), outResults.end());
 }
 
 IndexStats BVHIndex::GetStats() const
 {
     IndexStats stats;
-    stats.entityCount = m_entities.size();
-    stats.nodeCount = m_nodes.size();
+    stats.entityCount = m_entityIndex.size();
+    stats.nodeCount = m_nodes.size() - m_freeNodes.size();
     stats.memoryBytes = m_nodes.capacity() * sizeof(Node) +
                         m_entities.capacity() * sizeof(ISpatialEntity*) +
-                        m_primitiveIndices.capacity() * sizeof(int);
+                        m_entityBounds.capacity() * sizeof(AABB) +
+                        m_entityLeaf.capacity() * sizeof(int) +
+                        m_primitiveIndices.capacity() * sizeof(int) +
+                        m_flatNodes.capacity() * sizeof(FlatNode) +
+                        m_packets.capacity() * sizeof(PrimitivePacket) +
+                        m_nodeFlatLane.capacity() * sizeof(int) +
+                        m_slotPacketLane.capacity() * sizeof(int);
+    stats.buildTimeMs = m_buildTimeMs;
+    stats.rebuildCount = m_rebuildCount;
+    stats.refitCount = m_refitCount;
+    stats.rotationCount = m_rotationCount;
+    stats.refitTimeMs = m_refitTimeMs;
+    stats.totalBuildTimeMs = m_totalBuildTimeMs;
+    stats.totalRefitTimeMs = m_totalRefitTimeMs;
+    stats.qualityRatio = m_buildSAHCost > 0.0f ? GetSAHCost() / m_buildSAHCost : 1.0f;
 
     // Calculate max depth and avg entities per leaf
     int maxDepth = 0;
@@ -582,9 +1299,9 @@ IndexStats BVHIndex::GetStats() const
         }
     };
 
-    if (!m_nodes.empty())
+    if (m_root >= 0)
     {
-        traverse(0, 0);
+        traverse(m_root, 0);
     }
 
     stats.maxDepth = maxDepth;
@@ -595,7 +1312,7 @@ IndexStats BVHIndex::GetStats() const
 
 void BVHIndex::DebugDraw(IDebugRenderer* renderer, int maxDepth) const
 {
-    if (!renderer || m_nodes.empty()) return;
+    if (!renderer || m_root < 0) return;
 
     std::function<void(int, int)> draw = [&](int nodeIdx, int depth) {
         if (maxDepth >= 0 && depth > maxDepth) return;
@@ -615,13 +1332,13 @@ void BVHIndex::DebugDraw(IDebugRenderer* renderer, int maxDepth) const
         }
     };
 
-    draw(0, 0);
+    draw(m_root, 0);
 }
 
 AABB BVHIndex::GetWorldBounds() const
 {
-    if (m_nodes.empty()) return AABB();
-    return m_nodes[0].bounds;
+    if (m_root < 0) return AABB();
+    return m_nodes[m_root].bounds;
 }
 
 // QueryFilter implementation
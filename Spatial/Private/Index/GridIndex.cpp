@@ -0,0 +1,860 @@
+#include "Spatial/Index/GridIndex.h"
+#include "Spatial/Query/QueryFilter.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+
+namespace RVX::Spatial
+{
+
+namespace
+{
+    // Cell coordinates are packed into 21 bits per axis for hashing
+    constexpr int kCellCoordLimit = (1 << 20) - 1;
+
+    // Cells are culled hierarchically: blocks of 16^3, then 4^3, then single cells
+    constexpr int kCellBlockSize = 4;
+    constexpr int kTopBlockSize = kCellBlockSize * kCellBlockSize;
+
+    enum class CellOverlap
+    {
+        Outside,
+        Partial,
+        Inside
+    };
+
+    /// Entry distance of a ray into a box. Matches BVHIndex: boxes that contain
+    /// the ray origin are not reported, hits must enter within [tMin, tMax].
+    bool RayEntryDistance(const Ray& ray, const AABB& box, float& outT)
+    {
+        const Vec3 invDir = ray.GetInverseDirection();
+        const Vec3 t0 = (box.GetMin() - ray.origin) * invDir;
+        const Vec3 t1 = (box.GetMax() - ray.origin) * invDir;
+        const Vec3 tSmall = glm::min(t0, t1);
+        const Vec3 tBig = glm::max(t0, t1);
+
+        outT = std::max(std::max(tSmall.x, tSmall.y), tSmall.z);
+        const float tExit = std::min(std::min(tBig.x, tBig.y), tBig.z);
+        return tExit >= outT && outT >= ray.tMin && outT <= ray.tMax;
+    }
+
+    float MaxExtent(const AABB& bounds)
+    {
+        const Vec3 size = bounds.GetSize();
+        return std::max(size.x, std::max(size.y, size.z));
+    }
+} // namespace
+
+GridIndex::GridIndex(const GridConfig& config)
+    : m_config(config)
+{
+    m_config.cellSize = std::max(m_config.cellSize, 1e-3f);
+    m_invCellSize = 1.0f / m_config.cellSize;
+}
+
+GridIndex::~GridIndex() = default;
+
+// =============================================================================
+// Build & Update
+// =============================================================================
+
+void GridIndex::Build(std::span<ISpatialEntity*> entities)
+{
+    Clear();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    m_records.reserve(entities.size());
+    for (auto* entity : entities)
+    {
+        if (!entity) continue;
+        Register(AllocateSlot(entity));
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_buildTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalBuildTimeMs += m_buildTimeMs;
+    m_rebuildCount++;
+}
+
+void GridIndex::Clear()
+{
+    m_cells.clear();
+    m_cellLookup.clear();
+    m_records.clear();
+    m_freeSlots.clear();
+    m_oversized.clear();
+    m_entityIndex.clear();
+    m_occupiedMin = IVec3(0);
+    m_occupiedMax = IVec3(-1);
+    m_maxEntitySize = 0.0f;
+    m_emptiedCells.clear();
+    m_pendingInserts.clear();
+    m_pendingRemoves.clear();
+    m_pendingUpdates.clear();
+}
+
+void GridIndex::Insert(ISpatialEntity* entity)
+{
+    if (!entity) return;
+    m_pendingInserts.push_back(entity);
+}
+
+void GridIndex::Remove(EntityHandle handle)
+{
+    // Removals are applied before insertions, so drop an earlier pending insert
+    m_pendingInserts.erase(
+        std::remove_if(m_pendingInserts.begin(), m_pendingInserts.end(),
+            [handle](ISpatialEntity* entity) { return entity->GetHandle() == handle; }),
+        m_pendingInserts.end());
+    m_pendingRemoves.push_back(handle);
+}
+
+void GridIndex::Update(ISpatialEntity* entity)
+{
+    if (!entity) return;
+    m_pendingUpdates.push_back(entity);
+}
+
+void GridIndex::Commit()
+{
+    if (m_pendingInserts.empty() && m_pendingRemoves.empty() && m_pendingUpdates.empty())
+    {
+        return;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const float previousMaxEntitySize = m_maxEntitySize;
+    m_removedMaxExtent = 0.0f;
+    m_addedMaxExtent = 0.0f;
+
+    // Process removals
+    for (auto handle : m_pendingRemoves)
+    {
+        auto it = m_entityIndex.find(handle);
+        if (it == m_entityIndex.end()) continue;
+
+        const int slot = it->second;
+        Unregister(slot);
+        m_records[slot] = EntityRecord{};
+        m_freeSlots.push_back(slot);
+        m_entityIndex.erase(it);
+    }
+    m_pendingRemoves.clear();
+
+    // Move entities between cells; entities unknown to the index are ignored
+    for (auto* entity : m_pendingUpdates)
+    {
+        auto it = m_entityIndex.find(entity->GetHandle());
+        if (it == m_entityIndex.end()) continue;
+
+        const int slot = it->second;
+        EntityRecord& record = m_records[slot];
+        const AABB bounds = entity->GetWorldBounds();
+        record.entity = entity;
+
+        // Same cell range: only the cached bounds and the cells' content bounds change
+        if (!record.oversized && bounds.IsValid() &&
+            CellCoord(bounds.GetMin()) == record.minCell &&
+            CellCoord(bounds.GetMax()) == record.maxCell)
+        {
+            m_removedMaxExtent = std::max(m_removedMaxExtent, MaxExtent(record.bounds));
+            m_addedMaxExtent = std::max(m_addedMaxExtent, MaxExtent(bounds));
+            m_maxEntitySize = std::max(m_maxEntitySize, m_addedMaxExtent);
+            record.bounds = bounds;
+            ExpandCellContent(record);
+            continue;
+        }
+
+        Unregister(slot);
+        record.bounds = bounds;
+        Register(slot);
+    }
+    m_pendingUpdates.clear();
+
+    // Process insertions (re-inserting an indexed entity is treated as a move)
+    for (auto* entity : m_pendingInserts)
+    {
+        auto it = m_entityIndex.find(entity->GetHandle());
+        if (it != m_entityIndex.end())
+        {
+            Unregister(it->second);
+            m_records[it->second].entity = entity;
+            m_records[it->second].bounds = entity->GetWorldBounds();
+            Register(it->second);
+            continue;
+        }
+
+        Register(AllocateSlot(entity));
+    }
+    m_pendingInserts.clear();
+
+    ReleaseEmptyCells();
+
+    // The block padding only has to shrink when the largest entity left and none as large arrived
+    if (m_removedMaxExtent >= previousMaxEntitySize && m_addedMaxExtent < previousMaxEntitySize)
+    {
+        RecomputeMaxEntitySize();
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_refitTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalRefitTimeMs += m_refitTimeMs;
+    m_refitCount++;
+}
+
+// =============================================================================
+// Cell Management
+// =============================================================================
+
+uint64_t GridIndex::HashCell(const IVec3& coord)
+{
+    const uint64_t x = static_cast<uint64_t>(coord.x + kCellCoordLimit) & 0x1FFFFF;
+    const uint64_t y = static_cast<uint64_t>(coord.y + kCellCoordLimit) & 0x1FFFFF;
+    const uint64_t z = static_cast<uint64_t>(coord.z + kCellCoordLimit) & 0x1FFFFF;
+    return x | (y << 21) | (z << 42);
+}
+
+IVec3 GridIndex::CellCoord(const Vec3& position) const
+{
+    const Vec3 scaled = glm::clamp(glm::floor(position * m_invCellSize),
+                                   Vec3(static_cast<float>(-kCellCoordLimit)),
+                                   Vec3(static_cast<float>(kCellCoordLimit)));
+    return IVec3(scaled);
+}
+
+AABB GridIndex::CellBounds(const IVec3& coord) const
+{
+    const Vec3 min = Vec3(coord) * m_config.cellSize;
+    return AABB(min, min + Vec3(m_config.cellSize));
+}
+
+const GridIndex::Cell* GridIndex::FindCell(const IVec3& coord) const
+{
+    auto it = m_cellLookup.find(HashCell(coord));
+    return it != m_cellLookup.end() ? &m_cells[it->second] : nullptr;
+}
+
+int GridIndex::FindOrCreateCell(const IVec3& coord)
+{
+    const uint64_t key = HashCell(coord);
+    auto it = m_cellLookup.find(key);
+    if (it != m_cellLookup.end())
+    {
+        return it->second;
+    }
+
+    const int cellIdx = static_cast<int>(m_cells.size());
+    m_cells.emplace_back();
+    m_cells.back().coord = coord;
+    m_cellLookup.emplace(key, cellIdx);
+
+    if (m_occupiedMin.x > m_occupiedMax.x)
+    {
+        m_occupiedMin = coord;
+        m_occupiedMax = coord;
+    }
+    else
+    {
+        m_occupiedMin = glm::min(m_occupiedMin, coord);
+        m_occupiedMax = glm::max(m_occupiedMax, coord);
+    }
+
+    return cellIdx;
+}
+
+void GridIndex::ReleaseEmptyCells()
+{
+    if (m_emptiedCells.empty()) return;
+
+    // Highest index first: the cell swapped into a released slot is then never
+    // one still waiting to be released
+    std::sort(m_emptiedCells.begin(), m_emptiedCells.end(), std::greater<int>());
+    m_emptiedCells.erase(std::unique(m_emptiedCells.begin(), m_emptiedCells.end()), m_emptiedCells.end());
+
+    bool released = false;
+    for (int cellIdx : m_emptiedCells)
+    {
+        // Entities may have moved back in during the same Commit
+        if (!m_cells[cellIdx].slots.empty()) continue;
+
+        m_cellLookup.erase(HashCell(m_cells[cellIdx].coord));
+        const int lastIdx = static_cast<int>(m_cells.size()) - 1;
+        if (cellIdx != lastIdx)
+        {
+            m_cells[cellIdx] = std::move(m_cells[lastIdx]);
+            m_cellLookup[HashCell(m_cells[cellIdx].coord)] = cellIdx;
+        }
+        m_cells.pop_back();
+        released = true;
+    }
+    m_emptiedCells.clear();
+
+    if (!released) return;
+
+    // Give memory back after a crowd has passed rather than holding the peak
+    if (m_cells.capacity() > 64 && m_cells.size() < m_cells.capacity() / 4)
+    {
+        m_cells.shrink_to_fit();
+    }
+
+    m_occupiedMin = IVec3(0);
+    m_occupiedMax = IVec3(-1);
+    for (const Cell& cell : m_cells)
+    {
+        if (m_occupiedMin.x > m_occupiedMax.x)
+        {
+            m_occupiedMin = cell.coord;
+            m_occupiedMax = cell.coord;
+        }
+        else
+        {
+            m_occupiedMin = glm::min(m_occupiedMin, cell.coord);
+            m_occupiedMax = glm::max(m_occupiedMax, cell.coord);
+        }
+    }
+}
+
+void GridIndex::RecomputeMaxEntitySize()
+{
+    m_maxEntitySize = 0.0f;
+    for (const auto& [handle, slot] : m_entityIndex)
+    {
+        (void)handle;
+        const EntityRecord& record = m_records[slot];
+        if (record.registered && !record.oversized)
+        {
+            m_maxEntitySize = std::max(m_maxEntitySize, MaxExtent(record.bounds));
+        }
+    }
+}
+
+void GridIndex::ExpandCellContent(const EntityRecord& record)
+{
+    for (int z = record.minCell.z; z <= record.maxCell.z; ++z)
+    {
+        for (int y = record.minCell.y; y <= record.maxCell.y; ++y)
+        {
+            for (int x = record.minCell.x; x <= record.maxCell.x; ++x)
+            {
+                auto it = m_cellLookup.find(HashCell(IVec3(x, y, z)));
+                if (it != m_cellLookup.end())
+                {
+                    m_cells[it->second].contentBounds.Expand(record.bounds);
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Entity Management
+// =============================================================================
+
+int GridIndex::AllocateSlot(ISpatialEntity* entity)
+{
+    int slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<int>(m_records.size());
+        m_records.emplace_back();
+    }
+
+    m_records[slot].entity = entity;
+    m_records[slot].bounds = entity->GetWorldBounds();
+    m_entityIndex[entity->GetHandle()] = slot;
+    return slot;
+}
+
+void GridIndex::Register(int slot)
+{
+    EntityRecord& record = m_records[slot];
+    record.registered = true;
+
+    if (!record.bounds.IsValid())
+    {
+        record.oversized = true;
+        m_oversized.push_back(slot);
+        return;
+    }
+
+    record.minCell = CellCoord(record.bounds.GetMin());
+    record.maxCell = CellCoord(record.bounds.GetMax());
+
+    const IVec3 span = record.maxCell - record.minCell + IVec3(1);
+    const int64_t cellCount = static_cast<int64_t>(span.x) * span.y * span.z;
+    record.oversized = cellCount > m_config.maxCellsPerEntity;
+
+    if (record.oversized)
+    {
+        m_oversized.push_back(slot);
+        return;
+    }
+
+    const float extent = MaxExtent(record.bounds);
+    m_maxEntitySize = std::max(m_maxEntitySize, extent);
+    m_addedMaxExtent = std::max(m_addedMaxExtent, extent);
+
+    for (int z = record.minCell.z; z <= record.maxCell.z; ++z)
+    {
+        for (int y = record.minCell.y; y <= record.maxCell.y; ++y)
+        {
+            for (int x = record.minCell.x; x <= record.maxCell.x; ++x)
+            {
+                Cell& cell = m_cells[FindOrCreateCell(IVec3(x, y, z))];
+                cell.slots.push_back(slot);
+                cell.contentBounds.Expand(record.bounds);
+            }
+        }
+    }
+}
+
+void GridIndex::Unregister(int slot)
+{
+    EntityRecord& record = m_records[slot];
+    if (!record.registered) return;
+    record.registered = false;
+
+    auto eraseSlot = [slot](std::vector<int>& slots) {
+        auto it = std::find(slots.begin(), slots.end(), slot);
+        if (it != slots.end())
+        {
+            *it = slots.back();
+            slots.pop_back();
+        }
+    };
+
+    if (record.oversized)
+    {
+        eraseSlot(m_oversized);
+        return;
+    }
+
+    m_removedMaxExtent = std::max(m_removedMaxExtent, MaxExtent(record.bounds));
+
+    for (int z = record.minCell.z; z <= record.maxCell.z; ++z)
+    {
+        for (int y = record.minCell.y; y <= record.maxCell.y; ++y)
+        {
+            for (int x = record.minCell.x; x <= record.maxCell.x; ++x)
+            {
+                auto it = m_cellLookup.find(HashCell(IVec3(x, y, z)));
+                if (it != m_cellLookup.end())
+                {
+                    Cell& cell = m_cells[it->second];
+                    eraseSlot(cell.slots);
+                    if (cell.slots.empty())
+                    {
+                        cell.contentBounds = AABB();
+                        m_emptiedCells.push_back(it->second);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+void GridIndex::AppendResult(int slot, std::vector<QueryResult>& results) const
+{
+    const EntityRecord& record = m_records[slot];
+    QueryResult result;
+    result.handle = record.entity->GetHandle();
+    result.userData = record.entity->GetUserData();
+    results.push_back(result);
+}
+
+template<typename CellTest, typename EntityTest>
+void GridIndex::QueryCells(
+    const IVec3& minCell,
+    const IVec3& maxCell,
+    CellTest&& cellTest,
+    EntityTest&& entityTest,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& results) const
+{
+    // Oversized entities are not stored in cells
+    for (int slot : m_oversized)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (filter.Accepts(record.entity) && entityTest(record.bounds))
+        {
+            AppendResult(slot, results);
+        }
+    }
+
+    const IVec3 rangeMin = glm::max(minCell, m_occupiedMin);
+    const IVec3 rangeMax = glm::min(maxCell, m_occupiedMax);
+    if (rangeMin.x > rangeMax.x || rangeMin.y > rangeMax.y || rangeMin.z > rangeMax.z) return;
+
+    // Entities spanning several cells are deduplicated once all cells are visited
+    std::vector<int> multiCellHits;
+
+    // Cells are tested by their content, which may reach into neighbouring cells.
+    // That keeps conservative tests (frustum planes) consistent with testing the entities.
+    auto visitCell = [&](const Cell& cell, CellOverlap overlap) {
+        if (cell.slots.empty()) return;
+
+        if (overlap == CellOverlap::Partial)
+        {
+            overlap = cellTest(cell.contentBounds);
+            if (overlap == CellOverlap::Outside) return;
+        }
+
+        for (int slot : cell.slots)
+        {
+            const EntityRecord& record = m_records[slot];
+            if (!filter.Accepts(record.entity)) continue;
+            if (overlap != CellOverlap::Inside && !entityTest(record.bounds)) continue;
+
+            if (record.SpansMultipleCells())
+            {
+                multiCellHits.push_back(slot);
+            }
+            else
+            {
+                AppendResult(slot, results);
+            }
+        }
+    };
+
+    // Blocks are padded by the largest entity so they bound the content of their cells
+    const Vec3 padding(m_maxEntitySize);
+    auto walkBlock = [&](auto& self, const IVec3& blockMin, int size, CellOverlap overlap) -> void {
+        if (size == 1)
+        {
+            if (const Cell* cell = FindCell(blockMin))
+            {
+                visitCell(*cell, overlap);
+            }
+            return;
+        }
+
+        const IVec3 blockMax = glm::min(blockMin + IVec3(size - 1), rangeMax);
+        if (overlap == CellOverlap::Partial)
+        {
+            overlap = cellTest(AABB(CellBounds(blockMin).GetMin() - padding,
+                                    CellBounds(blockMax).GetMax() + padding));
+            if (overlap == CellOverlap::Outside) return;
+        }
+
+        const int subSize = size / kCellBlockSize;
+        for (int z = blockMin.z; z <= blockMax.z; z += subSize)
+        {
+            for (int y = blockMin.y; y <= blockMax.y; y += subSize)
+            {
+                for (int x = blockMin.x; x <= blockMax.x; x += subSize)
+                {
+                    self(self, IVec3(x, y, z), subSize, overlap);
+                }
+            }
+        }
+    };
+
+    // Walk the coordinate range, or the occupied cells when the range is mostly empty space
+    const IVec3 span = rangeMax - rangeMin + IVec3(1);
+    const int64_t rangeCells = static_cast<int64_t>(span.x) * span.y * span.z;
+    const int64_t topBlockCells = static_cast<int64_t>(kTopBlockSize) * kTopBlockSize * kTopBlockSize;
+
+    if (rangeCells <= static_cast<int64_t>(m_cells.size()) * topBlockCells)
+    {
+        for (int z = rangeMin.z; z <= rangeMax.z; z += kTopBlockSize)
+        {
+            for (int y = rangeMin.y; y <= rangeMax.y; y += kTopBlockSize)
+            {
+                for (int x = rangeMin.x; x <= rangeMax.x; x += kTopBlockSize)
+                {
+                    walkBlock(walkBlock, IVec3(x, y, z), kTopBlockSize, CellOverlap::Partial);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (const Cell& cell : m_cells)
+        {
+            if (cell.coord.x < rangeMin.x || cell.coord.x > rangeMax.x ||
+                cell.coord.y < rangeMin.y || cell.coord.y > rangeMax.y ||
+                cell.coord.z < rangeMin.z || cell.coord.z > rangeMax.z)
+            {
+                continue;
+            }
+            visitCell(cell, CellOverlap::Partial);
+        }
+    }
+
+    if (!multiCellHits.empty())
+    {
+        std::sort(multiCellHits.begin(), multiCellHits.end());
+        multiCellHits.erase(std::unique(multiCellHits.begin(), multiCellHits.end()), multiCellHits.end());
+        for (int slot : multiCellHits)
+        {
+            AppendResult(slot, results);
+        }
+    }
+}
+
+void GridIndex::QueryFrustum(
+    const Frustum& frustum,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    QueryCells(m_occupiedMin, m_occupiedMax,
+        [&frustum](const AABB& cellBounds) {
+            switch (frustum.Intersects(cellBounds))
+            {
+                case IntersectionResult::Outside: return CellOverlap::Outside;
+                case IntersectionResult::Inside:  return CellOverlap::Inside;
+                default:                          return CellOverlap::Partial;
+            }
+        },
+        [&frustum](const AABB& bounds) { return frustum.IsVisible(bounds); },
+        filter, outResults);
+}
+
+void GridIndex::QueryBox(
+    const AABB& box,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (!box.IsValid()) return;
+
+    QueryCells(CellCoord(box.GetMin()), CellCoord(box.GetMax()),
+        [&box](const AABB& cellBounds) {
+            if (!box.Overlaps(cellBounds)) return CellOverlap::Outside;
+            return box.Contains(cellBounds) ? CellOverlap::Inside : CellOverlap::Partial;
+        },
+        [&box](const AABB& bounds) { return bounds.Overlaps(box); },
+        filter, outResults);
+}
+
+void GridIndex::QuerySphere(
+    const Vec3& center,
+    float radius,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    const Sphere sphere(center, radius);
+    if (!sphere.IsValid()) return;
+
+    const size_t firstResult = outResults.size();
+    QueryCells(CellCoord(center - Vec3(radius)), CellCoord(center + Vec3(radius)),
+        [&sphere](const AABB& cellBounds) {
+            return sphere.Overlaps(cellBounds) ? CellOverlap::Partial : CellOverlap::Outside;
+        },
+        [&sphere](const AABB& bounds) { return sphere.Overlaps(bounds); },
+        filter, outResults);
+
+    for (size_t i = firstResult; i < outResults.size(); ++i)
+    {
+        const EntityRecord& record = m_records[m_entityIndex.at(outResults[i].handle)];
+        outResults[i].distance = glm::length(record.bounds.GetCenter() - center);
+        outResults[i].sortKey = outResults[i].distance;
+    }
+}
+
+bool GridIndex::QueryRay(
+    const Ray& ray,
+    const QueryFilter& filter,
+    QueryResult& outResult) const
+{
+    float closestT = ray.tMax;
+    int closestSlot = -1;
+
+    auto testSlot = [&](int slot) {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) return;
+
+        float t1;
+        if (RayEntryDistance(ray, record.bounds, t1) && t1 < closestT)
+        {
+            closestT = t1;
+            closestSlot = slot;
+        }
+    };
+
+    for (int slot : m_oversized)
+    {
+        testSlot(slot);
+    }
+
+    // 3D-DDA over the occupied cell range, stopping once no closer hit is possible
+    if (m_occupiedMin.x <= m_occupiedMax.x)
+    {
+        const AABB occupied(CellBounds(m_occupiedMin).GetMin(), CellBounds(m_occupiedMax).GetMax());
+
+        float tEnter, tExit;
+        if (RayAABBIntersect(ray, occupied, tEnter, tExit))
+        {
+            IVec3 cell = glm::clamp(CellCoord(ray.At(tEnter)), m_occupiedMin, m_occupiedMax);
+            const IVec3 step(ray.direction.x >= 0.0f ? 1 : -1,
+                             ray.direction.y >= 0.0f ? 1 : -1,
+                             ray.direction.z >= 0.0f ? 1 : -1);
+            const Vec3 invDir = ray.GetInverseDirection();
+
+            Vec3 tNext;
+            Vec3 tDelta;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float boundary = (cell[axis] + (step[axis] > 0 ? 1 : 0)) * m_config.cellSize;
+                tNext[axis] = (boundary - ray.origin[axis]) * invDir[axis];
+                tDelta[axis] = m_config.cellSize * std::abs(invDir[axis]);
+            }
+
+            while (true)
+            {
+                const float cellExit = std::min({tNext.x, tNext.y, tNext.z});
+
+                if (const Cell* current = FindCell(cell))
+                {
+                    for (int slot : current->slots)
+                    {
+                        testSlot(slot);
+                    }
+                }
+
+                if (closestT <= cellExit || cellExit > tExit) break;
+
+                const int axis = (tNext.x < tNext.y)
+                    ? (tNext.x < tNext.z ? 0 : 2)
+                    : (tNext.y < tNext.z ? 1 : 2);
+                cell[axis] += step[axis];
+                if (cell[axis] < m_occupiedMin[axis] || cell[axis] > m_occupiedMax[axis]) break;
+                tNext[axis] += tDelta[axis];
+            }
+        }
+    }
+
+    if (closestSlot < 0) return false;
+
+    const EntityRecord& record = m_records[closestSlot];
+    outResult.handle = record.entity->GetHandle();
+    outResult.userData = record.entity->GetUserData();
+    outResult.distance = closestT;
+    outResult.sortKey = closestT;
+    return true;
+}
+
+void GridIndex::QueryRayAll(
+    const Ray& ray,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (m_occupiedMin.x > m_occupiedMax.x && m_oversized.empty()) return;
+
+    // Clip to the occupied range so the cell walk stays bounded
+    IVec3 minCell = m_occupiedMin;
+    IVec3 maxCell = m_occupiedMax;
+    if (m_occupiedMin.x <= m_occupiedMax.x)
+    {
+        const AABB occupied(CellBounds(m_occupiedMin).GetMin(), CellBounds(m_occupiedMax).GetMax());
+        float tEnter, tExit;
+        if (RayAABBIntersect(ray, occupied, tEnter, tExit))
+        {
+            const Vec3 a = ray.At(tEnter);
+            const Vec3 b = ray.At(tExit);
+            minCell = CellCoord(glm::min(a, b));
+            maxCell = CellCoord(glm::max(a, b));
+        }
+        else
+        {
+            maxCell = minCell - IVec3(1);
+        }
+    }
+
+    const size_t firstResult = outResults.size();
+    QueryCells(minCell, maxCell,
+        [&ray](const AABB& cellBounds) {
+            return RayAABBTest(ray, cellBounds) ? CellOverlap::Partial : CellOverlap::Outside;
+        },
+        [&ray](const AABB& bounds) { float t; return RayEntryDistance(ray, bounds, t); },
+        filter, outResults);
+
+    for (size_t i = firstResult; i < outResults.size(); ++i)
+    {
+        const EntityRecord& record = m_records[m_entityIndex.at(outResults[i].handle)];
+        float t1;
+        RayEntryDistance(ray, record.bounds, t1);
+        outResults[i].distance = t1;
+        outResults[i].sortKey = t1;
+    }
+
+    // Sort by distance
+    std::sort(outResults.begin(), outResults.end());
+}
+
+// =============================================================================
+// Statistics & Debug
+// =============================================================================
+
+IndexStats GridIndex::GetStats() const
+{
+    IndexStats stats;
+    stats.entityCount = m_entityIndex.size();
+    stats.nodeCount = m_cells.size();
+    stats.memoryBytes = m_cells.capacity() * sizeof(Cell) +
+                        m_records.capacity() * sizeof(EntityRecord) +
+                        m_cellLookup.size() * (sizeof(uint64_t) + sizeof(int)) +
+                        m_oversized.capacity() * sizeof(int);
+    stats.buildTimeMs = m_buildTimeMs;
+    stats.rebuildCount = m_rebuildCount;
+    stats.refitCount = m_refitCount;
+    stats.refitTimeMs = m_refitTimeMs;
+    stats.totalBuildTimeMs = m_totalBuildTimeMs;
+    stats.totalRefitTimeMs = m_totalRefitTimeMs;
+
+    size_t occupiedCells = 0;
+    size_t cellEntries = 0;
+    for (const Cell& cell : m_cells)
+    {
+        stats.memoryBytes += cell.slots.capacity() * sizeof(int);
+        if (cell.slots.empty()) continue;
+        occupiedCells++;
+        cellEntries += cell.slots.size();
+    }
+
+    stats.avgEntitiesPerLeaf = occupiedCells > 0
+        ? static_cast<float>(cellEntries) / occupiedCells
+        : 0.0f;
+
+    return stats;
+}
+
+void GridIndex::DebugDraw(IDebugRenderer* renderer, int maxDepth) const
+{
+    (void)maxDepth;
+    if (!renderer) return;
+
+    for (const Cell& cell : m_cells)
+    {
+        if (cell.slots.empty()) continue;
+
+        // Color based on occupancy
+        float t = std::min(1.0f, static_cast<float>(cell.slots.size()) / 16.0f);
+        Vec4 color(t, 1.0f - t, 0.2f, 0.5f);
+        renderer->DrawBox(CellBounds(cell.coord), color);
+    }
+}
+
+AABB GridIndex::GetWorldBounds() const
+{
+    AABB bounds;
+    for (const auto& [handle, slot] : m_entityIndex)
+    {
+        (void)handle;
+        bounds.Expand(m_records[slot].bounds);
+    }
+    return bounds;
+}
+
+} // namespace RVX::Spatial
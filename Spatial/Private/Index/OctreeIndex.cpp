@@ -0,0 +1,819 @@
+#include "Spatial/Index/OctreeIndex.h"
+#include "Spatial/Query/QueryFilter.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+namespace RVX::Spatial
+{
+
+namespace
+{
+    /// Entry distance of a ray into a box. Matches BVHIndex: boxes that contain
+    /// the ray origin are not reported, hits must enter within [tMin, tMax].
+    bool RayEntryDistance(const Ray& ray, const AABB& box, float& outT)
+    {
+        const Vec3 invDir = ray.GetInverseDirection();
+        const Vec3 t0 = (box.GetMin() - ray.origin) * invDir;
+        const Vec3 t1 = (box.GetMax() - ray.origin) * invDir;
+        const Vec3 tSmall = glm::min(t0, t1);
+        const Vec3 tBig = glm::max(t0, t1);
+
+        outT = std::max(std::max(tSmall.x, tSmall.y), tSmall.z);
+        const float tExit = std::min(std::min(tBig.x, tBig.y), tBig.z);
+        return tExit >= outT && outT >= ray.tMin && outT <= ray.tMax;
+    }
+} // namespace
+
+OctreeIndex::OctreeIndex(const OctreeConfig& config)
+    : m_config(config)
+{
+    m_config.looseness = std::max(m_config.looseness, 1.0f);
+    m_config.maxEntitiesPerNode = std::max(m_config.maxEntitiesPerNode, 1);
+}
+
+OctreeIndex::~OctreeIndex() = default;
+
+// =============================================================================
+// Build & Update
+// =============================================================================
+
+void OctreeIndex::Build(std::span<ISpatialEntity*> entities)
+{
+    Clear();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    m_records.reserve(entities.size());
+
+    AABB totalBounds = m_config.worldBounds;
+    for (auto* entity : entities)
+    {
+        if (!entity) continue;
+
+        EntityRecord record;
+        record.entity = entity;
+        record.bounds = entity->GetWorldBounds();
+        totalBounds.Expand(record.bounds);
+
+        m_entityIndex[entity->GetHandle()] = static_cast<int>(m_records.size());
+        m_records.push_back(record);
+    }
+
+    if (!m_records.empty())
+    {
+        // Size the root as the tightest cube around everything, so the tree rarely grows
+        const Vec3 extent = totalBounds.GetExtent();
+        InitRoot(totalBounds.GetCenter(), std::max({extent.x, extent.y, extent.z, m_config.minHalfSize}));
+
+        for (int slot = 0; slot < static_cast<int>(m_records.size()); ++slot)
+        {
+            InsertRecord(slot);
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_buildTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalBuildTimeMs += m_buildTimeMs;
+    m_rebuildCount++;
+}
+
+void OctreeIndex::Clear()
+{
+    m_nodes.clear();
+    m_freeChildBlocks.clear();
+    m_records.clear();
+    m_freeSlots.clear();
+    m_entityIndex.clear();
+    m_pendingInserts.clear();
+    m_pendingRemoves.clear();
+    m_pendingUpdates.clear();
+}
+
+void OctreeIndex::Insert(ISpatialEntity* entity)
+{
+    if (!entity) return;
+    m_pendingInserts.push_back(entity);
+}
+
+void OctreeIndex::Remove(EntityHandle handle)
+{
+    // Removals are applied before insertions, so drop an earlier pending insert
+    m_pendingInserts.erase(
+        std::remove_if(m_pendingInserts.begin(), m_pendingInserts.end(),
+            [handle](ISpatialEntity* entity) { return entity->GetHandle() == handle; }),
+        m_pendingInserts.end());
+    m_pendingRemoves.push_back(handle);
+}
+
+void OctreeIndex::Update(ISpatialEntity* entity)
+{
+    if (!entity) return;
+    m_pendingUpdates.push_back(entity);
+}
+
+void OctreeIndex::Commit()
+{
+    if (m_pendingInserts.empty() && m_pendingRemoves.empty() && m_pendingUpdates.empty())
+    {
+        return;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Process removals
+    for (auto handle : m_pendingRemoves)
+    {
+        auto it = m_entityIndex.find(handle);
+        if (it == m_entityIndex.end()) continue;
+
+        const int slot = it->second;
+        DetachFromNode(slot);
+        m_records[slot] = EntityRecord{};
+        m_freeSlots.push_back(slot);
+        m_entityIndex.erase(it);
+    }
+    m_pendingRemoves.clear();
+
+    // Relocate moved entities; entities unknown to the index are ignored
+    for (auto* entity : m_pendingUpdates)
+    {
+        auto it = m_entityIndex.find(entity->GetHandle());
+        if (it == m_entityIndex.end()) continue;
+
+        const int slot = it->second;
+        EntityRecord& record = m_records[slot];
+        record.entity = entity;
+        record.bounds = entity->GetWorldBounds();
+
+        // Still inside the node's loose bounds and no deeper fit: nothing to do
+        const Node& node = m_nodes[record.node];
+        if (node.looseBounds.Contains(record.bounds) &&
+            (node.IsLeaf() || !FitsInChildren(node, record.bounds)))
+        {
+            continue;
+        }
+
+        DetachFromNode(slot);
+        InsertRecord(slot);
+    }
+    m_pendingUpdates.clear();
+
+    // Process insertions (re-inserting an indexed entity is treated as a move)
+    for (auto* entity : m_pendingInserts)
+    {
+        auto it = m_entityIndex.find(entity->GetHandle());
+        int slot;
+        if (it != m_entityIndex.end())
+        {
+            slot = it->second;
+            DetachFromNode(slot);
+        }
+        else if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<int>(m_records.size());
+            m_records.emplace_back();
+        }
+
+        m_records[slot].entity = entity;
+        m_records[slot].bounds = entity->GetWorldBounds();
+        m_entityIndex[entity->GetHandle()] = slot;
+        InsertRecord(slot);
+    }
+    m_pendingInserts.clear();
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_refitTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    m_totalRefitTimeMs += m_refitTimeMs;
+    m_refitCount++;
+}
+
+// =============================================================================
+// Tree Management
+// =============================================================================
+
+void OctreeIndex::InitRoot(const Vec3& center, float halfSize)
+{
+    m_nodes.clear();
+    m_freeChildBlocks.clear();
+    m_nodes.emplace_back();
+    SetNodeExtent(0, center, halfSize, 0);
+}
+
+void OctreeIndex::SetNodeExtent(int nodeIdx, const Vec3& center, float halfSize, int depth)
+{
+    Node& node = m_nodes[nodeIdx];
+    node.center = center;
+    node.halfSize = halfSize;
+    node.depth = depth;
+
+    const Vec3 looseExtent(halfSize * m_config.looseness);
+    node.looseBounds = AABB(center - looseExtent, center + looseExtent);
+}
+
+int OctreeIndex::ChildIndexFor(const Node& node, const Vec3& point) const
+{
+    return (point.x >= node.center.x ? 1 : 0) |
+           (point.y >= node.center.y ? 2 : 0) |
+           (point.z >= node.center.z ? 4 : 0);
+}
+
+bool OctreeIndex::CanSplit(const Node& node) const
+{
+    return node.depth < m_config.maxDepth && node.halfSize * 0.5f >= m_config.minHalfSize;
+}
+
+bool OctreeIndex::FitsInChildren(const Node& node, const AABB& bounds) const
+{
+    if (!CanSplit(node)) return false;
+
+    const float childHalf = node.halfSize * 0.5f;
+
+    // The entity goes to the child owning its center; check that child's loose bounds
+    const Vec3 center = bounds.GetCenter();
+    const int octant = ChildIndexFor(node, center);
+    const Vec3 childCenter = node.center + Vec3(
+        (octant & 1) ? childHalf : -childHalf,
+        (octant & 2) ? childHalf : -childHalf,
+        (octant & 4) ? childHalf : -childHalf);
+
+    const Vec3 looseExtent(childHalf * m_config.looseness);
+    return AABB(childCenter - looseExtent, childCenter + looseExtent).Contains(bounds);
+}
+
+int OctreeIndex::FindTargetNode(const AABB& bounds) const
+{
+    int nodeIdx = 0;
+    while (!m_nodes[nodeIdx].IsLeaf() && FitsInChildren(m_nodes[nodeIdx], bounds))
+    {
+        const Node& node = m_nodes[nodeIdx];
+        nodeIdx = node.firstChild + ChildIndexFor(node, bounds.GetCenter());
+    }
+    return nodeIdx;
+}
+
+int OctreeIndex::AllocateChildBlock(int parentIdx)
+{
+    int first;
+    if (!m_freeChildBlocks.empty())
+    {
+        first = m_freeChildBlocks.back();
+        m_freeChildBlocks.pop_back();
+    }
+    else
+    {
+        first = static_cast<int>(m_nodes.size());
+        m_nodes.resize(m_nodes.size() + 8);
+    }
+
+    const Vec3 parentCenter = m_nodes[parentIdx].center;
+    const float childHalf = m_nodes[parentIdx].halfSize * 0.5f;
+    const int childDepth = m_nodes[parentIdx].depth + 1;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        m_nodes[first + i] = Node{};
+        m_nodes[first + i].parent = parentIdx;
+
+        const Vec3 offset(
+            (i & 1) ? childHalf : -childHalf,
+            (i & 2) ? childHalf : -childHalf,
+            (i & 4) ? childHalf : -childHalf);
+        SetNodeExtent(first + i, parentCenter + offset, childHalf, childDepth);
+    }
+
+    m_nodes[parentIdx].firstChild = first;
+    return first;
+}
+
+void OctreeIndex::SplitNode(int nodeIdx)
+{
+    const int firstChild = AllocateChildBlock(nodeIdx);
+
+    // Push down every entity that fits a child; the subtree count is unchanged
+    std::vector<int> moving = std::move(m_nodes[nodeIdx].slots);
+    m_nodes[nodeIdx].slots.clear();
+
+    for (int slot : moving)
+    {
+        EntityRecord& record = m_records[slot];
+        int target = nodeIdx;
+        if (FitsInChildren(m_nodes[nodeIdx], record.bounds))
+        {
+            target = firstChild + ChildIndexFor(m_nodes[nodeIdx], record.bounds.GetCenter());
+            m_nodes[target].subtreeCount++;
+        }
+
+        record.node = target;
+        record.indexInNode = static_cast<int>(m_nodes[target].slots.size());
+        m_nodes[target].slots.push_back(slot);
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        const int child = firstChild + i;
+        if (static_cast<int>(m_nodes[child].slots.size()) > m_config.maxEntitiesPerNode &&
+            CanSplit(m_nodes[child]))
+        {
+            SplitNode(child);
+        }
+    }
+}
+
+void OctreeIndex::CollapseNode(int nodeIdx)
+{
+    const int firstChild = m_nodes[nodeIdx].firstChild;
+    if (firstChild < 0) return;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        CollapseNode(firstChild + i);
+        m_nodes[firstChild + i] = Node{};
+    }
+
+    m_freeChildBlocks.push_back(firstChild);
+    m_nodes[nodeIdx].firstChild = -1;
+}
+
+void OctreeIndex::GrowRoot(const AABB& bounds)
+{
+    // Double the root towards the entity until its loose bounds cover it
+    for (int iteration = 0; iteration < 32 && !m_nodes[0].looseBounds.Contains(bounds); ++iteration)
+    {
+        const Vec3 oldCenter = m_nodes[0].center;
+        const float oldHalf = m_nodes[0].halfSize;
+        const Vec3 target = bounds.GetCenter();
+        const Vec3 newCenter = oldCenter + Vec3(
+            target.x >= oldCenter.x ? oldHalf : -oldHalf,
+            target.y >= oldCenter.y ? oldHalf : -oldHalf,
+            target.z >= oldCenter.z ? oldHalf : -oldHalf);
+
+        // Move the old root out of slot 0 and re-create slot 0 as the bigger root
+        Node oldRoot = std::move(m_nodes[0]);
+        m_nodes[0] = Node{};
+        SetNodeExtent(0, newCenter, oldHalf * 2.0f, 0);
+        m_nodes[0].subtreeCount = oldRoot.subtreeCount;
+
+        const int firstChild = AllocateChildBlock(0);
+        const int moved = firstChild + ChildIndexFor(m_nodes[0], oldCenter);
+        oldRoot.parent = 0;
+        m_nodes[moved] = std::move(oldRoot);
+
+        for (int slot : m_nodes[moved].slots)
+        {
+            m_records[slot].node = moved;
+        }
+
+        // Re-parent the old root's children and push every depth down by one
+        std::function<void(int)> deepen = [&](int nodeIdx) {
+            m_nodes[nodeIdx].depth++;
+            const int child = m_nodes[nodeIdx].firstChild;
+            if (child < 0) return;
+            for (int i = 0; i < 8; ++i)
+            {
+                m_nodes[child + i].parent = nodeIdx;
+                deepen(child + i);
+            }
+        };
+        m_nodes[moved].depth = 0;
+        deepen(moved);
+
+        m_nodes[0].looseBounds.Expand(m_nodes[moved].looseBounds);
+    }
+}
+
+// =============================================================================
+// Entity Management
+// =============================================================================
+
+void OctreeIndex::InsertRecord(int slot)
+{
+    const AABB bounds = m_records[slot].bounds;
+
+    if (m_nodes.empty())
+    {
+        const Vec3 extent = bounds.IsValid() ? bounds.GetExtent() : Vec3(0.0f);
+        const Vec3 center = bounds.IsValid() ? bounds.GetCenter() : Vec3(0.0f);
+        InitRoot(center, std::max({extent.x, extent.y, extent.z, m_config.minHalfSize}));
+    }
+
+    if (bounds.IsValid() && !m_nodes[0].looseBounds.Contains(bounds))
+    {
+        GrowRoot(bounds);
+    }
+
+    AttachToNode(slot, FindTargetNode(bounds));
+}
+
+void OctreeIndex::AttachToNode(int slot, int nodeIdx)
+{
+    EntityRecord& record = m_records[slot];
+    Node& node = m_nodes[nodeIdx];
+
+    // Entities the root could not grow to cover still have to be found by queries
+    if (nodeIdx == 0)
+    {
+        node.looseBounds.Expand(record.bounds);
+    }
+
+    record.node = nodeIdx;
+    record.indexInNode = static_cast<int>(node.slots.size());
+    node.slots.push_back(slot);
+    AdjustSubtreeCount(nodeIdx, 1);
+
+    const Node& target = m_nodes[nodeIdx];
+    if (target.IsLeaf() && static_cast<int>(target.slots.size()) > m_config.maxEntitiesPerNode &&
+        CanSplit(target))
+    {
+        SplitNode(nodeIdx);
+    }
+}
+
+void OctreeIndex::DetachFromNode(int slot)
+{
+    EntityRecord& record = m_records[slot];
+    if (record.node < 0) return;
+
+    // Swap-remove from the node's entity list
+    Node& node = m_nodes[record.node];
+    const int last = node.slots.back();
+    node.slots[record.indexInNode] = last;
+    m_records[last].indexInNode = record.indexInNode;
+    node.slots.pop_back();
+
+    const int nodeIdx = record.node;
+    record.node = -1;
+    record.indexInNode = -1;
+    AdjustSubtreeCount(nodeIdx, -1);
+}
+
+void OctreeIndex::AdjustSubtreeCount(int nodeIdx, int delta)
+{
+    while (nodeIdx >= 0)
+    {
+        Node& node = m_nodes[nodeIdx];
+        node.subtreeCount += delta;
+
+        // Release child blocks once every descendant is empty
+        if (delta < 0 && !node.IsLeaf() && node.subtreeCount == static_cast<int>(node.slots.size()))
+        {
+            CollapseNode(nodeIdx);
+        }
+
+        nodeIdx = m_nodes[nodeIdx].parent;
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+void OctreeIndex::AppendResult(int slot, std::vector<QueryResult>& results) const
+{
+    const EntityRecord& record = m_records[slot];
+    QueryResult result;
+    result.handle = record.entity->GetHandle();
+    result.userData = record.entity->GetUserData();
+    results.push_back(result);
+}
+
+void OctreeIndex::QueryFrustum(
+    const Frustum& frustum,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (m_nodes.empty()) return;
+    QueryFrustumRecursive(0, frustum, false, filter, outResults);
+}
+
+void OctreeIndex::QueryFrustumRecursive(
+    int nodeIdx,
+    const Frustum& frustum,
+    bool fullyInside,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& results) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.subtreeCount == 0) return;
+
+    // Once a node's loose bounds are inside, everything below is inside too
+    if (!fullyInside)
+    {
+        auto intersection = frustum.Intersects(node.looseBounds);
+        if (intersection == IntersectionResult::Outside) return;
+        fullyInside = intersection == IntersectionResult::Inside;
+    }
+
+    for (int slot : node.slots)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) continue;
+
+        if (fullyInside || frustum.IsVisible(record.bounds))
+        {
+            AppendResult(slot, results);
+        }
+    }
+
+    if (!node.IsLeaf())
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            QueryFrustumRecursive(node.firstChild + i, frustum, fullyInside, filter, results);
+        }
+    }
+}
+
+void OctreeIndex::QueryBox(
+    const AABB& box,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (m_nodes.empty()) return;
+    QueryBoxRecursive(0, box, filter, outResults);
+}
+
+void OctreeIndex::QueryBoxRecursive(
+    int nodeIdx,
+    const AABB& box,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& results) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.subtreeCount == 0 || !node.looseBounds.Overlaps(box)) return;
+
+    for (int slot : node.slots)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) continue;
+
+        if (record.bounds.Overlaps(box))
+        {
+            AppendResult(slot, results);
+        }
+    }
+
+    if (!node.IsLeaf())
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            QueryBoxRecursive(node.firstChild + i, box, filter, results);
+        }
+    }
+}
+
+void OctreeIndex::QuerySphere(
+    const Vec3& center,
+    float radius,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (m_nodes.empty()) return;
+    QuerySphereRecursive(0, Sphere(center, radius), filter, outResults);
+}
+
+void OctreeIndex::QuerySphereRecursive(
+    int nodeIdx,
+    const Sphere& sphere,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& results) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.subtreeCount == 0 || !sphere.Overlaps(node.looseBounds)) return;
+
+    for (int slot : node.slots)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) continue;
+
+        if (sphere.Overlaps(record.bounds))
+        {
+            AppendResult(slot, results);
+            results.back().distance = glm::length(record.bounds.GetCenter() - sphere.GetCenter());
+            results.back().sortKey = results.back().distance;
+        }
+    }
+
+    if (!node.IsLeaf())
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            QuerySphereRecursive(node.firstChild + i, sphere, filter, results);
+        }
+    }
+}
+
+bool OctreeIndex::QueryRay(
+    const Ray& ray,
+    const QueryFilter& filter,
+    QueryResult& outResult) const
+{
+    if (m_nodes.empty()) return false;
+
+    float closestT = ray.tMax;
+    bool hit = false;
+    QueryRayRecursive(0, ray, filter, closestT, outResult, hit);
+
+    if (hit)
+    {
+        outResult.distance = closestT;
+        outResult.sortKey = closestT;
+    }
+
+    return hit;
+}
+
+void OctreeIndex::QueryRayRecursive(
+    int nodeIdx,
+    const Ray& ray,
+    const QueryFilter& filter,
+    float& closestT,
+    QueryResult& result,
+    bool& hit) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.subtreeCount == 0) return;
+
+    float tMin, tMax;
+    if (!RayAABBIntersect(ray, node.looseBounds, tMin, tMax) || tMin > closestT) return;
+
+    for (int slot : node.slots)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) continue;
+
+        float t1;
+        if (RayEntryDistance(ray, record.bounds, t1) && t1 < closestT)
+        {
+            closestT = t1;
+            result.handle = record.entity->GetHandle();
+            result.userData = record.entity->GetUserData();
+            hit = true;
+        }
+    }
+
+    if (node.IsLeaf()) return;
+
+    // Visit children front to back so closestT prunes as early as possible
+    std::pair<float, int> order[8];
+    int count = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        const int child = node.firstChild + i;
+        if (m_nodes[child].subtreeCount == 0) continue;
+        if (RayAABBIntersect(ray, m_nodes[child].looseBounds, tMin, tMax) && tMin <= closestT)
+        {
+            order[count++] = {tMin, child};
+        }
+    }
+    std::sort(order, order + count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (order[i].first > closestT) break;
+        QueryRayRecursive(order[i].second, ray, filter, closestT, result, hit);
+    }
+}
+
+void OctreeIndex::QueryRayAll(
+    const Ray& ray,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& outResults) const
+{
+    if (m_nodes.empty()) return;
+    QueryRayAllRecursive(0, ray, filter, outResults);
+
+    // Sort by distance
+    std::sort(outResults.begin(), outResults.end());
+}
+
+void OctreeIndex::QueryRayAllRecursive(
+    int nodeIdx,
+    const Ray& ray,
+    const QueryFilter& filter,
+    std::vector<QueryResult>& results) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.subtreeCount == 0) return;
+
+    float tMin, tMax;
+    if (!RayAABBIntersect(ray, node.looseBounds, tMin, tMax)) return;
+
+    for (int slot : node.slots)
+    {
+        const EntityRecord& record = m_records[slot];
+        if (!filter.Accepts(record.entity)) continue;
+
+        float t1;
+        if (RayEntryDistance(ray, record.bounds, t1))
+        {
+            AppendResult(slot, results);
+            results.back().distance = t1;
+            results.back().sortKey = t1;
+        }
+    }
+
+    if (!node.IsLeaf())
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            QueryRayAllRecursive(node.firstChild + i, ray, filter, results);
+        }
+    }
+}
+
+// =============================================================================
+// Statistics & Debug
+// =============================================================================
+
+IndexStats OctreeIndex::GetStats() const
+{
+    IndexStats stats;
+    stats.entityCount = m_entityIndex.size();
+    stats.nodeCount = m_nodes.size() - m_freeChildBlocks.size() * 8;
+    stats.memoryBytes = m_nodes.capacity() * sizeof(Node) +
+                        m_records.capacity() * sizeof(EntityRecord);
+    stats.buildTimeMs = m_buildTimeMs;
+    stats.rebuildCount = m_rebuildCount;
+    stats.refitCount = m_refitCount;
+    stats.refitTimeMs = m_refitTimeMs;
+    stats.totalBuildTimeMs = m_totalBuildTimeMs;
+    stats.totalRefitTimeMs = m_totalRefitTimeMs;
+
+    int maxDepth = 0;
+    int occupiedNodes = 0;
+
+    std::function<void(int)> traverse = [&](int nodeIdx) {
+        const Node& node = m_nodes[nodeIdx];
+        stats.memoryBytes += node.slots.capacity() * sizeof(int);
+        if (node.subtreeCount == 0) return;
+
+        maxDepth = std::max(maxDepth, node.depth);
+        if (!node.slots.empty()) occupiedNodes++;
+
+        if (!node.IsLeaf())
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                traverse(node.firstChild + i);
+            }
+        }
+    };
+
+    if (!m_nodes.empty())
+    {
+        traverse(0);
+    }
+
+    stats.maxDepth = maxDepth;
+    stats.avgEntitiesPerLeaf = occupiedNodes > 0
+        ? static_cast<float>(stats.entityCount) / occupiedNodes
+        : 0.0f;
+
+    return stats;
+}
+
+void OctreeIndex::DebugDraw(IDebugRenderer* renderer, int maxDepth) const
+{
+    if (!renderer || m_nodes.empty()) return;
+
+    std::function<void(int)> draw = [&](int nodeIdx) {
+        const Node& node = m_nodes[nodeIdx];
+        if (node.subtreeCount == 0) return;
+        if (maxDepth >= 0 && node.depth > maxDepth) return;
+
+        // Color based on depth
+        float t = static_cast<float>(node.depth) / 10.0f;
+        Vec4 color(t, 1.0f - t, 0.5f, 0.5f);
+
+        renderer->DrawBox(node.looseBounds, color);
+
+        if (!node.IsLeaf())
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                draw(node.firstChild + i);
+            }
+        }
+    };
+
+    draw(0);
+}
+
+AABB OctreeIndex::GetWorldBounds() const
+{
+    AABB bounds;
+    for (const auto& [handle, slot] : m_entityIndex)
+    {
+        (void)handle;
+        bounds.Expand(m_records[slot].bounds);
+    }
+    return bounds;
+}
+
+} // namespace RVX::Spatial
@@ -10,11 +10,9 @@ SpatialIndexPtr SpatialFactory::Create(SpatialIndexType type)
         case SpatialIndexType::BVH:
             return CreateBVH();
         case SpatialIndexType::Octree:
-            // TODO: Implement OctreeIndex
-            return CreateBVH(); // Fallback to BVH
+            return CreateOctree();
         case SpatialIndexType::Grid:
-            // TODO: Implement GridIndex
-            return CreateBVH(); // Fallback to BVH
+            return CreateGrid();
         default:
             return CreateBVH();
     }
@@ -25,6 +23,16 @@ SpatialIndexPtr SpatialFactory::CreateBVH(const BVHConfig& config)
     return std::make_unique<BVHIndex>(config);
 }
 
+SpatialIndexPtr SpatialFactory::CreateOctree(const OctreeConfig& config)
+{
+    return std::make_unique<OctreeIndex>(config);
+}
+
+SpatialIndexPtr SpatialFactory::CreateGrid(const GridConfig& config)
+{
+    return std::make_unique<GridIndex>(config);
+}
+
 const char* SpatialFactory::GetTypeName(SpatialIndexType type)
 {
     switch (type)
@@ -0,0 +1,269 @@
+/**
+ * @file main.cpp
+ * @brief AnimationBatch benchmark: parallel crowd evaluation into one palette
+ *
+ * Runs a crowd of state machines, each walking and then cross-fading into
+ * a run halfway through, and reports the cost per character per frame.
+ * The reference updates characters one after another and leaves each
+ * skinning array with its character, the way AnimatorComponents tick on
+ * their own. The batch advances state machines serially and evaluates
+ * poses and skinning in parallel on the JobSystem into one palette; its
+ * palette must match the reference exactly. A third run puts two thirds of
+ * the crowd on interpolated update rates and checks that only the expected
+ * share is evaluated each frame.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Animation/Runtime/AnimationBatch.h"
+#include "Animation/State/AnimationStateMachine.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+using namespace RVX;
+using namespace RVX::Animation;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr TimeUs kClipDuration = kMicrosecondsPerSecond;
+    constexpr int kKeyframesPerChannel = 20;
+    constexpr float kFrameTime = 1.0f / 60.0f;
+
+    Skeleton::Ptr MakeSkeleton(int boneCount, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+
+        auto skeleton = Skeleton::Create();
+        for (int i = 0; i < boneCount; ++i)
+        {
+            const int parent = i == 0 ? -1 : (i % 4 == 1 ? (i - 1) / 2 : i - 1);
+            Bone bone("bone_" + std::to_string(i), parent);
+            bone.localBindPose.translation = Vec3(offset(rng), 0.1f + offset(rng), offset(rng));
+            skeleton->AddBone(bone);
+        }
+        skeleton->ComputeInverseBindPoses();
+        return skeleton;
+    }
+
+    AnimationClip::Ptr MakeClip(const Skeleton& skeleton, std::mt19937& rng, float amplitude)
+    {
+        std::uniform_real_distribution<float> angle(-amplitude, amplitude);
+
+        auto clip = std::make_shared<AnimationClip>();
+        clip->duration = kClipDuration;
+        clip->defaultWrapMode = WrapMode::Loop;
+        for (const Bone& bone : skeleton.bones)
+        {
+            TransformTrack track;
+            track.targetName = bone.name;
+            for (int k = 0; k < kKeyframesPerChannel; ++k)
+            {
+                const TimeUs time = kClipDuration * k / (kKeyframesPerChannel - 1);
+                track.rotationKeyframes.emplace_back(time, normalize(Quat(Vec3(angle(rng), angle(rng), angle(rng)))));
+            }
+            clip->transformTracks.push_back(std::move(track));
+        }
+        return clip;
+    }
+
+    AnimationStateMachine::Ptr MakeCharacter(const Skeleton::ConstPtr& skeleton,
+                                             const AnimationClip::ConstPtr& walk,
+                                             const AnimationClip::ConstPtr& run, int index)
+    {
+        auto fsm = AnimationStateMachine::Create(skeleton);
+        fsm->AddState("Walk")->SetMotion(walk);
+        fsm->AddState("Run")->SetMotion(run);
+        fsm->SetDefaultState("Walk");
+        fsm->Start();
+        fsm->GetState("Walk")->SetNormalizedTime(static_cast<float>(index % 97) / 97.0f);
+        return fsm;
+    }
+
+    struct Crowd
+    {
+        std::vector<AnimationStateMachine::Ptr> characters;
+        std::vector<std::vector<Mat4>> skinning;    ///< Reference: one array per character
+        AnimationBatch batch;
+    };
+
+    void BuildCrowd(Crowd& crowd, int count, const Skeleton::ConstPtr& skeleton,
+                    const AnimationClip::ConstPtr& walk, const AnimationClip::ConstPtr& run)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            crowd.characters.push_back(MakeCharacter(skeleton, walk, run, i));
+            crowd.skinning.emplace_back(skeleton->GetBoneCount(), Mat4(1.0f));
+            crowd.batch.Add(crowd.characters.back().get());
+        }
+    }
+
+    void CrossFadeAt(Crowd& crowd, int frame, int frameCount)
+    {
+        if (frame == frameCount / 2)
+        {
+            for (auto& fsm : crowd.characters)
+            {
+                fsm->ForceState("Run", 0.3f);
+            }
+        }
+    }
+
+    void UpdateReference(Crowd& crowd, int frameCount)
+    {
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            CrossFadeAt(crowd, frame, frameCount);
+            for (size_t i = 0; i < crowd.characters.size(); ++i)
+            {
+                AnimationStateMachine& fsm = *crowd.characters[i];
+                fsm.Update(kFrameTime);
+                SkeletonPose& pose = fsm.GetOutputPose();
+                pose.ComputeSkinningMatrices();
+                crowd.skinning[i] = pose.GetSkinningMatrices();
+            }
+        }
+    }
+
+    /// Returns the evaluations per frame after the first
+    std::vector<size_t> UpdateBatch(Crowd& crowd, int frameCount)
+    {
+        std::vector<size_t> evaluated;
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            CrossFadeAt(crowd, frame, frameCount);
+            for (auto& fsm : crowd.characters)
+            {
+                fsm->Advance(kFrameTime);
+            }
+            crowd.batch.Evaluate();
+            if (frame > 0)
+            {
+                evaluated.push_back(crowd.batch.GetStats().evaluatedCount);
+            }
+        }
+        return evaluated;
+    }
+
+    float MaxPaletteDifference(const Crowd& reference, const Crowd& batched)
+    {
+        const std::vector<Mat4>& palette = batched.batch.GetPalette();
+        float maxDiff = 0.0f;
+        for (size_t i = 0; i < reference.skinning.size(); ++i)
+        {
+            const size_t offset = batched.batch.GetPaletteOffset(static_cast<AnimationBatch::Handle>(i));
+            const std::vector<Mat4>& expected = reference.skinning[i];
+            if (offset + expected.size() > palette.size())
+            {
+                return 1e30f;
+            }
+            for (size_t b = 0; b < expected.size(); ++b)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        maxDiff = std::max(maxDiff, std::abs(palette[offset + b][c][r] - expected[b][c][r]));
+                    }
+                }
+            }
+        }
+        return maxDiff;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize();
+    RVX_CORE_INFO("AnimationBatch Benchmark ({} workers)", JobSystem::Get().GetWorkerCount());
+
+    // Optional scale factor for quick runs: AnimationBatchBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const int frameCount = std::max(8, static_cast<int>(60 * scale));
+    constexpr int kBoneCount = 64;
+    const uint32_t lodIntervals[] = {1, 2, 4};
+
+    const int crowdSizes[] = {500, 1000};
+    int failures = 0;
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} bones, {} frames, cross-fade at frame {} ===", kBoneCount, frameCount, frameCount / 2);
+    RVX_CORE_INFO("  {:<12} {:>14} {:>14} {:>10} {:>14} {:>14} {:>12}",
+                  "Characters", "Serial us", "Batch us", "Speedup", "LOD us", "LOD evals", "Palette diff");
+
+    for (int crowdSize : crowdSizes)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(crowdSize));
+        Skeleton::ConstPtr skeleton = MakeSkeleton(kBoneCount, rng);
+        AnimationClip::ConstPtr walk = MakeClip(*skeleton, rng, 0.3f);
+        AnimationClip::ConstPtr run = MakeClip(*skeleton, rng, 0.6f);
+
+        Crowd reference, batched, lod;
+        BuildCrowd(reference, crowdSize, skeleton, walk, run);
+        BuildCrowd(batched, crowdSize, skeleton, walk, run);
+        BuildCrowd(lod, crowdSize, skeleton, walk, run);
+        for (int i = 0; i < crowdSize; ++i)
+        {
+            lod.batch.SetUpdateInterval(static_cast<AnimationBatch::Handle>(i), lodIntervals[i % 3]);
+        }
+
+        auto start = Clock::now();
+        UpdateReference(reference, frameCount);
+        const double serialUs = ElapsedMs(start) * 1e3 / (double(frameCount) * crowdSize);
+
+        start = Clock::now();
+        UpdateBatch(batched, frameCount);
+        const double batchUs = ElapsedMs(start) * 1e3 / (double(frameCount) * crowdSize);
+
+        start = Clock::now();
+        const std::vector<size_t> lodEvaluated = UpdateBatch(lod, frameCount);
+        const double lodUs = ElapsedMs(start) * 1e3 / (double(frameCount) * crowdSize);
+
+        // Same state machines, same frames: the palette must be bit-identical
+        const float paletteDiff = MaxPaletteDifference(reference, batched);
+        if (paletteDiff != 0.0f ||
+            batched.batch.GetPalette().size() != size_t(crowdSize) * kBoneCount)
+        {
+            RVX_CORE_ERROR("  {} characters: batched palette differs from per-character update ({})",
+                           crowdSize, paletteDiff);
+            failures++;
+        }
+
+        // Staggered intervals: each frame evaluates every 1-in-1, half the
+        // 1-in-2 and a quarter of the 1-in-4 characters
+        size_t expectedPerFrame = 0;
+        for (int i = 0; i < crowdSize; ++i)
+        {
+            const uint32_t interval = lodIntervals[i % 3];
+            expectedPerFrame += interval == 1 ? 4 : (interval == 2 ? 2 : 1);
+        }
+        expectedPerFrame /= 4;
+        for (size_t evaluated : lodEvaluated)
+        {
+            if (evaluated + 2 < expectedPerFrame || evaluated > expectedPerFrame + 2)
+            {
+                RVX_CORE_ERROR("  {} characters: LOD evaluated {} per frame, expected about {}",
+                               crowdSize, evaluated, expectedPerFrame);
+                failures++;
+                break;
+            }
+        }
+
+        RVX_CORE_INFO("  {:<12} {:>14.2f} {:>14.2f} {:>9.2f}x {:>14.2f} {:>14} {:>12.2e}",
+                      crowdSize, serialUs, batchUs, serialUs / batchUs, lodUs,
+                      lodEvaluated.empty() ? 0 : lodEvaluated.back(), paletteDiff);
+    }
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
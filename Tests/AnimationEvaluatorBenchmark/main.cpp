@@ -0,0 +1,289 @@
+/**
+ * @file main.cpp
+ * @brief AnimationEvaluator benchmark: sample, blend and skin many characters
+ *
+ * Each character samples one clip, blends a second clip in at partial
+ * weight and computes skinning matrices, the per-frame work of a skinned
+ * crowd. The same frame is also run through a reference path that resolves
+ * every track by bone name, blends array-of-structs poses with slerp into a
+ * freshly allocated temporary, and composes matrices with full 4x4
+ * products, the design the evaluator replaced. Skinning matrices of both
+ * paths must match for unblended poses; blended local rotations, where
+ * nlerp replaces slerp, must match within a small angle.
+ */
+
+#include "Core/Core.h"
+#include "Animation/Runtime/AnimationEvaluator.h"
+#include "Animation/Runtime/SkeletonPosePool.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+using namespace RVX;
+using namespace RVX::Animation;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr TimeUs kClipDuration = 2 * kMicrosecondsPerSecond;
+    constexpr int kKeyframesPerChannel = 30;
+
+    /// A branching humanoid-like hierarchy: a spine with limbs hanging off it
+    Skeleton::Ptr MakeSkeleton(int boneCount, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+
+        auto skeleton = Skeleton::Create();
+        for (int i = 0; i < boneCount; ++i)
+        {
+            const int parent = i == 0 ? -1 : (i % 4 == 1 ? (i - 1) / 2 : i - 1);
+            Bone bone("bone_" + std::to_string(i), parent);
+            bone.localBindPose.translation = Vec3(offset(rng), 0.1f + offset(rng), offset(rng));
+            skeleton->AddBone(bone);
+        }
+        skeleton->ComputeInverseBindPoses();
+        return skeleton;
+    }
+
+    AnimationClip::Ptr MakeClip(const Skeleton& skeleton, std::mt19937& rng, float amplitude)
+    {
+        std::uniform_real_distribution<float> angle(-amplitude, amplitude);
+        std::uniform_real_distribution<float> offset(-0.05f, 0.05f);
+
+        auto clip = std::make_shared<AnimationClip>();
+        clip->duration = kClipDuration;
+        for (const Bone& bone : skeleton.bones)
+        {
+            TransformTrack track;
+            track.targetName = bone.name;
+            for (int k = 0; k < kKeyframesPerChannel; ++k)
+            {
+                const TimeUs time = kClipDuration * k / (kKeyframesPerChannel - 1);
+                track.translationKeyframes.emplace_back(time, bone.localBindPose.translation + Vec3(offset(rng)));
+                track.rotationKeyframes.emplace_back(time, normalize(Quat(Vec3(angle(rng), angle(rng), angle(rng)))));
+            }
+            clip->transformTracks.push_back(std::move(track));
+        }
+
+        // A track for a bone the skeleton does not have must be skipped
+        TransformTrack unbound;
+        unbound.targetName = "prop_attachment";
+        unbound.translationKeyframes.emplace_back(0, Vec3(1.0f));
+        clip->transformTracks.push_back(std::move(unbound));
+        return clip;
+    }
+
+    /// Per-track name lookup, AoS pose, heap temporary, slerp, full matrix products
+    class ReferenceCharacter
+    {
+    public:
+        explicit ReferenceCharacter(Skeleton::ConstPtr skeleton)
+            : m_skeleton(std::move(skeleton))
+            , m_local(m_skeleton->GetBoneCount())
+            , m_global(m_skeleton->GetBoneCount())
+            , m_skinning(m_skeleton->GetBoneCount())
+        {
+        }
+
+        void Update(AnimationEvaluator& sampler, const AnimationClip& base,
+                    const AnimationClip& overlay, TimeUs time, float weight)
+        {
+            Sample(sampler, base, time, m_local);
+
+            if (weight > 0.001f)
+            {
+                std::vector<TransformSample> temp(m_local.size());
+                for (size_t i = 0; i < temp.size(); ++i)
+                {
+                    temp[i] = m_skeleton->bones[i].localBindPose;
+                }
+                Sample(sampler, overlay, time, temp);
+                for (size_t i = 0; i < m_local.size(); ++i)
+                {
+                    m_local[i] = TransformSample::Lerp(m_local[i], temp[i], weight);
+                }
+            }
+
+            const auto& bones = m_skeleton->bones;
+            for (size_t i = 0; i < bones.size(); ++i)
+            {
+                const Mat4 local = m_local[i].ToMatrix();
+                const int parent = bones[i].parentIndex;
+                m_global[i] = parent >= 0 ? m_global[parent] * local : local;
+            }
+            for (size_t i = 0; i < bones.size(); ++i)
+            {
+                m_skinning[i] = m_global[i] * bones[i].inverseBindPose;
+            }
+        }
+
+        const std::vector<Mat4>& GetSkinningMatrices() const { return m_skinning; }
+        const std::vector<TransformSample>& GetLocalTransforms() const { return m_local; }
+
+    private:
+        void Sample(AnimationEvaluator& sampler, const AnimationClip& clip, TimeUs time,
+                    std::vector<TransformSample>& pose)
+        {
+            const TimeUs wrapped = ApplyWrapMode(time, clip.duration, clip.defaultWrapMode);
+            for (const auto& track : clip.transformTracks)
+            {
+                TransformSample sample = sampler.EvaluateTransformTrack(track, wrapped);
+                const int boneIndex = m_skeleton->FindBoneIndex(track.targetName);
+                if (boneIndex >= 0)
+                {
+                    pose[boneIndex] = sample;
+                }
+            }
+        }
+
+        Skeleton::ConstPtr m_skeleton;
+        std::vector<TransformSample> m_local;
+        std::vector<Mat4> m_global;
+        std::vector<Mat4> m_skinning;
+    };
+
+    struct Character
+    {
+        SkeletonPose pose;
+        AnimationEvaluator evaluator;
+        ReferenceCharacter reference;
+    };
+
+    float MaxDifference(const std::vector<Mat4>& a, const std::vector<Mat4>& b)
+    {
+        float maxDiff = a.size() == b.size() ? 0.0f : 1e30f;
+        for (size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int r = 0; r < 4; ++r)
+                {
+                    maxDiff = std::max(maxDiff, std::abs(a[i][c][r] - b[i][c][r]));
+                }
+            }
+        }
+        return maxDiff;
+    }
+
+    /// Largest rotation angle between corresponding bones, in radians
+    float MaxAngleDifference(const SkeletonPose& pose, const std::vector<TransformSample>& reference)
+    {
+        float maxAngle = 0.0f;
+        const auto& rotations = pose.GetRotations();
+        for (size_t i = 0; i < std::min(rotations.size(), reference.size()); ++i)
+        {
+            const float d = std::min(1.0f, std::abs(dot(rotations[i], reference[i].rotation)));
+            maxAngle = std::max(maxAngle, 2.0f * std::acos(d));
+        }
+        return maxAngle;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("AnimationEvaluator Benchmark");
+
+    // Optional scale factor for quick runs: AnimationEvaluatorBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const int frameCount = std::max(4, static_cast<int>(60 * scale));
+    constexpr int kCharacterCount = 200;
+    constexpr float kBlendWeight = 0.35f;
+    constexpr TimeUs kFrameTime = kMicrosecondsPerSecond / 60;
+
+    const int boneCounts[] = {32, 64, 128};
+    int failures = 0;
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} characters, {} frames, overlay clip blended at {} ===",
+                  kCharacterCount, frameCount, kBlendWeight);
+    RVX_CORE_INFO("  {:<8} {:>16} {:>16} {:>10} {:>14} {:>14}",
+                  "Bones", "Reference us", "Evaluator us", "Speedup", "Exact diff", "Blend rad");
+
+    for (int boneCount : boneCounts)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(boneCount));
+        Skeleton::ConstPtr skeleton = MakeSkeleton(boneCount, rng);
+        AnimationClip::ConstPtr baseClip = MakeClip(*skeleton, rng, 0.4f);
+        AnimationClip::ConstPtr overlayClip = MakeClip(*skeleton, rng, 0.4f);
+
+        std::vector<std::unique_ptr<Character>> characters;
+        for (int i = 0; i < kCharacterCount; ++i)
+        {
+            characters.push_back(std::unique_ptr<Character>(
+                new Character{SkeletonPose(skeleton), AnimationEvaluator(), ReferenceCharacter(skeleton)}));
+        }
+        auto timeOf = [&](int frame, int character) {
+            return TimeUs(frame) * kFrameTime + TimeUs(character) * 7919;
+        };
+
+        // Unblended poses must match the reference to float precision
+        float exactDiff = 0.0f;
+        for (int i = 0; i < kCharacterCount; i += 17)
+        {
+            Character& c = *characters[i];
+            c.evaluator.Evaluate(*baseClip, timeOf(0, i), c.pose);
+            c.pose.ComputeSkinningMatrices();
+            c.reference.Update(c.evaluator, *baseClip, *overlayClip, timeOf(0, i), 0.0f);
+            exactDiff = std::max(exactDiff, MaxDifference(c.pose.GetSkinningMatrices(),
+                                                          c.reference.GetSkinningMatrices()));
+        }
+
+        auto start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            for (int i = 0; i < kCharacterCount; ++i)
+            {
+                Character& c = *characters[i];
+                c.reference.Update(c.evaluator, *baseClip, *overlayClip, timeOf(frame, i), kBlendWeight);
+            }
+        }
+        const double referenceUs = ElapsedMs(start) * 1e3 / (double(frameCount) * kCharacterCount);
+
+        start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            for (int i = 0; i < kCharacterCount; ++i)
+            {
+                Character& c = *characters[i];
+                c.evaluator.Evaluate(*baseClip, timeOf(frame, i), c.pose);
+                c.evaluator.EvaluateBlended(*overlayClip, timeOf(frame, i), kBlendWeight, c.pose);
+                c.pose.ComputeSkinningMatrices();
+            }
+        }
+        const double evaluatorUs = ElapsedMs(start) * 1e3 / (double(frameCount) * kCharacterCount);
+
+        // Blended poses differ only by nlerp versus slerp
+        float blendDiff = 0.0f;
+        for (const auto& c : characters)
+        {
+            blendDiff = std::max(blendDiff, MaxAngleDifference(c->pose, c->reference.GetLocalTransforms()));
+        }
+
+        if (exactDiff > 1e-4f || blendDiff > 1e-2f)
+        {
+            RVX_CORE_ERROR("  {} bones: skinning matrices differ from reference ({} unblended, {} blended)",
+                           boneCount, exactDiff, blendDiff);
+            failures++;
+        }
+        if (SkeletonPosePool::GetActiveCount() != 0 || SkeletonPosePool::GetPooledCount() != 1)
+        {
+            RVX_CORE_ERROR("  {} bones: {} scratch poses still borrowed, {} allocated",
+                           boneCount, SkeletonPosePool::GetActiveCount(), SkeletonPosePool::GetPooledCount());
+            failures++;
+        }
+
+        RVX_CORE_INFO("  {:<8} {:>16.2f} {:>16.2f} {:>9.2f}x {:>14.2e} {:>14.2e}",
+                      boneCount, referenceUs, evaluatorUs, referenceUs / evaluatorUs, exactDiff, blendDiff);
+    }
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,306 @@
+/**
+ * @file main.cpp
+ * @brief ClusteredLighting benchmark: light-centric binning vs per-cluster tests
+ *
+ * Scatters point and spot lights around the camera and assigns them to
+ * clusters. The reference walks every cluster, tests every light against
+ * it as a sphere and transforms spot lights inside that loop, the way
+ * AssignLights used to. ClusteredLighting bins each light into the
+ * clusters its bounds cover, tests spots as cones and runs depth slices on
+ * the JobSystem. Point light lists must match the reference exactly; spot
+ * lists must be a subset of the sphere lists that still covers sample
+ * points inside every cone. A second table shows BeginFrame with the
+ * cached cluster AABBs against a projection that changes every frame.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Render/Lighting/ClusteredLighting.h"
+#include "Render/Lighting/LightManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+using namespace RVX;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr uint32 kScreenWidth = 1920;
+    constexpr uint32 kScreenHeight = 1080;
+
+    bool SphereIntersectsAABB(const ClusteredLighting::ClusterAABB& aabb, const Vec3& center, float radius)
+    {
+        Vec3 closest = clamp(center, Vec3(aabb.minPoint), Vec3(aabb.maxPoint));
+        Vec3 diff = center - closest;
+        return dot(diff, diff) <= radius * radius;
+    }
+
+    /// Per-cluster light lists of the previous cluster-by-cluster assignment
+    struct ReferenceAssignment
+    {
+        std::vector<std::vector<LightIndex>> clusters;
+    };
+
+    void AssignReference(ReferenceAssignment& out, const std::vector<ClusteredLighting::ClusterAABB>& aabbs,
+                         const Mat4& view, const LightManager& lights, uint32 maxLightsPerCluster)
+    {
+        const auto& pointLights = lights.GetPointLights();
+        const auto& spotLights = lights.GetSpotLights();
+
+        std::vector<Vec3> pointPositions;
+        for (const auto& light : pointLights)
+        {
+            pointPositions.push_back(Vec3(view * Vec4(light.position, 1.0f)));
+        }
+
+        out.clusters.assign(aabbs.size(), {});
+        for (size_t i = 0; i < aabbs.size(); ++i)
+        {
+            auto& list = out.clusters[i];
+            for (uint32 li = 0; li < pointLights.size(); ++li)
+            {
+                if (SphereIntersectsAABB(aabbs[i], pointPositions[li], pointLights[li].range) &&
+                    list.size() < maxLightsPerCluster)
+                {
+                    list.push_back({static_cast<uint16>(li), 0});
+                }
+            }
+            for (uint32 li = 0; li < spotLights.size(); ++li)
+            {
+                Vec3 viewPos = Vec3(view * Vec4(spotLights[li].position, 1.0f));
+                if (SphereIntersectsAABB(aabbs[i], viewPos, spotLights[li].range) &&
+                    list.size() < maxLightsPerCluster)
+                {
+                    list.push_back({static_cast<uint16>(li), 1});
+                }
+            }
+        }
+    }
+
+    void AddLights(LightManager& lights, uint32 pointCount, uint32 spotCount, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> spread(-120.0f, 120.0f);
+        std::uniform_real_distribution<float> depth(-300.0f, 20.0f);
+        std::uniform_real_distribution<float> range(2.0f, 15.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> angle(0.2f, 0.8f);
+
+        for (uint32 i = 0; i < pointCount; ++i)
+        {
+            lights.AddPointLight(Vec3(spread(rng), spread(rng) * 0.1f, depth(rng)), Vec3(1.0f), 1.0f, range(rng));
+        }
+        for (uint32 i = 0; i < spotCount; ++i)
+        {
+            Vec3 direction(unit(rng), -1.0f, unit(rng));
+            float outer = angle(rng);
+            lights.AddSpotLight(Vec3(spread(rng), 4.0f + spread(rng) * 0.05f, depth(rng)), normalize(direction),
+                                Vec3(1.0f), 1.0f, range(rng) * 2.0f, outer * 0.8f, outer);
+        }
+    }
+
+    /// Points inside a spot light's cone, in view space
+    std::vector<Vec3> SampleCone(const GPUSpotLight& light, const Mat4& view, std::mt19937& rng, int count)
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        const Vec3 axis = normalize(light.direction);
+        const Vec3 helper = std::abs(axis.y) < 0.9f ? Vec3(0, 1, 0) : Vec3(1, 0, 0);
+        const Vec3 tangent = normalize(cross(axis, helper));
+        const Vec3 bitangent = cross(axis, tangent);
+        const float tanAngle = std::tan(std::acos(light.outerConeAngle)) * 0.95f;
+        const float maxAlong = light.range * light.outerConeAngle * 0.95f;  // Stays within range
+
+        std::vector<Vec3> points;
+        for (int i = 0; i < count; ++i)
+        {
+            const float along = unit(rng) * maxAlong;
+            const float radial = std::sqrt(unit(rng)) * along * tanAngle;
+            const float phi = unit(rng) * 6.2831853f;
+            Vec3 world = light.position + axis * along +
+                         (tangent * std::cos(phi) + bitangent * std::sin(phi)) * radial;
+            points.push_back(Vec3(view * Vec4(world, 1.0f)));
+        }
+        return points;
+    }
+
+    bool Contains(const ClusteredLighting::ClusterAABB& aabb, const Vec3& p)
+    {
+        return p.x >= aabb.minPoint.x && p.x <= aabb.maxPoint.x &&
+               p.y >= aabb.minPoint.y && p.y <= aabb.maxPoint.y &&
+               p.z >= aabb.minPoint.z && p.z <= aabb.maxPoint.z;
+    }
+
+    bool ListHas(const LightIndex* begin, const LightIndex* end, uint16 index, uint16 type)
+    {
+        return std::any_of(begin, end, [&](const LightIndex& l) { return l.lightIndex == index && l.lightType == type; });
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize();
+    RVX_CORE_INFO("ClusteredLighting Benchmark ({} workers)", JobSystem::Get().GetWorkerCount());
+
+    // Optional scale factor for quick runs: ClusteredLightingBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const int frameCount = std::max(3, static_cast<int>(20 * scale));
+
+    const Mat4 view = glm::lookAt(Vec3(0.0f, 2.0f, 0.0f), Vec3(0.0f, 2.0f, -1.0f), Vec3(0.0f, 1.0f, 0.0f));
+    const Mat4 proj = glm::perspective(glm::radians(60.0f), float(kScreenWidth) / kScreenHeight, 0.1f, 1000.0f);
+
+    struct LightMix
+    {
+        uint32 points;
+        uint32 spots;
+    };
+    const LightMix mixes[] = {{128, 64}, {512, 256}, {1024, 512}};
+    int failures = 0;
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== Light assignment, {} frames ===", frameCount);
+    RVX_CORE_INFO("  {:<12} {:>14} {:>14} {:>10} {:>14} {:>14} {:>12}",
+                  "Lights", "Reference ms", "Binned ms", "Speedup", "Ref tests", "Binned tests", "Spot lists");
+
+    ClusteredLighting lighting;
+    lighting.Initialize(nullptr);
+    const ClusteringConfig& config = lighting.GetConfig();
+
+    for (const LightMix& mix : mixes)
+    {
+        std::mt19937 rng(mix.points + mix.spots);
+        LightManager lights;
+        AddLights(lights, mix.points, mix.spots, rng);
+
+        lighting.BeginFrame(view, proj, kScreenWidth, kScreenHeight);
+        const auto& aabbs = lighting.GetClusterAABBs();
+
+        ReferenceAssignment reference;
+        auto start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            AssignReference(reference, aabbs, view, lights, config.maxLightsPerCluster);
+        }
+        const double referenceMs = ElapsedMs(start) / frameCount;
+
+        start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            lighting.BeginFrame(view, proj, kScreenWidth, kScreenHeight);
+            lighting.AssignLights(lights);
+        }
+        const double binnedMs = ElapsedMs(start) / frameCount;
+
+        // Point lights: identical lists. Spot lights: a subset of the sphere lists.
+        const auto& clusters = lighting.GetClusters();
+        const auto& indices = lighting.GetLightIndices();
+        size_t referenceSpots = 0, binnedSpots = 0;
+        bool listsMatch = true;
+        for (size_t i = 0; i < clusters.size() && listsMatch; ++i)
+        {
+            const LightIndex* begin = indices.data() + clusters[i].offset;
+            const LightIndex* end = begin + clusters[i].count;
+            const auto& expected = reference.clusters[i];
+
+            std::vector<LightIndex> expectedPoints, actualPoints;
+            for (const LightIndex& l : expected)
+            {
+                if (l.lightType == 0)
+                    expectedPoints.push_back(l);
+                else
+                    referenceSpots++;
+            }
+            for (const LightIndex* l = begin; l != end; ++l)
+            {
+                if (l->lightType == 0)
+                {
+                    actualPoints.push_back(*l);
+                }
+                else
+                {
+                    // A full reference list may have dropped spots the cone test keeps
+                    binnedSpots++;
+                    listsMatch &= expected.size() >= config.maxLightsPerCluster ||
+                        ListHas(expected.data(), expected.data() + expected.size(), l->lightIndex, 1);
+                }
+            }
+            listsMatch &= expectedPoints.size() == actualPoints.size() &&
+                std::equal(expectedPoints.begin(), expectedPoints.end(), actualPoints.begin(),
+                           [](const LightIndex& a, const LightIndex& b) { return a.lightIndex == b.lightIndex; });
+            listsMatch &= clusters[i].pointCount + clusters[i].spotCount == clusters[i].count;
+        }
+        if (!listsMatch)
+        {
+            RVX_CORE_ERROR("  {} + {} lights: cluster lists differ from the reference", mix.points, mix.spots);
+            failures++;
+        }
+
+        // Every cluster containing a point inside a cone must list that spot
+        // (skipping clusters the reference had already filled)
+        size_t missed = 0;
+        const auto& spotLights = lights.GetSpotLights();
+        for (uint32 li = 0; li < spotLights.size(); ++li)
+        {
+            for (const Vec3& p : SampleCone(spotLights[li], view, rng, 8))
+            {
+                for (size_t c = 0; c < aabbs.size(); ++c)
+                {
+                    if (!Contains(aabbs[c], p) || reference.clusters[c].size() >= config.maxLightsPerCluster)
+                        continue;
+                    const LightIndex* begin = indices.data() + clusters[c].offset;
+                    if (!ListHas(begin, begin + clusters[c].count, static_cast<uint16>(li), 1))
+                        missed++;
+                }
+            }
+        }
+        if (missed > 0)
+        {
+            RVX_CORE_ERROR("  {} + {} lights: {} cone samples in clusters without their spot light",
+                           mix.points, mix.spots, missed);
+            failures++;
+        }
+
+        const size_t referenceTests = aabbs.size() * (mix.points + mix.spots);
+        RVX_CORE_INFO("  {:<12} {:>14.3f} {:>14.3f} {:>9.2f}x {:>14} {:>14} {:>5}/{:<6}",
+                      std::to_string(mix.points) + "+" + std::to_string(mix.spots),
+                      referenceMs, binnedMs, referenceMs / binnedMs, referenceTests,
+                      lighting.GetStatistics().clusterTests, binnedSpots, referenceSpots);
+    }
+
+    // Cluster AABBs: cached while the projection holds still
+    {
+        constexpr int kFrames = 200;
+        auto start = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            lighting.BeginFrame(view, proj, kScreenWidth, kScreenHeight);
+        }
+        const double cachedUs = ElapsedMs(start) * 1e3 / kFrames;
+
+        start = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            const float fov = glm::radians(60.0f + static_cast<float>(frame % 2));
+            lighting.BeginFrame(view, glm::perspective(fov, float(kScreenWidth) / kScreenHeight, 0.1f, 1000.0f),
+                                kScreenWidth, kScreenHeight);
+        }
+        const double rebuildUs = ElapsedMs(start) * 1e3 / kFrames;
+
+        RVX_CORE_INFO("");
+        RVX_CORE_INFO("=== BeginFrame, {} clusters ===", config.GetTotalClusterCount());
+        RVX_CORE_INFO("  Same projection {:.2f} us, changing projection {:.2f} us", cachedUs, rebuildUs);
+    }
+
+    lighting.Shutdown();
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
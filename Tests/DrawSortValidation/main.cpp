@@ -0,0 +1,199 @@
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Render/Renderer/DrawSort.h"
+#include "Render/Renderer/RenderDrawItem.h"
+#include "TestFramework/TestRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Test;
+
+namespace
+{
+    std::vector<DrawSortEntry> MakeEntries(size_t count, uint64 keyMask, uint32 seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::vector<DrawSortEntry> entries(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            entries[i] = {rng() & keyMask, static_cast<uint32>(i)};
+        }
+        return entries;
+    }
+
+    // Reference ordering: stable by key, so equal keys keep their input order
+    bool MatchesStableSort(std::vector<DrawSortEntry> entries)
+    {
+        std::vector<DrawSortEntry> expected = entries;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const DrawSortEntry& lhs, const DrawSortEntry& rhs) { return lhs.key < rhs.key; });
+
+        DrawSortScratch scratch;
+        RadixSortDrawEntries(entries, scratch);
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i].key != expected[i].key || entries[i].index != expected[i].index)
+                return false;
+        }
+        return true;
+    }
+
+    RenderDrawItem MakeItem(MaterialRenderMode mode, uint64 materialId, uint64 meshId, float depth)
+    {
+        RenderDrawItem item;
+        item.renderMode = mode;
+        item.materialId = materialId;
+        item.meshId = meshId;
+        item.depthFromCamera = depth;
+        item.sortKey = BuildDrawSortKey(item);
+        return item;
+    }
+} // namespace
+
+bool Test_RadixSortMatchesStableSort()
+{
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(0, ~0ULL, 1)));
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(37, ~0ULL, 2)));
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(5000, ~0ULL, 3)));
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(100000, ~0ULL, 4)));
+    return true;
+}
+
+bool Test_ParallelRadixSortMatchesStableSort()
+{
+    JobSystem::Get().Initialize(4);
+    const bool matches = MatchesStableSort(MakeEntries(200000, ~0ULL, 10)) &&
+                         MatchesStableSort(MakeEntries(200000, 0x0F0F'0000'0000'0F0FULL, 11));
+    JobSystem::Get().Shutdown();
+
+    TEST_ASSERT_TRUE(matches);
+    return true;
+}
+
+bool Test_RadixSortKeepsEqualKeysStable()
+{
+    // Few distinct keys and an odd number of live digits exercise stability and the final swap
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(20000, 0xFFULL, 5)));
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(20000, 0xFF00'0000'00FF'0000ULL, 6)));
+    TEST_ASSERT_TRUE(MatchesStableSort(MakeEntries(20000, 0ULL, 7)));
+    return true;
+}
+
+bool Test_OpaqueKeysGroupMaterialsThenSortFrontToBack()
+{
+    const RenderDrawItem nearA = MakeItem(MaterialRenderMode::Opaque, 10, 1, 2.0f);
+    const RenderDrawItem farA = MakeItem(MaterialRenderMode::Opaque, 10, 1, 50.0f);
+    const RenderDrawItem nearB = MakeItem(MaterialRenderMode::Opaque, 11, 1, 1.0f);
+
+    TEST_ASSERT_TRUE(nearA.sortKey < farA.sortKey);
+
+    // Material dominates depth, so nearB sorts entirely before or after both A items
+    const bool bFirst = nearB.sortKey < nearA.sortKey;
+    TEST_ASSERT_EQ(bFirst, nearB.sortKey < farA.sortKey);
+
+    // Masked draws follow every opaque draw
+    const RenderDrawItem masked = MakeItem(MaterialRenderMode::Masked, 10, 1, 0.0f);
+    TEST_ASSERT_TRUE(masked.sortKey > farA.sortKey);
+    TEST_ASSERT_TRUE(masked.sortKey > nearB.sortKey);
+    return true;
+}
+
+bool Test_TransparentKeysSortBackToFront()
+{
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<float> depth(0.0f, 5000.0f);
+
+    std::vector<RenderDrawItem> items;
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        items.push_back(MakeItem(MaterialRenderMode::Transparent, i % 7, i % 13, depth(rng)));
+    }
+    items.push_back(MakeItem(MaterialRenderMode::Transparent, 1, 1, -1.0f));
+    items.push_back(MakeItem(MaterialRenderMode::Transparent, 1, 1, std::numeric_limits<float>::infinity()));
+
+    DrawSortScratch scratch;
+    std::vector<RenderDrawItem> itemScratch;
+    SortDrawItems(items, scratch, itemScratch);
+
+    for (size_t i = 1; i < items.size(); ++i)
+    {
+        const float prev = std::isfinite(items[i - 1].depthFromCamera) ? std::max(items[i - 1].depthFromCamera, 0.0f) : 0.0f;
+        const float curr = std::isfinite(items[i].depthFromCamera) ? std::max(items[i].depthFromCamera, 0.0f) : 0.0f;
+        TEST_ASSERT_TRUE(prev >= curr);
+    }
+    return true;
+}
+
+bool Test_SortDrawItemsMatchesComparatorSort()
+{
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> depth(0.0f, 1000.0f);
+
+    // Roughly the draw count that made comparator sorting show up in captures
+    std::vector<RenderDrawItem> items;
+    for (uint32 i = 0; i < 40000; ++i)
+    {
+        RenderDrawItem item = MakeItem(MaterialRenderMode::Opaque, rng() % 200, rng() % 1000, depth(rng));
+        item.objectIndex = i;
+        items.push_back(item);
+    }
+
+    std::vector<RenderDrawItem> expected = items;
+    const auto comparatorStart = std::chrono::high_resolution_clock::now();
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const RenderDrawItem& lhs, const RenderDrawItem& rhs) { return lhs.sortKey < rhs.sortKey; });
+    const double comparatorMs = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - comparatorStart).count();
+
+    DrawSortScratch scratch;
+    std::vector<RenderDrawItem> itemScratch;
+    std::vector<RenderDrawItem> warmup = items;
+    SortDrawItems(warmup, scratch, itemScratch);
+
+    const auto radixStart = std::chrono::high_resolution_clock::now();
+    SortDrawItems(items, scratch, itemScratch);
+    const double radixMs = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - radixStart).count();
+
+    RVX_CORE_INFO("  40k draw items: comparator {:.3f} ms, radix {:.3f} ms", comparatorMs, radixMs);
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        TEST_ASSERT_EQ(expected[i].objectIndex, items[i].objectIndex);
+    }
+    return true;
+}
+
+int main()
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Draw Sort Validation Tests");
+
+    TestSuite suite;
+    suite.AddTest("RadixSortMatchesStableSort", Test_RadixSortMatchesStableSort);
+    suite.AddTest("ParallelRadixSortMatchesStableSort", Test_ParallelRadixSortMatchesStableSort);
+    suite.AddTest("RadixSortKeepsEqualKeysStable", Test_RadixSortKeepsEqualKeysStable);
+    suite.AddTest("OpaqueKeysGroupMaterialsThenSortFrontToBack", Test_OpaqueKeysGroupMaterialsThenSortFrontToBack);
+    suite.AddTest("TransparentKeysSortBackToFront", Test_TransparentKeysSortBackToFront);
+    suite.AddTest("SortDrawItemsMatchesComparatorSort", Test_SortDrawItemsMatchesComparatorSort);
+
+    auto results = suite.Run();
+    suite.PrintResults(results);
+
+    Log::Shutdown();
+
+    for (const auto& result : results)
+    {
+        if (!result.passed)
+            return 1;
+    }
+
+    return 0;
+}
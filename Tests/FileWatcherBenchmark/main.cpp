@@ -0,0 +1,354 @@
+/**
+ * @file main.cpp
+ * @brief File watcher benchmark: native notifications vs polling
+ *
+ * Generates a directory tree of small asset files and watches it once with
+ * native notifications (inotify on Linux) and once with the polling
+ * fallback. For each it reports what setting up the watch costs, the CPU the
+ * background thread burns while nothing changes, what an idle Update()
+ * costs the game thread, and the latency from a change on disk to its
+ * callback for modified, created and deleted files and for files in a new
+ * subdirectory.
+ *
+ * Every change must be reported with the right type in both modes. With
+ * native notifications a burst large enough to overflow the kernel event
+ * queue is also written while nobody reads it; the watcher must recover
+ * every file in it by rescanning.
+ */
+
+#include "Core/Core.h"
+#include "Resource/FileWatcher.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if !defined(_WIN32)
+    #include <sys/resource.h>
+#endif
+
+using namespace RVX;
+using namespace RVX::Resource;
+
+namespace
+{
+    constexpr uint32 kDirectories = 100;             // Spread over two levels
+    constexpr uint32 kFilesPerDirectory = 200;
+    constexpr uint32 kSamples = 20;                  // Changes timed per kind
+    constexpr auto kIdleTime = std::chrono::seconds(2);
+    constexpr auto kChangeTimeout = std::chrono::seconds(3);
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// User plus system time of the whole process, in milliseconds
+    double ProcessCpuMs()
+    {
+#if !defined(_WIN32)
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        auto toMs = [](const timeval& time) { return time.tv_sec * 1000.0 + time.tv_usec / 1000.0; };
+        return toMs(usage.ru_utime) + toMs(usage.ru_stime);
+#else
+        return 0.0;
+#endif
+    }
+
+    void WriteFile(const std::filesystem::path& path, uint32 contents)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "asset " << contents << '\n';
+    }
+
+    std::filesystem::path DirectoryPath(const std::filesystem::path& root, uint32 index)
+    {
+        return root / ("group" + std::to_string(index % 10)) / ("dir" + std::to_string(index));
+    }
+
+    std::filesystem::path FilePath(const std::filesystem::path& root, uint32 directory, uint32 file)
+    {
+        return DirectoryPath(root, directory) / ("asset" + std::to_string(file) + ".dat");
+    }
+
+    struct Latency
+    {
+        std::vector<double> samples;
+        uint32 missed = 0;
+
+        double Median()
+        {
+            if (samples.empty())
+                return 0.0;
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2];
+        }
+
+        double Max() const
+        {
+            return samples.empty() ? 0.0 : *std::max_element(samples.begin(), samples.end());
+        }
+    };
+
+    struct RunResult
+    {
+        double watchMs = 0.0;
+        double idleCpuPercent = 0.0;     // Of one core, background thread only
+        double idleUpdateMs = 0.0;       // Game-thread cost of Update() with nothing changing
+        Latency modified;
+        Latency created;
+        Latency deleted;
+        Latency newDirectory;
+        uint32 burstFiles = 0;
+        uint32 burstRecovered = 0;
+    };
+
+    class Run
+    {
+    public:
+        Run(const std::filesystem::path& root, uint32 directories, bool polling)
+            : m_root(root), m_directories(directories), m_polling(polling)
+        {
+        }
+
+        RunResult Execute()
+        {
+            WatchOptions options;
+            options.debounceMs = 0;          // Measure detection, not the debounce delay
+            options.forcePolling = m_polling;
+
+            auto start = Clock::now();
+            const uint32 watchId = m_watcher.Watch(m_root.string(),
+                [this](const FileChangeEvent& event) { m_events.push_back(event); }, options);
+            m_result.watchMs = ElapsedMs(start);
+            if (watchId == 0)
+            {
+                return m_result;
+            }
+
+            m_watcher.StartBackground();
+            MeasureIdle();
+            MeasureChanges();
+            m_watcher.StopBackground();
+
+            if (!m_polling)
+            {
+                MeasureBurst();
+            }
+
+            m_watcher.UnwatchAll();
+            return m_result;
+        }
+
+    private:
+        void MeasureIdle()
+        {
+            // Let the first background pass settle before sampling
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+            const double cpuStart = ProcessCpuMs();
+            const auto start = Clock::now();
+            std::this_thread::sleep_for(kIdleTime);
+            m_result.idleCpuPercent = (ProcessCpuMs() - cpuStart) * 100.0 / ElapsedMs(start);
+
+            constexpr int kUpdates = 20;
+            const auto updateStart = Clock::now();
+            for (int i = 0; i < kUpdates; ++i)
+            {
+                m_watcher.Update();
+            }
+            m_result.idleUpdateMs = ElapsedMs(updateStart) / kUpdates;
+            m_events.clear();
+        }
+
+        void MeasureChanges()
+        {
+            for (uint32 i = 0; i < kSamples; ++i)
+            {
+                const uint32 directory = (i * 37) % m_directories;
+
+                const auto existing = FilePath(m_root, directory, i % kFilesPerDirectory);
+                auto start = Clock::now();
+                WriteFile(existing, 1000 + i);
+                Expect(existing, FileChangeType::Modified, start, m_result.modified);
+
+                const auto added = DirectoryPath(m_root, directory) / ("added" + std::to_string(i) + ".dat");
+                start = Clock::now();
+                WriteFile(added, i);
+                Expect(added, FileChangeType::Created, start, m_result.created);
+
+                start = Clock::now();
+                std::filesystem::remove(added);
+                Expect(added, FileChangeType::Deleted, start, m_result.deleted);
+
+                const auto nested = DirectoryPath(m_root, directory) / ("new" + std::to_string(i)) / "nested";
+                start = Clock::now();
+                std::filesystem::create_directories(nested);
+                WriteFile(nested / "asset.dat", i);
+                Expect(nested / "asset.dat", FileChangeType::Created, start, m_result.newDirectory);
+            }
+        }
+
+        /// Drive Update() like a game loop until the change is reported
+        void Expect(const std::filesystem::path& path, FileChangeType type, Clock::time_point start, Latency& latency)
+        {
+            const std::string expected = path.string();
+            const auto deadline = Clock::now() + kChangeTimeout;
+
+            while (Clock::now() < deadline)
+            {
+                m_watcher.Update();
+
+                // Earlier changes to the path may still be trickling in
+                for (const auto& event : m_events)
+                {
+                    if (event.path == expected && event.type == type)
+                    {
+                        latency.samples.push_back(ElapsedMs(start));
+                        m_events.clear();
+                        return;
+                    }
+                }
+                m_events.clear();
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            latency.missed++;
+        }
+
+        /// Overflow the kernel queue while nobody reads it, then catch up
+        void MeasureBurst()
+        {
+#if defined(__linux__)
+            uint32 queueLimit = 16384;
+            std::ifstream limit("/proc/sys/fs/inotify/max_queued_events");
+            limit >> queueLimit;
+
+            // Each new file queues at least a create and a close
+            const auto burstDirectory = m_root / "burst";
+            std::filesystem::create_directories(burstDirectory);
+            m_watcher.Update();
+            m_events.clear();
+
+            m_result.burstFiles = queueLimit / 2 + 1000;
+            std::unordered_set<std::string> pending;
+            for (uint32 i = 0; i < m_result.burstFiles; ++i)
+            {
+                const auto path = burstDirectory / ("burst" + std::to_string(i) + ".dat");
+                WriteFile(path, i);
+                pending.insert(path.string());
+            }
+
+            const auto deadline = Clock::now() + kChangeTimeout;
+            while (!pending.empty() && Clock::now() < deadline)
+            {
+                m_watcher.Update();
+                for (const auto& event : m_events)
+                {
+                    if (event.type == FileChangeType::Created && pending.erase(event.path) > 0)
+                    {
+                        m_result.burstRecovered++;
+                    }
+                }
+                m_events.clear();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+#endif
+        }
+
+        std::filesystem::path m_root;
+        uint32 m_directories;
+        bool m_polling;
+        FileWatcher m_watcher;
+        std::vector<FileChangeEvent> m_events;
+        RunResult m_result;
+    };
+
+    void CreateTree(const std::filesystem::path& root, uint32 directories)
+    {
+        for (uint32 d = 0; d < directories; ++d)
+        {
+            std::filesystem::create_directories(DirectoryPath(root, d));
+            for (uint32 f = 0; f < kFilesPerDirectory; ++f)
+            {
+                WriteFile(FilePath(root, d, f), f);
+            }
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("File Watcher Benchmark");
+
+    // Optional scale factor for the tree size, e.g. "FileWatcherBenchmark 0.1"
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const uint32 directories = std::max(10u, static_cast<uint32>(kDirectories * scale));
+
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::filesystem::path base = std::filesystem::temp_directory_path() /
+                                       ("RVXFileWatcherBenchmark-" + std::to_string(stamp));
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} directories x {} files under {} ===", directories, kFilesPerDirectory, base.string());
+
+    int failures = 0;
+    RunResult results[2];
+    const char* names[2] = {"native", "polling"};
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        // A fresh tree per run so neither sees the other's leftovers
+        const auto root = base / names[mode];
+        CreateTree(root, directories);
+        results[mode] = Run(root, directories, mode == 1).Execute();
+    }
+
+    std::error_code error;
+    std::filesystem::remove_all(base, error);
+
+    RVX_CORE_INFO("  {:<8} {:>9} {:>10} {:>10} {:>17} {:>17} {:>17} {:>17}",
+                  "mode", "watch ms", "idle cpu%", "update ms",
+                  "modify med/max", "create med/max", "delete med/max", "new dir med/max");
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        RunResult& result = results[mode];
+        RVX_CORE_INFO("  {:<8} {:>9.1f} {:>10.2f} {:>10.3f} {:>8.2f}/{:<8.2f} {:>8.2f}/{:<8.2f} {:>8.2f}/{:<8.2f} {:>8.2f}/{:<8.2f}",
+                      names[mode], result.watchMs, result.idleCpuPercent, result.idleUpdateMs,
+                      result.modified.Median(), result.modified.Max(),
+                      result.created.Median(), result.created.Max(),
+                      result.deleted.Median(), result.deleted.Max(),
+                      result.newDirectory.Median(), result.newDirectory.Max());
+
+        const uint32 missed = result.modified.missed + result.created.missed +
+                              result.deleted.missed + result.newDirectory.missed;
+        if (missed > 0)
+        {
+            RVX_CORE_ERROR("  {}: {} of {} changes not reported", names[mode], missed, kSamples * 4);
+            failures++;
+        }
+    }
+
+    const RunResult& native = results[0];
+    if (native.burstFiles > 0)
+    {
+        RVX_CORE_INFO("  overflow burst: {} of {} files reported", native.burstRecovered, native.burstFiles);
+        if (native.burstRecovered != native.burstFiles)
+        {
+            RVX_CORE_ERROR("  native: files lost after the event queue overflowed");
+            failures++;
+        }
+    }
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
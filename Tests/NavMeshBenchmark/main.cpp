@@ -0,0 +1,288 @@
+/**
+ * @file main.cpp
+ * @brief NavMesh benchmark: Finalize() and poly queries against polygon count
+ *
+ * Builds tiled triangle meshes of growing size and times Finalize(), which
+ * links neighbours through hashed edges and bins polygons into an XZ grid,
+ * then FindNearestPoly() and GetHeight() throughput. On the smaller meshes
+ * the neighbours are checked against the pairwise edge comparison Finalize
+ * used to run, and query results against a scan of every polygon, so a
+ * faster path cannot silently return a worse polygon.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "AI/Navigation/NavMesh.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::AI;
+
+namespace
+{
+    // Sizes above these skip the quadratic / linear references
+    constexpr size_t kMaxReferenceAdjacencyPolys = 8192;
+    constexpr size_t kMaxReferenceQueryPolys = 60000;
+    constexpr int kReferenceQueries = 256;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// Grid of unit quads, each split into two counter-clockwise triangles
+    /// sharing vertices with their neighbours, on a gently rolling surface
+    void BuildTiledMesh(NavMesh& mesh, uint32 tiles)
+    {
+        mesh.Clear();
+        for (uint32 z = 0; z <= tiles; ++z)
+        {
+            for (uint32 x = 0; x <= tiles; ++x)
+            {
+                const float height = 0.25f * std::sin(x * 0.1f) * std::cos(z * 0.1f);
+                mesh.AddVertex(Vec3(static_cast<float>(x), height, static_cast<float>(z)));
+            }
+        }
+
+        const uint32 stride = tiles + 1;
+        for (uint32 z = 0; z < tiles; ++z)
+        {
+            for (uint32 x = 0; x < tiles; ++x)
+            {
+                const uint32 v00 = z * stride + x;
+                const uint32 v10 = v00 + 1;
+                const uint32 v01 = v00 + stride;
+                const uint32 v11 = v01 + 1;
+                mesh.AddPolygon({v00, v10, v11});
+                mesh.AddPolygon({v00, v11, v01});
+            }
+        }
+    }
+
+    /// The pairwise search Finalize() used before edge hashing
+    std::vector<std::vector<NavPolyRef>> ReferenceNeighbors(const NavMesh& mesh)
+    {
+        const auto& polys = mesh.GetPolygons();
+        std::vector<std::vector<NavPolyRef>> neighbors(polys.size());
+        for (size_t i = 0; i < polys.size(); ++i)
+        {
+            neighbors[i].assign(polys[i].vertexIndices.size(), RVX_NAV_INVALID_POLY);
+        }
+
+        for (size_t i = 0; i < polys.size(); ++i)
+        {
+            const auto& a = polys[i].vertexIndices;
+            for (size_t j = i + 1; j < polys.size(); ++j)
+            {
+                const auto& b = polys[j].vertexIndices;
+                for (size_t ei = 0; ei < a.size(); ++ei)
+                {
+                    const uint32 a0 = a[ei];
+                    const uint32 a1 = a[(ei + 1) % a.size()];
+                    for (size_t ej = 0; ej < b.size(); ++ej)
+                    {
+                        const uint32 b0 = b[ej];
+                        const uint32 b1 = b[(ej + 1) % b.size()];
+                        if ((a0 == b1 && a1 == b0) || (a0 == b0 && a1 == b1))
+                        {
+                            neighbors[i][ei] = polys[j].id;
+                            neighbors[j][ej] = polys[i].id;
+                        }
+                    }
+                }
+            }
+        }
+        return neighbors;
+    }
+
+    bool ContainsXZ(const NavMesh& mesh, const NavPoly& poly, const Vec3& position)
+    {
+        const auto& vertices = mesh.GetVertices();
+        for (size_t i = 0; i < poly.vertexIndices.size(); ++i)
+        {
+            const Vec3& a = vertices[poly.vertexIndices[i]];
+            const Vec3& b = vertices[poly.vertexIndices[(i + 1) % poly.vertexIndices.size()]];
+            if ((b.x - a.x) * (position.z - a.z) - (b.z - a.z) * (position.x - a.x) < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct ReferenceResult
+    {
+        NavPolyRef contained = RVX_NAV_INVALID_POLY;  // First polygon containing the position
+        float nearestDist = FLT_MAX;                  // FLT_MAX when nothing is within the extent
+    };
+
+    /// Scan of every polygon with the same acceptance rules as FindNearestPoly
+    ReferenceResult ReferenceNearest(const NavMesh& mesh, const Vec3& position, const Vec3& extent)
+    {
+        ReferenceResult result;
+        for (const NavPoly& poly : mesh.GetPolygons())
+        {
+            if (ContainsXZ(mesh, poly, position) && std::abs(position.y - poly.center.y) < extent.y)
+            {
+                result.contained = poly.id;
+                return result;
+            }
+
+            const Vec3 closest = mesh.ClosestPointOnPoly(poly.id, position);
+            result.nearestDist = std::min(result.nearestDist, glm::length(closest - position));
+        }
+
+        if (result.nearestDist > glm::length(extent))
+        {
+            result.nearestDist = FLT_MAX;
+        }
+        return result;
+    }
+
+    std::vector<Vec3> MakeQueries(uint32 tiles, int count, uint32 seed)
+    {
+        // Past the mesh edges and above or below it, so some queries miss or fall back to the nearest polygon
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> xz(-4.0f, static_cast<float>(tiles) + 4.0f);
+        std::uniform_real_distribution<float> y(-1.5f, 1.5f);
+
+        std::vector<Vec3> queries(count);
+        for (Vec3& query : queries)
+        {
+            query = Vec3(xz(rng), y(rng), xz(rng));
+        }
+        return queries;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize();
+    RVX_CORE_INFO("NavMesh Benchmark ({} workers)", JobSystem::Get().GetWorkerCount());
+
+    // Optional scale factor for the query count, e.g. "NavMeshBenchmark 0.1"
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const int queryCount = std::max(1000, static_cast<int>(200000 * scale));
+
+    // 2k, 8k, 51k and 205k triangles
+    const uint32 tileCounts[] = {32, 64, 160, 320};
+    const Vec3 extent(2.0f, 1.0f, 2.0f);
+
+    int failures = 0;
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("  {:>8} {:>12} {:>14} {:>14} {:>14} {:>14}",
+                  "polys", "finalize ms", "pairwise ms", "nearest us", "height us", "scan us");
+
+    for (uint32 tiles : tileCounts)
+    {
+        NavMesh mesh;
+        BuildTiledMesh(mesh, tiles);
+        const size_t polyCount = mesh.GetPolygons().size();
+
+        auto start = Clock::now();
+        mesh.Finalize();
+        const double finalizeMs = ElapsedMs(start);
+
+        double pairwiseMs = 0.0;
+        if (polyCount <= kMaxReferenceAdjacencyPolys)
+        {
+            start = Clock::now();
+            const auto reference = ReferenceNeighbors(mesh);
+            pairwiseMs = ElapsedMs(start);
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < polyCount; ++i)
+            {
+                mismatches += mesh.GetPolygons()[i].neighbors != reference[i] ? 1 : 0;
+            }
+            if (mismatches > 0)
+            {
+                RVX_CORE_ERROR("  {} polys: {} polygons have different neighbours", polyCount, mismatches);
+                failures++;
+            }
+        }
+
+        const std::vector<Vec3> queries = MakeQueries(tiles, queryCount, tiles);
+
+        start = Clock::now();
+        size_t hits = 0;
+        for (const Vec3& query : queries)
+        {
+            hits += mesh.FindNearestPoly(query, extent) != RVX_NAV_INVALID_POLY ? 1 : 0;
+        }
+        const double nearestUs = ElapsedMs(start) * 1000.0 / queries.size();
+
+        start = Clock::now();
+        float heightSum = 0.0f;
+        for (const Vec3& query : queries)
+        {
+            float height = 0.0f;
+            if (mesh.GetHeight(query, height))
+            {
+                heightSum += height;
+            }
+        }
+        const double heightUs = ElapsedMs(start) * 1000.0 / queries.size();
+
+        double scanUs = 0.0;
+        if (polyCount <= kMaxReferenceQueryPolys)
+        {
+            const std::vector<Vec3> checks = MakeQueries(tiles, kReferenceQueries, tiles + 1);
+            size_t wrong = 0;
+
+            start = Clock::now();
+            std::vector<ReferenceResult> references(checks.size());
+            for (size_t i = 0; i < checks.size(); ++i)
+            {
+                references[i] = ReferenceNearest(mesh, checks[i], extent);
+            }
+            scanUs = ElapsedMs(start) * 1000.0 / checks.size();
+
+            for (size_t i = 0; i < checks.size(); ++i)
+            {
+                const NavPolyRef result = mesh.FindNearestPoly(checks[i], extent);
+                const ReferenceResult& reference = references[i];
+                if (reference.contained != RVX_NAV_INVALID_POLY)
+                {
+                    wrong += result != reference.contained ? 1 : 0;
+                }
+                else if (result == RVX_NAV_INVALID_POLY || reference.nearestDist == FLT_MAX)
+                {
+                    wrong += (result == RVX_NAV_INVALID_POLY) != (reference.nearestDist == FLT_MAX) ? 1 : 0;
+                }
+                else
+                {
+                    const float dist = glm::length(mesh.ClosestPointOnPoly(result, checks[i]) - checks[i]);
+                    wrong += dist > reference.nearestDist + 1e-3f ? 1 : 0;
+                }
+            }
+
+            if (wrong > 0)
+            {
+                RVX_CORE_ERROR("  {} polys: {} of {} queries disagree with a full scan", polyCount, wrong, checks.size());
+                failures++;
+            }
+        }
+
+        RVX_CORE_INFO("  {:>8} {:>12.2f} {:>14} {:>14.3f} {:>14.3f} {:>14}",
+                      polyCount, finalizeMs,
+                      pairwiseMs > 0.0 ? fmt::format("{:.2f}", pairwiseMs) : std::string("-"),
+                      nearestUs, heightUs,
+                      scanUs > 0.0 ? fmt::format("{:.2f}", scanUs) : std::string("-"));
+        RVX_CORE_INFO("  {:>8} {} of {} queries hit (height sum {:.1f})", "", hits, queries.size(), heightSum);
+    }
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,473 @@
+/**
+ * @file main.cpp
+ * @brief Network serializer benchmark: word-buffered bit streams vs per-bit loops
+ *
+ * Packs quantized transform snapshots through BitWriter/BitReader and
+ * through a copy of the per-bit loops the streams used before, and checks
+ * both produce the same bytes and read back the same values. A second
+ * table pushes full transform snapshots through NetworkWriter and
+ * NetworkReader (compressed positions and quaternions) and reports
+ * packets per second and the cost of one server tick sending every
+ * replicated object to every client.
+ */
+
+#include "Core/Core.h"
+#include "Networking/Serialization/NetworkSerializer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Net;
+
+namespace
+{
+    constexpr uint32 kObjectCount = 2000;
+    constexpr uint32 kClientCount = 64;
+    constexpr uint32 kObjectsPerPacket = 48;     // ~1 KB packets
+    constexpr uint32 kPositionBits = 20;
+    constexpr uint32 kVelocityBits = 12;
+    constexpr float kMaxSpeed = 50.0f;
+
+    const Vec3 kWorldMin(-4096.0f, -256.0f, -4096.0f);
+    const Vec3 kWorldMax(4096.0f, 768.0f, 4096.0f);
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // =========================================================================
+    // Per-bit streams, as BitWriter/BitReader were
+    // =========================================================================
+
+    class ReferenceBitWriter
+    {
+    public:
+        explicit ReferenceBitWriter(uint32 capacityBytes) : m_buffer(capacityBytes, 0) {}
+
+        void WriteBit(bool value)
+        {
+            if (value)
+            {
+                m_buffer[m_bitPosition / 8] |= static_cast<uint8>(1u << (m_bitPosition % 8));
+            }
+            m_bitPosition++;
+        }
+
+        void WriteBits(uint32 value, uint32 numBits)
+        {
+            for (uint32 i = 0; i < numBits; ++i)
+            {
+                WriteBit((value >> i) & 1);
+            }
+        }
+
+        void Reset()
+        {
+            std::fill(m_buffer.begin(), m_buffer.end(), uint8(0));
+            m_bitPosition = 0;
+        }
+
+        std::span<const uint8> GetSpan() const { return {m_buffer.data(), (m_bitPosition + 7) / 8}; }
+
+    private:
+        std::vector<uint8> m_buffer;
+        uint32 m_bitPosition = 0;
+    };
+
+    class ReferenceBitReader
+    {
+    public:
+        explicit ReferenceBitReader(std::span<const uint8> data) : m_data(data) {}
+
+        bool ReadBit()
+        {
+            const bool bit = (m_data[m_bitPosition / 8] >> (m_bitPosition % 8)) & 1;
+            m_bitPosition++;
+            return bit;
+        }
+
+        uint32 ReadBits(uint32 numBits)
+        {
+            uint32 result = 0;
+            for (uint32 i = 0; i < numBits; ++i)
+            {
+                if (ReadBit())
+                {
+                    result |= 1u << i;
+                }
+            }
+            return result;
+        }
+
+    private:
+        std::span<const uint8> m_data;
+        uint32 m_bitPosition = 0;
+    };
+
+    // =========================================================================
+    // Snapshots
+    // =========================================================================
+
+    struct ReplicatedTransform
+    {
+        uint16 netId = 0;
+        Vec3 position{0.0f};
+        Quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+        Vec3 velocity{0.0f};
+        bool moving = false;
+    };
+
+    /// A transform already quantized to the field widths NetworkWriter uses
+    struct QuantizedTransform
+    {
+        uint32 netId = 0;
+        uint32 position[3] = {};
+        uint32 rotationIndex = 0;
+        uint32 rotation[3] = {};
+        uint32 moving = 0;
+        uint32 velocity[3] = {};
+
+        bool operator==(const QuantizedTransform&) const = default;
+    };
+
+    std::vector<ReplicatedTransform> MakeTransforms(uint32 count)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> signedUnit(-1.0f, 1.0f);
+
+        std::vector<ReplicatedTransform> transforms(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            ReplicatedTransform& t = transforms[i];
+            t.netId = static_cast<uint16>(i + 1);
+            t.position = kWorldMin + (kWorldMax - kWorldMin) * Vec3(unit(rng), unit(rng), unit(rng));
+            t.rotation = glm::normalize(Quat(signedUnit(rng), signedUnit(rng), signedUnit(rng), signedUnit(rng)));
+            t.moving = unit(rng) < 0.6f;
+            t.velocity = Vec3(signedUnit(rng), signedUnit(rng), signedUnit(rng)) * kMaxSpeed * 0.9f;
+        }
+        return transforms;
+    }
+
+    std::vector<QuantizedTransform> MakeQuantized(uint32 count)
+    {
+        std::mt19937 rng(5678);
+        const auto bits = [&rng](uint32 width) { return static_cast<uint32>(rng()) & ((1u << width) - 1); };
+
+        std::vector<QuantizedTransform> transforms(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            QuantizedTransform& t = transforms[i];
+            t.netId = i + 1;
+            t.rotationIndex = bits(2);
+            t.moving = bits(1);
+            for (int c = 0; c < 3; ++c)
+            {
+                t.position[c] = bits(kPositionBits);
+                t.rotation[c] = bits(10);
+                t.velocity[c] = t.moving ? bits(kVelocityBits) : 0;
+            }
+        }
+        return transforms;
+    }
+
+    template<typename Writer>
+    void PackQuantized(Writer& writer, const QuantizedTransform& t)
+    {
+        writer.WriteBits(t.netId, 16);
+        for (uint32 value : t.position) writer.WriteBits(value, kPositionBits);
+        writer.WriteBits(t.rotationIndex, 2);
+        for (uint32 value : t.rotation) writer.WriteBits(value, 10);
+        writer.WriteBits(t.moving, 1);
+        if (t.moving)
+        {
+            for (uint32 value : t.velocity) writer.WriteBits(value, kVelocityBits);
+        }
+    }
+
+    template<typename Reader>
+    QuantizedTransform UnpackQuantized(Reader& reader)
+    {
+        QuantizedTransform t;
+        t.netId = reader.ReadBits(16);
+        for (uint32& value : t.position) value = reader.ReadBits(kPositionBits);
+        t.rotationIndex = reader.ReadBits(2);
+        for (uint32& value : t.rotation) value = reader.ReadBits(10);
+        t.moving = reader.ReadBits(1);
+        if (t.moving)
+        {
+            for (uint32& value : t.velocity) value = reader.ReadBits(kVelocityBits);
+        }
+        return t;
+    }
+
+    void WriteTransform(NetworkWriter& writer, const ReplicatedTransform& t)
+    {
+        writer.WriteUInt16(t.netId);
+        writer.WriteCompressedPosition(t.position, kWorldMin, kWorldMax, kPositionBits);
+        writer.WriteCompressedQuat(t.rotation);
+        writer.WriteBool(t.moving);
+        if (t.moving)
+        {
+            writer.WriteCompressedPosition(t.velocity, Vec3(-kMaxSpeed), Vec3(kMaxSpeed), kVelocityBits);
+        }
+    }
+
+    ReplicatedTransform ReadTransform(NetworkReader& reader)
+    {
+        ReplicatedTransform t;
+        t.netId = reader.ReadUInt16();
+        t.position = reader.ReadCompressedPosition(kWorldMin, kWorldMax, kPositionBits);
+        t.rotation = reader.ReadCompressedQuat();
+        t.moving = reader.ReadBool();
+        if (t.moving)
+        {
+            t.velocity = reader.ReadCompressedPosition(Vec3(-kMaxSpeed), Vec3(kMaxSpeed), kVelocityBits);
+        }
+        return t;
+    }
+
+    /// Writes packet header + objects [first, first + count)
+    template<typename Writer, typename Object, typename WriteFn>
+    void WritePacket(Writer& writer, uint32 sequence, const std::vector<Object>& objects,
+                     uint32 first, uint32 count, WriteFn&& writeObject)
+    {
+        writer.WriteBits(sequence & 0xFFFF, 16);
+        writer.WriteBits(count, 8);
+        for (uint32 i = first; i < first + count; ++i)
+        {
+            writeObject(writer, objects[i]);
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Network Serializer Benchmark");
+
+    // Optional scale factor for the number of repetitions, e.g. "NetworkSerializerBenchmark 0.1"
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const int snapshotRounds = std::max(4, static_cast<int>(kClientCount * scale));
+    const uint32 packetsPerSnapshot = (kObjectCount + kObjectsPerPacket - 1) / kObjectsPerPacket;
+
+    int failures = 0;
+
+    // =========================================================================
+    // Raw bit packing
+    // =========================================================================
+
+    const std::vector<QuantizedTransform> quantized = MakeQuantized(kObjectCount);
+    std::vector<std::vector<uint8>> packets(packetsPerSnapshot);
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== Bit packing ({} quantized transforms, {} packets per snapshot) ===",
+                  kObjectCount, packetsPerSnapshot);
+    RVX_CORE_INFO("  {:<12} {:>14} {:>14} {:>12}", "stream", "write pkt/s", "read pkt/s", "MB/s write");
+
+    const auto packetRange = [&](uint32 packet, uint32& first, uint32& count)
+    {
+        first = packet * kObjectsPerPacket;
+        count = std::min(kObjectsPerPacket, kObjectCount - first);
+    };
+
+    const auto report = [&](const char* name, double writeMs, double readMs, size_t bytes)
+    {
+        const double packetCount = static_cast<double>(packetsPerSnapshot) * snapshotRounds;
+        RVX_CORE_INFO("  {:<12} {:>14.0f} {:>14.0f} {:>12.1f}", name,
+                      packetCount / (writeMs / 1000.0), packetCount / (readMs / 1000.0),
+                      static_cast<double>(bytes) * snapshotRounds / (writeMs / 1000.0) / (1024.0 * 1024.0));
+    };
+
+    {
+        ReferenceBitWriter writer(2048);
+        size_t bytes = 0;
+        auto start = Clock::now();
+        for (int round = 0; round < snapshotRounds; ++round)
+        {
+            bytes = 0;
+            for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+            {
+                uint32 first, count;
+                packetRange(packet, first, count);
+                writer.Reset();
+                WritePacket(writer, packet, quantized, first, count,
+                            [](ReferenceBitWriter& w, const QuantizedTransform& t) { PackQuantized(w, t); });
+                const auto span = writer.GetSpan();
+                packets[packet].assign(span.begin(), span.end());
+                bytes += span.size();
+            }
+        }
+        const double writeMs = ElapsedMs(start);
+
+        size_t mismatches = 0;
+        start = Clock::now();
+        for (int round = 0; round < snapshotRounds; ++round)
+        {
+            for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+            {
+                uint32 first, count;
+                packetRange(packet, first, count);
+                ReferenceBitReader reader(packets[packet]);
+                reader.ReadBits(16);
+                reader.ReadBits(8);
+                for (uint32 i = first; i < first + count; ++i)
+                {
+                    mismatches += UnpackQuantized(reader) == quantized[i] ? 0 : 1;
+                }
+            }
+        }
+        const double readMs = ElapsedMs(start);
+
+        report("per-bit", writeMs, readMs, bytes);
+        if (mismatches > 0)
+        {
+            RVX_CORE_ERROR("  per-bit: {} transforms read back differently", mismatches);
+            failures++;
+        }
+    }
+
+    {
+        BitWriter writer(2048);
+        size_t bytes = 0;
+        size_t differentPackets = 0;
+        auto start = Clock::now();
+        for (int round = 0; round < snapshotRounds; ++round)
+        {
+            bytes = 0;
+            for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+            {
+                uint32 first, count;
+                packetRange(packet, first, count);
+                writer.Reset();
+                WritePacket(writer, packet, quantized, first, count,
+                            [](BitWriter& w, const QuantizedTransform& t) { PackQuantized(w, t); });
+                const auto span = writer.GetSpan();
+                bytes += span.size();
+                if (round == 0)
+                {
+                    differentPackets += std::equal(span.begin(), span.end(),
+                                                   packets[packet].begin(), packets[packet].end()) ? 0 : 1;
+                }
+            }
+        }
+        const double writeMs = ElapsedMs(start);
+
+        size_t mismatches = 0;
+        start = Clock::now();
+        for (int round = 0; round < snapshotRounds; ++round)
+        {
+            for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+            {
+                uint32 first, count;
+                packetRange(packet, first, count);
+                BitReader reader(packets[packet]);
+                reader.ReadBits(16);
+                reader.ReadBits(8);
+                for (uint32 i = first; i < first + count; ++i)
+                {
+                    mismatches += UnpackQuantized(reader) == quantized[i] ? 0 : 1;
+                }
+                mismatches += reader.HasOverflowed() ? 1 : 0;
+            }
+        }
+        const double readMs = ElapsedMs(start);
+
+        report("BitStream", writeMs, readMs, bytes);
+        if (differentPackets > 0)
+        {
+            RVX_CORE_ERROR("  BitStream: {} packets differ from the per-bit stream", differentPackets);
+            failures++;
+        }
+        if (mismatches > 0)
+        {
+            RVX_CORE_ERROR("  BitStream: {} transforms read back differently", mismatches);
+            failures++;
+        }
+    }
+
+    // =========================================================================
+    // Full transform snapshots
+    // =========================================================================
+
+    const std::vector<ReplicatedTransform> transforms = MakeTransforms(kObjectCount);
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== Transform snapshots through NetworkWriter/NetworkReader ===");
+
+    BitWriter bitWriter(2048);
+    NetworkWriter writer(bitWriter);
+    size_t snapshotBytes = 0;
+
+    auto start = Clock::now();
+    for (int round = 0; round < snapshotRounds; ++round)
+    {
+        snapshotBytes = 0;
+        for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+        {
+            uint32 first, count;
+            packetRange(packet, first, count);
+            bitWriter.Reset();
+            WritePacket(bitWriter, packet, transforms, first, count,
+                        [&writer](BitWriter&, const ReplicatedTransform& t) { WriteTransform(writer, t); });
+            const auto span = bitWriter.GetSpan();
+            packets[packet].assign(span.begin(), span.end());
+            snapshotBytes += span.size();
+        }
+    }
+    const double writeMs = ElapsedMs(start);
+
+    // One quantization step per component, plus float error
+    const Vec3 positionTolerance = (kWorldMax - kWorldMin) / static_cast<float>((1u << kPositionBits) - 1) + 1e-3f;
+    size_t mismatches = 0;
+    start = Clock::now();
+    for (int round = 0; round < snapshotRounds; ++round)
+    {
+        for (uint32 packet = 0; packet < packetsPerSnapshot; ++packet)
+        {
+            uint32 first, count;
+            packetRange(packet, first, count);
+            BitReader bitReader(packets[packet]);
+            NetworkReader reader(bitReader);
+            bitReader.ReadBits(16);
+            mismatches += bitReader.ReadBits(8) == count ? 0 : 1;
+            for (uint32 i = first; i < first + count; ++i)
+            {
+                const ReplicatedTransform t = ReadTransform(reader);
+                const ReplicatedTransform& expected = transforms[i];
+                const Vec3 positionError = glm::abs(t.position - expected.position);
+                const bool ok = t.netId == expected.netId && t.moving == expected.moving &&
+                                positionError.x <= positionTolerance.x &&
+                                positionError.y <= positionTolerance.y &&
+                                positionError.z <= positionTolerance.z &&
+                                std::abs(glm::dot(t.rotation, expected.rotation)) > 0.999f;
+                mismatches += ok ? 0 : 1;
+            }
+        }
+    }
+    const double readMs = ElapsedMs(start);
+
+    const double packetCount = static_cast<double>(packetsPerSnapshot) * snapshotRounds;
+    const double snapshotMs = writeMs / snapshotRounds;
+    RVX_CORE_INFO("  {} bytes per snapshot ({:.1f} bytes per object)",
+                  snapshotBytes, static_cast<double>(snapshotBytes) / kObjectCount);
+    RVX_CORE_INFO("  write {:>10.0f} pkt/s {:>10.3f} ms/snapshot", packetCount / (writeMs / 1000.0), snapshotMs);
+    RVX_CORE_INFO("  read  {:>10.0f} pkt/s {:>10.3f} ms/snapshot", packetCount / (readMs / 1000.0), readMs / snapshotRounds);
+    RVX_CORE_INFO("  server tick, {} objects to {} clients: {:.2f} ms", kObjectCount, kClientCount, snapshotMs * kClientCount);
+
+    if (mismatches > 0)
+    {
+        RVX_CORE_ERROR("  {} transforms read back outside quantization error", mismatches);
+        failures++;
+    }
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,397 @@
+#include "Core/Core.h"
+#include "Null/NullDevice.h"
+#include "RHI/RHICommandContext.h"
+#include "RHI/RHIDevice.h"
+#include "TestFramework/TestRunner.h"
+
+#include <array>
+#include <cstring>
+#include <memory>
+
+using namespace RVX;
+using namespace RVX::Test;
+
+namespace
+{
+    std::unique_ptr<IRHIDevice> CreateDevice()
+    {
+        RHIDeviceDesc desc;
+        desc.enableDebugLayer = false;
+        return CreateRHIDevice(RHIBackendType::Null, desc);
+    }
+
+    RHITextureBarrier Transition(RHITexture* texture, RHIResourceState before, RHIResourceState after)
+    {
+        RHITextureBarrier barrier;
+        barrier.texture = texture;
+        barrier.stateBefore = before;
+        barrier.stateAfter = after;
+        return barrier;
+    }
+
+    uint64 GetValidationErrors(const IRHIDevice& device)
+    {
+        return GetNullDeviceStats(device)->validationErrors;
+    }
+
+    // Minimal graphics setup: a pipeline with one set that has a dynamic
+    // uniform buffer, a render target and an index buffer
+    struct DrawSetup
+    {
+        RHIShaderRef vertexShader;
+        RHIDescriptorSetLayoutRef setLayout;
+        RHIPipelineLayoutRef pipelineLayout;
+        RHIPipelineRef pipeline;
+        RHIBufferRef constants;
+        RHIDescriptorSetRef descriptorSet;
+        RHITextureRef colorTarget;
+        RHITextureViewRef colorView;
+        RHIBufferRef indexBuffer;
+    };
+
+    DrawSetup CreateDrawSetup(IRHIDevice& device)
+    {
+        DrawSetup setup;
+
+        RHIShaderDesc shaderDesc;
+        shaderDesc.stage = RHIShaderStage::Vertex;
+        setup.vertexShader = device.CreateShader(shaderDesc);
+
+        RHIDescriptorSetLayoutDesc setLayoutDesc;
+        setLayoutDesc.entries.push_back({0, RHIBindingType::DynamicUniformBuffer, RHIShaderStage::All, 1, true});
+        setup.setLayout = device.CreateDescriptorSetLayout(setLayoutDesc);
+
+        RHIPipelineLayoutDesc pipelineLayoutDesc;
+        pipelineLayoutDesc.setLayouts.push_back(setup.setLayout.Get());
+        setup.pipelineLayout = device.CreatePipelineLayout(pipelineLayoutDesc);
+
+        RHIGraphicsPipelineDesc pipelineDesc;
+        pipelineDesc.vertexShader = setup.vertexShader.Get();
+        pipelineDesc.pipelineLayout = setup.pipelineLayout.Get();
+        setup.pipeline = device.CreateGraphicsPipeline(pipelineDesc);
+
+        setup.constants = device.CreateBuffer(RHIBufferDesc()
+            .SetSize(1024)
+            .SetUsage(RHIBufferUsage::Constant)
+            .SetMemoryType(RHIMemoryType::Upload));
+
+        RHIDescriptorSetDesc setDesc;
+        setDesc.SetLayout(setup.setLayout.Get()).BindBuffer(0, setup.constants.Get(), 0, 256);
+        setup.descriptorSet = device.CreateDescriptorSet(setDesc);
+
+        setup.colorTarget = device.CreateTexture(RHITextureDesc::RenderTarget(64, 64, RHIFormat::RGBA8_UNORM));
+        setup.colorView = device.CreateTextureView(setup.colorTarget.Get());
+
+        setup.indexBuffer = device.CreateBuffer(RHIBufferDesc()
+            .SetSize(36 * sizeof(uint32))
+            .SetUsage(RHIBufferUsage::Index));
+        return setup;
+    }
+} // namespace
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool Test_FactoryCreatesNullDevice()
+{
+    auto device = CreateDevice();
+    TEST_ASSERT_NOT_NULL(device);
+    TEST_ASSERT_EQ(device->GetBackendType(), RHIBackendType::Null);
+    TEST_ASSERT_EQ(device->GetCapabilities().backendType, RHIBackendType::Null);
+    TEST_ASSERT_TRUE(device->GetCapabilities().adapterName == "Null Device");
+    TEST_ASSERT_NOT_NULL(GetNullDeviceStats(*device));
+
+    for (uint32 frame = 0; frame < RVX_MAX_FRAME_COUNT + 1; ++frame)
+    {
+        TEST_ASSERT_EQ(device->GetCurrentFrameIndex(), frame % RVX_MAX_FRAME_COUNT);
+        device->BeginFrame();
+        device->EndFrame();
+    }
+
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 0u);
+    return true;
+}
+
+bool Test_BuffersMapAndTrackMemory()
+{
+    auto device = CreateDevice();
+
+    {
+        auto upload = device->CreateBuffer(RHIBufferDesc()
+            .SetSize(256)
+            .SetUsage(RHIBufferUsage::Constant)
+            .SetMemoryType(RHIMemoryType::Upload));
+        auto vertex = device->CreateBuffer(RHIBufferDesc()
+            .SetSize(1024)
+            .SetUsage(RHIBufferUsage::Vertex));
+
+        auto* data = static_cast<uint8*>(upload->Map());
+        TEST_ASSERT_NOT_NULL(data);
+        std::memset(data, 0x5A, 256);
+        upload->Unmap();
+        TEST_ASSERT_EQ(static_cast<uint8*>(upload->Map())[255], 0x5A);
+        upload->Unmap();
+
+        RHIMemoryStats memory = device->GetMemoryStats();
+        TEST_ASSERT_EQ(memory.bufferMemory, 1280u);
+        TEST_ASSERT_EQ(GetNullDeviceStats(*device)->bufferCount, 2u);
+        TEST_ASSERT_EQ(GetValidationErrors(*device), 0u);
+
+        // GPU-only memory cannot be mapped
+        TEST_ASSERT_TRUE(vertex->Map() == nullptr);
+        TEST_ASSERT_EQ(GetValidationErrors(*device), 1u);
+    }
+
+    RHIMemoryStats memory = device->GetMemoryStats();
+    TEST_ASSERT_EQ(memory.bufferMemory, 0u);
+    TEST_ASSERT_EQ(memory.peakUsage, 1280u);
+    TEST_ASSERT_EQ(GetNullDeviceStats(*device)->bufferCount, 0u);
+    return true;
+}
+
+bool Test_SubmitCountsDrawsAndBarriers()
+{
+    auto device = CreateDevice();
+    DrawSetup setup = CreateDrawSetup(*device);
+    TEST_ASSERT_NOT_NULL(setup.pipeline);
+    TEST_ASSERT_NOT_NULL(setup.descriptorSet);
+
+    auto ctx = device->CreateCommandContext(RHICommandQueueType::Graphics);
+    ctx->Begin();
+    ctx->TextureBarrier(Transition(setup.colorTarget.Get(), RHIResourceState::Common, RHIResourceState::RenderTarget));
+    ctx->BeginRenderPass(RHIRenderPassDesc().AddColorAttachment(setup.colorView.Get()));
+    ctx->SetPipeline(setup.pipeline.Get());
+    const std::array<uint32, 1> dynamicOffsets = {256};
+    ctx->SetDescriptorSet(0, setup.descriptorSet.Get(), dynamicOffsets);
+    ctx->SetIndexBuffer(setup.indexBuffer.Get(), RHIFormat::R32_UINT);
+    ctx->DrawIndexed(36, 10);
+    ctx->Draw(3);
+    ctx->EndRenderPass();
+    ctx->TextureBarrier(Transition(setup.colorTarget.Get(), RHIResourceState::RenderTarget, RHIResourceState::ShaderResource));
+    ctx->End();
+
+    // Recorded work is not counted until it is submitted
+    TEST_ASSERT_EQ(GetNullDeviceStats(*device)->drawCalls, 0u);
+
+    device->SubmitCommandContext(ctx.Get());
+
+    const NullDeviceStats* stats = GetNullDeviceStats(*device);
+    TEST_ASSERT_EQ(stats->submissions, 1u);
+    TEST_ASSERT_EQ(stats->commandContexts, 1u);
+    TEST_ASSERT_EQ(stats->renderPasses, 1u);
+    TEST_ASSERT_EQ(stats->drawCalls, 2u);
+    TEST_ASSERT_EQ(stats->instances, 11u);
+    TEST_ASSERT_EQ(stats->primitives, 121u);
+    TEST_ASSERT_EQ(stats->pipelineBinds, 1u);
+    TEST_ASSERT_EQ(stats->descriptorSetBinds, 1u);
+    TEST_ASSERT_EQ(stats->textureBarriers, 2u);
+    TEST_ASSERT_EQ(stats->validationErrors, 0u);
+
+    ResetNullDeviceStats(*device);
+    TEST_ASSERT_EQ(GetNullDeviceStats(*device)->drawCalls, 0u);
+    TEST_ASSERT_EQ(GetNullDeviceStats(*device)->pipelineCount, 1u);
+    return true;
+}
+
+bool Test_BarrierStateMismatchIsReported()
+{
+    auto device = CreateDevice();
+    auto texture = device->CreateTexture(RHITextureDesc::Texture2D(16, 16, RHIFormat::RGBA8_UNORM));
+
+    auto ctx = device->CreateCommandContext(RHICommandQueueType::Graphics);
+    ctx->Begin();
+    ctx->TextureBarrier(Transition(texture.Get(), RHIResourceState::Common, RHIResourceState::ShaderResource));
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 0u);
+
+    // The texture is a shader resource, not a render target
+    ctx->TextureBarrier(Transition(texture.Get(), RHIResourceState::RenderTarget, RHIResourceState::CopySource));
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 1u);
+
+    // A render pass needs its attachment in RenderTarget state
+    auto view = device->CreateTextureView(texture.Get());
+    ctx->BeginRenderPass(RHIRenderPassDesc().AddColorAttachment(view.Get()));
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 2u);
+    ctx->EndRenderPass();
+    ctx->End();
+    return true;
+}
+
+bool Test_InvalidCommandsAreReported()
+{
+    auto device = CreateDevice();
+    DrawSetup setup = CreateDrawSetup(*device);
+    auto ctx = device->CreateCommandContext(RHICommandQueueType::Graphics);
+
+    // Outside Begin/End
+    ctx->Draw(3);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 1u);
+
+    ctx->Begin();
+
+    // Outside a render pass
+    ctx->SetPipeline(setup.pipeline.Get());
+    ctx->Draw(3);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 2u);
+
+    // Missing dynamic offset
+    ctx->SetDescriptorSet(0, setup.descriptorSet.Get());
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 3u);
+
+    // Indexed draw without an index buffer
+    ctx->TextureBarrier(Transition(setup.colorTarget.Get(), RHIResourceState::Common, RHIResourceState::RenderTarget));
+    ctx->BeginRenderPass(RHIRenderPassDesc().AddColorAttachment(setup.colorView.Get()));
+    ctx->DrawIndexed(36);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 4u);
+
+    // Dispatch inside a render pass, with a graphics pipeline bound
+    ctx->Dispatch(1, 1, 1);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 6u);
+
+    // Ending with the pass still open
+    ctx->End();
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 7u);
+
+    device->SubmitCommandContext(ctx.Get());
+    const NullDeviceStats* stats = GetNullDeviceStats(*device);
+    TEST_ASSERT_EQ(stats->drawCalls, 0u);
+    TEST_ASSERT_EQ(stats->dispatches, 0u);
+    TEST_ASSERT_EQ(stats->validationErrors, 7u);
+    return true;
+}
+
+bool Test_FencesSignalOnSubmit()
+{
+    auto device = CreateDevice();
+    auto contextFence = device->CreateFence(0);
+    auto submitFence = device->CreateFence(0);
+
+    auto ctx = device->CreateCommandContext(RHICommandQueueType::Graphics);
+    ctx->Begin();
+    ctx->SignalFence(contextFence.Get(), 5);
+    ctx->End();
+
+    TEST_ASSERT_EQ(contextFence->GetCompletedValue(), 0u);
+
+    device->SubmitCommandContext(ctx.Get(), submitFence.Get());
+    TEST_ASSERT_EQ(contextFence->GetCompletedValue(), 5u);
+    TEST_ASSERT_EQ(submitFence->GetCompletedValue(), 1u);
+
+    // Waiting on completed values returns immediately
+    device->WaitForFence(submitFence.Get(), 1);
+    device->WaitIdle();
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 0u);
+    return true;
+}
+
+bool Test_StagingAndRingBuffers()
+{
+    auto device = CreateDevice();
+
+    auto staging = device->CreateStagingBuffer(RHIStagingBufferDesc().SetSize(1024));
+    auto* base = static_cast<uint8*>(staging->Map());
+    staging->Unmap();
+    auto* offset = static_cast<uint8*>(staging->Map(512, 256));
+    TEST_ASSERT_TRUE(offset == base + 512);
+    staging->Unmap();
+
+    // Mapping past the end is rejected
+    TEST_ASSERT_TRUE(staging->Map(1000, 100) == nullptr);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 1u);
+
+    RHIRingBufferDesc ringDesc;
+    ringDesc.size = 1024;
+    ringDesc.alignment = 256;
+    auto ring = device->CreateRingBuffer(ringDesc);
+
+    RHIRingAllocation first = ring->Allocate(100);
+    RHIRingAllocation second = ring->Allocate(100);
+    TEST_ASSERT_TRUE(first.IsValid() && second.IsValid());
+    TEST_ASSERT_EQ(first.gpuOffset, 0u);
+    TEST_ASSERT_EQ(second.gpuOffset, 256u);
+    TEST_ASSERT_TRUE(first.buffer == ring->GetBuffer());
+
+    // The frame's space is used up until the ring is reset
+    TEST_ASSERT_FALSE(ring->Allocate(600).IsValid());
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 2u);
+
+    ring->Reset(1);
+    TEST_ASSERT_EQ(ring->Allocate(600).gpuOffset, 0u);
+    return true;
+}
+
+bool Test_SwapChainCyclesBackBuffers()
+{
+    auto device = CreateDevice();
+
+    RHISwapChainDesc desc;
+    desc.width = 320;
+    desc.height = 240;
+    desc.bufferCount = 2;
+    auto swapChain = device->CreateSwapChain(desc);
+
+    RHITexture* first = swapChain->GetCurrentBackBuffer();
+    TEST_ASSERT_EQ(first->GetWidth(), 320u);
+    TEST_ASSERT_TRUE(swapChain->GetCurrentBackBufferView()->GetTexture() == first);
+
+    auto ctx = device->CreateCommandContext(RHICommandQueueType::Graphics);
+    ctx->Begin();
+    ctx->TextureBarrier(Transition(first, RHIResourceState::Present, RHIResourceState::RenderTarget));
+    ctx->BeginRenderPass(RHIRenderPassDesc().AddColorAttachment(swapChain->GetCurrentBackBufferView()));
+    ctx->EndRenderPass();
+    ctx->TextureBarrier(Transition(first, RHIResourceState::RenderTarget, RHIResourceState::Present));
+    ctx->End();
+    device->SubmitCommandContext(ctx.Get());
+
+    swapChain->Present();
+    TEST_ASSERT_EQ(swapChain->GetCurrentBackBufferIndex(), 1u);
+    TEST_ASSERT_TRUE(swapChain->GetCurrentBackBuffer() != first);
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 0u);
+
+    // Presenting a back buffer left in RenderTarget state is an error
+    RHITexture* second = swapChain->GetCurrentBackBuffer();
+    ctx->Begin();
+    ctx->TextureBarrier(Transition(second, RHIResourceState::Present, RHIResourceState::RenderTarget));
+    ctx->End();
+    device->SubmitCommandContext(ctx.Get());
+    swapChain->Present();
+    TEST_ASSERT_EQ(GetValidationErrors(*device), 1u);
+    TEST_ASSERT_EQ(swapChain->GetCurrentBackBufferIndex(), 0u);
+
+    swapChain->Resize(640, 480);
+    TEST_ASSERT_EQ(swapChain->GetCurrentBackBuffer()->GetWidth(), 640u);
+    return true;
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main()
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Null RHI Validation Tests");
+
+    TestSuite suite;
+    suite.AddTest("FactoryCreatesNullDevice", Test_FactoryCreatesNullDevice);
+    suite.AddTest("BuffersMapAndTrackMemory", Test_BuffersMapAndTrackMemory);
+    suite.AddTest("SubmitCountsDrawsAndBarriers", Test_SubmitCountsDrawsAndBarriers);
+    suite.AddTest("BarrierStateMismatchIsReported", Test_BarrierStateMismatchIsReported);
+    suite.AddTest("InvalidCommandsAreReported", Test_InvalidCommandsAreReported);
+    suite.AddTest("FencesSignalOnSubmit", Test_FencesSignalOnSubmit);
+    suite.AddTest("StagingAndRingBuffers", Test_StagingAndRingBuffers);
+    suite.AddTest("SwapChainCyclesBackBuffers", Test_SwapChainCyclesBackBuffers);
+
+    auto results = suite.Run();
+    suite.PrintResults(results);
+
+    Log::Shutdown();
+
+    for (const auto& result : results)
+    {
+        if (!result.passed)
+            return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,345 @@
+/**
+ * @file main.cpp
+ * @brief CPUParticleSimulator benchmark: SoA SIMD kernels vs AoS per particle
+ *
+ * Simulates a fountain of particles falling onto a ground plane with drag,
+ * curl noise, colour and size over lifetime, and reports the cost per
+ * frame. The reference is the previous simulator layout: an array of
+ * 100-byte particles walked through an alive index list, one particle at a
+ * time, with the list rebuilt every frame to drop dead particles. Both
+ * start from the same particles and must agree on their state after the
+ * run; a short-lived run checks that both retire the same particles on the
+ * same frames. Runs headless, without an RHI device.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Particle/GPU/CPUParticleSimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+using namespace RVX;
+using namespace RVX::Particle;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr float kFrameTime = 1.0f / 60.0f;
+
+    // =========================================================================
+    // Reference: AoS particles behind an alive index list
+    // =========================================================================
+
+    float PerlinNoise(const Vec3& pos)
+    {
+        auto fade = [](float t) { return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f); };
+        auto lerp = [](float a, float b, float t) { return a + t * (b - a); };
+        auto hash = [](int x, int y, int z) -> int {
+            uint32 n = static_cast<uint32>(x + y * 57 + z * 113);
+            n = (n << 13) ^ n;
+            return static_cast<int>((n * (n * n * 15731u + 789221u) + 1376312589u) & 0x7fffffffu);
+        };
+        auto grad = [](int h, float x, float y, float z) -> float {
+            int b = h & 15;
+            float u = b < 8 ? x : y;
+            float v = b < 4 ? y : (b == 12 || b == 14 ? x : z);
+            return ((b & 1) ? -u : u) + ((b & 2) ? -v : v);
+        };
+
+        int X = static_cast<int>(std::floor(pos.x)) & 255;
+        int Y = static_cast<int>(std::floor(pos.y)) & 255;
+        int Z = static_cast<int>(std::floor(pos.z)) & 255;
+        float x = pos.x - std::floor(pos.x);
+        float y = pos.y - std::floor(pos.y);
+        float z = pos.z - std::floor(pos.z);
+        float u = fade(x), v = fade(y), w = fade(z);
+
+        float x1 = lerp(grad(hash(X, Y, Z), x, y, z), grad(hash(X + 1, Y, Z), x - 1, y, z), u);
+        float x2 = lerp(grad(hash(X, Y + 1, Z), x, y - 1, z), grad(hash(X + 1, Y + 1, Z), x - 1, y - 1, z), u);
+        float x3 = lerp(grad(hash(X, Y, Z + 1), x, y, z - 1), grad(hash(X + 1, Y, Z + 1), x - 1, y, z - 1), u);
+        float x4 = lerp(grad(hash(X, Y + 1, Z + 1), x, y - 1, z - 1), grad(hash(X + 1, Y + 1, Z + 1), x - 1, y - 1, z - 1), u);
+        return lerp(lerp(x1, x2, v), lerp(x3, x4, v), w);
+    }
+
+    Vec3 CurlNoise(const Vec3& pos, float epsilon)
+    {
+        float n1 = PerlinNoise(pos + Vec3(0, epsilon, 0));
+        float n2 = PerlinNoise(pos - Vec3(0, epsilon, 0));
+        float n3 = PerlinNoise(pos + Vec3(0, 0, epsilon));
+        float n4 = PerlinNoise(pos - Vec3(0, 0, epsilon));
+        float n5 = PerlinNoise(pos + Vec3(epsilon, 0, 0));
+        float n6 = PerlinNoise(pos - Vec3(epsilon, 0, 0));
+        return Vec3((n1 - n2) - (n3 - n4), (n3 - n4) - (n5 - n6), (n5 - n6) - (n1 - n2)) / (2.0f * epsilon);
+    }
+
+    struct ReferenceSimulator
+    {
+        std::vector<CPUParticle> particles;
+        std::vector<uint32> alive;
+        size_t deaths = 0;
+
+        explicit ReferenceSimulator(const CPUParticleStreams& streams)
+        {
+            for (uint32 i = 0; i < streams.count; ++i)
+            {
+                particles.push_back(streams.Get(i));
+                alive.push_back(i);
+            }
+        }
+
+        void SimulateParticle(CPUParticle& p, float dt, const CPUSimulateParams& params) const
+        {
+            const SimulationGPUData& data = params.simulationData;
+            p.age += dt;
+            if (p.age >= p.lifetime)
+            {
+                p.flags &= ~PARTICLE_FLAG_ALIVE;
+                return;
+            }
+            float normalizedAge = p.age / p.lifetime;
+
+            p.velocity += (Vec3(data.gravity) + Vec3(data.forceParams)) * dt;
+            p.velocity *= (1.0f - data.forceParams.w * dt);
+
+            const NoiseModule& noise = *params.noiseModule;
+            Vec3 noisePos = p.position * noise.frequency + Vec3(0.0f, params.totalTime * noise.scrollSpeed, 0.0f);
+            p.velocity += CurlNoise(noisePos, 0.01f) * (noise.strength * noise.positionAmount * dt);
+
+            p.position += p.velocity * dt;
+            p.rotation += p.rotationSpeed * dt;
+
+            for (uint32 i = 0; i < data.collisionPlaneCount; ++i)
+            {
+                Vec3 normal = Vec3(data.collisionPlanes[i]);
+                float dist = dot(p.position, normal) + data.collisionPlanes[i].w;
+                float radius = p.size.x * data.collisionRadiusScale;
+                if (dist < radius)
+                {
+                    p.velocity = (p.velocity - normal * (2.0f * dot(p.velocity, normal))) * data.collisionBounce;
+                    p.position += normal * (radius - dist);
+                    p.lifetime -= p.lifetime * data.collisionLifetimeLoss;
+                    p.flags |= PARTICLE_FLAG_COLLISION;
+                }
+            }
+
+            p.color = params.colorModule->Evaluate(normalizedAge) * p.startColor;
+            p.size = p.startSize * params.sizeModule->Evaluate(normalizedAge);
+        }
+
+        void Simulate(float dt, const CPUSimulateParams& params)
+        {
+            JobSystem::Get().ParallelFor(0, alive.size(), [&](size_t i) {
+                SimulateParticle(particles[alive[i]], dt, params);
+            });
+
+            std::vector<uint32> newAlive;
+            newAlive.reserve(alive.size());
+            for (uint32 index : alive)
+            {
+                if (particles[index].flags & PARTICLE_FLAG_ALIVE)
+                    newAlive.push_back(index);
+                else
+                    deaths++;
+            }
+            alive = std::move(newAlive);
+        }
+    };
+
+    // =========================================================================
+    // Scene
+    // =========================================================================
+
+    struct Modules
+    {
+        ColorOverLifetimeModule color;
+        SizeOverLifetimeModule size;
+        NoiseModule noise;
+    };
+
+    void SetupModules(Modules& modules)
+    {
+        modules.color.colorGradient = GradientCurve::FadeOut();
+        modules.size.sizeCurve = AnimationCurve::Linear();
+        modules.size.sizeMultiplier = Vec2(0.5f, 0.5f);
+        modules.noise.strength = 2.0f;
+        modules.noise.frequency = 0.5f;
+        modules.noise.scrollSpeed = 0.25f;
+    }
+
+    CPUSimulateParams MakeSimulateParams(const Modules& modules, float totalTime)
+    {
+        CPUSimulateParams params;
+        SimulationGPUData& data = params.simulationData;
+        data = SimulationGPUData{};
+        data.gravity = Vec4(0.0f, -9.81f, 0.0f, 0.0f);
+        data.forceParams = Vec4(0.5f, 0.0f, 0.0f, 0.1f);
+        data.collisionPlanes[0] = Vec4(0.0f, 1.0f, 0.0f, 0.0f);
+        data.collisionPlaneCount = 1;
+        data.collisionBounce = 0.5f;
+        data.collisionLifetimeLoss = 0.1f;
+        data.collisionRadiusScale = 0.5f;
+        data.collisionEnabled = 1;
+        params.colorModule = &modules.color;
+        params.sizeModule = &modules.size;
+        params.noiseModule = &modules.noise;
+        params.totalTime = totalTime;
+        return params;
+    }
+
+    EmitParams MakeEmitParams(uint32 count, float minLife, float maxLife)
+    {
+        EmitParams params;
+        EmitterGPUData& data = params.emitterData;
+        data = EmitterGPUData{};
+        data.transform = glm::translate(Mat4(1.0f), Vec3(0.0f, 2.0f, 0.0f));
+        data.emitterShape = static_cast<uint32>(EmitterShape::Box);
+        data.shapeParams = Vec4(4.0f, 1.0f, 4.0f, 0.0f);
+        data.velocityParams = Vec4(1.0f, 4.0f, 1.0f, 0.0f);
+        data.lifetimeParams = Vec4(minLife, maxLife, 0.0f, 0.0f);
+        data.sizeParams = Vec4(0.05f, 0.2f, 0.0f, 0.0f);
+        data.colorStart = Vec4(1.0f, 0.6f, 0.2f, 1.0f);
+        data.rotationParams = Vec4(0.0f, 6.28f, -1.0f, 1.0f);
+        params.emitCount = count;
+        params.randomSeed = 1234;
+        return params;
+    }
+
+    struct Difference
+    {
+        float position = 0.0f;
+        float velocity = 0.0f;
+        float color = 0.0f;
+        float size = 0.0f;
+    };
+
+    Difference Compare(const ReferenceSimulator& reference, const CPUParticleStreams& streams)
+    {
+        Difference diff;
+        for (uint32 i = 0; i < streams.count; ++i)
+        {
+            const CPUParticle& expected = reference.particles[reference.alive[i]];
+            const CPUParticle actual = streams.Get(i);
+            for (int c = 0; c < 3; ++c)
+            {
+                diff.position = std::max(diff.position, std::abs(actual.position[c] - expected.position[c]));
+                diff.velocity = std::max(diff.velocity, std::abs(actual.velocity[c] - expected.velocity[c]));
+            }
+            for (int c = 0; c < 4; ++c)
+            {
+                diff.color = std::max(diff.color, std::abs(actual.color[c] - expected.color[c]));
+            }
+            for (int c = 0; c < 2; ++c)
+            {
+                diff.size = std::max(diff.size, std::abs(actual.size[c] - expected.size[c]));
+            }
+        }
+        return diff;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize();
+    RVX_CORE_INFO("ParticleSimulation Benchmark ({} workers)", JobSystem::Get().GetWorkerCount());
+
+    // Optional scale factor for quick runs: ParticleSimulationBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const uint32 particleCount = std::max(1000u, static_cast<uint32>(1000000 * scale));
+    const int frameCount = std::max(4, static_cast<int>(30 * scale));
+    int failures = 0;
+
+    Modules modules;
+    SetupModules(modules);
+
+    // Long-lived particles: nothing dies, so both sides keep the same order
+    {
+        CPUParticleSimulator simulator;
+        simulator.Initialize(nullptr, particleCount);
+        simulator.Emit(MakeEmitParams(particleCount, 100.0f, 200.0f));
+        ReferenceSimulator reference(simulator.GetParticleStreams());
+
+        auto start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            reference.Simulate(kFrameTime, MakeSimulateParams(modules, frame * kFrameTime));
+        }
+        const double referenceMs = ElapsedMs(start) / frameCount;
+
+        start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            simulator.SimulateWithModules(kFrameTime, MakeSimulateParams(modules, frame * kFrameTime));
+        }
+        const double soaMs = ElapsedMs(start) / frameCount;
+
+        const Difference diff = Compare(reference, simulator.GetParticleStreams());
+        if (simulator.GetAliveCount() != particleCount ||
+            diff.position > 1e-3f || diff.velocity > 1e-3f || diff.color > 1e-2f || diff.size > 1e-2f)
+        {
+            RVX_CORE_ERROR("  SoA state differs from reference (alive {}, position {}, velocity {}, color {}, size {})",
+                           simulator.GetAliveCount(), diff.position, diff.velocity, diff.color, diff.size);
+            failures++;
+        }
+
+        RVX_CORE_INFO("");
+        RVX_CORE_INFO("=== {} particles, {} frames, noise + colour + size + plane collision ===",
+                      particleCount, frameCount);
+        RVX_CORE_INFO("  {:<10} {:>14} {:>14}", "Layout", "ms / frame", "ns / particle");
+        RVX_CORE_INFO("  {:<10} {:>14.2f} {:>14.2f}", "AoS", referenceMs, referenceMs * 1e6 / particleCount);
+        RVX_CORE_INFO("  {:<10} {:>14.2f} {:>14.2f}", "SoA SIMD", soaMs, soaMs * 1e6 / particleCount);
+        RVX_CORE_INFO("  Speedup {:.2f}x, max difference: position {:.2e}, velocity {:.2e}, color {:.2e}, size {:.2e}",
+                      referenceMs / soaMs, diff.position, diff.velocity, diff.color, diff.size);
+    }
+
+    // Short-lived particles: both retire the same number each frame
+    {
+        constexpr uint32 kShortLivedCount = 20000;
+        constexpr int kShortLivedFrames = 40;
+
+        CPUParticleSimulator simulator;
+        simulator.Initialize(nullptr, kShortLivedCount);
+        simulator.Emit(MakeEmitParams(kShortLivedCount, 0.1f, 0.5f));
+        ReferenceSimulator reference(simulator.GetParticleStreams());
+
+        size_t deathEvents = 0;
+        for (int frame = 0; frame < kShortLivedFrames; ++frame)
+        {
+            const CPUSimulateParams params = MakeSimulateParams(modules, frame * kFrameTime);
+            reference.Simulate(kFrameTime, params);
+            simulator.SimulateWithModules(kFrameTime, params);
+            for (const ParticleEvent& event : simulator.GetQueuedEvents())
+            {
+                deathEvents += event.type == ParticleEventType::OnDeath ? 1 : 0;
+            }
+
+            if (simulator.GetAliveCount() != reference.alive.size())
+            {
+                RVX_CORE_ERROR("  Frame {}: {} particles alive, reference has {}",
+                               frame, simulator.GetAliveCount(), reference.alive.size());
+                failures++;
+                break;
+            }
+        }
+        if (simulator.GetAliveCount() != 0 || deathEvents != reference.deaths)
+        {
+            RVX_CORE_ERROR("  Short-lived run: {} alive, {} death events for {} deaths",
+                           simulator.GetAliveCount(), deathEvents, reference.deaths);
+            failures++;
+        }
+        RVX_CORE_INFO("  Short-lived run: {} deaths over {} frames, {} death events",
+                      reference.deaths, kShortLivedFrames, deathEvents);
+    }
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,351 @@
+#include "Core/Core.h"
+#include "Physics/Broadphase/Broadphase.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/Shapes/CollisionShape.h"
+#include "TestFramework/TestRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Physics;
+using namespace RVX::Test;
+
+namespace
+{
+    bool Overlaps(const AABB& a, const AABB& b)
+    {
+        return a.GetMin().x <= b.GetMax().x && a.GetMax().x >= b.GetMin().x &&
+               a.GetMin().y <= b.GetMax().y && a.GetMax().y >= b.GetMin().y &&
+               a.GetMin().z <= b.GetMax().z && a.GetMax().z >= b.GetMin().z;
+    }
+
+    AABB RandomBox(std::mt19937& rng, float worldExtent)
+    {
+        std::uniform_real_distribution<float> position(-worldExtent, worldExtent);
+        std::uniform_real_distribution<float> size(0.2f, 2.0f);
+        const Vec3 center(position(rng), position(rng), position(rng));
+        const Vec3 half(size(rng), size(rng), size(rng));
+        return AABB(center - half, center + half);
+    }
+
+    PhysicsWorld::Ptr CreateWorldWithGround(float groundTop)
+    {
+        auto world = std::make_shared<PhysicsWorld>();
+        world->Initialize();
+
+        RigidBodyDesc groundDesc;
+        groundDesc.type = BodyType::Static;
+        groundDesc.position = Vec3(0.0f, groundTop - 1.0f, 0.0f);
+        BodyHandle ground = world->CreateBody(groundDesc);
+        world->AddShape(ground, std::make_shared<BoxShape>(Vec3(500.0f, 1.0f, 500.0f)));
+        return world;
+    }
+
+    BodyHandle CreateDynamic(PhysicsWorld& world, const Vec3& position, std::shared_ptr<CollisionShape> shape)
+    {
+        RigidBodyDesc desc;
+        desc.type = BodyType::Dynamic;
+        desc.position = position;
+        desc.allowSleep = false;
+        BodyHandle handle = world.CreateBody(desc);
+        world.AddShape(handle, std::move(shape));
+        return handle;
+    }
+} // namespace
+
+bool Test_TreeStaysBalancedForSortedInserts()
+{
+    // Sorted inserts degrade an unbalanced tree into a list
+    DynamicAABBTree tree;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const Vec3 center(static_cast<float>(i) * 2.0f, 0.0f, 0.0f);
+        tree.CreateProxy(AABB(center - Vec3(0.5f), center + Vec3(0.5f)), nullptr);
+    }
+
+    TEST_ASSERT_TRUE(tree.Validate());
+    TEST_ASSERT_EQ(tree.GetProxyCount(), size_t(10000));
+
+    // AVL bound is ~1.44 * log2(n), about 19 levels here
+    TEST_ASSERT_TRUE(tree.GetHeight() <= 20);
+    return true;
+}
+
+bool Test_TreeQueryMatchesBruteForce()
+{
+    std::mt19937 rng(1);
+    DynamicAABBTree tree;
+
+    std::vector<int32> proxies;
+    std::vector<AABB> bounds;
+    for (int i = 0; i < 2000; ++i)
+    {
+        bounds.push_back(RandomBox(rng, 100.0f));
+        proxies.push_back(tree.CreateProxy(bounds.back(), nullptr));
+    }
+
+    std::uniform_real_distribution<float> step(-1.5f, 1.5f);
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        // Move everything, destroy a few and recreate them elsewhere
+        for (size_t i = 0; i < proxies.size(); ++i)
+        {
+            const Vec3 delta(step(rng), step(rng), step(rng));
+            bounds[i] = AABB(bounds[i].GetMin() + delta, bounds[i].GetMax() + delta);
+            tree.MoveProxy(proxies[i], bounds[i], delta);
+        }
+        for (size_t i = frame; i < proxies.size(); i += 97)
+        {
+            tree.DestroyProxy(proxies[i]);
+            bounds[i] = RandomBox(rng, 100.0f);
+            proxies[i] = tree.CreateProxy(bounds[i], nullptr);
+        }
+        TEST_ASSERT_TRUE(tree.Validate());
+
+        for (int query = 0; query < 50; ++query)
+        {
+            const AABB queryBox = RandomBox(rng, 100.0f);
+
+            std::set<int32> found;
+            tree.Query(queryBox, [&](int32 proxy) { found.insert(proxy); return true; });
+
+            // Every tight overlap is reported and every report overlaps the fat bounds
+            for (size_t i = 0; i < proxies.size(); ++i)
+            {
+                if (Overlaps(bounds[i], queryBox))
+                    TEST_ASSERT_TRUE(found.count(proxies[i]) == 1);
+            }
+            for (int32 proxy : found)
+                TEST_ASSERT_TRUE(Overlaps(tree.GetFatBounds(proxy), queryBox));
+        }
+    }
+    return true;
+}
+
+bool Test_BroadphasePairsCoverOverlaps()
+{
+    std::mt19937 rng(2);
+    Broadphase broadphase;
+
+    std::vector<int32> proxies;
+    std::vector<AABB> bounds;
+    for (int i = 0; i < 1500; ++i)
+    {
+        bounds.push_back(RandomBox(rng, 40.0f));
+        proxies.push_back(broadphase.AddProxy(bounds.back(), nullptr));
+    }
+
+    std::uniform_real_distribution<float> step(-0.3f, 0.3f);
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        for (size_t i = 0; i < proxies.size(); ++i)
+        {
+            // Half the proxies sit still so cached pairs must survive without re-queries
+            if (i % 2 == 0)
+                continue;
+            const Vec3 delta(step(rng), step(rng), step(rng));
+            bounds[i] = AABB(bounds[i].GetMin() + delta, bounds[i].GetMax() + delta);
+            broadphase.MoveProxy(proxies[i], bounds[i], delta);
+        }
+        if (frame % 5 == 4)
+        {
+            const size_t victim = static_cast<size_t>(frame) * 13 % proxies.size();
+            broadphase.RemoveProxy(proxies[victim]);
+            bounds[victim] = RandomBox(rng, 40.0f);
+            proxies[victim] = broadphase.AddProxy(bounds[victim], nullptr);
+        }
+
+        broadphase.UpdatePairs();
+
+        std::set<std::pair<int32, int32>> cached;
+        for (const BroadphasePair& pair : broadphase.GetPairs())
+        {
+            TEST_ASSERT_TRUE(pair.proxyA < pair.proxyB);
+            TEST_ASSERT_TRUE(broadphase.GetTree().FatBoundsOverlap(pair.proxyA, pair.proxyB));
+            TEST_ASSERT_TRUE(cached.insert({pair.proxyA, pair.proxyB}).second);
+        }
+
+        for (size_t i = 0; i < proxies.size(); ++i)
+        {
+            for (size_t j = i + 1; j < proxies.size(); ++j)
+            {
+                if (!Overlaps(bounds[i], bounds[j]))
+                    continue;
+                const int32 a = std::min(proxies[i], proxies[j]);
+                const int32 b = std::max(proxies[i], proxies[j]);
+                TEST_ASSERT_TRUE(cached.count({a, b}) == 1);
+            }
+        }
+    }
+
+    TEST_ASSERT_TRUE(broadphase.GetTree().Validate());
+    return true;
+}
+
+bool Test_ShapesComeToRestOnGround()
+{
+    auto world = CreateWorldWithGround(0.0f);
+
+    int enterCount = 0;
+    world->SetOnCollisionEnter([&](const CollisionEvent&) { ++enterCount; });
+
+    // Sphere and box use the analytic and SAT paths, the cylinder goes through GJK + EPA
+    BodyHandle sphere = CreateDynamic(*world, Vec3(0.0f, 3.0f, 0.0f), std::make_shared<SphereShape>(0.5f));
+    BodyHandle box = CreateDynamic(*world, Vec3(5.0f, 3.0f, 0.0f), std::make_shared<BoxShape>(Vec3(0.5f)));
+    BodyHandle cylinder = CreateDynamic(*world, Vec3(10.0f, 3.0f, 0.0f), std::make_shared<CylinderShape>(0.5f, 0.5f));
+    BodyHandle capsule = CreateDynamic(*world, Vec3(15.0f, 3.0f, 0.0f), std::make_shared<CapsuleShape>(0.25f, 0.5f));
+
+    for (int i = 0; i < 180; ++i)
+        world->Step(1.0f / 60.0f);
+
+    TEST_ASSERT_TRUE(std::abs(world->GetBodyPosition(sphere).y - 0.5f) < 0.05f);
+    TEST_ASSERT_TRUE(std::abs(world->GetBodyPosition(box).y - 0.5f) < 0.05f);
+    TEST_ASSERT_TRUE(std::abs(world->GetBodyPosition(cylinder).y - 0.5f) < 0.05f);
+    TEST_ASSERT_TRUE(std::abs(world->GetBodyPosition(capsule).y - 0.75f) < 0.05f);
+    TEST_ASSERT_EQ(enterCount, 4);
+    return true;
+}
+
+bool Test_TriggersReportWithoutBlocking()
+{
+    auto world = CreateWorldWithGround(-20.0f);
+
+    RigidBodyDesc triggerDesc;
+    triggerDesc.type = BodyType::Static;
+    triggerDesc.isTrigger = true;
+    BodyHandle trigger = world->CreateBody(triggerDesc);
+    world->AddShape(trigger, std::make_shared<BoxShape>(Vec3(2.0f, 0.5f, 2.0f)));
+
+    int triggerEnter = 0;
+    int triggerExit = 0;
+    int collisionEnter = 0;
+    world->SetOnTriggerEnter([&](const CollisionEvent& event)
+    {
+        if (event.isTrigger && (event.bodyIdA == trigger.GetId() || event.bodyIdB == trigger.GetId()))
+            ++triggerEnter;
+    });
+    world->SetOnTriggerExit([&](const CollisionEvent&) { ++triggerExit; });
+    world->SetOnCollisionEnter([&](const CollisionEvent&) { ++collisionEnter; });
+
+    BodyHandle ball = CreateDynamic(*world, Vec3(0.0f, 3.0f, 0.0f), std::make_shared<SphereShape>(0.5f));
+
+    for (int i = 0; i < 120; ++i)
+        world->Step(1.0f / 60.0f);
+
+    TEST_ASSERT_TRUE(world->GetBodyPosition(ball).y < -2.0f);
+    TEST_ASSERT_EQ(triggerEnter, 1);
+    TEST_ASSERT_EQ(triggerExit, 1);
+    TEST_ASSERT_EQ(collisionEnter, 0);
+    return true;
+}
+
+bool Test_DestroyBodyDropsPairs()
+{
+    auto world = CreateWorldWithGround(0.0f);
+
+    std::vector<BodyHandle> bodies;
+    for (int i = 0; i < 16; ++i)
+    {
+        bodies.push_back(CreateDynamic(*world, Vec3(static_cast<float>(i) * 0.9f, 0.5f, 0.0f),
+                                       std::make_shared<SphereShape>(0.5f)));
+    }
+
+    world->Step(1.0f / 60.0f);
+    TEST_ASSERT_TRUE(world->GetBroadphase().GetPairs().size() >= bodies.size());
+
+    for (size_t i = 0; i < bodies.size(); i += 2)
+        world->DestroyBody(bodies[i]);
+
+    for (const BroadphasePair& pair : world->GetBroadphase().GetPairs())
+    {
+        for (int32 proxy : {pair.proxyA, pair.proxyB})
+        {
+            const auto* body = static_cast<const RigidBody*>(world->GetBroadphase().GetUserData(proxy));
+            TEST_ASSERT_NOT_NULL(world->GetBody(body->GetHandle()));
+        }
+    }
+
+    world->Step(1.0f / 60.0f);
+    TEST_ASSERT_TRUE(world->GetBroadphase().GetTree().Validate());
+    return true;
+}
+
+bool Test_FiveThousandBodiesStep()
+{
+    auto world = CreateWorldWithGround(0.0f);
+
+    // Two loose layers that land and settle into a pile of contacts
+    std::shared_ptr<CollisionShape> sphereShape = std::make_shared<SphereShape>(0.5f);
+    std::shared_ptr<CollisionShape> boxShape = std::make_shared<BoxShape>(Vec3(0.45f));
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> jitter(-0.2f, 0.2f);
+
+    std::vector<BodyHandle> bodies;
+    for (int layer = 0; layer < 2; ++layer)
+    {
+        for (int x = 0; x < 50; ++x)
+        {
+            for (int z = 0; z < 50; ++z)
+            {
+                const Vec3 position(x * 1.5f - 37.5f + jitter(rng), 1.0f + layer * 1.5f, z * 1.5f - 37.5f + jitter(rng));
+                bodies.push_back(CreateDynamic(*world, position, (x + z) % 2 == 0 ? sphereShape : boxShape));
+            }
+        }
+    }
+
+    constexpr int kSteps = 120;
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    for (int i = 0; i < kSteps; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        world->Step(1.0f / 60.0f);
+        const double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+    }
+
+    const Broadphase::Stats& stats = world->GetBroadphase().GetStats();
+    RVX_CORE_INFO("  {} bodies: {:.3f} ms/step avg, {:.3f} ms worst, {} pairs, {} moved proxies, tree height {}",
+                  bodies.size(), totalMs / kSteps, worstMs, stats.pairCount, stats.movedProxyCount, stats.treeHeight);
+
+    // Nothing tunnels through the ground
+    for (BodyHandle body : bodies)
+        TEST_ASSERT_TRUE(world->GetBodyPosition(body).y > 0.2f);
+    return true;
+}
+
+int main()
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Physics Broadphase Validation Tests");
+
+    TestSuite suite;
+    suite.AddTest("TreeStaysBalancedForSortedInserts", Test_TreeStaysBalancedForSortedInserts);
+    suite.AddTest("TreeQueryMatchesBruteForce", Test_TreeQueryMatchesBruteForce);
+    suite.AddTest("BroadphasePairsCoverOverlaps", Test_BroadphasePairsCoverOverlaps);
+    suite.AddTest("ShapesComeToRestOnGround", Test_ShapesComeToRestOnGround);
+    suite.AddTest("TriggersReportWithoutBlocking", Test_TriggersReportWithoutBlocking);
+    suite.AddTest("DestroyBodyDropsPairs", Test_DestroyBodyDropsPairs);
+    suite.AddTest("FiveThousandBodiesStep", Test_FiveThousandBodiesStep);
+
+    auto results = suite.Run();
+    suite.PrintResults(results);
+
+    Log::Shutdown();
+
+    for (const auto& result : results)
+    {
+        if (!result.passed)
+            return 1;
+    }
+
+    return 0;
+}
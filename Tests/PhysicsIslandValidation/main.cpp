@@ -0,0 +1,349 @@
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Physics/Constraints/DistanceConstraint.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/Shapes/CollisionShape.h"
+#include "TestFramework/TestRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Physics;
+using namespace RVX::Test;
+
+namespace
+{
+    constexpr float kStep = 1.0f / 60.0f;
+
+    PhysicsWorld::Ptr CreateWorldWithGround(const PhysicsWorldConfig& config = {})
+    {
+        auto world = std::make_shared<PhysicsWorld>();
+        world->Initialize(config);
+
+        RigidBodyDesc groundDesc;
+        groundDesc.type = BodyType::Static;
+        groundDesc.position = Vec3(0.0f, -1.0f, 0.0f);
+        BodyHandle ground = world->CreateBody(groundDesc);
+        world->AddShape(ground, std::make_shared<BoxShape>(Vec3(500.0f, 1.0f, 500.0f)));
+        return world;
+    }
+
+    BodyHandle CreateBox(PhysicsWorld& world, const Vec3& position)
+    {
+        RigidBodyDesc desc;
+        desc.type = BodyType::Dynamic;
+        desc.position = position;
+        BodyHandle handle = world.CreateBody(desc);
+        world.AddShape(handle, std::make_shared<BoxShape>(Vec3(0.5f)));
+        return handle;
+    }
+
+    /// Boxes resting on each other, bottom first
+    std::vector<BodyHandle> CreateStack(PhysicsWorld& world, const Vec3& base, int height)
+    {
+        std::vector<BodyHandle> stack;
+        for (int i = 0; i < height; ++i)
+            stack.push_back(CreateBox(world, base + Vec3(0.0f, 0.5f + static_cast<float>(i), 0.0f)));
+        return stack;
+    }
+
+    bool AllSleeping(const PhysicsWorld& world, const std::vector<BodyHandle>& bodies)
+    {
+        return std::all_of(bodies.begin(), bodies.end(), [&](BodyHandle body)
+        {
+            return world.GetBody(body)->IsSleeping();
+        });
+    }
+
+    bool StepUntilAsleep(PhysicsWorld& world, const std::vector<BodyHandle>& bodies, float maxSeconds)
+    {
+        for (float t = 0.0f; t < maxSeconds; t += kStep)
+        {
+            world.Step(kStep);
+            if (AllSleeping(world, bodies))
+                return true;
+        }
+        return false;
+    }
+} // namespace
+
+bool Test_RestingBodiesFallAsleep()
+{
+    auto world = CreateWorldWithGround();
+
+    std::vector<BodyHandle> boxes;
+    for (int i = 0; i < 20; ++i)
+        boxes.push_back(CreateBox(*world, Vec3(static_cast<float>(i) * 3.0f, 1.0f, 0.0f)));
+
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, boxes, 5.0f));
+
+    // A world at rest does no island work at all
+    world->Step(kStep);
+    TEST_ASSERT_EQ(world->GetStepStats().islandCount, size_t(0));
+    TEST_ASSERT_EQ(world->GetStepStats().awakeBodyCount, size_t(0));
+
+    for (BodyHandle box : boxes)
+    {
+        TEST_ASSERT_TRUE(world->GetBodyPosition(box).y > 0.4f);
+        TEST_ASSERT_TRUE(glm::length(world->GetBodyVelocity(box)) == 0.0f);
+    }
+    return true;
+}
+
+bool Test_BodiesThatCannotSleepStayAwake()
+{
+    auto world = CreateWorldWithGround();
+    std::vector<BodyHandle> stack = CreateStack(*world, Vec3(0.0f), 2);
+    world->GetBody(stack[1])->SetAllowSleep(false);
+
+    // The insomniac keeps its whole island awake
+    for (int i = 0; i < 180; ++i)
+        world->Step(kStep);
+
+    TEST_ASSERT_TRUE(!world->GetBody(stack[0])->IsSleeping());
+    TEST_ASSERT_TRUE(!world->GetBody(stack[1])->IsSleeping());
+    TEST_ASSERT_EQ(world->GetStepStats().islandCount, size_t(1));
+    return true;
+}
+
+bool Test_ImpulseWakesWholeStack()
+{
+    auto world = CreateWorldWithGround();
+    std::vector<BodyHandle> stack = CreateStack(*world, Vec3(0.0f), 4);
+    std::vector<BodyHandle> bystander = CreateStack(*world, Vec3(20.0f, 0.0f, 0.0f), 2);
+
+    std::vector<BodyHandle> all = stack;
+    all.insert(all.end(), bystander.begin(), bystander.end());
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, all, 10.0f));
+
+    world->ApplyImpulse(stack.back(), Vec3(0.5f, 0.0f, 0.0f));
+    world->Step(kStep);
+
+    // The top box links to the bottom one through the sleeping pairs in between
+    for (BodyHandle box : stack)
+        TEST_ASSERT_TRUE(!world->GetBody(box)->IsSleeping());
+    TEST_ASSERT_TRUE(AllSleeping(*world, bystander));
+    TEST_ASSERT_EQ(world->GetStepStats().islandCount, size_t(1));
+    TEST_ASSERT_EQ(world->GetStepStats().awakeBodyCount, stack.size());
+    return true;
+}
+
+bool Test_FallingBodyWakesSleeper()
+{
+    auto world = CreateWorldWithGround();
+    BodyHandle sleeper = CreateBox(*world, Vec3(0.0f, 0.5f, 0.0f));
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, {sleeper}, 5.0f));
+
+    BodyHandle faller = CreateBox(*world, Vec3(0.0f, 4.0f, 0.0f));
+
+    bool woke = false;
+    for (int i = 0; i < 120 && !woke; ++i)
+    {
+        world->Step(kStep);
+        woke = !world->GetBody(sleeper)->IsSleeping();
+    }
+    TEST_ASSERT_TRUE(woke);
+
+    // Both settle as one pile without the faller sinking into the sleeper
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, {sleeper, faller}, 10.0f));
+    TEST_ASSERT_TRUE(world->GetBodyPosition(faller).y > 1.2f);
+    return true;
+}
+
+bool Test_KinematicBodyWakesSleeper()
+{
+    auto world = CreateWorldWithGround();
+    BodyHandle sleeper = CreateBox(*world, Vec3(0.0f, 0.5f, 0.0f));
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, {sleeper}, 5.0f));
+
+    RigidBodyDesc pusherDesc;
+    pusherDesc.type = BodyType::Kinematic;
+    pusherDesc.position = Vec3(-2.0f, 0.5f, 0.0f);
+    BodyHandle pusher = world->CreateBody(pusherDesc);
+    world->AddShape(pusher, std::make_shared<BoxShape>(Vec3(0.5f)));
+
+    // Kinematic bodies are driven by the caller; the solver only reads their velocity
+    const Vec3 velocity(2.0f, 0.0f, 0.0f);
+    world->SetBodyVelocity(pusher, velocity);
+
+    bool woke = false;
+    for (int i = 0; i < 120; ++i)
+    {
+        world->SetBodyPosition(pusher, world->GetBodyPosition(pusher) + velocity * kStep);
+        world->Step(kStep);
+        woke = woke || !world->GetBody(sleeper)->IsSleeping();
+    }
+    TEST_ASSERT_TRUE(woke);
+
+    // Pushed ahead of the pusher rather than left inside it
+    TEST_ASSERT_TRUE(world->GetBodyPosition(sleeper).x > 1.5f);
+    TEST_ASSERT_TRUE(world->GetBodyPosition(sleeper).x - world->GetBodyPosition(pusher).x > 0.8f);
+    return true;
+}
+
+bool Test_DestroyingSupportWakesBody()
+{
+    auto world = CreateWorldWithGround();
+    std::vector<BodyHandle> stack = CreateStack(*world, Vec3(0.0f), 2);
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, stack, 10.0f));
+
+    world->DestroyBody(stack[0]);
+    TEST_ASSERT_TRUE(!world->GetBody(stack[1])->IsSleeping());
+
+    for (int i = 0; i < 60; ++i)
+        world->Step(kStep);
+    TEST_ASSERT_TRUE(world->GetBodyPosition(stack[1]).y < 0.7f);
+    return true;
+}
+
+bool Test_IslandsFollowContactsAndJoints()
+{
+    PhysicsWorldConfig config;
+    config.enableSleeping = false;
+    auto world = CreateWorldWithGround(config);
+
+    // Two piles on the shared static ground stay separate islands
+    CreateStack(*world, Vec3(0.0f), 3);
+    CreateStack(*world, Vec3(10.0f, 0.0f, 0.0f), 3);
+
+    // A rope from a static anchor to a chain of two dynamic bodies in the air
+    RigidBodyDesc anchorDesc;
+    anchorDesc.type = BodyType::Static;
+    anchorDesc.position = Vec3(-10.0f, 10.0f, 0.0f);
+    RigidBody* anchor = world->GetBody(world->CreateBody(anchorDesc));
+    RigidBody* first = world->GetBody(CreateBox(*world, Vec3(-8.0f, 10.0f, 0.0f)));
+    RigidBody* second = world->GetBody(CreateBox(*world, Vec3(-6.0f, 10.0f, 0.0f)));
+
+    auto ropeA = std::make_shared<DistanceConstraint>(anchor, first, Vec3(0.0f), Vec3(0.0f), 2.0f);
+    auto ropeB = std::make_shared<DistanceConstraint>(first, second, Vec3(0.0f), Vec3(0.0f), 2.0f);
+    ropeA->SetDistanceRange(0.0f, 2.0f);
+    ropeB->SetDistanceRange(0.0f, 2.0f);
+    world->CreateConstraint(ropeA);
+    world->CreateConstraint(ropeB);
+
+    world->Step(kStep);
+    TEST_ASSERT_EQ(world->GetStepStats().islandCount, size_t(3));
+    TEST_ASSERT_EQ(world->GetStepStats().awakeBodyCount, size_t(8));
+
+    // Joints are solved now: the chain swings on its ropes instead of falling 20 m
+    for (int i = 0; i < 120; ++i)
+        world->Step(kStep);
+    TEST_ASSERT_TRUE(glm::length(first->GetPosition() - anchor->GetPosition()) < 4.0f);
+    TEST_ASSERT_TRUE(glm::length(second->GetPosition() - first->GetPosition()) < 4.0f);
+    return true;
+}
+
+bool Test_ParallelIslandsMatchSerial()
+{
+    auto buildScene = [](bool parallel)
+    {
+        PhysicsWorldConfig config;
+        config.parallelIslands = parallel;
+        auto world = CreateWorldWithGround(config);
+        for (int x = 0; x < 40; ++x)
+        {
+            for (int z = 0; z < 25; ++z)
+            {
+                CreateStack(*world, Vec3(static_cast<float>(x) * 3.0f, 0.2f, static_cast<float>(z) * 3.0f), 3);
+            }
+        }
+        return world;
+    };
+
+    auto serial = buildScene(false);
+    auto parallel = buildScene(true);
+
+    double serialMs = 0.0;
+    double parallelMs = 0.0;
+    size_t jobCount = 0;
+    for (int i = 0; i < 60; ++i)
+    {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        serial->Step(kStep);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        parallel->Step(kStep);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        serialMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        parallelMs += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        jobCount = std::max(jobCount, parallel->GetStepStats().jobCount);
+    }
+
+    RVX_CORE_INFO("  3000 bodies in 1000 islands: serial {:.3f} ms/step, parallel {:.3f} ms/step ({} workers, {} jobs)",
+                  serialMs / 60.0, parallelMs / 60.0, JobSystem::Get().GetWorkerCount(), jobCount);
+    TEST_ASSERT_TRUE(jobCount > 1);
+
+    // Islands share no dynamic bodies, so the solve order between them cannot matter
+    for (uint64 id = 1; id <= serial->GetBodyCount(); ++id)
+    {
+        const Vec3 a = serial->GetBodyPosition(BodyHandle(id));
+        const Vec3 b = parallel->GetBodyPosition(BodyHandle(id));
+        TEST_ASSERT_TRUE(a == b);
+    }
+    return true;
+}
+
+bool Test_SleepingWorldStepsCheaply()
+{
+    auto world = CreateWorldWithGround();
+
+    std::vector<BodyHandle> boxes;
+    for (int x = 0; x < 100; ++x)
+    {
+        for (int z = 0; z < 50; ++z)
+            boxes.push_back(CreateBox(*world, Vec3(static_cast<float>(x) * 2.0f, 0.5f, static_cast<float>(z) * 2.0f)));
+    }
+
+    auto timeSteps = [&](int steps)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < steps; ++i)
+            world->Step(kStep);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / steps;
+    };
+
+    const double awakeMs = timeSteps(5);
+    TEST_ASSERT_TRUE(StepUntilAsleep(*world, boxes, 5.0f));
+    const double asleepMs = timeSteps(60);
+
+    RVX_CORE_INFO("  5000 boxes: {:.3f} ms/step awake, {:.3f} ms/step asleep", awakeMs, asleepMs);
+    TEST_ASSERT_EQ(world->GetStepStats().awakeBodyCount, size_t(0));
+    TEST_ASSERT_TRUE(asleepMs < awakeMs);
+    return true;
+}
+
+int main()
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize(4);
+    RVX_CORE_INFO("Physics Island Validation Tests");
+
+    TestSuite suite;
+    suite.AddTest("RestingBodiesFallAsleep", Test_RestingBodiesFallAsleep);
+    suite.AddTest("BodiesThatCannotSleepStayAwake", Test_BodiesThatCannotSleepStayAwake);
+    suite.AddTest("ImpulseWakesWholeStack", Test_ImpulseWakesWholeStack);
+    suite.AddTest("FallingBodyWakesSleeper", Test_FallingBodyWakesSleeper);
+    suite.AddTest("KinematicBodyWakesSleeper", Test_KinematicBodyWakesSleeper);
+    suite.AddTest("DestroyingSupportWakesBody", Test_DestroyingSupportWakesBody);
+    suite.AddTest("IslandsFollowContactsAndJoints", Test_IslandsFollowContactsAndJoints);
+    suite.AddTest("ParallelIslandsMatchSerial", Test_ParallelIslandsMatchSerial);
+    suite.AddTest("SleepingWorldStepsCheaply", Test_SleepingWorldStepsCheaply);
+
+    auto results = suite.Run();
+    suite.PrintResults(results);
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+
+    for (const auto& result : results)
+    {
+        if (!result.passed)
+            return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file main.cpp
+ * @brief Physics scene query benchmark: brute force vs tree vs batched
+ *
+ * Casts 10k rays into a world of 10k static spheres and boxes. The brute
+ * force pass tests every ray against every body analytically and doubles as
+ * the reference: the tree-accelerated and batched queries must report the
+ * same body and distance for every ray. Overlap and sphere-cast timings are
+ * reported for the same population.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/Shapes/CollisionShape.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Physics;
+
+namespace
+{
+    constexpr float kWorldExtent = 500.0f;
+    constexpr float kRayLength = 400.0f;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// Analytic description of a body, for the brute-force reference
+    struct BodyInfo
+    {
+        Vec3 center;
+        Vec3 halfExtents;   // Box half extents, or the radius in x for spheres
+        bool sphere;
+        uint64 id;
+    };
+
+    float RaySphere(const Vec3& origin, const Vec3& direction, const Vec3& center, float radius)
+    {
+        const Vec3 m = origin - center;
+        const float b = -dot(m, direction);
+        const Vec3 closest = m + direction * b;
+        const float disc = radius * radius - dot(closest, closest);
+        if (dot(m, m) <= radius * radius || disc < 0.0f)
+            return std::numeric_limits<float>::max();
+        const float t = b - std::sqrt(disc);
+        return t >= 0.0f ? t : std::numeric_limits<float>::max();
+    }
+
+    float RayBox(const Vec3& origin, const Vec3& invDirection, const Vec3& min, const Vec3& max)
+    {
+        const Vec3 t1 = (min - origin) * invDirection;
+        const Vec3 t2 = (max - origin) * invDirection;
+        const Vec3 tNear = glm::min(t1, t2);
+        const Vec3 tFar = glm::max(t1, t2);
+        const float enter = std::max(std::max(tNear.x, tNear.y), tNear.z);
+        const float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+        return enter >= 0.0f && enter <= exit ? enter : std::numeric_limits<float>::max();
+    }
+
+    RaycastHit BruteForceRaycast(const std::vector<BodyInfo>& bodies, const RaycastCommand& ray)
+    {
+        const Vec3 invDirection = 1.0f / ray.direction;
+        RaycastHit hit;
+        float closest = ray.maxDistance;
+        for (const BodyInfo& body : bodies)
+        {
+            const float t = body.sphere
+                ? RaySphere(ray.origin, ray.direction, body.center, body.halfExtents.x)
+                : RayBox(ray.origin, invDirection, body.center - body.halfExtents, body.center + body.halfExtents);
+            if (t <= closest)
+            {
+                closest = t;
+                hit.hit = true;
+                hit.distance = t;
+                hit.bodyId = body.id;
+            }
+        }
+        return hit;
+    }
+
+    bool SameHit(const RaycastHit& a, const RaycastHit& b)
+    {
+        if (a.hit != b.hit)
+            return false;
+        return !a.hit || (a.bodyId == b.bodyId && std::abs(a.distance - b.distance) <= 1e-2f);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize();
+    RVX_CORE_INFO("Physics Query Benchmark");
+
+    // Optional scale factor for quick runs: PhysicsQueryBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    auto scaled = [scale](int count) { return std::max(64, static_cast<int>(count * scale)); };
+    const int bodyCount = scaled(10000);
+    const int rayCount = scaled(10000);
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> position(-kWorldExtent, kWorldExtent);
+    std::uniform_real_distribution<float> size(0.5f, 4.0f);
+    std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+
+    auto world = std::make_shared<PhysicsWorld>();
+    world->Initialize();
+
+    std::vector<BodyInfo> bodies;
+    bodies.reserve(bodyCount);
+    auto start = Clock::now();
+    for (int i = 0; i < bodyCount; ++i)
+    {
+        RigidBodyDesc desc;
+        desc.type = BodyType::Static;
+        desc.position = Vec3(position(rng), position(rng), position(rng));
+        BodyHandle handle = world->CreateBody(desc);
+
+        BodyInfo info{desc.position, Vec3(size(rng), size(rng), size(rng)), i % 2 == 0, handle.GetId()};
+        if (info.sphere)
+            world->AddShape(handle, std::make_shared<SphereShape>(info.halfExtents.x));
+        else
+            world->AddShape(handle, std::make_shared<BoxShape>(info.halfExtents));
+        bodies.push_back(info);
+    }
+    const double buildMs = ElapsedMs(start);
+
+    std::vector<RaycastCommand> rays(rayCount);
+    for (auto& ray : rays)
+    {
+        ray.origin = Vec3(position(rng), position(rng), position(rng));
+        ray.direction = normalize(Vec3(axis(rng), axis(rng), axis(rng)) + Vec3(1e-4f));
+        ray.maxDistance = kRayLength;
+    }
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} rays vs {} bodies ({} workers, build {:.2f} ms) ===",
+                  rayCount, bodyCount, JobSystem::Get().GetWorkerCount(), buildMs);
+    RVX_CORE_INFO("  {:<18} {:>10} {:>10} {:>8}", "Query", "Total ms", "us/ray", "Hits");
+
+    auto report = [&](const char* name, double ms, const std::vector<RaycastHit>& hits)
+    {
+        size_t hitCount = 0;
+        for (const auto& hit : hits)
+            hitCount += hit.hit ? 1 : 0;
+        RVX_CORE_INFO("  {:<18} {:>10.2f} {:>10.3f} {:>8}", name, ms, ms * 1000.0 / rays.size(), hitCount);
+    };
+
+    std::vector<RaycastHit> reference(rays.size());
+    start = Clock::now();
+    for (size_t i = 0; i < rays.size(); ++i)
+        reference[i] = BruteForceRaycast(bodies, rays[i]);
+    report("Brute force", ElapsedMs(start), reference);
+
+    std::vector<RaycastHit> serial(rays.size());
+    start = Clock::now();
+    for (size_t i = 0; i < rays.size(); ++i)
+        world->Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, serial[i]);
+    report("Tree", ElapsedMs(start), serial);
+
+    std::vector<RaycastHit> batched(rays.size());
+    start = Clock::now();
+    world->RaycastBatch(rays, batched);
+    report("Tree batch", ElapsedMs(start), batched);
+
+    int failures = 0;
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        if (!SameHit(reference[i], serial[i]) || !SameHit(reference[i], batched[i]))
+            failures++;
+    }
+    if (failures > 0)
+        RVX_CORE_ERROR("  {} rays disagree with the brute-force reference", failures);
+
+    // Overlaps and sweeps over the same population
+    const auto probe = std::make_shared<SphereShape>(5.0f);
+    std::vector<OverlapCommand> overlaps(rays.size());
+    std::vector<ShapeCastCommand> casts(rays.size() / 10);
+    for (size_t i = 0; i < overlaps.size(); ++i)
+    {
+        overlaps[i].shape = probe.get();
+        overlaps[i].position = rays[i].origin;
+    }
+    for (size_t i = 0; i < casts.size(); ++i)
+    {
+        casts[i].shape = probe.get();
+        casts[i].origin = rays[i].origin;
+        casts[i].direction = rays[i].direction;
+        casts[i].maxDistance = 100.0f;
+    }
+
+    std::vector<BodyHandle> overlapBodies;
+    std::vector<uint32> overlapOffsets;
+    start = Clock::now();
+    world->OverlapBatch(overlaps, overlapBodies, overlapOffsets);
+    const double overlapMs = ElapsedMs(start);
+
+    std::vector<ShapeCastHit> castHits(casts.size());
+    start = Clock::now();
+    world->ShapeCastBatch(casts, castHits);
+    const double castMs = ElapsedMs(start);
+
+    RVX_CORE_INFO("  {:<18} {:>10.2f} {:>10.3f} {:>8}", "Overlap batch", overlapMs,
+                  overlapMs * 1000.0 / overlaps.size(), overlapBodies.size());
+    RVX_CORE_INFO("  {:<18} {:>10.2f} {:>10.3f} {:>8}", "Sphere cast batch", castMs,
+                  castMs * 1000.0 / casts.size(),
+                  std::count_if(castHits.begin(), castHits.end(), [](const ShapeCastHit& hit) { return hit.hit; }));
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,420 @@
+/**
+ * @file main.cpp
+ * @brief Physics scene query validation
+ *
+ * Checks that raycasts, shape casts and overlaps report the exact shape
+ * surface (not body bounds), that the tree-accelerated search agrees with an
+ * analytic brute-force reference, and that batched queries match single ones.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/Shapes/CollisionShape.h"
+#include "TestFramework/TestRunner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Physics;
+using namespace RVX::Test;
+
+namespace
+{
+    constexpr float kTolerance = 2e-3f;
+
+    PhysicsWorld::Ptr CreateWorld()
+    {
+        auto world = std::make_shared<PhysicsWorld>();
+        world->Initialize();
+        return world;
+    }
+
+    BodyHandle CreateStatic(PhysicsWorld& world, std::shared_ptr<CollisionShape> shape,
+                            const Vec3& position, const Quat& rotation = Quat(1, 0, 0, 0))
+    {
+        RigidBodyDesc desc;
+        desc.type = BodyType::Static;
+        desc.position = position;
+        desc.rotation = rotation;
+        BodyHandle handle = world.CreateBody(desc);
+        world.AddShape(handle, std::move(shape));
+        return handle;
+    }
+
+    bool Near(float a, float b, float tolerance = kTolerance)
+    {
+        return std::abs(a - b) <= tolerance;
+    }
+
+    bool Near(const Vec3& a, const Vec3& b, float tolerance = kTolerance)
+    {
+        return length(a - b) <= tolerance;
+    }
+} // namespace
+
+bool Test_RaycastHitsNearestSurface()
+{
+    auto world = CreateWorld();
+    BodyHandle nearBox = CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(0.0f, 0.0f, 10.0f));
+    CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(0.0f, 0.0f, 20.0f));
+
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+    TEST_ASSERT_EQ(hit.bodyId, nearBox.GetId());
+    TEST_ASSERT_TRUE(Near(hit.distance, 9.0f));
+    TEST_ASSERT_TRUE(Near(hit.point, Vec3(0.0f, 0.0f, 9.0f)));
+    TEST_ASSERT_TRUE(Near(hit.normal, Vec3(0.0f, 0.0f, -1.0f)));
+
+    // Too short to reach, and the other way misses entirely
+    TEST_ASSERT_FALSE(world->Raycast(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), 8.5f, hit));
+    TEST_ASSERT_FALSE(world->Raycast(Vec3(0.0f), Vec3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+
+    std::vector<RaycastHit> hits;
+    TEST_ASSERT_EQ(world->RaycastAll(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), 100.0f, hits), size_t(2));
+    TEST_ASSERT_TRUE(Near(hits[0].distance, 9.0f));
+    TEST_ASSERT_TRUE(Near(hits[1].distance, 19.0f));
+    return true;
+}
+
+bool Test_RaycastConvexShapes()
+{
+    auto world = CreateWorld();
+    const Vec3 down(0.0f, -1.0f, 0.0f);
+
+    // Off-center ray against a sphere: the normal follows the surface, not the ray
+    CreateStatic(*world, std::make_shared<SphereShape>(1.0f), Vec3(0.0f));
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(0.6f, 5.0f, 0.0f), down, 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 5.0f - 0.8f));
+    TEST_ASSERT_TRUE(Near(hit.normal, Vec3(0.6f, 0.8f, 0.0f)));
+
+    // Capsule side and cap
+    CreateStatic(*world, std::make_shared<CapsuleShape>(0.5f, 1.0f), Vec3(10.0f, 0.0f, 0.0f));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(10.0f, 5.0f, 0.0f), down, 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 5.0f - 1.5f));
+    TEST_ASSERT_TRUE(Near(hit.normal, Vec3(0.0f, 1.0f, 0.0f)));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(5.0f, 0.5f, 0.0f), Vec3(1.0f, 0.0f, 0.0f), 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 4.5f));
+    TEST_ASSERT_TRUE(Near(hit.normal, Vec3(-1.0f, 0.0f, 0.0f)));
+
+    // Cylinder cap is flat, unlike the capsule
+    CreateStatic(*world, std::make_shared<CylinderShape>(1.0f, 1.0f), Vec3(20.0f, 0.0f, 0.0f));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(20.7f, 5.0f, 0.0f), down, 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 4.0f));
+    TEST_ASSERT_TRUE(Near(hit.normal, Vec3(0.0f, 1.0f, 0.0f)));
+
+    // Box rotated 45 degrees about Y presents an edge to a ray along X
+    const Quat yaw = glm::angleAxis(glm::radians(45.0f), Vec3(0.0f, 1.0f, 0.0f));
+    CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(30.0f, 0.0f, 0.0f), yaw);
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(25.0f, 0.0f, 0.2f), Vec3(1.0f, 0.0f, 0.0f), 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 5.0f - std::sqrt(2.0f) + 0.2f));
+    TEST_ASSERT_TRUE(std::abs(hit.normal.x + std::sqrt(0.5f)) < 1e-3f);
+
+    // Convex hull (octahedron): face normal of the (+,+,+) face
+    const std::vector<Vec3> octahedron = {
+        Vec3(1, 0, 0), Vec3(-1, 0, 0), Vec3(0, 1, 0), Vec3(0, -1, 0), Vec3(0, 0, 1), Vec3(0, 0, -1)};
+    CreateStatic(*world, std::make_shared<ConvexHullShape>(octahedron), Vec3(40.0f, 0.0f, 0.0f));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(40.2f, 5.0f, 0.2f), down, 10.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 5.0f - 0.6f, 5e-3f));
+    TEST_ASSERT_TRUE(Near(hit.normal, normalize(Vec3(1.0f)), 1e-2f));
+    return true;
+}
+
+bool Test_RaycastMeshAndHeightField()
+{
+    auto world = CreateWorld();
+    const Vec3 down(0.0f, -1.0f, 0.0f);
+
+    // Two-triangle quad tilted about Z; hits from below see the flipped normal
+    const std::vector<Vec3> vertices = {
+        Vec3(-2, -2, -2), Vec3(2, 2, -2), Vec3(2, 2, 2), Vec3(-2, -2, 2)};
+    const std::vector<uint32> indices = {0, 1, 2, 0, 2, 3};
+    BodyHandle mesh = CreateStatic(*world, std::make_shared<TriangleMeshShape>(vertices, indices), Vec3(0.0f));
+
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(1.0f, 10.0f, 0.0f), down, 20.0f, hit));
+    TEST_ASSERT_EQ(hit.bodyId, mesh.GetId());
+    TEST_ASSERT_TRUE(Near(hit.point.y, 1.0f));
+    TEST_ASSERT_TRUE(hit.normal.y > 0.0f && Near(length(hit.normal), 1.0f));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(1.0f, -10.0f, 0.0f), -down, 20.0f, hit));
+    TEST_ASSERT_TRUE(hit.normal.y < 0.0f);
+
+    // 64 x 64 ramp rising along X, walked cell by cell
+    const uint32 size = 64;
+    std::vector<float> heights(size * size);
+    for (uint32 z = 0; z < size; ++z)
+        for (uint32 x = 0; x < size; ++x)
+            heights[z * size + x] = static_cast<float>(x) * 0.25f;
+    CreateStatic(*world, std::make_shared<HeightFieldShape>(heights, size, size), Vec3(100.0f, 0.0f, 0.0f));
+
+    // Local x = 5 is grid x = 36.5, height 9.125
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(105.0f, 50.0f, 3.3f), down, 100.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.point.y, 9.125f));
+    TEST_ASSERT_TRUE(Near(hit.normal, normalize(Vec3(-0.25f, 1.0f, 0.0f))));
+
+    // A grazing ray travelling up the ramp lands where the slope catches it
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(68.0f, 4.0f, 0.0f), normalize(Vec3(1.0f, 0.05f, 0.0f)), 200.0f, hit));
+    const float expectedX = 68.0f + (4.0f - 0.25f * 31.5f - 0.25f * (68.0f - 100.0f)) / (0.25f - 0.05f);
+    TEST_ASSERT_TRUE(Near(hit.point.x, expectedX, 1e-2f));
+    return true;
+}
+
+bool Test_RaycastStartingInsideIgnoresShape()
+{
+    auto world = CreateWorld();
+    CreateStatic(*world, std::make_shared<SphereShape>(2.0f), Vec3(0.0f));
+    BodyHandle outer = CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(0.0f, 0.0f, 10.0f));
+
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+    TEST_ASSERT_EQ(hit.bodyId, outer.GetId());
+    TEST_ASSERT_TRUE(Near(hit.distance, 9.0f));
+    return true;
+}
+
+bool Test_RaycastMatchesBruteForce()
+{
+    auto world = CreateWorld();
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> radius(0.2f, 2.0f);
+
+    struct Sphere { Vec3 center; float radius; uint64 id; };
+    std::vector<Sphere> spheres;
+    for (int i = 0; i < 2000; ++i)
+    {
+        Sphere sphere{Vec3(position(rng), position(rng), position(rng)), radius(rng), 0};
+        sphere.id = CreateStatic(*world, std::make_shared<SphereShape>(sphere.radius), sphere.center).GetId();
+        spheres.push_back(sphere);
+    }
+
+    std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+    int hitCount = 0;
+    for (int i = 0; i < 500; ++i)
+    {
+        const Vec3 origin(position(rng) * 1.5f, position(rng) * 1.5f, position(rng) * 1.5f);
+        const Vec3 direction = normalize(Vec3(axis(rng), axis(rng), axis(rng)) + Vec3(1e-3f));
+
+        // Reference: nearest entry over every sphere the origin is outside of
+        float expected = 150.0f;
+        uint64 expectedId = 0;
+        for (const Sphere& sphere : spheres)
+        {
+            const Vec3 m = origin - sphere.center;
+            const float b = -dot(m, direction);
+            const Vec3 closest = m + direction * b;
+            const float disc = sphere.radius * sphere.radius - dot(closest, closest);
+            if (dot(m, m) <= sphere.radius * sphere.radius || disc < 0.0f)
+                continue;
+            const float t = b - std::sqrt(disc);
+            if (t >= 0.0f && t < expected)
+            {
+                expected = t;
+                expectedId = sphere.id;
+            }
+        }
+
+        RaycastHit hit;
+        const bool didHit = world->Raycast(origin, direction, 150.0f, hit);
+        TEST_ASSERT_EQ(didHit, expectedId != 0);
+        if (didHit)
+        {
+            ++hitCount;
+            TEST_ASSERT_EQ(hit.bodyId, expectedId);
+            TEST_ASSERT_TRUE(Near(hit.distance, expected, 1e-3f));
+        }
+    }
+
+    TEST_ASSERT_TRUE(hitCount > 50);
+    return true;
+}
+
+bool Test_ShapeCastAndOverlapUseExactShapes()
+{
+    auto world = CreateWorld();
+    BodyHandle floor = CreateStatic(*world, std::make_shared<BoxShape>(Vec3(10.0f, 1.0f, 10.0f)), Vec3(0.0f, -1.0f, 0.0f));
+
+    // Sphere dropped onto the floor stops one radius above it
+    ShapeCastHit castHit;
+    TEST_ASSERT_TRUE(world->SphereCast(Vec3(0.0f, 5.0f, 0.0f), 0.5f, Vec3(0.0f, -1.0f, 0.0f), 10.0f, castHit));
+    TEST_ASSERT_EQ(castHit.bodyId, floor.GetId());
+    TEST_ASSERT_TRUE(Near(castHit.fraction * 10.0f, 4.5f, 5e-3f));
+    TEST_ASSERT_TRUE(Near(castHit.normal, Vec3(0.0f, 1.0f, 0.0f), 1e-2f));
+    TEST_ASSERT_TRUE(Near(castHit.point.y, 0.0f, 5e-3f));
+
+    // A tilted box sweep lands on its lowest corner
+    const Quat tilt = glm::angleAxis(glm::radians(45.0f), Vec3(0.0f, 0.0f, 1.0f));
+    const BoxShape box(Vec3(0.5f));
+    TEST_ASSERT_TRUE(world->ShapeCast(box, Vec3(0.0f, 5.0f, 0.0f), tilt, Vec3(0.0f, -1.0f, 0.0f), 10.0f, castHit));
+    TEST_ASSERT_TRUE(Near(castHit.fraction * 10.0f, 5.0f - std::sqrt(0.5f), 5e-3f));
+
+    // Sweeping away from everything misses
+    TEST_ASSERT_FALSE(world->SphereCast(Vec3(0.0f, 5.0f, 0.0f), 0.5f, Vec3(0.0f, 1.0f, 0.0f), 10.0f, castHit));
+
+    // Starting in overlap reports a hit at the origin
+    TEST_ASSERT_TRUE(world->SphereCast(Vec3(0.0f, 0.2f, 0.0f), 0.5f, Vec3(1.0f, 0.0f, 0.0f), 10.0f, castHit));
+    TEST_ASSERT_TRUE(castHit.fraction == 0.0f);
+
+    // The rotated box's bounds reach the query sphere but the box itself does not
+    const Quat yaw = glm::angleAxis(glm::radians(45.0f), Vec3(0.0f, 1.0f, 0.0f));
+    BodyHandle diamond = CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(20.0f, 0.0f, 0.0f), yaw);
+    std::vector<BodyHandle> bodies;
+    TEST_ASSERT_EQ(world->OverlapSphere(Vec3(21.3f, 0.0f, 1.3f), 0.3f, bodies), size_t(0));
+    TEST_ASSERT_EQ(world->OverlapSphere(Vec3(21.3f, 0.0f, 0.0f), 0.3f, bodies), size_t(1));
+    TEST_ASSERT_TRUE(bodies[0] == diamond);
+    TEST_ASSERT_EQ(world->OverlapShape(BoxShape(Vec3(30.0f, 0.5f, 30.0f)), Vec3(0.0f, 0.4f, 0.0f),
+                                       Quat(1, 0, 0, 0), bodies), size_t(2));
+    return true;
+}
+
+bool Test_ShapeCastAgainstMesh()
+{
+    auto world = CreateWorld();
+    const std::vector<Vec3> vertices = {Vec3(-5, 0, -5), Vec3(5, 0, -5), Vec3(5, 0, 5), Vec3(-5, 0, 5)};
+    const std::vector<uint32> indices = {0, 2, 1, 0, 3, 2};
+    CreateStatic(*world, std::make_shared<TriangleMeshShape>(vertices, indices), Vec3(0.0f, 1.0f, 0.0f));
+
+    ShapeCastHit castHit;
+    TEST_ASSERT_TRUE(world->SphereCast(Vec3(2.0f, 6.0f, 1.0f), 1.0f, Vec3(0.0f, -1.0f, 0.0f), 10.0f, castHit));
+    TEST_ASSERT_TRUE(Near(castHit.fraction * 10.0f, 4.0f, 5e-3f));
+
+    std::vector<BodyHandle> bodies;
+    TEST_ASSERT_EQ(world->OverlapSphere(Vec3(0.0f, 1.5f, 0.0f), 0.6f, bodies), size_t(1));
+    TEST_ASSERT_EQ(world->OverlapSphere(Vec3(0.0f, 1.5f, 0.0f), 0.4f, bodies), size_t(0));
+    return true;
+}
+
+bool Test_BatchMatchesSingleQueries()
+{
+    auto world = CreateWorld();
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+    for (int i = 0; i < 500; ++i)
+    {
+        const Vec3 at(position(rng), position(rng), position(rng));
+        if (i % 2 == 0)
+            CreateStatic(*world, std::make_shared<SphereShape>(1.0f), at);
+        else
+            CreateStatic(*world, std::make_shared<BoxShape>(Vec3(0.8f)), at);
+    }
+
+    std::vector<RaycastCommand> rays(1000);
+    std::vector<OverlapCommand> overlaps(300);
+    const auto sphere = std::make_shared<SphereShape>(2.0f);
+    for (auto& ray : rays)
+    {
+        ray.origin = Vec3(position(rng), position(rng), position(rng));
+        ray.direction = normalize(Vec3(position(rng), position(rng), position(rng)) + Vec3(1e-3f));
+        ray.maxDistance = 60.0f;
+    }
+    for (auto& overlap : overlaps)
+    {
+        overlap.shape = sphere.get();
+        overlap.position = Vec3(position(rng), position(rng), position(rng));
+    }
+
+    std::vector<RaycastHit> hits(rays.size());
+    world->RaycastBatch(rays, hits);
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        RaycastHit single;
+        world->Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, single);
+        TEST_ASSERT_EQ(hits[i].hit, single.hit);
+        TEST_ASSERT_EQ(hits[i].bodyId, single.bodyId);
+        TEST_ASSERT_TRUE(hits[i].distance == single.distance);
+    }
+
+    std::vector<ShapeCastCommand> casts(200);
+    for (size_t i = 0; i < casts.size(); ++i)
+    {
+        casts[i].shape = sphere.get();
+        casts[i].origin = rays[i].origin;
+        casts[i].direction = rays[i].direction;
+        casts[i].maxDistance = rays[i].maxDistance;
+    }
+    std::vector<ShapeCastHit> castHits(casts.size());
+    world->ShapeCastBatch(casts, castHits);
+    for (size_t i = 0; i < casts.size(); ++i)
+    {
+        ShapeCastHit single;
+        world->ShapeCast(*sphere, casts[i].origin, casts[i].rotation, casts[i].direction, casts[i].maxDistance, single);
+        TEST_ASSERT_EQ(castHits[i].hit, single.hit);
+        TEST_ASSERT_EQ(castHits[i].bodyId, single.bodyId);
+    }
+
+    std::vector<BodyHandle> bodies;
+    std::vector<uint32> offsets;
+    world->OverlapBatch(overlaps, bodies, offsets);
+    TEST_ASSERT_EQ(offsets.size(), overlaps.size() + 1);
+    for (size_t i = 0; i < overlaps.size(); ++i)
+    {
+        std::vector<BodyHandle> single;
+        world->OverlapSphere(overlaps[i].position, 2.0f, single);
+        TEST_ASSERT_EQ(static_cast<size_t>(offsets[i + 1] - offsets[i]), single.size());
+        TEST_ASSERT_TRUE(std::equal(single.begin(), single.end(), bodies.begin() + offsets[i]));
+    }
+    return true;
+}
+
+bool Test_QueriesSeeMovedBodies()
+{
+    auto world = CreateWorld();
+    BodyHandle box = CreateStatic(*world, std::make_shared<BoxShape>(Vec3(1.0f)), Vec3(0.0f, 0.0f, 10.0f));
+
+    RaycastHit hit;
+    world->SetBodyPosition(box, Vec3(0.0f, 0.0f, 40.0f));
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+    TEST_ASSERT_TRUE(Near(hit.distance, 39.0f));
+
+    // A falling body is found where the solver left it, not where the step began
+    RigidBodyDesc desc;
+    desc.type = BodyType::Dynamic;
+    desc.position = Vec3(10.0f, 50.0f, 0.0f);
+    BodyHandle falling = world->CreateBody(desc);
+    world->AddShape(falling, std::make_shared<SphereShape>(0.5f));
+    for (int i = 0; i < 90; ++i)
+        world->Step(1.0f / 60.0f);
+
+    const float y = world->GetBodyPosition(falling).y;
+    TEST_ASSERT_TRUE(y < 40.0f);
+    TEST_ASSERT_TRUE(world->Raycast(Vec3(10.0f, 100.0f, 0.0f), Vec3(0.0f, -1.0f, 0.0f), 200.0f, hit));
+    TEST_ASSERT_EQ(hit.bodyId, falling.GetId());
+    TEST_ASSERT_TRUE(Near(hit.point.y, y + 0.5f));
+    return true;
+}
+
+int main()
+{
+    Log::Initialize();
+    JobSystem::Get().Initialize(4);
+    RVX_CORE_INFO("Physics Query Validation Tests");
+
+    TestSuite suite;
+    suite.AddTest("RaycastHitsNearestSurface", Test_RaycastHitsNearestSurface);
+    suite.AddTest("RaycastConvexShapes", Test_RaycastConvexShapes);
+    suite.AddTest("RaycastMeshAndHeightField", Test_RaycastMeshAndHeightField);
+    suite.AddTest("RaycastStartingInsideIgnoresShape", Test_RaycastStartingInsideIgnoresShape);
+    suite.AddTest("RaycastMatchesBruteForce", Test_RaycastMatchesBruteForce);
+    suite.AddTest("ShapeCastAndOverlapUseExactShapes", Test_ShapeCastAndOverlapUseExactShapes);
+    suite.AddTest("ShapeCastAgainstMesh", Test_ShapeCastAgainstMesh);
+    suite.AddTest("BatchMatchesSingleQueries", Test_BatchMatchesSingleQueries);
+    suite.AddTest("QueriesSeeMovedBodies", Test_QueriesSeeMovedBodies);
+
+    auto results = suite.Run();
+    suite.PrintResults(results);
+
+    JobSystem::Get().Shutdown();
+    Log::Shutdown();
+
+    for (const auto& result : results)
+    {
+        if (!result.passed)
+            return 1;
+    }
+
+    return 0;
+}
@@ -1,6 +1,13 @@
 #include "Core/Core.h"
+#include "Core/Job/JobSystem.h"
 #include "Render/Graph/RenderGraph.h"
 #include "TestFramework/TestRunner.h"
+#include <atomic>
+#include <string>
+
+#if RVX_ENABLE_NULL
+#include "Null/NullDevice.h"
+#endif
 
 using namespace RVX;
 using namespace RVX::Test;
@@ -54,12 +61,16 @@ namespace
         void Begin() override {}
         void End() override {}
         void Reset() override {}
-        void BeginEvent(const char*, uint32 = 0) override {}
+        void BeginEvent(const char* name, uint32 = 0) override { recordedEvents.push_back(name); }
         void EndEvent() override {}
         void SetMarker(const char*, uint32 = 0) override {}
         void BufferBarrier(const RHIBufferBarrier&) override {}
         void TextureBarrier(const RHITextureBarrier&) override {}
-        void Barriers(std::span<const RHIBufferBarrier>, std::span<const RHITextureBarrier>) override {}
+        void Barriers(std::span<const RHIBufferBarrier> bufferBarriers, std::span<const RHITextureBarrier> textureBarriers) override
+        {
+            recordedBufferBarriers.insert(recordedBufferBarriers.end(), bufferBarriers.begin(), bufferBarriers.end());
+            recordedTextureBarriers.insert(recordedTextureBarriers.end(), textureBarriers.begin(), textureBarriers.end());
+        }
         void BeginBarrier(const RHIBufferBarrier&) override {}
         void BeginBarrier(const RHITextureBarrier&) override {}
         void EndBarrier(const RHIBufferBarrier&) override {}
@@ -99,6 +110,10 @@ namespace
         void SetLineWidth(float) override {}
         void SignalFence(RHIFence*, uint64) override {}
         void WaitFence(RHIFence*, uint64) override {}
+
+        std::vector<RHIBufferBarrier> recordedBufferBarriers;
+        std::vector<RHITextureBarrier> recordedTextureBarriers;
+        std::vector<std::string> recordedEvents;
     };
 
     class FakeFence final : public RHIFence
@@ -829,6 +844,381 @@ bool Test_ClearAndRecompile()
     return true;
 }
 
+struct CachedFrameData
+{
+    RGTextureHandle scene;
+    RGTextureHandle output;
+};
+
+// Two-pass frame: render into a transient target, then resolve into an imported one
+void BuildCachedFrame(RenderGraph& graph, RHITexture* backBuffer, uint32 width, std::vector<std::string>* executed)
+{
+    RHITextureDesc sceneDesc = RHITextureDesc::RenderTarget(width, 256, RHIFormat::RGBA16_FLOAT);
+    auto scene = graph.CreateTexture(sceneDesc);
+    auto output = graph.ImportTexture(backBuffer, RHIResourceState::Present);
+
+    graph.AddPass<CachedFrameData>(
+        "Scene",
+        RenderGraphPassType::Graphics,
+        [&](RenderGraphBuilder& builder, CachedFrameData& data)
+        {
+            data.scene = builder.Write(scene, RHIResourceState::RenderTarget);
+        },
+        [executed](const CachedFrameData&, RHICommandContext&)
+        {
+            if (executed)
+                executed->push_back("Scene");
+        });
+
+    graph.AddPass<CachedFrameData>(
+        "Resolve",
+        RenderGraphPassType::Graphics,
+        [&](RenderGraphBuilder& builder, CachedFrameData& data)
+        {
+            data.scene = builder.Read(scene);
+            data.output = builder.Write(output, RHIResourceState::RenderTarget);
+        },
+        [executed](const CachedFrameData&, RHICommandContext&)
+        {
+            if (executed)
+                executed->push_back("Resolve");
+        });
+
+    graph.SetExportState(output, RHIResourceState::Present);
+}
+
+bool Test_CompileCacheReplaysUnchangedGraph()
+{
+    RenderGraph graph;
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    BuildCachedFrame(graph, &backBuffer, 256, nullptr);
+    graph.Compile();
+    RenderGraph::CompileStats firstStats = graph.GetCompileStats();
+    TEST_ASSERT_FALSE(firstStats.compiledFromCache);
+    TEST_ASSERT_EQ(firstStats.compileCacheMisses, 1u);
+
+    FakeCommandContext firstCtx;
+    graph.Execute(firstCtx);
+
+    graph.Clear();
+    std::vector<std::string> executed;
+    BuildCachedFrame(graph, &backBuffer, 256, &executed);
+    graph.Compile();
+
+    const auto& stats = graph.GetCompileStats();
+    TEST_ASSERT_TRUE(stats.compiledFromCache);
+    TEST_ASSERT_EQ(stats.graphSignature, firstStats.graphSignature);
+    TEST_ASSERT_EQ(stats.compileCacheHits, 1u);
+    TEST_ASSERT_EQ(stats.compileCacheMisses, 1u);
+    TEST_ASSERT_TRUE(stats.GetCompileCacheHitRate() > 49.0f && stats.GetCompileCacheHitRate() < 51.0f);
+    TEST_ASSERT_TRUE(stats.compileTimeSavedMs >= 0.0);
+    TEST_ASSERT_EQ(stats.totalPasses, firstStats.totalPasses);
+    TEST_ASSERT_EQ(stats.barrierCount, firstStats.barrierCount);
+
+    // Replayed barriers and export transitions match the first frame
+    FakeCommandContext ctx;
+    graph.Execute(ctx);
+    TEST_ASSERT_EQ(executed.size(), static_cast<size_t>(2));
+    TEST_ASSERT_EQ(executed[0], std::string("Scene"));
+    TEST_ASSERT_EQ(executed[1], std::string("Resolve"));
+    TEST_ASSERT_EQ(ctx.recordedTextureBarriers.size(), firstCtx.recordedTextureBarriers.size());
+
+    return true;
+}
+
+bool Test_CompileCacheRebindsImportedResources()
+{
+    RenderGraph graph;
+    FakeTexture backBuffer0(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+    FakeTexture backBuffer1(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    BuildCachedFrame(graph, &backBuffer0, 256, nullptr);
+    graph.Compile();
+    graph.Clear();
+
+    // Same topology, different swap chain image
+    BuildCachedFrame(graph, &backBuffer1, 256, nullptr);
+    graph.Compile();
+    TEST_ASSERT_TRUE(graph.GetCompileStats().compiledFromCache);
+
+    FakeCommandContext ctx;
+    graph.Execute(ctx);
+
+    // Present -> RenderTarget before Resolve, RenderTarget -> Present on export
+    uint32 backBufferBarriers = 0;
+    for (const auto& barrier : ctx.recordedTextureBarriers)
+    {
+        TEST_ASSERT_NE(barrier.texture, static_cast<RHITexture*>(&backBuffer0));
+        if (barrier.texture == &backBuffer1)
+            backBufferBarriers++;
+    }
+    TEST_ASSERT_EQ(backBufferBarriers, 2u);
+
+    return true;
+}
+
+bool Test_CompileCacheRecompilesOnStructuralChange()
+{
+    RenderGraph graph;
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    BuildCachedFrame(graph, &backBuffer, 256, nullptr);
+    graph.Compile();
+    uint64 firstSignature = graph.GetCompileStats().graphSignature;
+    graph.Clear();
+
+    // A resized transient target changes the signature
+    BuildCachedFrame(graph, &backBuffer, 512, nullptr);
+    graph.Compile();
+    TEST_ASSERT_FALSE(graph.GetCompileStats().compiledFromCache);
+    TEST_ASSERT_NE(graph.GetCompileStats().graphSignature, firstSignature);
+    TEST_ASSERT_EQ(graph.GetCompileStats().compileCacheMisses, 2u);
+    graph.Clear();
+
+    // An extra pass changes the signature
+    BuildCachedFrame(graph, &backBuffer, 512, nullptr);
+    graph.AddPass<SimplePassData>(
+        "Extra",
+        RenderGraphPassType::Graphics,
+        [](RenderGraphBuilder&, SimplePassData&) {},
+        [](const SimplePassData&, RHICommandContext&) {});
+    graph.Compile();
+    TEST_ASSERT_FALSE(graph.GetCompileStats().compiledFromCache);
+    TEST_ASSERT_EQ(graph.GetCompileStats().culledPasses, 1u);
+    graph.Clear();
+
+    // Disabling the cache always runs the full compile
+    graph.SetCompileCacheEnabled(false);
+    BuildCachedFrame(graph, &backBuffer, 512, nullptr);
+    graph.Compile();
+    graph.Clear();
+    BuildCachedFrame(graph, &backBuffer, 512, nullptr);
+    graph.Compile();
+    TEST_ASSERT_FALSE(graph.GetCompileStats().compiledFromCache);
+    TEST_ASSERT_EQ(graph.GetCompileStats().compileCacheHits, 0u);
+
+    return true;
+}
+
+#if RVX_ENABLE_NULL
+bool Test_CompileCacheCreatesTransientResourcesPerFrame()
+{
+    auto device = CreateRHIDevice(RHIBackendType::Null, RHIDeviceDesc{});
+    TEST_ASSERT_NOT_NULL(device.get());
+
+    RenderGraph graph;
+    graph.SetDevice(device.get());
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+    const uint32 textureCount = GetNullDeviceStats(*device)->textureCount;
+
+    // Earlier frames may still be in flight, so keep their targets alive
+    std::vector<RHITextureRef> inFlight;
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        graph.Clear();
+        BuildCachedFrame(graph, &backBuffer, 256, nullptr);
+        graph.Compile();
+        TEST_ASSERT_EQ(graph.GetCompileStats().compiledFromCache, frame > 0);
+
+        RHITexture* scene = graph.GetTexture(RGTextureHandle{0});
+        TEST_ASSERT_NOT_NULL(scene);
+        for (const RHITextureRef& previous : inFlight)
+            TEST_ASSERT_NE(scene, previous.Get());
+        inFlight.emplace_back(scene);
+
+        // Replayed barriers transition this frame's target from its real, undefined state
+        FakeCommandContext ctx;
+        graph.Execute(ctx);
+        uint32 sceneBarriers = 0;
+        for (const auto& barrier : ctx.recordedTextureBarriers)
+        {
+            if (barrier.texture != scene)
+                continue;
+            if (sceneBarriers++ == 0)
+                TEST_ASSERT_TRUE(barrier.stateBefore == RHIResourceState::Undefined);
+        }
+        TEST_ASSERT_EQ(sceneBarriers, 2u);
+    }
+    TEST_ASSERT_EQ(graph.GetCompileStats().compileCacheHits, 3u);
+
+    // The cache holds no resources of its own
+    inFlight.clear();
+    graph.Clear();
+    TEST_ASSERT_EQ(GetNullDeviceStats(*device)->textureCount, textureCount);
+
+    return true;
+}
+#endif
+
+struct ParallelPassData
+{
+    RGTextureHandle target;
+    uint32 itemCount = 0;
+};
+
+// Parallel passes and plain passes writing one exported target in turn
+void BuildParallelFrame(RenderGraph& graph, RHITexture* backBuffer, const std::vector<uint32>& itemCounts,
+                        std::vector<std::atomic<uint32>>* recordedItems)
+{
+    auto output = graph.ImportTexture(backBuffer, RHIResourceState::Present);
+
+    for (size_t i = 0; i < itemCounts.size(); ++i)
+    {
+        const std::string name = "Pass" + std::to_string(i);
+        const uint32 itemCount = itemCounts[i];
+        if (itemCount == 0)
+        {
+            graph.AddPass<ParallelPassData>(
+                name.c_str(),
+                RenderGraphPassType::Graphics,
+                [&](RenderGraphBuilder& builder, ParallelPassData& data)
+                {
+                    data.target = builder.Write(output, RHIResourceState::RenderTarget);
+                },
+                [](const ParallelPassData&, RHICommandContext&) {});
+            continue;
+        }
+
+        graph.AddParallelPass<ParallelPassData>(
+            name.c_str(),
+            RenderGraphPassType::Graphics,
+            [&](RenderGraphBuilder& builder, ParallelPassData& data)
+            {
+                data.target = builder.Write(output, RHIResourceState::RenderTarget);
+            },
+            [itemCount](ParallelPassData& data) -> uint32
+            {
+                data.itemCount = itemCount;
+                return itemCount;
+            },
+            [recordedItems](const ParallelPassData& data, RHICommandContext&, const RGRecordRange& range)
+            {
+                if (!recordedItems)
+                    return;
+                for (uint32 item = range.begin; item < range.end && item < data.itemCount; ++item)
+                {
+                    (*recordedItems)[item].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+    }
+
+    graph.SetExportState(output, RHIResourceState::Present);
+}
+
+bool Test_ExecuteRecordsParallelPassAsOneChunk()
+{
+    RenderGraph graph;
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    std::vector<std::atomic<uint32>> recordedItems(500);
+    BuildParallelFrame(graph, &backBuffer, {500}, &recordedItems);
+    graph.Compile();
+
+    FakeCommandContext ctx;
+    graph.Execute(ctx);
+
+    for (const auto& count : recordedItems)
+    {
+        TEST_ASSERT_EQ(count.load(), 1u);
+    }
+    TEST_ASSERT_EQ(ctx.recordedEvents.size(), static_cast<size_t>(1));
+    TEST_ASSERT_EQ(graph.GetExecuteStats().contextCount, 1u);
+    TEST_ASSERT_EQ(graph.GetExecuteStats().splitPassCount, 0u);
+
+    return true;
+}
+
+bool Test_ExecuteParallelKeepsPassOrderAcrossContexts()
+{
+    RenderGraph graph;
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    // Plain passes (0 items) are recorded on the calling thread
+    BuildParallelFrame(graph, &backBuffer, {0, 40, 0, 40, 40, 0}, nullptr);
+    graph.Compile();
+
+    FakeCommandContext serialCtx;
+    graph.Execute(serialCtx);
+
+    graph.Clear();
+    BuildParallelFrame(graph, &backBuffer, {0, 40, 0, 40, 40, 0}, nullptr);
+    graph.Compile();
+
+    FakeCommandContext contexts[3];
+    RHICommandContext* contextList[] = {&contexts[0], &contexts[1], &contexts[2]};
+    graph.ExecuteParallel(contextList);
+
+    // Contexts submitted in order replay the serial pass and barrier order
+    std::vector<std::string> events;
+    std::vector<RHITextureBarrier> barriers;
+    size_t usedContexts = 0;
+    for (const FakeCommandContext& ctx : contexts)
+    {
+        events.insert(events.end(), ctx.recordedEvents.begin(), ctx.recordedEvents.end());
+        barriers.insert(barriers.end(), ctx.recordedTextureBarriers.begin(), ctx.recordedTextureBarriers.end());
+        if (!ctx.recordedEvents.empty())
+            usedContexts++;
+    }
+    TEST_ASSERT_TRUE(events == serialCtx.recordedEvents);
+    TEST_ASSERT_EQ(barriers.size(), serialCtx.recordedTextureBarriers.size());
+    for (size_t i = 0; i < barriers.size(); ++i)
+    {
+        TEST_ASSERT_EQ(barriers[i].texture, serialCtx.recordedTextureBarriers[i].texture);
+        TEST_ASSERT_EQ(barriers[i].stateBefore, serialCtx.recordedTextureBarriers[i].stateBefore);
+        TEST_ASSERT_EQ(barriers[i].stateAfter, serialCtx.recordedTextureBarriers[i].stateAfter);
+    }
+    TEST_ASSERT_TRUE(usedContexts > 1);
+
+    // RenderTarget -> Present export lands in the last context
+    TEST_ASSERT_FALSE(contexts[2].recordedTextureBarriers.empty());
+    TEST_ASSERT_EQ(contexts[2].recordedTextureBarriers.back().stateAfter, RHIResourceState::Present);
+    TEST_ASSERT_EQ(graph.GetExecuteStats().contextCount, 3u);
+
+    return true;
+}
+
+bool Test_ExecuteParallelSplitsLargePassesOnWorkers()
+{
+    JobSystem::Get().Initialize(3);
+
+    RenderGraph graph;
+    graph.SetParallelRecordingGranularity(100);
+    FakeTexture backBuffer(RHITextureDesc::RenderTarget(256, 256, RHIFormat::RGBA8_UNORM));
+
+    std::vector<std::atomic<uint32>> recordedItems(1000);
+    BuildParallelFrame(graph, &backBuffer, {1000}, &recordedItems);
+    graph.Compile();
+
+    FakeCommandContext contexts[4];
+    RHICommandContext* contextList[] = {&contexts[0], &contexts[1], &contexts[2], &contexts[3]};
+    graph.ExecuteParallel(contextList);
+
+    JobSystem::Get().Shutdown();
+
+    // Every item recorded exactly once, one chunk per context
+    for (const auto& count : recordedItems)
+    {
+        TEST_ASSERT_EQ(count.load(), 1u);
+    }
+    for (const FakeCommandContext& ctx : contexts)
+    {
+        TEST_ASSERT_EQ(ctx.recordedEvents.size(), static_cast<size_t>(1));
+    }
+
+    // Pass barriers go with the first chunk only
+    TEST_ASSERT_FALSE(contexts[0].recordedTextureBarriers.empty());
+    TEST_ASSERT_TRUE(contexts[1].recordedTextureBarriers.empty());
+    TEST_ASSERT_TRUE(contexts[2].recordedTextureBarriers.empty());
+
+    const auto& stats = graph.GetExecuteStats();
+    TEST_ASSERT_EQ(stats.splitPassCount, 1u);
+    TEST_ASSERT_EQ(stats.recordUnitCount, 4u);
+    TEST_ASSERT_EQ(stats.workerSegmentCount, 4u);
+
+    return true;
+}
+
 bool Test_InvalidTextureUsageIsReported()
 {
     RenderGraph graph;
@@ -953,6 +1343,15 @@ int main()
     suite.AddTest("ReadBeforeWriteHazardPreservesExecutionOrder", Test_ReadBeforeWriteHazardPreservesExecutionOrder);
     suite.AddTest("ExecuteAsyncFallsBackToGraphicsUntilQueueSchedulerExists", Test_ExecuteAsyncFallsBackToGraphicsUntilQueueSchedulerExists);
     suite.AddTest("ClearAndRecompile", Test_ClearAndRecompile);
+    suite.AddTest("CompileCacheReplaysUnchangedGraph", Test_CompileCacheReplaysUnchangedGraph);
+    suite.AddTest("CompileCacheRebindsImportedResources", Test_CompileCacheRebindsImportedResources);
+    suite.AddTest("CompileCacheRecompilesOnStructuralChange", Test_CompileCacheRecompilesOnStructuralChange);
+#if RVX_ENABLE_NULL
+    suite.AddTest("CompileCacheCreatesTransientResourcesPerFrame", Test_CompileCacheCreatesTransientResourcesPerFrame);
+#endif
+    suite.AddTest("ExecuteRecordsParallelPassAsOneChunk", Test_ExecuteRecordsParallelPassAsOneChunk);
+    suite.AddTest("ExecuteParallelKeepsPassOrderAcrossContexts", Test_ExecuteParallelKeepsPassOrderAcrossContexts);
+    suite.AddTest("ExecuteParallelSplitsLargePassesOnWorkers", Test_ExecuteParallelSplitsLargePassesOnWorkers);
     suite.AddTest("InvalidTextureUsageIsReported", Test_InvalidTextureUsageIsReported);
     suite.AddTest("InvalidBufferUsageIsReported", Test_InvalidBufferUsageIsReported);
     suite.AddTest("EmptyPassUsageIsReported", Test_EmptyPassUsageIsReported);
@@ -104,36 +104,44 @@ namespace
         TEST_ASSERT_TRUE(source.find("m_pipelineCache->GetMaterialDescriptorSet") == std::string::npos);
         TEST_ASSERT_TRUE(source.find("m_pipelineCache->GetCurrentConstantDynamicOffsets") == std::string::npos);
 
+        // Bindings are resolved while preparing the draw packets...
         const size_t frameSetPos = source.find("m_pipelineCache->GetFrameDescriptorSet");
-        const size_t frameBindPos = source.find("ctx.SetDescriptorSet(0, frameSet)", frameSetPos);
-        const size_t updateObjectPos = source.find("m_pipelineCache->UpdateObjectConstants", frameBindPos);
-        const size_t objectSetPos = source.find("m_pipelineCache->GetObjectDescriptorSet", updateObjectPos);
-        const size_t objectOffsetPos = source.find("m_pipelineCache->GetCurrentObjectDynamicOffset", objectSetPos);
-        const size_t objectBindPos = source.find("ctx.SetDescriptorSet(1, objectSet, objectDynamicOffsets)", objectOffsetPos);
-        const size_t materialUpdatePos = source.find("m_materialSystem->UpdateMaterialConstants", objectBindPos);
+        const size_t objectSetPos = source.find("m_pipelineCache->GetObjectDescriptorSet", frameSetPos);
+        const size_t updateObjectPos = source.find("m_pipelineCache->UploadObjectInstances", objectSetPos);
+        const size_t materialUpdatePos = source.find("m_materialSystem->UpdateMaterialConstants", updateObjectPos);
         const size_t materialSetPos = source.find("m_materialSystem->GetOrCreateMaterialSet", materialUpdatePos);
         const size_t materialOffsetPos = source.find("m_materialSystem->GetCurrentMaterialDynamicOffset", materialSetPos);
-        const size_t materialBindPos = source.find("ctx.SetDescriptorSet(2, materialSet, materialDynamicOffsets)", materialOffsetPos);
+        const size_t objectOffsetPos = source.find("PipelineCache::GetObjectInstanceDynamicOffset", materialOffsetPos);
+
+        // ...and bound per set while recording them
+        const size_t frameBindPos = source.find("ctx.SetDescriptorSet(0, m_frameSet)", objectOffsetPos);
+        const size_t objectBindPos = source.find("ctx.SetDescriptorSet(1, m_objectSet, packet.objectDynamicOffsets)", frameBindPos);
+        const size_t materialBindPos =
+            source.find("ctx.SetDescriptorSet(2, packet.materialSet, packet.materialDynamicOffsets)", objectBindPos);
+        const size_t drawPos = source.find("ctx.DrawIndexed(submesh.indexCount, packet.instanceCount", materialBindPos);
 
         TEST_ASSERT_TRUE(frameSetPos != std::string::npos);
-        TEST_ASSERT_TRUE(frameBindPos != std::string::npos);
-        TEST_ASSERT_TRUE(updateObjectPos != std::string::npos);
         TEST_ASSERT_TRUE(objectSetPos != std::string::npos);
-        TEST_ASSERT_TRUE(objectOffsetPos != std::string::npos);
-        TEST_ASSERT_TRUE(objectBindPos != std::string::npos);
+        TEST_ASSERT_TRUE(updateObjectPos != std::string::npos);
         TEST_ASSERT_TRUE(materialUpdatePos != std::string::npos);
         TEST_ASSERT_TRUE(materialSetPos != std::string::npos);
         TEST_ASSERT_TRUE(materialOffsetPos != std::string::npos);
+        TEST_ASSERT_TRUE(objectOffsetPos != std::string::npos);
+        TEST_ASSERT_TRUE(frameBindPos != std::string::npos);
+        TEST_ASSERT_TRUE(objectBindPos != std::string::npos);
         TEST_ASSERT_TRUE(materialBindPos != std::string::npos);
-        TEST_ASSERT_TRUE(frameSetPos < frameBindPos);
-        TEST_ASSERT_TRUE(frameBindPos < updateObjectPos);
-        TEST_ASSERT_TRUE(updateObjectPos < objectSetPos);
-        TEST_ASSERT_TRUE(objectSetPos < objectOffsetPos);
-        TEST_ASSERT_TRUE(objectOffsetPos < objectBindPos);
-        TEST_ASSERT_TRUE(objectBindPos < materialUpdatePos);
+        TEST_ASSERT_TRUE(drawPos != std::string::npos);
+        TEST_ASSERT_TRUE(source.find("m_pipelineCache->UpdateObjectConstants") == std::string::npos);
+        TEST_ASSERT_TRUE(frameSetPos < objectSetPos);
+        TEST_ASSERT_TRUE(objectSetPos < updateObjectPos);
+        TEST_ASSERT_TRUE(updateObjectPos < materialUpdatePos);
         TEST_ASSERT_TRUE(materialUpdatePos < materialSetPos);
         TEST_ASSERT_TRUE(materialSetPos < materialOffsetPos);
-        TEST_ASSERT_TRUE(materialOffsetPos < materialBindPos);
+        TEST_ASSERT_TRUE(materialOffsetPos < objectOffsetPos);
+        TEST_ASSERT_TRUE(objectOffsetPos < frameBindPos);
+        TEST_ASSERT_TRUE(frameBindPos < objectBindPos);
+        TEST_ASSERT_TRUE(objectBindPos < materialBindPos);
+        TEST_ASSERT_TRUE(materialBindPos < drawPos);
 
         return true;
     }
@@ -147,6 +155,8 @@ namespace
         TEST_ASSERT_TRUE(!source.empty());
         TEST_ASSERT_TRUE(source.find("cbuffer ViewConstants : register(b0, space0)") != std::string::npos);
         TEST_ASSERT_TRUE(source.find("cbuffer ObjectConstants : register(b0, space1)") != std::string::npos);
+        TEST_ASSERT_TRUE(source.find("float4x4 ObjectWorld[MAX_OBJECT_INSTANCES_PER_DRAW]") != std::string::npos);
+        TEST_ASSERT_TRUE(source.find("uint instanceId : SV_InstanceID") != std::string::npos);
         TEST_ASSERT_TRUE(source.find("cbuffer MaterialConstants : register(b0, space2)") != std::string::npos);
         TEST_ASSERT_TRUE(source.find("Texture2D BaseColorTexture : register(t1, space2)") != std::string::npos);
         TEST_ASSERT_TRUE(source.find("Texture2D NormalTexture : register(t2, space2)") != std::string::npos);
@@ -177,6 +187,35 @@ namespace
 
         return true;
     }
+
+    bool Test_ExhaustedObjectConstantsSkipDraws()
+    {
+        const std::filesystem::path passDir = std::filesystem::path(RVX_SOURCE_DIR) / "Render" / "Private" / "Passes";
+
+        // Instanced passes must check the upload before building window offsets from it
+        for (const char* file : {"OpaquePass.cpp", "ShadowPass.cpp"})
+        {
+            const std::string source = LoadSourceFile(passDir / file);
+            TEST_ASSERT_TRUE(!source.empty());
+
+            const size_t uploadPos = source.find("m_pipelineCache->UploadObjectInstances");
+            const size_t checkPos = source.find("PipelineCache::InvalidObjectUpload", uploadPos);
+            const size_t offsetPos = source.find("PipelineCache::GetObjectInstanceDynamicOffset", uploadPos);
+            TEST_ASSERT_TRUE(uploadPos != std::string::npos);
+            TEST_ASSERT_TRUE(checkPos != std::string::npos);
+            TEST_ASSERT_TRUE(offsetPos != std::string::npos);
+            TEST_ASSERT_TRUE(checkPos < offsetPos);
+        }
+
+        for (const char* file : {"DepthPrepass.cpp", "TransparentPass.cpp"})
+        {
+            const std::string source = LoadSourceFile(passDir / file);
+            TEST_ASSERT_TRUE(!source.empty());
+            TEST_ASSERT_TRUE(source.find("if (!m_pipelineCache->UpdateObjectConstants(") != std::string::npos);
+        }
+
+        return true;
+    }
 } // namespace
 
 int main()
@@ -195,6 +234,8 @@ int main()
                   Test_DefaultLitUsesDescriptorSetSpaces);
     suite.AddTest("DynamicConstantSlotsDoNotWrapWithinFrame",
                   Test_DynamicConstantSlotsDoNotWrapWithinFrame);
+    suite.AddTest("ExhaustedObjectConstantsSkipDraws",
+                  Test_ExhaustedObjectConstantsSkipDraws);
 
     auto results = suite.Run();
     suite.PrintResults(results);
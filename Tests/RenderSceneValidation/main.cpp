@@ -11,7 +11,9 @@
 #include "TestFramework/TestRunner.h"
 #include "World/World.h"
 
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <vector>
 
 using namespace RVX;
@@ -78,6 +80,43 @@ namespace
         const auto handle = sceneManager->CreateEntity(name);
         return sceneManager->GetEntity(handle);
     }
+
+    // Reference result for the hierarchical cull: a linear scalar test over every object
+    std::vector<uint32_t> CullLinear(const RenderScene& scene, const Frustum& frustum, bool shadowCasters)
+    {
+        std::vector<uint32_t> visible;
+        for (size_t i = 0; i < scene.GetObjectCount(); ++i)
+        {
+            const RenderObject& object = scene.GetObject(i);
+            const bool passes = shadowCasters ? object.castsShadow : object.visible;
+            if (passes && frustum.IsVisible(object.bounds))
+            {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return visible;
+    }
+
+    bool CullMatchesLinear(const RenderScene& scene, const std::vector<Frustum>& frustums)
+    {
+        for (const auto filter : {RenderScene::CullFilter::Visible, RenderScene::CullFilter::ShadowCasters})
+        {
+            std::vector<std::vector<uint32_t>> results(frustums.size());
+            scene.CullFrustums(frustums, results, filter);
+
+            for (size_t i = 0; i < frustums.size(); ++i)
+            {
+                std::sort(results[i].begin(), results[i].end());
+                const auto expected = CullLinear(scene, frustums[i],
+                                                 filter == RenderScene::CullFilter::ShadowCasters);
+                if (results[i] != expected)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
 } // namespace
 
 bool Test_CullAgainstCameraRejectsOutsideObjects()
@@ -254,6 +293,293 @@ bool Test_RenderSceneCollectorDoesNotFallbackWhenPrimitiveIsHidden()
     return true;
 }
 
+bool Test_RenderSceneRetainsPrimitivesAcrossCollects()
+{
+    World world;
+    world.Initialize();
+
+    auto* entity = CreateEntity(world, "RetainedEntity");
+    TEST_ASSERT_NOT_NULL(entity);
+
+    auto mesh = MakeMeshResource(1006);
+    auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+    TEST_ASSERT_NOT_NULL(primitive);
+    TEST_ASSERT_TRUE(primitive->AttachToComponent(entity->GetRootComponent()));
+    primitive->SetMesh(mesh);
+
+    RenderScene scene;
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetObjectCount());
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetLastExtractedCount());
+
+    // Nothing changed: the object is kept without being re-extracted
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetObjectCount());
+    TEST_ASSERT_EQ(static_cast<size_t>(0), scene.GetLastExtractedCount());
+
+    entity->SetPosition(Vec3(0.0f, 3.0f, 0.0f));
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetLastExtractedCount());
+    TEST_ASSERT_EQ(Vec3(0.0f, 3.0f, 0.0f), Vec3(scene.GetObject(0).worldMatrix[3]));
+
+    primitive->SetVisible(false);
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(0), scene.GetObjectCount());
+
+    primitive->SetVisible(true);
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetObjectCount());
+
+    world.GetSceneManager()->DestroyEntity(entity->GetHandle());
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(0), scene.GetObjectCount());
+
+    world.Shutdown();
+    return true;
+}
+
+bool Test_RenderSceneKeepsObjectsDenseAfterRemoval()
+{
+    World world;
+    world.Initialize();
+
+    auto mesh = MakeMeshResource(1007);
+    std::vector<SceneEntity*> entities;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto* entity = CreateEntity(world, "DenseEntity");
+        TEST_ASSERT_NOT_NULL(entity);
+        auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+        TEST_ASSERT_TRUE(primitive->AttachToComponent(entity->GetRootComponent()));
+        primitive->SetMesh(mesh);
+        entities.push_back(entity);
+    }
+
+    RenderScene scene;
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(3), scene.GetObjectCount());
+
+    const auto removedHandle = entities[0]->GetHandle();
+    world.GetSceneManager()->DestroyEntity(removedHandle);
+    scene.CollectFromWorld(&world);
+
+    TEST_ASSERT_EQ(static_cast<size_t>(2), scene.GetObjectCount());
+    for (size_t i = 0; i < scene.GetObjectCount(); ++i)
+    {
+        TEST_ASSERT_TRUE(scene.GetObject(i).entityId != removedHandle);
+        TEST_ASSERT_EQ(mesh.GetId(), scene.GetObject(i).meshId);
+    }
+
+    world.Shutdown();
+    return true;
+}
+
+bool Test_RenderSceneResyncsWhenAnotherSceneConsumedChanges()
+{
+    World world;
+    world.Initialize();
+
+    auto* entity = CreateEntity(world, "SharedEntity");
+    TEST_ASSERT_NOT_NULL(entity);
+
+    auto mesh = MakeMeshResource(1008);
+    auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+    TEST_ASSERT_TRUE(primitive->AttachToComponent(entity->GetRootComponent()));
+    primitive->SetMesh(mesh);
+
+    RenderScene first;
+    RenderScene second;
+    first.CollectFromWorld(&world);
+    second.CollectFromWorld(&world);
+
+    // The move is consumed by the first scene; the second must still see it
+    entity->SetPosition(Vec3(2.0f, 0.0f, 0.0f));
+    first.CollectFromWorld(&world);
+    second.CollectFromWorld(&world);
+
+    TEST_ASSERT_EQ(static_cast<size_t>(1), second.GetObjectCount());
+    TEST_ASSERT_EQ(Vec3(2.0f, 0.0f, 0.0f), Vec3(second.GetObject(0).worldMatrix[3]));
+
+    world.Shutdown();
+    return true;
+}
+
+bool Test_SceneManagerQueuesEachRecycledRemovalOnce()
+{
+    World world;
+    world.Initialize();
+    auto* sceneManager = world.GetSceneManager();
+    auto mesh = MakeMeshResource(1010);
+
+    auto churn = [&](int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            auto* entity = CreateEntity(world, "ChurnEntity");
+            auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+            primitive->AttachToComponent(entity->GetRootComponent());
+            primitive->SetMesh(mesh);
+            sceneManager->DestroyEntity(entity->GetHandle());
+        }
+    };
+
+    // Nobody has synced: nothing is queued, however long the world runs
+    churn(100);
+    uint64 epoch = 0;
+    std::vector<uint32> removedIds;
+    std::vector<PrimitiveComponent*> dirty;
+    TEST_ASSERT_FALSE(sceneManager->ConsumePrimitiveRenderChanges(epoch, removedIds, dirty));
+    TEST_ASSERT_TRUE(removedIds.empty());
+
+    // After a sync, the recycled render id is queued once rather than per destroy
+    churn(100);
+    TEST_ASSERT_TRUE(sceneManager->ConsumePrimitiveRenderChanges(epoch, removedIds, dirty));
+    TEST_ASSERT_EQ(static_cast<size_t>(1), removedIds.size());
+    TEST_ASSERT_TRUE(dirty.empty());
+
+    // And queued again once consumed
+    churn(1);
+    TEST_ASSERT_TRUE(sceneManager->ConsumePrimitiveRenderChanges(epoch, removedIds, dirty));
+    TEST_ASSERT_EQ(static_cast<size_t>(1), removedIds.size());
+
+    world.Shutdown();
+    return true;
+}
+
+bool Test_RenderScenePicksUpPrimitiveWhenMeshFinishesLoading()
+{
+    World world;
+    world.Initialize();
+
+    auto* entity = CreateEntity(world, "LoadingEntity");
+    TEST_ASSERT_NOT_NULL(entity);
+
+    auto* resource = new TestMeshResource();
+    resource->SetId(1009);
+    resource->SetMesh(MeshFactory::CreateTriangle());
+    resource->SetBounds(AABB(Vec3(-1.0f), Vec3(1.0f)));
+    Resource::ResourceHandle<Resource::MeshResource> mesh(resource);
+
+    auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+    TEST_ASSERT_TRUE(primitive->AttachToComponent(entity->GetRootComponent()));
+    primitive->SetMesh(mesh);
+
+    RenderScene scene;
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(0), scene.GetObjectCount());
+
+    resource->MarkLoaded();
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_EQ(static_cast<size_t>(1), scene.GetObjectCount());
+    TEST_ASSERT_EQ(mesh.GetId(), scene.GetObject(0).meshId);
+
+    world.Shutdown();
+    return true;
+}
+
+bool Test_SortVisibleObjectsGroupsBySortKeyThenDistance()
+{
+    RenderScene scene;
+    const float distances[] = {30.0f, 5.0f, 12.0f, 8.0f, 1.0f, 20.0f};
+    for (int i = 0; i < 6; ++i)
+    {
+        RenderObject object = MakeObject(Vec3(0.0f, 0.0f, -distances[i]));
+        object.sortKey = 100 + static_cast<uint64_t>(i % 2);
+        scene.AddObject(object);
+    }
+
+    std::vector<uint32_t> visible = {0, 1, 2, 3, 4, 5};
+    scene.SortVisibleObjects(visible, Vec3(0.0f));
+
+    // Each sort key forms one contiguous run, nearest first within the run
+    TEST_ASSERT_EQ(static_cast<size_t>(6), visible.size());
+    for (size_t i = 1; i < visible.size(); ++i)
+    {
+        const RenderObject& prev = scene.GetObject(visible[i - 1]);
+        const RenderObject& curr = scene.GetObject(visible[i]);
+        if (prev.sortKey == curr.sortKey)
+        {
+            TEST_ASSERT_TRUE(distances[visible[i - 1]] < distances[visible[i]]);
+        }
+        else
+        {
+            TEST_ASSERT_EQ(static_cast<size_t>(3), i);
+        }
+    }
+    return true;
+}
+
+bool Test_RenderSceneHierarchicalCullMatchesLinearCull()
+{
+    World world;
+    world.Initialize();
+
+    std::mt19937 rng(4242);
+    std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+
+    auto mesh = MakeMeshResource(1010);
+    std::vector<SceneEntity*> entities;
+    std::vector<StaticMeshComponent*> primitives;
+    for (int i = 0; i < 600; ++i)
+    {
+        auto* entity = CreateEntity(world, "CullEntity");
+        TEST_ASSERT_NOT_NULL(entity);
+        auto* primitive = static_cast<Actor*>(entity)->AddComponent<StaticMeshComponent>();
+        TEST_ASSERT_TRUE(primitive->AttachToComponent(entity->GetRootComponent()));
+        primitive->SetMesh(mesh);
+        primitive->SetCastsShadow(i % 3 != 0);
+        entity->SetPosition(Vec3(position(rng), position(rng) * 0.2f, position(rng)));
+        entities.push_back(entity);
+        primitives.push_back(primitive);
+    }
+
+    std::vector<Frustum> frustums(4);
+    frustums[0].SetPerspective(Vec3(0.0f), Vec3(0.0f, 0.0f, -1.0f), Vec3(0.0f, 1.0f, 0.0f),
+                               1.04719755f, 1.5f, 0.1f, 150.0f);
+    frustums[1].SetPerspective(Vec3(50.0f, 10.0f, 50.0f), glm::normalize(Vec3(-1.0f, -0.2f, 0.3f)),
+                               Vec3(0.0f, 1.0f, 0.0f), 0.8f, 1.0f, 1.0f, 400.0f);
+    frustums[2].ExtractFromMatrix(
+        glm::ortho(-60.0f, 60.0f, -60.0f, 60.0f, 0.0f, 500.0f) *
+        glm::lookAt(Vec3(0.0f, 250.0f, 0.0f), Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f)));
+    frustums[3].SetPerspective(Vec3(0.0f, 1000.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f),
+                               0.5f, 1.0f, 0.1f, 10.0f);
+
+    RenderScene scene;
+    scene.CollectFromWorld(&world);
+    scene.AddObject(MakeObject(Vec3(0.0f, 0.0f, -10.0f)));
+    scene.AddObject(MakeObject(Vec3(0.0f, 0.0f, 10.0f)));
+    TEST_ASSERT_EQ(static_cast<size_t>(602), scene.GetObjectCount());
+    TEST_ASSERT_TRUE(CullMatchesLinear(scene, frustums));
+
+    // A few moves refit the existing clusters
+    for (int i = 0; i < 60; ++i)
+    {
+        entities[i * 7]->SetPosition(Vec3(position(rng), 0.0f, position(rng)));
+        primitives[i * 5]->SetVisible(i % 2 == 0);
+    }
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_TRUE(CullMatchesLinear(scene, frustums));
+
+    // Heavy churn swaps objects around and forces a rebuild
+    for (int i = 0; i < 300; ++i)
+    {
+        world.GetSceneManager()->DestroyEntity(entities[i * 2]->GetHandle());
+    }
+    for (int i = 0; i < 150; ++i)
+    {
+        entities[i * 2 + 1]->SetPosition(Vec3(position(rng), 0.0f, position(rng)));
+    }
+    scene.CollectFromWorld(&world);
+    TEST_ASSERT_TRUE(CullMatchesLinear(scene, frustums));
+
+    std::vector<uint32_t> visible;
+    scene.CullFrustum(frustums[3], visible);
+    TEST_ASSERT_TRUE(visible.empty());
+
+    world.Shutdown();
+    return true;
+}
+
 int main()
 {
     Log::Initialize();
@@ -272,6 +598,20 @@ int main()
                   Test_RenderSceneCollectorSkipsInactivePrimitiveOwners);
     suite.AddTest("RenderSceneCollectorDoesNotFallbackWhenPrimitiveIsHidden",
                   Test_RenderSceneCollectorDoesNotFallbackWhenPrimitiveIsHidden);
+    suite.AddTest("RenderSceneRetainsPrimitivesAcrossCollects",
+                  Test_RenderSceneRetainsPrimitivesAcrossCollects);
+    suite.AddTest("RenderSceneKeepsObjectsDenseAfterRemoval",
+                  Test_RenderSceneKeepsObjectsDenseAfterRemoval);
+    suite.AddTest("RenderSceneResyncsWhenAnotherSceneConsumedChanges",
+                  Test_RenderSceneResyncsWhenAnotherSceneConsumedChanges);
+    suite.AddTest("SceneManagerQueuesEachRecycledRemovalOnce",
+                  Test_SceneManagerQueuesEachRecycledRemovalOnce);
+    suite.AddTest("RenderScenePicksUpPrimitiveWhenMeshFinishesLoading",
+                  Test_RenderScenePicksUpPrimitiveWhenMeshFinishesLoading);
+    suite.AddTest("SortVisibleObjectsGroupsBySortKeyThenDistance",
+                  Test_SortVisibleObjectsGroupsBySortKeyThenDistance);
+    suite.AddTest("RenderSceneHierarchicalCullMatchesLinearCull",
+                  Test_RenderSceneHierarchicalCullMatchesLinearCull);
 
     auto results = suite.Run();
     suite.PrintResults(results);
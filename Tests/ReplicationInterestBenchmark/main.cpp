@@ -0,0 +1,662 @@
+/**
+ * @file main.cpp
+ * @brief Replication interest management benchmark over a loopback transport
+ *
+ * Runs a server and its clients in one process, connected through a
+ * LoopbackNetwork, with objects wandering over a large map and one moving
+ * viewer per client. The same simulation runs with every object replicated
+ * to every client and with interest management, and reports the bytes each
+ * client receives and sends per second, how many objects the server
+ * serializes and what a server update costs.
+ *
+ * After each run the objects stop, and every client must hold every object
+ * near its viewer with the server's final state, every snapshot must have
+ * been acknowledged, and with interest management no client may hold an
+ * object far outside its view.
+ *
+ * A last run drops every acknowledgement for far longer than the server
+ * remembers unacknowledged snapshots while the objects keep moving. Once
+ * acks flow again the client must decode and acknowledge snapshots, and
+ * the server must go back to sending deltas.
+ *
+ * Another run sends more snapshots than the 16-bit sequence numbers cover
+ * while one object stays idle on its first baseline. Both objects must
+ * still be sent as deltas, acknowledged and current on the client.
+ */
+
+#include "Core/Core.h"
+#include "Networking/Networking.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Net;
+
+namespace
+{
+    constexpr uint16 kServerPort = 7777;
+    constexpr uint32 kClientCount = RVX_NET_MAX_CONNECTIONS;   // A server's default connection limit
+    constexpr uint32 kObjectCount = 2000;
+    constexpr float kWorldSize = 2048.0f;
+    constexpr float kTickRate = 20.0f;
+    constexpr float kObjectSpeed = 6.0f;
+    constexpr float kViewerSpeed = 12.0f;
+    constexpr int kSettleTicks = 20;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// Object wandering over the map
+    class Wanderer : public IReplicatedObject
+    {
+    public:
+        RVX_REPLICATED_OBJECT(Wanderer)
+
+        void SerializeState(NetworkWriter& writer) const override
+        {
+            writer.WriteVec3(position);
+            writer.WriteUInt16(health);
+            writer.WriteUInt8(team);
+        }
+
+        void DeserializeState(NetworkReader& reader) override
+        {
+            position = reader.ReadVec3();
+            health = reader.ReadUInt16();
+            team = reader.ReadUInt8();
+        }
+
+        bool GetReplicationPosition(Vec3& outPosition) const override
+        {
+            outPosition = position;
+            return true;
+        }
+
+        Vec3 position{0.0f};
+        Vec3 velocity{0.0f};
+        uint16 health = 100;
+        uint8 team = 0;
+    };
+
+    /// Object with no position, relevant to every client
+    class MatchState : public IReplicatedObject
+    {
+    public:
+        RVX_REPLICATED_OBJECT(MatchState)
+
+        void SerializeState(NetworkWriter& writer) const override
+        {
+            writer.WriteUInt32(tick);
+        }
+
+        void DeserializeState(NetworkReader& reader) override
+        {
+            tick = reader.ReadUInt32();
+        }
+
+        uint32 tick = 0;
+    };
+
+    struct Client
+    {
+        std::unique_ptr<NetworkManager> network;
+        std::unique_ptr<ReplicationManager> replication;
+        uint16 port = 0;
+        ConnectionId serverSideId = RVX_NET_INVALID_CONNECTION_ID;
+        Vec3 viewer{0.0f};
+        Vec3 viewerVelocity{0.0f};
+    };
+
+    struct RunResult
+    {
+        double downKBps = 0.0;          // Per client
+        double upKBps = 0.0;            // Per client
+        double serializationsPerSec = 0.0;
+        double serverMsPerTick = 0.0;
+        double relevantPairs = 0.0;     // Average per tick
+        size_t missing = 0;             // Nearby objects absent or stale on clients
+        size_t unexpected = 0;          // Far objects present on clients
+        uint64 snapshotsSent = 0;
+        uint64 snapshotsAcked = 0;
+    };
+
+    void Bounce(Vec3& position, Vec3& velocity, float dt)
+    {
+        position += velocity * dt;
+        for (int axis : {0, 2})
+        {
+            if (position[axis] < 0.0f || position[axis] > kWorldSize)
+            {
+                position[axis] = std::clamp(position[axis], 0.0f, kWorldSize);
+                velocity[axis] = -velocity[axis];
+            }
+        }
+    }
+
+    Vec3 RandomVelocity(std::mt19937& rng, float speed)
+    {
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        const float a = angle(rng);
+        return Vec3(std::cos(a) * speed, 0.0f, std::sin(a) * speed);
+    }
+
+    RunResult Run(bool interest, uint32 clientCount, uint32 objectCount, float seconds, uint32& failures)
+    {
+        const auto network = std::make_shared<LoopbackNetwork>();
+        const auto loopback = [network]() { return CreateLoopbackTransport(network); };
+        const InterestConfig interestConfig;
+        const float dt = 1.0f / kTickRate;
+
+        // Replication is limited by demand here, not by the per-client budget
+        ReplicationBudgetConfig budget;
+        budget.bytesPerSecond = 8 * 1024 * 1024;
+
+        NetworkManager serverNetwork;
+        ReplicationManager server;
+        serverNetwork.SetTransportFactory(loopback);
+        serverNetwork.StartServer(kServerPort);
+        server.Initialize(&serverNetwork);
+        server.SetBudgetConfig(budget);
+        if (interest)
+        {
+            server.EnableInterestManagement(interestConfig);
+        }
+
+        std::unordered_map<uint16, ConnectionId> portToConnection;
+        serverNetwork.SetOnConnect([&](ConnectionPtr conn)
+        {
+            portToConnection[conn->GetRemoteAddress().port] = conn->GetId();
+        });
+        serverNetwork.SetOnData([&](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+        {
+            server.HandlePacket(conn->GetId(), data);
+        });
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coordinate(0.0f, kWorldSize);
+
+        std::vector<Client> clients(clientCount);
+        for (Client& client : clients)
+        {
+            client.network = std::make_unique<NetworkManager>();
+            client.replication = std::make_unique<ReplicationManager>();
+            client.network->SetTransportFactory(loopback);
+            client.network->Connect("127.0.0.1", kServerPort);
+            client.port = client.network->GetLocalAddress().port;
+
+            ReplicationManager* replication = client.replication.get();
+            replication->Initialize(client.network.get());
+            replication->RegisterType<Wanderer>();
+            replication->RegisterType<MatchState>();
+            client.network->SetOnData([replication](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+            {
+                replication->HandlePacket(conn->GetId(), data);
+            });
+
+            client.viewer = Vec3(coordinate(rng), 0.0f, coordinate(rng));
+            client.viewerVelocity = RandomVelocity(rng, kViewerSpeed);
+        }
+
+        // Handshake
+        for (int attempt = 0; attempt < 8 && portToConnection.size() < clientCount; ++attempt)
+        {
+            serverNetwork.Update(0.0f);
+            for (Client& client : clients)
+            {
+                client.network->Update(0.0f);
+            }
+        }
+        for (Client& client : clients)
+        {
+            client.serverSideId = portToConnection[client.port];
+            server.SetViewerPosition(client.serverSideId, client.viewer);
+        }
+
+        auto match = std::make_shared<MatchState>();
+        server.Spawn(match);
+
+        std::vector<std::shared_ptr<Wanderer>> objects(objectCount);
+        for (auto& object : objects)
+        {
+            object = std::make_shared<Wanderer>();
+            object->position = Vec3(coordinate(rng), 0.0f, coordinate(rng));
+            object->velocity = RandomVelocity(rng, kObjectSpeed);
+            object->team = static_cast<uint8>(rng() % 4);
+            server.Spawn(object);
+        }
+
+        const auto tick = [&](bool moving)
+        {
+            if (moving)
+            {
+                for (auto& object : objects)
+                {
+                    Bounce(object->position, object->velocity, dt);
+                }
+                for (Client& client : clients)
+                {
+                    Bounce(client.viewer, client.viewerVelocity, dt);
+                    server.SetViewerPosition(client.serverSideId, client.viewer);
+                }
+                match->tick++;
+            }
+
+            serverNetwork.Update(dt);
+            const auto start = Clock::now();
+            server.Update(dt);
+            const double ms = ElapsedMs(start);
+
+            for (Client& client : clients)
+            {
+                client.network->Update(dt);
+            }
+            return ms;
+        };
+
+        // Measure the moving phase only, from after the initial spawns
+        for (Client& client : clients)
+        {
+            client.network->Update(dt);
+        }
+        network->ResetStats();
+        const uint64 serializationsBefore = server.GetStats().serializations;
+
+        const int ticks = std::max(1, static_cast<int>(seconds * kTickRate));
+        double serverMs = 0.0;
+        double relevantPairs = 0.0;
+        for (int i = 0; i < ticks; ++i)
+        {
+            serverMs += tick(true);
+            relevantPairs += interest ? static_cast<double>(server.GetInterestManager()->GetRelevantPairCount())
+                                      : static_cast<double>(clientCount) * (objectCount + 1);
+        }
+
+        RunResult result;
+        const double simulated = ticks / static_cast<double>(kTickRate);
+        uint64 down = 0;
+        uint64 up = 0;
+        for (const Client& client : clients)
+        {
+            const LoopbackPortStats stats = network->GetPortStats(client.port);
+            down += stats.bytesReceived;
+            up += stats.bytesSent;
+        }
+        result.downKBps = down / 1024.0 / simulated / clientCount;
+        result.upKBps = up / 1024.0 / simulated / clientCount;
+        result.serializationsPerSec = (server.GetStats().serializations - serializationsBefore) / simulated;
+        result.serverMsPerTick = serverMs / ticks;
+        result.relevantPairs = relevantPairs / ticks;
+
+        // Let the last states and acks arrive, then compare clients with the server
+        for (int i = 0; i < kSettleTicks; ++i)
+        {
+            tick(false);
+        }
+        serverNetwork.Update(dt);
+
+        const float farDistance = interestConfig.viewRadius +
+                                  2.0f * (interestConfig.cellSize * 1.4143f + interestConfig.hysteresis);
+        for (const Client& client : clients)
+        {
+            auto remoteMatch = std::dynamic_pointer_cast<MatchState>(client.replication->GetObject(match->GetNetId()));
+            result.missing += !remoteMatch || remoteMatch->tick != match->tick ? 1 : 0;
+
+            for (const auto& object : objects)
+            {
+                const float distance = glm::length(object->position - client.viewer);
+                auto remote = std::dynamic_pointer_cast<Wanderer>(client.replication->GetObject(object->GetNetId()));
+
+                if (!interest || distance <= interestConfig.viewRadius)
+                {
+                    const bool current = remote && remote->position == object->position &&
+                                         remote->team == object->team;
+                    result.missing += current ? 0 : 1;
+                }
+                else if (remote && distance > farDistance)
+                {
+                    result.unexpected++;
+                }
+            }
+        }
+
+        result.snapshotsSent = server.GetStats().snapshotsSent;
+        result.snapshotsAcked = server.GetStats().snapshotsAcked;
+
+        const char* mode = interest ? "interest" : "all";
+        if (result.missing > 0)
+        {
+            RVX_CORE_ERROR("  {}: {} nearby objects missing or stale on clients", mode, result.missing);
+            failures++;
+        }
+        if (result.unexpected > 0)
+        {
+            RVX_CORE_ERROR("  {}: {} objects outside the view still on clients", mode, result.unexpected);
+            failures++;
+        }
+        if (result.snapshotsAcked != result.snapshotsSent)
+        {
+            RVX_CORE_ERROR("  {}: {} of {} snapshots acknowledged", mode, result.snapshotsAcked, result.snapshotsSent);
+            failures++;
+        }
+
+        for (Client& client : clients)
+        {
+            client.replication->Shutdown();
+            client.network->Stop();
+        }
+        server.Shutdown();
+        serverNetwork.Stop();
+        return result;
+    }
+    struct AckLossResult
+    {
+        uint64 objectsSent = 0;         // After acks resumed
+        uint64 deltaObjectsSent = 0;
+        uint64 snapshotsAcked = 0;
+    };
+
+    /// Drop every ack for a long stretch, then check replication recovers
+    AckLossResult RunAckLoss(uint32& failures)
+    {
+        constexpr uint32 kObjects = 16;
+        constexpr int kLossTicks = 400;
+        constexpr int kRecoveryTicks = 40;
+
+        const auto network = std::make_shared<LoopbackNetwork>();
+        const auto loopback = [network]() { return CreateLoopbackTransport(network); };
+        const float dt = 1.0f / kTickRate;
+        bool dropAcks = false;
+
+        NetworkManager serverNetwork;
+        ReplicationManager server;
+        serverNetwork.SetTransportFactory(loopback);
+        serverNetwork.StartServer(kServerPort);
+        server.Initialize(&serverNetwork);
+        serverNetwork.SetOnData([&](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+        {
+            // The only replication packets clients send are acks
+            if (dropAcks && !data.empty() && data[0] == static_cast<uint8>(PacketType::Replication))
+                return;
+            server.HandlePacket(conn->GetId(), data);
+        });
+
+        Client client;
+        client.network = std::make_unique<NetworkManager>();
+        client.replication = std::make_unique<ReplicationManager>();
+        client.network->SetTransportFactory(loopback);
+        client.network->Connect("127.0.0.1", kServerPort);
+        ReplicationManager* replication = client.replication.get();
+        replication->Initialize(client.network.get());
+        replication->RegisterType<Wanderer>();
+        client.network->SetOnData([replication](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+        {
+            replication->HandlePacket(conn->GetId(), data);
+        });
+
+        for (int attempt = 0; attempt < 8 && serverNetwork.GetConnectionCount() == 0; ++attempt)
+        {
+            serverNetwork.Update(0.0f);
+            client.network->Update(0.0f);
+        }
+
+        std::mt19937 rng(99);
+        std::vector<std::shared_ptr<Wanderer>> objects(kObjects);
+        for (auto& object : objects)
+        {
+            object = std::make_shared<Wanderer>();
+            object->position = Vec3(kWorldSize * 0.5f, 0.0f, kWorldSize * 0.5f);
+            object->velocity = RandomVelocity(rng, kObjectSpeed);
+            server.Spawn(object);
+        }
+
+        const auto tick = [&](bool moving)
+        {
+            if (moving)
+            {
+                for (auto& object : objects)
+                {
+                    Bounce(object->position, object->velocity, dt);
+                }
+            }
+            serverNetwork.Update(dt);
+            server.Update(dt);
+            client.network->Update(dt);
+        };
+
+        for (int i = 0; i < kSettleTicks; ++i)
+        {
+            tick(true);
+        }
+
+        dropAcks = true;
+        for (int i = 0; i < kLossTicks; ++i)
+        {
+            tick(true);
+        }
+        dropAcks = false;
+
+        const ReplicationStats before = server.GetStats();
+        for (int i = 0; i < kRecoveryTicks; ++i)
+        {
+            tick(true);
+        }
+        for (int i = 0; i < kSettleTicks; ++i)
+        {
+            tick(false);
+        }
+        serverNetwork.Update(dt);
+        const ReplicationStats after = server.GetStats();
+
+        size_t stale = 0;
+        for (const auto& object : objects)
+        {
+            auto remote = std::dynamic_pointer_cast<Wanderer>(replication->GetObject(object->GetNetId()));
+            stale += remote && remote->position == object->position ? 0 : 1;
+        }
+
+        AckLossResult result;
+        result.objectsSent = after.objectsSent - before.objectsSent;
+        result.deltaObjectsSent = after.deltaObjectsSent - before.deltaObjectsSent;
+        result.snapshotsAcked = after.snapshotsAcked - before.snapshotsAcked;
+        if (stale > 0)
+        {
+            RVX_CORE_ERROR("  ack loss: {} of {} objects stale on the client", stale, kObjects);
+            failures++;
+        }
+        if (result.snapshotsAcked == 0 || result.deltaObjectsSent == 0)
+        {
+            RVX_CORE_ERROR("  ack loss: replication did not recover once acks arrived again");
+            failures++;
+        }
+
+        client.replication->Shutdown();
+        client.network->Stop();
+        server.Shutdown();
+        serverNetwork.Stop();
+        return result;
+    }
+
+    struct SequenceWrapResult
+    {
+        uint64 snapshotsSent = 0;
+        uint64 objectsSent = 0;         // After the idle object moved again
+        uint64 deltaObjectsSent = 0;
+    };
+
+    /// Send past 65536 snapshots with one object idle on an old baseline
+    SequenceWrapResult RunSequenceWrap(uint32& failures)
+    {
+        constexpr int kWrapTicks = 70000;
+        constexpr int kMovingTicks = 40;
+
+        const auto network = std::make_shared<LoopbackNetwork>();
+        const auto loopback = [network]() { return CreateLoopbackTransport(network); };
+        const float dt = 1.0f / kTickRate;
+
+        NetworkManager serverNetwork;
+        ReplicationManager server;
+        serverNetwork.SetTransportFactory(loopback);
+        serverNetwork.StartServer(kServerPort);
+        server.Initialize(&serverNetwork);
+        serverNetwork.SetOnData([&](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+        {
+            server.HandlePacket(conn->GetId(), data);
+        });
+
+        Client client;
+        client.network = std::make_unique<NetworkManager>();
+        client.replication = std::make_unique<ReplicationManager>();
+        client.network->SetTransportFactory(loopback);
+        client.network->Connect("127.0.0.1", kServerPort);
+        ReplicationManager* replication = client.replication.get();
+        replication->Initialize(client.network.get());
+        replication->RegisterType<Wanderer>();
+        client.network->SetOnData([replication](ConnectionPtr conn, std::span<const uint8> data, ChannelId)
+        {
+            replication->HandlePacket(conn->GetId(), data);
+        });
+
+        for (int attempt = 0; attempt < 8 && serverNetwork.GetConnectionCount() == 0; ++attempt)
+        {
+            serverNetwork.Update(0.0f);
+            client.network->Update(0.0f);
+        }
+
+        std::mt19937 rng(7);
+        auto busy = std::make_shared<Wanderer>();
+        auto idle = std::make_shared<Wanderer>();
+        for (auto& object : {busy, idle})
+        {
+            object->position = Vec3(kWorldSize * 0.5f, 0.0f, kWorldSize * 0.5f);
+            object->velocity = RandomVelocity(rng, kObjectSpeed);
+            server.Spawn(object);
+        }
+
+        const auto tick = [&](bool moveBusy, bool moveIdle)
+        {
+            if (moveBusy)
+                Bounce(busy->position, busy->velocity, dt);
+            if (moveIdle)
+                Bounce(idle->position, idle->velocity, dt);
+            serverNetwork.Update(dt);
+            server.Update(dt);
+            client.network->Update(dt);
+        };
+
+        // The idle object is acknowledged once, then only the busy one moves
+        for (int i = 0; i < kSettleTicks; ++i)
+        {
+            tick(true, true);
+        }
+        for (int i = 0; i < kWrapTicks; ++i)
+        {
+            tick(true, false);
+        }
+
+        const ReplicationStats before = server.GetStats();
+        for (int i = 0; i < kMovingTicks; ++i)
+        {
+            tick(true, true);
+        }
+        for (int i = 0; i < kSettleTicks; ++i)
+        {
+            tick(false, false);
+        }
+        serverNetwork.Update(dt);
+        const ReplicationStats after = server.GetStats();
+
+        size_t stale = 0;
+        for (const auto& object : {busy, idle})
+        {
+            auto remote = std::dynamic_pointer_cast<Wanderer>(replication->GetObject(object->GetNetId()));
+            stale += remote && remote->position == object->position ? 0 : 1;
+        }
+
+        SequenceWrapResult result;
+        result.snapshotsSent = after.snapshotsSent;
+        result.objectsSent = after.objectsSent - before.objectsSent;
+        result.deltaObjectsSent = after.deltaObjectsSent - before.deltaObjectsSent;
+        if (result.snapshotsSent <= 65536)
+        {
+            RVX_CORE_ERROR("  sequence wrap: only {} snapshots sent", result.snapshotsSent);
+            failures++;
+        }
+        if (stale > 0)
+        {
+            RVX_CORE_ERROR("  sequence wrap: {} of 2 objects stale on the client", stale);
+            failures++;
+        }
+        if (after.snapshotsAcked != after.snapshotsSent)
+        {
+            RVX_CORE_ERROR("  sequence wrap: {} of {} snapshots acknowledged", after.snapshotsAcked,
+                           after.snapshotsSent);
+            failures++;
+        }
+        if (result.deltaObjectsSent != result.objectsSent)
+        {
+            RVX_CORE_ERROR("  sequence wrap: {} of {} objects sent as deltas", result.deltaObjectsSent,
+                           result.objectsSent);
+            failures++;
+        }
+
+        client.replication->Shutdown();
+        client.network->Stop();
+        server.Shutdown();
+        serverNetwork.Stop();
+        return result;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Replication Interest Benchmark");
+
+    // Optional scale factor for clients, objects and duration, e.g. "ReplicationInterestBenchmark 0.1"
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const uint32 clientCount = std::max(8u, static_cast<uint32>(kClientCount * std::min(scale, 1.0f)));
+    const uint32 objectCount = std::max(200u, static_cast<uint32>(kObjectCount * std::min(scale, 1.0f)));
+    const float seconds = std::max(1.0f, 5.0f * scale);
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} clients, {} objects on a {:.0f}m map, {:.0f}s at {:.0f} Hz ===",
+                  clientCount, objectCount, kWorldSize, seconds, kTickRate);
+
+    uint32 failures = 0;
+
+    // Connection and spawn logging would drown the table
+    Log::SetLevel(spdlog::level::err);
+    const RunResult all = Run(false, clientCount, objectCount, seconds, failures);
+    const RunResult interest = Run(true, clientCount, objectCount, seconds, failures);
+    const AckLossResult ackLoss = RunAckLoss(failures);
+    const SequenceWrapResult sequenceWrap = RunSequenceWrap(failures);
+    Log::SetLevel(spdlog::level::info);
+
+    RVX_CORE_INFO("  {:<10} {:>14} {:>14} {:>14} {:>12} {:>16}",
+                  "mode", "down KB/s/cl", "up KB/s/cl", "serialize/s", "server ms", "relevant pairs");
+    for (const auto& [name, result] : {std::pair{"all", all}, std::pair{"interest", interest}})
+    {
+        RVX_CORE_INFO("  {:<10} {:>14.1f} {:>14.2f} {:>14.0f} {:>12.3f} {:>16.0f}",
+                      name, result.downKBps, result.upKBps, result.serializationsPerSec,
+                      result.serverMsPerTick, result.relevantPairs);
+    }
+    RVX_CORE_INFO("  interest management: {:.1f}x less downstream per client",
+                  interest.downKBps > 0.0 ? all.downKBps / interest.downKBps : 0.0);
+    RVX_CORE_INFO("  after acks were lost: {} snapshots acknowledged, {} of {} objects sent as deltas",
+                  ackLoss.snapshotsAcked, ackLoss.deltaObjectsSent, ackLoss.objectsSent);
+    RVX_CORE_INFO("  after {} snapshots: {} of {} objects sent as deltas",
+                  sequenceWrap.snapshotsSent, sequenceWrap.deltaObjectsSent, sequenceWrap.objectsSent);
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,403 @@
+/**
+ * @file main.cpp
+ * @brief Spatial index benchmark: BVH vs Octree vs Grid
+ *
+ * Runs static, fully dynamic and mixed populations through every index type
+ * and reports build, per-frame update and query timings. Query results are
+ * cross-checked against the BVH so a faster index cannot silently be wrong.
+ *
+ * A crowd is also walked across the world through the grid, with one large
+ * entity passing through, to check that the grid releases the cells it
+ * leaves behind and still answers like the BVH afterwards.
+ */
+
+#include "Core/Core.h"
+#include "Spatial/Spatial.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+using namespace RVX;
+using namespace RVX::Spatial;
+
+namespace
+{
+    constexpr float kWorldExtent = 1000.0f;
+    constexpr int kFrames = 60;
+    constexpr int kQueriesPerFrame = 64;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    class BenchEntity : public ISpatialEntity
+    {
+    public:
+        EntityHandle handle = 0;
+        AABB bounds;
+        Vec3 velocity{0.0f};
+
+        EntityHandle GetHandle() const override { return handle; }
+        AABB GetWorldBounds() const override { return bounds; }
+        bool IsSpatialDirty() const override { return false; }
+        void ClearSpatialDirty() override {}
+    };
+
+    struct Scenario
+    {
+        const char* name;
+        int entityCount;
+        float dynamicFraction;   // fraction of entities moved every frame
+        int churnPerFrame;       // remove + insert pairs per frame
+    };
+
+    struct Timings
+    {
+        double buildMs = 0.0;
+        double updateMs = 0.0;   // per frame (Update/Insert/Remove + Commit)
+        double frustumUs = 0.0;  // per query
+        double boxUs = 0.0;
+        double rayUs = 0.0;
+        size_t resultChecksum = 0;
+    };
+
+    struct QuerySet
+    {
+        std::vector<Frustum> frustums;
+        std::vector<AABB> boxes;
+        std::vector<Ray> rays;
+    };
+
+    std::vector<std::unique_ptr<BenchEntity>> CreateEntities(int count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-kWorldExtent, kWorldExtent);
+        std::uniform_real_distribution<float> size(0.5f, 4.0f);
+        std::uniform_real_distribution<float> speed(-20.0f, 20.0f);
+
+        std::vector<std::unique_ptr<BenchEntity>> entities;
+        entities.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            auto entity = std::make_unique<BenchEntity>();
+            entity->handle = static_cast<EntityHandle>(i);
+            const Vec3 center(position(rng), position(rng) * 0.1f, position(rng));
+            const float extent = size(rng);
+            entity->bounds = AABB(center - Vec3(extent), center + Vec3(extent));
+            entity->velocity = Vec3(speed(rng), 0.0f, speed(rng));
+            entities.push_back(std::move(entity));
+        }
+        return entities;
+    }
+
+    QuerySet CreateQueries(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-kWorldExtent, kWorldExtent);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+        QuerySet queries;
+        for (int i = 0; i < kQueriesPerFrame; ++i)
+        {
+            const Vec3 eye(position(rng), 10.0f, position(rng));
+            const float yaw = angle(rng);
+            const Vec3 forward(std::cos(yaw), -0.1f, std::sin(yaw));
+
+            Frustum frustum;
+            frustum.SetPerspective(eye, glm::normalize(forward), Vec3(0.0f, 1.0f, 0.0f),
+                                   glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+            queries.frustums.push_back(frustum);
+
+            const Vec3 boxCenter(position(rng), 0.0f, position(rng));
+            queries.boxes.push_back(AABB(boxCenter - Vec3(50.0f), boxCenter + Vec3(50.0f)));
+
+            queries.rays.push_back(Ray(eye, glm::normalize(forward), 0.0f, 2.0f * kWorldExtent));
+        }
+        return queries;
+    }
+
+    void RunQueries(const ISpatialIndex& index, const QuerySet& queries, Timings& timings)
+    {
+        const QueryFilter filter = QueryFilter::All();
+        std::vector<QueryResult> results;
+
+        auto start = Clock::now();
+        for (const auto& frustum : queries.frustums)
+        {
+            results.clear();
+            index.QueryFrustum(frustum, filter, results);
+            timings.resultChecksum += results.size();
+        }
+        timings.frustumUs += ElapsedMs(start) * 1000.0 / queries.frustums.size();
+
+        start = Clock::now();
+        for (const auto& box : queries.boxes)
+        {
+            results.clear();
+            index.QueryBox(box, filter, results);
+            timings.resultChecksum += results.size();
+        }
+        timings.boxUs += ElapsedMs(start) * 1000.0 / queries.boxes.size();
+
+        start = Clock::now();
+        for (const auto& ray : queries.rays)
+        {
+            QueryResult hit;
+            if (index.QueryRay(ray, filter, hit))
+            {
+                timings.resultChecksum += static_cast<size_t>(hit.handle);
+            }
+        }
+        timings.rayUs += ElapsedMs(start) * 1000.0 / queries.rays.size();
+    }
+
+    Timings RunScenario(SpatialIndexType type, const Scenario& scenario)
+    {
+        auto entities = CreateEntities(scenario.entityCount, 1234);
+        const QuerySet queries = CreateQueries(5678);
+        std::mt19937 rng(91011);
+
+        // Entities in the upper part of the handle range start outside the index for churn
+        const int initialCount = scenario.entityCount - scenario.churnPerFrame * 2;
+        std::vector<ISpatialEntity*> initial;
+        std::vector<bool> indexed(entities.size(), false);
+        for (int i = 0; i < initialCount; ++i)
+        {
+            initial.push_back(entities[i].get());
+            indexed[i] = true;
+        }
+
+        auto index = SpatialFactory::Create(type);
+        Timings timings;
+
+        auto start = Clock::now();
+        index->Build(initial);
+        timings.buildMs = ElapsedMs(start);
+
+        const int dynamicCount = static_cast<int>(scenario.entityCount * scenario.dynamicFraction);
+        const float dt = 1.0f / 60.0f;
+
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            start = Clock::now();
+
+            for (int i = 0; i < dynamicCount; ++i)
+            {
+                auto& entity = *entities[i];
+                if (!indexed[i]) continue;
+                const Vec3 offset = entity.velocity * dt;
+                entity.bounds = AABB(entity.bounds.GetMin() + offset, entity.bounds.GetMax() + offset);
+                index->Update(&entity);
+            }
+
+            for (int c = 0; c < scenario.churnPerFrame; ++c)
+            {
+                const size_t slot = rng() % entities.size();
+                if (indexed[slot])
+                {
+                    index->Remove(entities[slot]->handle);
+                }
+                else
+                {
+                    index->Insert(entities[slot].get());
+                }
+                indexed[slot] = !indexed[slot];
+            }
+
+            index->Commit();
+            timings.updateMs += ElapsedMs(start);
+
+            RunQueries(*index, queries, timings);
+        }
+
+        timings.updateMs /= kFrames;
+        timings.frustumUs /= kFrames;
+        timings.boxUs /= kFrames;
+        timings.rayUs /= kFrames;
+        return timings;
+    }
+
+    std::vector<EntityHandle> SortedHandles(std::vector<QueryResult>& results)
+    {
+        std::vector<EntityHandle> handles;
+        for (const auto& result : results)
+        {
+            handles.push_back(result.handle);
+        }
+        std::sort(handles.begin(), handles.end());
+        results.clear();
+        return handles;
+    }
+
+    /// Walk a crowd across the world; returns the number of failed checks
+    int RunRoamingCrowd(int entityCount)
+    {
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+
+        std::vector<std::unique_ptr<BenchEntity>> entities;
+        std::vector<ISpatialEntity*> initial;
+        for (int i = 0; i < entityCount; ++i)
+        {
+            auto entity = std::make_unique<BenchEntity>();
+            entity->handle = static_cast<EntityHandle>(i);
+            const Vec3 center(position(rng) - kWorldExtent, 0.0f, position(rng));
+            entity->bounds = AABB(center - Vec3(1.0f), center + Vec3(1.0f));
+            initial.push_back(entity.get());
+            entities.push_back(std::move(entity));
+        }
+
+        // Flat enough to stay in the cells rather than the oversized list
+        auto large = std::make_unique<BenchEntity>();
+        large->handle = static_cast<EntityHandle>(entityCount);
+        large->bounds = AABB(Vec3(-kWorldExtent - 30.0f, -1.0f, -30.0f), Vec3(-kWorldExtent + 30.0f, 1.0f, 30.0f));
+        initial.push_back(large.get());
+
+        auto grid = SpatialFactory::Create(SpatialIndexType::Grid);
+        auto bvh = SpatialFactory::Create(SpatialIndexType::BVH);
+        grid->Build(initial);
+        bvh->Build(initial);
+        const size_t initialCells = grid->GetStats().nodeCount;
+        size_t peakCells = initialCells;
+
+        constexpr int kRoamFrames = 200;
+        const Vec3 step(2.0f * kWorldExtent / kRoamFrames, 0.0f, 0.0f);
+        auto start = Clock::now();
+        for (int frame = 0; frame < kRoamFrames; ++frame)
+        {
+            for (auto& entity : entities)
+            {
+                entity->bounds = AABB(entity->bounds.GetMin() + step, entity->bounds.GetMax() + step);
+                grid->Update(entity.get());
+                bvh->Update(entity.get());
+            }
+
+            // The large entity leaves halfway
+            if (frame == kRoamFrames / 2)
+            {
+                grid->Remove(large->handle);
+                bvh->Remove(large->handle);
+            }
+            else if (frame < kRoamFrames / 2)
+            {
+                large->bounds = AABB(large->bounds.GetMin() + step, large->bounds.GetMax() + step);
+                grid->Update(large.get());
+                bvh->Update(large.get());
+            }
+
+            grid->Commit();
+            bvh->Commit();
+            peakCells = std::max(peakCells, grid->GetStats().nodeCount);
+        }
+        const double updateMs = ElapsedMs(start) / kRoamFrames;
+
+        const size_t finalCells = grid->GetStats().nodeCount;
+        RVX_CORE_INFO("  cells: {} at start, {} at most, {} at the end ({:.3f} ms/frame with the BVH)",
+                      initialCells, peakCells, finalCells, updateMs);
+
+        int failures = 0;
+        if (finalCells > initialCells * 2)
+        {
+            RVX_CORE_ERROR("  Grid kept {} cells for a crowd that needed {}", finalCells, initialCells);
+            failures++;
+        }
+
+        // Boxes that contain whole cells take the no-per-entity-test path
+        const QueryFilter filter = QueryFilter::All();
+        std::vector<QueryResult> results;
+        const Vec3 crowdCenter(kWorldExtent, 0.0f, 0.0f);
+        for (const float halfSize : {5.0f, 20.0f, 45.0f, 80.0f})
+        {
+            const AABB box(crowdCenter - Vec3(halfSize), crowdCenter + Vec3(halfSize));
+            grid->QueryBox(box, filter, results);
+            const auto gridHits = SortedHandles(results);
+            bvh->QueryBox(box, filter, results);
+            if (gridHits != SortedHandles(results))
+            {
+                RVX_CORE_ERROR("  Grid box query ({} half size) differs from BVH", halfSize);
+                failures++;
+            }
+        }
+
+        for (const QuerySet& queries = CreateQueries(1357); const auto& frustum : queries.frustums)
+        {
+            grid->QueryFrustum(frustum, filter, results);
+            const auto gridHits = SortedHandles(results);
+            bvh->QueryFrustum(frustum, filter, results);
+            if (gridHits != SortedHandles(results))
+            {
+                RVX_CORE_ERROR("  Grid frustum query differs from BVH after the crowd moved");
+                failures++;
+                break;
+            }
+        }
+
+        return failures;
+    }
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("Spatial Index Benchmark");
+
+    // Optional scale factor for quick runs: SpatialIndexBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    auto scaled = [scale](int count) { return std::max(64, static_cast<int>(count * scale)); };
+
+    const Scenario scenarios[] = {
+        {"Static",  scaled(100000), 0.0f, 0},
+        {"Dynamic", scaled(20000),  1.0f, 0},
+        {"Mixed",   scaled(50000),  0.1f, 32},
+    };
+
+    const SpatialIndexType types[] = {
+        SpatialIndexType::BVH,
+        SpatialIndexType::Octree,
+        SpatialIndexType::Grid,
+    };
+
+    int failures = 0;
+
+    for (const auto& scenario : scenarios)
+    {
+        RVX_CORE_INFO("");
+        RVX_CORE_INFO("=== {} ({} entities, {:.0f}% dynamic, {} churn/frame) ===",
+                      scenario.name, scenario.entityCount,
+                      scenario.dynamicFraction * 100.0f, scenario.churnPerFrame);
+        RVX_CORE_INFO("  {:<8} {:>10} {:>12} {:>12} {:>12} {:>12}",
+                      "Index", "Build ms", "Update ms/f", "Frustum us", "Box us", "Ray us");
+
+        size_t referenceChecksum = 0;
+        for (auto type : types)
+        {
+            const Timings timings = RunScenario(type, scenario);
+            RVX_CORE_INFO("  {:<8} {:>10.3f} {:>12.4f} {:>12.2f} {:>12.2f} {:>12.2f}",
+                          SpatialFactory::GetTypeName(type), timings.buildMs, timings.updateMs,
+                          timings.frustumUs, timings.boxUs, timings.rayUs);
+
+            if (type == SpatialIndexType::BVH)
+            {
+                referenceChecksum = timings.resultChecksum;
+            }
+            else if (timings.resultChecksum != referenceChecksum)
+            {
+                RVX_CORE_ERROR("  {} query results differ from BVH", SpatialFactory::GetTypeName(type));
+                failures++;
+            }
+        }
+    }
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== Roaming crowd ({} entities crossing the world) ===", scaled(5000));
+    failures += RunRoamingCrowd(scaled(5000));
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
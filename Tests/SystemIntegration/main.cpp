@@ -82,6 +82,7 @@ bool TestSpatialModule()
             AABB GetWorldBounds() const override { return m_bounds; }
             bool IsSpatialDirty() const override { return false; }
             void ClearSpatialDirty() override {}
+            void SetBounds(const AABB& b) { m_bounds = b; }
 
         private:
             Spatial::EntityHandle m_handle;
@@ -106,6 +107,35 @@ bool TestSpatialModule()
         assert(results.size() == 2); // entity1 and entity2
 
         LOG_INFO("  BVHIndex: PASS");
+
+        // Incremental update: move, insert and remove without a full rebuild
+        Spatial::BVHConfig incrementalConfig;
+        incrementalConfig.maxIncrementalRatio = 1.0f;
+        incrementalConfig.rebuildQualityThreshold = 100.0f;
+
+        Spatial::BVHIndex incrementalBvh(incrementalConfig);
+        incrementalBvh.Build(entities);
+
+        entity3.SetBounds(AABB(Vec3(1, 1, 1), Vec3(1.5f, 1.5f, 1.5f)));
+        incrementalBvh.Update(&entity3);
+
+        TestEntity entity4(4, AABB(Vec3(-1.5f, 0, 0), Vec3(-1, 0.5f, 0.5f)));
+        incrementalBvh.Insert(&entity4);
+        incrementalBvh.Remove(entity1.GetHandle());
+        incrementalBvh.Commit();
+
+        assert(incrementalBvh.GetEntityCount() == 3);
+
+        results.clear();
+        incrementalBvh.QueryBox(AABB(Vec3(-2, -2, -2), Vec3(2, 2, 2)),
+                                Spatial::QueryFilter::All(), results);
+        assert(results.size() == 3); // entity2, moved entity3 and entity4
+
+        auto bvhStats = incrementalBvh.GetStats();
+        assert(bvhStats.rebuildCount == 1);
+        assert(bvhStats.refitCount == 1);
+        LOG_INFO("  BVHIndex refit time: {} ms", bvhStats.refitTimeMs);
+        LOG_INFO("  BVHIndex incremental: PASS");
     }
 
     LOG_INFO("Spatial Module: ALL TESTS PASSED");
@@ -0,0 +1,319 @@
+/**
+ * @file main.cpp
+ * @brief ThreadPool benchmark: submit, steal and fork-join overhead
+ *
+ * Measures per-task cost of near-empty tasks at 1, 4 and 16 worker threads:
+ * tasks submitted from outside the pool, tasks spawned by a worker (which
+ * the others must steal), and a recursive fork-join tree whose inner nodes
+ * wait on their children. The first two are also run on a reference pool
+ * with a single locked priority queue and a packaged_task per submit, the
+ * design ThreadPool replaced. Every run checks that each task ran exactly
+ * once, and that tasks spawned while the pool shuts down still run.
+ */
+
+#include "Core/Core.h"
+#include "Core/Job/ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+using namespace RVX;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// Single locked heap, one shared_ptr<packaged_task> per submit
+    class LockedQueuePool
+    {
+    public:
+        explicit LockedQueuePool(size_t threadCount)
+        {
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                m_threads.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        ~LockedQueuePool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_condition.notify_all();
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        template<typename F>
+        std::future<void> Submit(F&& func)
+        {
+            auto task = std::make_shared<std::packaged_task<void()>>(std::forward<F>(func));
+            std::future<void> future = task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_tasks.push(Entry{[task]() { (*task)(); }, 0});
+            }
+            m_condition.notify_one();
+            return future;
+        }
+
+    private:
+        struct Entry
+        {
+            std::function<void()> func;
+            int priority;
+            bool operator<(const Entry& other) const { return priority < other.priority; }
+        };
+
+        void WorkerLoop()
+        {
+            while (true)
+            {
+                Entry entry;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_condition.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+                    if (m_stopping && m_tasks.empty())
+                        return;
+                    entry = std::move(const_cast<Entry&>(m_tasks.top()));
+                    m_tasks.pop();
+                }
+                entry.func();
+            }
+        }
+
+        std::vector<std::thread> m_threads;
+        std::priority_queue<Entry> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping = false;
+    };
+
+    struct Result
+    {
+        double nsPerTask = 0.0;
+        bool valid = true;
+    };
+
+    /// Main thread submits every task, then waits for all of them
+    Result ExternalSubmit(ThreadPool& pool, int taskCount)
+    {
+        std::atomic<int> executed{0};
+        const auto start = Clock::now();
+        for (int i = 0; i < taskCount; ++i)
+        {
+            pool.SubmitDetached([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+        }
+        pool.WaitAll();
+        const double ms = ElapsedMs(start);
+        return {ms * 1e6 / taskCount, executed.load() == taskCount};
+    }
+
+    Result ExternalSubmit(LockedQueuePool& pool, int taskCount)
+    {
+        std::atomic<int> executed{0};
+        std::vector<std::future<void>> futures;
+        futures.reserve(taskCount);
+        const auto start = Clock::now();
+        for (int i = 0; i < taskCount; ++i)
+        {
+            futures.push_back(pool.Submit([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& future : futures)
+        {
+            future.wait();
+        }
+        const double ms = ElapsedMs(start);
+        return {ms * 1e6 / taskCount, executed.load() == taskCount};
+    }
+
+    /// One task running on a worker spawns every other task; idle workers steal them
+    Result WorkerSpawn(ThreadPool& pool, int taskCount)
+    {
+        std::atomic<int> executed{0};
+        std::atomic<bool> spawned{false};
+        const auto start = Clock::now();
+        pool.SubmitDetached([&]() {
+            for (int i = 0; i < taskCount; ++i)
+            {
+                pool.SubmitDetached([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+            }
+            spawned.store(true, std::memory_order_release);
+        });
+        pool.RunUntil([&]() { return spawned.load(std::memory_order_acquire); });
+        pool.WaitAll();
+        const double ms = ElapsedMs(start);
+        return {ms * 1e6 / taskCount, executed.load() == taskCount};
+    }
+
+    Result WorkerSpawn(LockedQueuePool& pool, int taskCount)
+    {
+        std::atomic<int> executed{0};
+        std::vector<std::future<void>> futures;
+        futures.reserve(taskCount);
+        const auto start = Clock::now();
+        pool.Submit([&]() {
+            for (int i = 0; i < taskCount; ++i)
+            {
+                futures.push_back(pool.Submit([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }));
+            }
+        }).wait();
+        for (auto& future : futures)
+        {
+            future.wait();
+        }
+        const double ms = ElapsedMs(start);
+        return {ms * 1e6 / taskCount, executed.load() == taskCount};
+    }
+
+    /// Each inner node spawns two children and waits for them, helping while it does
+    void ForkJoin(ThreadPool& pool, int depth, std::atomic<int>& leaves)
+    {
+        if (depth == 0)
+        {
+            leaves.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::atomic<int> remaining{2};
+        for (int child = 0; child < 2; ++child)
+        {
+            pool.SubmitDetached([&pool, &leaves, &remaining, depth]() {
+                ForkJoin(pool, depth - 1, leaves);
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+        pool.RunUntil([&remaining]() { return remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    Result ForkJoinTree(ThreadPool& pool, int depth)
+    {
+        std::atomic<int> leaves{0};
+        const int taskCount = (1 << (depth + 1)) - 2;
+        const auto start = Clock::now();
+        ForkJoin(pool, depth, leaves);
+        const double ms = ElapsedMs(start);
+        return {ms * 1e6 / taskCount, leaves.load() == (1 << depth)};
+    }
+
+    /// Tasks that spawn children while the pool is being destroyed
+    bool SpawnDuringShutdown(size_t threads)
+    {
+        std::atomic<int> children{0};
+        {
+            ThreadPool pool(threads);
+            for (size_t i = 0; i < threads; ++i)
+            {
+                pool.SubmitDetached([&pool, &children]()
+                {
+                    // Long enough for the destructor to start stopping the pool
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    pool.SubmitDetached([&children]() { children++; });
+                });
+            }
+        }
+        return children.load() == static_cast<int>(threads);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("ThreadPool Benchmark");
+
+    // Optional scale factor for quick runs: ThreadPoolBenchmark 0.1
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    auto scaled = [scale](int count) { return std::max(64, static_cast<int>(count * scale)); };
+    const int taskCount = scaled(200000);
+    int forkDepth = 2;
+    while ((2 << forkDepth) <= taskCount / 2)
+    {
+        ++forkDepth;
+    }
+
+    const size_t threadCounts[] = {1, 4, 16};
+    constexpr int kRepeats = 3;
+
+    int failures = 0;
+    auto check = [&failures](const Result& result, const char* name, size_t threads)
+    {
+        if (!result.valid)
+        {
+            RVX_CORE_ERROR("  {} with {} threads lost or duplicated tasks", name, threads);
+            failures++;
+        }
+    };
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} empty tasks, fork-join depth {} (best of {}) ===", taskCount, forkDepth, kRepeats);
+    RVX_CORE_INFO("  {:<8} {:>14} {:>14} {:>14} {:>14} {:>12} {:>10}",
+                  "Threads", "Locked ext ns", "Steal ext ns", "Locked spawn", "Steal spawn", "Fork-join ns", "Steals");
+
+    for (size_t threads : threadCounts)
+    {
+        Result lockedExternal{1e30}, lockedSpawn{1e30};
+        {
+            LockedQueuePool locked(threads);
+            for (int repeat = 0; repeat < kRepeats; ++repeat)
+            {
+                const Result external = ExternalSubmit(locked, taskCount);
+                const Result spawn = WorkerSpawn(locked, taskCount);
+                check(external, "Locked external submit", threads);
+                check(spawn, "Locked worker spawn", threads);
+                lockedExternal.nsPerTask = std::min(lockedExternal.nsPerTask, external.nsPerTask);
+                lockedSpawn.nsPerTask = std::min(lockedSpawn.nsPerTask, spawn.nsPerTask);
+            }
+        }
+
+        Result stealExternal{1e30}, stealSpawn{1e30}, forkJoin{1e30};
+        size_t steals = 0;
+        {
+            ThreadPool pool(threads);
+            for (int repeat = 0; repeat < kRepeats; ++repeat)
+            {
+                const Result external = ExternalSubmit(pool, taskCount);
+                const Result spawn = WorkerSpawn(pool, taskCount);
+                const Result tree = ForkJoinTree(pool, forkDepth);
+                check(external, "External submit", threads);
+                check(spawn, "Worker spawn", threads);
+                check(tree, "Fork-join", threads);
+                stealExternal.nsPerTask = std::min(stealExternal.nsPerTask, external.nsPerTask);
+                stealSpawn.nsPerTask = std::min(stealSpawn.nsPerTask, spawn.nsPerTask);
+                forkJoin.nsPerTask = std::min(forkJoin.nsPerTask, tree.nsPerTask);
+            }
+            if (pool.HasPendingTasks())
+            {
+                RVX_CORE_ERROR("  {} tasks still pending after WaitAll", pool.GetPendingCount());
+                failures++;
+            }
+            steals = pool.GetStealCount();
+        }
+
+        RVX_CORE_INFO("  {:<8} {:>14.1f} {:>14.1f} {:>14.1f} {:>14.1f} {:>12.1f} {:>10}",
+                      threads, lockedExternal.nsPerTask, stealExternal.nsPerTask,
+                      lockedSpawn.nsPerTask, stealSpawn.nsPerTask, forkJoin.nsPerTask, steals);
+
+        if (!SpawnDuringShutdown(threads))
+        {
+            RVX_CORE_ERROR("  {} threads: tasks spawned during shutdown were dropped", threads);
+            failures++;
+        }
+    }
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
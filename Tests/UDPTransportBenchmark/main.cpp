@@ -0,0 +1,246 @@
+/**
+ * @file main.cpp
+ * @brief UDP transport benchmark: polled socket vs dedicated batched I/O thread
+ *
+ * Sends bursts of datagrams between two UDPTransports over 127.0.0.1, once
+ * with the socket polled from the game thread and once with a dedicated
+ * I/O thread (recvmmsg/sendmmsg batching on Linux). Each simulated tick
+ * sends a burst, leaves the rest of the tick to "game work", then drains
+ * whatever arrived, and the game-thread time spent sending and draining is
+ * reported per packet along with its worst tick.
+ *
+ * Every datagram carries its sequence number and a fill pattern; any that
+ * arrive corrupted, duplicated or out of order fail the run, as does loss
+ * with the I/O thread, which keeps the socket drained between ticks. The
+ * polled socket only drains once per tick, so the kernel may drop part of
+ * a large burst; that loss is reported rather than failed.
+ */
+
+#include "Core/Core.h"
+#include "Networking/Transport/UDPTransport.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace RVX;
+using namespace RVX::Net;
+
+namespace
+{
+    constexpr uint32 kPacketsPerTick = 1000;
+    constexpr uint32 kTicks = 200;
+    constexpr uint32 kPacketBytes = 200;
+    constexpr auto kGameWork = std::chrono::milliseconds(5);
+    constexpr auto kDrainTimeout = std::chrono::milliseconds(500);
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct RunResult
+    {
+        bool ok = false;
+        bool ioThread = false;          // False if the I/O thread was requested but unavailable
+        uint32 sent = 0;
+        uint32 received = 0;
+        uint32 invalid = 0;             // Corrupted, duplicated or out of order
+        double sendUs = 0.0;            // Game-thread time per packet sent
+        double receiveUs = 0.0;         // Game-thread time per packet received
+        double worstTickMs = 0.0;       // Most game-thread time spent on the network in one tick
+        UDPIOStats senderStats;
+        UDPIOStats receiverStats;
+    };
+
+    void FillPacket(std::vector<uint8>& packet, uint32 sequence)
+    {
+        std::memset(packet.data(), static_cast<int>(sequence & 0xFF), packet.size());
+        std::memcpy(packet.data(), &sequence, sizeof(sequence));
+    }
+
+    class Receiver
+    {
+    public:
+        explicit Receiver(UDPTransport& transport) : m_transport(transport) {}
+
+        /// Everything that has arrived; returns the number of packets
+        uint32 Drain(RunResult& result)
+        {
+            m_transport.Poll(0);
+
+            uint32 count = 0;
+            while (m_transport.ReceiveFrom(m_packet) == TransportResult::Success)
+            {
+                count++;
+                result.received++;
+
+                uint32 sequence = 0;
+                std::memcpy(&sequence, m_packet.data.data(), std::min<size_t>(sizeof(sequence), m_packet.data.size()));
+                const bool intact = m_packet.data.size() == kPacketBytes &&
+                                    m_packet.data.back() == static_cast<uint8>(sequence & 0xFF);
+
+                // Loss leaves gaps, but loopback never reorders or duplicates
+                if (!intact || (m_hasLast && sequence <= m_lastSequence))
+                {
+                    result.invalid++;
+                }
+                m_lastSequence = sequence;
+                m_hasLast = true;
+            }
+            return count;
+        }
+
+    private:
+        UDPTransport& m_transport;
+        ReceivedPacket m_packet;
+        uint32 m_lastSequence = 0;
+        bool m_hasLast = false;
+    };
+
+    RunResult Run(bool ioThread, uint32 packetsPerTick, uint32 ticks)
+    {
+        RunResult result;
+
+        TransportConfig config;
+        config.bindAddress = "127.0.0.1";
+        config.receiveBufferSize = 4 * 1024 * 1024;
+        config.sendBufferSize = 4 * 1024 * 1024;
+        config.dedicatedIOThread = ioThread;
+
+        UDPTransport sender;
+        UDPTransport receiver;
+        if (sender.Initialize(config) != TransportResult::Success ||
+            receiver.Initialize(config) != TransportResult::Success)
+        {
+            RVX_CORE_ERROR("  could not open UDP sockets on 127.0.0.1");
+            return result;
+        }
+        result.ioThread = sender.HasIOThread() && receiver.HasIOThread();
+
+        const NetworkAddress destination = receiver.GetLocalAddress();
+        Receiver drain(receiver);
+        std::vector<uint8> packet(kPacketBytes);
+
+        double sendMs = 0.0;
+        double receiveMs = 0.0;
+        uint32 sequence = 0;
+
+        for (uint32 tick = 0; tick < ticks; ++tick)
+        {
+            auto start = Clock::now();
+            for (uint32 i = 0; i < packetsPerTick; ++i)
+            {
+                FillPacket(packet, sequence);
+                TransportResult sendResult = sender.SendTo(destination, packet);
+                while (sendResult == TransportResult::WouldBlock)
+                {
+                    // The send queue is full; the I/O thread frees it as it sends
+                    std::this_thread::yield();
+                    sendResult = sender.SendTo(destination, packet);
+                }
+                sequence++;
+                result.sent += sendResult == TransportResult::Success ? 1 : 0;
+            }
+            sender.Poll(0);
+            const double tickSendMs = ElapsedMs(start);
+
+            std::this_thread::sleep_for(kGameWork);
+
+            start = Clock::now();
+            drain.Drain(result);
+            const double tickReceiveMs = ElapsedMs(start);
+
+            sendMs += tickSendMs;
+            receiveMs += tickReceiveMs;
+            result.worstTickMs = std::max(result.worstTickMs, tickSendMs + tickReceiveMs);
+        }
+
+        // Collect stragglers without timing them
+        const auto deadline = Clock::now() + kDrainTimeout;
+        while (result.received < result.sent && Clock::now() < deadline)
+        {
+            sender.Poll(0);
+            if (drain.Drain(result) == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        result.sendUs = result.sent > 0 ? sendMs * 1000.0 / result.sent : 0.0;
+        result.receiveUs = result.received > 0 ? receiveMs * 1000.0 / result.received : 0.0;
+        result.senderStats = sender.GetIOStats();
+        result.receiverStats = receiver.GetIOStats();
+        result.ok = true;
+
+        sender.Shutdown();
+        receiver.Shutdown();
+        return result;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Log::Initialize();
+    RVX_CORE_INFO("UDP Transport Benchmark");
+
+    // Optional scale factor for the tick count, e.g. "UDPTransportBenchmark 0.1"
+    const float scale = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 1.0f;
+    const uint32 ticks = std::max(10u, static_cast<uint32>(kTicks * scale));
+
+    RVX_CORE_INFO("");
+    RVX_CORE_INFO("=== {} ticks of {} x {} byte datagrams over 127.0.0.1 ===", ticks, kPacketsPerTick, kPacketBytes);
+
+    int failures = 0;
+
+    const RunResult polled = Run(false, kPacketsPerTick, ticks);
+    const RunResult threaded = Run(true, kPacketsPerTick, ticks);
+
+    RVX_CORE_INFO("  {:<10} {:>10} {:>10} {:>8} {:>12} {:>12} {:>14}",
+                  "mode", "sent", "received", "lost", "send us/pkt", "recv us/pkt", "worst tick ms");
+    for (const auto& [name, result] : {std::pair{"polled", polled}, std::pair{"io thread", threaded}})
+    {
+        if (!result.ok)
+        {
+            failures++;
+            continue;
+        }
+
+        RVX_CORE_INFO("  {:<10} {:>10} {:>10} {:>8} {:>12.3f} {:>12.3f} {:>14.3f}",
+                      name, result.sent, result.received, result.sent - result.received,
+                      result.sendUs, result.receiveUs, result.worstTickMs);
+
+        if (result.invalid > 0)
+        {
+            RVX_CORE_ERROR("  {}: {} datagrams corrupted, duplicated or out of order", name, result.invalid);
+            failures++;
+        }
+    }
+
+    if (threaded.ok && threaded.ioThread)
+    {
+        const UDPIOStats& send = threaded.senderStats;
+        const UDPIOStats& receive = threaded.receiverStats;
+        RVX_CORE_INFO("  io thread: {:.1f} datagrams per sendmmsg, {:.1f} per recvmmsg, {} receive stalls",
+                      send.sendCalls > 0 ? static_cast<double>(send.packetsSent) / send.sendCalls : 0.0,
+                      receive.receiveCalls > 0 ? static_cast<double>(receive.packetsReceived) / receive.receiveCalls : 0.0,
+                      receive.receiveStalls);
+
+        if (threaded.received != threaded.sent)
+        {
+            RVX_CORE_ERROR("  io thread: {} of {} datagrams lost", threaded.sent - threaded.received, threaded.sent);
+            failures++;
+        }
+    }
+    else if (threaded.ok)
+    {
+        RVX_CORE_INFO("  io thread: not available on this platform, both runs were polled");
+    }
+
+    Log::Shutdown();
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+/**
+ * @file AnimationSubsystem.h
+ * @brief Batched, parallel animation evaluation for World
+ */
+
+#include "Core/Subsystem/WorldSubsystem.h"
+#include "Core/MathTypes.h"
+#include "Animation/Runtime/AnimationBatch.h"
+#include <unordered_map>
+#include <vector>
+
+namespace RVX
+{
+    class AnimatorComponent;
+
+    /**
+     * @brief Animation subsystem
+     *
+     * Takes pose evaluation away from individual AnimatorComponents:
+     * - Animators tick as before but only advance their state machines
+     * - Every animator waiting for a pose is evaluated in parallel jobs
+     * - Skinning matrices land in one palette for a single GPU upload
+     * - Optional distance LOD evaluates far characters every Nth frame
+     *
+     * Usage:
+     * @code
+     * auto* animation = world.AddSubsystem<AnimationSubsystem>();
+     * animation->SetLODLevels({{20.0f, 1}, {60.0f, 2}, {FLT_MAX, 4}});
+     *
+     * // Each frame, before world.Tick()
+     * animation->SetViewPosition(camera.GetPosition());
+     *
+     * // After world.Tick()
+     * UploadBones(animation->GetPalette());
+     * size_t firstBone = animation->GetPaletteOffset(animator);
+     * @endcode
+     */
+    class AnimationSubsystem : public WorldSubsystem
+    {
+    public:
+        /// Update rate for animators up to a distance from the view
+        struct LODLevel
+        {
+            float maxDistance = 0.0f;
+            uint32_t updateInterval = 1;
+        };
+
+        const char* GetName() const override { return "AnimationSubsystem"; }
+
+        void Initialize() override;
+        void Deinitialize() override;
+        void Tick(float deltaTime) override;
+        bool ShouldTick() const override { return true; }
+
+        // =====================================================================
+        // Update Rate LOD
+        // =====================================================================
+
+        /// Set LOD levels, nearest first; beyond the last level its interval
+        /// applies. Empty evaluates every animator every frame.
+        void SetLODLevels(std::vector<LODLevel> levels);
+        const std::vector<LODLevel>& GetLODLevels() const { return m_lodLevels; }
+
+        /// Position LOD distances are measured from
+        void SetViewPosition(const Vec3& position) { m_viewPosition = position; }
+        const Vec3& GetViewPosition() const { return m_viewPosition; }
+
+        // =====================================================================
+        // Output
+        // =====================================================================
+
+        /// Skinning matrices of every animator evaluated this frame
+        const std::vector<Mat4>& GetPalette() const { return m_batch.GetPalette(); }
+
+        /// First palette matrix of an animator (0 if it is not batched)
+        size_t GetPaletteOffset(const AnimatorComponent* animator) const;
+
+        /// The underlying batch, for statistics
+        const Animation::AnimationBatch& GetBatch() const { return m_batch; }
+
+    private:
+        struct TrackedAnimator
+        {
+            Animation::AnimationBatch::Handle handle = Animation::AnimationBatch::InvalidHandle;
+            Animation::AnimationStateMachine* stateMachine = nullptr;
+            uint64_t lastSeenFrame = 0;
+        };
+
+        uint32_t SelectUpdateInterval(float distance) const;
+        void ReleaseAnimators();
+
+        Animation::AnimationBatch m_batch;
+        std::unordered_map<AnimatorComponent*, TrackedAnimator> m_tracked;
+        std::vector<AnimatorComponent*> m_pending;
+        std::vector<LODLevel> m_lodLevels;
+        Vec3 m_viewPosition{0.0f};
+        uint64_t m_frame = 0;
+    };
+
+} // namespace RVX
@@ -39,6 +39,7 @@ namespace RVX
     {
         std::string name = "World";
         bool autoInitializeSpatial = true;
+        bool autoInitializeAnimation = false;   ///< Batch animators (AnimationSubsystem)
     };
 
     /**
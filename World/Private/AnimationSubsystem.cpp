@@ -0,0 +1,166 @@
+/**
+ * @file AnimationSubsystem.cpp
+ * @brief AnimationSubsystem implementation
+ */
+
+#include "World/AnimationSubsystem.h"
+#include "World/World.h"
+#include "Scene/SceneManager.h"
+#include "Scene/SceneEntity.h"
+#include "Scene/Components/AnimatorComponent.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+
+namespace RVX
+{
+
+void AnimationSubsystem::Initialize()
+{
+    RVX_CORE_INFO("AnimationSubsystem initialized");
+}
+
+void AnimationSubsystem::Deinitialize()
+{
+    RVX_CORE_DEBUG("AnimationSubsystem deinitializing...");
+    ReleaseAnimators();
+    RVX_CORE_INFO("AnimationSubsystem deinitialized");
+}
+
+void AnimationSubsystem::Tick(float deltaTime)
+{
+    (void)deltaTime;
+
+    World* world = GetWorld();
+    SceneManager* scene = world ? world->GetSceneManager() : nullptr;
+    if (!scene)
+        return;
+
+    m_frame++;
+    m_pending.clear();
+
+    // Gather animators whose Tick advanced their state machine this frame
+    scene->ForEachActiveEntity([this](SceneEntity* entity) {
+        auto* animator = entity->GetComponent<AnimatorComponent>();
+        if (!animator)
+            return;
+
+        // Already evaluated itself this frame; batched from the next one
+        if (!animator->IsBatchedEvaluation())
+        {
+            animator->SetBatchedEvaluation(true);
+            return;
+        }
+        if (!animator->IsAwaitingBatchedPose())
+            return;
+
+        Animation::AnimationStateMachine* stateMachine = animator->GetStateMachine().get();
+        auto it = m_tracked.find(animator);
+        if (it != m_tracked.end() && it->second.stateMachine != stateMachine)
+        {
+            m_batch.Remove(it->second.handle);
+            m_tracked.erase(it);
+            it = m_tracked.end();
+        }
+        if (!stateMachine)
+            return;
+
+        if (it == m_tracked.end())
+        {
+            TrackedAnimator tracked;
+            tracked.handle = m_batch.Add(stateMachine);
+            tracked.stateMachine = stateMachine;
+            it = m_tracked.emplace(animator, tracked).first;
+        }
+        it->second.lastSeenFrame = m_frame;
+
+        if (!m_lodLevels.empty())
+        {
+            const float distance = length(entity->GetWorldPosition() - m_viewPosition);
+            m_batch.SetUpdateInterval(it->second.handle, SelectUpdateInterval(distance));
+        }
+        m_pending.push_back(animator);
+    });
+
+    // Drop animators that were removed, culled or stopped
+    for (auto it = m_tracked.begin(); it != m_tracked.end();)
+    {
+        if (it->second.lastSeenFrame != m_frame)
+        {
+            m_batch.Remove(it->second.handle);
+            it = m_tracked.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    m_batch.Evaluate();
+
+    // Hand poses back on this thread: skeleton updates and callbacks are not thread-safe
+    for (AnimatorComponent* animator : m_pending)
+    {
+        const Animation::SkeletonPose* pose = m_batch.GetPose(m_tracked[animator].handle);
+        if (pose)
+        {
+            animator->ApplyBatchedPose(*pose);
+        }
+    }
+}
+
+void AnimationSubsystem::SetLODLevels(std::vector<LODLevel> levels)
+{
+    std::sort(levels.begin(), levels.end(),
+        [](const LODLevel& a, const LODLevel& b) { return a.maxDistance < b.maxDistance; });
+    m_lodLevels = std::move(levels);
+
+    if (m_lodLevels.empty())
+    {
+        for (const auto& [animator, tracked] : m_tracked)
+        {
+            m_batch.SetUpdateInterval(tracked.handle, 1);
+        }
+    }
+}
+
+size_t AnimationSubsystem::GetPaletteOffset(const AnimatorComponent* animator) const
+{
+    auto it = m_tracked.find(const_cast<AnimatorComponent*>(animator));
+    return it != m_tracked.end() ? m_batch.GetPaletteOffset(it->second.handle) : 0;
+}
+
+uint32_t AnimationSubsystem::SelectUpdateInterval(float distance) const
+{
+    for (const LODLevel& level : m_lodLevels)
+    {
+        if (distance <= level.maxDistance)
+        {
+            return level.updateInterval;
+        }
+    }
+    return m_lodLevels.back().updateInterval;
+}
+
+void AnimationSubsystem::ReleaseAnimators()
+{
+    // Hand evaluation back to the components
+    World* world = GetWorld();
+    SceneManager* scene = world ? world->GetSceneManager() : nullptr;
+    if (scene)
+    {
+        for (const auto& [handle, entity] : scene->GetEntities())
+        {
+            if (auto* animator = entity->GetComponent<AnimatorComponent>())
+            {
+                animator->SetBatchedEvaluation(false);
+            }
+        }
+    }
+
+    m_batch.Clear();
+    m_tracked.clear();
+    m_pending.clear();
+}
+
+} // namespace RVX
@@ -12,6 +12,7 @@
 #include "Scene/ActorFactory.h"
 #include "Scene/SceneManager.h"
 #include "World/SpatialSubsystem.h"
+#include "World/AnimationSubsystem.h"
 
 #include <algorithm>
 
@@ -50,6 +51,12 @@ void World::Initialize(const WorldConfig& config)
         AddSubsystem<SpatialSubsystem>();
     }
 
+    // Add animation subsystem
+    if (m_config.autoInitializeAnimation)
+    {
+        AddSubsystem<AnimationSubsystem>();
+    }
+
     // Initialize all subsystems
     m_subsystems.InitializeAll();
 